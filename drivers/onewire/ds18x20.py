@@ -37,7 +37,21 @@ class DS18X20:
         self.ow.write(buf)
 
     def read_temp(self, rom):
-        buf = self.read_scratch(rom)
+        return self._temp(rom, self.read_scratch(rom))
+
+    def read_temps(self, roms):
+        # Read all the given sensors in one go, after a single convert_temp();
+        # a sensor whose scratchpad fails its CRC check gives None.
+        buf = bytearray(9 * len(roms))
+        ok = self.ow.read_roms(roms, _RD_SCRATCH, buf)
+        mv = memoryview(buf)
+        return [
+            self._temp(rom, mv[9 * i : 9 * i + 9]) if ok[i] else None
+            for i, rom in enumerate(roms)
+        ]
+
+    @staticmethod
+    def _temp(rom, buf):
         if rom[0] == 0x10:
             if buf[1]:
                 t = buf[0] >> 1 | 0x80
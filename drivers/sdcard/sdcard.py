@@ -18,6 +18,10 @@ Example usage on ESP8266:
     os.mount(sd, '/sd')
     os.listdir('/')
 
+If the firmware includes the _sdcard module (a C version of this driver, which
+uses multi-block transfers and the port's DMA SPI where available) then SDCard
+is taken from there instead.
+
 """
 
 from micropython import const
@@ -296,3 +300,9 @@ class SDCard:
             return self.sectors
         if op == 5:  # get block size in bytes
             return 512
+
+
+try:
+    from _sdcard import SDCard
+except ImportError:
+    pass
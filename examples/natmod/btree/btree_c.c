@@ -98,7 +98,7 @@ mp_obj_type_t btree_type;
 
 #include "extmod/modbtree.c"
 
-mp_map_elem_t btree_locals_dict_table[8];
+mp_map_elem_t btree_locals_dict_table[9];
 STATIC MP_DEFINE_CONST_DICT(btree_locals_dict, btree_locals_dict_table);
 
 STATIC mp_obj_t btree_open(size_t n_args, const mp_obj_t *args) {
@@ -137,6 +137,7 @@ mp_obj_t mpy_init(mp_obj_fun_bc_t *self, size_t n_args, size_t n_kw, mp_obj_t *a
     btree_locals_dict_table[5] = (mp_map_elem_t){ MP_OBJ_NEW_QSTR(MP_QSTR_keys), MP_OBJ_FROM_PTR(&btree_keys_obj) };
     btree_locals_dict_table[6] = (mp_map_elem_t){ MP_OBJ_NEW_QSTR(MP_QSTR_values), MP_OBJ_FROM_PTR(&btree_values_obj) };
     btree_locals_dict_table[7] = (mp_map_elem_t){ MP_OBJ_NEW_QSTR(MP_QSTR_items), MP_OBJ_FROM_PTR(&btree_items_obj) };
+    btree_locals_dict_table[8] = (mp_map_elem_t){ MP_OBJ_NEW_QSTR(MP_QSTR_get_into), MP_OBJ_FROM_PTR(&btree_get_into_obj) };
     btree_type.locals_dict = (void*)&btree_locals_dict;
 
     mp_store_global(MP_QSTR__open, MP_OBJ_FROM_PTR(&btree_open_obj));
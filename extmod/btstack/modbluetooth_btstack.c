@@ -1185,6 +1185,14 @@ int mp_bluetooth_gatts_set_buffer(uint16_t value_handle, size_t len, bool append
     return mp_bluetooth_gatts_db_resize(MP_STATE_PORT(bluetooth_btstack_root_pointers)->gatts_db, value_handle, len, append);
 }
 
+int mp_bluetooth_gatts_set_buffer_obj(uint16_t value_handle, mp_obj_t owner, uint8_t *buf, size_t len, bool append) {
+    DEBUG_printf("mp_bluetooth_gatts_set_buffer_obj\n");
+    if (!mp_bluetooth_is_active()) {
+        return ERRNO_BLUETOOTH_NOT_ACTIVE;
+    }
+    return mp_bluetooth_gatts_db_set_buffer_obj(MP_STATE_PORT(bluetooth_btstack_root_pointers)->gatts_db, value_handle, owner, buf, len, append);
+}
+
 int mp_bluetooth_get_preferred_mtu(void) {
     if (!mp_bluetooth_is_active()) {
         mp_raise_OSError(ERRNO_BLUETOOTH_NOT_ACTIVE);
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef MICROPY_INCLUDED_EXTMOD_CRYPTO_HW_H
+#define MICROPY_INCLUDED_EXTMOD_CRYPTO_HW_H
+
+#include "py/mpconfig.h"
+
+// Hooks for a port to run uhashlib and ucryptolib on a hardware crypto engine.
+// Each hook is enabled by its config option and implemented by the port.  A
+// hook returns false if the engine can't take the request (it's busy, absent
+// on this chip, or the buffers aren't suitable for DMA) and then the software
+// implementation is used instead.  Builds using mbedtls accelerate TLS itself
+// through mbedtls's own MBEDTLS_*_ALT options in the port's mbedtls config.
+
+#if MICROPY_HW_CRYPTO_SHA256
+// Update the SHA-256 chaining state (8 words, in host byte order) with nblocks
+// consecutive 64-byte blocks of data.
+bool mp_hw_sha256_blocks(uint32_t state[8], const uint8_t *data, size_t nblocks);
+#endif
+
+#if MICROPY_HW_CRYPTO_AES
+// same values as the ucryptolib modes
+#define MP_HW_AES_MODE_ECB (1)
+#define MP_HW_AES_MODE_CBC (2)
+
+// Encrypt or decrypt len bytes (a multiple of 16) from in to out, which may be
+// the same buffer, with the given 16 or 32 byte key.  For CBC mode iv is
+// updated to continue the chain with the next call, and is NULL for ECB.
+bool mp_hw_aes_crypt(const uint8_t *key, size_t key_len, int mode, bool encrypt,
+    uint8_t *iv, const uint8_t *in, uint8_t *out, size_t len);
+#endif
+
+#endif // MICROPY_INCLUDED_EXTMOD_CRYPTO_HW_H
@@ -18,6 +18,7 @@ set(MICROPY_SOURCE_EXTMOD
     ${MICROPY_EXTMOD_DIR}/modframebuf.c
     ${MICROPY_EXTMOD_DIR}/modnetwork.c
     ${MICROPY_EXTMOD_DIR}/modonewire.c
+    ${MICROPY_EXTMOD_DIR}/modsdcard.c
     ${MICROPY_EXTMOD_DIR}/moduasyncio.c
     ${MICROPY_EXTMOD_DIR}/modubinascii.c
     ${MICROPY_EXTMOD_DIR}/moducryptolib.c
@@ -34,6 +35,7 @@ set(MICROPY_SOURCE_EXTMOD
     ${MICROPY_EXTMOD_DIR}/modussl_axtls.c
     ${MICROPY_EXTMOD_DIR}/modussl_mbedtls.c
     ${MICROPY_EXTMOD_DIR}/modutimeq.c
+    ${MICROPY_EXTMOD_DIR}/modutimerwheel.c
     ${MICROPY_EXTMOD_DIR}/moduwebsocket.c
     ${MICROPY_EXTMOD_DIR}/moduzlib.c
     ${MICROPY_EXTMOD_DIR}/modwebrepl.c
@@ -44,6 +46,7 @@ set(MICROPY_SOURCE_EXTMOD
     ${MICROPY_EXTMOD_DIR}/vfs_fat.c
     ${MICROPY_EXTMOD_DIR}/vfs_fat_diskio.c
     ${MICROPY_EXTMOD_DIR}/vfs_fat_file.c
+    ${MICROPY_EXTMOD_DIR}/vfs_filebuf.c
     ${MICROPY_EXTMOD_DIR}/vfs_lfs.c
     ${MICROPY_EXTMOD_DIR}/vfs_posix.c
     ${MICROPY_EXTMOD_DIR}/vfs_posix_file.c
@@ -187,6 +190,12 @@ if(MICROPY_SSL_MBEDTLS)
         MBEDTLS_CONFIG_FILE="${MICROPY_PORT_DIR}/mbedtls/mbedtls_config.h"
     )
 
+    if(MICROPY_SSL_MBEDTLS_FAST_ECC)
+        target_compile_definitions(micropy_lib_mbedtls INTERFACE
+            MICROPY_SSL_MBEDTLS_FAST_ECC=1
+        )
+    endif()
+
     list(APPEND MICROPY_INC_CORE
         "${MICROPY_LIB_MBEDTLS_DIR}/include"
     )
@@ -68,6 +68,9 @@ SRC_MOD += $(addprefix $(AXTLS_DIR)/,\
 else ifeq ($(MICROPY_SSL_MBEDTLS),1)
 MBEDTLS_DIR = lib/mbedtls
 CFLAGS_MOD += -DMICROPY_SSL_MBEDTLS=1 -I$(TOP)/$(MBEDTLS_DIR)/include
+ifeq ($(MICROPY_SSL_MBEDTLS_FAST_ECC),1)
+CFLAGS_MOD += -DMICROPY_SSL_MBEDTLS_FAST_ECC=1
+endif
 SRC_MOD += $(addprefix $(MBEDTLS_DIR)/library/,\
 	aes.c \
 	aesni.c \
@@ -32,6 +32,10 @@
 
 void machine_bitstream_high_low(mp_hal_pin_obj_t pin, uint32_t *timing_ns, const uint8_t *buf, size_t len);
 
+// For ports that output in the background: wait for the output to finish and
+// release the hardware used, on soft reset.
+void machine_bitstream_deinit(void);
+
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(machine_bitstream_obj);
 
 #endif // MICROPY_INCLUDED_EXTMOD_MACHINE_BITSTREAM_H
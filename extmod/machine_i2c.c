@@ -627,6 +627,48 @@ STATIC mp_obj_t machine_i2c_writeto_mem(size_t n_args, const mp_obj_t *pos_args,
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(machine_i2c_writeto_mem_obj, 1, machine_i2c_writeto_mem);
 
+// Do a list of (addr, memaddr, buf, op[, addrsize]) operations back to back,
+// where op is READ or WRITE and memaddr is None for a plain read or write.
+STATIC mp_obj_t machine_i2c_transact(mp_obj_t self_in, mp_obj_t ops_in) {
+    mp_obj_base_t *self = (mp_obj_base_t *)MP_OBJ_TO_PTR(self_in);
+    size_t n_ops;
+    mp_obj_t *ops;
+    mp_obj_get_array(ops_in, &n_ops, &ops);
+    for (size_t i = 0; i < n_ops; ++i) {
+        size_t n_items;
+        mp_obj_t *items;
+        mp_obj_get_array(ops[i], &n_items, &items);
+        if (n_items != 4 && n_items != 5) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid I2C operation"));
+        }
+        uint16_t addr = mp_obj_get_int(items[0]);
+        bool read = mp_obj_get_int(items[3]) & MP_MACHINE_I2C_FLAG_READ;
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(items[2], &bufinfo, read ? MP_BUFFER_WRITE : MP_BUFFER_READ);
+        int ret;
+        if (items[1] == mp_const_none) {
+            if (read) {
+                ret = mp_machine_i2c_readfrom(self, addr, bufinfo.buf, bufinfo.len, true);
+            } else {
+                ret = mp_machine_i2c_writeto(self, addr, bufinfo.buf, bufinfo.len, true);
+            }
+        } else {
+            uint32_t memaddr = mp_obj_get_int(items[1]);
+            uint8_t addrsize = n_items == 5 ? mp_obj_get_int(items[4]) : 8;
+            if (read) {
+                ret = read_mem(self_in, addr, memaddr, addrsize, bufinfo.buf, bufinfo.len);
+            } else {
+                ret = write_mem(self_in, addr, memaddr, addrsize, bufinfo.buf, bufinfo.len);
+            }
+        }
+        if (ret < 0) {
+            mp_raise_OSError(-ret);
+        }
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(machine_i2c_transact_obj, machine_i2c_transact);
+
 STATIC const mp_rom_map_elem_t machine_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_init), MP_ROM_PTR(&machine_i2c_init_obj) },
     { MP_ROM_QSTR(MP_QSTR_scan), MP_ROM_PTR(&machine_i2c_scan_obj) },
@@ -647,6 +689,11 @@ STATIC const mp_rom_map_elem_t machine_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readfrom_mem), MP_ROM_PTR(&machine_i2c_readfrom_mem_obj) },
     { MP_ROM_QSTR(MP_QSTR_readfrom_mem_into), MP_ROM_PTR(&machine_i2c_readfrom_mem_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto_mem), MP_ROM_PTR(&machine_i2c_writeto_mem_obj) },
+
+    // lists of operations
+    { MP_ROM_QSTR(MP_QSTR_transact), MP_ROM_PTR(&machine_i2c_transact_obj) },
+    { MP_ROM_QSTR(MP_QSTR_READ), MP_ROM_INT(MP_MACHINE_I2C_FLAG_READ) },
+    { MP_ROM_QSTR(MP_QSTR_WRITE), MP_ROM_INT(0) },
 };
 MP_DEFINE_CONST_DICT(mp_machine_i2c_locals_dict, machine_i2c_locals_dict_table);
 
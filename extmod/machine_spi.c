@@ -28,6 +28,8 @@
 #include <string.h>
 
 #include "py/runtime.h"
+#include "py/stream.h"
+#include "py/mperrno.h"
 #include "extmod/machine_spi.h"
 
 // if a port didn't define MSB/LSB constants then provide them
@@ -59,9 +61,69 @@ STATIC mp_obj_t machine_spi_deinit(mp_obj_t self) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(machine_spi_deinit_obj, machine_spi_deinit);
 
+#if MICROPY_PY_MACHINE_SPI_ASYNC
+
+// An SPI transfer started by write_async() or transfer_async().  While it is
+// busy it is on the MP_STATE_VM(machine_spi_transfers) list, so that it and
+// its buffers are not reclaimed even if the caller drops the transfer object.
+typedef struct _mp_machine_spi_transfer_obj_t {
+    mp_obj_base_t base;
+    mp_obj_t spi;
+    mp_obj_t src;
+    mp_obj_t dest;
+    struct _mp_machine_spi_transfer_obj_t *next;
+    bool busy;
+} mp_machine_spi_transfer_obj_t;
+
+STATIC const mp_obj_type_t mp_machine_spi_transfer_type;
+
+// Check whether a transfer is still running, and release it if not.
+STATIC bool machine_spi_transfer_busy(mp_machine_spi_transfer_obj_t *self) {
+    if (!self->busy) {
+        return false;
+    }
+    mp_obj_base_t *s = (mp_obj_base_t *)MP_OBJ_TO_PTR(self->spi);
+    mp_machine_spi_p_t *spi_p = (mp_machine_spi_p_t *)s->type->protocol;
+    if (spi_p->transfer_busy(s)) {
+        return true;
+    }
+    self->busy = false;
+    self->src = mp_const_none;
+    self->dest = mp_const_none;
+    mp_machine_spi_transfer_obj_t **t = &MP_STATE_VM(machine_spi_transfers);
+    while (*t != self) {
+        t = &(*t)->next;
+    }
+    *t = self->next;
+    return false;
+}
+
+STATIC void machine_spi_transfer_block(mp_machine_spi_transfer_obj_t *self) {
+    while (machine_spi_transfer_busy(self)) {
+        MICROPY_EVENT_POLL_HOOK
+    }
+}
+
+// Wait for any transfer started asynchronously on the given bus to finish.
+void mp_machine_spi_wait_bus(mp_obj_t spi) {
+    mp_machine_spi_transfer_obj_t *t = MP_STATE_VM(machine_spi_transfers);
+    while (t != NULL) {
+        mp_machine_spi_transfer_obj_t *next = t->next;
+        if (t->spi == spi) {
+            machine_spi_transfer_block(t);
+        }
+        t = next;
+    }
+}
+
+#endif
+
 STATIC void mp_machine_spi_transfer(mp_obj_t self, size_t len, const void *src, void *dest) {
     mp_obj_base_t *s = (mp_obj_base_t *)MP_OBJ_TO_PTR(self);
     mp_machine_spi_p_t *spi_p = (mp_machine_spi_p_t *)s->type->protocol;
+    #if MICROPY_PY_MACHINE_SPI_ASYNC
+    mp_machine_spi_wait_bus(self);
+    #endif
     spi_p->transfer(s, len, src, dest);
 }
 
@@ -104,6 +166,97 @@ STATIC mp_obj_t mp_machine_spi_write_readinto(mp_obj_t self, mp_obj_t wr_buf, mp
 }
 MP_DEFINE_CONST_FUN_OBJ_3(mp_machine_spi_write_readinto_obj, mp_machine_spi_write_readinto);
 
+#if MICROPY_PY_MACHINE_SPI_ASYNC
+
+// Start a transfer and return an object to check for its completion.  A
+// transfer already running on the bus is waited for first, so two buffers
+// can be used in turn: one being sent while the other is being filled.
+STATIC mp_obj_t mp_machine_spi_start_async(mp_obj_t self, mp_obj_t wr_buf, mp_obj_t rd_buf) {
+    mp_buffer_info_t src;
+    mp_get_buffer_raise(wr_buf, &src, MP_BUFFER_READ);
+    mp_buffer_info_t dest = { .buf = NULL };
+    if (rd_buf != mp_const_none) {
+        mp_get_buffer_raise(rd_buf, &dest, MP_BUFFER_WRITE);
+        if (src.len != dest.len) {
+            mp_raise_ValueError(MP_ERROR_TEXT("buffers must be the same length"));
+        }
+    }
+
+    mp_machine_spi_transfer_obj_t *t = mp_obj_malloc(mp_machine_spi_transfer_obj_t, &mp_machine_spi_transfer_type);
+    t->spi = self;
+    t->src = wr_buf;
+    t->dest = rd_buf;
+    t->next = NULL;
+    t->busy = false;
+
+    mp_obj_base_t *s = (mp_obj_base_t *)MP_OBJ_TO_PTR(self);
+    mp_machine_spi_p_t *spi_p = (mp_machine_spi_p_t *)s->type->protocol;
+    mp_machine_spi_wait_bus(self);
+    if (spi_p->transfer_start == NULL) {
+        // the port can't transfer in the background, so it's done by now
+        spi_p->transfer(s, src.len, src.buf, dest.buf);
+    } else {
+        spi_p->transfer_start(s, src.len, src.buf, dest.buf);
+        t->busy = true;
+        t->next = MP_STATE_VM(machine_spi_transfers);
+        MP_STATE_VM(machine_spi_transfers) = t;
+    }
+    return MP_OBJ_FROM_PTR(t);
+}
+
+STATIC mp_obj_t mp_machine_spi_write_async(mp_obj_t self, mp_obj_t wr_buf) {
+    return mp_machine_spi_start_async(self, wr_buf, mp_const_none);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(mp_machine_spi_write_async_obj, mp_machine_spi_write_async);
+
+STATIC mp_obj_t mp_machine_spi_transfer_async(mp_obj_t self, mp_obj_t wr_buf, mp_obj_t rd_buf) {
+    return mp_machine_spi_start_async(self, wr_buf, rd_buf);
+}
+MP_DEFINE_CONST_FUN_OBJ_3(mp_machine_spi_transfer_async_obj, mp_machine_spi_transfer_async);
+
+STATIC mp_obj_t machine_spi_transfer_done(mp_obj_t self_in) {
+    return mp_obj_new_bool(!machine_spi_transfer_busy(MP_OBJ_TO_PTR(self_in)));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(machine_spi_transfer_done_obj, machine_spi_transfer_done);
+
+STATIC mp_obj_t machine_spi_transfer_wait(mp_obj_t self_in) {
+    machine_spi_transfer_block(MP_OBJ_TO_PTR(self_in));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(machine_spi_transfer_wait_obj, machine_spi_transfer_wait);
+
+// Polling a transfer reports it as readable and writable once it's finished,
+// so it can be waited on with select.poll.
+STATIC mp_uint_t machine_spi_transfer_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    if (request == MP_STREAM_POLL) {
+        if (machine_spi_transfer_busy(MP_OBJ_TO_PTR(self_in))) {
+            return 0;
+        }
+        return arg & (MP_STREAM_POLL_RD | MP_STREAM_POLL_WR);
+    }
+    *errcode = MP_EINVAL;
+    return MP_STREAM_ERROR;
+}
+
+STATIC const mp_rom_map_elem_t machine_spi_transfer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_done), MP_ROM_PTR(&machine_spi_transfer_done_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&machine_spi_transfer_wait_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(machine_spi_transfer_locals_dict, machine_spi_transfer_locals_dict_table);
+
+STATIC const mp_stream_p_t machine_spi_transfer_stream_p = {
+    .ioctl = machine_spi_transfer_ioctl,
+};
+
+STATIC const mp_obj_type_t mp_machine_spi_transfer_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_SPITransfer,
+    .protocol = &machine_spi_transfer_stream_p,
+    .locals_dict = (mp_obj_dict_t *)&machine_spi_transfer_locals_dict,
+};
+
+#endif // MICROPY_PY_MACHINE_SPI_ASYNC
+
 STATIC const mp_rom_map_elem_t machine_spi_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_init), MP_ROM_PTR(&machine_spi_init_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&machine_spi_deinit_obj) },
@@ -111,6 +264,10 @@ STATIC const mp_rom_map_elem_t machine_spi_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_machine_spi_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_machine_spi_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_readinto), MP_ROM_PTR(&mp_machine_spi_write_readinto_obj) },
+    #if MICROPY_PY_MACHINE_SPI_ASYNC
+    { MP_ROM_QSTR(MP_QSTR_write_async), MP_ROM_PTR(&mp_machine_spi_write_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_transfer_async), MP_ROM_PTR(&mp_machine_spi_transfer_async_obj) },
+    #endif
 
     { MP_ROM_QSTR(MP_QSTR_MSB), MP_ROM_INT(MICROPY_PY_MACHINE_SPI_MSB) },
     { MP_ROM_QSTR(MP_QSTR_LSB), MP_ROM_INT(MICROPY_PY_MACHINE_SPI_LSB) },
@@ -48,6 +48,11 @@ typedef struct _mp_machine_spi_p_t {
     void (*init)(mp_obj_base_t *obj, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
     void (*deinit)(mp_obj_base_t *obj); // can be NULL
     void (*transfer)(mp_obj_base_t *obj, size_t len, const uint8_t *src, uint8_t *dest);
+    // Optional: start a transfer (eg using DMA) and return without waiting for
+    // it.  The buffers stay valid, and no other transfer is started on the bus,
+    // until transfer_busy returns false.  Both can be NULL.
+    void (*transfer_start)(mp_obj_base_t *obj, size_t len, const uint8_t *src, uint8_t *dest);
+    bool (*transfer_busy)(mp_obj_base_t *obj);
 } mp_machine_spi_p_t;
 
 typedef struct _mp_machine_soft_spi_obj_t {
@@ -65,5 +70,10 @@ MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_machine_spi_read_obj);
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_machine_spi_readinto_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(mp_machine_spi_write_obj);
 MP_DECLARE_CONST_FUN_OBJ_3(mp_machine_spi_write_readinto_obj);
+#if MICROPY_PY_MACHINE_SPI_ASYNC
+void mp_machine_spi_wait_bus(mp_obj_t spi);
+MP_DECLARE_CONST_FUN_OBJ_2(mp_machine_spi_write_async_obj);
+MP_DECLARE_CONST_FUN_OBJ_3(mp_machine_spi_transfer_async_obj);
+#endif
 
 #endif // MICROPY_INCLUDED_EXTMOD_MACHINE_SPI_H
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef MICROPY_INCLUDED_EXTMOD_MBEDTLS_MBEDTLS_CONFIG_FAST_ECC_H
+#define MICROPY_INCLUDED_EXTMOD_MBEDTLS_MBEDTLS_CONFIG_FAST_ECC_H
+
+// mbedtls configuration profile for fast handshakes on microcontrollers, used
+// by a port's mbedtls_config.h when built with MICROPY_SSL_MBEDTLS_FAST_ECC=1.
+// It replaces the RSA key exchange (and TLS 1.0 and 1.1) with ECDHE over the
+// P-256 curve only, which is the profile selected at runtime by
+// ussl.PROFILE_ECDSA_P256.  Servers with RSA certificates can still be reached
+// using ECDHE-RSA.
+
+// ECDHE key exchange, with ECDSA or RSA certificates
+#define MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
+#define MBEDTLS_KEY_EXCHANGE_ECDHE_RSA_ENABLED
+#define MBEDTLS_ASN1_WRITE_C
+#define MBEDTLS_ECDH_C
+#define MBEDTLS_ECDSA_C
+#define MBEDTLS_ECP_C
+#define MBEDTLS_GCM_C
+
+// Only P-256, with its fast NIST reduction, and fixed-point comb tables for
+// multiplying the generator, which speeds up signing and key generation.
+#define MBEDTLS_ECP_DP_SECP256R1_ENABLED
+#define MBEDTLS_ECP_NIST_OPTIM
+#define MBEDTLS_ECP_FIXED_POINT_OPTIM (1)
+#define MBEDTLS_ECP_MAX_BITS (256)
+#define MBEDTLS_ECP_WINDOW_SIZE (4)
+
+// Allow the client to negotiate a smaller record size with the server (the
+// max_fragment_length argument of ussl), and shrink the record buffers to it
+// once the handshake is over.
+#define MBEDTLS_SSL_MAX_FRAGMENT_LENGTH
+#define MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH
+
+#endif // MICROPY_INCLUDED_EXTMOD_MBEDTLS_MBEDTLS_CONFIG_FAST_ECC_H
@@ -41,8 +41,14 @@ uintptr_t mp_uos_dupterm_poll(uintptr_t poll_flags);
 int mp_uos_dupterm_rx_chr(void);
 void mp_uos_dupterm_tx_strn(const char *str, size_t len);
 void mp_uos_deactivate(size_t dupterm_idx, const char *msg, mp_obj_t exc);
+#if MICROPY_PY_OS_DUPTERM_TX_BUF_SIZE
+void mp_uos_dupterm_tx_flush(void);
+#else
+#define mp_uos_dupterm_tx_flush()
+#endif
 #else
 #define mp_uos_dupterm_tx_strn(s, l)
+#define mp_uos_dupterm_tx_flush()
 #endif
 
 #endif // MICROPY_INCLUDED_EXTMOD_MISC_H
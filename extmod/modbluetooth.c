@@ -766,6 +766,37 @@ STATIC mp_obj_t bluetooth_ble_gatts_notify(size_t n_args, const mp_obj_t *args)
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(bluetooth_ble_gatts_notify_obj, 3, 4, bluetooth_ble_gatts_notify);
 
+// Send the same notification to each of a sequence of connections.  All of
+// them are tried, and the first error (if any) is raised at the end.
+STATIC mp_obj_t bluetooth_ble_gatts_notify_many(size_t n_args, const mp_obj_t *args) {
+    size_t n_conn;
+    mp_obj_t *conn_handles;
+    mp_obj_get_array(args[1], &n_conn, &conn_handles);
+    mp_int_t value_handle = mp_obj_get_int(args[2]);
+
+    mp_buffer_info_t bufinfo = {0};
+    bool send_data = n_args == 4 && args[3] != mp_const_none;
+    if (send_data) {
+        mp_get_buffer_raise(args[3], &bufinfo, MP_BUFFER_READ);
+    }
+
+    int first_err = 0;
+    for (size_t i = 0; i < n_conn; ++i) {
+        mp_int_t conn_handle = mp_obj_get_int(conn_handles[i]);
+        int err;
+        if (send_data) {
+            err = mp_bluetooth_gatts_notify_send(conn_handle, value_handle, bufinfo.buf, bufinfo.len);
+        } else {
+            err = mp_bluetooth_gatts_notify(conn_handle, value_handle);
+        }
+        if (first_err == 0) {
+            first_err = err;
+        }
+    }
+    return bluetooth_handle_errno(first_err);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(bluetooth_ble_gatts_notify_many_obj, 3, 4, bluetooth_ble_gatts_notify_many);
+
 STATIC mp_obj_t bluetooth_ble_gatts_indicate(mp_obj_t self_in, mp_obj_t conn_handle_in, mp_obj_t value_handle_in) {
     (void)self_in;
     mp_int_t conn_handle = mp_obj_get_int(conn_handle_in);
@@ -778,8 +809,14 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_3(bluetooth_ble_gatts_indicate_obj, bluetooth_ble
 
 STATIC mp_obj_t bluetooth_ble_gatts_set_buffer(size_t n_args, const mp_obj_t *args) {
     mp_int_t value_handle = mp_obj_get_int(args[1]);
-    mp_int_t len = mp_obj_get_int(args[2]);
     bool append = n_args >= 4 && mp_obj_is_true(args[3]);
+    if (!mp_obj_is_int(args[2])) {
+        // Use the caller's buffer to hold the value.
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_RW);
+        return bluetooth_handle_errno(mp_bluetooth_gatts_set_buffer_obj(value_handle, args[2], bufinfo.buf, bufinfo.len, append));
+    }
+    mp_int_t len = mp_obj_get_int(args[2]);
     return bluetooth_handle_errno(mp_bluetooth_gatts_set_buffer(value_handle, len, append));
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(bluetooth_ble_gatts_set_buffer_obj, 3, 4, bluetooth_ble_gatts_set_buffer);
@@ -953,6 +990,7 @@ STATIC const mp_rom_map_elem_t bluetooth_ble_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_gatts_read), MP_ROM_PTR(&bluetooth_ble_gatts_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_gatts_write), MP_ROM_PTR(&bluetooth_ble_gatts_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_gatts_notify), MP_ROM_PTR(&bluetooth_ble_gatts_notify_obj) },
+    { MP_ROM_QSTR(MP_QSTR_gatts_notify_many), MP_ROM_PTR(&bluetooth_ble_gatts_notify_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_gatts_indicate), MP_ROM_PTR(&bluetooth_ble_gatts_indicate_obj) },
     { MP_ROM_QSTR(MP_QSTR_gatts_set_buffer), MP_ROM_PTR(&bluetooth_ble_gatts_set_buffer_obj) },
     #if MICROPY_PY_BLUETOOTH_ENABLE_GATT_CLIENT
@@ -1609,6 +1647,7 @@ void mp_bluetooth_gatts_db_create_entry(mp_gatts_db_t db, uint16_t handle, size_
     entry->data_alloc = len;
     entry->data_len = 0;
     entry->append = false;
+    entry->data_owner = MP_OBJ_NULL;
     elem->value = MP_OBJ_FROM_PTR(entry);
 }
 
@@ -1639,6 +1678,11 @@ int mp_bluetooth_gatts_db_write(mp_gatts_db_t db, uint16_t handle, const uint8_t
     mp_bluetooth_gatts_db_entry_t *entry = mp_bluetooth_gatts_db_lookup(db, handle);
     if (entry) {
         if (value_len > entry->data_alloc) {
+            if (entry->data_owner != MP_OBJ_NULL) {
+                // A caller-owned buffer can't grow.
+                MICROPY_PY_BLUETOOTH_EXIT
+                return MP_EINVAL;
+            }
             uint8_t *data = m_new_maybe(uint8_t, value_len);
             if (data) {
                 entry->data = data;
@@ -1660,12 +1704,19 @@ int mp_bluetooth_gatts_db_resize(mp_gatts_db_t db, uint16_t handle, size_t len,
     MICROPY_PY_BLUETOOTH_ENTER
     mp_bluetooth_gatts_db_entry_t *entry = mp_bluetooth_gatts_db_lookup(db, handle);
     if (entry) {
-        uint8_t *data = m_renew_maybe(uint8_t, entry->data, entry->data_alloc, len, true);
+        uint8_t *data;
+        if (entry->data_owner != MP_OBJ_NULL) {
+            // Go back to a buffer of our own.
+            data = m_new_maybe(uint8_t, len);
+        } else {
+            data = m_renew_maybe(uint8_t, entry->data, entry->data_alloc, len, true);
+        }
         if (data) {
             entry->data = data;
             entry->data_alloc = len;
             entry->data_len = 0;
             entry->append = append;
+            entry->data_owner = MP_OBJ_NULL;
         } else {
             MICROPY_PY_BLUETOOTH_EXIT
             return MP_ENOMEM;
@@ -1675,4 +1726,22 @@ int mp_bluetooth_gatts_db_resize(mp_gatts_db_t db, uint16_t handle, size_t len,
     return entry ? 0 : MP_EINVAL;
 }
 
+int mp_bluetooth_gatts_db_set_buffer_obj(mp_gatts_db_t db, uint16_t handle, mp_obj_t owner, uint8_t *buf, size_t len, bool append) {
+    MICROPY_PY_BLUETOOTH_ENTER
+    mp_bluetooth_gatts_db_entry_t *entry = mp_bluetooth_gatts_db_lookup(db, handle);
+    if (entry) {
+        if (entry->data_owner == MP_OBJ_NULL) {
+            m_del(uint8_t, entry->data, entry->data_alloc);
+        }
+        entry->data = buf;
+        entry->data_alloc = len;
+        // The whole buffer is the value, unless remote writes are appended to it.
+        entry->data_len = append ? 0 : len;
+        entry->append = append;
+        entry->data_owner = owner;
+    }
+    MICROPY_PY_BLUETOOTH_EXIT
+    return entry ? 0 : MP_EINVAL;
+}
+
 #endif // MICROPY_PY_BLUETOOTH
@@ -346,6 +346,9 @@ int mp_bluetooth_gatts_indicate(uint16_t conn_handle, uint16_t value_handle);
 // Resize and enable/disable append-mode on a value.
 // Append-mode means that remote writes will append and local reads will clear after reading.
 int mp_bluetooth_gatts_set_buffer(uint16_t value_handle, size_t len, bool append);
+// Store a value in a caller-owned buffer instead, so it can be updated in place
+// without a copy.  The owner object is kept alive while the buffer is in use.
+int mp_bluetooth_gatts_set_buffer_obj(uint16_t value_handle, mp_obj_t owner, uint8_t *buf, size_t len, bool append);
 
 // Disconnect from a central or peripheral.
 int mp_bluetooth_gap_disconnect(uint16_t conn_handle);
@@ -494,6 +497,8 @@ typedef struct {
     size_t data_len;
     // Whether new writes append or replace existing data (default false).
     bool append;
+    // Object owning data if it's a caller-owned buffer, otherwise MP_OBJ_NULL.
+    mp_obj_t data_owner;
 } mp_bluetooth_gatts_db_entry_t;
 
 typedef mp_map_t *mp_gatts_db_t;
@@ -511,5 +516,6 @@ mp_bluetooth_gatts_db_entry_t *mp_bluetooth_gatts_db_lookup(mp_gatts_db_t db, ui
 int mp_bluetooth_gatts_db_read(mp_gatts_db_t db, uint16_t handle, uint8_t **value, size_t *value_len);
 int mp_bluetooth_gatts_db_write(mp_gatts_db_t db, uint16_t handle, const uint8_t *value, size_t value_len);
 int mp_bluetooth_gatts_db_resize(mp_gatts_db_t db, uint16_t handle, size_t len, bool append);
+int mp_bluetooth_gatts_db_set_buffer_obj(mp_gatts_db_t db, uint16_t handle, mp_obj_t owner, uint8_t *buf, size_t len, bool append);
 
 #endif // MICROPY_INCLUDED_EXTMOD_MODBLUETOOTH_H
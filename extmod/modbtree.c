@@ -121,6 +121,61 @@ STATIC mp_obj_t btree_get(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(btree_get_obj, 2, 3, btree_get);
 
+// Copy the value for a key into a writable buffer, returning its length (or
+// None if the key is not present), to avoid allocating a bytes object.
+STATIC mp_obj_t btree_get_into(mp_obj_t self_in, mp_obj_t key_in, mp_obj_t buf_in) {
+    mp_obj_btree_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    DBT key, val;
+    key.data = (void *)mp_obj_str_get_data(key_in, &key.size);
+    int res = __bt_get(self->db, &key, &val, 0);
+    if (res == RET_SPECIAL) {
+        return mp_const_none;
+    }
+    CHECK_ERROR(res);
+    if (val.size > bufinfo.len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+    }
+    memcpy(bufinfo.buf, val.data, val.size);
+    return MP_OBJ_NEW_SMALL_INT(val.size);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(btree_get_into_obj, btree_get_into);
+
+#if !MICROPY_ENABLE_DYNRUNTIME
+// Store each (key, value) pair from an iterable.  If sorted is true then the
+// keys must be strictly ascending, which lets the btree library append to
+// the last leaf page and fill pages completely rather than splitting them.
+STATIC void btree_put_pairs(mp_obj_btree_t *self, mp_obj_t pairs_in, bool sorted) {
+    BTREE *t = self->db->internal;
+    DBT last_key = { NULL, 0 };
+    mp_obj_t last_key_obj = MP_OBJ_NULL; // keeps last_key.data alive
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(pairs_in, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        mp_obj_t *pair;
+        mp_obj_get_array_fixed_n(item, 2, &pair);
+        DBT key, val;
+        key.data = (void *)mp_obj_str_get_data(pair[0], &key.size);
+        val.data = (void *)mp_obj_str_get_data(pair[1], &val.size);
+        if (sorted && last_key_obj != MP_OBJ_NULL && t->bt_cmp(&last_key, &key) >= 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("keys not sorted"));
+        }
+        int res = __bt_put(self->db, &key, &val, 0);
+        CHECK_ERROR(res);
+        last_key = key;
+        last_key_obj = pair[0];
+    }
+}
+
+STATIC mp_obj_t btree_put_many(mp_obj_t self_in, mp_obj_t pairs_in) {
+    btree_put_pairs(MP_OBJ_TO_PTR(self_in), pairs_in, false);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(btree_put_many_obj, btree_put_many);
+#endif
+
 STATIC mp_obj_t btree_seq(size_t n_args, const mp_obj_t *args) {
     mp_obj_btree_t *self = MP_OBJ_TO_PTR(args[0]);
     int flags = MP_OBJ_SMALL_INT_VALUE(args[1]);
@@ -303,7 +358,9 @@ STATIC const mp_rom_map_elem_t btree_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&btree_close_obj) },
     { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&btree_flush_obj) },
     { MP_ROM_QSTR(MP_QSTR_get), MP_ROM_PTR(&btree_get_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_into), MP_ROM_PTR(&btree_get_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_put), MP_ROM_PTR(&btree_put_obj) },
+    { MP_ROM_QSTR(MP_QSTR_put_many), MP_ROM_PTR(&btree_put_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_seq), MP_ROM_PTR(&btree_seq_obj) },
     { MP_ROM_QSTR(MP_QSTR_keys), MP_ROM_PTR(&btree_keys_obj) },
     { MP_ROM_QSTR(MP_QSTR_values), MP_ROM_PTR(&btree_values_obj) },
@@ -366,9 +423,24 @@ STATIC mp_obj_t mod_btree_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_btree_open_obj, 1, mod_btree_open);
 
+// Open a new database on a stream and fill it from an iterable of (key, value)
+// pairs sorted by key.  Keyword arguments are as for open().
+STATIC mp_obj_t mod_btree_bulk_load(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    if (n_args != 2) {
+        mp_raise_TypeError(NULL);
+    }
+    mp_obj_t db = mod_btree_open(1, pos_args, kw_args);
+    mp_obj_btree_t *self = MP_OBJ_TO_PTR(db);
+    btree_put_pairs(self, pos_args[1], true);
+    CHECK_ERROR(__bt_sync(self->db, 0));
+    return db;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_btree_bulk_load_obj, 2, mod_btree_bulk_load);
+
 STATIC const mp_rom_map_elem_t mp_module_btree_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_btree) },
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&mod_btree_open_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bulk_load), MP_ROM_PTR(&mod_btree_bulk_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_INCL), MP_ROM_INT(FLAG_END_KEY_INCL) },
     { MP_ROM_QSTR(MP_QSTR_DESC), MP_ROM_INT(FLAG_DESC) },
 };
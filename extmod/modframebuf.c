@@ -39,6 +39,9 @@ typedef struct _mp_obj_framebuf_t {
     void *buf;
     uint16_t width, height, stride;
     uint8_t format;
+    // bounding box of the pixels drawn since dirty() was last called, with
+    // dirty_x1/dirty_y1 exclusive and dirty_x1 == 0 if there are none
+    uint16_t dirty_x0, dirty_y0, dirty_x1, dirty_y1;
 } mp_obj_framebuf_t;
 
 #if !MICROPY_ENABLE_DYNRUNTIME
@@ -127,12 +130,13 @@ STATIC uint32_t rgb565_getpixel(const mp_obj_framebuf_t *fb, unsigned int x, uns
 }
 
 STATIC void rgb565_fill_rect(const mp_obj_framebuf_t *fb, unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint32_t col) {
-    uint16_t *b = &((uint16_t *)fb->buf)[x + y * fb->stride];
-    while (h--) {
-        for (unsigned int ww = w; ww; --ww) {
-            *b++ = col;
-        }
-        b += fb->stride - w;
+    uint16_t *row = &((uint16_t *)fb->buf)[x + y * fb->stride];
+    for (unsigned int ww = 0; ww < w; ++ww) {
+        row[ww] = col;
+    }
+    // copy the first row to the rest
+    for (uint16_t *b = row + fb->stride; --h; b += fb->stride) {
+        memcpy(b, row, w * sizeof(uint16_t));
     }
 }
 
@@ -248,7 +252,100 @@ static inline uint32_t getpixel(const mp_obj_framebuf_t *fb, unsigned int x, uns
     return formats[fb->format].getpixel(fb, x, y);
 }
 
-STATIC void fill_rect(const mp_obj_framebuf_t *fb, int x, int y, int w, int h, uint32_t col) {
+// Extend the dirty rectangle to cover an area, already clipped to the framebuffer.
+STATIC void mark_dirty(mp_obj_framebuf_t *fb, unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+    if (w == 0 || h == 0) {
+        return;
+    }
+    if (fb->dirty_x1 == 0) {
+        fb->dirty_x0 = x;
+        fb->dirty_y0 = y;
+        fb->dirty_x1 = x + w;
+        fb->dirty_y1 = y + h;
+    } else {
+        fb->dirty_x0 = MIN(fb->dirty_x0, x);
+        fb->dirty_y0 = MIN(fb->dirty_y0, y);
+        fb->dirty_x1 = MAX(fb->dirty_x1, x + w);
+        fb->dirty_y1 = MAX(fb->dirty_y1, y + h);
+    }
+}
+
+STATIC void mark_dirty_clipped(mp_obj_framebuf_t *fb, int x, int y, int w, int h) {
+    int xend = MIN(fb->width, x + w);
+    int yend = MIN(fb->height, y + h);
+    x = MAX(x, 0);
+    y = MAX(y, 0);
+    if (x < xend && y < yend) {
+        mark_dirty(fb, x, y, xend - x, yend - y);
+    }
+}
+
+// Number of bits per pixel for formats that store each row of pixels in
+// consecutive bytes, or 0 for formats that don't.
+STATIC unsigned int row_bits_per_pixel(uint8_t format) {
+    switch (format) {
+        case FRAMEBUF_RGB565:
+            return 16;
+        case FRAMEBUF_GS8:
+            return 8;
+        case FRAMEBUF_GS4_HMSB:
+            return 4;
+        case FRAMEBUF_GS2_HMSB:
+            return 2;
+        case FRAMEBUF_MHLSB:
+        case FRAMEBUF_MHMSB:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Copy rows of bytes between framebuffers (or within one).  A port can define
+// MICROPY_PY_FRAMEBUF_COPY_ROWS_HOOK(dest, dest_step, src, src_step, len, rows)
+// to do the copy with hardware (eg DMA2D), returning false to fall back to
+// memmove.
+STATIC void copy_rows(uint8_t *dest, size_t dest_step, const uint8_t *src, size_t src_step, size_t len, unsigned int rows) {
+    #ifdef MICROPY_PY_FRAMEBUF_COPY_ROWS_HOOK
+    if (MICROPY_PY_FRAMEBUF_COPY_ROWS_HOOK(dest, dest_step, src, src_step, len, rows)) {
+        return;
+    }
+    #endif
+    if (dest > src) {
+        // the buffers may overlap, so copy the last row first
+        dest += (rows - 1) * dest_step;
+        src += (rows - 1) * src_step;
+        while (rows--) {
+            memmove(dest, src, len);
+            dest -= dest_step;
+            src -= src_step;
+        }
+    } else {
+        while (rows--) {
+            memmove(dest, src, len);
+            dest += dest_step;
+            src += src_step;
+        }
+    }
+}
+
+// Fill an area, already clipped to the framebuffer.  A port can define
+// MICROPY_PY_FRAMEBUF_FILL_ROWS_HOOK(dest, dest_step, len, rows, bpp, col) to
+// fill the rows of the formats with 8 or more bits per pixel with hardware,
+// returning false to fall back to software.
+STATIC void fill_rect_clipped(mp_obj_framebuf_t *fb, unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint32_t col) {
+    #ifdef MICROPY_PY_FRAMEBUF_FILL_ROWS_HOOK
+    unsigned int bpp = row_bits_per_pixel(fb->format);
+    if (bpp >= 8 && MICROPY_PY_FRAMEBUF_FILL_ROWS_HOOK((uint8_t *)fb->buf + (x + y * fb->stride) * bpp / 8,
+        fb->stride * bpp / 8, w * bpp / 8, h, bpp, col)) {
+        mark_dirty(fb, x, y, w, h);
+        return;
+    }
+    #endif
+    formats[fb->format].fill_rect(fb, x, y, w, h, col);
+    mark_dirty(fb, x, y, w, h);
+}
+
+STATIC void fill_rect(mp_obj_framebuf_t *fb, int x, int y, int w, int h, uint32_t col) {
     if (h < 1 || w < 1 || x + w <= 0 || y + h <= 0 || y >= fb->height || x >= fb->width) {
         // No operation needed.
         return;
@@ -260,7 +357,7 @@ STATIC void fill_rect(const mp_obj_framebuf_t *fb, int x, int y, int w, int h, u
     x = MAX(x, 0);
     y = MAX(y, 0);
 
-    formats[fb->format].fill_rect(fb, x, y, xend - x, yend - y, col);
+    fill_rect_clipped(fb, x, y, xend - x, yend - y, col);
 }
 
 STATIC mp_obj_t framebuf_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
@@ -302,6 +399,12 @@ STATIC mp_obj_t framebuf_make_new(const mp_obj_type_t *type, size_t n_args, size
             mp_raise_ValueError(MP_ERROR_TEXT("invalid format"));
     }
 
+    // the whole framebuffer is new to whatever it's displayed on
+    o->dirty_x0 = 0;
+    o->dirty_y0 = 0;
+    o->dirty_x1 = o->width;
+    o->dirty_y1 = o->height;
+
     return MP_OBJ_FROM_PTR(o);
 }
 
@@ -317,7 +420,7 @@ STATIC mp_int_t framebuf_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo,
 STATIC mp_obj_t framebuf_fill(mp_obj_t self_in, mp_obj_t col_in) {
     mp_obj_framebuf_t *self = MP_OBJ_TO_PTR(self_in);
     mp_int_t col = mp_obj_get_int(col_in);
-    formats[self->format].fill_rect(self, 0, 0, self->width, self->height, col);
+    fill_rect_clipped(self, 0, 0, self->width, self->height, col);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(framebuf_fill_obj, framebuf_fill);
@@ -349,6 +452,7 @@ STATIC mp_obj_t framebuf_pixel(size_t n_args, const mp_obj_t *args) {
         } else {
             // set
             setpixel(self, x, y, mp_obj_get_int(args[3]));
+            mark_dirty(self, x, y, 1, 1);
         }
     }
     return mp_const_none;
@@ -414,6 +518,8 @@ STATIC mp_obj_t framebuf_line(size_t n_args, const mp_obj_t *args) {
     mp_int_t y2 = mp_obj_get_int(args[4]);
     mp_int_t col = mp_obj_get_int(args[5]);
 
+    mark_dirty_clipped(self, MIN(x1, x2), MIN(y1, y2), MAX(x1, x2) - MIN(x1, x2) + 1, MAX(y1, y2) - MIN(y1, y2) + 1);
+
     mp_int_t dx = x2 - x1;
     mp_int_t sx;
     if (dx > 0) {
@@ -476,7 +582,50 @@ STATIC mp_obj_t framebuf_line(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(framebuf_line_obj, 6, 6, framebuf_line);
 
-STATIC mp_obj_t framebuf_blit(size_t n_args, const mp_obj_t *args) {
+// Parameters of a blit, with the destination area already clipped.  Moving one
+// pixel right in the destination moves (su_x, su_y) in the (unscaled) source,
+// and moving one pixel down moves (sv_x, sv_y).
+typedef struct _framebuf_blit_t {
+    int x0, y0, x0end, y0end;
+    int u0, v0;
+    int sx0, sy0, su_x, su_y, sv_x, sv_y;
+    int scale;
+    mp_int_t key;
+    const mp_obj_framebuf_t *palette;
+    unsigned int lut_len;
+    uint32_t lut[16];
+} framebuf_blit_t;
+
+// The inner loops of a blit.  This is called with the pixel functions of
+// common pairs of formats as constants, so the compiler can make a version
+// specialised for each.
+static inline void blit_rows(mp_obj_framebuf_t *self, const mp_obj_framebuf_t *source, const framebuf_blit_t *b, setpixel_t set, getpixel_t get) {
+    int v = b->v0;
+    for (int y0 = b->y0; y0 < b->y0end; ++y0, ++v) {
+        int us = b->u0 / b->scale;
+        int vs = v / b->scale;
+        int sub = b->u0 % b->scale;
+        int sx = b->sx0 + us * b->su_x + vs * b->sv_x;
+        int sy = b->sy0 + us * b->su_y + vs * b->sv_y;
+        for (int x0 = b->x0; x0 < b->x0end; ++x0) {
+            uint32_t col = get(source, sx, sy);
+            if (b->palette) {
+                col = col < b->lut_len ? b->lut[col] : getpixel(b->palette, col, 0);
+            }
+            if (col != (uint32_t)b->key) {
+                set(self, x0, y0, col);
+            }
+            if (++sub == b->scale) {
+                sub = 0;
+                sx += b->su_x;
+                sy += b->su_y;
+            }
+        }
+    }
+}
+
+STATIC mp_obj_t framebuf_blit(size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args->used, 4, 6, true);
     mp_obj_framebuf_t *self = MP_OBJ_TO_PTR(args[0]);
     mp_obj_t source_in = mp_obj_cast_to_native_base(args[1], MP_OBJ_FROM_PTR(&mp_type_framebuf));
     if (source_in == MP_OBJ_NULL) {
@@ -486,50 +635,122 @@ STATIC mp_obj_t framebuf_blit(size_t n_args, const mp_obj_t *args) {
 
     mp_int_t x = mp_obj_get_int(args[2]);
     mp_int_t y = mp_obj_get_int(args[3]);
-    mp_int_t key = -1;
-    if (n_args > 4) {
-        key = mp_obj_get_int(args[4]);
+    mp_obj_t key_in = n_args > 4 ? args[4] : MP_OBJ_NEW_SMALL_INT(-1);
+    mp_obj_t palette_in = n_args > 5 ? args[5] : mp_const_none;
+    mp_int_t scale = 1;
+    mp_int_t rotate = 0;
+
+    // The keyword arguments are looked up by hand so this also works in the
+    // native module, which doesn't have mp_arg_parse_all.
+    for (size_t i = 0; i < kw_args->used; ++i) {
+        qstr kw = MP_OBJ_QSTR_VALUE(kw_args->table[i].key);
+        mp_obj_t value = kw_args->table[i].value;
+        if (kw == MP_QSTR_key) {
+            key_in = value;
+        } else if (kw == MP_QSTR_palette) {
+            palette_in = value;
+        } else if (kw == MP_QSTR_scale) {
+            scale = mp_obj_get_int(value);
+        } else if (kw == MP_QSTR_rotate) {
+            rotate = mp_obj_get_int(value);
+        } else {
+            mp_raise_TypeError(MP_ERROR_TEXT("unexpected keyword argument"));
+        }
     }
-    mp_obj_framebuf_t *palette = NULL;
-    if (n_args > 5 && args[5] != mp_const_none) {
-        palette = MP_OBJ_TO_PTR(mp_obj_cast_to_native_base(args[5], MP_OBJ_FROM_PTR(&mp_type_framebuf)));
+
+    framebuf_blit_t b;
+    b.key = mp_obj_get_int(key_in);
+    b.palette = NULL;
+    if (palette_in != mp_const_none) {
+        b.palette = MP_OBJ_TO_PTR(mp_obj_cast_to_native_base(palette_in, MP_OBJ_FROM_PTR(&mp_type_framebuf)));
+    }
+    if (scale < 1 || scale > 255) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid scale"));
+    }
+    b.scale = scale;
+
+    // Work out where the source starts and which way it goes for the rotation
+    // (clockwise), and the size it covers in the destination.
+    int sw = source->width;
+    int sh = source->height;
+    int dw, dh;
+    switch (rotate) {
+        case 0:
+            b.sx0 = 0, b.sy0 = 0, b.su_x = 1, b.su_y = 0, b.sv_x = 0, b.sv_y = 1;
+            dw = sw, dh = sh;
+            break;
+        case 90:
+            b.sx0 = 0, b.sy0 = sh - 1, b.su_x = 0, b.su_y = -1, b.sv_x = 1, b.sv_y = 0;
+            dw = sh, dh = sw;
+            break;
+        case 180:
+            b.sx0 = sw - 1, b.sy0 = sh - 1, b.su_x = -1, b.su_y = 0, b.sv_x = 0, b.sv_y = -1;
+            dw = sw, dh = sh;
+            break;
+        case 270:
+            b.sx0 = sw - 1, b.sy0 = 0, b.su_x = 0, b.su_y = 1, b.sv_x = -1, b.sv_y = 0;
+            dw = sh, dh = sw;
+            break;
+        default:
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid rotation"));
     }
+    dw *= scale;
+    dh *= scale;
 
     if (
         (x >= self->width) ||
         (y >= self->height) ||
-        (-x >= source->width) ||
-        (-y >= source->height)
+        (-x >= dw) ||
+        (-y >= dh)
         ) {
         // Out of bounds, no-op.
         return mp_const_none;
     }
 
     // Clip.
-    int x0 = MAX(0, x);
-    int y0 = MAX(0, y);
-    int x1 = MAX(0, -x);
-    int y1 = MAX(0, -y);
-    int x0end = MIN(self->width, x + source->width);
-    int y0end = MIN(self->height, y + source->height);
-
-    for (; y0 < y0end; ++y0) {
-        int cx1 = x1;
-        for (int cx0 = x0; cx0 < x0end; ++cx0) {
-            uint32_t col = getpixel(source, cx1, y1);
-            if (palette) {
-                col = getpixel(palette, col, 0);
-            }
-            if (col != (uint32_t)key) {
-                setpixel(self, cx0, y0, col);
-            }
-            ++cx1;
+    b.x0 = MAX(0, x);
+    b.y0 = MAX(0, y);
+    b.u0 = b.x0 - x;
+    b.v0 = b.y0 - y;
+    b.x0end = MIN(self->width, x + dw);
+    b.y0end = MIN(self->height, y + dh);
+    mark_dirty(self, b.x0, b.y0, b.x0end - b.x0, b.y0end - b.y0);
+
+    // Copy whole rows of bytes if there's no conversion, transformation or key
+    // colour, and the rows start and end on byte boundaries.
+    unsigned int bpp = row_bits_per_pixel(self->format);
+    if (source->format == self->format && bpp != 0 && b.key == -1 && b.palette == NULL && scale == 1 && rotate == 0) {
+        unsigned int ppb = bpp < 8 ? 8 / bpp : 1; // pixels per byte
+        unsigned int w = b.x0end - b.x0;
+        if (b.x0 % ppb == 0 && b.u0 % ppb == 0 && w % ppb == 0) {
+            copy_rows((uint8_t *)self->buf + (b.x0 + b.y0 * self->stride) * bpp / 8, self->stride * bpp / 8,
+                (uint8_t *)source->buf + (b.u0 + b.v0 * source->stride) * bpp / 8, source->stride * bpp / 8,
+                w * bpp / 8, b.y0end - b.y0);
+            return mp_const_none;
+        }
+    }
+
+    // Look up the start of the palette once, rather than for every pixel.
+    b.lut_len = 0;
+    if (b.palette) {
+        b.lut_len = MIN(b.palette->width, MP_ARRAY_SIZE(b.lut));
+        for (unsigned int i = 0; i < b.lut_len; ++i) {
+            b.lut[i] = getpixel(b.palette, i, 0);
         }
-        ++y1;
+    }
+
+    if (self->format == FRAMEBUF_RGB565 && source->format == FRAMEBUF_RGB565) {
+        blit_rows(self, source, &b, rgb565_setpixel, rgb565_getpixel);
+    } else if (self->format == FRAMEBUF_RGB565 && source->format == FRAMEBUF_GS4_HMSB) {
+        blit_rows(self, source, &b, rgb565_setpixel, gs4_hmsb_getpixel);
+    } else if (self->format == FRAMEBUF_RGB565 && (source->format == FRAMEBUF_MHLSB || source->format == FRAMEBUF_MHMSB)) {
+        blit_rows(self, source, &b, rgb565_setpixel, mono_horiz_getpixel);
+    } else {
+        blit_rows(self, source, &b, formats[self->format].setpixel, formats[source->format].getpixel);
     }
     return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(framebuf_blit_obj, 4, 6, framebuf_blit);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(framebuf_blit_obj, 4, framebuf_blit);
 
 STATIC mp_obj_t framebuf_scroll(mp_obj_t self_in, mp_obj_t xstep_in, mp_obj_t ystep_in) {
     mp_obj_framebuf_t *self = MP_OBJ_TO_PTR(self_in);
@@ -559,6 +780,7 @@ STATIC mp_obj_t framebuf_scroll(mp_obj_t self_in, mp_obj_t xstep_in, mp_obj_t ys
             setpixel(self, x, y, getpixel(self, x - xstep, y - ystep));
         }
     }
+    mark_dirty(self, 0, 0, self->width, self->height);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(framebuf_scroll_obj, framebuf_scroll);
@@ -574,6 +796,8 @@ STATIC mp_obj_t framebuf_text(size_t n_args, const mp_obj_t *args) {
         col = mp_obj_get_int(args[4]);
     }
 
+    mark_dirty_clipped(self, x0, y0, strlen(str) * 8, 8);
+
     // loop over chars
     for (; *str; ++str) {
         // get char and make sure its in range of font
@@ -601,6 +825,23 @@ STATIC mp_obj_t framebuf_text(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(framebuf_text_obj, 4, 5, framebuf_text);
 
+// Return the area drawn to since the last call, as (x, y, w, h), or None.
+STATIC mp_obj_t framebuf_dirty(mp_obj_t self_in) {
+    mp_obj_framebuf_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->dirty_x1 == 0) {
+        return mp_const_none;
+    }
+    mp_obj_t tuple[4] = {
+        MP_OBJ_NEW_SMALL_INT(self->dirty_x0),
+        MP_OBJ_NEW_SMALL_INT(self->dirty_y0),
+        MP_OBJ_NEW_SMALL_INT(self->dirty_x1 - self->dirty_x0),
+        MP_OBJ_NEW_SMALL_INT(self->dirty_y1 - self->dirty_y0),
+    };
+    self->dirty_x1 = 0;
+    return mp_obj_new_tuple(4, tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(framebuf_dirty_obj, framebuf_dirty);
+
 #if !MICROPY_ENABLE_DYNRUNTIME
 STATIC const mp_rom_map_elem_t framebuf_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&framebuf_fill_obj) },
@@ -613,6 +854,7 @@ STATIC const mp_rom_map_elem_t framebuf_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&framebuf_blit_obj) },
     { MP_ROM_QSTR(MP_QSTR_scroll), MP_ROM_PTR(&framebuf_scroll_obj) },
     { MP_ROM_QSTR(MP_QSTR_text), MP_ROM_PTR(&framebuf_text_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dirty), MP_ROM_PTR(&framebuf_dirty_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(framebuf_locals_dict, framebuf_locals_dict_table);
 
@@ -641,6 +883,10 @@ STATIC mp_obj_t legacy_framebuffer1(size_t n_args, const mp_obj_t *args) {
     } else {
         o->stride = o->width;
     }
+    o->dirty_x0 = 0;
+    o->dirty_y0 = 0;
+    o->dirty_x1 = o->width;
+    o->dirty_y1 = o->height;
 
     return MP_OBJ_FROM_PTR(o);
 }
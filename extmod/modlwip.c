@@ -29,6 +29,7 @@
 #include <string.h>
 #include <stdio.h>
 
+#include "py/objarray.h"
 #include "py/objlist.h"
 #include "py/runtime.h"
 #include "py/stream.h"
@@ -64,6 +65,21 @@
 // All socket options should be globally distinct,
 // because we ignore option levels for efficiency.
 #define IP_ADD_MEMBERSHIP 0x400
+#define SO_SNDBUF 0x1001
+#define SO_RCVBUF 0x1002
+// The TCP options are lwIP's values offset to keep them distinct
+#define TCP_NODELAY 0x2001
+#define TCP_KEEPIDLE 0x2003
+#define TCP_KEEPINTVL 0x2004
+#define TCP_KEEPCNT 0x2005
+#define TCP_CORK 0x2006
+
+// Number of datagrams a UDP or raw socket can hold until they are received,
+// by default.  Later datagrams are dropped.  It can be changed per socket
+// with setsockopt(SOL_SOCKET, SO_RCVBUF, n).
+#ifndef MICROPY_PY_LWIP_UDP_QUEUE_LEN
+#define MICROPY_PY_LWIP_UDP_QUEUE_LEN (1)
+#endif
 
 // For compatibilily with older lwIP versions.
 #ifndef ip_set_option
@@ -274,6 +290,13 @@ static const int error_lookup_table[] = {
 #define MOD_NETWORK_SOCK_DGRAM (2)
 #define MOD_NETWORK_SOCK_RAW (3)
 
+// A datagram waiting behind the one in incoming.pbuf
+typedef struct _lwip_datagram_t {
+    struct pbuf *pbuf;
+    byte peer[4];
+    uint16_t port;
+} lwip_datagram_t;
+
 typedef struct _lwip_socket_obj_t {
     mp_obj_base_t base;
 
@@ -299,6 +322,26 @@ typedef struct _lwip_socket_obj_t {
     mp_uint_t peer_port;
     mp_uint_t timeout;
     uint16_t recv_offset;
+    // pbuf that the memoryview returned by the last recv_pbuf() points into
+    struct pbuf *held_pbuf;
+    mp_obj_t held_view;
+    // For UDP and raw sockets, a ring of datagrams received after the one in
+    // incoming.pbuf (whose source is in peer/peer_port)
+    lwip_datagram_t *dgram_queue;
+    uint8_t dgram_alloc;
+    uint8_t dgram_iget;
+    uint8_t dgram_len;
+    // For TCP sockets, the options set with setsockopt() that lwIP doesn't
+    // keep itself (these are passed on to accepted sockets)
+    #define TCP_OPT_NODELAY (1)
+    #define TCP_OPT_CORK (2)
+    uint8_t tcp_opts;
+    // Limit on unacknowledged send data from SO_SNDBUF, or 0 for none
+    uint16_t snd_limit;
+    // Receive window to keep back from the peer for SO_RCVBUF, and how much
+    // of it has been kept back so far
+    uint16_t rcv_withhold;
+    uint16_t rcv_withheld;
 
     uint8_t domain;
     uint8_t type;
@@ -339,6 +382,14 @@ STATIC void lwip_socket_free_incoming(lwip_socket_obj_t *socket) {
             pbuf_free(socket->incoming.pbuf);
             socket->incoming.pbuf = NULL;
         }
+        for (; socket->dgram_len > 0; --socket->dgram_len) {
+            lwip_datagram_t *d = &socket->dgram_queue[socket->dgram_iget];
+            pbuf_free(d->pbuf);
+            d->pbuf = NULL;
+            if (++socket->dgram_iget >= socket->dgram_alloc) {
+                socket->dgram_iget = 0;
+            }
+        }
     } else {
         uint8_t alloc = socket->incoming.connection.alloc;
         struct tcp_pcb *volatile *tcp_array = lwip_socket_incoming_array(socket);
@@ -353,6 +404,48 @@ STATIC void lwip_socket_free_incoming(lwip_socket_obj_t *socket) {
     }
 }
 
+// Take a datagram for a UDP or raw socket: it goes in incoming.pbuf if that
+// is free, or on the queue behind it.  Called within the lwIP context.
+STATIC void lwip_socket_put_datagram(lwip_socket_obj_t *socket, struct pbuf *p, const ip_addr_t *addr, u16_t port) {
+    if (socket->incoming.pbuf == NULL) {
+        socket->incoming.pbuf = p;
+        socket->peer_port = (mp_uint_t)port;
+        memcpy(&socket->peer, addr, sizeof(socket->peer));
+    } else if (socket->dgram_len < socket->dgram_alloc) {
+        unsigned int i = socket->dgram_iget + socket->dgram_len;
+        if (i >= socket->dgram_alloc) {
+            i -= socket->dgram_alloc;
+        }
+        lwip_datagram_t *d = &socket->dgram_queue[i];
+        d->pbuf = p;
+        d->port = port;
+        memcpy(d->peer, addr, sizeof(d->peer));
+        ++socket->dgram_len;
+    } else {
+        // That's why they call it "unreliable". No room in the inn, drop the packet.
+        pbuf_free(p);
+    }
+}
+
+// Free the datagram in incoming.pbuf and move the next queued one, if any,
+// up into its place.  Must be called with the lock held.
+STATIC void lwip_socket_next_datagram(lwip_socket_obj_t *socket) {
+    pbuf_free(socket->incoming.pbuf);
+    if (socket->dgram_len == 0) {
+        socket->incoming.pbuf = NULL;
+        return;
+    }
+    lwip_datagram_t *d = &socket->dgram_queue[socket->dgram_iget];
+    socket->incoming.pbuf = d->pbuf;
+    socket->peer_port = d->port;
+    memcpy(&socket->peer, d->peer, sizeof(socket->peer));
+    d->pbuf = NULL;
+    if (++socket->dgram_iget >= socket->dgram_alloc) {
+        socket->dgram_iget = 0;
+    }
+    --socket->dgram_len;
+}
+
 /*******************************************************************************/
 // Callback functions for the lwIP raw API.
 
@@ -373,17 +466,12 @@ STATIC u8_t _lwip_raw_incoming(void *arg, struct raw_pcb *pcb, struct pbuf *p, c
 {
     lwip_socket_obj_t *socket = (lwip_socket_obj_t *)arg;
 
-    if (socket->incoming.pbuf != NULL) {
-        pbuf_free(p);
-    } else {
-        socket->incoming.pbuf = p;
-        memcpy(&socket->peer, addr, sizeof(socket->peer));
-    }
+    lwip_socket_put_datagram(socket, p, addr, 0);
     return 1; // we ate the packet
 }
 #endif
 
-// Callback for incoming UDP packets. We simply stash the packet and the source address,
+// Callback for incoming UDP packets. We simply queue the packet and the source address,
 // in case we need it for recvfrom.
 #if LWIP_VERSION_MAJOR < 2
 STATIC void _lwip_udp_incoming(void *arg, struct udp_pcb *upcb, struct pbuf *p, ip_addr_t *addr, u16_t port)
@@ -393,14 +481,7 @@ STATIC void _lwip_udp_incoming(void *arg, struct udp_pcb *upcb, struct pbuf *p,
 {
     lwip_socket_obj_t *socket = (lwip_socket_obj_t *)arg;
 
-    if (socket->incoming.pbuf != NULL) {
-        // That's why they call it "unreliable". No room in the inn, drop the packet.
-        pbuf_free(p);
-    } else {
-        socket->incoming.pbuf = p;
-        socket->peer_port = (mp_uint_t)port;
-        memcpy(&socket->peer, addr, sizeof(socket->peer));
-    }
+    lwip_socket_put_datagram(socket, p, addr, port);
 }
 
 // Callback for general tcp errors.
@@ -537,21 +618,13 @@ STATIC err_t _lwip_tcp_recv(void *arg, struct tcp_pcb *tcpb, struct pbuf *p, err
 // Functions for socket send/receive operations. Socket send/recv and friends call
 // these to do the work.
 
-// Helper function for send/sendto to handle raw/UDP packets.
-STATIC mp_uint_t lwip_raw_udp_send(lwip_socket_obj_t *socket, const byte *buf, mp_uint_t len, byte *ip, mp_uint_t port, int *_errno) {
-    if (len > 0xffff) {
-        // Any packet that big is probably going to fail the pbuf_alloc anyway, but may as well try
-        len = 0xffff;
-    }
-
-    MICROPY_PY_LWIP_ENTER
-
+// Send one raw/UDP packet, of at most 0xffff bytes.  Must be called with the
+// lock held.  Returns an lwIP error code.
+STATIC err_t lwip_raw_udp_send_locked(lwip_socket_obj_t *socket, const byte *buf, mp_uint_t len, byte *ip, mp_uint_t port) {
     // FIXME: maybe PBUF_ROM?
     struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, len, PBUF_RAM);
     if (p == NULL) {
-        MICROPY_PY_LWIP_EXIT
-        *_errno = MP_ENOMEM;
-        return -1;
+        return ERR_MEM;
     }
 
     memcpy(p->payload, buf, len);
@@ -581,12 +654,28 @@ STATIC mp_uint_t lwip_raw_udp_send(lwip_socket_obj_t *socket, const byte *buf, m
 
     pbuf_free(p);
 
-    MICROPY_PY_LWIP_EXIT
-
     // udp_sendto can return 1 on occasion for ESP8266 port.  It's not known why
     // but it seems that the send actually goes through without error in this case.
     // So we treat such cases as a success until further investigation.
-    if (err != ERR_OK && err != 1) {
+    if (err == 1) {
+        err = ERR_OK;
+    }
+
+    return err;
+}
+
+// Helper function for send/sendto to handle raw/UDP packets.
+STATIC mp_uint_t lwip_raw_udp_send(lwip_socket_obj_t *socket, const byte *buf, mp_uint_t len, byte *ip, mp_uint_t port, int *_errno) {
+    if (len > 0xffff) {
+        // Any packet that big is probably going to fail the pbuf_alloc anyway, but may as well try
+        len = 0xffff;
+    }
+
+    MICROPY_PY_LWIP_ENTER
+    err_t err = lwip_raw_udp_send_locked(socket, buf, len, ip, port);
+    MICROPY_PY_LWIP_EXIT
+
+    if (err != ERR_OK) {
         *_errno = error_lookup_table[-err];
         return -1;
     }
@@ -625,8 +714,7 @@ STATIC mp_uint_t lwip_raw_udp_receive(lwip_socket_obj_t *socket, byte *buf, mp_u
     MICROPY_PY_LWIP_ENTER
 
     u16_t result = pbuf_copy_partial(p, buf, ((p->tot_len > len) ? len : p->tot_len), 0);
-    pbuf_free(p);
-    socket->incoming.pbuf = NULL;
+    lwip_socket_next_datagram(socket);
 
     MICROPY_PY_LWIP_EXIT
 
@@ -651,14 +739,51 @@ STATIC mp_uint_t lwip_raw_udp_receive(lwip_socket_obj_t *socket, byte *buf, mp_u
     assert(socket->pcb.tcp);
 
 
-// Helper function for send/sendto to handle TCP packets
-STATIC mp_uint_t lwip_tcp_send(lwip_socket_obj_t *socket, const byte *buf, mp_uint_t len, int *_errno) {
+// Space in the send buffer, within any limit set with SO_SNDBUF.  Must be
+// called with the lock held.
+STATIC u16_t lwip_tcp_sndbuf(lwip_socket_obj_t *socket) {
+    u16_t available = tcp_sndbuf(socket->pcb.tcp);
+    if (socket->snd_limit != 0) {
+        u16_t queued = TCP_SND_BUF - available;
+        available = queued >= socket->snd_limit ? 0 : MIN(available, socket->snd_limit - queued);
+    }
+    return available;
+}
+
+// Turn Nagle's algorithm off for TCP_NODELAY, except while the socket is
+// corked so that partial segments are kept back.  Must be called with the
+// lock held.
+STATIC void lwip_tcp_set_nagle(lwip_socket_obj_t *socket) {
+    if ((socket->tcp_opts & (TCP_OPT_NODELAY | TCP_OPT_CORK)) == TCP_OPT_NODELAY) {
+        tcp_nagle_disable(socket->pcb.tcp);
+    } else {
+        tcp_nagle_enable(socket->pcb.tcp);
+    }
+}
+
+// Open the receive window by len bytes that were taken from the queue, less
+// any that are still to be kept back for SO_RCVBUF.  Must be called with the
+// lock held.
+STATIC void lwip_tcp_recved(lwip_socket_obj_t *socket, u16_t len) {
+    if (socket->rcv_withheld < socket->rcv_withhold) {
+        u16_t keep = MIN(len, socket->rcv_withhold - socket->rcv_withheld);
+        socket->rcv_withheld += keep;
+        len -= keep;
+    }
+    if (len != 0) {
+        tcp_recved(socket->pcb.tcp, len);
+    }
+}
+
+// Helper function for send/sendto/writev to handle TCP packets.  The buffers
+// are queued in order, as much as fits in the send buffer.
+STATIC mp_uint_t lwip_tcp_sendv(lwip_socket_obj_t *socket, const mp_stream_iovec_t *iov, size_t iovcnt, int *_errno) {
     // Check for any pending errors
     STREAM_ERROR_CHECK(socket);
 
     MICROPY_PY_LWIP_ENTER
 
-    u16_t available = tcp_sndbuf(socket->pcb.tcp);
+    u16_t available = lwip_tcp_sndbuf(socket);
 
     if (available == 0) {
         // Non-blocking socket
@@ -675,7 +800,7 @@ STATIC mp_uint_t lwip_tcp_send(lwip_socket_obj_t *socket, const byte *buf, mp_ui
         // If peer fully closed socket, we would have socket->state set to ERR_RST (connection
         // reset) by error callback.
         // Avoid sending too small packets, so wait until at least 16 bytes available
-        while (socket->state >= STATE_CONNECTED && (available = tcp_sndbuf(socket->pcb.tcp)) < 16) {
+        while (socket->state >= STATE_CONNECTED && (available = lwip_tcp_sndbuf(socket)) < 16) {
             MICROPY_PY_LWIP_EXIT
             if (socket->timeout != -1 && mp_hal_ticks_ms() - start > socket->timeout) {
                 *_errno = MP_ETIMEDOUT;
@@ -689,45 +814,69 @@ STATIC mp_uint_t lwip_tcp_send(lwip_socket_obj_t *socket, const byte *buf, mp_ui
         STREAM_ERROR_CHECK_WITH_LOCK(socket);
     }
 
-    u16_t write_len = MIN(available, len);
+    mp_uint_t total = 0;
+    err_t err = ERR_OK;
+    for (size_t j = 0; j < iovcnt && available > 0; ++j) {
+        u16_t write_len = MIN(available, iov[j].len);
 
-    // If tcp_write returns ERR_MEM then there's currently not enough memory to
-    // queue the write, so wait and keep trying until it succeeds (with 10s limit).
-    // Note: if the socket is non-blocking then this code will actually block until
-    // there's enough memory to do the write, but by this stage we have already
-    // committed to being able to write the data.
-    err_t err;
-    for (int i = 0; i < 200; ++i) {
-        err = tcp_write(socket->pcb.tcp, buf, write_len, TCP_WRITE_FLAG_COPY);
-        if (err != ERR_MEM) {
-            break;
+        // Tell lwIP when more data follows, so each buffer doesn't end a segment
+        u8_t apiflags = TCP_WRITE_FLAG_COPY;
+        if ((j + 1 < iovcnt && write_len == iov[j].len) || (socket->tcp_opts & TCP_OPT_CORK)) {
+            apiflags |= TCP_WRITE_FLAG_MORE;
+        }
+
+        // If tcp_write returns ERR_MEM then there's currently not enough memory to
+        // queue the write, so wait and keep trying until it succeeds (with 10s limit).
+        // Note: if the socket is non-blocking then this code will actually block until
+        // there's enough memory to do the write, but by this stage we have already
+        // committed to being able to write the data.
+        for (int i = 0; i < 200; ++i) {
+            err = tcp_write(socket->pcb.tcp, iov[j].buf, write_len, apiflags);
+            if (err != ERR_MEM) {
+                break;
+            }
+            err = tcp_output(socket->pcb.tcp);
+            if (err != ERR_OK) {
+                break;
+            }
+            MICROPY_PY_LWIP_EXIT
+            mp_hal_delay_ms(50);
+            MICROPY_PY_LWIP_REENTER
         }
-        err = tcp_output(socket->pcb.tcp);
         if (err != ERR_OK) {
             break;
         }
-        MICROPY_PY_LWIP_EXIT
-        mp_hal_delay_ms(50);
-        MICROPY_PY_LWIP_REENTER
+
+        total += write_len;
+        available -= write_len;
     }
 
-    // If the output buffer is getting full then send the data to the lower layers
-    if (err == ERR_OK && tcp_sndbuf(socket->pcb.tcp) < TCP_SND_BUF / 4) {
+    // If the output buffer is getting full then send the data to the lower layers,
+    // and with TCP_NODELAY send it straight away unless the socket is corked
+    if (err == ERR_OK && (tcp_sndbuf(socket->pcb.tcp) < TCP_SND_BUF / 4
+                          || (socket->tcp_opts & (TCP_OPT_NODELAY | TCP_OPT_CORK)) == TCP_OPT_NODELAY)) {
         err = tcp_output(socket->pcb.tcp);
     }
 
     MICROPY_PY_LWIP_EXIT
 
-    if (err != ERR_OK) {
+    // Report an error only if nothing was queued, else it's seen by the next write
+    if (err != ERR_OK && total == 0) {
         *_errno = error_lookup_table[-err];
         return MP_STREAM_ERROR;
     }
 
-    return write_len;
+    return total;
 }
 
-// Helper function for recv/recvfrom to handle TCP packets
-STATIC mp_uint_t lwip_tcp_receive(lwip_socket_obj_t *socket, byte *buf, mp_uint_t len, int *_errno) {
+STATIC mp_uint_t lwip_tcp_send(lwip_socket_obj_t *socket, const byte *buf, mp_uint_t len, int *_errno) {
+    mp_stream_iovec_t iov = { buf, len };
+    return lwip_tcp_sendv(socket, &iov, 1, _errno);
+}
+
+// Helper function for TCP receives to wait until there is queued data.  Returns
+// 1 if there is data, 0 if the peer closed the connection, or MP_STREAM_ERROR.
+STATIC mp_uint_t lwip_tcp_wait_incoming(lwip_socket_obj_t *socket, int *_errno) {
     // Check for any pending errors
     STREAM_ERROR_CHECK(socket);
 
@@ -766,36 +915,63 @@ STATIC mp_uint_t lwip_tcp_receive(lwip_socket_obj_t *socket, byte *buf, mp_uint_
         }
     }
 
+    return 1;
+}
+
+// Helper function for recv/recvfrom to handle TCP packets
+STATIC mp_uint_t lwip_tcp_receive(lwip_socket_obj_t *socket, byte *buf, mp_uint_t len, int *_errno) {
+    mp_uint_t ret = lwip_tcp_wait_incoming(socket, _errno);
+    if (ret != 1) {
+        return ret;
+    }
+
     MICROPY_PY_LWIP_ENTER
 
     assert(socket->pcb.tcp != NULL);
 
+    // Copy from as many of the queued pbufs as needed, without waiting for more
+    mp_uint_t total = 0;
     struct pbuf *p = socket->incoming.pbuf;
+    while (p != NULL && total < len) {
+        mp_uint_t n = p->len - socket->recv_offset;
+        if (n > len - total) {
+            n = len - total;
+        }
 
-    mp_uint_t remaining = p->len - socket->recv_offset;
-    if (len > remaining) {
-        len = remaining;
-    }
-
-    memcpy(buf, (byte *)p->payload + socket->recv_offset, len);
-
-    remaining -= len;
-    if (remaining == 0) {
-        socket->incoming.pbuf = p->next;
-        // If we don't ref here, free() will free the entire chain,
-        // if we ref, it does what we need: frees 1st buf, and decrements
-        // next buf's refcount back to 1.
-        pbuf_ref(p->next);
-        pbuf_free(p);
-        socket->recv_offset = 0;
-    } else {
-        socket->recv_offset += len;
+        memcpy(buf + total, (byte *)p->payload + socket->recv_offset, n);
+        total += n;
+
+        if (socket->recv_offset + n == p->len) {
+            socket->incoming.pbuf = p->next;
+            // If we don't ref here, free() will free the entire chain,
+            // if we ref, it does what we need: frees 1st buf, and decrements
+            // next buf's refcount back to 1.
+            pbuf_ref(p->next);
+            pbuf_free(p);
+            socket->recv_offset = 0;
+            p = socket->incoming.pbuf;
+        } else {
+            socket->recv_offset += n;
+        }
+        lwip_tcp_recved(socket, n);
     }
-    tcp_recved(socket->pcb.tcp, len);
 
     MICROPY_PY_LWIP_EXIT
 
-    return len;
+    return total;
+}
+
+// Drop the pbuf held for the last recv_pbuf() call, and empty the view of it
+// so that stale references see no data.  Must be called with the lock held.
+STATIC void lwip_socket_release_held(lwip_socket_obj_t *socket) {
+    if (socket->held_pbuf != NULL) {
+        pbuf_free(socket->held_pbuf);
+        socket->held_pbuf = NULL;
+    }
+    if (socket->held_view != MP_OBJ_NULL) {
+        mp_obj_array_t *view = MP_OBJ_TO_PTR(socket->held_view);
+        view->len = 0;
+    }
 }
 
 /*******************************************************************************/
@@ -817,6 +993,16 @@ STATIC mp_obj_t lwip_socket_make_new(const mp_obj_type_t *type, size_t n_args, s
     socket->base.type = &lwip_socket_type;
     socket->timeout = -1;
     socket->recv_offset = 0;
+    socket->held_pbuf = NULL;
+    socket->held_view = MP_OBJ_NULL;
+    socket->dgram_queue = NULL;
+    socket->dgram_alloc = 0;
+    socket->dgram_iget = 0;
+    socket->dgram_len = 0;
+    socket->tcp_opts = 0;
+    socket->snd_limit = 0;
+    socket->rcv_withhold = 0;
+    socket->rcv_withheld = 0;
     socket->domain = MOD_NETWORK_AF_INET;
     socket->type = MOD_NETWORK_SOCK_STREAM;
     socket->callback = MP_OBJ_NULL;
@@ -829,6 +1015,13 @@ STATIC mp_obj_t lwip_socket_make_new(const mp_obj_type_t *type, size_t n_args, s
         }
     }
 
+    #if MICROPY_PY_LWIP_UDP_QUEUE_LEN > 1
+    if (socket->type != MOD_NETWORK_SOCK_STREAM) {
+        socket->dgram_alloc = MICROPY_PY_LWIP_UDP_QUEUE_LEN - 1;
+        socket->dgram_queue = m_new0(lwip_datagram_t, socket->dgram_alloc);
+    }
+    #endif
+
     switch (socket->type) {
         case MOD_NETWORK_SOCK_STREAM:
             socket->pcb.tcp = tcp_new();
@@ -1022,7 +1215,18 @@ STATIC mp_obj_t lwip_socket_accept(mp_obj_t self_in) {
     socket2->timeout = socket->timeout;
     socket2->state = STATE_CONNECTED;
     socket2->recv_offset = 0;
+    socket2->held_pbuf = NULL;
+    socket2->held_view = MP_OBJ_NULL;
+    socket2->dgram_queue = NULL;
+    socket2->dgram_alloc = 0;
+    socket2->dgram_iget = 0;
+    socket2->dgram_len = 0;
+    socket2->tcp_opts = socket->tcp_opts;
+    socket2->snd_limit = socket->snd_limit;
+    socket2->rcv_withhold = socket->rcv_withhold;
+    socket2->rcv_withheld = 0;
     socket2->callback = MP_OBJ_NULL;
+    lwip_tcp_set_nagle(socket2);
     tcp_arg(socket2->pcb.tcp, (void *)socket2);
     tcp_err(socket2->pcb.tcp, _lwip_tcp_error);
     tcp_recv(socket2->pcb.tcp, _lwip_tcp_recv);
@@ -1199,6 +1403,124 @@ STATIC mp_obj_t lwip_socket_recv(mp_obj_t self_in, mp_obj_t len_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(lwip_socket_recv_obj, lwip_socket_recv);
 
+STATIC mp_obj_t lwip_socket_recv_into(size_t n_args, const mp_obj_t *args) {
+    lwip_socket_obj_t *socket = MP_OBJ_TO_PTR(args[0]);
+    int _errno;
+
+    lwip_socket_check_connected(socket);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+    mp_uint_t len = bufinfo.len;
+    if (n_args > 2) {
+        mp_uint_t nbytes = mp_obj_get_int_truncated(args[2]);
+        if (nbytes != 0 && nbytes < len) {
+            len = nbytes;
+        }
+    }
+
+    mp_uint_t ret = 0;
+    switch (socket->type) {
+        case MOD_NETWORK_SOCK_STREAM: {
+            ret = lwip_tcp_receive(socket, bufinfo.buf, len, &_errno);
+            break;
+        }
+        case MOD_NETWORK_SOCK_DGRAM:
+        #if MICROPY_PY_LWIP_SOCK_RAW
+        case MOD_NETWORK_SOCK_RAW:
+        #endif
+            ret = lwip_raw_udp_receive(socket, bufinfo.buf, len, NULL, NULL, &_errno);
+            break;
+    }
+    if (ret == -1) {
+        mp_raise_OSError(_errno);
+    }
+
+    return mp_obj_new_int_from_uint(ret);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lwip_socket_recv_into_obj, 2, 3, lwip_socket_recv_into);
+
+#if MICROPY_PY_BUILTINS_MEMORYVIEW
+// Return a read-only memoryview of up to bufsize bytes straight out of the
+// first queued pbuf.  The pbuf is kept until the next call, or close().
+STATIC mp_obj_t lwip_socket_recv_pbuf(size_t n_args, const mp_obj_t *args) {
+    lwip_socket_obj_t *socket = MP_OBJ_TO_PTR(args[0]);
+    int _errno;
+
+    lwip_socket_check_connected(socket);
+
+    if (socket->type != MOD_NETWORK_SOCK_STREAM) {
+        mp_raise_OSError(MP_EOPNOTSUPP);
+    }
+
+    mp_uint_t len = (mp_uint_t)-1;
+    if (n_args > 1) {
+        mp_int_t n = mp_obj_get_int(args[1]);
+        if (n >= 0) {
+            len = n;
+        }
+    }
+
+    MICROPY_PY_LWIP_ENTER
+    lwip_socket_release_held(socket);
+    MICROPY_PY_LWIP_EXIT
+
+    // The same view object is reused for every call
+    if (socket->held_view == MP_OBJ_NULL) {
+        socket->held_view = mp_obj_new_memoryview('B', 0, NULL);
+    }
+
+    mp_uint_t ret = lwip_tcp_wait_incoming(socket, &_errno);
+    if (ret == MP_STREAM_ERROR) {
+        mp_raise_OSError(_errno);
+    }
+    if (ret == 0) {
+        // peer closed the connection, return an empty view
+        return socket->held_view;
+    }
+
+    MICROPY_PY_LWIP_ENTER
+
+    assert(socket->pcb.tcp != NULL);
+
+    struct pbuf *p = socket->incoming.pbuf;
+    mp_uint_t remaining = p->len - socket->recv_offset;
+    if (len > remaining) {
+        len = remaining;
+    }
+
+    mp_obj_array_t *view = MP_OBJ_TO_PTR(socket->held_view);
+    view->items = (byte *)p->payload + socket->recv_offset;
+    view->len = len;
+
+    if (len == remaining) {
+        // Take the pbuf off the queue, keeping the queue's reference to it,
+        // and ref the next buf as in lwip_tcp_receive for when it's freed.
+        socket->incoming.pbuf = p->next;
+        pbuf_ref(p->next);
+        socket->recv_offset = 0;
+    } else {
+        // The pbuf stays queued, so take an extra reference to it
+        pbuf_ref(p);
+        socket->recv_offset += len;
+    }
+    socket->held_pbuf = p;
+    lwip_tcp_recved(socket, len);
+
+    MICROPY_PY_LWIP_EXIT
+
+    return socket->held_view;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lwip_socket_recv_pbuf_obj, 1, 2, lwip_socket_recv_pbuf);
+#endif
+
+// Read the file in chunks the size of the TCP send buffer, so each chunk can
+// be queued in one go
+STATIC mp_obj_t lwip_socket_sendfile(size_t n_args, const mp_obj_t *args) {
+    return mp_stream_sendfile(n_args, args, TCP_SND_BUF);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lwip_socket_sendfile_obj, 2, 4, lwip_socket_sendfile);
+
 STATIC mp_obj_t lwip_socket_sendto(mp_obj_t self_in, mp_obj_t data_in, mp_obj_t addr_in) {
     lwip_socket_obj_t *socket = MP_OBJ_TO_PTR(self_in);
     int _errno;
@@ -1275,6 +1597,107 @@ STATIC mp_obj_t lwip_socket_recvfrom(mp_obj_t self_in, mp_obj_t len_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(lwip_socket_recvfrom_obj, lwip_socket_recvfrom);
 
+STATIC mp_obj_t lwip_socket_recvfrom_into(size_t n_args, const mp_obj_t *args) {
+    lwip_socket_obj_t *socket = MP_OBJ_TO_PTR(args[0]);
+    int _errno;
+
+    lwip_socket_check_connected(socket);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+    mp_uint_t len = bufinfo.len;
+    if (n_args > 2) {
+        mp_uint_t nbytes = mp_obj_get_int_truncated(args[2]);
+        if (nbytes != 0 && nbytes < len) {
+            len = nbytes;
+        }
+    }
+    byte ip[4];
+    mp_uint_t port;
+
+    mp_uint_t ret = 0;
+    switch (socket->type) {
+        case MOD_NETWORK_SOCK_STREAM: {
+            memcpy(ip, &socket->peer, sizeof(socket->peer));
+            port = (mp_uint_t)socket->peer_port;
+            ret = lwip_tcp_receive(socket, bufinfo.buf, len, &_errno);
+            break;
+        }
+        case MOD_NETWORK_SOCK_DGRAM:
+        #if MICROPY_PY_LWIP_SOCK_RAW
+        case MOD_NETWORK_SOCK_RAW:
+        #endif
+            ret = lwip_raw_udp_receive(socket, bufinfo.buf, len, ip, &port, &_errno);
+            break;
+    }
+    if (ret == -1) {
+        mp_raise_OSError(_errno);
+    }
+
+    mp_obj_t tuple[2] = {
+        mp_obj_new_int_from_uint(ret),
+        netutils_format_inet_addr(ip, port, NETUTILS_BIG),
+    };
+    return mp_obj_new_tuple(2, tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lwip_socket_recvfrom_into_obj, 2, 3, lwip_socket_recvfrom_into);
+
+// Number of packets that sendto_many() checks and then sends with one taking
+// of the lock
+#define SENDTO_MANY_CHUNK (8)
+
+STATIC mp_obj_t lwip_socket_sendto_many(mp_obj_t self_in, mp_obj_t items_in) {
+    lwip_socket_obj_t *socket = MP_OBJ_TO_PTR(self_in);
+
+    lwip_socket_check_connected(socket);
+
+    if (socket->type == MOD_NETWORK_SOCK_STREAM) {
+        mp_raise_OSError(MP_EOPNOTSUPP);
+    }
+
+    size_t n_items;
+    mp_obj_t *items;
+    mp_obj_get_array(items_in, &n_items, &items);
+
+    mp_buffer_info_t bufinfo[SENDTO_MANY_CHUNK];
+    uint8_t ip[SENDTO_MANY_CHUNK][NETUTILS_IPV4ADDR_BUFSIZE];
+    mp_uint_t port[SENDTO_MANY_CHUNK];
+
+    size_t sent = 0;
+    err_t err = ERR_OK;
+    while (sent < n_items && err == ERR_OK) {
+        // Get the buffers and addresses first, since that may raise
+        size_t n = MIN(n_items - sent, SENDTO_MANY_CHUNK);
+        for (size_t i = 0; i < n; ++i) {
+            mp_obj_t *item;
+            mp_obj_get_array_fixed_n(items[sent + i], 2, &item);
+            mp_get_buffer_raise(item[0], &bufinfo[i], MP_BUFFER_READ);
+            if (bufinfo[i].len > 0xffff) {
+                bufinfo[i].len = 0xffff;
+            }
+            port[i] = netutils_parse_inet_addr(item[1], ip[i], NETUTILS_BIG);
+        }
+
+        MICROPY_PY_LWIP_ENTER
+        for (size_t i = 0; i < n; ++i) {
+            err = lwip_raw_udp_send_locked(socket, bufinfo[i].buf, bufinfo[i].len, ip[i], port[i]);
+            if (err != ERR_OK) {
+                break;
+            }
+            ++sent;
+        }
+        MICROPY_PY_LWIP_EXIT
+    }
+
+    // Report an error only if nothing was sent, like a short write
+    if (sent == 0 && err != ERR_OK) {
+        mp_raise_OSError(error_lookup_table[-err]);
+    }
+
+    return MP_OBJ_NEW_SMALL_INT(sent);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(lwip_socket_sendto_many_obj, lwip_socket_sendto_many);
+
 STATIC mp_obj_t lwip_socket_sendall(mp_obj_t self_in, mp_obj_t buf_in) {
     lwip_socket_obj_t *socket = MP_OBJ_TO_PTR(self_in);
     lwip_socket_check_connected(socket);
@@ -1292,7 +1715,7 @@ STATIC mp_obj_t lwip_socket_sendall(mp_obj_t self_in, mp_obj_t buf_in) {
                 // way to determine how much data, if any, was successfully sent." Then, the
                 // most useful behavior is: check whether we will be able to send all of input
                 // data without EAGAIN, and if won't be, raise it without sending any.
-                if (bufinfo.len > tcp_sndbuf(socket->pcb.tcp)) {
+                if (bufinfo.len > lwip_tcp_sndbuf(socket)) {
                     mp_raise_OSError(MP_EAGAIN);
                 }
             }
@@ -1362,16 +1785,143 @@ STATIC mp_obj_t lwip_socket_setsockopt(size_t n_args, const mp_obj_t *args) {
 
     switch (opt) {
         // level: SOL_SOCKET
-        case SOF_REUSEADDR: {
+        case SOF_REUSEADDR:
+        case SOF_KEEPALIVE: {
             mp_int_t val = mp_obj_get_int(args[3]);
             // Options are common for UDP and TCP pcb's.
             if (val) {
-                ip_set_option(socket->pcb.tcp, SOF_REUSEADDR);
+                ip_set_option(socket->pcb.tcp, opt);
             } else {
-                ip_reset_option(socket->pcb.tcp, SOF_REUSEADDR);
+                ip_reset_option(socket->pcb.tcp, opt);
+            }
+            break;
+        }
+        case SO_SNDBUF: {
+            // Limit the TCP data waiting to be sent and acknowledged; lwIP's
+            // TCP_SND_BUF is the most that can be set.
+            mp_int_t val = mp_obj_get_int(args[3]);
+            if (socket->type == MOD_NETWORK_SOCK_STREAM) {
+                socket->snd_limit = val >= TCP_SND_BUF ? 0 : MAX(val, TCP_MSS);
             }
             break;
         }
+        case SO_RCVBUF: {
+            // For UDP and raw sockets this is the number of datagrams to hold.
+            mp_int_t val = mp_obj_get_int(args[3]);
+            if (socket->type == MOD_NETWORK_SOCK_STREAM) {
+                // For TCP, part of lwIP's TCP_WND receive window is kept back
+                // from the peer as received data is taken from the socket.
+                mp_uint_t withhold = 0;
+                if (val < TCP_WND) {
+                    withhold = MIN(TCP_WND - MAX(val, TCP_MSS), 0xffff);
+                }
+                MICROPY_PY_LWIP_ENTER
+                socket->rcv_withhold = withhold;
+                if (socket->rcv_withheld > withhold) {
+                    if (socket->pcb.tcp != NULL) {
+                        tcp_recved(socket->pcb.tcp, socket->rcv_withheld - withhold);
+                    }
+                    socket->rcv_withheld = withhold;
+                }
+                MICROPY_PY_LWIP_EXIT
+                break;
+            }
+            if (val < 1 || val > 256) {
+                mp_raise_ValueError(NULL);
+            }
+            uint8_t alloc = val - 1;
+            lwip_datagram_t *queue = NULL;
+            if (alloc != 0) {
+                queue = m_new0(lwip_datagram_t, alloc);
+            }
+
+            MICROPY_PY_LWIP_ENTER
+
+            // Move over as many queued datagrams as fit, and drop the rest
+            uint8_t len = 0;
+            for (; socket->dgram_len > 0; --socket->dgram_len) {
+                lwip_datagram_t *d = &socket->dgram_queue[socket->dgram_iget];
+                if (len < alloc) {
+                    queue[len++] = *d;
+                } else {
+                    pbuf_free(d->pbuf);
+                }
+                if (++socket->dgram_iget >= socket->dgram_alloc) {
+                    socket->dgram_iget = 0;
+                }
+            }
+            lwip_datagram_t *old_queue = socket->dgram_queue;
+            uint8_t old_alloc = socket->dgram_alloc;
+            socket->dgram_queue = queue;
+            socket->dgram_alloc = alloc;
+            socket->dgram_iget = 0;
+            socket->dgram_len = len;
+
+            MICROPY_PY_LWIP_EXIT
+
+            m_del(lwip_datagram_t, old_queue, old_alloc);
+            break;
+        }
+
+        // level: IPPROTO_TCP
+        case TCP_NODELAY:
+        case TCP_CORK: {
+            mp_int_t val = mp_obj_get_int(args[3]);
+            if (socket->type != MOD_NETWORK_SOCK_STREAM) {
+                break;
+            }
+            uint8_t flag = opt == TCP_NODELAY ? TCP_OPT_NODELAY : TCP_OPT_CORK;
+
+            MICROPY_PY_LWIP_ENTER
+            if (val) {
+                socket->tcp_opts |= flag;
+            } else {
+                socket->tcp_opts &= ~flag;
+            }
+            // A listening socket passes the options on to accepted sockets
+            if (socket->pcb.tcp != NULL && socket->state != STATE_LISTENING) {
+                lwip_tcp_set_nagle(socket);
+                if (flag == TCP_OPT_CORK && !val) {
+                    // Send what was kept back while the socket was corked
+                    tcp_output(socket->pcb.tcp);
+                }
+            }
+            MICROPY_PY_LWIP_EXIT
+            break;
+        }
+        case TCP_KEEPIDLE:
+        #if LWIP_TCP_KEEPALIVE
+        case TCP_KEEPINTVL:
+        case TCP_KEEPCNT:
+        #endif
+        {
+            // Times are in seconds; keepalives are enabled with SO_KEEPALIVE
+            mp_int_t val = mp_obj_get_int(args[3]);
+            if (socket->type != MOD_NETWORK_SOCK_STREAM) {
+                break;
+            }
+            if (val < 1) {
+                mp_raise_ValueError(NULL);
+            }
+            lwip_socket_check_connected(socket);
+            if (socket->state == STATE_LISTENING) {
+                // lwIP doesn't pass these on to accepted connections
+                mp_raise_OSError(MP_EOPNOTSUPP);
+            }
+
+            MICROPY_PY_LWIP_ENTER
+            if (opt == TCP_KEEPIDLE) {
+                socket->pcb.tcp->keep_idle = val * 1000;
+            #if LWIP_TCP_KEEPALIVE
+            } else if (opt == TCP_KEEPINTVL) {
+                socket->pcb.tcp->keep_intvl = val * 1000;
+            } else {
+                socket->pcb.tcp->keep_cnt = val;
+            #endif
+            }
+            MICROPY_PY_LWIP_EXIT
+            break;
+        }
 
         // level: IPPROTO_IP
         case IP_ADD_MEMBERSHIP: {
@@ -1445,6 +1995,12 @@ STATIC mp_uint_t lwip_socket_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_
     lwip_socket_obj_t *socket = MP_OBJ_TO_PTR(self_in);
     mp_uint_t ret;
 
+    if (request == MP_STREAM_WRITEV && socket->type == MOD_NETWORK_SOCK_STREAM) {
+        // lwip_tcp_sendv takes the lock itself, and may wait for buffer space
+        const struct mp_stream_writev_t *args = (const struct mp_stream_writev_t *)arg;
+        return lwip_tcp_sendv(socket, args->iov, args->iovcnt, errcode);
+    }
+
     MICROPY_PY_LWIP_ENTER
 
     if (request == MP_STREAM_POLL) {
@@ -1458,7 +2014,7 @@ STATIC mp_uint_t lwip_socket_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_
                     ret |= MP_STREAM_POLL_RD;
                 }
             } else {
-                // Otherwise there is just one slot for incoming data
+                // Otherwise incoming data is (or starts) in incoming.pbuf
                 if (socket->incoming.pbuf != NULL) {
                     ret |= MP_STREAM_POLL_RD;
                 }
@@ -1474,7 +2030,7 @@ STATIC mp_uint_t lwip_socket_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_
                 // raw socket is writable
                 ret |= MP_STREAM_POLL_WR;
             #endif
-            } else if (socket->pcb.tcp != NULL && tcp_sndbuf(socket->pcb.tcp) > 0) {
+            } else if (socket->pcb.tcp != NULL && lwip_tcp_sndbuf(socket) > 0) {
                 // TCP socket is writable
                 // Note: pcb.tcp==NULL if state<0, and in this case we can't call tcp_sndbuf
                 ret |= MP_STREAM_POLL_WR;
@@ -1502,6 +2058,8 @@ STATIC mp_uint_t lwip_socket_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_
         }
 
     } else if (request == MP_STREAM_CLOSE) {
+        lwip_socket_release_held(socket);
+
         if (socket->pcb.tcp == NULL) {
             MICROPY_PY_LWIP_EXIT
             return 0;
@@ -1564,8 +2122,14 @@ STATIC const mp_rom_map_elem_t lwip_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&lwip_socket_connect_obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&lwip_socket_send_obj) },
     { MP_ROM_QSTR(MP_QSTR_recv), MP_ROM_PTR(&lwip_socket_recv_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recv_into), MP_ROM_PTR(&lwip_socket_recv_into_obj) },
+    #if MICROPY_PY_BUILTINS_MEMORYVIEW
+    { MP_ROM_QSTR(MP_QSTR_recv_pbuf), MP_ROM_PTR(&lwip_socket_recv_pbuf_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_sendto), MP_ROM_PTR(&lwip_socket_sendto_obj) },
     { MP_ROM_QSTR(MP_QSTR_recvfrom), MP_ROM_PTR(&lwip_socket_recvfrom_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recvfrom_into), MP_ROM_PTR(&lwip_socket_recvfrom_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendto_many), MP_ROM_PTR(&lwip_socket_sendto_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendall), MP_ROM_PTR(&lwip_socket_sendall_obj) },
     { MP_ROM_QSTR(MP_QSTR_settimeout), MP_ROM_PTR(&lwip_socket_settimeout_obj) },
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&lwip_socket_setblocking_obj) },
@@ -1576,6 +2140,8 @@ STATIC const mp_rom_map_elem_t lwip_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writev), MP_ROM_PTR(&mp_stream_writev_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendfile), MP_ROM_PTR(&lwip_socket_sendfile_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(lwip_socket_locals_dict, lwip_socket_locals_dict_table);
 
@@ -1766,6 +2332,18 @@ STATIC const mp_rom_map_elem_t mp_module_lwip_globals_table[] = {
 
     { MP_ROM_QSTR(MP_QSTR_SOL_SOCKET), MP_ROM_INT(1) },
     { MP_ROM_QSTR(MP_QSTR_SO_REUSEADDR), MP_ROM_INT(SOF_REUSEADDR) },
+    { MP_ROM_QSTR(MP_QSTR_SO_KEEPALIVE), MP_ROM_INT(SOF_KEEPALIVE) },
+    { MP_ROM_QSTR(MP_QSTR_SO_SNDBUF), MP_ROM_INT(SO_SNDBUF) },
+    { MP_ROM_QSTR(MP_QSTR_SO_RCVBUF), MP_ROM_INT(SO_RCVBUF) },
+
+    { MP_ROM_QSTR(MP_QSTR_IPPROTO_TCP), MP_ROM_INT(6) },
+    { MP_ROM_QSTR(MP_QSTR_TCP_NODELAY), MP_ROM_INT(TCP_NODELAY) },
+    { MP_ROM_QSTR(MP_QSTR_TCP_CORK), MP_ROM_INT(TCP_CORK) },
+    { MP_ROM_QSTR(MP_QSTR_TCP_KEEPIDLE), MP_ROM_INT(TCP_KEEPIDLE) },
+    #if LWIP_TCP_KEEPALIVE
+    { MP_ROM_QSTR(MP_QSTR_TCP_KEEPINTVL), MP_ROM_INT(TCP_KEEPINTVL) },
+    { MP_ROM_QSTR(MP_QSTR_TCP_KEEPCNT), MP_ROM_INT(TCP_KEEPCNT) },
+    #endif
 
     { MP_ROM_QSTR(MP_QSTR_IPPROTO_IP), MP_ROM_INT(0) },
     { MP_ROM_QSTR(MP_QSTR_IP_ADD_MEMBERSHIP), MP_ROM_INT(IP_ADD_MEMBERSHIP) },
@@ -34,6 +34,10 @@
 #include "shared/netutils/netutils.h"
 #include "modnetwork.h"
 
+#if MICROPY_PY_NETWORK_CYW43
+#include "extmod/network_cyw43.h"
+#endif
+
 #if MICROPY_PY_NETWORK
 
 #if MICROPY_PY_LWIP
@@ -53,6 +57,9 @@ void mod_network_init(void) {
 }
 
 void mod_network_deinit(void) {
+    #if MICROPY_PY_NETWORK_CYW43
+    network_cyw43_irq_deinit();
+    #endif
 }
 
 void mod_network_register_nic(mp_obj_t nic) {
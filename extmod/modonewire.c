@@ -27,7 +27,7 @@
 #include <stdio.h>
 #include <stdint.h>
 
-#include "py/obj.h"
+#include "py/runtime.h"
 #include "py/mphal.h"
 
 #if MICROPY_PY_ONEWIRE
@@ -45,6 +45,9 @@
 #define TIMING_WRITE2 (50)
 #define TIMING_WRITE3 (10)
 
+#define ONEWIRE_SEARCH_ROM (0xf0)
+#define ONEWIRE_MATCH_ROM (0x55)
+
 STATIC int onewire_bus_reset(mp_hal_pin_obj_t pin) {
     mp_hal_pin_od_low(pin);
     mp_hal_delay_us(TIMING_RESET1);
@@ -83,6 +86,86 @@ STATIC void onewire_bus_writebit(mp_hal_pin_obj_t pin, int value) {
     mp_hal_quiet_timing_exit(i);
 }
 
+STATIC uint8_t onewire_bus_readbyte(mp_hal_pin_obj_t pin) {
+    uint8_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= onewire_bus_readbit(pin) << i;
+    }
+    return value;
+}
+
+STATIC void onewire_bus_writebyte(mp_hal_pin_obj_t pin, uint8_t value) {
+    for (int i = 0; i < 8; ++i) {
+        onewire_bus_writebit(pin, value & 1);
+        value >>= 1;
+    }
+}
+
+STATIC void onewire_bus_write(mp_hal_pin_obj_t pin, const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; ++i) {
+        onewire_bus_writebyte(pin, buf[i]);
+    }
+}
+
+STATIC uint8_t onewire_crc8_buf(const uint8_t *buf, size_t len) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t byte = buf[i];
+        for (int b = 0; b < 8; ++b) {
+            uint8_t fb_bit = (crc ^ byte) & 0x01;
+            if (fb_bit == 0x01) {
+                crc = crc ^ 0x18;
+            }
+            crc = (crc >> 1) & 0x7f;
+            if (fb_bit == 0x01) {
+                crc = crc | 0x80;
+            }
+            byte = byte >> 1;
+        }
+    }
+    return crc;
+}
+
+// One pass of the ROM search.  rom holds the ROM found by the previous pass
+// (all zeros for the first) and is updated in place with the next one.
+// Returns the discrepancy position to pass to the next search, 0 if this was
+// the last device, or -1 if there are no devices or the bus is in error.
+STATIC int onewire_bus_search_rom(mp_hal_pin_obj_t pin, uint8_t *rom, int diff) {
+    if (!onewire_bus_reset(pin)) {
+        return -1;
+    }
+    onewire_bus_writebyte(pin, ONEWIRE_SEARCH_ROM);
+    int next_diff = 0;
+    int i = 64;
+    for (int byte = 0; byte < 8; ++byte) {
+        uint8_t r_b = 0;
+        for (int bit = 0; bit < 8; ++bit) {
+            int b = onewire_bus_readbit(pin);
+            if (onewire_bus_readbit(pin)) {
+                if (b) {
+                    // there are no devices or there is an error on the bus
+                    return -1;
+                }
+            } else {
+                if (!b) {
+                    // collision, two devices with different bit meaning
+                    if (diff > i || ((rom[byte] & (1 << bit)) && diff != i)) {
+                        b = 1;
+                        next_diff = i;
+                    }
+                }
+            }
+            onewire_bus_writebit(pin, b);
+            if (b) {
+                r_b |= 1 << bit;
+            }
+            --i;
+        }
+        rom[byte] = r_b;
+    }
+    return next_diff;
+}
+
 /******************************************************************************/
 // MicroPython bindings
 
@@ -97,12 +180,7 @@ STATIC mp_obj_t onewire_readbit(mp_obj_t pin_in) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(onewire_readbit_obj, onewire_readbit);
 
 STATIC mp_obj_t onewire_readbyte(mp_obj_t pin_in) {
-    mp_hal_pin_obj_t pin = mp_hal_get_pin_obj(pin_in);
-    uint8_t value = 0;
-    for (int i = 0; i < 8; ++i) {
-        value |= onewire_bus_readbit(pin) << i;
-    }
-    return MP_OBJ_NEW_SMALL_INT(value);
+    return MP_OBJ_NEW_SMALL_INT(onewire_bus_readbyte(mp_hal_get_pin_obj(pin_in)));
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(onewire_readbyte_obj, onewire_readbyte);
 
@@ -113,35 +191,101 @@ STATIC mp_obj_t onewire_writebit(mp_obj_t pin_in, mp_obj_t value_in) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(onewire_writebit_obj, onewire_writebit);
 
 STATIC mp_obj_t onewire_writebyte(mp_obj_t pin_in, mp_obj_t value_in) {
-    mp_hal_pin_obj_t pin = mp_hal_get_pin_obj(pin_in);
-    int value = mp_obj_get_int(value_in);
-    for (int i = 0; i < 8; ++i) {
-        onewire_bus_writebit(pin, value & 1);
-        value >>= 1;
-    }
+    onewire_bus_writebyte(mp_hal_get_pin_obj(pin_in), mp_obj_get_int(value_in));
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(onewire_writebyte_obj, onewire_writebyte);
 
-STATIC mp_obj_t onewire_crc8(mp_obj_t data) {
+STATIC mp_obj_t onewire_readinto(mp_obj_t pin_in, mp_obj_t buf_in) {
+    mp_hal_pin_obj_t pin = mp_hal_get_pin_obj(pin_in);
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
-    uint8_t crc = 0;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
     for (size_t i = 0; i < bufinfo.len; ++i) {
-        uint8_t byte = ((uint8_t *)bufinfo.buf)[i];
-        for (int b = 0; b < 8; ++b) {
-            uint8_t fb_bit = (crc ^ byte) & 0x01;
-            if (fb_bit == 0x01) {
-                crc = crc ^ 0x18;
-            }
-            crc = (crc >> 1) & 0x7f;
-            if (fb_bit == 0x01) {
-                crc = crc | 0x80;
+        ((uint8_t *)bufinfo.buf)[i] = onewire_bus_readbyte(pin);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(onewire_readinto_obj, onewire_readinto);
+
+STATIC mp_obj_t onewire_write(mp_obj_t pin_in, mp_obj_t buf_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    onewire_bus_write(mp_hal_get_pin_obj(pin_in), bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(onewire_write_obj, onewire_write);
+
+// Return a list of the ROMs of all devices on the bus.
+STATIC mp_obj_t onewire_scan(mp_obj_t pin_in) {
+    mp_hal_pin_obj_t pin = mp_hal_get_pin_obj(pin_in);
+    mp_obj_t devices = mp_obj_new_list(0, NULL);
+    uint8_t rom[8] = {0};
+    int diff = 65;
+    for (int n = 0; n < 0xff; ++n) {
+        diff = onewire_bus_search_rom(pin, rom, diff);
+        if (diff < 0) {
+            break;
+        }
+        mp_obj_list_append(devices, mp_obj_new_bytearray(sizeof(rom), rom));
+        if (diff == 0) {
+            break;
+        }
+    }
+    return devices;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(onewire_scan_obj, onewire_scan);
+
+// Read from several devices in turn: for each ROM the device is selected,
+// cmd is sent and the device's equal share of buf is read.  Returns a list
+// of bools, one per device, which are True where that device responded and
+// its data has a valid CRC8.
+STATIC mp_obj_t onewire_read_roms(size_t n_args, const mp_obj_t *args) {
+    mp_hal_pin_obj_t pin = mp_hal_get_pin_obj(args[0]);
+    size_t n_roms;
+    mp_obj_t *roms;
+    mp_obj_get_array(args[1], &n_roms, &roms);
+    uint8_t cmd = mp_obj_get_int(args[2]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[3], &bufinfo, MP_BUFFER_WRITE);
+    if (n_roms == 0 || bufinfo.len % n_roms) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer length is invalid"));
+    }
+    size_t len = bufinfo.len / n_roms;
+
+    // check all the ROMs first so nothing is left half done
+    for (size_t i = 0; i < n_roms; ++i) {
+        mp_buffer_info_t rominfo;
+        mp_get_buffer_raise(roms[i], &rominfo, MP_BUFFER_READ);
+        if (rominfo.len != 8) {
+            mp_raise_ValueError(MP_ERROR_TEXT("ROM must be 8 bytes"));
+        }
+    }
+
+    mp_obj_t ok = mp_obj_new_list(n_roms, NULL);
+    uint8_t *buf = bufinfo.buf;
+    for (size_t i = 0; i < n_roms; ++i, buf += len) {
+        mp_buffer_info_t rominfo;
+        mp_get_buffer_raise(roms[i], &rominfo, MP_BUFFER_READ);
+        bool valid = false;
+        if (onewire_bus_reset(pin)) {
+            onewire_bus_writebyte(pin, ONEWIRE_MATCH_ROM);
+            onewire_bus_write(pin, rominfo.buf, rominfo.len);
+            onewire_bus_writebyte(pin, cmd);
+            for (size_t j = 0; j < len; ++j) {
+                buf[j] = onewire_bus_readbyte(pin);
             }
-            byte = byte >> 1;
+            valid = onewire_crc8_buf(buf, len) == 0;
         }
+        ((mp_obj_list_t *)MP_OBJ_TO_PTR(ok))->items[i] = mp_obj_new_bool(valid);
     }
-    return MP_OBJ_NEW_SMALL_INT(crc);
+    return ok;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(onewire_read_roms_obj, 4, 4, onewire_read_roms);
+
+STATIC mp_obj_t onewire_crc8(mp_obj_t data) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    return MP_OBJ_NEW_SMALL_INT(onewire_crc8_buf(bufinfo.buf, bufinfo.len));
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(onewire_crc8_obj, onewire_crc8);
 
@@ -153,6 +297,10 @@ STATIC const mp_rom_map_elem_t onewire_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readbyte), MP_ROM_PTR(&onewire_readbyte_obj) },
     { MP_ROM_QSTR(MP_QSTR_writebit), MP_ROM_PTR(&onewire_writebit_obj) },
     { MP_ROM_QSTR(MP_QSTR_writebyte), MP_ROM_PTR(&onewire_writebyte_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&onewire_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&onewire_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scan), MP_ROM_PTR(&onewire_scan_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_roms), MP_ROM_PTR(&onewire_read_roms_obj) },
     { MP_ROM_QSTR(MP_QSTR_crc8), MP_ROM_PTR(&onewire_crc8_obj) },
 };
 
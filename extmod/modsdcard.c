@@ -0,0 +1,521 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "extmod/machine_spi.h"
+#include "extmod/vfs.h"
+
+#if MICROPY_PY_SDCARD_SPI
+
+// C version of the SD card driver in drivers/sdcard/sdcard.py, with the same
+// constructor and block-device protocol.  Compared to the Python version it
+// keeps the card selected for the whole of a multi-block CMD18/CMD25 transfer,
+// polls for tokens without going through the VM, sends a pre-erase hint
+// (ACMD23) before multi-block writes, and moves the data blocks with the
+// port's asynchronous (eg DMA) SPI transfer where it has one.  As with the
+// Python version the card is left in its default CRC-less mode and the data
+// CRC bytes are clocked through but not checked.
+//
+// The SPI bus may be a machine.SPI/SoftSPI object, in which case its C
+// protocol is used directly, or any object with write() and write_readinto()
+// methods.  The CS pin is driven by calling it, as for machine.Pin.
+
+#define SDCARD_BLOCK_SIZE (512)
+#define SDCARD_CMD_TIMEOUT (100)
+#define SDCARD_TOKEN_TIMEOUT_MS (100)
+#define SDCARD_BUSY_TIMEOUT_MS (1000)
+
+// Data blocks at least this long go through transfer_start when available.
+#define SDCARD_ASYNC_MIN_LEN (64)
+
+#define R1_IDLE_STATE (1 << 0)
+#define R1_ILLEGAL_COMMAND (1 << 2)
+
+#define TOKEN_CMD25 (0xfc)
+#define TOKEN_STOP_TRAN (0xfd)
+#define TOKEN_DATA (0xfe)
+
+typedef struct _mp_obj_sdcard_t {
+    mp_obj_base_t base;
+    mp_obj_t spi;
+    mp_obj_t cs;
+    // The SPI protocol if spi is a machine.SPI object, else NULL.
+    const mp_machine_spi_p_t *spi_p;
+    uint32_t sectors;
+    // Multiplier from block number to command address: 512 for byte
+    // addressed (SDSC) cards, 1 for block addressed (SDHC/SDXC) cards.
+    uint32_t cdv;
+} mp_obj_sdcard_t;
+
+/******************************************************************************/
+// SPI and CS access
+
+STATIC void sdcard_cs(mp_obj_sdcard_t *self, int value) {
+    mp_call_function_1(self->cs, MP_OBJ_NEW_SMALL_INT(value));
+}
+
+STATIC void sdcard_spi_transfer_native(mp_obj_sdcard_t *self, size_t len, const uint8_t *src, uint8_t *dest) {
+    mp_obj_base_t *s = MP_OBJ_TO_PTR(self->spi);
+    #if MICROPY_PY_MACHINE_SPI_ASYNC
+    if (len >= SDCARD_ASYNC_MIN_LEN && self->spi_p->transfer_start != NULL) {
+        self->spi_p->transfer_start(s, len, src, dest);
+        while (self->spi_p->transfer_busy(s)) {
+            MICROPY_EVENT_POLL_HOOK
+        }
+        return;
+    }
+    #endif
+    self->spi_p->transfer(s, len, src, dest);
+}
+
+STATIC void sdcard_spi_write(mp_obj_sdcard_t *self, size_t len, const uint8_t *src) {
+    if (self->spi_p != NULL) {
+        sdcard_spi_transfer_native(self, len, src, NULL);
+    } else {
+        mp_obj_t buf = mp_obj_new_bytearray_by_ref(len, (void *)src);
+        mp_obj_t dest[3];
+        mp_load_method(self->spi, MP_QSTR_write, dest);
+        dest[2] = buf;
+        mp_call_method_n_kw(1, 0, dest);
+    }
+}
+
+// Read len bytes into buf while sending 0xff.
+STATIC void sdcard_spi_read(mp_obj_sdcard_t *self, size_t len, uint8_t *buf) {
+    memset(buf, 0xff, len);
+    if (self->spi_p != NULL) {
+        sdcard_spi_transfer_native(self, len, buf, buf);
+    } else {
+        mp_obj_t b = mp_obj_new_bytearray_by_ref(len, buf);
+        mp_obj_t dest[4];
+        mp_load_method(self->spi, MP_QSTR_write_readinto, dest);
+        dest[2] = b;
+        dest[3] = b;
+        mp_call_method_n_kw(2, 0, dest);
+    }
+}
+
+STATIC uint8_t sdcard_spi_read_byte(mp_obj_sdcard_t *self) {
+    uint8_t b;
+    sdcard_spi_read(self, 1, &b);
+    return b;
+}
+
+STATIC void sdcard_spi_write_byte(mp_obj_sdcard_t *self, uint8_t b) {
+    sdcard_spi_write(self, 1, &b);
+}
+
+STATIC void sdcard_release(mp_obj_sdcard_t *self) {
+    sdcard_cs(self, 1);
+    sdcard_spi_write_byte(self, 0xff);
+}
+
+STATIC NORETURN void sdcard_raise_eio(mp_obj_sdcard_t *self) {
+    sdcard_release(self);
+    mp_raise_OSError(MP_EIO);
+}
+
+STATIC void sdcard_init_spi(mp_obj_sdcard_t *self, mp_int_t baudrate) {
+    // pyb.SPI needs the MASTER mode passed in, machine.SPI has no such constant
+    mp_obj_t dest[2 + 1 + 3 * 2];
+    mp_load_method_maybe(self->spi, MP_QSTR_MASTER, dest);
+    mp_obj_t master = dest[0];
+    mp_load_method(self->spi, MP_QSTR_init, dest);
+    size_t n_args = 0;
+    if (master != MP_OBJ_NULL) {
+        dest[2] = master;
+        n_args = 1;
+    }
+    mp_obj_t *kw = dest + 2 + n_args;
+    kw[0] = MP_OBJ_NEW_QSTR(MP_QSTR_baudrate);
+    kw[1] = mp_obj_new_int(baudrate);
+    kw[2] = MP_OBJ_NEW_QSTR(MP_QSTR_phase);
+    kw[3] = MP_OBJ_NEW_SMALL_INT(0);
+    kw[4] = MP_OBJ_NEW_QSTR(MP_QSTR_polarity);
+    kw[5] = MP_OBJ_NEW_SMALL_INT(0);
+    mp_call_method_n_kw(n_args, 3, dest);
+}
+
+/******************************************************************************/
+// SD protocol
+
+// Send a command and return its R1 response, or -1 if there was none.  The
+// resp_len bytes following the R1 byte are read into resp (which may be NULL
+// to discard them).  The card is left selected if release is false.
+STATIC int sdcard_cmd(mp_obj_sdcard_t *self, uint8_t cmd, uint32_t arg, uint8_t crc,
+    uint8_t *resp, size_t resp_len, bool release, bool skip1) {
+    sdcard_cs(self, 0);
+
+    uint8_t buf[6] = { 0x40 | cmd, arg >> 24, arg >> 16, arg >> 8, arg, crc };
+    sdcard_spi_write(self, sizeof(buf), buf);
+
+    if (skip1) {
+        sdcard_spi_read_byte(self);
+    }
+
+    // wait for the response (bit 7 clear)
+    for (int i = 0; i < SDCARD_CMD_TIMEOUT; ++i) {
+        uint8_t response = sdcard_spi_read_byte(self);
+        if (!(response & 0x80)) {
+            uint8_t discard[4];
+            while (resp_len) {
+                size_t n = MIN(resp_len, sizeof(discard));
+                sdcard_spi_read(self, n, resp != NULL ? resp : discard);
+                if (resp != NULL) {
+                    resp += n;
+                }
+                resp_len -= n;
+            }
+            if (release) {
+                sdcard_release(self);
+            }
+            return response;
+        }
+    }
+
+    sdcard_release(self);
+    return -1;
+}
+
+// Wait for the card to stop signalling busy (holding its output low).
+STATIC bool sdcard_wait_not_busy(mp_obj_sdcard_t *self) {
+    mp_uint_t t0 = mp_hal_ticks_ms();
+    while (sdcard_spi_read_byte(self) != 0xff) {
+        if (mp_hal_ticks_ms() - t0 > SDCARD_BUSY_TIMEOUT_MS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Receive one data block with the card already selected.
+STATIC bool sdcard_read_data(mp_obj_sdcard_t *self, size_t len, uint8_t *buf) {
+    // wait for the start token; the card normally sends it within a few bytes
+    mp_uint_t t0 = mp_hal_ticks_ms();
+    for (;;) {
+        uint8_t token = sdcard_spi_read_byte(self);
+        if (token == TOKEN_DATA) {
+            break;
+        }
+        if (token != 0xff || mp_hal_ticks_ms() - t0 > SDCARD_TOKEN_TIMEOUT_MS) {
+            // an error token, or a timeout
+            return false;
+        }
+    }
+
+    // read the data and the (unchecked) CRC
+    uint8_t crc[2];
+    sdcard_spi_read(self, len, buf);
+    sdcard_spi_read(self, sizeof(crc), crc);
+    return true;
+}
+
+// Send one data block with the card already selected.
+STATIC bool sdcard_write_data(mp_obj_sdcard_t *self, uint8_t token, const uint8_t *buf) {
+    static const uint8_t crc[2] = { 0xff, 0xff };
+    sdcard_spi_write_byte(self, token);
+    sdcard_spi_write(self, SDCARD_BLOCK_SIZE, buf);
+    sdcard_spi_write(self, sizeof(crc), crc);
+
+    // check the data response, then wait for the write to finish
+    if ((sdcard_spi_read_byte(self) & 0x1f) != 0x05) {
+        return false;
+    }
+    return sdcard_wait_not_busy(self);
+}
+
+STATIC void sdcard_init_card_v1(mp_obj_sdcard_t *self) {
+    for (int i = 0; i < SDCARD_CMD_TIMEOUT; ++i) {
+        sdcard_cmd(self, 55, 0, 0, NULL, 0, true, false);
+        if (sdcard_cmd(self, 41, 0, 0, NULL, 0, true, false) == 0) {
+            // SDSC card, uses byte addressing in read/write/erase commands
+            self->cdv = 512;
+            return;
+        }
+    }
+    mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("timeout waiting for v1 card"));
+}
+
+STATIC void sdcard_init_card_v2(mp_obj_sdcard_t *self) {
+    for (int i = 0; i < SDCARD_CMD_TIMEOUT; ++i) {
+        mp_hal_delay_ms(50);
+        sdcard_cmd(self, 58, 0, 0, NULL, 4, true, false);
+        sdcard_cmd(self, 55, 0, 0, NULL, 0, true, false);
+        if (sdcard_cmd(self, 41, 0x40000000, 0, NULL, 0, true, false) == 0) {
+            uint8_t ocr[4];
+            sdcard_cmd(self, 58, 0, 0, ocr, 4, true, false);
+            if (!(ocr[0] & 0x40)) {
+                // SDSC card, uses byte addressing in read/write/erase commands
+                self->cdv = 512;
+            } else {
+                // SDHC/SDXC card, uses block addressing in read/write/erase commands
+                self->cdv = 1;
+            }
+            return;
+        }
+    }
+    mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("timeout waiting for v2 card"));
+}
+
+STATIC void sdcard_init_card(mp_obj_sdcard_t *self, mp_int_t baudrate) {
+    // init CS pin
+    mp_obj_t dest[2 + 1 + 2];
+    mp_load_method(self->cs, MP_QSTR_OUT, dest);
+    mp_obj_t out = dest[0];
+    mp_load_method(self->cs, MP_QSTR_init, dest);
+    dest[2] = out;
+    dest[3] = MP_OBJ_NEW_QSTR(MP_QSTR_value);
+    dest[4] = MP_OBJ_NEW_SMALL_INT(1);
+    mp_call_method_n_kw(1, 1, dest);
+
+    // init SPI bus; use low data rate for initialisation
+    sdcard_init_spi(self, 100000);
+
+    // clock card at least 100 cycles with cs high
+    for (int i = 0; i < 16; ++i) {
+        sdcard_spi_write_byte(self, 0xff);
+    }
+
+    // CMD0: init card; should return R1_IDLE_STATE (allow 5 attempts)
+    int i = 0;
+    while (sdcard_cmd(self, 0, 0, 0x95, NULL, 0, true, false) != R1_IDLE_STATE) {
+        if (++i == 5) {
+            mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("no SD card"));
+        }
+    }
+
+    // CMD8: determine card version
+    int r = sdcard_cmd(self, 8, 0x01aa, 0x87, NULL, 4, true, false);
+    if (r == R1_IDLE_STATE) {
+        sdcard_init_card_v2(self);
+    } else if (r == (R1_IDLE_STATE | R1_ILLEGAL_COMMAND)) {
+        sdcard_init_card_v1(self);
+    } else {
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("couldn't determine SD card version"));
+    }
+
+    // get the number of sectors
+    // CMD9: response R2 (R1 byte + 16-byte block read)
+    uint8_t csd[16];
+    if (sdcard_cmd(self, 9, 0, 0, NULL, 0, false, false) != 0
+        || !sdcard_read_data(self, sizeof(csd), csd)) {
+        sdcard_release(self);
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("no response from SD card"));
+    }
+    sdcard_release(self);
+    if ((csd[0] & 0xc0) == 0x40) {
+        // CSD version 2.0
+        self->sectors = ((csd[8] << 8 | csd[9]) + 1) * 1024;
+    } else if ((csd[0] & 0xc0) == 0x00) {
+        // CSD version 1.0 (old, <=2GB)
+        uint32_t c_size = (csd[6] & 0x3) << 10 | csd[7] << 2 | csd[8] >> 6;
+        uint32_t c_size_mult = (csd[9] & 0x3) << 1 | csd[10] >> 7;
+        uint32_t read_bl_len = csd[5] & 0xf;
+        self->sectors = (c_size + 1) << (c_size_mult + 2 + read_bl_len - 9);
+    } else {
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("SD card CSD format not supported"));
+    }
+
+    // CMD16: set block length to 512 bytes
+    if (sdcard_cmd(self, 16, SDCARD_BLOCK_SIZE, 0, NULL, 0, true, false) != 0) {
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("can't set 512 block size"));
+    }
+
+    // set to high data rate now that it's initialised
+    sdcard_init_spi(self, baudrate);
+}
+
+/******************************************************************************/
+// MicroPython bindings
+
+STATIC mp_obj_t sdcard_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_spi, ARG_cs, ARG_baudrate };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_spi, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_cs, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_baudrate, MP_ARG_INT, {.u_int = 1320000} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_sdcard_t *self = m_new_obj(mp_obj_sdcard_t);
+    self->base.type = type;
+    self->spi = args[ARG_spi].u_obj;
+    self->cs = args[ARG_cs].u_obj;
+    self->spi_p = NULL;
+    #if MICROPY_PY_MACHINE_SPI || MICROPY_PY_MACHINE_SOFTSPI
+    // all machine.SPI types share this locals dict and implement the protocol
+    if (mp_obj_is_obj(self->spi)
+        && ((mp_obj_base_t *)MP_OBJ_TO_PTR(self->spi))->type->locals_dict == &mp_machine_spi_locals_dict) {
+        self->spi_p = ((mp_obj_base_t *)MP_OBJ_TO_PTR(self->spi))->type->protocol;
+    }
+    #endif
+
+    sdcard_init_card(self, args[ARG_baudrate].u_int);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t sdcard_readblocks(mp_obj_t self_in, mp_obj_t block_num_in, mp_obj_t buf_in) {
+    mp_obj_sdcard_t *self = MP_OBJ_TO_PTR(self_in);
+    uint32_t addr = mp_obj_get_int(block_num_in) * self->cdv;
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    size_t nblocks = bufinfo.len / SDCARD_BLOCK_SIZE;
+    if (nblocks == 0 || bufinfo.len % SDCARD_BLOCK_SIZE) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer length is invalid"));
+    }
+    #if MICROPY_PY_MACHINE_SPI_ASYNC
+    if (self->spi_p != NULL) {
+        mp_machine_spi_wait_bus(self->spi);
+    }
+    #endif
+
+    uint8_t *buf = bufinfo.buf;
+    if (nblocks == 1) {
+        // CMD17: read a single block
+        if (sdcard_cmd(self, 17, addr, 0, NULL, 0, false, false) != 0
+            || !sdcard_read_data(self, SDCARD_BLOCK_SIZE, buf)) {
+            sdcard_raise_eio(self);
+        }
+        sdcard_release(self);
+    } else {
+        // CMD18: read multiple blocks, keeping the card selected throughout
+        if (sdcard_cmd(self, 18, addr, 0, NULL, 0, false, false) != 0) {
+            sdcard_raise_eio(self);
+        }
+        for (; nblocks; --nblocks, buf += SDCARD_BLOCK_SIZE) {
+            if (!sdcard_read_data(self, SDCARD_BLOCK_SIZE, buf)) {
+                sdcard_cmd(self, 12, 0, 0xff, NULL, 0, true, true);
+                mp_raise_OSError(MP_EIO);
+            }
+        }
+        // CMD12: stop the transmission, then wait for the card to be ready
+        if (sdcard_cmd(self, 12, 0, 0xff, NULL, 0, false, true) != 0
+            || !sdcard_wait_not_busy(self)) {
+            sdcard_raise_eio(self);
+        }
+        sdcard_release(self);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(sdcard_readblocks_obj, sdcard_readblocks);
+
+STATIC mp_obj_t sdcard_writeblocks(mp_obj_t self_in, mp_obj_t block_num_in, mp_obj_t buf_in) {
+    mp_obj_sdcard_t *self = MP_OBJ_TO_PTR(self_in);
+    uint32_t addr = mp_obj_get_int(block_num_in) * self->cdv;
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    size_t nblocks = bufinfo.len / SDCARD_BLOCK_SIZE;
+    if (nblocks == 0 || bufinfo.len % SDCARD_BLOCK_SIZE) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer length is invalid"));
+    }
+    #if MICROPY_PY_MACHINE_SPI_ASYNC
+    if (self->spi_p != NULL) {
+        mp_machine_spi_wait_bus(self->spi);
+    }
+    #endif
+
+    const uint8_t *buf = bufinfo.buf;
+    if (nblocks == 1) {
+        // CMD24: write a single block
+        if (sdcard_cmd(self, 24, addr, 0, NULL, 0, false, false) != 0
+            || !sdcard_write_data(self, TOKEN_DATA, buf)) {
+            sdcard_raise_eio(self);
+        }
+        sdcard_release(self);
+    } else {
+        // ACMD23: tell the card how many blocks follow so it can pre-erase
+        // them; this is only a hint so its response is not checked
+        sdcard_cmd(self, 55, 0, 0, NULL, 0, true, false);
+        sdcard_cmd(self, 23, nblocks, 0, NULL, 0, true, false);
+
+        // CMD25: write multiple blocks, keeping the card selected throughout
+        if (sdcard_cmd(self, 25, addr, 0, NULL, 0, false, false) != 0) {
+            sdcard_raise_eio(self);
+        }
+        bool ok = true;
+        for (; nblocks && ok; --nblocks, buf += SDCARD_BLOCK_SIZE) {
+            ok = sdcard_write_data(self, TOKEN_CMD25, buf);
+        }
+        // stop the transmission, even after an error, and wait for the card
+        sdcard_spi_write_byte(self, TOKEN_STOP_TRAN);
+        sdcard_spi_read_byte(self);
+        if (!sdcard_wait_not_busy(self) || !ok) {
+            sdcard_raise_eio(self);
+        }
+        sdcard_release(self);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(sdcard_writeblocks_obj, sdcard_writeblocks);
+
+STATIC mp_obj_t sdcard_ioctl(mp_obj_t self_in, mp_obj_t cmd_in, mp_obj_t arg_in) {
+    mp_obj_sdcard_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t cmd = mp_obj_get_int(cmd_in);
+    switch (cmd) {
+        case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
+            return mp_obj_new_int_from_uint(self->sectors);
+        case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
+            return MP_OBJ_NEW_SMALL_INT(SDCARD_BLOCK_SIZE);
+        default:
+            return mp_const_none;
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(sdcard_ioctl_obj, sdcard_ioctl);
+
+STATIC const mp_rom_map_elem_t sdcard_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&sdcard_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&sdcard_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ioctl), MP_ROM_PTR(&sdcard_ioctl_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(sdcard_locals_dict, sdcard_locals_dict_table);
+
+STATIC const mp_obj_type_t sdcard_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_SDCard,
+    .make_new = sdcard_make_new,
+    .locals_dict = (mp_obj_dict_t *)&sdcard_locals_dict,
+};
+
+STATIC const mp_rom_map_elem_t mp_module_sdcard_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR__sdcard) },
+    { MP_ROM_QSTR(MP_QSTR_SDCard), MP_ROM_PTR(&sdcard_type) },
+};
+STATIC MP_DEFINE_CONST_DICT(mp_module_sdcard_globals, mp_module_sdcard_globals_table);
+
+const mp_obj_module_t mp_module_sdcard = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&mp_module_sdcard_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR__sdcard, mp_module_sdcard);
+
+#endif // MICROPY_PY_SDCARD_SPI
@@ -28,6 +28,10 @@
 #include "py/smallint.h"
 #include "py/pairheap.h"
 #include "py/mphal.h"
+#include "py/objgenerator.h"
+#include "py/stream.h"
+#include "py/objexcept.h"
+#include "py/gc.h"
 
 #if MICROPY_PY_UASYNCIO
 
@@ -295,6 +299,810 @@ STATIC const mp_obj_type_t task_type = {
     .iternext = task_iternext,
 };
 
+#if MICROPY_PY_UASYNCIO_RUN_LOOP
+
+/******************************************************************************/
+// sleep_ms, using a singleton generator so it doesn't allocate on the heap
+
+typedef struct _mp_obj_sleep_gen_t {
+    mp_obj_base_t base;
+    mp_obj_t state; // time to schedule the task at, or MP_OBJ_NULL once it yielded
+} mp_obj_sleep_gen_t;
+
+STATIC mp_obj_t sleep_gen_iternext(mp_obj_t self_in) {
+    mp_obj_sleep_gen_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->state != MP_OBJ_NULL) {
+        // _task_queue.push(cur_task, self.state)
+        mp_obj_t args[3] = {
+            mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR__task_queue)),
+            mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_cur_task)),
+            self->state,
+        };
+        self->state = MP_OBJ_NULL;
+        task_queue_push(3, args);
+        return mp_const_none;
+    } else {
+        return MP_OBJ_STOP_ITERATION;
+    }
+}
+
+STATIC const mp_obj_type_t sleep_gen_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_SingletonGenerator,
+    .getiter = mp_identity_getiter,
+    .iternext = sleep_gen_iternext,
+};
+
+// The state is only ever a small int, so this doesn't need to be a root pointer.
+STATIC mp_obj_sleep_gen_t sleep_gen = { { &sleep_gen_type }, MP_OBJ_NULL };
+
+STATIC mp_obj_t uasyncio_sleep_ms(mp_obj_t t_in) {
+    assert(sleep_gen.state == MP_OBJ_NULL);
+    mp_int_t t = mp_obj_get_int(t_in);
+    if (t < 0) {
+        t = 0;
+    }
+    sleep_gen.state = MP_OBJ_NEW_SMALL_INT((mp_hal_ticks_ms() + t) & (MICROPY_PY_UTIME_TICKS_PERIOD - 1));
+    return MP_OBJ_FROM_PTR(&sleep_gen);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(uasyncio_sleep_ms_obj, uasyncio_sleep_ms);
+
+/******************************************************************************/
+// Main run loop
+
+// The equivalent of IOQueue.wait_io_event: poll the streams for up to dt ms
+// and schedule the tasks waiting on those that are ready.
+STATIC void io_queue_wait_io_event(mp_obj_t io_queue, mp_obj_t map, mp_obj_t task_queue, mp_int_t dt) {
+    mp_obj_t dest[4];
+    mp_load_method(mp_load_attr(io_queue, MP_QSTR_poller), MP_QSTR_ipoll, dest);
+    dest[2] = MP_OBJ_NEW_SMALL_INT(dt);
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iter = mp_getiter(mp_call_method_n_kw(1, 0, dest), &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+        mp_obj_t *s_ev;
+        mp_obj_get_array_fixed_n(item, 2, &s_ev);
+        mp_obj_t s = s_ev[0];
+        mp_int_t ev = mp_obj_get_int(s_ev[1]);
+        mp_obj_t *sm;
+        mp_obj_get_array_fixed_n(mp_obj_subscr(map, mp_obj_id(s), MP_OBJ_SENTINEL), 3, &sm);
+        mp_obj_t args[2] = { task_queue, MP_OBJ_NULL };
+        if ((ev & ~MP_STREAM_POLL_WR) && sm[0] != mp_const_none) {
+            // POLLIN or error
+            args[1] = sm[0];
+            task_queue_push(2, args);
+            sm[0] = mp_const_none;
+        }
+        if ((ev & ~MP_STREAM_POLL_RD) && sm[1] != mp_const_none) {
+            // POLLOUT or error
+            args[1] = sm[1];
+            task_queue_push(2, args);
+            sm[1] = mp_const_none;
+        }
+        if (sm[0] == mp_const_none && sm[1] == mp_const_none) {
+            mp_load_method(io_queue, MP_QSTR__dequeue, dest);
+            dest[2] = s;
+            mp_call_method_n_kw(1, 0, dest);
+        } else {
+            mp_load_method(mp_load_attr(io_queue, MP_QSTR_poller), MP_QSTR_modify, dest);
+            dest[2] = s;
+            dest[3] = MP_OBJ_NEW_SMALL_INT(sm[0] == mp_const_none ? MP_STREAM_POLL_WR : MP_STREAM_POLL_RD);
+            mp_call_method_n_kw(2, 0, dest);
+        }
+    }
+}
+
+// Continue running the coroutine of a task, either sending None or throwing exc
+// into it.  Returns MP_OBJ_NULL if it yielded, or else the exception that ended
+// it, which is a StopIteration if it returned.
+STATIC mp_obj_t task_resume(mp_obj_t coro, mp_obj_t exc) {
+    mp_obj_t ret;
+    mp_vm_return_kind_t kind;
+    if (mp_obj_get_type(coro) == &mp_type_gen_instance) {
+        kind = mp_obj_gen_resume(coro, mp_const_none, exc, &ret);
+    } else {
+        // A Python object with send and throw methods, which raise to finish.
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            mp_obj_t dest[3];
+            mp_load_method(coro, exc == MP_OBJ_NULL ? MP_QSTR_send : MP_QSTR_throw, dest);
+            dest[2] = exc == MP_OBJ_NULL ? mp_const_none : exc;
+            mp_call_method_n_kw(1, 0, dest);
+            nlr_pop();
+            kind = MP_VM_RETURN_YIELD;
+        } else {
+            ret = MP_OBJ_FROM_PTR(nlr.ret_val);
+            kind = MP_VM_RETURN_EXCEPTION;
+        }
+    }
+    if (kind == MP_VM_RETURN_YIELD) {
+        return MP_OBJ_NULL;
+    } else if (kind == MP_VM_RETURN_NORMAL) {
+        if (ret == mp_const_none) {
+            return mp_obj_new_exception(&mp_type_StopIteration);
+        }
+        return mp_obj_new_exception_arg1(&mp_type_StopIteration, ret);
+    } else {
+        return ret;
+    }
+}
+
+// Keep scheduling tasks until there are none left to schedule.  This is the
+// equivalent of core.run_until_complete, and must be kept in step with it.
+STATIC mp_obj_t uasyncio_run_until_complete(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t main_task = n_args == 1 ? args[0] : mp_const_none;
+    if (uasyncio_context == MP_OBJ_NULL) {
+        // No task was ever created, so there is nothing to run.
+        return mp_const_none;
+    }
+    mp_obj_t cancelled_error = mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_CancelledError));
+
+    // Poll once up front, as the Python version of the loop does, so the poller
+    // allocates its result before any task can lock the heap.
+    mp_obj_t io_queue = mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR__io_queue));
+    io_queue_wait_io_event(io_queue, mp_load_attr(io_queue, MP_QSTR_map),
+        mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR__task_queue)), 0);
+
+    for (;;) {
+        mp_obj_t task_queue_in = mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR__task_queue));
+        io_queue = mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR__io_queue));
+        mp_obj_task_queue_t *task_queue = MP_OBJ_TO_PTR(task_queue_in);
+
+        // Wait until the head of _task_queue is ready to run
+        mp_int_t dt = 1;
+        while (dt > 0) {
+            dt = -1;
+            mp_obj_t map = mp_load_attr(io_queue, MP_QSTR_map);
+            if (task_queue->heap != NULL) {
+                // A task waiting on _task_queue; "ph_key" is time to schedule task at
+                dt = ticks_diff(task_queue->heap->ph_key, ticks());
+                if (dt < 0) {
+                    dt = 0;
+                }
+            } else if (!mp_obj_is_true(map)) {
+                // No tasks can be woken so finished running
+                return mp_const_none;
+            }
+            if (dt != 0 || mp_obj_is_true(map)) {
+                // Only poll when there's a stream to poll or time to wait.
+                io_queue_wait_io_event(io_queue, map, task_queue_in, dt);
+            }
+        }
+
+        // Get next task to run and continue it
+        mp_obj_t t_in = task_queue_pop(task_queue_in);
+        mp_obj_task_t *t = MP_OBJ_TO_PTR(t_in);
+        mp_obj_dict_store(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_cur_task), t_in);
+        mp_obj_t exc = t->data;
+        mp_obj_t er;
+        if (!mp_obj_is_true(exc)) {
+            er = task_resume(t->coro, MP_OBJ_NULL);
+        } else {
+            // The task was cancelled, or it finished with an exception that wasn't
+            // await'ed on, in which case throwing it in raises StopIteration.
+            t->data = mp_const_none;
+            er = task_resume(t->coro, exc);
+        }
+        if (er == MP_OBJ_NULL) {
+            // The coroutine yielded; it's responsible for rescheduling itself.
+            continue;
+        }
+        if (!mp_obj_exception_match(er, cancelled_error)
+            && !mp_obj_exception_match(er, MP_OBJ_FROM_PTR(&mp_type_Exception))) {
+            nlr_raise(er);
+        }
+
+        // This task is done, check if it's the main task and then loop should stop
+        if (t_in == main_task) {
+            if (mp_obj_exception_match(er, MP_OBJ_FROM_PTR(&mp_type_StopIteration))) {
+                return mp_obj_exception_get_value(er);
+            }
+            nlr_raise(er);
+        }
+        if (mp_obj_is_true(t->state)) {
+            // Task was running but is now finished.
+            bool waiting = false;
+            if (t->state == TASK_STATE_RUNNING_NOT_WAITED_ON) {
+                // "None" indicates that the task is complete and not await'ed on (yet).
+                t->state = TASK_STATE_DONE_NOT_WAITED_ON;
+            } else if (mp_obj_is_callable(t->state)) {
+                // The task has a callback registered to be called on completion.
+                mp_call_function_2(t->state, t_in, er);
+                t->state = TASK_STATE_DONE_WAS_WAITED_ON;
+                waiting = true;
+            } else {
+                // Schedule any other tasks waiting on the completion of this task.
+                mp_obj_t push_args[2] = { task_queue_in, MP_OBJ_NULL };
+                while (task_queue_peek(t->state) != mp_const_none) {
+                    push_args[1] = task_queue_pop(t->state);
+                    task_queue_push(2, push_args);
+                    waiting = true;
+                }
+                // "False" indicates that the task is complete and has been await'ed on.
+                t->state = TASK_STATE_DONE_WAS_WAITED_ON;
+            }
+            if (!waiting
+                && !mp_obj_exception_match(er, cancelled_error)
+                && !mp_obj_exception_match(er, MP_OBJ_FROM_PTR(&mp_type_StopIteration))) {
+                // An exception ended this detached task, so queue it for later
+                // execution to handle the uncaught exception if no other task retrieves
+                // the exception in the meantime (this is handled by Task.throw).
+                mp_obj_t push_args[2] = { task_queue_in, t_in };
+                task_queue_push(2, push_args);
+            }
+            // Save return value of coro to pass up to caller.
+            t->data = er;
+        } else if (t->state == TASK_STATE_DONE_NOT_WAITED_ON) {
+            // Task is already finished and nothing await'ed on the task,
+            // so call the exception handler.
+            mp_obj_t exc_context = mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR__exc_context));
+            mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_exception), exc);
+            mp_obj_dict_store(exc_context, MP_OBJ_NEW_QSTR(MP_QSTR_future), t_in);
+            mp_obj_t loop = mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_Loop));
+            mp_call_function_1(mp_load_attr(loop, MP_QSTR_call_exception_handler), exc_context);
+        }
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(uasyncio_run_until_complete_obj, 0, 1, uasyncio_run_until_complete);
+
+#endif // MICROPY_PY_UASYNCIO_RUN_LOOP
+
+#if MICROPY_PY_UASYNCIO_PRIMITIVES
+
+/******************************************************************************/
+// Helpers for synchronisation primitives that keep their waiting tasks on a TaskQueue
+
+STATIC mp_obj_t context_get(qstr name) {
+    return mp_obj_dict_get(uasyncio_context, MP_OBJ_NEW_QSTR(name));
+}
+
+// Put the calling task on the given queue, and set its data to that queue so
+// the task can be removed from it if cancelled.
+STATIC void wait_on(mp_obj_t waiting) {
+    mp_obj_t args[2] = { waiting, context_get(MP_QSTR_cur_task) };
+    task_queue_push(2, args);
+    ((mp_obj_task_t *)MP_OBJ_TO_PTR(args[1]))->data = waiting;
+}
+
+// Schedule the first task on the given queue, if there is one.
+STATIC void wake_one(mp_obj_t waiting) {
+    mp_obj_task_queue_t *q = MP_OBJ_TO_PTR(waiting);
+    if (q->heap != NULL) {
+        mp_obj_t args[2] = { context_get(MP_QSTR__task_queue), task_queue_pop(waiting) };
+        task_queue_push(2, args);
+    }
+}
+
+STATIC mp_obj_t new_task_queue(void) {
+    return task_queue_make_new(&task_queue_type, 0, 0, NULL);
+}
+
+/******************************************************************************/
+// Awaitable returned by the wait/acquire/get/put methods of the primitives
+
+enum {
+    WAITER_DONE,
+    WAITER_EVENT,
+    WAITER_LOCK,
+    WAITER_FLAG,
+    WAITER_GET,
+    WAITER_PUT,
+};
+
+typedef struct _mp_obj_waiter_t {
+    mp_obj_base_t base;
+    uint8_t kind;
+    bool yielded; // whether the calling task was suspended and has since resumed
+    mp_obj_t prim; // the Event, Lock, ThreadSafeFlag or Queue being waited on
+    mp_obj_t item; // the item to put, for Queue.put
+} mp_obj_waiter_t;
+
+typedef struct _mp_obj_event_t {
+    mp_obj_base_t base;
+    bool state;
+    mp_obj_t waiting;
+} mp_obj_event_t;
+
+typedef struct _mp_obj_lock_t {
+    mp_obj_base_t base;
+    // The state can take the following values:
+    // - 0: unlocked
+    // - 1: locked
+    // - <Task>: unlocked but this task has been scheduled to acquire the lock next
+    mp_obj_t state;
+    mp_obj_t waiting;
+} mp_obj_lock_t;
+
+typedef struct _mp_obj_flag_t {
+    mp_obj_base_t base;
+    volatile bool flag;
+} mp_obj_flag_t;
+
+// The items are held in a ring buffer with one slot more than the capacity, and
+// only put_nowait writes iput and only get_nowait writes iget.  So with a bounded
+// queue (whose buffer is never reallocated) one producer can safely put items
+// from a hard IRQ while the asyncio loop takes them out.
+typedef struct _mp_obj_queue_t {
+    mp_obj_base_t base;
+    size_t maxsize; // 0 for an unbounded queue
+    size_t alloc;
+    volatile size_t iget;
+    volatile size_t iput;
+    mp_obj_t *items;
+    mp_obj_t getters;
+    mp_obj_t putters;
+    volatile bool wake_pending;
+} mp_obj_queue_t;
+
+STATIC const mp_obj_type_t waiter_type;
+
+STATIC const mp_obj_waiter_t waiter_done = { { &waiter_type }, WAITER_DONE, false, MP_OBJ_NULL, MP_OBJ_NULL };
+
+STATIC mp_obj_t waiter_new(uint8_t kind, mp_obj_t prim, mp_obj_t item) {
+    mp_obj_waiter_t *self = mp_obj_malloc(mp_obj_waiter_t, &waiter_type);
+    self->kind = kind;
+    self->yielded = false;
+    self->prim = prim;
+    self->item = item;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC void lock_do_release(mp_obj_lock_t *self);
+STATIC bool queue_is_full(mp_obj_queue_t *self);
+STATIC mp_obj_t queue_take(mp_obj_queue_t *self);
+STATIC void queue_append(mp_obj_queue_t *self, mp_obj_t item);
+
+STATIC mp_obj_t waiter_iternext(mp_obj_t self_in) {
+    mp_obj_waiter_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (self->kind) {
+        case WAITER_EVENT: {
+            mp_obj_event_t *event = MP_OBJ_TO_PTR(self->prim);
+            if (event->state || self->yielded) {
+                return mp_make_stop_iteration(mp_const_true);
+            }
+            wait_on(event->waiting);
+            break;
+        }
+        case WAITER_LOCK: {
+            mp_obj_lock_t *lock = MP_OBJ_TO_PTR(self->prim);
+            if (self->yielded || lock->state == MP_OBJ_NEW_SMALL_INT(0)) {
+                lock->state = MP_OBJ_NEW_SMALL_INT(1);
+                return mp_make_stop_iteration(mp_const_true);
+            }
+            wait_on(lock->waiting);
+            break;
+        }
+        case WAITER_FLAG: {
+            mp_obj_flag_t *flag = MP_OBJ_TO_PTR(self->prim);
+            if (flag->flag || self->yielded) {
+                flag->flag = false;
+                return MP_OBJ_STOP_ITERATION;
+            }
+            // _io_queue.queue_read(self.prim)
+            mp_obj_t dest[3];
+            mp_load_method(context_get(MP_QSTR__io_queue), MP_QSTR_queue_read, dest);
+            dest[2] = self->prim;
+            mp_call_method_n_kw(1, 0, dest);
+            break;
+        }
+        case WAITER_GET: {
+            // A woken getter may find the queue empty again if a get_nowait got
+            // in first, in which case it just waits again.
+            mp_obj_queue_t *queue = MP_OBJ_TO_PTR(self->prim);
+            if (queue->iget != queue->iput) {
+                return mp_make_stop_iteration(queue_take(queue));
+            }
+            wait_on(queue->getters);
+            break;
+        }
+        case WAITER_PUT: {
+            mp_obj_queue_t *queue = MP_OBJ_TO_PTR(self->prim);
+            if (!queue_is_full(queue)) {
+                queue_append(queue, self->item);
+                self->item = MP_OBJ_NULL;
+                return MP_OBJ_STOP_ITERATION;
+            }
+            wait_on(queue->putters);
+            break;
+        }
+        default:
+            return MP_OBJ_STOP_ITERATION;
+    }
+    self->yielded = true;
+    return mp_const_none;
+}
+
+// So the awaitable can be passed directly to create_task, which runs it with send.
+STATIC mp_obj_t waiter_send(mp_obj_t self_in, mp_obj_t value) {
+    (void)value;
+    MP_STATE_THREAD(stop_iteration_arg) = MP_OBJ_NULL;
+    mp_obj_t ret = waiter_iternext(self_in);
+    if (ret == MP_OBJ_STOP_ITERATION) {
+        mp_raise_StopIteration(MP_STATE_THREAD(stop_iteration_arg));
+    }
+    return ret;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(waiter_send_obj, waiter_send);
+
+// Called when the waiting task is cancelled.  If it was already scheduled to run
+// then it was woken in place of another waiting task, so pass that wakeup on.
+STATIC mp_obj_t waiter_throw(mp_obj_t self_in, mp_obj_t exc) {
+    mp_obj_waiter_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->kind == WAITER_LOCK) {
+        mp_obj_lock_t *lock = MP_OBJ_TO_PTR(self->prim);
+        if (lock->state == context_get(MP_QSTR_cur_task)) {
+            lock->state = MP_OBJ_NEW_SMALL_INT(1);
+            lock_do_release(lock);
+        }
+    } else if (self->kind == WAITER_GET) {
+        mp_obj_queue_t *queue = MP_OBJ_TO_PTR(self->prim);
+        if (queue->iget != queue->iput) {
+            wake_one(queue->getters);
+        }
+    } else if (self->kind == WAITER_PUT) {
+        mp_obj_queue_t *queue = MP_OBJ_TO_PTR(self->prim);
+        if (!queue_is_full(queue)) {
+            wake_one(queue->putters);
+        }
+    }
+    nlr_raise(mp_make_raise_obj(exc));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(waiter_throw_obj, waiter_throw);
+
+STATIC const mp_rom_map_elem_t waiter_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&waiter_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_throw), MP_ROM_PTR(&waiter_throw_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(waiter_locals_dict, waiter_locals_dict_table);
+
+STATIC const mp_obj_type_t waiter_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Waiter,
+    .getiter = mp_identity_getiter,
+    .iternext = waiter_iternext,
+    .locals_dict = (mp_obj_dict_t *)&waiter_locals_dict,
+};
+
+/******************************************************************************/
+// Event class
+
+STATIC mp_obj_t event_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    (void)args;
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    mp_obj_event_t *self = mp_obj_malloc(mp_obj_event_t, type);
+    self->state = false;
+    self->waiting = new_task_queue();
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t event_is_set(mp_obj_t self_in) {
+    mp_obj_event_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(self->state);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(event_is_set_obj, event_is_set);
+
+// Note: like the Python version, this must only be called from the thread
+// running the asyncio loop (i.e. neither hard or soft IRQ, or a different thread).
+STATIC mp_obj_t event_set(mp_obj_t self_in) {
+    mp_obj_event_t *self = MP_OBJ_TO_PTR(self_in);
+    while (task_queue_peek(self->waiting) != mp_const_none) {
+        wake_one(self->waiting);
+    }
+    self->state = true;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(event_set_obj, event_set);
+
+STATIC mp_obj_t event_clear(mp_obj_t self_in) {
+    mp_obj_event_t *self = MP_OBJ_TO_PTR(self_in);
+    self->state = false;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(event_clear_obj, event_clear);
+
+STATIC mp_obj_t event_wait(mp_obj_t self_in) {
+    return waiter_new(WAITER_EVENT, self_in, MP_OBJ_NULL);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(event_wait_obj, event_wait);
+
+STATIC const mp_rom_map_elem_t event_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_is_set), MP_ROM_PTR(&event_is_set_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set), MP_ROM_PTR(&event_set_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&event_clear_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&event_wait_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(event_locals_dict, event_locals_dict_table);
+
+STATIC const mp_obj_type_t event_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Event,
+    .make_new = event_make_new,
+    .locals_dict = (mp_obj_dict_t *)&event_locals_dict,
+};
+
+/******************************************************************************/
+// Lock class
+
+STATIC mp_obj_t lock_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    (void)args;
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    mp_obj_lock_t *self = mp_obj_malloc(mp_obj_lock_t, type);
+    self->state = MP_OBJ_NEW_SMALL_INT(0);
+    self->waiting = new_task_queue();
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t lock_locked(mp_obj_t self_in) {
+    mp_obj_lock_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(self->state == MP_OBJ_NEW_SMALL_INT(1));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(lock_locked_obj, lock_locked);
+
+STATIC void lock_do_release(mp_obj_lock_t *self) {
+    if (self->state != MP_OBJ_NEW_SMALL_INT(1)) {
+        mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Lock not acquired"));
+    }
+    mp_obj_task_queue_t *waiting = MP_OBJ_TO_PTR(self->waiting);
+    if (waiting->heap != NULL) {
+        // Task(s) waiting on lock, schedule next Task
+        self->state = MP_OBJ_FROM_PTR(waiting->heap);
+        wake_one(self->waiting);
+    } else {
+        // No Task waiting so unlock
+        self->state = MP_OBJ_NEW_SMALL_INT(0);
+    }
+}
+
+STATIC mp_obj_t lock_release(mp_obj_t self_in) {
+    lock_do_release(MP_OBJ_TO_PTR(self_in));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(lock_release_obj, lock_release);
+
+STATIC mp_obj_t lock_acquire(mp_obj_t self_in) {
+    return waiter_new(WAITER_LOCK, self_in, MP_OBJ_NULL);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(lock_acquire_obj, lock_acquire);
+
+STATIC mp_obj_t lock_aexit(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    lock_do_release(MP_OBJ_TO_PTR(args[0]));
+    return MP_OBJ_FROM_PTR(&waiter_done);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(lock_aexit_obj, 4, 4, lock_aexit);
+
+STATIC const mp_rom_map_elem_t lock_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_locked), MP_ROM_PTR(&lock_locked_obj) },
+    { MP_ROM_QSTR(MP_QSTR_release), MP_ROM_PTR(&lock_release_obj) },
+    { MP_ROM_QSTR(MP_QSTR_acquire), MP_ROM_PTR(&lock_acquire_obj) },
+    { MP_ROM_QSTR(MP_QSTR___aenter__), MP_ROM_PTR(&lock_acquire_obj) },
+    { MP_ROM_QSTR(MP_QSTR___aexit__), MP_ROM_PTR(&lock_aexit_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(lock_locals_dict, lock_locals_dict_table);
+
+STATIC const mp_obj_type_t lock_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Lock,
+    .make_new = lock_make_new,
+    .locals_dict = (mp_obj_dict_t *)&lock_locals_dict,
+};
+
+/******************************************************************************/
+// ThreadSafeFlag class, which can be set from outside the asyncio loop, such as
+// other threads, IRQs or scheduler context.  It's a stream that asyncio polls
+// until the flag is set.  Unlike Event, it's self-clearing.
+
+STATIC mp_obj_t flag_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    (void)args;
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    mp_obj_flag_t *self = mp_obj_malloc(mp_obj_flag_t, type);
+    self->flag = false;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t flag_set(mp_obj_t self_in) {
+    mp_obj_flag_t *self = MP_OBJ_TO_PTR(self_in);
+    self->flag = true;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(flag_set_obj, flag_set);
+
+STATIC mp_obj_t flag_wait(mp_obj_t self_in) {
+    return waiter_new(WAITER_FLAG, self_in, MP_OBJ_NULL);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(flag_wait_obj, flag_wait);
+
+STATIC mp_uint_t flag_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    mp_obj_flag_t *self = MP_OBJ_TO_PTR(self_in);
+    if (request == MP_STREAM_POLL) {
+        return self->flag ? arg & MP_STREAM_POLL_RD : 0;
+    }
+    *errcode = MP_EINVAL;
+    return MP_STREAM_ERROR;
+}
+
+STATIC const mp_stream_p_t flag_stream_p = {
+    .ioctl = flag_ioctl,
+};
+
+STATIC const mp_rom_map_elem_t flag_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_set), MP_ROM_PTR(&flag_set_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&flag_wait_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(flag_locals_dict, flag_locals_dict_table);
+
+STATIC const mp_obj_type_t flag_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_ThreadSafeFlag,
+    .make_new = flag_make_new,
+    .protocol = &flag_stream_p,
+    .locals_dict = (mp_obj_dict_t *)&flag_locals_dict,
+};
+
+/******************************************************************************/
+// Queue class
+
+#define QUEUE_UNBOUNDED_INITIAL_ALLOC (8)
+
+MP_DEFINE_EXCEPTION(QueueEmpty, Exception)
+MP_DEFINE_EXCEPTION(QueueFull, Exception)
+
+STATIC mp_obj_t queue_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 1, false);
+    mp_int_t maxsize = n_args == 1 ? mp_obj_get_int(args[0]) : 0;
+    mp_obj_queue_t *self = mp_obj_malloc(mp_obj_queue_t, type);
+    // As with CPython, a maxsize of zero or less means the queue is unbounded.
+    self->maxsize = maxsize > 0 ? maxsize : 0;
+    self->alloc = maxsize > 0 ? self->maxsize + 1 : QUEUE_UNBOUNDED_INITIAL_ALLOC;
+    self->iget = 0;
+    self->iput = 0;
+    self->items = m_new0(mp_obj_t, self->alloc);
+    self->getters = new_task_queue();
+    self->putters = new_task_queue();
+    self->wake_pending = false;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC size_t queue_len(mp_obj_queue_t *self) {
+    size_t iget = self->iget;
+    size_t iput = self->iput;
+    return iput >= iget ? iput - iget : self->alloc - iget + iput;
+}
+
+STATIC bool queue_is_full(mp_obj_queue_t *self) {
+    return self->maxsize != 0 && queue_len(self) >= self->maxsize;
+}
+
+STATIC mp_obj_t queue_take(mp_obj_queue_t *self) {
+    size_t iget = self->iget;
+    mp_obj_t item = self->items[iget];
+    // Clear the slot so the queue doesn't keep the item alive.
+    self->items[iget] = MP_OBJ_NULL;
+    self->iget = (iget + 1) % self->alloc;
+    wake_one(self->putters);
+    return item;
+}
+
+// Wake tasks waiting to get, one for each item in the queue.
+STATIC mp_obj_t queue_wake_getters(mp_obj_t self_in) {
+    mp_obj_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    self->wake_pending = false;
+    for (size_t n = queue_len(self); n > 0; --n) {
+        wake_one(self->getters);
+    }
+    return mp_const_none;
+}
+#if MICROPY_ENABLE_GC && MICROPY_ENABLE_SCHEDULER
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(queue_wake_getters_obj, queue_wake_getters);
+#endif
+
+STATIC void queue_append(mp_obj_queue_t *self, mp_obj_t item) {
+    size_t iput = self->iput;
+    size_t iput_next = (iput + 1) % self->alloc;
+    if (iput_next == self->iget) {
+        // An unbounded queue is full, so move the items to a larger buffer.
+        size_t len = queue_len(self);
+        mp_obj_t *items = m_new0(mp_obj_t, self->alloc * 2);
+        for (size_t i = 0; i < len; ++i) {
+            items[i] = self->items[(self->iget + i) % self->alloc];
+        }
+        m_del(mp_obj_t, self->items, self->alloc);
+        self->items = items;
+        self->alloc *= 2;
+        self->iget = 0;
+        iput = len;
+        iput_next = len + 1;
+    }
+    self->items[iput] = item;
+    self->iput = iput_next;
+
+    #if MICROPY_ENABLE_GC && MICROPY_ENABLE_SCHEDULER
+    if (gc_is_locked()) {
+        // Possibly called from a hard IRQ that interrupted the asyncio loop while
+        // it was using the task queues, so defer waking the getters to the scheduler.
+        if (!self->wake_pending) {
+            self->wake_pending = true;
+            mp_sched_schedule(MP_OBJ_FROM_PTR(&queue_wake_getters_obj), MP_OBJ_FROM_PTR(self));
+        }
+        return;
+    }
+    #endif
+
+    if (self->wake_pending) {
+        // A wakeup deferred from an IRQ couldn't be scheduled, so do it now.
+        queue_wake_getters(MP_OBJ_FROM_PTR(self));
+    } else {
+        wake_one(self->getters);
+    }
+}
+
+STATIC mp_obj_t queue_qsize(mp_obj_t self_in) {
+    return MP_OBJ_NEW_SMALL_INT(queue_len(MP_OBJ_TO_PTR(self_in)));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(queue_qsize_obj, queue_qsize);
+
+STATIC mp_obj_t queue_empty(mp_obj_t self_in) {
+    mp_obj_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(self->iget == self->iput);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(queue_empty_obj, queue_empty);
+
+STATIC mp_obj_t queue_full(mp_obj_t self_in) {
+    return mp_obj_new_bool(queue_is_full(MP_OBJ_TO_PTR(self_in)));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(queue_full_obj, queue_full);
+
+// This doesn't allocate for a bounded queue, so may be called from a hard IRQ,
+// provided there is only one such producer for the queue.
+STATIC mp_obj_t queue_put_nowait(mp_obj_t self_in, mp_obj_t item) {
+    mp_obj_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    if (queue_is_full(self)) {
+        mp_raise_type(&mp_type_QueueFull);
+    }
+    queue_append(self, item);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(queue_put_nowait_obj, queue_put_nowait);
+
+STATIC mp_obj_t queue_get_nowait(mp_obj_t self_in) {
+    mp_obj_queue_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->iget == self->iput) {
+        mp_raise_type(&mp_type_QueueEmpty);
+    }
+    return queue_take(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(queue_get_nowait_obj, queue_get_nowait);
+
+STATIC mp_obj_t queue_put(mp_obj_t self_in, mp_obj_t item) {
+    return waiter_new(WAITER_PUT, self_in, item);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(queue_put_obj, queue_put);
+
+STATIC mp_obj_t queue_get(mp_obj_t self_in) {
+    return waiter_new(WAITER_GET, self_in, MP_OBJ_NULL);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(queue_get_obj, queue_get);
+
+STATIC const mp_rom_map_elem_t queue_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_qsize), MP_ROM_PTR(&queue_qsize_obj) },
+    { MP_ROM_QSTR(MP_QSTR_empty), MP_ROM_PTR(&queue_empty_obj) },
+    { MP_ROM_QSTR(MP_QSTR_full), MP_ROM_PTR(&queue_full_obj) },
+    { MP_ROM_QSTR(MP_QSTR_put_nowait), MP_ROM_PTR(&queue_put_nowait_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_nowait), MP_ROM_PTR(&queue_get_nowait_obj) },
+    { MP_ROM_QSTR(MP_QSTR_put), MP_ROM_PTR(&queue_put_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get), MP_ROM_PTR(&queue_get_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(queue_locals_dict, queue_locals_dict_table);
+
+STATIC const mp_obj_type_t queue_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Queue,
+    .make_new = queue_make_new,
+    .locals_dict = (mp_obj_dict_t *)&queue_locals_dict,
+};
+
+#endif // MICROPY_PY_UASYNCIO_PRIMITIVES
+
 /******************************************************************************/
 // C-level uasyncio module
 
@@ -302,6 +1110,18 @@ STATIC const mp_rom_map_elem_t mp_module_uasyncio_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR__uasyncio) },
     { MP_ROM_QSTR(MP_QSTR_TaskQueue), MP_ROM_PTR(&task_queue_type) },
     { MP_ROM_QSTR(MP_QSTR_Task), MP_ROM_PTR(&task_type) },
+    #if MICROPY_PY_UASYNCIO_RUN_LOOP
+    { MP_ROM_QSTR(MP_QSTR_sleep_ms), MP_ROM_PTR(&uasyncio_sleep_ms_obj) },
+    { MP_ROM_QSTR(MP_QSTR_run_until_complete), MP_ROM_PTR(&uasyncio_run_until_complete_obj) },
+    #endif
+    #if MICROPY_PY_UASYNCIO_PRIMITIVES
+    { MP_ROM_QSTR(MP_QSTR_Event), MP_ROM_PTR(&event_type) },
+    { MP_ROM_QSTR(MP_QSTR_Lock), MP_ROM_PTR(&lock_type) },
+    { MP_ROM_QSTR(MP_QSTR_ThreadSafeFlag), MP_ROM_PTR(&flag_type) },
+    { MP_ROM_QSTR(MP_QSTR_Queue), MP_ROM_PTR(&queue_type) },
+    { MP_ROM_QSTR(MP_QSTR_QueueEmpty), MP_ROM_PTR(&mp_type_QueueEmpty) },
+    { MP_ROM_QSTR(MP_QSTR_QueueFull), MP_ROM_PTR(&mp_type_QueueFull) },
+    #endif
 };
 STATIC MP_DEFINE_CONST_DICT(mp_module_uasyncio_globals, mp_module_uasyncio_globals_table);
 
@@ -33,47 +33,108 @@
 
 #if MICROPY_PY_UBINASCII
 
+STATIC const char binascii_hexdigits[] = "0123456789abcdef";
+
+STATIC const char binascii_base64_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Value of each character in the base64 alphabet, or 0xff for characters not
+// in it (including the pad character).
+STATIC const byte binascii_base64_sextet[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 62, 0xff, 0xff, 0xff, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+#if MICROPY_PY_UBINASCII_INTO
+// Get the buffer for one of the _into functions to write len bytes into.
+STATIC byte *binascii_get_dest(mp_obj_t dest_in, size_t len) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(dest_in, &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.len < len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+    }
+    return bufinfo.buf;
+}
+#endif
+
+STATIC size_t binascii_hexlify_len(size_t len, const char *sep) {
+    if (len == 0) {
+        return 0;
+    }
+    // 1-char separator between hex numbers
+    return len * 2 + (sep != NULL ? len - 1 : 0);
+}
+
+STATIC void binascii_hexlify_into(const byte *in, size_t len, const char *sep, byte *out) {
+    if (sep == NULL) {
+        for (; len > 0; --len, ++in) {
+            *out++ = binascii_hexdigits[*in >> 4];
+            *out++ = binascii_hexdigits[*in & 0xf];
+        }
+    } else {
+        for (size_t i = 0; i < len; ++i, ++in) {
+            if (i != 0) {
+                *out++ = *sep;
+            }
+            *out++ = binascii_hexdigits[*in >> 4];
+            *out++ = binascii_hexdigits[*in & 0xf];
+        }
+    }
+}
+
 STATIC mp_obj_t mod_binascii_hexlify(size_t n_args, const mp_obj_t *args) {
     // First argument is the data to convert.
     // Second argument is an optional separator to be used between values.
-    const char *sep = NULL;
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_READ);
 
-    // Code below assumes non-zero buffer length when computing size with
-    // separator, so handle the zero-length case here.
     if (bufinfo.len == 0) {
         return mp_const_empty_bytes;
     }
 
+    const char *sep = n_args > 1 ? mp_obj_str_get_str(args[1]) : NULL;
     vstr_t vstr;
-    size_t out_len = bufinfo.len * 2;
-    if (n_args > 1) {
-        // 1-char separator between hex numbers
-        out_len += bufinfo.len - 1;
-        sep = mp_obj_str_get_str(args[1]);
-    }
-    vstr_init_len(&vstr, out_len);
-    byte *in = bufinfo.buf, *out = (byte *)vstr.buf;
-    for (mp_uint_t i = bufinfo.len; i--;) {
-        byte d = (*in >> 4);
-        if (d > 9) {
-            d += 'a' - '9' - 1;
-        }
-        *out++ = d + '0';
-        d = (*in++ & 0xf);
-        if (d > 9) {
-            d += 'a' - '9' - 1;
-        }
-        *out++ = d + '0';
-        if (sep != NULL && i != 0) {
-            *out++ = *sep;
-        }
-    }
+    vstr_init_len(&vstr, binascii_hexlify_len(bufinfo.len, sep));
+    binascii_hexlify_into(bufinfo.buf, bufinfo.len, sep, (byte *)vstr.buf);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_binascii_hexlify_obj, 1, 2, mod_binascii_hexlify);
 
+#if MICROPY_PY_UBINASCII_INTO
+STATIC mp_obj_t mod_binascii_hexlify_into(size_t n_args, const mp_obj_t *args) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_READ);
+    const char *sep = n_args > 2 ? mp_obj_str_get_str(args[2]) : NULL;
+    size_t out_len = binascii_hexlify_len(bufinfo.len, sep);
+    binascii_hexlify_into(bufinfo.buf, bufinfo.len, sep, binascii_get_dest(args[1], out_len));
+    return mp_obj_new_int_from_uint(out_len);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_binascii_hexlify_into_obj, 2, 3, mod_binascii_hexlify_into);
+#endif
+
+// Decode len hex digits (an even number) into out, which may be the same as in.
+STATIC void binascii_unhexlify_into(const byte *in, size_t len, byte *out) {
+    for (; len > 0; len -= 2, in += 2) {
+        if (!unichar_isxdigit(in[0]) || !unichar_isxdigit(in[1])) {
+            mp_raise_ValueError(MP_ERROR_TEXT("non-hex digit found"));
+        }
+        *out++ = unichar_xdigit_value(in[0]) << 4 | unichar_xdigit_value(in[1]);
+    }
+}
+
 STATIC mp_obj_t mod_binascii_unhexlify(mp_obj_t data) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
@@ -83,59 +144,61 @@ STATIC mp_obj_t mod_binascii_unhexlify(mp_obj_t data) {
     }
     vstr_t vstr;
     vstr_init_len(&vstr, bufinfo.len / 2);
-    byte *in = bufinfo.buf, *out = (byte *)vstr.buf;
-    byte hex_byte = 0;
-    for (mp_uint_t i = bufinfo.len; i--;) {
-        byte hex_ch = *in++;
-        if (unichar_isxdigit(hex_ch)) {
-            hex_byte += unichar_xdigit_value(hex_ch);
-        } else {
-            mp_raise_ValueError(MP_ERROR_TEXT("non-hex digit found"));
-        }
-        if (i & 1) {
-            hex_byte <<= 4;
-        } else {
-            *out++ = hex_byte;
-            hex_byte = 0;
-        }
-    }
+    binascii_unhexlify_into(bufinfo.buf, bufinfo.len, (byte *)vstr.buf);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_unhexlify_obj, mod_binascii_unhexlify);
 
-// If ch is a character in the base64 alphabet, and is not a pad character, then
-// the corresponding integer between 0 and 63, inclusively, is returned.
-// Otherwise, -1 is returned.
-static int mod_binascii_sextet(byte ch) {
-    if (ch >= 'A' && ch <= 'Z') {
-        return ch - 'A';
-    } else if (ch >= 'a' && ch <= 'z') {
-        return ch - 'a' + 26;
-    } else if (ch >= '0' && ch <= '9') {
-        return ch - '0' + 52;
-    } else if (ch == '+') {
-        return 62;
-    } else if (ch == '/') {
-        return 63;
-    } else {
-        return -1;
-    }
-}
-
-STATIC mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
+#if MICROPY_PY_UBINASCII_INTO
+STATIC mp_obj_t mod_binascii_unhexlify_into(mp_obj_t data, mp_obj_t dest) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
-    byte *in = bufinfo.buf;
 
-    vstr_t vstr;
-    vstr_init(&vstr, (bufinfo.len / 4) * 3 + 1); // Potentially over-allocate
-    byte *out = (byte *)vstr.buf;
+    if ((bufinfo.len & 1) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("odd-length string"));
+    }
+    binascii_unhexlify_into(bufinfo.buf, bufinfo.len, binascii_get_dest(dest, bufinfo.len / 2));
+    return mp_obj_new_int_from_uint(bufinfo.len / 2);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_binascii_unhexlify_into_obj, mod_binascii_unhexlify_into);
+#endif
 
+// Decode base64 into out, which has room for out_max bytes and may be the same
+// as in.  Characters not in the base64 alphabet are skipped.  Returns the
+// number of bytes written.
+STATIC size_t binascii_a2b_base64_into(const byte *in, size_t len, byte *out, size_t out_max) {
+    byte *out_start = out;
+    byte *out_end = out + out_max;
     uint shift = 0;
     int nbits = 0; // Number of meaningful bits in shift
     bool hadpad = false; // Had a pad character since last valid character
-    for (size_t i = 0; i < bufinfo.len; i++) {
-        if (in[i] == '=') {
+    size_t i = 0;
+    while (i < len) {
+        if (nbits == 0) {
+            // Fast path for whole groups of 4 characters, all in the alphabet
+            while (i + 4 <= len && out_end - out >= 3) {
+                uint32_t a = binascii_base64_sextet[in[i]];
+                uint32_t b = binascii_base64_sextet[in[i + 1]];
+                uint32_t c = binascii_base64_sextet[in[i + 2]];
+                uint32_t d = binascii_base64_sextet[in[i + 3]];
+                if ((a | b | c | d) & 0x80) {
+                    break;
+                }
+                uint32_t v = a << 18 | b << 12 | c << 6 | d;
+                out[0] = v >> 16;
+                out[1] = v >> 8;
+                out[2] = v;
+                out += 3;
+                i += 4;
+                hadpad = false;
+            }
+            if (i == len) {
+                break;
+            }
+        }
+
+        byte ch = in[i++];
+        if (ch == '=') {
             if ((nbits == 2) || ((nbits == 4) && hadpad)) {
                 nbits = 0;
                 break;
@@ -143,8 +206,8 @@ STATIC mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
             hadpad = true;
         }
 
-        int sextet = mod_binascii_sextet(in[i]);
-        if (sextet == -1) {
+        uint sextet = binascii_base64_sextet[ch];
+        if (sextet == 0xff) {
             continue;
         }
         hadpad = false;
@@ -153,7 +216,10 @@ STATIC mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
 
         if (nbits >= 8) {
             nbits -= 8;
-            out[vstr.len++] = (shift >> nbits) & 0xFF;
+            if (out == out_end) {
+                mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+            }
+            *out++ = (shift >> nbits) & 0xFF;
         }
     }
 
@@ -161,10 +227,60 @@ STATIC mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
         mp_raise_ValueError(MP_ERROR_TEXT("incorrect padding"));
     }
 
+    return out - out_start;
+}
+
+STATIC mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+
+    // Room for the most that can be decoded from 4n + 3 characters
+    vstr_t vstr;
+    vstr_init(&vstr, (bufinfo.len / 4) * 3 + 2);
+    vstr.len = binascii_a2b_base64_into(bufinfo.buf, bufinfo.len, (byte *)vstr.buf, vstr.alloc);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_a2b_base64_obj, mod_binascii_a2b_base64);
 
+#if MICROPY_PY_UBINASCII_INTO
+STATIC mp_obj_t mod_binascii_a2b_base64_into(mp_obj_t data, mp_obj_t dest) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t destinfo;
+    mp_get_buffer_raise(dest, &destinfo, MP_BUFFER_WRITE);
+    size_t len = binascii_a2b_base64_into(bufinfo.buf, bufinfo.len, destinfo.buf, destinfo.len);
+    return mp_obj_new_int_from_uint(len);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_binascii_a2b_base64_into_obj, mod_binascii_a2b_base64_into);
+#endif
+
+STATIC size_t binascii_b2a_base64_len(size_t len, bool newline) {
+    return (len + 2) / 3 * 4 + newline;
+}
+
+// Encode len bytes as base64 into out, which must not overlap in.
+STATIC void binascii_b2a_base64_into(const byte *in, size_t len, bool newline, byte *out) {
+    const char *alphabet = binascii_base64_alphabet;
+    for (; len >= 3; len -= 3, in += 3, out += 4) {
+        uint32_t v = (uint32_t)in[0] << 16 | in[1] << 8 | in[2];
+        out[0] = alphabet[v >> 18];
+        out[1] = alphabet[(v >> 12) & 0x3f];
+        out[2] = alphabet[(v >> 6) & 0x3f];
+        out[3] = alphabet[v & 0x3f];
+    }
+    if (len != 0) {
+        uint32_t v = (uint32_t)in[0] << 16 | (len == 2 ? in[1] << 8 : 0);
+        out[0] = alphabet[v >> 18];
+        out[1] = alphabet[(v >> 12) & 0x3f];
+        out[2] = len == 2 ? alphabet[(v >> 6) & 0x3f] : '=';
+        out[3] = '=';
+        out += 4;
+    }
+    if (newline) {
+        *out = '\n';
+    }
+}
+
 STATIC mp_obj_t mod_binascii_b2a_base64(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_newline };
     static const mp_arg_t allowed_args[] = {
@@ -173,60 +289,37 @@ STATIC mp_obj_t mod_binascii_b2a_base64(size_t n_args, const mp_obj_t *pos_args,
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
-    uint8_t newline = args[ARG_newline].u_bool;
+    bool newline = args[ARG_newline].u_bool;
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(pos_args[0], &bufinfo, MP_BUFFER_READ);
 
     vstr_t vstr;
-    vstr_init_len(&vstr, ((bufinfo.len != 0) ? (((bufinfo.len - 1) / 3) + 1) * 4 : 0) + newline);
-
-    // First pass, we convert input buffer to numeric base 64 values
-    byte *in = bufinfo.buf, *out = (byte *)vstr.buf;
-    mp_uint_t i;
-    for (i = bufinfo.len; i >= 3; i -= 3) {
-        *out++ = (in[0] & 0xFC) >> 2;
-        *out++ = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-        *out++ = (in[1] & 0x0F) << 2 | (in[2] & 0xC0) >> 6;
-        *out++ = in[2] & 0x3F;
-        in += 3;
-    }
-    if (i != 0) {
-        *out++ = (in[0] & 0xFC) >> 2;
-        if (i == 2) {
-            *out++ = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-            *out++ = (in[1] & 0x0F) << 2;
-        } else {
-            *out++ = (in[0] & 0x03) << 4;
-            *out++ = 64;
-        }
-        *out = 64;
-    }
-
-    // Second pass, we convert number base 64 values to actual base64 ascii encoding
-    out = (byte *)vstr.buf;
-    for (mp_uint_t j = vstr.len - newline; j--;) {
-        if (*out < 26) {
-            *out += 'A';
-        } else if (*out < 52) {
-            *out += 'a' - 26;
-        } else if (*out < 62) {
-            *out += '0' - 52;
-        } else if (*out == 62) {
-            *out = '+';
-        } else if (*out == 63) {
-            *out = '/';
-        } else {
-            *out = '=';
-        }
-        out++;
-    }
-    if (newline) {
-        *out = '\n';
-    }
+    vstr_init_len(&vstr, binascii_b2a_base64_len(bufinfo.len, newline));
+    binascii_b2a_base64_into(bufinfo.buf, bufinfo.len, newline, (byte *)vstr.buf);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_binascii_b2a_base64_obj, 1, mod_binascii_b2a_base64);
 
+#if MICROPY_PY_UBINASCII_INTO
+STATIC mp_obj_t mod_binascii_b2a_base64_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_newline };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_newline, MP_ARG_BOOL, {.u_bool = true} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 2, pos_args + 2, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    bool newline = args[ARG_newline].u_bool;
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(pos_args[0], &bufinfo, MP_BUFFER_READ);
+
+    size_t out_len = binascii_b2a_base64_len(bufinfo.len, newline);
+    binascii_b2a_base64_into(bufinfo.buf, bufinfo.len, newline, binascii_get_dest(pos_args[1], out_len));
+    return mp_obj_new_int_from_uint(out_len);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_binascii_b2a_base64_into_obj, 2, mod_binascii_b2a_base64_into);
+#endif
+
 #if MICROPY_PY_UBINASCII_CRC32
 #include "lib/uzlib/tinf.h"
 
@@ -246,6 +339,12 @@ STATIC const mp_rom_map_elem_t mp_module_binascii_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_unhexlify), MP_ROM_PTR(&mod_binascii_unhexlify_obj) },
     { MP_ROM_QSTR(MP_QSTR_a2b_base64), MP_ROM_PTR(&mod_binascii_a2b_base64_obj) },
     { MP_ROM_QSTR(MP_QSTR_b2a_base64), MP_ROM_PTR(&mod_binascii_b2a_base64_obj) },
+    #if MICROPY_PY_UBINASCII_INTO
+    { MP_ROM_QSTR(MP_QSTR_hexlify_into), MP_ROM_PTR(&mod_binascii_hexlify_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unhexlify_into), MP_ROM_PTR(&mod_binascii_unhexlify_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_a2b_base64_into), MP_ROM_PTR(&mod_binascii_a2b_base64_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_b2a_base64_into), MP_ROM_PTR(&mod_binascii_b2a_base64_into_obj) },
+    #endif
     #if MICROPY_PY_UBINASCII_CRC32
     { MP_ROM_QSTR(MP_QSTR_crc32), MP_ROM_PTR(&mod_binascii_crc32_obj) },
     #endif
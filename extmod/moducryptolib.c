@@ -33,6 +33,7 @@
 #include <string.h>
 
 #include "py/runtime.h"
+#include "extmod/crypto_hw.h"
 
 // This module implements crypto ciphers API, roughly following
 // https://www.python.org/dev/peps/pep-0272/ . Exact implementation
@@ -44,6 +45,8 @@ enum {
     UCRYPTOLIB_MODE_ECB = 1,
     UCRYPTOLIB_MODE_CBC = 2,
     UCRYPTOLIB_MODE_CTR = 6,
+    // PEP 272 has no value for GCM, this is the one used by PyCryptodome
+    UCRYPTOLIB_MODE_GCM = 11,
 };
 
 struct ctr_params {
@@ -54,6 +57,23 @@ struct ctr_params {
     uint8_t encrypted_counter[16];
 };
 
+struct gcm_params {
+    // the counter is the IV of the AES context, as for CTR, but only its
+    // last 32 bits are incremented
+    struct ctr_params ctr;
+    uint8_t h[16]; // hash subkey, E(K, 0)
+    uint8_t tag_mask[16]; // E(K, J0), xor'd into the final GHASH
+    uint8_t ghash[16]; // running GHASH value
+    uint8_t partial_len; // number of bytes of ghash absorbed in the current block
+#define GCM_STATE_AAD 0
+#define GCM_STATE_DATA 1
+#define GCM_STATE_FINAL 2
+    uint8_t state;
+    // byte counts, which limits a message to 4GiB
+    uint32_t aad_len;
+    uint32_t data_len;
+};
+
 #if MICROPY_SSL_AXTLS
 #include "lib/axtls/crypto/crypto.h"
 
@@ -87,6 +107,12 @@ typedef struct _mp_obj_aes_t {
 #define AES_KEYTYPE_ENC  1
 #define AES_KEYTYPE_DEC  2
     uint8_t key_type : 2;
+    #if MICROPY_HW_CRYPTO_AES
+    // the engine takes the raw key, while the software context only keeps
+    // the expanded one
+    uint8_t key_len;
+    uint8_t key[32];
+    #endif
 } mp_obj_aes_t;
 
 static inline bool is_ctr_mode(int block_mode) {
@@ -97,11 +123,24 @@ static inline bool is_ctr_mode(int block_mode) {
     #endif
 }
 
+static inline bool is_gcm_mode(int block_mode) {
+    #if MICROPY_PY_UCRYPTOLIB_GCM
+    return block_mode == UCRYPTOLIB_MODE_GCM;
+    #else
+    return false;
+    #endif
+}
+
 static inline struct ctr_params *ctr_params_from_aes(mp_obj_aes_t *o) {
     // ctr_params follows aes object struct
     return (struct ctr_params *)&o[1];
 }
 
+static inline struct gcm_params *gcm_params_from_aes(mp_obj_aes_t *o) {
+    // gcm_params follows aes object struct
+    return (struct gcm_params *)&o[1];
+}
+
 #if MICROPY_SSL_AXTLS
 STATIC void aes_initial_set_key_impl(AES_CTX_IMPL *ctx, const uint8_t *key, size_t keysize, const uint8_t iv[16]) {
     assert(16 == keysize || 32 == keysize);
@@ -211,6 +250,110 @@ STATIC void aes_process_ctr_impl(AES_CTX_IMPL *ctx, const uint8_t *in, uint8_t *
 
 #endif
 
+#if MICROPY_PY_UCRYPTOLIB_GCM
+// GCM is built from the ECB primitive of the backend, so it works the same
+// with axTLS and mbedtls.  The message is processed a byte at a time so that
+// encrypt() and decrypt() can be called with chunks of any length.
+
+// x = x * y in GF(2^128), bit-serial as in NIST SP 800-38D algorithm 1
+STATIC void gcm_gf_mult(uint8_t x[16], const uint8_t y[16]) {
+    uint8_t z[16] = {0};
+    uint8_t v[16];
+    memcpy(v, y, 16);
+    for (int i = 0; i < 128; ++i) {
+        if (x[i >> 3] & (0x80 >> (i & 7))) {
+            for (int j = 0; j < 16; ++j) {
+                z[j] ^= v[j];
+            }
+        }
+        uint8_t lsb = v[15] & 1;
+        for (int j = 15; j > 0; --j) {
+            v[j] = (v[j] >> 1) | (v[j - 1] << 7);
+        }
+        v[0] >>= 1;
+        if (lsb) {
+            v[0] ^= 0xe1;
+        }
+    }
+    memcpy(x, z, 16);
+}
+
+STATIC void gcm_ghash_flush(struct gcm_params *gcm) {
+    // pad the current block with zeros (already in ghash) and multiply
+    if (gcm->partial_len != 0) {
+        gcm_gf_mult(gcm->ghash, gcm->h);
+        gcm->partial_len = 0;
+    }
+}
+
+STATIC void gcm_ghash_update(struct gcm_params *gcm, const uint8_t *buf, size_t len) {
+    while (len--) {
+        gcm->ghash[gcm->partial_len++] ^= *buf++;
+        if (gcm->partial_len == 16) {
+            gcm_gf_mult(gcm->ghash, gcm->h);
+            gcm->partial_len = 0;
+        }
+    }
+}
+
+STATIC void gcm_init(AES_CTX_IMPL *ctx, struct gcm_params *gcm) {
+    // the key is already set for encryption and ctx->iv holds J0
+    memset(gcm, 0, sizeof(*gcm));
+    aes_process_ecb_impl(ctx, gcm->ghash, gcm->h, true);
+    aes_process_ecb_impl(ctx, ctx->iv, gcm->tag_mask, true);
+    // counter for the first block of data is inc32(J0)
+    ctx->iv[15] = 2;
+}
+
+STATIC void aes_process_gcm_impl(AES_CTX_IMPL *ctx, const uint8_t *in, uint8_t *out, size_t in_len, struct gcm_params *gcm, bool encrypt) {
+    if (gcm->state == GCM_STATE_AAD) {
+        gcm_ghash_flush(gcm);
+        gcm->state = GCM_STATE_DATA;
+    }
+    gcm->data_len += in_len;
+
+    size_t n = gcm->ctr.offset;
+    uint8_t *const counter = ctx->iv;
+
+    while (in_len--) {
+        if (n == 0) {
+            aes_process_ecb_impl(ctx, counter, gcm->ctr.encrypted_counter, true);
+
+            // increment the low 32 bits of the counter
+            for (int i = 15; i >= 12; --i) {
+                if (++counter[i] != 0) {
+                    break;
+                }
+            }
+        }
+
+        // read the input before writing the output, they may be the same
+        uint8_t in_byte = *in++;
+        uint8_t out_byte = in_byte ^ gcm->ctr.encrypted_counter[n];
+        *out++ = out_byte;
+        uint8_t c = encrypt ? out_byte : in_byte;
+        gcm_ghash_update(gcm, &c, 1);
+        n = (n + 1) & 0xf;
+    }
+
+    gcm->ctr.offset = n;
+}
+
+STATIC void gcm_finish(struct gcm_params *gcm, uint8_t tag[16]) {
+    gcm_ghash_flush(gcm);
+    uint8_t len_block[16];
+    uint64_t bits[2] = { (uint64_t)gcm->aad_len * 8, (uint64_t)gcm->data_len * 8 };
+    for (int i = 0; i < 16; ++i) {
+        len_block[i] = (uint8_t)(bits[i >> 3] >> (56 - 8 * (i & 7)));
+    }
+    gcm_ghash_update(gcm, len_block, 16);
+    for (int i = 0; i < 16; ++i) {
+        tag[i] = gcm->ghash[i] ^ gcm->tag_mask[i];
+    }
+    gcm->state = GCM_STATE_FINAL;
+}
+#endif
+
 STATIC mp_obj_t ucryptolib_aes_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     mp_arg_check_num(n_args, n_kw, 2, 3, false);
 
@@ -221,6 +364,9 @@ STATIC mp_obj_t ucryptolib_aes_make_new(const mp_obj_type_t *type, size_t n_args
         case UCRYPTOLIB_MODE_CBC:
         #if MICROPY_PY_UCRYPTOLIB_CTR
         case UCRYPTOLIB_MODE_CTR:
+        #endif
+        #if MICROPY_PY_UCRYPTOLIB_GCM
+        case UCRYPTOLIB_MODE_GCM:
         #endif
             break;
 
@@ -228,7 +374,13 @@ STATIC mp_obj_t ucryptolib_aes_make_new(const mp_obj_type_t *type, size_t n_args
             mp_raise_ValueError(MP_ERROR_TEXT("mode"));
     }
 
-    mp_obj_aes_t *o = mp_obj_malloc_var(mp_obj_aes_t, struct ctr_params, !!is_ctr_mode(block_mode), type);
+    size_t params_size = 0;
+    if (is_ctr_mode(block_mode)) {
+        params_size = sizeof(struct ctr_params);
+    } else if (is_gcm_mode(block_mode)) {
+        params_size = sizeof(struct gcm_params);
+    }
+    mp_obj_aes_t *o = mp_obj_malloc_var(mp_obj_aes_t, uint8_t, params_size, type);
 
     o->block_mode = block_mode;
     o->key_type = AES_KEYTYPE_NONE;
@@ -241,12 +393,30 @@ STATIC mp_obj_t ucryptolib_aes_make_new(const mp_obj_type_t *type, size_t n_args
 
     mp_buffer_info_t ivinfo;
     ivinfo.buf = NULL;
+    #if MICROPY_PY_UCRYPTOLIB_GCM
+    uint8_t j0[16];
+    #endif
     if (n_args > 2 && args[2] != mp_const_none) {
         mp_get_buffer_raise(args[2], &ivinfo, MP_BUFFER_READ);
 
+        #if MICROPY_PY_UCRYPTOLIB_GCM
+        if (is_gcm_mode(block_mode)) {
+            // only the recommended 96-bit nonce is supported, J0 = IV || 1
+            if (12 != ivinfo.len) {
+                mp_raise_ValueError(MP_ERROR_TEXT("IV"));
+            }
+            memcpy(j0, ivinfo.buf, 12);
+            j0[12] = j0[13] = j0[14] = 0;
+            j0[15] = 1;
+            ivinfo.buf = j0;
+            ivinfo.len = 16;
+        }
+        #endif
         if (16 != ivinfo.len) {
             mp_raise_ValueError(MP_ERROR_TEXT("IV"));
         }
+    } else if (is_gcm_mode(o->block_mode)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("IV"));
     } else if (o->block_mode == UCRYPTOLIB_MODE_CBC || is_ctr_mode(o->block_mode)) {
         mp_raise_ValueError(MP_ERROR_TEXT("IV"));
     }
@@ -256,6 +426,19 @@ STATIC mp_obj_t ucryptolib_aes_make_new(const mp_obj_type_t *type, size_t n_args
     }
 
     aes_initial_set_key_impl(&o->ctx, keyinfo.buf, keyinfo.len, ivinfo.buf);
+    #if MICROPY_HW_CRYPTO_AES
+    o->key_len = keyinfo.len;
+    memcpy(o->key, keyinfo.buf, keyinfo.len);
+    #endif
+
+    #if MICROPY_PY_UCRYPTOLIB_GCM
+    if (is_gcm_mode(block_mode)) {
+        // the hash subkey is needed before any data, and GCM only ever
+        // uses the forward cipher, so the key is finalised straight away
+        aes_final_set_key_impl(&o->ctx, true);
+        gcm_init(&o->ctx, gcm_params_from_aes(o));
+    }
+    #endif
 
     return MP_OBJ_FROM_PTR(o);
 }
@@ -272,7 +455,13 @@ STATIC mp_obj_t aes_process(size_t n_args, const mp_obj_t *args, bool encrypt) {
     mp_buffer_info_t in_bufinfo;
     mp_get_buffer_raise(in_buf, &in_bufinfo, MP_BUFFER_READ);
 
-    if (!is_ctr_mode(self->block_mode) && in_bufinfo.len % 16 != 0) {
+    #if MICROPY_PY_UCRYPTOLIB_GCM
+    if (is_gcm_mode(self->block_mode) && gcm_params_from_aes(self)->state == GCM_STATE_FINAL) {
+        mp_raise_ValueError(MP_ERROR_TEXT("finalized"));
+    }
+    #endif
+
+    if (!is_ctr_mode(self->block_mode) && !is_gcm_mode(self->block_mode) && in_bufinfo.len % 16 != 0) {
         mp_raise_ValueError(MP_ERROR_TEXT("blksize % 16"));
     }
 
@@ -292,9 +481,11 @@ STATIC mp_obj_t aes_process(size_t n_args, const mp_obj_t *args, bool encrypt) {
     }
 
     if (AES_KEYTYPE_NONE == self->key_type) {
-        // always set key for encryption if CTR mode.
+        // always set key for encryption if CTR mode, GCM already did it.
         const bool encrypt_mode = encrypt || is_ctr_mode(self->block_mode);
-        aes_final_set_key_impl(&self->ctx, encrypt_mode);
+        if (!is_gcm_mode(self->block_mode)) {
+            aes_final_set_key_impl(&self->ctx, encrypt_mode);
+        }
         self->key_type = encrypt ? AES_KEYTYPE_ENC : AES_KEYTYPE_DEC;
     } else {
         if ((encrypt && self->key_type == AES_KEYTYPE_DEC) ||
@@ -304,6 +495,17 @@ STATIC mp_obj_t aes_process(size_t n_args, const mp_obj_t *args, bool encrypt) {
         }
     }
 
+    #if MICROPY_HW_CRYPTO_AES
+    // The software contexts of both backends keep the CBC chaining value in
+    // ctx.iv, so the engine and software can take turns on the same object
+    if ((self->block_mode == UCRYPTOLIB_MODE_ECB || self->block_mode == UCRYPTOLIB_MODE_CBC)
+        && mp_hw_aes_crypt(self->key, self->key_len, self->block_mode, encrypt,
+            self->block_mode == UCRYPTOLIB_MODE_CBC ? self->ctx.iv : NULL,
+            in_bufinfo.buf, out_buf_ptr, in_bufinfo.len)) {
+        goto done;
+    }
+    #endif
+
     switch (self->block_mode) {
         case UCRYPTOLIB_MODE_ECB: {
             uint8_t *in = in_bufinfo.buf, *out = out_buf_ptr;
@@ -324,8 +526,18 @@ STATIC mp_obj_t aes_process(size_t n_args, const mp_obj_t *args, bool encrypt) {
                 ctr_params_from_aes(self));
             break;
         #endif
+
+        #if MICROPY_PY_UCRYPTOLIB_GCM
+        case UCRYPTOLIB_MODE_GCM:
+            aes_process_gcm_impl(&self->ctx, in_bufinfo.buf, out_buf_ptr, in_bufinfo.len,
+                gcm_params_from_aes(self), encrypt);
+            break;
+        #endif
     }
 
+    #if MICROPY_HW_CRYPTO_AES
+done:
+    #endif
     if (out_buf != MP_OBJ_NULL) {
         return out_buf;
     }
@@ -342,9 +554,67 @@ STATIC mp_obj_t ucryptolib_aes_decrypt(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ucryptolib_aes_decrypt_obj, 2, 3, ucryptolib_aes_decrypt);
 
+#if MICROPY_PY_UCRYPTOLIB_GCM
+STATIC struct gcm_params *gcm_params_check(mp_obj_t self_in) {
+    mp_obj_aes_t *self = MP_OBJ_TO_PTR(self_in);
+    if (!is_gcm_mode(self->block_mode)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("mode"));
+    }
+    struct gcm_params *gcm = gcm_params_from_aes(self);
+    if (gcm->state == GCM_STATE_FINAL) {
+        mp_raise_ValueError(MP_ERROR_TEXT("finalized"));
+    }
+    return gcm;
+}
+
+// Authenticate additional data, which must all come before the message.
+STATIC mp_obj_t ucryptolib_aes_update(mp_obj_t self_in, mp_obj_t aad_in) {
+    struct gcm_params *gcm = gcm_params_check(self_in);
+    if (gcm->state != GCM_STATE_AAD) {
+        mp_raise_ValueError(MP_ERROR_TEXT("update after data"));
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(aad_in, &bufinfo, MP_BUFFER_READ);
+    gcm_ghash_update(gcm, bufinfo.buf, bufinfo.len);
+    gcm->aad_len += bufinfo.len;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(ucryptolib_aes_update_obj, ucryptolib_aes_update);
+
+// Return the tag, or check it against the given one when decrypting.
+STATIC mp_obj_t ucryptolib_aes_finalize(size_t n_args, const mp_obj_t *args) {
+    struct gcm_params *gcm = gcm_params_check(args[0]);
+    uint8_t tag[16];
+    gcm_finish(gcm, tag);
+    if (n_args == 1) {
+        return mp_obj_new_bytes(tag, sizeof(tag));
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_READ);
+    // truncated tags are allowed, down to 32 bits as in SP 800-38D
+    if (bufinfo.len < 4 || bufinfo.len > 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("tag"));
+    }
+    // constant-time compare
+    uint8_t diff = 0;
+    for (size_t i = 0; i < bufinfo.len; ++i) {
+        diff |= tag[i] ^ ((const uint8_t *)bufinfo.buf)[i];
+    }
+    if (diff != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("tag mismatch"));
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(ucryptolib_aes_finalize_obj, 1, 2, ucryptolib_aes_finalize);
+#endif
+
 STATIC const mp_rom_map_elem_t ucryptolib_aes_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_encrypt), MP_ROM_PTR(&ucryptolib_aes_encrypt_obj) },
     { MP_ROM_QSTR(MP_QSTR_decrypt), MP_ROM_PTR(&ucryptolib_aes_decrypt_obj) },
+    #if MICROPY_PY_UCRYPTOLIB_GCM
+    { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&ucryptolib_aes_update_obj) },
+    { MP_ROM_QSTR(MP_QSTR_finalize), MP_ROM_PTR(&ucryptolib_aes_finalize_obj) },
+    #endif
 };
 STATIC MP_DEFINE_CONST_DICT(ucryptolib_aes_locals_dict, ucryptolib_aes_locals_dict_table);
 
@@ -364,6 +634,9 @@ STATIC const mp_rom_map_elem_t mp_module_ucryptolib_globals_table[] = {
     #if MICROPY_PY_UCRYPTOLIB_CTR
     { MP_ROM_QSTR(MP_QSTR_MODE_CTR), MP_ROM_INT(UCRYPTOLIB_MODE_CTR) },
     #endif
+    #if MICROPY_PY_UCRYPTOLIB_GCM
+    { MP_ROM_QSTR(MP_QSTR_MODE_GCM), MP_ROM_INT(UCRYPTOLIB_MODE_GCM) },
+    #endif
     #endif
 };
 
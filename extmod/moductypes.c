@@ -89,6 +89,45 @@ typedef struct _mp_obj_uctypes_struct_t {
     uint32_t flags;
 } mp_obj_uctypes_struct_t;
 
+#if MICROPY_PY_UCTYPES_COMPILE
+// A layout is a descriptor compiled for one layout type.  For a STRUCT it has
+// a map from field name to an entry in fields, holding the field's offset and
+// accessor functions.  For an ARRAY or PTR it has the element type, with elem
+// being the compiled layout for aggregate elements.  Aggregate fields (and
+// elements) refer to compiled sub-layouts, shared when descriptors are shared.
+STATIC const mp_obj_type_t uctypes_layout_type;
+
+typedef struct _uctypes_field_t uctypes_field_t;
+typedef mp_obj_t (*uctypes_field_get_t)(const uctypes_field_t *f, byte *addr, uint32_t flags);
+typedef void (*uctypes_field_set_t)(const uctypes_field_t *f, byte *addr, uint32_t flags, mp_obj_t val);
+
+struct _uctypes_field_t {
+    uctypes_field_get_t get;
+    uctypes_field_set_t set; // NULL for aggregates
+    mp_obj_t sub; // compiled layout of an aggregate
+    mp_uint_t offset;
+    uint8_t val_type;
+    uint8_t bit_offset;
+    uint8_t bit_len;
+};
+
+typedef struct _mp_obj_uctypes_layout_t {
+    mp_obj_base_t base;
+    mp_obj_t desc;
+    mp_uint_t size;
+    uint8_t agg_type;
+    uint8_t layout_type;
+    // for ARRAY and PTR
+    uint8_t val_type;
+    mp_uint_t arr_len;
+    mp_uint_t elem_size;
+    mp_obj_t elem;
+    // for STRUCT
+    mp_map_t fields_map;
+    uctypes_field_t fields[];
+} mp_obj_uctypes_layout_t;
+#endif
+
 STATIC NORETURN void syntax_error(void) {
     mp_raise_TypeError(MP_ERROR_TEXT("syntax error in uctypes descriptor"));
 }
@@ -102,6 +141,16 @@ STATIC mp_obj_t uctypes_struct_make_new(const mp_obj_type_t *type, size_t n_args
     if (n_args == 3) {
         o->flags = mp_obj_get_int(args[2]);
     }
+    #if MICROPY_PY_UCTYPES_COMPILE
+    if (mp_obj_is_type(o->desc, &uctypes_layout_type)) {
+        // the accessors of a layout are specific to its layout type
+        uint32_t layout_type = ((mp_obj_uctypes_layout_t *)MP_OBJ_TO_PTR(o->desc))->layout_type;
+        if (n_args == 3 && o->flags != layout_type) {
+            mp_raise_ValueError(MP_ERROR_TEXT("layout type mismatch"));
+        }
+        o->flags = layout_type;
+    }
+    #endif
     return MP_OBJ_FROM_PTR(o);
 }
 
@@ -109,6 +158,12 @@ STATIC void uctypes_struct_print(const mp_print_t *print, mp_obj_t self_in, mp_p
     (void)kind;
     mp_obj_uctypes_struct_t *self = MP_OBJ_TO_PTR(self_in);
     const char *typen = "unk";
+    #if MICROPY_PY_UCTYPES_COMPILE
+    if (mp_obj_is_type(self->desc, &uctypes_layout_type)) {
+        static const char *const agg_names[] = { "STRUCT", "PTR", "ARRAY" };
+        typen = agg_names[((mp_obj_uctypes_layout_t *)MP_OBJ_TO_PTR(self->desc))->agg_type];
+    } else
+    #endif
     if (mp_obj_is_dict_or_ordereddict(self->desc)) {
         typen = "STRUCT";
     } else if (mp_obj_is_type(self->desc, &mp_type_tuple)) {
@@ -182,6 +237,11 @@ STATIC mp_uint_t uctypes_struct_agg_size(mp_obj_tuple_t *t, int layout_type, mp_
 }
 
 STATIC mp_uint_t uctypes_struct_size(mp_obj_t desc_in, int layout_type, mp_uint_t *max_field_size) {
+    #if MICROPY_PY_UCTYPES_COMPILE
+    if (mp_obj_is_type(desc_in, &uctypes_layout_type)) {
+        return ((mp_obj_uctypes_layout_t *)MP_OBJ_TO_PTR(desc_in))->size;
+    }
+    #endif
     if (!mp_obj_is_dict_or_ordereddict(desc_in)) {
         if (mp_obj_is_type(desc_in, &mp_type_tuple)) {
             return uctypes_struct_agg_size((mp_obj_tuple_t *)MP_OBJ_TO_PTR(desc_in), layout_type, max_field_size);
@@ -379,9 +439,296 @@ STATIC void set_aligned(uint val_type, void *p, mp_int_t index, mp_obj_t val) {
     }
 }
 
+STATIC mp_obj_t get_bitfield(uint val_type, uint bit_offset, uint bit_len, byte *p, uint32_t flags) {
+    mp_uint_t val;
+    if (flags == LAYOUT_NATIVE) {
+        val = get_aligned_basic(val_type & 6, p);
+    } else {
+        val = mp_binary_get_int(GET_SCALAR_SIZE(val_type & 7), val_type & 1, flags, p);
+    }
+    val >>= bit_offset;
+    val &= (1 << bit_len) - 1;
+    // TODO: signed
+    assert((val_type & 1) == 0);
+    return mp_obj_new_int(val);
+}
+
+STATIC void set_bitfield(uint val_type, uint bit_offset, uint bit_len, byte *p, uint32_t flags, mp_obj_t set_val) {
+    mp_uint_t val;
+    if (flags == LAYOUT_NATIVE) {
+        val = get_aligned_basic(val_type & 6, p);
+    } else {
+        val = mp_binary_get_int(GET_SCALAR_SIZE(val_type & 7), val_type & 1, flags, p);
+    }
+    mp_uint_t set_val_int = (mp_uint_t)mp_obj_get_int(set_val);
+    mp_uint_t mask = (1 << bit_len) - 1;
+    set_val_int &= mask;
+    set_val_int <<= bit_offset;
+    mask <<= bit_offset;
+    val = (val & ~mask) | set_val_int;
+
+    if (flags == LAYOUT_NATIVE) {
+        set_aligned_basic(val_type & 6, p, val);
+    } else {
+        mp_binary_set_int(GET_SCALAR_SIZE(val_type & 7), flags == LAYOUT_BIG_ENDIAN, p, val);
+    }
+}
+
+#if MICROPY_PY_UCTYPES_COMPILE
+
+STATIC mp_obj_t layout_field_get_native(const uctypes_field_t *f, byte *addr, uint32_t flags) {
+    (void)flags;
+    return get_aligned(f->val_type, addr + f->offset, 0);
+}
+
+STATIC void layout_field_set_native(const uctypes_field_t *f, byte *addr, uint32_t flags, mp_obj_t val) {
+    (void)flags;
+    set_aligned(f->val_type, addr + f->offset, 0, val);
+}
+
+STATIC mp_obj_t layout_field_get_unaligned(const uctypes_field_t *f, byte *addr, uint32_t flags) {
+    return get_unaligned(f->val_type, addr + f->offset, flags);
+}
+
+STATIC void layout_field_set_unaligned(const uctypes_field_t *f, byte *addr, uint32_t flags, mp_obj_t val) {
+    set_unaligned(f->val_type, addr + f->offset, flags, val);
+}
+
+STATIC mp_obj_t layout_field_get_bitfield(const uctypes_field_t *f, byte *addr, uint32_t flags) {
+    return get_bitfield(f->val_type, f->bit_offset, f->bit_len, addr + f->offset, flags);
+}
+
+STATIC void layout_field_set_bitfield(const uctypes_field_t *f, byte *addr, uint32_t flags, mp_obj_t val) {
+    set_bitfield(f->val_type, f->bit_offset, f->bit_len, addr + f->offset, flags, val);
+}
+
+STATIC mp_obj_t layout_new_struct(mp_obj_t layout, byte *addr, uint32_t flags) {
+    mp_obj_uctypes_struct_t *o = mp_obj_malloc(mp_obj_uctypes_struct_t, &uctypes_struct_type);
+    o->desc = layout;
+    o->addr = addr;
+    o->flags = flags;
+    return MP_OBJ_FROM_PTR(o);
+}
+
+STATIC mp_obj_t layout_field_get_agg(const uctypes_field_t *f, byte *addr, uint32_t flags) {
+    return layout_new_struct(f->sub, addr + f->offset, flags);
+}
+
+STATIC mp_obj_t layout_field_get_bytes(const uctypes_field_t *f, byte *addr, uint32_t flags) {
+    (void)flags;
+    mp_obj_uctypes_layout_t *sub = MP_OBJ_TO_PTR(f->sub);
+    return mp_obj_new_bytearray_by_ref(sub->size, addr + f->offset);
+}
+
+STATIC mp_obj_t layout_compile(mp_obj_t desc, uint32_t layout_type, mp_obj_list_t *cache);
+
+// Compile an aggregate (tuple) descriptor, giving a layout for a STRUCT, PTR or ARRAY.
+STATIC mp_obj_t layout_compile_agg(mp_obj_tuple_t *t, uint32_t layout_type, mp_obj_list_t *cache) {
+    mp_uint_t agg_type = GET_TYPE(MP_OBJ_SMALL_INT_VALUE(t->items[0]), AGG_TYPE_BITS);
+    if (agg_type == STRUCT) {
+        return layout_compile(t->items[1], layout_type, cache);
+    }
+    mp_uint_t dummy = 0;
+    mp_obj_uctypes_layout_t *l = mp_obj_malloc(mp_obj_uctypes_layout_t, &uctypes_layout_type);
+    l->desc = MP_OBJ_FROM_PTR(t);
+    l->size = uctypes_struct_agg_size(t, layout_type, &dummy);
+    l->agg_type = agg_type;
+    l->layout_type = layout_type;
+    l->val_type = 0;
+    l->arr_len = 0;
+    l->elem = MP_OBJ_NULL;
+    mp_map_init(&l->fields_map, 0);
+    mp_obj_t elem_desc;
+    if (agg_type == ARRAY) {
+        mp_int_t arr_sz = MP_OBJ_SMALL_INT_VALUE(t->items[1]);
+        l->val_type = GET_TYPE(arr_sz, VAL_TYPE_BITS);
+        l->arr_len = arr_sz & VALUE_MASK(VAL_TYPE_BITS);
+        elem_desc = t->len == 2 ? MP_OBJ_NULL : t->items[2];
+    } else {
+        if (mp_obj_is_small_int(t->items[1])) {
+            l->val_type = GET_TYPE(MP_OBJ_SMALL_INT_VALUE(t->items[1]), VAL_TYPE_BITS);
+            elem_desc = MP_OBJ_NULL;
+        } else {
+            elem_desc = t->items[1];
+        }
+    }
+    if (elem_desc == MP_OBJ_NULL) {
+        l->elem_size = uctypes_struct_scalar_size(l->val_type);
+    } else {
+        l->elem = layout_compile(elem_desc, layout_type, cache);
+        l->elem_size = ((mp_obj_uctypes_layout_t *)MP_OBJ_TO_PTR(l->elem))->size;
+    }
+    return MP_OBJ_FROM_PTR(l);
+}
+
+// Compile a descriptor, reusing an already compiled layout for the same object.
+STATIC mp_obj_t layout_compile(mp_obj_t desc, uint32_t layout_type, mp_obj_list_t *cache) {
+    for (size_t i = 0; i < cache->len; i += 2) {
+        if (cache->items[i] == desc) {
+            return cache->items[i + 1];
+        }
+    }
+
+    mp_obj_t layout;
+    if (mp_obj_is_type(desc, &mp_type_tuple)) {
+        layout = layout_compile_agg(MP_OBJ_TO_PTR(desc), layout_type, cache);
+    } else {
+        if (!mp_obj_is_dict_or_ordereddict(desc)) {
+            syntax_error();
+        }
+        mp_map_t *desc_map = &((mp_obj_dict_t *)MP_OBJ_TO_PTR(desc))->map;
+        mp_uint_t max_field_size = 0;
+        mp_obj_uctypes_layout_t *l = mp_obj_malloc_var(mp_obj_uctypes_layout_t, uctypes_field_t, desc_map->used, &uctypes_layout_type);
+        l->desc = desc;
+        l->size = uctypes_struct_size(desc, layout_type, &max_field_size);
+        l->agg_type = STRUCT;
+        l->layout_type = layout_type;
+        l->elem = MP_OBJ_NULL;
+        mp_map_init(&l->fields_map, desc_map->used);
+        size_t n = 0;
+        for (size_t i = 0; i < desc_map->alloc; i++) {
+            if (!mp_map_slot_is_filled(desc_map, i)) {
+                continue;
+            }
+            mp_obj_t v = desc_map->table[i].value;
+            uctypes_field_t *f = &l->fields[n];
+            f->sub = MP_OBJ_NULL;
+            f->bit_offset = 0;
+            f->bit_len = 0;
+            if (mp_obj_is_small_int(v)) {
+                mp_int_t offset = MP_OBJ_SMALL_INT_VALUE(v);
+                f->val_type = GET_TYPE(offset, VAL_TYPE_BITS);
+                offset &= VALUE_MASK(VAL_TYPE_BITS);
+                if (f->val_type >= BFUINT8 && f->val_type <= BFINT32) {
+                    f->bit_offset = (offset >> OFFSET_BITS) & 31;
+                    f->bit_len = (offset >> LEN_BITS) & 31;
+                    f->offset = offset & ((1 << OFFSET_BITS) - 1);
+                    f->get = layout_field_get_bitfield;
+                    f->set = layout_field_set_bitfield;
+                } else {
+                    f->offset = offset;
+                    if (layout_type == LAYOUT_NATIVE) {
+                        f->get = layout_field_get_native;
+                        f->set = layout_field_set_native;
+                    } else {
+                        f->get = layout_field_get_unaligned;
+                        f->set = layout_field_set_unaligned;
+                    }
+                }
+            } else {
+                if (!mp_obj_is_type(v, &mp_type_tuple)) {
+                    syntax_error();
+                }
+                mp_obj_tuple_t *sub = MP_OBJ_TO_PTR(v);
+                f->val_type = 0;
+                f->offset = MP_OBJ_SMALL_INT_VALUE(sub->items[0]) & VALUE_MASK(AGG_TYPE_BITS);
+                f->sub = layout_compile(v, layout_type, cache);
+                f->set = NULL;
+                if (GET_TYPE(MP_OBJ_SMALL_INT_VALUE(sub->items[0]), AGG_TYPE_BITS) == ARRAY
+                    && IS_SCALAR_ARRAY(sub) && IS_SCALAR_ARRAY_OF_BYTES(sub)) {
+                    f->get = layout_field_get_bytes;
+                } else {
+                    f->get = layout_field_get_agg;
+                }
+            }
+            mp_map_lookup(&l->fields_map, MP_OBJ_NEW_QSTR(mp_obj_str_get_qstr(desc_map->table[i].key)), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = MP_OBJ_NEW_SMALL_INT(n);
+            ++n;
+        }
+        layout = MP_OBJ_FROM_PTR(l);
+    }
+
+    mp_obj_list_append(MP_OBJ_FROM_PTR(cache), desc);
+    mp_obj_list_append(MP_OBJ_FROM_PTR(cache), layout);
+    return layout;
+}
+
+STATIC mp_obj_t uctypes_compile(size_t n_args, const mp_obj_t *args) {
+    uint32_t layout_type = LAYOUT_NATIVE;
+    if (n_args == 2) {
+        layout_type = mp_obj_get_int(args[1]);
+    }
+    mp_obj_list_t *cache = MP_OBJ_TO_PTR(mp_obj_new_list(0, NULL));
+    return layout_compile(args[0], layout_type, cache);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(uctypes_compile_obj, 1, 2, uctypes_compile);
+
+STATIC mp_obj_t uctypes_layout_attr_op(mp_obj_uctypes_struct_t *self, qstr attr, mp_obj_t set_val) {
+    mp_obj_uctypes_layout_t *l = MP_OBJ_TO_PTR(self->desc);
+    if (l->agg_type != STRUCT) {
+        mp_raise_TypeError(MP_ERROR_TEXT("struct: no fields"));
+    }
+    mp_map_elem_t *elem = mp_map_lookup(&l->fields_map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        mp_raise_type_arg(&mp_type_KeyError, MP_OBJ_NEW_QSTR(attr));
+    }
+    const uctypes_field_t *f = &l->fields[MP_OBJ_SMALL_INT_VALUE(elem->value)];
+    if (set_val == MP_OBJ_NULL) {
+        return f->get(f, self->addr, self->flags);
+    }
+    if (f->set == NULL) {
+        // Cannot assign to aggregate
+        syntax_error();
+    }
+    f->set(f, self->addr, self->flags, set_val);
+    return set_val; // just !MP_OBJ_NULL
+}
+
+STATIC mp_obj_t uctypes_layout_subscr(mp_obj_uctypes_struct_t *self, mp_obj_t index_in, mp_obj_t value) {
+    mp_obj_uctypes_layout_t *l = MP_OBJ_TO_PTR(self->desc);
+    mp_int_t index = MP_OBJ_SMALL_INT_VALUE(index_in);
+    byte *p;
+    if (l->agg_type == ARRAY) {
+        if (index >= (mp_int_t)l->arr_len) {
+            mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("struct: index out of range"));
+        }
+        p = self->addr;
+    } else if (l->agg_type == PTR) {
+        p = *(void **)self->addr;
+    } else {
+        mp_raise_TypeError(MP_ERROR_TEXT("struct: can't index"));
+    }
+    if (l->elem != MP_OBJ_NULL) {
+        if (value != MP_OBJ_SENTINEL) {
+            return MP_OBJ_NULL; // op not supported
+        }
+        return layout_new_struct(l->elem, p + l->elem_size * index, self->flags);
+    }
+    if (self->flags == LAYOUT_NATIVE || l->agg_type == PTR) {
+        if (value == MP_OBJ_SENTINEL) {
+            return get_aligned(l->val_type, p, index);
+        } else if (l->agg_type == ARRAY) {
+            set_aligned(l->val_type, p, index, value);
+            return value; // just !MP_OBJ_NULL
+        } else {
+            return MP_OBJ_NULL; // op not supported
+        }
+    } else {
+        p += l->elem_size * index;
+        if (value == MP_OBJ_SENTINEL) {
+            return get_unaligned(l->val_type, p, self->flags);
+        } else {
+            set_unaligned(l->val_type, p, self->flags, value);
+            return value; // just !MP_OBJ_NULL
+        }
+    }
+}
+
+STATIC const mp_obj_type_t uctypes_layout_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_layout,
+};
+
+#endif
+
 STATIC mp_obj_t uctypes_struct_attr_op(mp_obj_t self_in, qstr attr, mp_obj_t set_val) {
     mp_obj_uctypes_struct_t *self = MP_OBJ_TO_PTR(self_in);
 
+    #if MICROPY_PY_UCTYPES_COMPILE
+    if (mp_obj_is_type(self->desc, &uctypes_layout_type)) {
+        return uctypes_layout_attr_op(self, attr, set_val);
+    }
+    #endif
+
     if (!mp_obj_is_dict_or_ordereddict(self->desc)) {
         mp_raise_TypeError(MP_ERROR_TEXT("struct: no fields"));
     }
@@ -412,32 +759,10 @@ STATIC mp_obj_t uctypes_struct_attr_op(mp_obj_t self_in, qstr attr, mp_obj_t set
             uint bit_offset = (offset >> OFFSET_BITS) & 31;
             uint bit_len = (offset >> LEN_BITS) & 31;
             offset &= (1 << OFFSET_BITS) - 1;
-            mp_uint_t val;
-            if (self->flags == LAYOUT_NATIVE) {
-                val = get_aligned_basic(val_type & 6, self->addr + offset);
-            } else {
-                val = mp_binary_get_int(GET_SCALAR_SIZE(val_type & 7), val_type & 1, self->flags, self->addr + offset);
-            }
             if (set_val == MP_OBJ_NULL) {
-                val >>= bit_offset;
-                val &= (1 << bit_len) - 1;
-                // TODO: signed
-                assert((val_type & 1) == 0);
-                return mp_obj_new_int(val);
+                return get_bitfield(val_type, bit_offset, bit_len, self->addr + offset, self->flags);
             } else {
-                mp_uint_t set_val_int = (mp_uint_t)mp_obj_get_int(set_val);
-                mp_uint_t mask = (1 << bit_len) - 1;
-                set_val_int &= mask;
-                set_val_int <<= bit_offset;
-                mask <<= bit_offset;
-                val = (val & ~mask) | set_val_int;
-
-                if (self->flags == LAYOUT_NATIVE) {
-                    set_aligned_basic(val_type & 6, self->addr + offset, val);
-                } else {
-                    mp_binary_set_int(GET_SCALAR_SIZE(val_type & 7), self->flags == LAYOUT_BIG_ENDIAN,
-                        self->addr + offset, val);
-                }
+                set_bitfield(val_type, bit_offset, bit_len, self->addr + offset, self->flags, set_val);
                 return set_val; // just !MP_OBJ_NULL
             }
         }
@@ -510,6 +835,11 @@ STATIC mp_obj_t uctypes_struct_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_ob
         return MP_OBJ_NULL; // op not supported
     } else {
         // load / store
+        #if MICROPY_PY_UCTYPES_COMPILE
+        if (mp_obj_is_type(self->desc, &uctypes_layout_type)) {
+            return uctypes_layout_subscr(self, index_in, value);
+        }
+        #endif
         if (!mp_obj_is_type(self->desc, &mp_type_tuple)) {
             mp_raise_TypeError(MP_ERROR_TEXT("struct: can't index"));
         }
@@ -583,6 +913,14 @@ STATIC mp_obj_t uctypes_struct_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     mp_obj_uctypes_struct_t *self = MP_OBJ_TO_PTR(self_in);
     switch (op) {
         case MP_UNARY_OP_INT:
+            #if MICROPY_PY_UCTYPES_COMPILE
+            if (mp_obj_is_type(self->desc, &uctypes_layout_type)) {
+                if (((mp_obj_uctypes_layout_t *)MP_OBJ_TO_PTR(self->desc))->agg_type == PTR) {
+                    byte *p = *(void **)self->addr;
+                    return mp_obj_new_int((mp_int_t)(uintptr_t)p);
+                }
+            } else
+            #endif
             if (mp_obj_is_type(self->desc, &mp_type_tuple)) {
                 mp_obj_tuple_t *t = MP_OBJ_TO_PTR(self->desc);
                 mp_int_t offset = MP_OBJ_SMALL_INT_VALUE(t->items[0]);
@@ -652,6 +990,9 @@ STATIC const mp_rom_map_elem_t mp_module_uctypes_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_addressof), MP_ROM_PTR(&uctypes_struct_addressof_obj) },
     { MP_ROM_QSTR(MP_QSTR_bytes_at), MP_ROM_PTR(&uctypes_struct_bytes_at_obj) },
     { MP_ROM_QSTR(MP_QSTR_bytearray_at), MP_ROM_PTR(&uctypes_struct_bytearray_at_obj) },
+    #if MICROPY_PY_UCTYPES_COMPILE
+    { MP_ROM_QSTR(MP_QSTR_compile), MP_ROM_PTR(&uctypes_compile_obj) },
+    #endif
 
     { MP_ROM_QSTR(MP_QSTR_NATIVE), MP_ROM_INT(LAYOUT_NATIVE) },
     { MP_ROM_QSTR(MP_QSTR_LITTLE_ENDIAN), MP_ROM_INT(LAYOUT_LITTLE_ENDIAN) },
@@ -28,6 +28,9 @@
 #include <string.h>
 
 #include "py/runtime.h"
+#include "py/stream.h"
+#include "py/builtin.h"
+#include "extmod/crypto_hw.h"
 
 #if MICROPY_PY_UHASHLIB
 
@@ -45,6 +48,10 @@
 
 #endif
 
+#if MICROPY_PY_UHASHLIB_SHA512 && MICROPY_SSL_MBEDTLS
+#include "mbedtls/sha512.h"
+#endif
+
 #if MICROPY_PY_UHASHLIB_SHA1 || MICROPY_PY_UHASHLIB_MD5
 
 #if MICROPY_SSL_AXTLS
@@ -70,6 +77,33 @@ static void uhashlib_ensure_not_final(mp_obj_hash_t *self) {
     }
 }
 
+// Create a hash object of the same type as self, for copy() to fill in its state.
+STATIC mp_obj_hash_t *uhashlib_copy_new(mp_obj_t self_in, size_t state_size) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    uhashlib_ensure_not_final(self);
+    mp_obj_hash_t *o = mp_obj_malloc_var(mp_obj_hash_t, char, state_size, self->base.type);
+    o->final = false;
+    return o;
+}
+
+// Shared by all the hash types, as it only needs their digest() method.
+STATIC mp_obj_t uhashlib_hexdigest(mp_obj_t self_in) {
+    mp_obj_t dest[2];
+    mp_load_method(self_in, MP_QSTR_digest, dest);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(mp_call_method_n_kw(0, 0, dest), &bufinfo, MP_BUFFER_READ);
+    static const char hexdig[] = "0123456789abcdef";
+    vstr_t vstr;
+    vstr_init_len(&vstr, bufinfo.len * 2);
+    const byte *in = bufinfo.buf;
+    for (size_t i = 0; i < bufinfo.len; ++i) {
+        vstr.buf[2 * i] = hexdig[in[i] >> 4];
+        vstr.buf[2 * i + 1] = hexdig[in[i] & 0xf];
+    }
+    return mp_obj_new_str_from_vstr(&mp_type_str, &vstr);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(uhashlib_hexdigest_obj, uhashlib_hexdigest);
+
 #if MICROPY_PY_UHASHLIB_SHA256
 STATIC mp_obj_t uhashlib_sha256_update(mp_obj_t self_in, mp_obj_t arg);
 
@@ -112,6 +146,14 @@ STATIC mp_obj_t uhashlib_sha256_digest(mp_obj_t self_in) {
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
 
+STATIC mp_obj_t uhashlib_sha256_copy(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_hash_t *o = uhashlib_copy_new(self_in, sizeof(mbedtls_sha256_context));
+    mbedtls_sha256_init((mbedtls_sha256_context *)&o->state);
+    mbedtls_sha256_clone((mbedtls_sha256_context *)&o->state, (mbedtls_sha256_context *)&self->state);
+    return MP_OBJ_FROM_PTR(o);
+}
+
 #else
 
 #include "lib/crypto-algorithms/sha256.c"
@@ -132,7 +174,25 @@ STATIC mp_obj_t uhashlib_sha256_update(mp_obj_t self_in, mp_obj_t arg) {
     uhashlib_ensure_not_final(self);
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(arg, &bufinfo, MP_BUFFER_READ);
+    #if MICROPY_HW_CRYPTO_SHA256
+    CRYAL_SHA256_CTX *ctx = (CRYAL_SHA256_CTX *)self->state;
+    const byte *buf = bufinfo.buf;
+    size_t len = bufinfo.len;
+    // Complete any partial block in software, then pass whole blocks to the engine
+    size_t head = MIN((64 - ctx->datalen) % 64, len);
+    sha256_update(ctx, buf, head);
+    buf += head;
+    len -= head;
+    size_t nblocks = len / 64;
+    if (nblocks > 0 && mp_hw_sha256_blocks((uint32_t *)ctx->state, buf, nblocks)) {
+        ctx->bitlen += (unsigned long long)nblocks * 512;
+        buf += nblocks * 64;
+        len -= nblocks * 64;
+    }
+    sha256_update(ctx, buf, len);
+    #else
     sha256_update((CRYAL_SHA256_CTX *)self->state, bufinfo.buf, bufinfo.len);
+    #endif
     return mp_const_none;
 }
 
@@ -145,14 +205,24 @@ STATIC mp_obj_t uhashlib_sha256_digest(mp_obj_t self_in) {
     sha256_final((CRYAL_SHA256_CTX *)self->state, (byte *)vstr.buf);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
+
+STATIC mp_obj_t uhashlib_sha256_copy(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_hash_t *o = uhashlib_copy_new(self_in, sizeof(CRYAL_SHA256_CTX));
+    memcpy(o->state, self->state, sizeof(CRYAL_SHA256_CTX));
+    return MP_OBJ_FROM_PTR(o);
+}
 #endif
 
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(uhashlib_sha256_update_obj, uhashlib_sha256_update);
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(uhashlib_sha256_digest_obj, uhashlib_sha256_digest);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(uhashlib_sha256_copy_obj, uhashlib_sha256_copy);
 
 STATIC const mp_rom_map_elem_t uhashlib_sha256_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&uhashlib_sha256_update_obj) },
     { MP_ROM_QSTR(MP_QSTR_digest), MP_ROM_PTR(&uhashlib_sha256_digest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_hexdigest), MP_ROM_PTR(&uhashlib_hexdigest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_copy), MP_ROM_PTR(&uhashlib_sha256_copy_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(uhashlib_sha256_locals_dict, uhashlib_sha256_locals_dict_table);
@@ -165,6 +235,237 @@ STATIC const mp_obj_type_t uhashlib_sha256_type = {
 };
 #endif
 
+#if MICROPY_PY_UHASHLIB_SHA512
+STATIC mp_obj_t uhashlib_sha512_update(mp_obj_t self_in, mp_obj_t arg);
+
+#if MICROPY_SSL_MBEDTLS
+
+#if MBEDTLS_VERSION_NUMBER < 0x02070000
+#define mbedtls_sha512_starts_ret mbedtls_sha512_starts
+#define mbedtls_sha512_update_ret mbedtls_sha512_update
+#define mbedtls_sha512_finish_ret mbedtls_sha512_finish
+#endif
+
+STATIC mp_obj_t uhashlib_sha512_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 1, false);
+    mp_obj_hash_t *o = mp_obj_malloc_var(mp_obj_hash_t, char, sizeof(mbedtls_sha512_context), type);
+    o->final = false;
+    mbedtls_sha512_init((mbedtls_sha512_context *)o->state);
+    mbedtls_sha512_starts_ret((mbedtls_sha512_context *)o->state, 0);
+    if (n_args == 1) {
+        uhashlib_sha512_update(MP_OBJ_FROM_PTR(o), args[0]);
+    }
+    return MP_OBJ_FROM_PTR(o);
+}
+
+STATIC mp_obj_t uhashlib_sha512_update(mp_obj_t self_in, mp_obj_t arg) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    uhashlib_ensure_not_final(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(arg, &bufinfo, MP_BUFFER_READ);
+    mbedtls_sha512_update_ret((mbedtls_sha512_context *)self->state, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+
+STATIC mp_obj_t uhashlib_sha512_digest(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    uhashlib_ensure_not_final(self);
+    self->final = true;
+    vstr_t vstr;
+    vstr_init_len(&vstr, 64);
+    mbedtls_sha512_finish_ret((mbedtls_sha512_context *)self->state, (byte *)vstr.buf);
+    mbedtls_sha512_free((mbedtls_sha512_context *)self->state);
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+
+STATIC mp_obj_t uhashlib_sha512_copy(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_hash_t *o = uhashlib_copy_new(self_in, sizeof(mbedtls_sha512_context));
+    mbedtls_sha512_init((mbedtls_sha512_context *)o->state);
+    mbedtls_sha512_clone((mbedtls_sha512_context *)o->state, (mbedtls_sha512_context *)self->state);
+    return MP_OBJ_FROM_PTR(o);
+}
+
+#else
+
+// Software SHA-512, as specified in FIPS 180-4.
+
+typedef struct _uhashlib_sha512_ctx_t {
+    uint64_t state[8];
+    uint64_t bitlen;
+    uint32_t datalen;
+    byte data[128];
+} uhashlib_sha512_ctx_t;
+
+STATIC const uint64_t uhashlib_sha512_k[80] = {
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+    0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+    0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+    0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+    0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+    0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+    0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+    0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+    0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+    0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+    0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+    0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+    0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+    0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL,
+};
+
+#define SHA512_ROTR(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+STATIC void uhashlib_sha512_transform(uhashlib_sha512_ctx_t *ctx, const byte *data) {
+    // The message schedule is kept as a rolling window of 16 words
+    uint64_t w[16];
+    for (int i = 0; i < 16; ++i, data += 8) {
+        w[i] = (uint64_t)data[0] << 56 | (uint64_t)data[1] << 48 | (uint64_t)data[2] << 40 | (uint64_t)data[3] << 32
+            | (uint64_t)data[4] << 24 | (uint64_t)data[5] << 16 | (uint64_t)data[6] << 8 | data[7];
+    }
+    uint64_t a = ctx->state[0], b = ctx->state[1], c = ctx->state[2], d = ctx->state[3];
+    uint64_t e = ctx->state[4], f = ctx->state[5], g = ctx->state[6], h = ctx->state[7];
+    for (int i = 0; i < 80; ++i) {
+        if (i >= 16) {
+            uint64_t w15 = w[(i - 15) & 15];
+            uint64_t w2 = w[(i - 2) & 15];
+            w[i & 15] += (SHA512_ROTR(w2, 19) ^ SHA512_ROTR(w2, 61) ^ (w2 >> 6)) + w[(i - 7) & 15]
+                + (SHA512_ROTR(w15, 1) ^ SHA512_ROTR(w15, 8) ^ (w15 >> 7));
+        }
+        uint64_t t1 = h + (SHA512_ROTR(e, 14) ^ SHA512_ROTR(e, 18) ^ SHA512_ROTR(e, 41))
+            + ((e & f) ^ (~e & g)) + uhashlib_sha512_k[i] + w[i & 15];
+        uint64_t t2 = (SHA512_ROTR(a, 28) ^ SHA512_ROTR(a, 34) ^ SHA512_ROTR(a, 39)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    ctx->state[0] += a;
+    ctx->state[1] += b;
+    ctx->state[2] += c;
+    ctx->state[3] += d;
+    ctx->state[4] += e;
+    ctx->state[5] += f;
+    ctx->state[6] += g;
+    ctx->state[7] += h;
+}
+
+STATIC void uhashlib_sha512_sw_update(uhashlib_sha512_ctx_t *ctx, const byte *data, size_t len) {
+    ctx->bitlen += (uint64_t)len << 3;
+    while (len > 0) {
+        if (ctx->datalen == 0 && len >= 128) {
+            // whole blocks are hashed straight from the input
+            uhashlib_sha512_transform(ctx, data);
+            data += 128;
+            len -= 128;
+            continue;
+        }
+        size_t n = MIN(len, 128 - ctx->datalen);
+        memcpy(ctx->data + ctx->datalen, data, n);
+        ctx->datalen += n;
+        data += n;
+        len -= n;
+        if (ctx->datalen == 128) {
+            uhashlib_sha512_transform(ctx, ctx->data);
+            ctx->datalen = 0;
+        }
+    }
+}
+
+STATIC mp_obj_t uhashlib_sha512_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 1, false);
+    mp_obj_hash_t *o = mp_obj_malloc_var(mp_obj_hash_t, char, sizeof(uhashlib_sha512_ctx_t), type);
+    o->final = false;
+    static const uint64_t init_state[8] = {
+        0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+        0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL,
+    };
+    uhashlib_sha512_ctx_t *ctx = (uhashlib_sha512_ctx_t *)o->state;
+    memcpy(ctx->state, init_state, sizeof(init_state));
+    ctx->bitlen = 0;
+    ctx->datalen = 0;
+    if (n_args == 1) {
+        uhashlib_sha512_update(MP_OBJ_FROM_PTR(o), args[0]);
+    }
+    return MP_OBJ_FROM_PTR(o);
+}
+
+STATIC mp_obj_t uhashlib_sha512_update(mp_obj_t self_in, mp_obj_t arg) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    uhashlib_ensure_not_final(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(arg, &bufinfo, MP_BUFFER_READ);
+    uhashlib_sha512_sw_update((uhashlib_sha512_ctx_t *)self->state, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+
+STATIC mp_obj_t uhashlib_sha512_digest(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    uhashlib_ensure_not_final(self);
+    self->final = true;
+    uhashlib_sha512_ctx_t *ctx = (uhashlib_sha512_ctx_t *)self->state;
+
+    // Pad with 0x80 then zeros to 16 bytes short of a block, then the
+    // 128-bit message length (of which only the low 64 bits are kept)
+    uint64_t bitlen = ctx->bitlen;
+    ctx->data[ctx->datalen++] = 0x80;
+    if (ctx->datalen > 112) {
+        memset(ctx->data + ctx->datalen, 0, 128 - ctx->datalen);
+        uhashlib_sha512_transform(ctx, ctx->data);
+        ctx->datalen = 0;
+    }
+    memset(ctx->data + ctx->datalen, 0, 120 - ctx->datalen);
+    for (int i = 0; i < 8; ++i) {
+        ctx->data[127 - i] = bitlen >> (8 * i);
+    }
+    uhashlib_sha512_transform(ctx, ctx->data);
+
+    vstr_t vstr;
+    vstr_init_len(&vstr, 64);
+    for (int i = 0; i < 64; ++i) {
+        vstr.buf[i] = ctx->state[i / 8] >> (56 - 8 * (i % 8));
+    }
+    return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
+}
+
+STATIC mp_obj_t uhashlib_sha512_copy(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_hash_t *o = uhashlib_copy_new(self_in, sizeof(uhashlib_sha512_ctx_t));
+    memcpy(o->state, self->state, sizeof(uhashlib_sha512_ctx_t));
+    return MP_OBJ_FROM_PTR(o);
+}
+#endif
+
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(uhashlib_sha512_update_obj, uhashlib_sha512_update);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(uhashlib_sha512_digest_obj, uhashlib_sha512_digest);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(uhashlib_sha512_copy_obj, uhashlib_sha512_copy);
+
+STATIC const mp_rom_map_elem_t uhashlib_sha512_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&uhashlib_sha512_update_obj) },
+    { MP_ROM_QSTR(MP_QSTR_digest), MP_ROM_PTR(&uhashlib_sha512_digest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_hexdigest), MP_ROM_PTR(&uhashlib_hexdigest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_copy), MP_ROM_PTR(&uhashlib_sha512_copy_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(uhashlib_sha512_locals_dict, uhashlib_sha512_locals_dict_table);
+
+STATIC const mp_obj_type_t uhashlib_sha512_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_sha512,
+    .make_new = uhashlib_sha512_make_new,
+    .locals_dict = (void *)&uhashlib_sha512_locals_dict,
+};
+#endif
+
 #if MICROPY_PY_UHASHLIB_SHA1
 STATIC mp_obj_t uhashlib_sha1_update(mp_obj_t self_in, mp_obj_t arg);
 
@@ -198,6 +499,13 @@ STATIC mp_obj_t uhashlib_sha1_digest(mp_obj_t self_in) {
     SHA1_Final((byte *)vstr.buf, (SHA1_CTX *)self->state);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
+
+STATIC mp_obj_t uhashlib_sha1_copy(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_hash_t *o = uhashlib_copy_new(self_in, sizeof(SHA1_CTX));
+    memcpy(o->state, self->state, sizeof(SHA1_CTX));
+    return MP_OBJ_FROM_PTR(o);
+}
 #endif
 
 #if MICROPY_SSL_MBEDTLS
@@ -239,14 +547,25 @@ STATIC mp_obj_t uhashlib_sha1_digest(mp_obj_t self_in) {
     mbedtls_sha1_free((mbedtls_sha1_context *)self->state);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
+
+STATIC mp_obj_t uhashlib_sha1_copy(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_hash_t *o = uhashlib_copy_new(self_in, sizeof(mbedtls_sha1_context));
+    mbedtls_sha1_init((mbedtls_sha1_context *)o->state);
+    mbedtls_sha1_clone((mbedtls_sha1_context *)o->state, (mbedtls_sha1_context *)self->state);
+    return MP_OBJ_FROM_PTR(o);
+}
 #endif
 
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(uhashlib_sha1_update_obj, uhashlib_sha1_update);
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(uhashlib_sha1_digest_obj, uhashlib_sha1_digest);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(uhashlib_sha1_copy_obj, uhashlib_sha1_copy);
 
 STATIC const mp_rom_map_elem_t uhashlib_sha1_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&uhashlib_sha1_update_obj) },
     { MP_ROM_QSTR(MP_QSTR_digest), MP_ROM_PTR(&uhashlib_sha1_digest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_hexdigest), MP_ROM_PTR(&uhashlib_hexdigest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_copy), MP_ROM_PTR(&uhashlib_sha1_copy_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(uhashlib_sha1_locals_dict, uhashlib_sha1_locals_dict_table);
 
@@ -291,6 +610,13 @@ STATIC mp_obj_t uhashlib_md5_digest(mp_obj_t self_in) {
     MD5_Final((byte *)vstr.buf, (MD5_CTX *)self->state);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
+
+STATIC mp_obj_t uhashlib_md5_copy(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_hash_t *o = uhashlib_copy_new(self_in, sizeof(MD5_CTX));
+    memcpy(o->state, self->state, sizeof(MD5_CTX));
+    return MP_OBJ_FROM_PTR(o);
+}
 #endif // MICROPY_SSL_AXTLS
 
 #if MICROPY_SSL_MBEDTLS
@@ -332,14 +658,25 @@ STATIC mp_obj_t uhashlib_md5_digest(mp_obj_t self_in) {
     mbedtls_md5_free((mbedtls_md5_context *)self->state);
     return mp_obj_new_str_from_vstr(&mp_type_bytes, &vstr);
 }
+
+STATIC mp_obj_t uhashlib_md5_copy(mp_obj_t self_in) {
+    mp_obj_hash_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_hash_t *o = uhashlib_copy_new(self_in, sizeof(mbedtls_md5_context));
+    mbedtls_md5_init((mbedtls_md5_context *)o->state);
+    mbedtls_md5_clone((mbedtls_md5_context *)o->state, (mbedtls_md5_context *)self->state);
+    return MP_OBJ_FROM_PTR(o);
+}
 #endif // MICROPY_SSL_MBEDTLS
 
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(uhashlib_md5_update_obj, uhashlib_md5_update);
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(uhashlib_md5_digest_obj, uhashlib_md5_digest);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(uhashlib_md5_copy_obj, uhashlib_md5_copy);
 
 STATIC const mp_rom_map_elem_t uhashlib_md5_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&uhashlib_md5_update_obj) },
     { MP_ROM_QSTR(MP_QSTR_digest), MP_ROM_PTR(&uhashlib_md5_digest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_hexdigest), MP_ROM_PTR(&uhashlib_hexdigest_obj) },
+    { MP_ROM_QSTR(MP_QSTR_copy), MP_ROM_PTR(&uhashlib_md5_copy_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(uhashlib_md5_locals_dict, uhashlib_md5_locals_dict_table);
 
@@ -351,11 +688,61 @@ STATIC const mp_obj_type_t uhashlib_md5_type = {
 };
 #endif // MICROPY_PY_UHASHLIB_MD5
 
+// Hash the rest of a stream, read in large blocks, with the given algorithm
+// (a hash type, another callable making a hash object, or the name of one of
+// the hash types here).  Returns the hash object.
+STATIC mp_obj_t uhashlib_file_digest(mp_obj_t stream_in, mp_obj_t algo_in) {
+    mp_get_stream_raise(stream_in, MP_STREAM_OP_READ);
+    if (mp_obj_is_str(algo_in)) {
+        size_t len;
+        const char *name = mp_obj_str_get_data(algo_in, &len);
+        qstr q = qstr_find_strn(name, len);
+        mp_map_elem_t *elem = NULL;
+        if (q != MP_QSTRnull) {
+            elem = mp_map_lookup(&mp_module_uhashlib.globals->map, MP_OBJ_NEW_QSTR(q), MP_MAP_LOOKUP);
+        }
+        if (elem == NULL || !mp_obj_is_type(elem->value, &mp_type_type)) {
+            mp_raise_ValueError(MP_ERROR_TEXT("unsupported hash type"));
+        }
+        algo_in = elem->value;
+    }
+    mp_obj_t h = mp_call_function_0(algo_in);
+    mp_obj_t update[3];
+    mp_load_method(h, MP_QSTR_update, update);
+
+    size_t buf_sz = 4096;
+    byte *buf = m_new(byte, buf_sz);
+    update[2] = mp_obj_new_bytearray_by_ref(buf_sz, buf);
+    for (;;) {
+        int errcode;
+        mp_uint_t n = mp_stream_read_exactly(stream_in, buf, buf_sz, &errcode);
+        if (errcode != 0) {
+            mp_raise_OSError(errcode);
+        }
+        if (n < buf_sz) {
+            // a short read is the end of the stream
+            if (n > 0) {
+                update[2] = mp_obj_new_bytearray_by_ref(n, buf);
+                mp_call_method_n_kw(1, 0, update);
+            }
+            break;
+        }
+        mp_call_method_n_kw(1, 0, update);
+    }
+    m_del(byte, buf, buf_sz);
+    return h;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(uhashlib_file_digest_obj, uhashlib_file_digest);
+
 STATIC const mp_rom_map_elem_t mp_module_uhashlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uhashlib) },
+    { MP_ROM_QSTR(MP_QSTR_file_digest), MP_ROM_PTR(&uhashlib_file_digest_obj) },
     #if MICROPY_PY_UHASHLIB_SHA256
     { MP_ROM_QSTR(MP_QSTR_sha256), MP_ROM_PTR(&uhashlib_sha256_type) },
     #endif
+    #if MICROPY_PY_UHASHLIB_SHA512
+    { MP_ROM_QSTR(MP_QSTR_sha512), MP_ROM_PTR(&uhashlib_sha512_type) },
+    #endif
     #if MICROPY_PY_UHASHLIB_SHA1
     { MP_ROM_QSTR(MP_QSTR_sha1), MP_ROM_PTR(&uhashlib_sha1_type) },
     #endif
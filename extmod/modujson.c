@@ -27,13 +27,166 @@
 #include <stdio.h>
 
 #include "py/objlist.h"
-#include "py/objstringio.h"
+#include "py/objstr.h"
 #include "py/parsenum.h"
 #include "py/runtime.h"
+#include "py/stackctrl.h"
 #include "py/stream.h"
 
 #if MICROPY_PY_UJSON
 
+// The encoder below writes JSON straight into a vstr, handling the common
+// types itself instead of going through mp_obj_print_helper for every value.
+// Anything else (eg user types, big ints) falls back to printing with
+// PRINT_JSON.  When dumping to a stream the vstr is used as a write buffer
+// and flushed once it reaches this size.
+#define UJSON_DUMP_BUF_SIZE (256)
+
+typedef struct _ujson_enc_t {
+    vstr_t vstr;
+    mp_obj_t stream_obj; // MP_OBJ_NULL for dumps
+    mp_print_ext_t print_ext; // prints into vstr, for the fallback
+} ujson_enc_t;
+
+STATIC void ujson_enc_reserve(vstr_t *vstr, size_t n) {
+    // vstr only grows by what is asked for, so grow it geometrically here to
+    // keep encoding of large documents linear in time
+    if (vstr->len + n > vstr->alloc) {
+        vstr_hint_size(vstr, MAX(n, vstr->alloc));
+    }
+}
+
+STATIC void ujson_enc_str(ujson_enc_t *enc, const byte *str_data, size_t str_len) {
+    // same output as mp_str_print_json, but runs of plain chars are added in one go
+    vstr_t *vstr = &enc->vstr;
+    ujson_enc_reserve(vstr, str_len + 2);
+    vstr_add_byte(vstr, '"');
+    const byte *run = str_data;
+    for (const byte *s = str_data, *top = str_data + str_len; s < top; s++) {
+        byte c = *s;
+        if (c >= 32 && c != '"' && c != '\\') {
+            continue;
+        }
+        vstr_add_strn(vstr, (const char *)run, s - run);
+        run = s + 1;
+        if (c == '"' || c == '\\') {
+            vstr_add_byte(vstr, '\\');
+            vstr_add_byte(vstr, c);
+        } else if (c == '\n') {
+            vstr_add_strn(vstr, "\\n", 2);
+        } else if (c == '\r') {
+            vstr_add_strn(vstr, "\\r", 2);
+        } else if (c == '\t') {
+            vstr_add_strn(vstr, "\\t", 2);
+        } else {
+            // this will handle control chars
+            vstr_printf(vstr, "\\u%04x", c);
+        }
+    }
+    vstr_add_strn(vstr, (const char *)run, str_data + str_len - run);
+    vstr_add_byte(vstr, '"');
+}
+
+STATIC void ujson_enc_small_int(ujson_enc_t *enc, mp_int_t val) {
+    char buf[sizeof(mp_int_t) * 3 + 2];
+    char *p = buf + sizeof(buf);
+    mp_uint_t u = val < 0 ? -(mp_uint_t)val : (mp_uint_t)val;
+    do {
+        *--p = '0' + u % 10;
+        u /= 10;
+    } while (u != 0);
+    if (val < 0) {
+        *--p = '-';
+    }
+    vstr_add_strn(&enc->vstr, p, buf + sizeof(buf) - p);
+}
+
+STATIC void ujson_enc_obj(ujson_enc_t *enc, mp_obj_t obj) {
+    MP_STACK_CHECK();
+    vstr_t *vstr = &enc->vstr;
+    ujson_enc_reserve(vstr, 32);
+    if (mp_obj_is_small_int(obj)) {
+        ujson_enc_small_int(enc, MP_OBJ_SMALL_INT_VALUE(obj));
+    } else if (mp_obj_is_str_or_bytes(obj)) {
+        GET_STR_DATA_LEN(obj, str_data, str_len);
+        ujson_enc_str(enc, str_data, str_len);
+    } else if (obj == mp_const_none) {
+        vstr_add_strn(vstr, "null", 4);
+    } else if (obj == mp_const_true) {
+        vstr_add_strn(vstr, "true", 4);
+    } else if (obj == mp_const_false) {
+        vstr_add_strn(vstr, "false", 5);
+    #if MICROPY_PY_BUILTINS_FLOAT
+    } else if (mp_obj_is_float(obj)) {
+        mp_type_float.print(&enc->print_ext.base, obj, PRINT_JSON);
+    #endif
+    } else if (mp_obj_is_type(obj, &mp_type_list) || mp_obj_is_type(obj, &mp_type_tuple)) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(obj, &len, &items);
+        vstr_add_byte(vstr, '[');
+        for (size_t i = 0; i < len; i++) {
+            if (i > 0) {
+                vstr_add_str(vstr, enc->print_ext.item_separator);
+            }
+            ujson_enc_obj(enc, items[i]);
+        }
+        vstr_add_byte(vstr, ']');
+    } else if (mp_obj_is_dict_or_ordereddict(obj)) {
+        mp_map_t *map = mp_obj_dict_get_map(obj);
+        bool first = true;
+        vstr_add_byte(vstr, '{');
+        for (size_t i = 0; i < map->alloc; i++) {
+            if (!mp_map_slot_is_filled(map, i)) {
+                continue;
+            }
+            if (!first) {
+                vstr_add_str(vstr, enc->print_ext.item_separator);
+            }
+            first = false;
+            mp_obj_t key = map->table[i].key;
+            if (mp_obj_is_str_or_bytes(key)) {
+                GET_STR_DATA_LEN(key, str_data, str_len);
+                ujson_enc_str(enc, str_data, str_len);
+            } else {
+                vstr_add_byte(vstr, '"');
+                ujson_enc_obj(enc, key);
+                vstr_add_byte(vstr, '"');
+            }
+            vstr_add_str(vstr, enc->print_ext.key_separator);
+            ujson_enc_obj(enc, map->table[i].value);
+        }
+        vstr_add_byte(vstr, '}');
+    } else {
+        mp_obj_print_helper(&enc->print_ext.base, obj, PRINT_JSON);
+    }
+    if (enc->stream_obj != MP_OBJ_NULL && vstr->len >= UJSON_DUMP_BUF_SIZE) {
+        mp_stream_write(enc->stream_obj, vstr->buf, vstr->len, MP_STREAM_RW_WRITE);
+        vstr_reset(vstr);
+    }
+}
+
+// Encode obj, writing it to stream_obj if given, otherwise returning a str.
+STATIC mp_obj_t ujson_encode(mp_obj_t obj, mp_obj_t stream_obj, const char *item_separator, const char *key_separator) {
+    ujson_enc_t enc;
+    if (stream_obj != MP_OBJ_NULL) {
+        mp_get_stream_raise(stream_obj, MP_STREAM_OP_WRITE);
+    }
+    vstr_init_print(&enc.vstr, stream_obj == MP_OBJ_NULL ? 8 : UJSON_DUMP_BUF_SIZE, &enc.print_ext.base);
+    enc.stream_obj = stream_obj;
+    enc.print_ext.item_separator = item_separator;
+    enc.print_ext.key_separator = key_separator;
+    ujson_enc_obj(&enc, obj);
+    if (stream_obj == MP_OBJ_NULL) {
+        return mp_obj_new_str_from_vstr(&mp_type_str, &enc.vstr);
+    }
+    if (enc.vstr.len != 0) {
+        mp_stream_write(stream_obj, enc.vstr.buf, enc.vstr.len, MP_STREAM_RW_WRITE);
+    }
+    vstr_clear(&enc.vstr);
+    return mp_const_none;
+}
+
 #if MICROPY_PY_UJSON_SEPARATORS
 
 enum {
@@ -50,31 +203,21 @@ STATIC mp_obj_t mod_ujson_dump_helper(size_t n_args, const mp_obj_t *pos_args, m
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - mode, pos_args + mode, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    mp_print_ext_t print_ext;
-
-    if (args[ARG_separators].u_obj == mp_const_none) {
-        print_ext.item_separator = ", ";
-        print_ext.key_separator = ": ";
-    } else {
+    const char *item_separator = ", ";
+    const char *key_separator = ": ";
+    if (args[ARG_separators].u_obj != mp_const_none) {
         mp_obj_t *items;
         mp_obj_get_array_fixed_n(args[ARG_separators].u_obj, 2, &items);
-        print_ext.item_separator = mp_obj_str_get_str(items[0]);
-        print_ext.key_separator = mp_obj_str_get_str(items[1]);
+        item_separator = mp_obj_str_get_str(items[0]);
+        key_separator = mp_obj_str_get_str(items[1]);
     }
 
     if (mode == DUMP_MODE_TO_STRING) {
         // dumps(obj)
-        vstr_t vstr;
-        vstr_init_print(&vstr, 8, &print_ext.base);
-        mp_obj_print_helper(&print_ext.base, pos_args[0], PRINT_JSON);
-        return mp_obj_new_str_from_vstr(&mp_type_str, &vstr);
+        return ujson_encode(pos_args[0], MP_OBJ_NULL, item_separator, key_separator);
     } else {
         // dump(obj, stream)
-        print_ext.base.data = MP_OBJ_TO_PTR(pos_args[1]);
-        print_ext.base.print_strn = mp_stream_write_adaptor;
-        mp_get_stream_raise(pos_args[1], MP_STREAM_OP_WRITE);
-        mp_obj_print_helper(&print_ext.base, pos_args[0], PRINT_JSON);
-        return mp_const_none;
+        return ujson_encode(pos_args[0], pos_args[1], item_separator, key_separator);
     }
 }
 
@@ -91,25 +234,18 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_ujson_dumps_obj, 1, mod_ujson_dumps);
 #else
 
 STATIC mp_obj_t mod_ujson_dump(mp_obj_t obj, mp_obj_t stream) {
-    mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
-    mp_print_t print = {MP_OBJ_TO_PTR(stream), mp_stream_write_adaptor};
-    mp_obj_print_helper(&print, obj, PRINT_JSON);
-    return mp_const_none;
+    return ujson_encode(obj, stream, ", ", ": ");
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_ujson_dump_obj, mod_ujson_dump);
 
 STATIC mp_obj_t mod_ujson_dumps(mp_obj_t obj) {
-    vstr_t vstr;
-    mp_print_t print;
-    vstr_init_print(&vstr, 8, &print);
-    mp_obj_print_helper(&print, obj, PRINT_JSON);
-    return mp_obj_new_str_from_vstr(&mp_type_str, &vstr);
+    return ujson_encode(obj, MP_OBJ_NULL, ", ", ": ");
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_dumps_obj, mod_ujson_dumps);
 
 #endif
 
-// The function below implements a simple non-recursive JSON parser.
+// The functions below implement a simple non-recursive JSON parser.
 //
 // The JSON specification is at http://www.ietf.org/rfc/rfc4627.txt
 // The parser here will parse any valid JSON and return the correct
@@ -122,11 +258,18 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_dumps_obj, mod_ujson_dumps);
 // strings).  It does 1 pass over the input stream.  It tries to be fast and
 // small in code size, while not using more RAM than necessary.
 
+// Streams are read in chunks of this size, rather than a byte at a time.
+#define UJSON_STREAM_BUF_SIZE (64)
+
 typedef struct _ujson_stream_t {
     mp_obj_t stream_obj;
+    // NULL when parsing from memory, in which case buf/len is all the input
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
-    int errcode;
+    const byte *buf;
+    size_t len;
+    size_t pos;
     byte cur;
+    byte rbuf[UJSON_STREAM_BUF_SIZE];
 } ujson_stream_t;
 
 #define S_EOF (0) // null is not allowed in json stream so is ok as EOF marker
@@ -134,38 +277,61 @@ typedef struct _ujson_stream_t {
 #define S_CUR(s) ((s).cur)
 #define S_NEXT(s) (ujson_stream_next(&(s)))
 
+STATIC void ujson_stream_init(ujson_stream_t *s, mp_obj_t stream_obj) {
+    const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
+    s->stream_obj = stream_obj;
+    s->read = stream_p->read;
+    s->buf = s->rbuf;
+    s->len = 0;
+    s->pos = 0;
+    s->cur = 0;
+}
+
 STATIC byte ujson_stream_next(ujson_stream_t *s) {
-    mp_uint_t ret = s->read(s->stream_obj, &s->cur, 1, &s->errcode);
-    if (s->errcode != 0) {
-        mp_raise_OSError(s->errcode);
-    }
-    if (ret == 0) {
-        s->cur = S_EOF;
+    if (s->pos >= s->len) {
+        if (s->read == NULL) {
+            s->cur = S_EOF;
+            return s->cur;
+        }
+        int errcode;
+        mp_uint_t ret = s->read(s->stream_obj, s->rbuf, sizeof(s->rbuf), &errcode);
+        if (ret == MP_STREAM_ERROR) {
+            mp_raise_OSError(errcode);
+        }
+        if (ret == 0) {
+            s->cur = S_EOF;
+            return s->cur;
+        }
+        s->buf = s->rbuf;
+        s->len = ret;
+        s->pos = 0;
     }
+    s->cur = s->buf[s->pos++];
     return s->cur;
 }
 
-STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
-    const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-    ujson_stream_t s = {stream_obj, stream_p->read, 0, 0};
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
-    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
-    stack.len = 0;
-    stack.items = NULL;
-    mp_obj_t stack_top = MP_OBJ_NULL;
-    const mp_obj_type_t *stack_top_type = NULL;
-    mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
+STATIC NORETURN void ujson_fail(void) {
+    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+}
+
+enum {
+    UJSON_TOK_EOF,
+    UJSON_TOK_VALUE,
+    UJSON_TOK_START_ARRAY,
+    UJSON_TOK_START_MAP,
+    UJSON_TOK_END_ARRAY,
+    UJSON_TOK_END_MAP,
+};
+
+// Return the next token from the stream, with primitives stored in *value.
+// The stream must already be positioned on the character to look at.
+STATIC int ujson_next_token(ujson_stream_t *s, vstr_t *vstr, mp_obj_t *value) {
     for (;;) {
-    cont:
-        if (S_END(s)) {
-            break;
+        if (S_END(*s)) {
+            return UJSON_TOK_EOF;
         }
-        mp_obj_t next = MP_OBJ_NULL;
-        bool enter = false;
-        byte cur = S_CUR(s);
-        S_NEXT(s);
+        byte cur = S_CUR(*s);
+        S_NEXT(*s);
         switch (cur) {
             case ',':
             case ':':
@@ -173,37 +339,34 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
             case '\t':
             case '\n':
             case '\r':
-                goto cont;
+                continue;
             case 'n':
-                if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
-                    S_NEXT(s);
-                    next = mp_const_none;
-                } else {
-                    goto fail;
+                if (S_CUR(*s) == 'u' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 'l') {
+                    S_NEXT(*s);
+                    *value = mp_const_none;
+                    return UJSON_TOK_VALUE;
                 }
-                break;
+                ujson_fail();
             case 'f':
-                if (S_CUR(s) == 'a' && S_NEXT(s) == 'l' && S_NEXT(s) == 's' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
-                    next = mp_const_false;
-                } else {
-                    goto fail;
+                if (S_CUR(*s) == 'a' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 's' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
+                    *value = mp_const_false;
+                    return UJSON_TOK_VALUE;
                 }
-                break;
+                ujson_fail();
             case 't':
-                if (S_CUR(s) == 'r' && S_NEXT(s) == 'u' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
-                    next = mp_const_true;
-                } else {
-                    goto fail;
+                if (S_CUR(*s) == 'r' && S_NEXT(*s) == 'u' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
+                    *value = mp_const_true;
+                    return UJSON_TOK_VALUE;
                 }
-                break;
+                ujson_fail();
             case '"':
-                vstr_reset(&vstr);
-                for (; !S_END(s) && S_CUR(s) != '"';) {
-                    byte c = S_CUR(s);
+                vstr_reset(vstr);
+                for (; !S_END(*s) && S_CUR(*s) != '"';) {
+                    byte c = S_CUR(*s);
                     if (c == '\\') {
-                        c = S_NEXT(s);
+                        c = S_NEXT(*s);
                         switch (c) {
                             case 'b':
                                 c = 0x08;
@@ -223,27 +386,27 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
                             case 'u': {
                                 mp_uint_t num = 0;
                                 for (int i = 0; i < 4; i++) {
-                                    c = (S_NEXT(s) | 0x20) - '0';
+                                    c = (S_NEXT(*s) | 0x20) - '0';
                                     if (c > 9) {
                                         c -= ('a' - ('9' + 1));
                                     }
                                     num = (num << 4) | c;
                                 }
-                                vstr_add_char(&vstr, num);
+                                vstr_add_char(vstr, num);
                                 goto str_cont;
                             }
                         }
                     }
-                    vstr_add_byte(&vstr, c);
+                    vstr_add_byte(vstr, c);
                 str_cont:
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
-                if (S_END(s)) {
-                    goto fail;
+                if (S_END(*s)) {
+                    ujson_fail();
                 }
-                S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
-                break;
+                S_NEXT(*s);
+                *value = mp_obj_new_str(vstr->buf, vstr->len);
+                return UJSON_TOK_VALUE;
             case '-':
             case '0':
             case '1':
@@ -256,10 +419,10 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
             case '8':
             case '9': {
                 bool flt = false;
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
                 for (;;) {
-                    vstr_add_byte(&vstr, cur);
-                    cur = S_CUR(s);
+                    vstr_add_byte(vstr, cur);
+                    cur = S_CUR(*s);
                     if (cur == '.' || cur == 'E' || cur == 'e') {
                         flt = true;
                     } else if (cur == '+' || cur == '-' || unichar_isdigit(cur)) {
@@ -267,25 +430,56 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
                     } else {
                         break;
                     }
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
                 if (flt) {
-                    next = mp_parse_num_decimal(vstr.buf, vstr.len, false, false, NULL);
+                    *value = mp_parse_num_decimal(vstr->buf, vstr->len, false, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    *value = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
-                break;
+                return UJSON_TOK_VALUE;
             }
             case '[':
+                return UJSON_TOK_START_ARRAY;
+            case '{':
+                return UJSON_TOK_START_MAP;
+            case ']':
+                return UJSON_TOK_END_ARRAY;
+            case '}':
+                return UJSON_TOK_END_MAP;
+            default:
+                ujson_fail();
+        }
+    }
+}
+
+STATIC mp_obj_t ujson_load_from(ujson_stream_t *s) {
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
+    stack.len = 0;
+    stack.items = NULL;
+    mp_obj_t stack_top = MP_OBJ_NULL;
+    const mp_obj_type_t *stack_top_type = NULL;
+    mp_obj_t stack_key = MP_OBJ_NULL;
+    S_NEXT(*s);
+    for (;;) {
+        mp_obj_t next = MP_OBJ_NULL;
+        bool enter = false;
+        switch (ujson_next_token(s, &vstr, &next)) {
+            case UJSON_TOK_EOF:
+                goto success;
+            case UJSON_TOK_VALUE:
+                break;
+            case UJSON_TOK_START_ARRAY:
                 next = mp_obj_new_list(0, NULL);
                 enter = true;
                 break;
-            case '{':
+            case UJSON_TOK_START_MAP:
                 next = mp_obj_new_dict(0);
                 enter = true;
                 break;
-            case '}':
-            case ']': {
+            default: {
                 if (stack_top == MP_OBJ_NULL) {
                     // no object at all
                     goto fail;
@@ -297,10 +491,8 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
                 stack.len -= 1;
                 stack_top = stack.items[stack.len];
                 stack_top_type = mp_obj_get_type(stack_top);
-                goto cont;
+                continue;
             }
-            default:
-                goto fail;
         }
         if (stack_top == MP_OBJ_NULL) {
             stack_top = next;
@@ -338,10 +530,10 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
     }
 success:
     // eat trailing whitespace
-    while (unichar_isspace(S_CUR(s))) {
-        S_NEXT(s);
+    while (unichar_isspace(S_CUR(*s))) {
+        S_NEXT(*s);
     }
-    if (!S_END(s)) {
+    if (!S_END(*s)) {
         // unexpected chars
         goto fail;
     }
@@ -353,25 +545,151 @@ success:
     return stack_top;
 
 fail:
-    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+    ujson_fail();
+}
+
+STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
+    ujson_stream_t s;
+    ujson_stream_init(&s, stream_obj);
+    return ujson_load_from(&s);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_load_obj, mod_ujson_load);
 
 STATIC mp_obj_t mod_ujson_loads(mp_obj_t obj) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(obj, &bufinfo, MP_BUFFER_READ);
-    vstr_t vstr = {bufinfo.len, bufinfo.len, (char *)bufinfo.buf, true};
-    mp_obj_stringio_t sio = {{&mp_type_stringio}, &vstr, 0, MP_OBJ_NULL};
-    return mod_ujson_load(MP_OBJ_FROM_PTR(&sio));
+    // parse straight out of the buffer, no stream is needed
+    ujson_stream_t s;
+    s.stream_obj = MP_OBJ_NULL;
+    s.read = NULL;
+    s.buf = bufinfo.buf;
+    s.len = bufinfo.len;
+    s.pos = 0;
+    s.cur = 0;
+    return ujson_load_from(&s);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_loads_obj, mod_ujson_loads);
 
+#if MICROPY_PY_UJSON_ITERPARSE
+
+// iterparse(stream) yields (event, value) pairs without building the
+// document, so only the current string/number and one byte per nesting
+// level are kept in memory.  The event names follow ijson's basic_parse.
+
+// state of each open container, kept in the nest vstr
+#define NEST_ARRAY 'a'
+#define NEST_MAP_KEY 'k'
+#define NEST_MAP_VALUE 'v'
+
+typedef struct _ujson_iterparse_t {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    ujson_stream_t s;
+    vstr_t vstr;
+    vstr_t nest;
+    bool top_done;
+    bool finished;
+} ujson_iterparse_t;
+
+STATIC mp_obj_t ujson_iterparse_event(qstr event, mp_obj_t value) {
+    mp_obj_t items[2] = { MP_OBJ_NEW_QSTR(event), value };
+    return mp_obj_new_tuple(2, items);
+}
+
+STATIC mp_obj_t ujson_iterparse_iternext(mp_obj_t self_in) {
+    ujson_iterparse_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->finished) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+
+    mp_obj_t value = mp_const_none;
+    int tok = ujson_next_token(&self->s, &self->vstr, &value);
+
+    if (tok == UJSON_TOK_EOF) {
+        if (!self->top_done) {
+            // truncated document
+            ujson_fail();
+        }
+        self->finished = true;
+        vstr_clear(&self->vstr);
+        vstr_clear(&self->nest);
+        return MP_OBJ_STOP_ITERATION;
+    }
+    if (self->top_done) {
+        // unexpected chars after the document
+        ujson_fail();
+    }
+
+    byte *top = self->nest.len == 0 ? NULL : (byte *)&self->nest.buf[self->nest.len - 1];
+    if (top != NULL && *top == NEST_MAP_KEY && tok != UJSON_TOK_END_MAP) {
+        if (tok != UJSON_TOK_VALUE || !mp_obj_is_str(value)) {
+            ujson_fail();
+        }
+        *top = NEST_MAP_VALUE;
+        return ujson_iterparse_event(MP_QSTR_map_key, value);
+    }
+
+    qstr event;
+    switch (tok) {
+        case UJSON_TOK_END_ARRAY:
+        case UJSON_TOK_END_MAP:
+            if (top == NULL || *top != (tok == UJSON_TOK_END_ARRAY ? NEST_ARRAY : NEST_MAP_KEY)) {
+                ujson_fail();
+            }
+            self->nest.len -= 1;
+            event = tok == UJSON_TOK_END_ARRAY ? MP_QSTR_end_array : MP_QSTR_end_map;
+            break;
+        default:
+            if (top != NULL && *top == NEST_MAP_VALUE) {
+                *top = NEST_MAP_KEY;
+            }
+            if (tok == UJSON_TOK_START_ARRAY) {
+                vstr_add_byte(&self->nest, NEST_ARRAY);
+                event = MP_QSTR_start_array;
+            } else if (tok == UJSON_TOK_START_MAP) {
+                vstr_add_byte(&self->nest, NEST_MAP_KEY);
+                event = MP_QSTR_start_map;
+            } else if (value == mp_const_none) {
+                event = MP_QSTR_null;
+            } else if (mp_obj_is_bool(value)) {
+                event = MP_QSTR_boolean;
+            } else if (mp_obj_is_str(value)) {
+                event = MP_QSTR_string;
+            } else {
+                event = MP_QSTR_number;
+            }
+            break;
+    }
+    if (self->nest.len == 0 && tok != UJSON_TOK_START_ARRAY && tok != UJSON_TOK_START_MAP) {
+        self->top_done = true;
+    }
+    return ujson_iterparse_event(event, value);
+}
+
+STATIC mp_obj_t mod_ujson_iterparse(mp_obj_t stream_obj) {
+    ujson_iterparse_t *self = mp_obj_malloc(ujson_iterparse_t, &mp_type_polymorph_iter);
+    self->iternext = ujson_iterparse_iternext;
+    ujson_stream_init(&self->s, stream_obj);
+    vstr_init(&self->vstr, 8);
+    vstr_init(&self->nest, 8);
+    self->top_done = false;
+    self->finished = false;
+    S_NEXT(self->s);
+    return MP_OBJ_FROM_PTR(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_iterparse_obj, mod_ujson_iterparse);
+
+#endif
+
 STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_ujson) },
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_ujson_dump_obj) },
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_ujson_dumps_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_ujson_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_ujson_loads_obj) },
+    #if MICROPY_PY_UJSON_ITERPARSE
+    { MP_ROM_QSTR(MP_QSTR_iterparse), MP_ROM_PTR(&mod_ujson_iterparse_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_ujson_globals, mp_module_ujson_globals_table);
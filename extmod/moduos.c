@@ -150,6 +150,9 @@ STATIC const mp_rom_map_elem_t os_module_globals_table[] = {
     #if MICROPY_PY_UOS_ERRNO
     { MP_ROM_QSTR(MP_QSTR_errno), MP_ROM_PTR(&mp_uos_errno_obj) },
     #endif
+    #if MICROPY_PY_UOS_MMAP
+    { MP_ROM_QSTR(MP_QSTR_mmap), MP_ROM_PTR(&mp_uos_mmap_obj) },
+    #endif
 
     #if MICROPY_VFS
     { MP_ROM_QSTR(MP_QSTR_ilistdir), MP_ROM_PTR(&mp_vfs_ilistdir_obj) },
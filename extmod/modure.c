@@ -41,8 +41,17 @@
 
 #define FLAG_DEBUG 0x1000
 
+#define URE_CACHE (MICROPY_PY_URE_CACHE && !MICROPY_ENABLE_DYNRUNTIME)
+
 typedef struct _mp_obj_re_t {
     mp_obj_base_t base;
+    #if URE_CACHE
+    mp_obj_t pattern;
+    #endif
+    #if MICROPY_PY_URE_ONEPASS
+    char *onepass; // tables for the one-pass matcher, NULL if not usable
+    bool onepass_checked;
+    #endif
     ByteProg re;
 } mp_obj_re_t;
 
@@ -177,14 +186,76 @@ STATIC void re_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t
     mp_printf(print, "<re %p>", self);
 }
 
+// Get the compiled form of a pattern object or string
+STATIC mp_obj_re_t *ure_get_re(mp_obj_t pattern) {
+    if (mp_obj_is_type(pattern, &re_type)) {
+        return MP_OBJ_TO_PTR(pattern);
+    }
+    #if URE_CACHE
+    // Look in the cache, which holds its most recently used patterns first.
+    // Entries are only ever replaced whole, so this is safe to race with.
+    size_t len;
+    const char *str = mp_obj_str_get_data(pattern, &len);
+    mp_obj_t *cache = MP_STATE_VM(ure_cache);
+    mp_obj_re_t *o = NULL;
+    size_t i;
+    for (i = 0; i < MICROPY_PY_URE_CACHE && cache[i] != MP_OBJ_NULL; ++i) {
+        mp_obj_re_t *entry = MP_OBJ_TO_PTR(cache[i]);
+        size_t entry_len;
+        const char *entry_str = mp_obj_str_get_data(entry->pattern, &entry_len);
+        if (entry->pattern == pattern || (entry_len == len && memcmp(entry_str, str, len) == 0)) {
+            o = entry;
+            break;
+        }
+    }
+    if (o == NULL) {
+        o = MP_OBJ_TO_PTR(mod_re_compile(1, &pattern));
+        if (i == MICROPY_PY_URE_CACHE) {
+            --i;
+        }
+    }
+    for (; i > 0; --i) {
+        cache[i] = cache[i - 1];
+    }
+    cache[0] = MP_OBJ_FROM_PTR(o);
+    return o;
+    #else
+    return MP_OBJ_TO_PTR(mod_re_compile(1, &pattern));
+    #endif
+}
+
+// Run the pattern on subj, with the one-pass matcher if it can be used
+STATIC int ure_run(mp_obj_re_t *self, Subject *subj, const char **caps, int caps_num, bool is_anchored) {
+    #if MICROPY_PY_URE_ONEPASS
+    if (!self->onepass_checked) {
+        int size = re1_5_onepass_size(&self->re);
+        char *tables = m_new(char, size);
+        unsigned char *visited = mp_local_alloc((self->re.bytelen + 7) / 8);
+        if (re1_5_onepass_build(&self->re, tables, visited) == 0) {
+            self->onepass = tables;
+        } else {
+            m_del(char, tables, size);
+        }
+        mp_local_free(visited);
+        self->onepass_checked = true;
+    }
+    if (self->onepass != NULL) {
+        const char **scratch = mp_local_alloc(2 * caps_num * sizeof(char *));
+        int res = re1_5_onepassprog(&self->re, self->onepass, subj, caps, caps_num, is_anchored, scratch);
+        // cast is a workaround for a bug in msvc (see below)
+        mp_local_free((char **)scratch);
+        if (res >= 0) {
+            return res;
+        }
+        memset((char **)caps, 0, caps_num * sizeof(char *));
+    }
+    #endif
+    return re1_5_recursiveloopprog(&self->re, subj, caps, caps_num, is_anchored);
+}
+
 STATIC mp_obj_t ure_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     (void)n_args;
-    mp_obj_re_t *self;
-    if (mp_obj_is_type(args[0], &re_type)) {
-        self = MP_OBJ_TO_PTR(args[0]);
-    } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
-    }
+    mp_obj_re_t *self = ure_get_re(args[0]);
     Subject subj;
     size_t len;
     subj.begin_line = subj.begin = mp_obj_str_get_data(args[1], &len);
@@ -193,7 +264,7 @@ STATIC mp_obj_t ure_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     mp_obj_match_t *match = m_new_obj_var(mp_obj_match_t, char *, caps_num);
     // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
     memset((char *)match->caps, 0, caps_num * sizeof(char *));
-    int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, is_anchored);
+    int res = ure_run(self, &subj, match->caps, caps_num, is_anchored);
     if (res == 0) {
         m_del_var(mp_obj_match_t, char *, caps_num, match);
         return mp_const_none;
@@ -234,7 +305,7 @@ STATIC mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
     while (true) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char **)caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, caps, caps_num, false);
+        int res = ure_run(self, &subj, caps, caps_num, false);
 
         // if we didn't have a match, or had an empty match, it's time to stop
         if (!res || caps[0] == caps[1]) {
@@ -263,12 +334,7 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(re_split_obj, 2, 3, re_split);
 #if MICROPY_PY_URE_SUB
 
 STATIC mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
-    mp_obj_re_t *self;
-    if (mp_obj_is_type(args[0], &re_type)) {
-        self = MP_OBJ_TO_PTR(args[0]);
-    } else {
-        self = MP_OBJ_TO_PTR(mod_re_compile(1, args));
-    }
+    mp_obj_re_t *self = ure_get_re(args[0]);
     mp_obj_t replace = args[1];
     mp_obj_t where = args[2];
     mp_int_t count = 0;
@@ -294,7 +360,7 @@ STATIC mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
     for (;;) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char *)match->caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, false);
+        int res = ure_run(self, &subj, match->caps, caps_num, false);
 
         // If we didn't have a match, or had an empty match, it's time to stop
         if (!res || match->caps[0] == match->caps[1]) {
@@ -407,6 +473,13 @@ STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
         goto error;
     }
     mp_obj_re_t *o = mp_obj_malloc_var(mp_obj_re_t, char, size, &re_type);
+    #if URE_CACHE
+    o->pattern = args[0];
+    #endif
+    #if MICROPY_PY_URE_ONEPASS
+    o->onepass = NULL;
+    o->onepass_checked = false;
+    #endif
     #if MICROPY_PY_URE_DEBUG
     int flags = 0;
     if (n_args > 1) {
@@ -459,6 +532,9 @@ MP_REGISTER_MODULE(MP_QSTR_ure, mp_module_ure);
 #include "lib/re1.5/compilecode.c"
 #include "lib/re1.5/recursiveloop.c"
 #include "lib/re1.5/charclass.c"
+#if MICROPY_PY_URE_ONEPASS
+#include "lib/re1.5/onepass.c"
+#endif
 
 #if MICROPY_PY_URE_DEBUG
 // Make sure the output print statements go to the same output as other Python output.
@@ -144,8 +144,9 @@ STATIC mp_obj_t select_select(size_t n_args, const mp_obj_t *args) {
     for (;;) {
         // poll the objects
         mp_uint_t n_ready = poll_map_poll(&poll_map, rwx_len);
+        mp_uint_t elapsed = mp_hal_ticks_ms() - start_tick;
 
-        if (n_ready > 0 || (timeout != (mp_uint_t)-1 && mp_hal_ticks_ms() - start_tick >= timeout)) {
+        if (n_ready > 0 || (timeout != (mp_uint_t)-1 && elapsed >= timeout)) {
             // one or more objects are ready, or we had a timeout
             mp_obj_t list_array[3];
             list_array[0] = mp_obj_new_list(rwx_len[0], NULL);
@@ -170,7 +171,7 @@ STATIC mp_obj_t select_select(size_t n_args, const mp_obj_t *args) {
             mp_map_deinit(&poll_map);
             return mp_obj_new_tuple(3, list_array);
         }
-        MICROPY_EVENT_POLL_HOOK
+        MICROPY_EVENT_POLL_HOOK_TIMEOUT(timeout == (mp_uint_t)-1 ? timeout : timeout - elapsed)
     }
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_select_select_obj, 3, 4, select_select);
@@ -246,10 +247,13 @@ STATIC mp_uint_t poll_poll_internal(uint n_args, const mp_obj_t *args) {
     for (;;) {
         // poll the objects
         n_ready = poll_map_poll(&self->poll_map, NULL);
-        if (n_ready > 0 || (timeout != (mp_uint_t)-1 && mp_hal_ticks_ms() - start_tick >= timeout)) {
+        mp_uint_t elapsed = mp_hal_ticks_ms() - start_tick;
+        if (n_ready > 0 || (timeout != (mp_uint_t)-1 && elapsed >= timeout)) {
             break;
         }
-        MICROPY_EVENT_POLL_HOOK
+        // Nothing is ready, so wait (possibly in a low-power state) until an
+        // event, or the timeout, such as the uasyncio loop's next deadline.
+        MICROPY_EVENT_POLL_HOOK_TIMEOUT(timeout == (mp_uint_t)-1 ? timeout : timeout - elapsed)
     }
 
     return n_ready;
@@ -45,17 +45,78 @@
 #include "mbedtls/ctr_drbg.h"
 #include "mbedtls/debug.h"
 #include "mbedtls/error.h"
+#include "mbedtls/version.h"
 
-typedef struct _mp_obj_ssl_socket_t {
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+#define SSL_HANDSHAKE_IS_OVER(ssl) mbedtls_ssl_is_handshake_over(ssl)
+#else
+#define SSL_HANDSHAKE_IS_OVER(ssl) ((ssl)->state == MBEDTLS_SSL_HANDSHAKE_OVER)
+#endif
+
+// These have the same values as in CPython
+#define PROTOCOL_TLS_CLIENT (16)
+#define PROTOCOL_TLS_SERVER (17)
+
+// Handshake profiles, selected with the profile argument
+#define PROFILE_DEFAULT (0)
+#define PROFILE_ECDSA_P256 (1)
+
+#if defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED) && defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+#define SSL_HAVE_PROFILE_ECDSA_P256
+// ECDHE-ECDSA over P-256 only: on a microcontroller this handshake is much
+// faster than RSA key exchange, and the keys and certificates are smaller.
+STATIC const int ssl_profile_ecdsa_p256_ciphersuites[] = {
+    MBEDTLS_TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,
+    MBEDTLS_TLS_ECDHE_ECDSA_WITH_AES_128_CCM,
+    MBEDTLS_TLS_ECDHE_ECDSA_WITH_AES_128_CBC_SHA256,
+    0
+};
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+STATIC const uint16_t ssl_profile_ecdsa_p256_groups[] = {
+    MBEDTLS_SSL_IANA_TLS_GROUP_SECP256R1,
+    MBEDTLS_SSL_IANA_TLS_GROUP_NONE
+};
+#else
+STATIC const mbedtls_ecp_group_id ssl_profile_ecdsa_p256_curves[] = {
+    MBEDTLS_ECP_DP_SECP256R1,
+    MBEDTLS_ECP_DP_NONE
+};
+#endif
+#endif
+
+// An SSLContext holds everything that can be shared by the sockets it wraps:
+// the RNG, the configuration, parsed certificates and keys, and (client side)
+// the sessions of previous connections, so they can be resumed.
+typedef struct _mp_obj_ssl_context_t {
     mp_obj_base_t base;
-    mp_obj_t sock;
     mbedtls_entropy_context entropy;
     mbedtls_ctr_drbg_context ctr_drbg;
-    mbedtls_ssl_context ssl;
     mbedtls_ssl_config conf;
     mbedtls_x509_crt cacert;
     mbedtls_x509_crt cert;
     mbedtls_pk_context pkey;
+    bool server_side;
+    // cleared once the mbedtls state is freed
+    bool initialised;
+    #if MICROPY_PY_USSL_SESSION_CACHE_SIZE
+    uint8_t session_next;
+    struct {
+        mp_obj_t hostname; // MP_OBJ_NULL if the entry is unused
+        mbedtls_ssl_session session;
+    } sessions[MICROPY_PY_USSL_SESSION_CACHE_SIZE];
+    #endif
+} mp_obj_ssl_context_t;
+
+typedef struct _mp_obj_ssl_socket_t {
+    mp_obj_base_t base;
+    mp_obj_t sock;
+    mp_obj_ssl_context_t *ctx;
+    mbedtls_ssl_context ssl;
+    // server_hostname, used to find and store the session in the cache
+    mp_obj_t hostname;
+    // whether ctx was made just for this socket, and is freed with it
+    bool owns_ctx;
+    bool session_saved;
 } mp_obj_ssl_socket_t;
 
 struct ssl_args {
@@ -64,8 +125,11 @@ struct ssl_args {
     mp_arg_val_t server_side;
     mp_arg_val_t server_hostname;
     mp_arg_val_t do_handshake;
+    mp_arg_val_t profile;
+    mp_arg_val_t max_fragment_length;
 };
 
+STATIC const mp_obj_type_t ussl_context_type;
 STATIC const mp_obj_type_t ussl_socket_type;
 
 #ifdef MBEDTLS_DEBUG_C
@@ -152,92 +216,244 @@ STATIC int _mbedtls_ssl_recv(void *ctx, byte *buf, size_t len) {
 }
 
 
-STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_t sock, struct ssl_args *args) {
-    // Verify the socket object has the full stream protocol
-    mp_get_stream_raise(sock, MP_STREAM_OP_READ | MP_STREAM_OP_WRITE | MP_STREAM_OP_IOCTL);
+STATIC NORETURN void ssl_raise_error(int ret) {
+    if (ret == MBEDTLS_ERR_SSL_ALLOC_FAILED) {
+        mp_raise_OSError(MP_ENOMEM);
+    } else if (ret == MBEDTLS_ERR_PK_BAD_INPUT_DATA) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid key"));
+    } else if (ret == MBEDTLS_ERR_X509_BAD_INPUT_DATA) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid cert"));
+    } else {
+        mbedtls_raise_error(ret);
+    }
+}
+
+STATIC void context_free(mp_obj_ssl_context_t *ctx) {
+    if (!ctx->initialised) {
+        return;
+    }
+    ctx->initialised = false;
+    #if MICROPY_PY_USSL_SESSION_CACHE_SIZE
+    for (size_t i = 0; i < MICROPY_PY_USSL_SESSION_CACHE_SIZE; ++i) {
+        mbedtls_ssl_session_free(&ctx->sessions[i].session);
+        ctx->sessions[i].hostname = MP_OBJ_NULL;
+    }
+    #endif
+    mbedtls_pk_free(&ctx->pkey);
+    mbedtls_x509_crt_free(&ctx->cert);
+    mbedtls_x509_crt_free(&ctx->cacert);
+    mbedtls_ssl_config_free(&ctx->conf);
+    mbedtls_ctr_drbg_free(&ctx->ctr_drbg);
+    mbedtls_entropy_free(&ctx->entropy);
+}
 
+STATIC mp_obj_ssl_context_t *context_new(bool server_side) {
     #if MICROPY_PY_USSL_FINALISER
-    mp_obj_ssl_socket_t *o = m_new_obj_with_finaliser(mp_obj_ssl_socket_t);
+    mp_obj_ssl_context_t *ctx = m_new_obj_with_finaliser(mp_obj_ssl_context_t);
     #else
-    mp_obj_ssl_socket_t *o = m_new_obj(mp_obj_ssl_socket_t);
+    mp_obj_ssl_context_t *ctx = m_new_obj(mp_obj_ssl_context_t);
     #endif
-    o->base.type = &ussl_socket_type;
-    o->sock = sock;
+    ctx->base.type = &ussl_context_type;
+    ctx->server_side = server_side;
+    ctx->initialised = true;
 
     int ret;
-    mbedtls_ssl_init(&o->ssl);
-    mbedtls_ssl_config_init(&o->conf);
-    mbedtls_x509_crt_init(&o->cacert);
-    mbedtls_x509_crt_init(&o->cert);
-    mbedtls_pk_init(&o->pkey);
-    mbedtls_ctr_drbg_init(&o->ctr_drbg);
+    mbedtls_ssl_config_init(&ctx->conf);
+    mbedtls_x509_crt_init(&ctx->cacert);
+    mbedtls_x509_crt_init(&ctx->cert);
+    mbedtls_pk_init(&ctx->pkey);
+    mbedtls_ctr_drbg_init(&ctx->ctr_drbg);
+    #if MICROPY_PY_USSL_SESSION_CACHE_SIZE
+    ctx->session_next = 0;
+    for (size_t i = 0; i < MICROPY_PY_USSL_SESSION_CACHE_SIZE; ++i) {
+        ctx->sessions[i].hostname = MP_OBJ_NULL;
+        mbedtls_ssl_session_init(&ctx->sessions[i].session);
+    }
+    #endif
     #ifdef MBEDTLS_DEBUG_C
     // Debug level (0-4) 1=warning, 2=info, 3=debug, 4=verbose
     mbedtls_debug_set_threshold(0);
     #endif
 
-    mbedtls_entropy_init(&o->entropy);
+    mbedtls_entropy_init(&ctx->entropy);
     const byte seed[] = "upy";
-    ret = mbedtls_ctr_drbg_seed(&o->ctr_drbg, mbedtls_entropy_func, &o->entropy, seed, sizeof(seed));
+    ret = mbedtls_ctr_drbg_seed(&ctx->ctr_drbg, mbedtls_entropy_func, &ctx->entropy, seed, sizeof(seed));
     if (ret != 0) {
         goto cleanup;
     }
 
-    ret = mbedtls_ssl_config_defaults(&o->conf,
-        args->server_side.u_bool ? MBEDTLS_SSL_IS_SERVER : MBEDTLS_SSL_IS_CLIENT,
+    ret = mbedtls_ssl_config_defaults(&ctx->conf,
+        server_side ? MBEDTLS_SSL_IS_SERVER : MBEDTLS_SSL_IS_CLIENT,
         MBEDTLS_SSL_TRANSPORT_STREAM,
         MBEDTLS_SSL_PRESET_DEFAULT);
     if (ret != 0) {
         goto cleanup;
     }
 
-    mbedtls_ssl_conf_authmode(&o->conf, MBEDTLS_SSL_VERIFY_NONE);
-    mbedtls_ssl_conf_rng(&o->conf, mbedtls_ctr_drbg_random, &o->ctr_drbg);
+    mbedtls_ssl_conf_authmode(&ctx->conf, MBEDTLS_SSL_VERIFY_NONE);
+    mbedtls_ssl_conf_rng(&ctx->conf, mbedtls_ctr_drbg_random, &ctx->ctr_drbg);
     #ifdef MBEDTLS_DEBUG_C
-    mbedtls_ssl_conf_dbg(&o->conf, mbedtls_debug, NULL);
+    mbedtls_ssl_conf_dbg(&ctx->conf, mbedtls_debug, NULL);
+    #endif
+    #if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_CLI_C)
+    if (!server_side) {
+        // ask servers for a ticket, so sessions can be resumed without the
+        // server having to keep state
+        mbedtls_ssl_conf_session_tickets(&ctx->conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+    }
     #endif
 
-    ret = mbedtls_ssl_setup(&o->ssl, &o->conf);
+    return ctx;
+
+cleanup:
+    context_free(ctx);
+    ssl_raise_error(ret);
+}
+
+STATIC void context_load_cert_chain(mp_obj_ssl_context_t *ctx, mp_obj_t cert_in, mp_obj_t key_in) {
+    size_t key_len;
+    const byte *key = (const byte *)mp_obj_str_get_data(key_in, &key_len);
+    // len should include terminating null
+    int ret = mbedtls_pk_parse_key(&ctx->pkey, key, key_len + 1, NULL, 0);
     if (ret != 0) {
-        goto cleanup;
+        ssl_raise_error(MBEDTLS_ERR_PK_BAD_INPUT_DATA); // use general error for all key errors
     }
 
-    if (args->server_hostname.u_obj != mp_const_none) {
-        const char *sni = mp_obj_str_get_str(args->server_hostname.u_obj);
-        ret = mbedtls_ssl_set_hostname(&o->ssl, sni);
-        if (ret != 0) {
-            goto cleanup;
-        }
+    size_t cert_len;
+    const byte *cert = (const byte *)mp_obj_str_get_data(cert_in, &cert_len);
+    // len should include terminating null
+    ret = mbedtls_x509_crt_parse(&ctx->cert, cert, cert_len + 1);
+    if (ret != 0) {
+        ssl_raise_error(MBEDTLS_ERR_X509_BAD_INPUT_DATA); // use general error for all cert errors
     }
 
-    mbedtls_ssl_set_bio(&o->ssl, &o->sock, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
+    ret = mbedtls_ssl_conf_own_cert(&ctx->conf, &ctx->cert, &ctx->pkey);
+    if (ret != 0) {
+        ssl_raise_error(ret);
+    }
+}
 
-    if (args->key.u_obj != mp_const_none) {
-        size_t key_len;
-        const byte *key = (const byte *)mp_obj_str_get_data(args->key.u_obj, &key_len);
-        // len should include terminating null
-        ret = mbedtls_pk_parse_key(&o->pkey, key, key_len + 1, NULL, 0);
-        if (ret != 0) {
-            ret = MBEDTLS_ERR_PK_BAD_INPUT_DATA; // use general error for all key errors
-            goto cleanup;
+// Apply the profile and max_fragment_length arguments to the configuration
+// of a new context.
+STATIC void context_configure(mp_obj_ssl_context_t *ctx, mp_int_t profile, mp_obj_t max_frag_len_in) {
+    if (profile == PROFILE_DEFAULT) {
+        // keep all ciphersuites and curves that mbedtls was built with
+    #ifdef SSL_HAVE_PROFILE_ECDSA_P256
+    } else if (profile == PROFILE_ECDSA_P256) {
+        mbedtls_ssl_conf_ciphersuites(&ctx->conf, ssl_profile_ecdsa_p256_ciphersuites);
+        #if MBEDTLS_VERSION_NUMBER >= 0x03000000
+        mbedtls_ssl_conf_groups(&ctx->conf, ssl_profile_ecdsa_p256_groups);
+        #else
+        mbedtls_ssl_conf_curves(&ctx->conf, ssl_profile_ecdsa_p256_curves);
+        #endif
+    #endif
+    } else {
+        mp_raise_ValueError(MP_ERROR_TEXT("profile not supported"));
+    }
+
+    if (max_frag_len_in != mp_const_none) {
+        // Ask the peer to send records of at most this many bytes, which with
+        // MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH also shrinks the record buffers
+        // once the handshake is over.
+        #if defined(MBEDTLS_SSL_MAX_FRAGMENT_LENGTH)
+        mp_int_t len = mp_obj_get_int(max_frag_len_in);
+        unsigned char code = MBEDTLS_SSL_MAX_FRAG_LEN_512;
+        while (code <= MBEDTLS_SSL_MAX_FRAG_LEN_4096 && (256 << code) != len) {
+            ++code;
         }
+        if (code > MBEDTLS_SSL_MAX_FRAG_LEN_4096 || mbedtls_ssl_conf_max_frag_len(&ctx->conf, code) != 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid max_fragment_length"));
+        }
+        #else
+        mp_raise_ValueError(MP_ERROR_TEXT("max_fragment_length not supported"));
+        #endif
+    }
+}
 
-        size_t cert_len;
-        const byte *cert = (const byte *)mp_obj_str_get_data(args->cert.u_obj, &cert_len);
-        // len should include terminating null
-        ret = mbedtls_x509_crt_parse(&o->cert, cert, cert_len + 1);
-        if (ret != 0) {
-            ret = MBEDTLS_ERR_X509_BAD_INPUT_DATA; // use general error for all cert errors
-            goto cleanup;
+#if MICROPY_PY_USSL_SESSION_CACHE_SIZE
+STATIC int context_find_session(mp_obj_ssl_context_t *ctx, mp_obj_t hostname) {
+    for (size_t i = 0; i < MICROPY_PY_USSL_SESSION_CACHE_SIZE; ++i) {
+        if (ctx->sessions[i].hostname != MP_OBJ_NULL && mp_obj_equal(ctx->sessions[i].hostname, hostname)) {
+            return i;
         }
+    }
+    return -1;
+}
+#endif
+
+// Once the handshake of a client socket is over, keep its session in the
+// context so the next connection to the same host can resume it.
+STATIC void socket_save_session(mp_obj_ssl_socket_t *o) {
+    #if MICROPY_PY_USSL_SESSION_CACHE_SIZE
+    mp_obj_ssl_context_t *ctx = o->ctx;
+    if (ctx == NULL || o->session_saved || ctx->server_side || o->hostname == mp_const_none || !SSL_HANDSHAKE_IS_OVER(&o->ssl)) {
+        return;
+    }
+    o->session_saved = true;
 
-        ret = mbedtls_ssl_conf_own_cert(&o->conf, &o->cert, &o->pkey);
+    int i = context_find_session(ctx, o->hostname);
+    if (i < 0) {
+        // replace the entries in turn
+        i = ctx->session_next;
+        ctx->session_next = (i + 1) % MICROPY_PY_USSL_SESSION_CACHE_SIZE;
+    }
+    mbedtls_ssl_session_free(&ctx->sessions[i].session);
+    mbedtls_ssl_session_init(&ctx->sessions[i].session);
+    if (mbedtls_ssl_get_session(&o->ssl, &ctx->sessions[i].session) == 0) {
+        ctx->sessions[i].hostname = o->hostname;
+    } else {
+        ctx->sessions[i].hostname = MP_OBJ_NULL;
+    }
+    #else
+    (void)o;
+    #endif
+}
+
+STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_ssl_context_t *ctx, bool owns_ctx, mp_obj_t sock, mp_obj_t server_hostname, bool do_handshake) {
+    // Verify the socket object has the full stream protocol
+    mp_get_stream_raise(sock, MP_STREAM_OP_READ | MP_STREAM_OP_WRITE | MP_STREAM_OP_IOCTL);
+
+    #if MICROPY_PY_USSL_FINALISER
+    mp_obj_ssl_socket_t *o = m_new_obj_with_finaliser(mp_obj_ssl_socket_t);
+    #else
+    mp_obj_ssl_socket_t *o = m_new_obj(mp_obj_ssl_socket_t);
+    #endif
+    o->base.type = &ussl_socket_type;
+    o->sock = sock;
+    o->ctx = ctx;
+    o->hostname = server_hostname;
+    o->owns_ctx = owns_ctx;
+    o->session_saved = false;
+
+    int ret;
+    mbedtls_ssl_init(&o->ssl);
+
+    ret = mbedtls_ssl_setup(&o->ssl, &ctx->conf);
+    if (ret != 0) {
+        goto cleanup;
+    }
+
+    if (server_hostname != mp_const_none) {
+        const char *sni = mp_obj_str_get_str(server_hostname);
+        ret = mbedtls_ssl_set_hostname(&o->ssl, sni);
         if (ret != 0) {
             goto cleanup;
         }
+
+        #if MICROPY_PY_USSL_SESSION_CACHE_SIZE
+        if (!ctx->server_side) {
+            int i = context_find_session(ctx, server_hostname);
+            if (i >= 0) {
+                // if the server doesn't accept it this is a full handshake
+                mbedtls_ssl_set_session(&o->ssl, &ctx->sessions[i].session);
+            }
+        }
+        #endif
     }
 
-    if (args->do_handshake.u_bool) {
+    mbedtls_ssl_set_bio(&o->ssl, &o->sock, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
+
+    if (do_handshake) {
         while ((ret = mbedtls_ssl_handshake(&o->ssl)) != 0) {
             if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
                 goto cleanup;
@@ -246,28 +462,18 @@ STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_t sock, struct ssl_args *args) {
             MICROPY_EVENT_POLL_HOOK
             #endif
         }
+        socket_save_session(o);
     }
 
     return o;
 
 cleanup:
-    mbedtls_pk_free(&o->pkey);
-    mbedtls_x509_crt_free(&o->cert);
-    mbedtls_x509_crt_free(&o->cacert);
     mbedtls_ssl_free(&o->ssl);
-    mbedtls_ssl_config_free(&o->conf);
-    mbedtls_ctr_drbg_free(&o->ctr_drbg);
-    mbedtls_entropy_free(&o->entropy);
-
-    if (ret == MBEDTLS_ERR_SSL_ALLOC_FAILED) {
-        mp_raise_OSError(MP_ENOMEM);
-    } else if (ret == MBEDTLS_ERR_PK_BAD_INPUT_DATA) {
-        mp_raise_ValueError(MP_ERROR_TEXT("invalid key"));
-    } else if (ret == MBEDTLS_ERR_X509_BAD_INPUT_DATA) {
-        mp_raise_ValueError(MP_ERROR_TEXT("invalid cert"));
-    } else {
-        mbedtls_raise_error(ret);
+    o->ctx = NULL;
+    if (owns_ctx) {
+        context_free(ctx);
     }
+    ssl_raise_error(ret);
 }
 
 STATIC mp_obj_t mod_ssl_getpeercert(mp_obj_t o_in, mp_obj_t binary_form) {
@@ -298,6 +504,8 @@ STATIC mp_uint_t socket_read(mp_obj_t o_in, void *buf, mp_uint_t size, int *errc
         return 0;
     }
     if (ret >= 0) {
+        // a deferred handshake has completed
+        socket_save_session(o);
         return ret;
     }
     if (ret == MBEDTLS_ERR_SSL_WANT_READ) {
@@ -317,6 +525,8 @@ STATIC mp_uint_t socket_write(mp_obj_t o_in, const void *buf, mp_uint_t size, in
 
     int ret = mbedtls_ssl_write(&o->ssl, buf, size);
     if (ret >= 0) {
+        // a deferred handshake has completed
+        socket_save_session(o);
         return ret;
     }
     if (ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
@@ -331,6 +541,34 @@ STATIC mp_uint_t socket_write(mp_obj_t o_in, const void *buf, mp_uint_t size, in
     return MP_STREAM_ERROR;
 }
 
+// Gather the buffers so they are encrypted and sent as a single record.  At
+// most SSL_WRITEV_MAX bytes are taken, the caller writes the rest.
+#define SSL_WRITEV_MAX (4096)
+STATIC mp_uint_t socket_writev(mp_obj_t o_in, const struct mp_stream_writev_t *args, int *errcode) {
+    size_t len = 0;
+    for (size_t i = 0; i < args->iovcnt; ++i) {
+        len += args->iov[i].len;
+    }
+    len = MIN(len, SSL_WRITEV_MAX);
+
+    byte *buf = m_new_maybe(byte, len);
+    if (buf == NULL) {
+        // let the caller fall back to writing the buffers one by one
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < args->iovcnt && n < len; ++i) {
+        size_t l = MIN(args->iov[i].len, len - n);
+        memcpy(buf + n, args->iov[i].buf, l);
+        n += l;
+    }
+
+    mp_uint_t ret = socket_write(o_in, buf, len, errcode);
+    m_del(byte, buf, len);
+    return ret;
+}
+
 STATIC mp_obj_t socket_setblocking(mp_obj_t self_in, mp_obj_t flag_in) {
     mp_obj_ssl_socket_t *o = MP_OBJ_TO_PTR(self_in);
     mp_obj_t sock = o->sock;
@@ -344,13 +582,16 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(socket_setblocking_obj, socket_setblocking);
 STATIC mp_uint_t socket_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     mp_obj_ssl_socket_t *self = MP_OBJ_TO_PTR(o_in);
     if (request == MP_STREAM_CLOSE) {
-        mbedtls_pk_free(&self->pkey);
-        mbedtls_x509_crt_free(&self->cert);
-        mbedtls_x509_crt_free(&self->cacert);
-        mbedtls_ssl_free(&self->ssl);
-        mbedtls_ssl_config_free(&self->conf);
-        mbedtls_ctr_drbg_free(&self->ctr_drbg);
-        mbedtls_entropy_free(&self->entropy);
+        if (self->ctx != NULL) {
+            mbedtls_ssl_free(&self->ssl);
+            if (self->owns_ctx) {
+                context_free(self->ctx);
+            }
+            self->ctx = NULL;
+        }
+    } else if (request == MP_STREAM_WRITEV) {
+        // Must not go down to the underlying socket, the data isn't encrypted
+        return socket_writev(o_in, (const struct mp_stream_writev_t *)arg, errcode);
     }
     // Pass all requests down to the underlying socket
     return mp_get_stream(self->sock)->ioctl(self->sock, request, arg, errcode);
@@ -361,6 +602,7 @@ STATIC const mp_rom_map_elem_t ussl_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writev), MP_ROM_PTR(&mp_stream_writev_obj) },
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&socket_setblocking_obj) },
     { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
     #if MICROPY_PY_USSL_FINALISER
@@ -396,6 +638,8 @@ STATIC mp_obj_t mod_ssl_wrap_socket(size_t n_args, const mp_obj_t *pos_args, mp_
         { MP_QSTR_server_side, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
         { MP_QSTR_server_hostname, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
         { MP_QSTR_do_handshake, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_profile, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = PROFILE_DEFAULT} },
+        { MP_QSTR_max_fragment_length, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
     };
 
     // TODO: Check that sock implements stream protocol
@@ -405,13 +649,129 @@ STATIC mp_obj_t mod_ssl_wrap_socket(size_t n_args, const mp_obj_t *pos_args, mp_
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args,
         MP_ARRAY_SIZE(allowed_args), allowed_args, (mp_arg_val_t *)&args);
 
-    return MP_OBJ_FROM_PTR(socket_new(sock, &args));
+    // Use a context of its own, freed along with the socket
+    mp_obj_ssl_context_t *ctx = context_new(args.server_side.u_bool);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        context_configure(ctx, args.profile.u_int, args.max_fragment_length.u_obj);
+        if (args.key.u_obj != mp_const_none) {
+            context_load_cert_chain(ctx, args.cert.u_obj, args.key.u_obj);
+        }
+        nlr_pop();
+    } else {
+        context_free(ctx);
+        nlr_jump(nlr.ret_val);
+    }
+
+    return MP_OBJ_FROM_PTR(socket_new(ctx, true, sock, args.server_hostname.u_obj, args.do_handshake.u_bool));
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mod_ssl_wrap_socket_obj, 1, mod_ssl_wrap_socket);
 
+/******************************************************************************/
+// SSLContext
+
+STATIC mp_obj_t ssl_context_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_protocol, ARG_profile, ARG_max_fragment_length };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_protocol, MP_ARG_INT, {.u_int = PROTOCOL_TLS_CLIENT} },
+        { MP_QSTR_profile, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = PROFILE_DEFAULT} },
+        { MP_QSTR_max_fragment_length, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t protocol = args[ARG_protocol].u_int;
+    if (protocol != PROTOCOL_TLS_CLIENT && protocol != PROTOCOL_TLS_SERVER) {
+        mp_raise_ValueError(NULL);
+    }
+    mp_obj_ssl_context_t *ctx = context_new(protocol == PROTOCOL_TLS_SERVER);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        context_configure(ctx, args[ARG_profile].u_int, args[ARG_max_fragment_length].u_obj);
+        nlr_pop();
+    } else {
+        context_free(ctx);
+        nlr_jump(nlr.ret_val);
+    }
+    return MP_OBJ_FROM_PTR(ctx);
+}
+
+STATIC mp_obj_t ssl_context_load_cert_chain(mp_obj_t self_in, mp_obj_t cert_in, mp_obj_t key_in) {
+    mp_obj_ssl_context_t *self = MP_OBJ_TO_PTR(self_in);
+    context_load_cert_chain(self, cert_in, key_in);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(ssl_context_load_cert_chain_obj, ssl_context_load_cert_chain);
+
+// Parse the CA certificates once, for all sockets of this context, and
+// require peers to present a certificate signed by one of them.
+STATIC mp_obj_t ssl_context_load_verify_locations(mp_obj_t self_in, mp_obj_t cadata_in) {
+    mp_obj_ssl_context_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t len;
+    const byte *data = (const byte *)mp_obj_str_get_data(cadata_in, &len);
+    // len should include terminating null
+    int ret = mbedtls_x509_crt_parse(&self->cacert, data, len + 1);
+    if (ret != 0) {
+        ssl_raise_error(MBEDTLS_ERR_X509_BAD_INPUT_DATA);
+    }
+    mbedtls_ssl_conf_ca_chain(&self->conf, &self->cacert, NULL);
+    mbedtls_ssl_conf_authmode(&self->conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(ssl_context_load_verify_locations_obj, ssl_context_load_verify_locations);
+
+STATIC mp_obj_t ssl_context_wrap_socket(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_server_hostname, ARG_do_handshake };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_server_hostname, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_do_handshake, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 2, pos_args + 2, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_ssl_context_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_obj_t hostname = args[ARG_server_hostname].u_obj;
+    if (hostname != mp_const_none) {
+        // check the type now, the session cache compares hostnames later
+        mp_obj_str_get_str(hostname);
+    }
+    return MP_OBJ_FROM_PTR(socket_new(self, false, pos_args[1], hostname, args[ARG_do_handshake].u_bool));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(ssl_context_wrap_socket_obj, 2, ssl_context_wrap_socket);
+
+#if MICROPY_PY_USSL_FINALISER
+STATIC mp_obj_t ssl_context_del(mp_obj_t self_in) {
+    context_free(MP_OBJ_TO_PTR(self_in));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ssl_context_del_obj, ssl_context_del);
+#endif
+
+STATIC const mp_rom_map_elem_t ussl_context_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_load_cert_chain), MP_ROM_PTR(&ssl_context_load_cert_chain_obj) },
+    { MP_ROM_QSTR(MP_QSTR_load_verify_locations), MP_ROM_PTR(&ssl_context_load_verify_locations_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wrap_socket), MP_ROM_PTR(&ssl_context_wrap_socket_obj) },
+    #if MICROPY_PY_USSL_FINALISER
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&ssl_context_del_obj) },
+    #endif
+};
+STATIC MP_DEFINE_CONST_DICT(ussl_context_locals_dict, ussl_context_locals_dict_table);
+
+STATIC const mp_obj_type_t ussl_context_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_SSLContext,
+    .make_new = ssl_context_make_new,
+    .locals_dict = (void *)&ussl_context_locals_dict,
+};
+
 STATIC const mp_rom_map_elem_t mp_module_ssl_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_ussl) },
     { MP_ROM_QSTR(MP_QSTR_wrap_socket), MP_ROM_PTR(&mod_ssl_wrap_socket_obj) },
+    { MP_ROM_QSTR(MP_QSTR_SSLContext), MP_ROM_PTR(&ussl_context_type) },
+    { MP_ROM_QSTR(MP_QSTR_PROTOCOL_TLS_CLIENT), MP_ROM_INT(PROTOCOL_TLS_CLIENT) },
+    { MP_ROM_QSTR(MP_QSTR_PROTOCOL_TLS_SERVER), MP_ROM_INT(PROTOCOL_TLS_SERVER) },
+    { MP_ROM_QSTR(MP_QSTR_PROFILE_DEFAULT), MP_ROM_INT(PROFILE_DEFAULT) },
+    { MP_ROM_QSTR(MP_QSTR_PROFILE_ECDSA_P256), MP_ROM_INT(PROFILE_ECDSA_P256) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_ssl_globals, mp_module_ssl_globals_table);
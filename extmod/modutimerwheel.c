@@ -0,0 +1,349 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/mphal.h"
+#include "py/smallint.h"
+
+#if MICROPY_PY_UTIMERWHEEL
+
+// A hierarchical timing wheel: timers are kept in WHEEL_LEVELS levels of
+// WHEEL_SIZE buckets, level n holding timers due within WHEEL_SIZE^(n+1)
+// ticks, in the bucket given by the corresponding bits of their time.  As the
+// wheel turns, each bucket of a higher level is moved down ("cascaded") when
+// the lower levels reach it, and timers arriving in level 0 are due.  Timers
+// due further ahead than the top level can reach wait in it for another turn.
+//
+// Every timer is a slot in a preallocated array, linked into a circular
+// doubly-linked list of slot indices for its bucket, so adding, cancelling
+// and expiring a timer don't allocate and take constant time.
+
+#define MODULO MICROPY_PY_UTIME_TICKS_PERIOD
+#define WHEEL_BITS (6)
+#define WHEEL_SIZE (1 << WHEEL_BITS)
+#define WHEEL_LEVELS (4)
+#define NUM_BUCKETS (WHEEL_LEVELS * WHEEL_SIZE)
+
+// Lists other than the buckets, for entry.list
+#define LIST_EXPIRED (NUM_BUCKETS)
+#define LIST_FREE (NUM_BUCKETS + 1)
+
+#define NONE (0xffff)
+
+// Handles are the slot index in the low 16 bits, and the slot's generation
+// above that, so a stale handle doesn't cancel a later user of the slot.
+#define HANDLE_GEN_MASK (0x3fff)
+
+typedef struct _timerwheel_entry_t {
+    mp_uint_t time;
+    mp_obj_t value;
+    uint16_t next;
+    uint16_t prev;
+    uint16_t list;
+    uint16_t gen;
+} timerwheel_entry_t;
+
+typedef struct _mp_obj_timerwheel_t {
+    mp_obj_base_t base;
+    mp_uint_t now; // time the wheel has turned to
+    uint16_t alloc;
+    uint16_t len; // number of timers added, and not cancelled or returned by expire
+    uint16_t free;
+    uint16_t level_len[WHEEL_LEVELS];
+    uint16_t heads[NUM_BUCKETS + 1]; // the buckets, then the expired list
+    timerwheel_entry_t entries[];
+} mp_obj_timerwheel_t;
+
+STATIC void timerwheel_list_append(mp_obj_timerwheel_t *self, uint16_t list, uint16_t i) {
+    timerwheel_entry_t *e = &self->entries[i];
+    uint16_t head = self->heads[list];
+    e->list = list;
+    if (head == NONE) {
+        e->next = i;
+        e->prev = i;
+        self->heads[list] = i;
+    } else {
+        uint16_t tail = self->entries[head].prev;
+        e->next = head;
+        e->prev = tail;
+        self->entries[tail].next = i;
+        self->entries[head].prev = i;
+    }
+    if (list < NUM_BUCKETS) {
+        self->level_len[list / WHEEL_SIZE] += 1;
+    }
+}
+
+STATIC void timerwheel_list_remove(mp_obj_timerwheel_t *self, uint16_t i) {
+    timerwheel_entry_t *e = &self->entries[i];
+    if (e->next == i) {
+        self->heads[e->list] = NONE;
+    } else {
+        self->entries[e->prev].next = e->next;
+        self->entries[e->next].prev = e->prev;
+        if (self->heads[e->list] == i) {
+            self->heads[e->list] = e->next;
+        }
+    }
+    if (e->list < NUM_BUCKETS) {
+        self->level_len[e->list / WHEEL_SIZE] -= 1;
+    }
+}
+
+// Put a timer in the bucket for its time, or in the expired list if it's due.
+STATIC void timerwheel_place(mp_obj_timerwheel_t *self, uint16_t i) {
+    mp_uint_t time = self->entries[i].time;
+    mp_uint_t delta = (time - self->now) & (MODULO - 1);
+    if (delta == 0 || delta >= MODULO / 2) {
+        timerwheel_list_append(self, LIST_EXPIRED, i);
+        return;
+    }
+    unsigned int level = 0;
+    while (level < WHEEL_LEVELS - 1 && delta >= (mp_uint_t)1 << (WHEEL_BITS * (level + 1))) {
+        ++level;
+    }
+    unsigned int bucket = (time >> (WHEEL_BITS * level)) & (WHEEL_SIZE - 1);
+    timerwheel_list_append(self, level * WHEEL_SIZE + bucket, i);
+}
+
+// Process the time the wheel has just turned to: cascade the buckets of the
+// levels that have come round to it, down to level 0 whose timers are now due.
+STATIC void timerwheel_tick(mp_obj_timerwheel_t *self) {
+    for (int level = WHEEL_LEVELS - 1; level >= 0; --level) {
+        unsigned int shift = WHEEL_BITS * level;
+        if ((self->now & (((mp_uint_t)1 << shift) - 1)) != 0) {
+            continue;
+        }
+        uint16_t list = level * WHEEL_SIZE + ((self->now >> shift) & (WHEEL_SIZE - 1));
+        uint16_t i = self->heads[list];
+        if (i == NONE) {
+            continue;
+        }
+        // Detach the bucket's list and place each of its timers again
+        self->heads[list] = NONE;
+        uint16_t first = i;
+        do {
+            uint16_t next = self->entries[i].next;
+            self->level_len[level] -= 1;
+            timerwheel_place(self, i);
+            i = next;
+        } while (i != first);
+    }
+}
+
+// Turn the wheel forward to the given time.
+STATIC void timerwheel_advance(mp_obj_timerwheel_t *self, mp_uint_t target) {
+    for (;;) {
+        mp_uint_t remaining = (target - self->now) & (MODULO - 1);
+        if (remaining == 0 || remaining >= MODULO / 2) {
+            // the wheel never turns backwards
+            return;
+        }
+        // Nothing happens until the next boundary of the lowest level with
+        // any timers, so go straight there
+        unsigned int level = 0;
+        while (level < WHEEL_LEVELS && self->level_len[level] == 0) {
+            ++level;
+        }
+        mp_uint_t skip = remaining;
+        if (level < WHEEL_LEVELS) {
+            mp_uint_t span = (mp_uint_t)1 << (WHEEL_BITS * level);
+            skip = MIN(remaining, span - (self->now & (span - 1)));
+        }
+        self->now = (self->now + skip) & (MODULO - 1);
+        timerwheel_tick(self);
+    }
+}
+
+STATIC void timerwheel_free(mp_obj_timerwheel_t *self, uint16_t i) {
+    timerwheel_entry_t *e = &self->entries[i];
+    e->value = MP_OBJ_NULL; // so we don't retain a pointer
+    e->gen += 1;
+    e->list = LIST_FREE;
+    e->next = self->free;
+    self->free = i;
+    self->len -= 1;
+}
+
+STATIC mp_obj_t timerwheel_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    mp_int_t alloc = mp_obj_get_int(args[0]);
+    if (alloc <= 0 || alloc >= NONE) {
+        mp_raise_ValueError(NULL);
+    }
+    mp_obj_timerwheel_t *o = mp_obj_malloc_var(mp_obj_timerwheel_t, timerwheel_entry_t, alloc, type);
+    o->now = mp_hal_ticks_ms() & (MODULO - 1);
+    o->alloc = alloc;
+    o->len = 0;
+    memset(o->level_len, 0, sizeof(o->level_len));
+    memset(o->heads, 0xff, sizeof(o->heads));
+    for (mp_int_t i = 0; i < alloc; ++i) {
+        o->entries[i].value = MP_OBJ_NULL;
+        o->entries[i].gen = 0;
+        o->entries[i].list = LIST_FREE;
+        o->entries[i].next = i + 1 < alloc ? i + 1 : NONE;
+    }
+    o->free = 0;
+    return MP_OBJ_FROM_PTR(o);
+}
+
+STATIC mp_obj_t timerwheel_add(mp_obj_t self_in, mp_obj_t time_in, mp_obj_t value) {
+    mp_obj_timerwheel_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->free == NONE) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("queue overflow"));
+    }
+    if (self->len == 0) {
+        // Nothing is relying on where the wheel has got to, so bring it up to
+        // date in case expire() hasn't been called for a long time
+        self->now = mp_hal_ticks_ms() & (MODULO - 1);
+    }
+    uint16_t i = self->free;
+    timerwheel_entry_t *e = &self->entries[i];
+    self->free = e->next;
+    self->len += 1;
+    e->time = mp_obj_get_int_truncated(time_in) & (MODULO - 1);
+    e->value = value;
+    timerwheel_place(self, i);
+    return MP_OBJ_NEW_SMALL_INT((mp_uint_t)(e->gen & HANDLE_GEN_MASK) << 16 | i);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(timerwheel_add_obj, timerwheel_add);
+
+STATIC mp_obj_t timerwheel_cancel(mp_obj_t self_in, mp_obj_t handle_in) {
+    mp_obj_timerwheel_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_uint_t handle = mp_obj_get_int_truncated(handle_in);
+    mp_uint_t i = handle & 0xffff;
+    if (i >= self->alloc) {
+        return mp_const_false;
+    }
+    timerwheel_entry_t *e = &self->entries[i];
+    if (e->list == LIST_FREE || (e->gen & HANDLE_GEN_MASK) != ((handle >> 16) & HANDLE_GEN_MASK)) {
+        // already expired or cancelled
+        return mp_const_false;
+    }
+    timerwheel_list_remove(self, i);
+    timerwheel_free(self, i);
+    return mp_const_true;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(timerwheel_cancel_obj, timerwheel_cancel);
+
+STATIC mp_obj_t timerwheel_expire(mp_obj_t self_in, mp_obj_t now_in) {
+    mp_obj_timerwheel_t *self = MP_OBJ_TO_PTR(self_in);
+    timerwheel_advance(self, mp_obj_get_int_truncated(now_in) & (MODULO - 1));
+    uint16_t i = self->heads[LIST_EXPIRED];
+    if (i == NONE) {
+        return mp_const_none;
+    }
+    mp_obj_t value = self->entries[i].value;
+    timerwheel_list_remove(self, i);
+    timerwheel_free(self, i);
+    return value;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(timerwheel_expire_obj, timerwheel_expire);
+
+STATIC mp_obj_t timerwheel_peektime(mp_obj_t self_in) {
+    mp_obj_timerwheel_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->len == 0) {
+        mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("empty heap"));
+    }
+    uint16_t i = self->heads[LIST_EXPIRED];
+    if (i != NONE) {
+        return MP_OBJ_NEW_SMALL_INT(self->entries[i].time);
+    }
+    // The earliest timer of each level is in the first non-empty bucket
+    // after the current one, except that timers waiting in the top level for
+    // another turn may come first, so carry on past buckets holding only those.
+    mp_uint_t best = MODULO;
+    for (unsigned int level = 0; level < WHEEL_LEVELS; ++level) {
+        if (self->level_len[level] == 0) {
+            continue;
+        }
+        unsigned int shift = WHEEL_BITS * level;
+        mp_uint_t reach = (mp_uint_t)1 << (shift + WHEEL_BITS);
+        unsigned int cur = (self->now >> shift) & (WHEEL_SIZE - 1);
+        mp_uint_t level_best = MODULO;
+        for (unsigned int k = 1; k <= WHEEL_SIZE && level_best >= reach; ++k) {
+            i = self->heads[level * WHEEL_SIZE + ((cur + k) & (WHEEL_SIZE - 1))];
+            if (i == NONE) {
+                continue;
+            }
+            uint16_t first = i;
+            do {
+                level_best = MIN(level_best, (self->entries[i].time - self->now) & (MODULO - 1));
+                i = self->entries[i].next;
+            } while (i != first);
+        }
+        best = MIN(best, level_best);
+    }
+    return MP_OBJ_NEW_SMALL_INT((self->now + best) & (MODULO - 1));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(timerwheel_peektime_obj, timerwheel_peektime);
+
+STATIC mp_obj_t timerwheel_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
+    mp_obj_timerwheel_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (op) {
+        case MP_UNARY_OP_BOOL:
+            return mp_obj_new_bool(self->len != 0);
+        case MP_UNARY_OP_LEN:
+            return MP_OBJ_NEW_SMALL_INT(self->len);
+        default:
+            return MP_OBJ_NULL;      // op not supported
+    }
+}
+
+STATIC const mp_rom_map_elem_t timerwheel_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&timerwheel_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cancel), MP_ROM_PTR(&timerwheel_cancel_obj) },
+    { MP_ROM_QSTR(MP_QSTR_expire), MP_ROM_PTR(&timerwheel_expire_obj) },
+    { MP_ROM_QSTR(MP_QSTR_peektime), MP_ROM_PTR(&timerwheel_peektime_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(timerwheel_locals_dict, timerwheel_locals_dict_table);
+
+STATIC const mp_obj_type_t timerwheel_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_utimerwheel,
+    .make_new = timerwheel_make_new,
+    .unary_op = timerwheel_unary_op,
+    .locals_dict = (void *)&timerwheel_locals_dict,
+};
+
+STATIC const mp_rom_map_elem_t mp_module_utimerwheel_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_utimerwheel) },
+    { MP_ROM_QSTR(MP_QSTR_utimerwheel), MP_ROM_PTR(&timerwheel_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(mp_module_utimerwheel_globals, mp_module_utimerwheel_globals_table);
+
+const mp_obj_module_t mp_module_utimerwheel = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&mp_module_utimerwheel_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_utimerwheel, mp_module_utimerwheel);
+
+#endif // MICROPY_PY_UTIMERWHEEL
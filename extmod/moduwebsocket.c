@@ -47,7 +47,7 @@ typedef struct _mp_obj_websocket_t {
     byte to_recv;
     byte mask_pos;
     byte buf_pos;
-    byte buf[6];
+    byte buf[12];
     byte opts;
     // Copy of last data frame flags
     byte ws_flags;
@@ -73,6 +73,35 @@ STATIC mp_obj_t websocket_make_new(const mp_obj_type_t *type, size_t n_args, siz
     return MP_OBJ_FROM_PTR(o);
 }
 
+// Unmask received payload in place, a machine word at a time where possible.
+STATIC void websocket_unmask(mp_obj_websocket_t *self, byte *p, size_t sz) {
+    uint32_t mask32;
+    memcpy(&mask32, self->mask, sizeof(mask32));
+    if (mask32 == 0) {
+        // unmasked frame
+        return;
+    }
+    for (; sz > 0 && ((uintptr_t)p & (sizeof(mp_uint_t) - 1)) != 0; --sz) {
+        *p++ ^= self->mask[self->mask_pos++ & 3];
+    }
+    if (sz >= sizeof(mp_uint_t)) {
+        // Mask rotated to line up with the aligned words, and repeated to
+        // fill a word (a whole number of masks, so the rotation is kept)
+        byte m[sizeof(mp_uint_t)];
+        for (size_t i = 0; i < sizeof(m); ++i) {
+            m[i] = self->mask[(self->mask_pos + i) & 3];
+        }
+        mp_uint_t mask_word;
+        memcpy(&mask_word, m, sizeof(mask_word));
+        for (; sz >= sizeof(mp_uint_t); sz -= sizeof(mp_uint_t), p += sizeof(mp_uint_t)) {
+            *(mp_uint_t *)p ^= mask_word;
+        }
+    }
+    for (; sz > 0; --sz) {
+        *p++ ^= self->mask[self->mask_pos++ & 3];
+    }
+}
+
 STATIC mp_uint_t websocket_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
     mp_obj_websocket_t *self = MP_OBJ_TO_PTR(self_in);
     const mp_stream_p_t *stream_p = mp_get_stream(self->sock);
@@ -120,7 +149,7 @@ STATIC mp_uint_t websocket_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
                     to_recv += 2;
                 } else if (sz == 127) {
                     // Msg size is next 8 bytes
-                    assert(0);
+                    to_recv += 8;
                 }
                 if (self->buf[1] & 0x80) {
                     // Next 4 bytes is mask
@@ -143,11 +172,17 @@ STATIC mp_uint_t websocket_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
             }
 
             case FRAME_OPT: {
+                // Options are 2 or 8 bytes of message length, then optionally
+                // 4 bytes of mask, so the total tells which are present
                 if ((self->buf_pos & 3) == 2) {
                     // First two bytes are message length
                     self->msg_sz = (self->buf[0] << 8) | self->buf[1];
+                } else if (self->buf_pos >= 8) {
+                    // First eight bytes are message length, only the low 32
+                    // bits of which are kept
+                    self->msg_sz = (uint32_t)self->buf[4] << 24 | self->buf[5] << 16 | self->buf[6] << 8 | self->buf[7];
                 }
-                if (self->buf_pos >= 4) {
+                if (self->buf_pos != 2 && self->buf_pos != 8) {
                     // Last 4 bytes is mask
                     memcpy(self->mask, self->buf + self->buf_pos - 4, 4);
                 }
@@ -174,10 +209,7 @@ STATIC mp_uint_t websocket_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
                     return out_sz;
                 }
 
-                sz = out_sz;
-                for (byte *p = buf; sz--; p++) {
-                    *p ^= self->mask[self->mask_pos++ & 3];
-                }
+                websocket_unmask(self, buf, out_sz);
 
                 self->msg_sz -= out_sz;
                 if (self->msg_sz == 0) {
@@ -217,17 +249,24 @@ STATIC mp_uint_t websocket_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
 
 STATIC mp_uint_t websocket_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
     mp_obj_websocket_t *self = MP_OBJ_TO_PTR(self_in);
-    assert(size < 0x10000);
-    byte header[4] = {0x80 | (self->opts & FRAME_OPCODE_MASK)};
+    byte header[10] = {0x80 | (self->opts & FRAME_OPCODE_MASK)};
     int hdr_sz;
     if (size < 126) {
         header[1] = size;
         hdr_sz = 2;
-    } else {
+    } else if (size < 0x10000) {
         header[1] = 126;
         header[2] = size >> 8;
         header[3] = size & 0xff;
         hdr_sz = 4;
+    } else {
+        // 64-bit length, of which the top 32 bits are zero
+        header[1] = 127;
+        header[6] = (uint32_t)size >> 24;
+        header[7] = size >> 16;
+        header[8] = size >> 8;
+        header[9] = size & 0xff;
+        hdr_sz = 10;
     }
 
     mp_obj_t dest[3];
@@ -237,9 +276,20 @@ STATIC mp_uint_t websocket_write(mp_obj_t self_in, const void *buf, mp_uint_t si
         mp_call_method_n_kw(1, 0, dest);
     }
 
-    mp_uint_t out_sz = mp_stream_write_exactly(self->sock, header, hdr_sz, errcode);
-    if (*errcode == 0) {
-        out_sz = mp_stream_write_exactly(self->sock, buf, size, errcode);
+    mp_uint_t out_sz;
+    if (size < 126) {
+        // Send a short frame with a single write, so the header doesn't go
+        // out in a small segment of its own
+        byte frame[2 + 125];
+        memcpy(frame, header, 2);
+        memcpy(frame + 2, buf, size);
+        out_sz = mp_stream_write_exactly(self->sock, frame, 2 + size, errcode);
+        out_sz = out_sz < 2 ? 0 : out_sz - 2;
+    } else {
+        out_sz = mp_stream_write_exactly(self->sock, header, hdr_sz, errcode);
+        if (*errcode == 0) {
+            out_sz = mp_stream_write_exactly(self->sock, buf, size, errcode);
+        }
     }
 
     if (self->opts & BLOCKING_WRITE) {
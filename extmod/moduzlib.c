@@ -33,6 +33,7 @@
 
 #if MICROPY_PY_UZLIB
 
+#define UZLIB_CONF_LUT_BITS (MICROPY_PY_UZLIB_LUT_BITS)
 #include "lib/uzlib/tinf.h"
 
 #if 0 // print debugging info
@@ -45,6 +46,8 @@ typedef struct _mp_obj_decompio_t {
     mp_obj_base_t base;
     mp_obj_t src_stream;
     TINF_DATA decomp;
+    byte *src_buf; // optional read-ahead buffer for the source stream
+    size_t src_buf_size;
     bool eof;
 } mp_obj_decompio_t;
 
@@ -56,25 +59,41 @@ STATIC int read_src_stream(TINF_DATA *data) {
     const mp_stream_p_t *stream = mp_get_stream(self->src_stream);
     int err;
     byte c;
-    mp_uint_t out_sz = stream->read(self->src_stream, &c, 1, &err);
+    byte *buf = self->src_buf ? self->src_buf : &c;
+    mp_uint_t out_sz = stream->read(self->src_stream, buf, self->src_buf ? self->src_buf_size : 1, &err);
     if (out_sz == MP_STREAM_ERROR) {
         mp_raise_OSError(err);
     }
     if (out_sz == 0) {
         mp_raise_type(&mp_type_EOFError);
     }
-    return c;
+    // Remaining bytes are taken from the buffer by uzlib before calling again
+    data->source = buf + 1;
+    data->source_limit = buf + out_sz;
+    return buf[0];
 }
 
 STATIC mp_obj_t decompio_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-    mp_arg_check_num(n_args, n_kw, 1, 2, false);
+    mp_arg_check_num(n_args, n_kw, 1, 3, false);
     mp_get_stream_raise(args[0], MP_STREAM_OP_READ);
     mp_obj_decompio_t *o = mp_obj_malloc(mp_obj_decompio_t, type);
     memset(&o->decomp, 0, sizeof(o->decomp));
     o->decomp.readSource = read_src_stream;
     o->src_stream = args[0];
+    o->src_buf = NULL;
+    o->src_buf_size = 0;
     o->eof = false;
 
+    // With a read-ahead buffer the source is read in blocks, which is much
+    // faster but may consume bytes past the end of the compressed data
+    if (n_args > 2) {
+        mp_int_t bufsize = mp_obj_get_int(args[2]);
+        if (bufsize > 0) {
+            o->src_buf = m_new(byte, bufsize);
+            o->src_buf_size = bufsize;
+        }
+    }
+
     mp_int_t dict_opt = 0;
     uint dict_sz;
     if (n_args > 1) {
@@ -189,11 +208,13 @@ STATIC mp_obj_t mod_uzlib_decompress(size_t n_args, const mp_obj_t *args) {
         if (st == TINF_DONE) {
             break;
         }
+        // Grow the output geometrically so large inputs aren't recopied often
         size_t offset = decomp->dest - dest_buf;
-        dest_buf = m_renew(byte, dest_buf, dest_buf_size, dest_buf_size + 256);
-        dest_buf_size += 256;
+        size_t grow = dest_buf_size / 2 < 256 ? 256 : dest_buf_size / 2;
+        dest_buf = m_renew(byte, dest_buf, dest_buf_size, dest_buf_size + grow);
+        dest_buf_size += grow;
         decomp->dest = dest_buf + offset;
-        decomp->dest_limit = decomp->dest + 256;
+        decomp->dest_limit = dest_buf + dest_buf_size;
     }
 
     mp_uint_t final_sz = decomp->dest - dest_buf;
@@ -208,11 +229,396 @@ error:
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_uzlib_decompress_obj, 1, 3, mod_uzlib_decompress);
 
+#if MICROPY_PY_UZLIB_COMPRESS && !MICROPY_ENABLE_DYNRUNTIME
+
+// Streaming compressor: greedy LZ77 over a sliding window, with hash chains
+// whose depth is set by the level, coded with the static Huffman codes.
+// Memory use is 2 * window for the input, plus window and hash table heads
+// as uint16_t, so a 1k window (wbits=10) needs about 5k.
+
+#define DEFL_MIN_MATCH (3)
+#define DEFL_MAX_MATCH (258)
+
+enum {
+    DEFL_FORMAT_RAW,
+    DEFL_FORMAT_ZLIB,
+    DEFL_FORMAT_GZIP,
+};
+
+// values follow zlib
+#define DEFL_Z_SYNC_FLUSH (2)
+#define DEFL_Z_FINISH (4)
+
+typedef struct _defl_t {
+    struct Outbuf out;
+    byte *win; // 2 * wsize bytes of input, the older half being history
+    uint16_t *head; // latest position for each hash, 0 for none
+    uint16_t *prev; // previous position with the same hash, per position
+    uint32_t pos; // next byte of win to encode
+    uint32_t end; // end of valid data in win
+    uint32_t checksum;
+    uint32_t total_in;
+    uint16_t wsize;
+    uint16_t max_chain;
+    uint8_t hash_bits;
+    uint8_t format;
+    bool finished;
+} defl_t;
+
+STATIC void defl_reserve(defl_t *d, size_t n) {
+    if ((size_t)(d->out.outsize - d->out.outlen) < n) {
+        size_t new_size = d->out.outlen + n;
+        d->out.outbuf = m_renew(byte, d->out.outbuf, d->out.outsize, new_size);
+        d->out.outsize = new_size;
+    }
+}
+
+STATIC void defl_put_byte(defl_t *d, byte b) {
+    outbits(&d->out, b, 8);
+}
+
+STATIC void defl_put_uint32(defl_t *d, uint32_t v, bool big_endian) {
+    for (int i = 0; i < 4; ++i) {
+        defl_put_byte(d, big_endian ? v >> (24 - 8 * i) : v >> (8 * i));
+    }
+}
+
+STATIC void defl_init(defl_t *d, mp_int_t level, mp_int_t wbits) {
+    if (level == -1) {
+        level = 6;
+    }
+    if (level < 0 || level > 9) {
+        mp_raise_ValueError(MP_ERROR_TEXT("level"));
+    }
+    mp_int_t window_bits = wbits;
+    if (wbits >= 9 && wbits <= 15) {
+        d->format = DEFL_FORMAT_ZLIB;
+    } else if (wbits >= -15 && wbits <= -9) {
+        d->format = DEFL_FORMAT_RAW;
+        window_bits = -wbits;
+    } else if (wbits >= 16 + 9 && wbits <= 16 + 15) {
+        d->format = DEFL_FORMAT_GZIP;
+        window_bits = wbits - 16;
+    } else {
+        mp_raise_ValueError(MP_ERROR_TEXT("wbits"));
+    }
+
+    memset(&d->out, 0, sizeof(d->out));
+    d->wsize = 1 << window_bits;
+    d->max_chain = level == 0 ? 0 : 1 << (level - 1);
+    d->hash_bits = MIN(window_bits - 1, 12);
+    d->win = m_new(byte, 2 * d->wsize);
+    d->head = m_new0(uint16_t, 1 << d->hash_bits);
+    d->prev = m_new(uint16_t, d->wsize);
+    d->pos = 0;
+    d->end = 0;
+    d->total_in = 0;
+    d->finished = false;
+
+    defl_reserve(d, 16);
+    if (d->format == DEFL_FORMAT_ZLIB) {
+        d->checksum = 1;
+        // RFC 1950: CINFO is the log2 of the window size minus 8, FLEVEL
+        // is informational, and the header must be a multiple of 31
+        uint cmf = (window_bits - 8) << 4 | 8;
+        uint flg = (level < 2 ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3) << 6;
+        flg += 31 - (cmf << 8 | flg) % 31;
+        defl_put_byte(d, cmf);
+        defl_put_byte(d, flg);
+    } else if (d->format == DEFL_FORMAT_GZIP) {
+        d->checksum = 0xffffffff;
+        // RFC 1952: magic, CM=deflate, no flags, no mtime, XFL=0, OS=unknown
+        static const byte gzip_header[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff };
+        for (size_t i = 0; i < sizeof(gzip_header); ++i) {
+            defl_put_byte(d, gzip_header[i]);
+        }
+    }
+    zlib_start_block(&d->out);
+}
+
+static inline uint defl_hash(defl_t *d, const byte *p) {
+    return ((p[0] << 16 | p[1] << 8 | p[2]) * 2654435761u) >> (32 - d->hash_bits);
+}
+
+// Insert position pos into the hash chains, returning the previous head.
+static inline uint defl_insert(defl_t *d, uint32_t pos) {
+    uint h = defl_hash(d, d->win + pos);
+    uint cand = d->head[h];
+    d->prev[pos & (d->wsize - 1)] = cand;
+    d->head[h] = pos;
+    return cand;
+}
+
+// Encode the buffered input, keeping DEFL_MAX_MATCH bytes of lookahead
+// unless all of it must be flushed.
+STATIC void defl_process(defl_t *d, bool flush) {
+    const byte *win = d->win;
+    uint32_t pos = d->pos;
+    uint32_t end = d->end;
+    uint32_t limit = flush ? end : (end > DEFL_MAX_MATCH ? end - DEFL_MAX_MATCH : 0);
+    while (pos < limit) {
+        uint32_t avail = end - pos;
+        uint best_len = 0;
+        uint best_dist = 0;
+        if (avail >= DEFL_MIN_MATCH) {
+            uint cand = defl_insert(d, pos);
+            uint max_len = MIN(avail, DEFL_MAX_MATCH);
+            for (uint chain = d->max_chain; cand != 0 && chain != 0; --chain) {
+                uint dist = pos - cand;
+                if (cand >= pos || dist >= d->wsize) {
+                    break;
+                }
+                if (win[cand + best_len] == win[pos + best_len]) {
+                    uint len = 0;
+                    while (len < max_len && win[cand + len] == win[pos + len]) {
+                        ++len;
+                    }
+                    if (len > best_len) {
+                        best_len = len;
+                        best_dist = dist;
+                        if (len == max_len) {
+                            break;
+                        }
+                    }
+                }
+                uint next = d->prev[cand & (d->wsize - 1)];
+                if (next >= cand) {
+                    break;
+                }
+                cand = next;
+            }
+        }
+        if (best_len >= DEFL_MIN_MATCH) {
+            zlib_match(&d->out, best_dist, best_len);
+            for (uint i = 1; i < best_len; ++i) {
+                if (end - (pos + i) >= DEFL_MIN_MATCH) {
+                    defl_insert(d, pos + i);
+                }
+            }
+            pos += best_len;
+        } else {
+            zlib_literal(&d->out, win[pos]);
+            pos += 1;
+        }
+    }
+    d->pos = pos;
+}
+
+STATIC void defl_slide(defl_t *d) {
+    uint wsize = d->wsize;
+    memmove(d->win, d->win + wsize, wsize);
+    d->pos -= wsize;
+    d->end -= wsize;
+    // position 0 doubles as "none", so it is never used as a match
+    for (size_t i = 0; i < (1u << d->hash_bits); ++i) {
+        d->head[i] = d->head[i] >= wsize ? d->head[i] - wsize : 0;
+    }
+    for (size_t i = 0; i < wsize; ++i) {
+        d->prev[i] = d->prev[i] >= wsize ? d->prev[i] - wsize : 0;
+    }
+}
+
+// Write out and discard the pending output, if there's somewhere to put it.
+STATIC void defl_drain(defl_t *d, mp_obj_t dest_stream) {
+    if (dest_stream != MP_OBJ_NULL && d->out.outlen != 0) {
+        mp_stream_write(dest_stream, d->out.outbuf, d->out.outlen, MP_STREAM_RW_WRITE);
+        d->out.outlen = 0;
+    }
+}
+
+STATIC void defl_write(defl_t *d, const byte *data, size_t len, mp_obj_t dest_stream) {
+    if (d->finished) {
+        mp_raise_ValueError(MP_ERROR_TEXT("finished"));
+    }
+    if (d->format == DEFL_FORMAT_ZLIB) {
+        d->checksum = uzlib_adler32(data, len, d->checksum);
+    } else if (d->format == DEFL_FORMAT_GZIP) {
+        d->checksum = uzlib_crc32(data, len, d->checksum);
+    }
+    d->total_in += len;
+    while (len != 0) {
+        if (d->end == 2u * d->wsize) {
+            defl_slide(d);
+        }
+        size_t n = MIN(len, 2u * d->wsize - d->end);
+        memcpy(d->win + d->end, data, n);
+        d->end += n;
+        data += n;
+        len -= n;
+        // at most 9 bits per byte with the static codes
+        defl_reserve(d, (d->end - d->pos) * 9 / 8 + 16);
+        defl_process(d, false);
+        defl_drain(d, dest_stream);
+    }
+}
+
+STATIC void defl_flush(defl_t *d, mp_int_t mode, mp_obj_t dest_stream) {
+    if (d->finished) {
+        mp_raise_ValueError(MP_ERROR_TEXT("finished"));
+    }
+    defl_reserve(d, (d->end - d->pos) * 9 / 8 + 32);
+    defl_process(d, true);
+    zlib_finish_block(&d->out);
+    if (mode == DEFL_Z_FINISH) {
+        // an empty final block, then the trailer on a byte boundary
+        outbits(&d->out, 1, 1);
+        outbits(&d->out, 1, 2);
+        zlib_finish_block(&d->out);
+        if (d->out.noutbits != 0) {
+            outbits(&d->out, 0, 8 - d->out.noutbits);
+        }
+        if (d->format == DEFL_FORMAT_ZLIB) {
+            defl_put_uint32(d, d->checksum, true);
+        } else if (d->format == DEFL_FORMAT_GZIP) {
+            defl_put_uint32(d, d->checksum ^ 0xffffffff, false);
+            defl_put_uint32(d, d->total_in, false);
+        }
+        d->finished = true;
+    } else {
+        // sync flush: an empty stored block brings the output to a byte
+        // boundary, so everything so far can be decompressed
+        outbits(&d->out, 0, 3);
+        if (d->out.noutbits != 0) {
+            outbits(&d->out, 0, 8 - d->out.noutbits);
+        }
+        outbits(&d->out, 0x0000, 16);
+        outbits(&d->out, 0xffff, 16);
+        zlib_start_block(&d->out);
+    }
+    defl_drain(d, dest_stream);
+}
+
+STATIC mp_obj_t defl_take_output(defl_t *d) {
+    mp_obj_t ret = mp_obj_new_bytes(d->out.outbuf, d->out.outlen);
+    d->out.outlen = 0;
+    return ret;
+}
+
+typedef struct _mp_obj_compobj_t {
+    mp_obj_base_t base;
+    defl_t defl;
+} mp_obj_compobj_t;
+
+STATIC const mp_obj_type_t compobj_type;
+
+STATIC mp_obj_t mod_uzlib_compressobj(size_t n_args, const mp_obj_t *args) {
+    mp_obj_compobj_t *o = mp_obj_malloc(mp_obj_compobj_t, &compobj_type);
+    defl_init(&o->defl, n_args > 0 ? mp_obj_get_int(args[0]) : -1,
+        n_args > 1 ? mp_obj_get_int(args[1]) : MICROPY_PY_UZLIB_COMPRESS_WBITS);
+    return MP_OBJ_FROM_PTR(o);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_uzlib_compressobj_obj, 0, 2, mod_uzlib_compressobj);
+
+STATIC mp_obj_t compobj_compress(mp_obj_t self_in, mp_obj_t data_in) {
+    mp_obj_compobj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+    defl_write(&self->defl, bufinfo.buf, bufinfo.len, MP_OBJ_NULL);
+    return defl_take_output(&self->defl);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(compobj_compress_obj, compobj_compress);
+
+STATIC mp_obj_t compobj_flush(size_t n_args, const mp_obj_t *args) {
+    mp_obj_compobj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_int_t mode = n_args > 1 ? mp_obj_get_int(args[1]) : DEFL_Z_FINISH;
+    defl_flush(&self->defl, mode, MP_OBJ_NULL);
+    return defl_take_output(&self->defl);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(compobj_flush_obj, 1, 2, compobj_flush);
+
+STATIC const mp_rom_map_elem_t compobj_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_compress), MP_ROM_PTR(&compobj_compress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&compobj_flush_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(compobj_locals_dict, compobj_locals_dict_table);
+
+STATIC const mp_obj_type_t compobj_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Compress,
+    .locals_dict = (void *)&compobj_locals_dict,
+};
+
+typedef struct _mp_obj_compio_t {
+    mp_obj_base_t base;
+    mp_obj_t dest_stream;
+    defl_t defl;
+} mp_obj_compio_t;
+
+STATIC mp_obj_t compio_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 3, false);
+    mp_get_stream_raise(args[0], MP_STREAM_OP_WRITE);
+    mp_obj_compio_t *o = mp_obj_malloc(mp_obj_compio_t, type);
+    o->dest_stream = args[0];
+    defl_init(&o->defl, n_args > 1 ? mp_obj_get_int(args[1]) : -1,
+        n_args > 2 ? mp_obj_get_int(args[2]) : MICROPY_PY_UZLIB_COMPRESS_WBITS);
+    defl_drain(&o->defl, o->dest_stream);
+    return MP_OBJ_FROM_PTR(o);
+}
+
+STATIC mp_uint_t compio_write(mp_obj_t o_in, const void *buf, mp_uint_t size, int *errcode) {
+    mp_obj_compio_t *o = MP_OBJ_TO_PTR(o_in);
+    defl_write(&o->defl, buf, size, o->dest_stream);
+    return size;
+}
+
+STATIC mp_uint_t compio_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    mp_obj_compio_t *o = MP_OBJ_TO_PTR(o_in);
+    if (request == MP_STREAM_FLUSH) {
+        defl_flush(&o->defl, DEFL_Z_SYNC_FLUSH, o->dest_stream);
+        return 0;
+    } else if (request == MP_STREAM_CLOSE) {
+        // finish the compressed stream, but leave the underlying one open
+        if (!o->defl.finished) {
+            defl_flush(&o->defl, DEFL_Z_FINISH, o->dest_stream);
+        }
+        return 0;
+    } else {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+}
+
+STATIC mp_obj_t compio___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    return mp_stream_close(args[0]);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(compio___exit___obj, 4, 4, compio___exit__);
+
+STATIC const mp_rom_map_elem_t compio_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&mp_stream_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&compio___exit___obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(compio_locals_dict, compio_locals_dict_table);
+
+STATIC const mp_stream_p_t compio_stream_p = {
+    .write = compio_write,
+    .ioctl = compio_ioctl,
+};
+
+STATIC const mp_obj_type_t compio_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_CompIO,
+    .make_new = compio_make_new,
+    .protocol = &compio_stream_p,
+    .locals_dict = (void *)&compio_locals_dict,
+};
+
+#endif // MICROPY_PY_UZLIB_COMPRESS && !MICROPY_ENABLE_DYNRUNTIME
+
 #if !MICROPY_ENABLE_DYNRUNTIME
 STATIC const mp_rom_map_elem_t mp_module_uzlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uzlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&mod_uzlib_decompress_obj) },
     { MP_ROM_QSTR(MP_QSTR_DecompIO), MP_ROM_PTR(&decompio_type) },
+    #if MICROPY_PY_UZLIB_COMPRESS
+    { MP_ROM_QSTR(MP_QSTR_compressobj), MP_ROM_PTR(&mod_uzlib_compressobj_obj) },
+    { MP_ROM_QSTR(MP_QSTR_CompIO), MP_ROM_PTR(&compio_type) },
+    { MP_ROM_QSTR(MP_QSTR_Z_SYNC_FLUSH), MP_ROM_INT(DEFL_Z_SYNC_FLUSH) },
+    { MP_ROM_QSTR(MP_QSTR_Z_FINISH), MP_ROM_INT(DEFL_Z_FINISH) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_uzlib_globals, mp_module_uzlib_globals_table);
@@ -234,5 +640,8 @@ MP_REGISTER_MODULE(MP_QSTR_uzlib, mp_module_uzlib);
 #include "lib/uzlib/tinfgzip.c"
 #include "lib/uzlib/adler32.c"
 #include "lib/uzlib/crc32.c"
+#if MICROPY_PY_UZLIB_COMPRESS && !MICROPY_ENABLE_DYNRUNTIME
+#include "lib/uzlib/defl_static.c"
+#endif
 
 #endif // MICROPY_PY_UZLIB
@@ -44,6 +44,19 @@
 #define DEBUG_printf(...) (void)0
 #endif
 
+// Size of the buffer used for file transfers in bulk mode.  It is allocated
+// on the heap for the duration of the transfer, and for GET_FILE is also the
+// size of each chunk sent (less the 2-byte length prefix).
+#ifndef MICROPY_PY_WEBREPL_BULK_BUF_SIZE
+#define MICROPY_PY_WEBREPL_BULK_BUF_SIZE (4096)
+#endif
+
+// Number of GET_FILE chunks that may be in flight, not yet acknowledged by
+// the client, in bulk mode.
+#ifndef MICROPY_PY_WEBREPL_BULK_WINDOW
+#define MICROPY_PY_WEBREPL_BULK_WINDOW (4)
+#endif
+
 struct webrepl_file {
     char sig[2];
     char type;
@@ -55,6 +68,16 @@ struct webrepl_file {
 } __attribute__((packed));
 
 enum { PUT_FILE = 1, GET_FILE, GET_VER };
+
+// Flags in webrepl_file.flags.  With WEBREPL_FLAG_BULK a client asks for a
+// file operation in bulk mode.  If that is granted, the high byte of the
+// response code to the request is the window: for GET_FILE, the number of
+// chunks the device sends ahead of the client's acknowledgements (one zero
+// byte per chunk, as for the initial request).  A response code of 0 means
+// the operation goes ahead in the basic mode, with a window of 1.  PUT_FILE
+// uses the same stream of data in both modes, in bulk mode written to the
+// file in larger blocks.
+enum { WEBREPL_FLAG_BULK = 0x01 };
 enum { STATE_PASSWD, STATE_NORMAL };
 
 typedef struct _mp_obj_webrepl_t {
@@ -65,6 +88,9 @@ typedef struct _mp_obj_webrepl_t {
     uint32_t data_to_recv;
     struct webrepl_file hdr;
     mp_obj_t cur_file;
+    byte *filebuf;
+    byte window;
+    bool eof;
 } mp_obj_webrepl_t;
 
 STATIC const char passwd_prompt[] = "Password: ";
@@ -101,6 +127,7 @@ STATIC mp_obj_t webrepl_make_new(const mp_obj_type_t *type, size_t n_args, size_
     o->sock = args[0];
     o->hdr_to_recv = sizeof(struct webrepl_file);
     o->data_to_recv = 0;
+    o->filebuf = NULL;
     o->state = STATE_PASSWD;
     write_webrepl_str(args[0], SSTR(passwd_prompt));
     return MP_OBJ_FROM_PTR(o);
@@ -109,6 +136,10 @@ STATIC mp_obj_t webrepl_make_new(const mp_obj_type_t *type, size_t n_args, size_
 STATIC void check_file_op_finished(mp_obj_webrepl_t *self) {
     if (self->data_to_recv == 0) {
         mp_stream_close(self->cur_file);
+        if (self->filebuf != NULL) {
+            m_del(byte, self->filebuf, MICROPY_PY_WEBREPL_BULK_BUF_SIZE);
+            self->filebuf = NULL;
+        }
         self->hdr_to_recv = sizeof(struct webrepl_file);
         DEBUG_printf("webrepl: Finished file operation %d\n", self->hdr.type);
         write_webrepl_resp(self->sock, 0);
@@ -117,9 +148,15 @@ STATIC void check_file_op_finished(mp_obj_webrepl_t *self) {
 
 STATIC int write_file_chunk(mp_obj_webrepl_t *self) {
     const mp_stream_p_t *file_stream = mp_get_stream(self->cur_file);
-    byte readbuf[2 + 256];
+    byte basic_readbuf[2 + 256];
+    byte *readbuf = basic_readbuf;
+    size_t readbuf_sz = sizeof(basic_readbuf);
+    if (self->filebuf != NULL) {
+        readbuf = self->filebuf;
+        readbuf_sz = MICROPY_PY_WEBREPL_BULK_BUF_SIZE;
+    }
     int err;
-    mp_uint_t out_sz = file_stream->read(self->cur_file, readbuf + 2, sizeof(readbuf) - 2, &err);
+    mp_uint_t out_sz = file_stream->read(self->cur_file, readbuf + 2, readbuf_sz - 2, &err);
     if (out_sz == MP_STREAM_ERROR) {
         return out_sz;
     }
@@ -163,12 +200,23 @@ STATIC void handle_op(mp_obj_webrepl_t *self) {
     assert(res != MP_STREAM_ERROR);
     #endif
 
-    write_webrepl_resp(self->sock, 0);
+    // Bulk mode needs a transfer buffer; without one the basic mode is used
+    self->window = 0;
+    self->eof = false;
+    if (self->hdr.flags & WEBREPL_FLAG_BULK) {
+        self->filebuf = m_new_maybe(byte, MICROPY_PY_WEBREPL_BULK_BUF_SIZE);
+        if (self->filebuf != NULL) {
+            self->window = MICROPY_PY_WEBREPL_BULK_WINDOW;
+        }
+    }
+
+    write_webrepl_resp(self->sock, self->window << 8);
 
     if (self->hdr.type == PUT_FILE) {
         self->data_to_recv = self->hdr.size;
         check_file_op_finished(self);
     } else if (self->hdr.type == GET_FILE) {
+        // The client's request for the first chunk counts as an acknowledgement
         self->data_to_recv = 1;
     }
 }
@@ -243,39 +291,60 @@ STATIC mp_uint_t _webrepl_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
         return -2;
     }
 
-    if (self->data_to_recv != 0) {
+    if (self->data_to_recv != 0 && self->hdr.type == GET_FILE) {
+        // Each byte received acknowledges a chunk, so more chunks can be
+        // sent until the window is full again or the end of file is reached
+        assert(*(byte *)buf == 0);
+        --self->data_to_recv;
+        while (!self->eof && self->data_to_recv < MAX(1, self->window)) {
+            mp_uint_t out_sz = write_file_chunk(self);
+            if (out_sz == 0) {
+                self->eof = true;
+            } else {
+                self->data_to_recv++;
+            }
+        }
+
+        check_file_op_finished(self);
+    } else if (self->data_to_recv != 0) {
         // Ports that don't have much available stack can make this filebuf static
         #if MICROPY_PY_WEBREPL_STATIC_FILEBUF
         static
         #endif
-        byte filebuf[512];
+        byte basic_filebuf[512];
+        byte *filebuf = basic_filebuf;
+        size_t filebuf_sz = sizeof(basic_filebuf);
+        if (self->filebuf != NULL) {
+            filebuf = self->filebuf;
+            filebuf_sz = MICROPY_PY_WEBREPL_BULK_BUF_SIZE;
+        }
         filebuf[0] = *(byte *)buf;
         mp_uint_t buf_sz = 1;
-        if (--self->data_to_recv != 0) {
-            size_t to_read = MIN(sizeof(filebuf) - 1, self->data_to_recv);
-            mp_uint_t sz = sock_stream->read(self->sock, filebuf + 1, to_read, errcode);
+        --self->data_to_recv;
+
+        // Take all the data that is already available, up to the size of the
+        // buffer, so the file is written in as few blocks as possible
+        while (self->data_to_recv != 0 && buf_sz < filebuf_sz) {
+            size_t to_read = MIN(filebuf_sz - buf_sz, self->data_to_recv);
+            mp_uint_t sz = sock_stream->read(self->sock, filebuf + buf_sz, to_read, errcode);
             if (sz == MP_STREAM_ERROR) {
+                if (mp_is_nonblocking_error(*errcode)) {
+                    break;
+                }
                 return sz;
             }
+            if (sz == 0) {
+                break;
+            }
             self->data_to_recv -= sz;
             buf_sz += sz;
         }
 
-        if (self->hdr.type == PUT_FILE) {
-            DEBUG_printf("webrepl: Writing %lu bytes to file\n", buf_sz);
-            int err;
-            mp_uint_t res = mp_stream_write_exactly(self->cur_file, filebuf, buf_sz, &err);
-            if (err != 0 || res != buf_sz) {
-                assert(0);
-            }
-        } else if (self->hdr.type == GET_FILE) {
-            assert(buf_sz == 1);
-            assert(self->data_to_recv == 0);
-            assert(filebuf[0] == 0);
-            mp_uint_t out_sz = write_file_chunk(self);
-            if (out_sz != 0) {
-                self->data_to_recv = 1;
-            }
+        DEBUG_printf("webrepl: Writing %lu bytes to file\n", buf_sz);
+        int err;
+        mp_uint_t res = mp_stream_write_exactly(self->cur_file, filebuf, buf_sz, &err);
+        if (err != 0 || res != buf_sz) {
+            assert(0);
         }
 
         check_file_op_finished(self);
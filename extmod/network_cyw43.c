@@ -28,6 +28,7 @@
 #include <string.h>
 #include "py/runtime.h"
 #include "py/objstr.h"
+#include "py/mperrno.h"
 #include "py/mphal.h"
 
 #if MICROPY_PY_NETWORK_CYW43
@@ -46,6 +47,19 @@ typedef struct _network_cyw43_obj_t {
 STATIC const network_cyw43_obj_t network_cyw43_wl_sta = { { &mp_network_cyw43_type }, &cyw43_state, CYW43_ITF_STA };
 STATIC const network_cyw43_obj_t network_cyw43_wl_ap = { { &mp_network_cyw43_type }, &cyw43_state, CYW43_ITF_AP };
 
+// Events for the handler given to WLAN.irq()
+#define NETWORK_CYW43_IRQ_SCAN_DONE (0x0001)
+#define NETWORK_CYW43_IRQ_STATUS (0x0002)
+
+// Events that call the handler given to WLAN.irq()
+STATIC uint16_t network_cyw43_irq_trigger;
+
+// STA link status last passed to the handler
+STATIC int network_cyw43_irq_status;
+
+// Time the scan started by scan_async() began
+STATIC mp_uint_t network_cyw43_scan_start_ms;
+
 STATIC void network_cyw43_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     network_cyw43_obj_t *self = MP_OBJ_TO_PTR(self_in);
     struct netif *netif = &self->cyw->netif[self->itf];
@@ -162,7 +176,7 @@ STATIC int network_cyw43_scan_cb(void *env, const cyw43_ev_scan_result_t *res) {
     return 0; // continue scan
 }
 
-STATIC mp_obj_t network_cyw43_scan(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+STATIC mp_obj_t network_cyw43_scan_start(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_passive, ARG_essid, ARG_bssid };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_passive, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
@@ -199,6 +213,13 @@ STATIC mp_obj_t network_cyw43_scan(size_t n_args, const mp_obj_t *pos_args, mp_m
         mp_raise_OSError(-scan_res);
     }
 
+    return res;
+}
+
+STATIC mp_obj_t network_cyw43_scan(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    network_cyw43_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_obj_t res = network_cyw43_scan_start(n_args, pos_args, kw_args);
+
     // Wait for scan to finish, with a 10s timeout
     uint32_t start = mp_hal_ticks_ms();
     while (cyw43_wifi_scan_active(self->cyw) && mp_hal_ticks_ms() - start < 10000) {
@@ -209,6 +230,19 @@ STATIC mp_obj_t network_cyw43_scan(size_t n_args, const mp_obj_t *pos_args, mp_m
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(network_cyw43_scan_obj, 1, network_cyw43_scan);
 
+STATIC void network_cyw43_irq_poll_schedule(void);
+
+STATIC mp_obj_t network_cyw43_scan_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    if (MP_STATE_PORT(network_cyw43_scan_list) != MP_OBJ_NULL) {
+        mp_raise_OSError(MP_EBUSY);
+    }
+    MP_STATE_PORT(network_cyw43_scan_list) = network_cyw43_scan_start(n_args, pos_args, kw_args);
+    network_cyw43_scan_start_ms = mp_hal_ticks_ms();
+    network_cyw43_irq_poll_schedule();
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(network_cyw43_scan_async_obj, 1, network_cyw43_scan_async);
+
 STATIC mp_obj_t network_cyw43_connect(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_essid, ARG_key, ARG_auth, ARG_bssid, ARG_channel };
     static const mp_arg_t allowed_args[] = {
@@ -242,6 +276,8 @@ STATIC mp_obj_t network_cyw43_connect(size_t n_args, const mp_obj_t *pos_args, m
     if (ret != 0) {
         mp_raise_OSError(-ret);
     }
+    // Follow the join to report its progress to the irq handler
+    network_cyw43_irq_poll_schedule();
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(network_cyw43_connect_obj, 1, network_cyw43_connect);
@@ -299,6 +335,117 @@ STATIC mp_obj_t network_cyw43_status(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(network_cyw43_status_obj, 1, 2, network_cyw43_status);
 
+/*******************************************************************************/
+// events
+
+STATIC void network_cyw43_irq_call(uint16_t event, mp_obj_t data) {
+    mp_obj_t handler = MP_STATE_PORT(network_cyw43_irq_handler);
+    if (handler != MP_OBJ_NULL && (network_cyw43_irq_trigger & event)) {
+        mp_call_function_2(handler, MP_OBJ_NEW_SMALL_INT(event), data);
+    }
+}
+
+// Runs from the scheduler, and schedules itself again while a scan started by
+// scan_async() is running or the STA interface is joining a network, to pass
+// their outcome to the irq handler.
+STATIC mp_obj_t network_cyw43_irq_poll(mp_obj_t self_in) {
+    network_cyw43_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    bool again = false;
+
+    mp_obj_t list = MP_STATE_PORT(network_cyw43_scan_list);
+    if (list != MP_OBJ_NULL) {
+        if (cyw43_wifi_scan_active(self->cyw) && mp_hal_ticks_ms() - network_cyw43_scan_start_ms < 10000) {
+            again = true;
+        } else {
+            MP_STATE_PORT(network_cyw43_scan_list) = MP_OBJ_NULL;
+            network_cyw43_irq_call(NETWORK_CYW43_IRQ_SCAN_DONE, list);
+        }
+    }
+
+    if (network_cyw43_irq_trigger & NETWORK_CYW43_IRQ_STATUS) {
+        int status = cyw43_tcpip_link_status(self->cyw, self->itf);
+        if (status != network_cyw43_irq_status) {
+            network_cyw43_irq_status = status;
+            network_cyw43_irq_call(NETWORK_CYW43_IRQ_STATUS, MP_OBJ_NEW_SMALL_INT(status));
+        }
+        if (status == CYW43_LINK_JOIN || status == CYW43_LINK_NOIP) {
+            again = true;
+        }
+    }
+
+    if (again) {
+        network_cyw43_irq_poll_schedule();
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(network_cyw43_irq_poll_obj, network_cyw43_irq_poll);
+
+STATIC void network_cyw43_irq_poll_schedule(void) {
+    mp_sched_schedule_ex(MP_OBJ_FROM_PTR(&network_cyw43_irq_poll_obj), MP_OBJ_FROM_PTR(&network_cyw43_wl_sta), MP_SCHED_COALESCE);
+}
+
+#if LWIP_NETIF_EXT_STATUS_CALLBACK
+// Called by lwIP when the link goes up or down or the address changes, such as
+// when the connection to the access point is lost.
+STATIC void network_cyw43_netif_cb(struct netif *netif, netif_nsc_reason_t reason, const netif_ext_callback_args_t *args) {
+    (void)reason;
+    (void)args;
+    if (netif == &cyw43_state.netif[CYW43_ITF_STA] && (network_cyw43_irq_trigger & NETWORK_CYW43_IRQ_STATUS)) {
+        network_cyw43_irq_poll_schedule();
+    }
+}
+NETIF_DECLARE_EXT_CALLBACK(network_cyw43_netif_ext_cb)
+#endif
+
+STATIC mp_obj_t network_cyw43_irq(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_handler, ARG_trigger };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_handler, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_trigger, MP_ARG_INT, {.u_int = NETWORK_CYW43_IRQ_SCAN_DONE | NETWORK_CYW43_IRQ_STATUS} },
+    };
+    network_cyw43_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (self->itf != CYW43_ITF_STA) {
+        mp_raise_ValueError(MP_ERROR_TEXT("STA required"));
+    }
+
+    #if LWIP_NETIF_EXT_STATUS_CALLBACK
+    static bool netif_cb_added = false;
+    if (!netif_cb_added) {
+        netif_add_ext_callback(&network_cyw43_netif_ext_cb, network_cyw43_netif_cb);
+        netif_cb_added = true;
+    }
+    #endif
+
+    if (args[ARG_handler].u_obj == mp_const_none) {
+        network_cyw43_irq_trigger = 0;
+        MP_STATE_PORT(network_cyw43_irq_handler) = MP_OBJ_NULL;
+    } else {
+        network_cyw43_irq_status = cyw43_tcpip_link_status(self->cyw, self->itf);
+        network_cyw43_irq_trigger = args[ARG_trigger].u_int;
+        MP_STATE_PORT(network_cyw43_irq_handler) = args[ARG_handler].u_obj;
+        network_cyw43_irq_poll_schedule();
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(network_cyw43_irq_obj, 1, network_cyw43_irq);
+
+void network_cyw43_irq_deinit(void) {
+    // The handler and scan results are on the heap, which doesn't survive a soft reset
+    network_cyw43_irq_trigger = 0;
+    MP_STATE_PORT(network_cyw43_irq_handler) = MP_OBJ_NULL;
+    if (MP_STATE_PORT(network_cyw43_scan_list) != MP_OBJ_NULL) {
+        // Stop the driver passing more results to the list
+        cyw43_state.wifi_scan_state = 0;
+        MP_STATE_PORT(network_cyw43_scan_list) = MP_OBJ_NULL;
+    }
+}
+
+/*******************************************************************************/
+// config
+
 static inline uint32_t nw_get_le32(const uint8_t *buf) {
     return buf[0] | buf[1] << 8 | buf[2] << 16 | buf[3] << 24;
 }
@@ -440,12 +587,17 @@ STATIC const mp_rom_map_elem_t network_cyw43_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&network_cyw43_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_active), MP_ROM_PTR(&network_cyw43_active_obj) },
     { MP_ROM_QSTR(MP_QSTR_scan), MP_ROM_PTR(&network_cyw43_scan_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scan_async), MP_ROM_PTR(&network_cyw43_scan_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_irq), MP_ROM_PTR(&network_cyw43_irq_obj) },
     { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&network_cyw43_connect_obj) },
     { MP_ROM_QSTR(MP_QSTR_disconnect), MP_ROM_PTR(&network_cyw43_disconnect_obj) },
     { MP_ROM_QSTR(MP_QSTR_isconnected), MP_ROM_PTR(&network_cyw43_isconnected_obj) },
     { MP_ROM_QSTR(MP_QSTR_ifconfig), MP_ROM_PTR(&network_cyw43_ifconfig_obj) },
     { MP_ROM_QSTR(MP_QSTR_status), MP_ROM_PTR(&network_cyw43_status_obj) },
     { MP_ROM_QSTR(MP_QSTR_config), MP_ROM_PTR(&network_cyw43_config_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_IRQ_SCAN_DONE), MP_ROM_INT(NETWORK_CYW43_IRQ_SCAN_DONE) },
+    { MP_ROM_QSTR(MP_QSTR_IRQ_STATUS), MP_ROM_INT(NETWORK_CYW43_IRQ_STATUS) },
 };
 STATIC MP_DEFINE_CONST_DICT(network_cyw43_locals_dict, network_cyw43_locals_dict_table);
 
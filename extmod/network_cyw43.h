@@ -28,4 +28,6 @@
 
 extern const mp_obj_type_t mp_network_cyw43_type;
 
+void network_cyw43_irq_deinit(void);
+
 #endif // MICROPY_INCLUDED_EXTMOD_NETWORK_CYW43_H
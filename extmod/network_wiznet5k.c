@@ -246,24 +246,85 @@ STATIC void wiznet5k_send_ethernet(wiznet5k_obj_t *self, size_t len, const uint8
     }
 }
 
-// Stores the frame in self->eth_frame and returns number of bytes in the frame, 0 for no frame
-STATIC uint16_t wiznet5k_recv_ethernet(wiznet5k_obj_t *self) {
-    uint16_t len = getSn_RX_RSR(0);
-    if (len == 0) {
-        return 0;
+// Issue a command to the MACRAW socket and wait for the chip to accept it.
+STATIC void wiznet5k_socket_command(uint8_t cmd) {
+    setSn_CR(0, cmd);
+    while (getSn_CR(0)) {
     }
+}
 
-    byte ip[4];
-    uint16_t port;
-    int ret = WIZCHIP_EXPORT(recvfrom)(0, self->eth_frame, 1514, ip, &port);
-    if (ret <= 0) {
-        printf("wiznet5k_recv_ethernet: fatal error len=%u ret=%d\n", len, ret);
-        netif_set_link_down(&self->netif);
-        netif_set_down(&self->netif);
-        return 0;
+STATIC void wiznet5k_fatal_error(wiznet5k_obj_t *self, const char *where, int err) {
+    printf("wiznet5k_%s: fatal error %d\n", where, err);
+    netif_set_link_down(&self->netif);
+    netif_set_down(&self->netif);
+}
+
+// Reads all frames that are waiting in the MACRAW socket and passes them to lwIP.
+// Each frame is preceded by a 2-byte length (which counts itself) and its data is
+// burst-read straight into a pbuf chain.  The chip's RX buffer space is released
+// with a single RECV command once all frames are consumed.
+// Returns the number of bytes consumed, 0 if there were no frames.
+STATIC uint16_t wiznet5k_recv_ethernet(wiznet5k_obj_t *self) {
+    uint16_t avail = getSn_RX_RSR(0);
+    uint16_t remain = avail;
+    while (remain >= 2) {
+        uint8_t head[2];
+        wiz_recv_data(0, head, 2);
+        uint16_t len = head[0] << 8 | head[1];
+        if (len <= 2 || len > remain) {
+            wiznet5k_fatal_error(self, "recv_ethernet", len);
+            return 0;
+        }
+        remain -= len;
+        len -= 2;
+
+        struct pbuf *p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+        if (p == NULL) {
+            wiz_recv_ignore(0, len);
+            continue;
+        }
+        for (struct pbuf *q = p; q != NULL; q = q->next) {
+            wiz_recv_data(0, q->payload, q->len);
+        }
+        if (self->trace_flags & TRACE_ETH_RX) {
+            len = pbuf_copy_partial(p, self->eth_frame, sizeof(self->eth_frame), 0);
+            netutils_ethernet_trace(MP_PYTHON_PRINTER, len, self->eth_frame, NETUTILS_TRACE_NEWLINE);
+        }
+        if (self->netif.input(p, &self->netif) != ERR_OK) {
+            pbuf_free(p);
+        }
     }
+    if (avail) {
+        wiznet5k_socket_command(Sn_CR_RECV);
+    }
+    return avail;
+}
 
-    return ret;
+// Burst-writes each segment of the pbuf chain into the chip's TX buffer and sends
+// it as one frame, without gathering it in a contiguous buffer first.
+STATIC void wiznet5k_send_pbuf(wiznet5k_obj_t *self, struct pbuf *p) {
+    while (getSn_TX_FSR(0) < p->tot_len) {
+        if (getSn_SR(0) != SOCK_MACRAW) {
+            wiznet5k_fatal_error(self, "send_pbuf", getSn_SR(0));
+            return;
+        }
+    }
+    for (struct pbuf *q = p; q != NULL; q = q->next) {
+        wiz_send_data(0, q->payload, q->len);
+    }
+    wiznet5k_socket_command(Sn_CR_SEND);
+    for (;;) {
+        uint8_t ir = getSn_IR(0);
+        if (ir & Sn_IR_SENDOK) {
+            setSn_IR(0, Sn_IR_SENDOK);
+            break;
+        }
+        if (ir & Sn_IR_TIMEOUT) {
+            setSn_IR(0, Sn_IR_TIMEOUT);
+            wiznet5k_fatal_error(self, "send_pbuf", SOCKERR_TIMEOUT);
+            break;
+        }
+    }
 }
 
 /*******************************************************************************/
@@ -271,11 +332,11 @@ STATIC uint16_t wiznet5k_recv_ethernet(wiznet5k_obj_t *self) {
 
 STATIC err_t wiznet5k_netif_output(struct netif *netif, struct pbuf *p) {
     wiznet5k_obj_t *self = netif->state;
-    pbuf_copy_partial(p, self->eth_frame, p->tot_len, 0);
     if (self->trace_flags & TRACE_ETH_TX) {
+        pbuf_copy_partial(p, self->eth_frame, p->tot_len, 0);
         netutils_ethernet_trace(MP_PYTHON_PRINTER, p->tot_len, self->eth_frame, NETUTILS_TRACE_IS_TX | NETUTILS_TRACE_NEWLINE);
     }
-    wiznet5k_send_ethernet(self, p->tot_len, self->eth_frame);
+    wiznet5k_send_pbuf(self, p);
     return ERR_OK;
 }
 
@@ -324,18 +385,7 @@ void wiznet5k_poll(void) {
         !(self->netif.flags & NETIF_FLAG_LINK_UP)) {
         return;
     }
-    uint16_t len;
-    while ((len = wiznet5k_recv_ethernet(self)) > 0) {
-        if (self->trace_flags & TRACE_ETH_RX) {
-            netutils_ethernet_trace(MP_PYTHON_PRINTER, len, self->eth_frame, NETUTILS_TRACE_NEWLINE);
-        }
-        struct pbuf *p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
-        if (p != NULL) {
-            pbuf_take(p, self->eth_frame, len);
-            if (self->netif.input(p, &self->netif) != ERR_OK) {
-                pbuf_free(p);
-            }
-        }
+    while (wiznet5k_recv_ethernet(self) > 0) {
     }
 }
 
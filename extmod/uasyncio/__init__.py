@@ -9,10 +9,15 @@ _attrs = {
     "wait_for": "funcs",
     "wait_for_ms": "funcs",
     "gather": "funcs",
+    "TimerWheel": "funcs",
     "Event": "event",
     "ThreadSafeFlag": "event",
     "Lock": "lock",
+    "Queue": "queue",
+    "QueueEmpty": "queue",
+    "QueueFull": "queue",
     "open_connection": "stream",
+    "open_file": "stream",
     "start_server": "stream",
     "StreamReader": "stream",
     "StreamWriter": "stream",
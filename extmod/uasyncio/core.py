@@ -57,6 +57,13 @@ def sleep_ms(t, sgen=SingletonGenerator()):
     return sgen
 
 
+# Use the built-in C version of sleep_ms, if available
+try:
+    from _uasyncio import sleep_ms
+except ImportError:
+    pass
+
+
 # Pause task execution for the given time (in seconds)
 def sleep(t):
     return sleep_ms(int(t * 1000))
@@ -222,6 +229,13 @@ def run_until_complete(main_task=None):
                 Loop.call_exception_handler(_exc_context)
 
 
+# Use the built-in C version of the run loop, if available
+try:
+    from _uasyncio import run_until_complete
+except ImportError:
+    pass
+
+
 # Create a new task from a coroutine and run it until it finishes
 def run(coro):
     return run_until_complete(create_task(coro))
@@ -59,3 +59,10 @@ try:
 
 except ImportError:
     pass
+
+
+# Use the C versions of Event and ThreadSafeFlag if they're available
+try:
+    from _uasyncio import Event, ThreadSafeFlag
+except ImportError:
+    pass
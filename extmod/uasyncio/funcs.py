@@ -11,8 +11,8 @@ def _run(waiter, aw):
     except BaseException as er:
         result = None
         status = er
-    if waiter.data is None:
-        # The waiter is still waiting, cancel it.
+    if waiter.data is None or isinstance(waiter.data, TimerWheel):
+        # The waiter is still waiting (on the main queue or a TimerWheel), cancel it.
         if waiter.cancel():
             # Waiter was cancelled by us, change its CancelledError to an instance of
             # CancelledError that contains the status and result of waiting on aw.
@@ -51,8 +51,58 @@ async def wait_for(aw, timeout, sleep=core.sleep):
     raise core.TimeoutError
 
 
-def wait_for_ms(aw, timeout):
-    return wait_for(aw, timeout, core.sleep_ms)
+def wait_for_ms(aw, timeout, sleep=core.sleep_ms):
+    return wait_for(aw, timeout, sleep)
+
+
+# MicroPython-extension: sleeps that wait on a utimerwheel instead of the main
+# task queue, so a large number of them (eg timeouts passed to wait_for that are
+# mostly cancelled) are cheap to add and cancel.  A single service task sleeps
+# on the main queue until the earliest one is due.
+class TimerWheel:
+    def __init__(self, capacity):
+        import utimerwheel
+
+        self.wheel = utimerwheel.utimerwheel(capacity)
+        self.handles = {}  # id(Task) -> handle of its timer in the wheel
+        self.service = None  # Task that wakes the tasks when their timers expire
+
+    def remove(self, t):
+        # Called by Task.cancel when a task sleeping on the wheel is cancelled.
+        self.wheel.cancel(self.handles.pop(id(t)))
+
+    async def sleep_ms(self, t):
+        t = core.ticks_add(core.ticks(), max(0, t))
+        self.handles[id(core.cur_task)] = self.wheel.add(t, core.cur_task)
+        # Set calling task's data to this wheel so it can be removed if needed
+        core.cur_task.data = self
+        s = self.service
+        if s is None:
+            self.service = core.create_task(self._service())
+        elif core.ticks_diff(t, s.ph_key) < 0:
+            # Service task is sleeping past this timer, so wake it up earlier
+            core._task_queue.remove(s)
+            core._task_queue.push(s, t)
+        yield
+
+    def sleep(self, t):
+        return self.sleep_ms(int(t * 1000))
+
+    async def _service(self):
+        wheel = self.wheel
+        while wheel:
+            dt = core.ticks_diff(wheel.peektime(), core.ticks())
+            if dt > 0:
+                await core.sleep_ms(dt)
+                continue
+            while True:
+                t = wheel.expire(core.ticks())
+                if t is None:
+                    break
+                del self.handles[id(t)]
+                t.data = None
+                core._task_queue.push(t)
+        self.service = None
 
 
 class _Remove:
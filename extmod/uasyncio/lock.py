@@ -51,3 +51,10 @@ class Lock:
 
     async def __aexit__(self, exc_type, exc, tb):
         return self.release()
+
+
+# Use the C version of Lock if it's available
+try:
+    from _uasyncio import Lock
+except ImportError:
+    pass
@@ -7,6 +7,7 @@ freeze(
         "uasyncio/event.py",
         "uasyncio/funcs.py",
         "uasyncio/lock.py",
+        "uasyncio/queue.py",
         "uasyncio/stream.py",
     ),
     opt=3,
@@ -0,0 +1,75 @@
+# MicroPython uasyncio module
+# MIT license; Copyright (c) 2026 agent
+
+from . import core
+
+
+class QueueEmpty(Exception):
+    pass
+
+
+class QueueFull(Exception):
+    pass
+
+
+# Queue class for passing items between tasks, optionally bounded by maxsize
+class Queue:
+    def __init__(self, maxsize=0):
+        self.maxsize = maxsize if maxsize > 0 else 0
+        self._items = []
+        self._getters = core.TaskQueue()  # Queue of Tasks waiting for an item
+        self._putters = core.TaskQueue()  # Queue of Tasks waiting for a free slot
+
+    def qsize(self):
+        return len(self._items)
+
+    def empty(self):
+        return not self._items
+
+    def full(self):
+        return 0 < self.maxsize <= len(self._items)
+
+    def put_nowait(self, item):
+        if self.full():
+            raise QueueFull()
+        self._items.append(item)
+        if self._getters.peek():
+            core._task_queue.push(self._getters.pop())
+
+    def get_nowait(self):
+        if not self._items:
+            raise QueueEmpty()
+        item = self._items.pop(0)
+        if self._putters.peek():
+            core._task_queue.push(self._putters.pop())
+        return item
+
+    async def put(self, item):
+        while self.full():
+            await self._wait(self._putters, self.full)
+        self.put_nowait(item)
+
+    async def get(self):
+        while not self._items:
+            await self._wait(self._getters, self.empty)
+        return self.get_nowait()
+
+    async def _wait(self, waiting, blocked):
+        # Put the calling task on the waiting queue
+        waiting.push(core.cur_task)
+        # Set calling task's data to the waiting queue so it can be removed if needed
+        core.cur_task.data = waiting
+        try:
+            yield
+        except core.CancelledError as er:
+            # Cancelled after being woken, so pass the wakeup on to the next waiting task
+            if not blocked() and waiting.peek():
+                core._task_queue.push(waiting.pop())
+            raise er
+
+
+# Use the C versions of Queue and its exceptions if they're available
+try:
+    from _uasyncio import Queue, QueueEmpty, QueueFull
+except ImportError:
+    pass
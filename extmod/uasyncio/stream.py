@@ -8,7 +8,8 @@ class Stream:
     def __init__(self, s, e={}):
         self.s = s
         self.e = e
-        self.out_buf = b""
+        # Output is accumulated in a bytearray, which grows in place as it's written to
+        self.out_buf = bytearray()
 
     def get_extra_info(self, v):
         return self.e[v]
@@ -46,6 +47,18 @@ class Stream:
                 n -= len(r2)
         return r
 
+    async def readexactly_into(self, buf):
+        mv = memoryview(buf)
+        off = 0
+        while off < len(mv):
+            yield core._io_queue.queue_read(self.s)
+            n = self.s.readinto(mv[off:])
+            if n is not None:
+                if not n:
+                    raise EOFError
+                off += n
+        return off
+
     async def readline(self):
         l = b""
         while True:
@@ -66,7 +79,8 @@ class Stream:
             ret = self.s.write(mv[off:])
             if ret is not None:
                 off += ret
-        self.out_buf = b""
+        # Keep the buffer's memory for later writes, and anything written while draining
+        del self.out_buf[:off]
 
 
 # Stream can be used for both reading and writing to save code size
@@ -74,6 +88,84 @@ StreamReader = Stream
 StreamWriter = Stream
 
 
+# Stream for a file: filesystems can't do I/O in the background, so instead
+# transfers are split into chunks with other tasks run in between
+class FileStream(Stream):
+    def __init__(self, f, chunk, text):
+        super().__init__(f)
+        self.chunk = chunk
+        if text:
+            self.out_buf = ""
+
+    async def __aexit__(self, exc_type, exc, tb):
+        await self.drain()
+        self.s.close()
+
+    def close(self):
+        self.s.close()
+
+    async def wait_closed(self):
+        self.s.close()
+
+    async def read(self, n=-1):
+        r = None
+        while n:
+            r2 = self.s.read(self.chunk if n < 0 else min(n, self.chunk))
+            if r is None:
+                r = r2
+            elif r2:
+                r += r2
+            if not r2:
+                break
+            n -= len(r2)
+            await core.sleep_ms(0)
+        return r
+
+    async def readinto(self, buf):
+        mv = memoryview(buf)
+        off = 0
+        while off < len(mv):
+            n = self.s.readinto(mv[off : off + self.chunk])
+            if not n:
+                break
+            off += n
+            await core.sleep_ms(0)
+        return off
+
+    async def readexactly(self, n):
+        r = await self.read(n)
+        if len(r) < n:
+            raise EOFError
+        return r
+
+    async def readexactly_into(self, buf):
+        n = await self.readinto(buf)
+        if n < len(buf):
+            raise EOFError
+        return n
+
+    async def readline(self):
+        return self.s.readline()
+
+    async def drain(self):
+        buf = self.out_buf
+        if not isinstance(buf, str):
+            buf = memoryview(buf)
+        n = len(buf)
+        for off in range(0, n, self.chunk):
+            self.s.write(buf[off : off + self.chunk])
+            await core.sleep_ms(0)
+        if isinstance(self.out_buf, str):
+            self.out_buf = self.out_buf[n:]
+        else:
+            del self.out_buf[:n]
+
+
+# Open a file for streaming; the arguments are the same as for open()
+async def open_file(name, mode="r", chunk=512):
+    return FileStream(open(name, mode), chunk, "b" not in mode)
+
+
 # Create a TCP stream connection to a remote host
 async def open_connection(host, port):
     from uerrno import EINPROGRESS
@@ -35,6 +35,10 @@
 #include "extmod/misc.h"
 #include "shared/runtime/interrupt_char.h"
 
+#if MICROPY_PY_OS_DUPTERM_TX_BUF_SIZE
+#include "py/mphal.h"
+#endif
+
 #if MICROPY_PY_OS_DUPTERM
 
 void mp_uos_deactivate(size_t dupterm_idx, const char *msg, mp_obj_t exc) {
@@ -56,6 +60,9 @@ void mp_uos_deactivate(size_t dupterm_idx, const char *msg, mp_obj_t exc) {
 uintptr_t mp_uos_dupterm_poll(uintptr_t poll_flags) {
     uintptr_t poll_flags_out = 0;
 
+    // Anything waiting for input should see all the output so far
+    mp_uos_dupterm_tx_flush();
+
     for (size_t idx = 0; idx < MICROPY_PY_OS_DUPTERM; ++idx) {
         mp_obj_t s = MP_STATE_VM(dupterm_objs[idx]);
         if (s == MP_OBJ_NULL) {
@@ -93,6 +100,8 @@ uintptr_t mp_uos_dupterm_poll(uintptr_t poll_flags) {
 }
 
 int mp_uos_dupterm_rx_chr(void) {
+    mp_uos_dupterm_tx_flush();
+
     for (size_t idx = 0; idx < MICROPY_PY_OS_DUPTERM; ++idx) {
         if (MP_STATE_VM(dupterm_objs[idx]) == MP_OBJ_NULL) {
             continue;
@@ -147,7 +156,7 @@ int mp_uos_dupterm_rx_chr(void) {
     return -1;
 }
 
-void mp_uos_dupterm_tx_strn(const char *str, size_t len) {
+STATIC void mp_uos_dupterm_tx_write(const char *str, size_t len) {
     for (size_t idx = 0; idx < MICROPY_PY_OS_DUPTERM; ++idx) {
         if (MP_STATE_VM(dupterm_objs[idx]) == MP_OBJ_NULL) {
             continue;
@@ -172,6 +181,81 @@ void mp_uos_dupterm_tx_strn(const char *str, size_t len) {
     }
 }
 
+#if MICROPY_PY_OS_DUPTERM_TX_BUF_SIZE
+
+void mp_uos_dupterm_tx_flush(void) {
+    size_t len = MP_STATE_VM(dupterm_tx_len);
+    if (len == 0 || MP_STATE_VM(dupterm_tx_flushing)) {
+        return;
+    }
+    // Output while flushing (eg when a stream is deactivated) is written straight
+    // away, so the buffer can't change under us
+    MP_STATE_VM(dupterm_tx_flushing) = true;
+    mp_uos_dupterm_tx_write((const char *)MP_STATE_VM(dupterm_tx_buf), len);
+    MP_STATE_VM(dupterm_tx_len) = 0;
+    MP_STATE_VM(dupterm_tx_flushing) = false;
+}
+
+STATIC bool mp_uos_dupterm_tx_expired(void) {
+    return mp_hal_ticks_ms() - MP_STATE_VM(dupterm_tx_time) >= MICROPY_PY_OS_DUPTERM_TX_FLUSH_MS;
+}
+
+#if MICROPY_ENABLE_SCHEDULER
+// Runs from the scheduler while there's buffered output, so that output gets
+// written out in time even if no more follows it.  The argument is this
+// function's object, to schedule it again.
+STATIC mp_obj_t mp_uos_dupterm_tx_flush_cb(mp_obj_t self) {
+    if (MP_STATE_VM(dupterm_tx_len) != 0) {
+        if (mp_uos_dupterm_tx_expired()) {
+            mp_uos_dupterm_tx_flush();
+        } else {
+            mp_sched_schedule_ex(self, self, MP_SCHED_COALESCE);
+        }
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mp_uos_dupterm_tx_flush_cb_obj, mp_uos_dupterm_tx_flush_cb);
+#endif
+
+#endif
+
+void mp_uos_dupterm_tx_strn(const char *str, size_t len) {
+    #if MICROPY_PY_OS_DUPTERM_TX_BUF_SIZE
+    if (!MP_STATE_VM(dupterm_tx_flushing)) {
+        size_t idx = 0;
+        while (idx < MICROPY_PY_OS_DUPTERM && MP_STATE_VM(dupterm_objs[idx]) == MP_OBJ_NULL) {
+            ++idx;
+        }
+        if (idx == MICROPY_PY_OS_DUPTERM) {
+            // No dupterm streams to write to
+            return;
+        }
+        if (MP_STATE_VM(dupterm_tx_len) + len > MICROPY_PY_OS_DUPTERM_TX_BUF_SIZE) {
+            mp_uos_dupterm_tx_flush();
+        }
+        if (len < MICROPY_PY_OS_DUPTERM_TX_BUF_SIZE) {
+            // Collect the output in the buffer, to write out once the buffer is
+            // full, input is wanted, or it has been waiting for a while
+            if (MP_STATE_VM(dupterm_tx_len) == 0) {
+                MP_STATE_VM(dupterm_tx_time) = mp_hal_ticks_ms();
+                #if MICROPY_ENABLE_SCHEDULER
+                mp_obj_t cb = MP_OBJ_FROM_PTR(&mp_uos_dupterm_tx_flush_cb_obj);
+                mp_sched_schedule_ex(cb, cb, MP_SCHED_COALESCE);
+                #endif
+            }
+            memcpy(MP_STATE_VM(dupterm_tx_buf) + MP_STATE_VM(dupterm_tx_len), str, len);
+            MP_STATE_VM(dupterm_tx_len) += len;
+            if (mp_uos_dupterm_tx_expired()) {
+                mp_uos_dupterm_tx_flush();
+            }
+            return;
+        }
+    }
+    #endif
+
+    mp_uos_dupterm_tx_write(str, len);
+}
+
 STATIC mp_obj_t mp_uos_dupterm(size_t n_args, const mp_obj_t *args) {
     mp_int_t idx = 0;
     if (n_args == 2) {
@@ -182,6 +266,9 @@ STATIC mp_obj_t mp_uos_dupterm(size_t n_args, const mp_obj_t *args) {
         mp_raise_ValueError(MP_ERROR_TEXT("invalid dupterm index"));
     }
 
+    // Output so far goes to the streams it was written for
+    mp_uos_dupterm_tx_flush();
+
     mp_obj_t previous_obj = MP_STATE_VM(dupterm_objs[idx]);
     if (previous_obj == MP_OBJ_NULL) {
         previous_obj = mp_const_none;
@@ -28,7 +28,9 @@
 #include <string.h>
 
 #include "py/runtime.h"
+#include "py/builtin.h"
 #include "py/objstr.h"
+#include "py/objtype.h"
 #include "py/mperrno.h"
 #include "extmod/vfs.h"
 
@@ -46,6 +48,13 @@
 #include "extmod/vfs_posix.h"
 #endif
 
+// Anything that may change where modules are found invalidates the import cache.
+#if MICROPY_MODULE_IMPORT_CACHE
+#define VFS_CHANGED() mp_import_cache_clear()
+#else
+#define VFS_CHANGED()
+#endif
+
 // For mp_vfs_proxy_call, the maximum number of additional args that can be passed.
 // A fixed maximum size is used to avoid the need for a costly variable array.
 #define PROXY_MAX_ARGS (2)
@@ -256,6 +265,7 @@ mp_obj_t mp_vfs_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args
         vfsp = &(*vfsp)->next;
     }
     *vfsp = vfs;
+    VFS_CHANGED();
 
     return mp_const_none;
 }
@@ -286,6 +296,8 @@ mp_obj_t mp_vfs_umount(mp_obj_t mnt_in) {
         MP_STATE_VM(vfs_cur) = MP_VFS_ROOT;
     }
 
+    VFS_CHANGED();
+
     // call the underlying object to do any unmounting operation
     mp_vfs_proxy_call(vfs, MP_QSTR_umount, 0, NULL);
 
@@ -293,9 +305,9 @@ mp_obj_t mp_vfs_umount(mp_obj_t mnt_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_umount_obj, mp_vfs_umount);
 
-// Note: buffering and encoding args are currently ignored
+// Note: encoding arg is currently ignored
 mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_file, ARG_mode, ARG_encoding };
+    enum { ARG_file, ARG_mode, ARG_buffering, ARG_encoding };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_rom_obj = MP_ROM_NONE} },
         { MP_QSTR_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_r)} },
@@ -314,8 +326,35 @@ mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
     }
     #endif
 
+    #if MICROPY_MODULE_IMPORT_CACHE
+    // a file opened for writing may be (or replace) a module
+    const char *mode = mp_obj_str_get_str(args[ARG_mode].u_obj);
+    if (strpbrk(mode, "wax+") != NULL) {
+        VFS_CHANGED();
+    }
+    #endif
+
     mp_vfs_mount_t *vfs = lookup_path(args[ARG_file].u_obj, &args[ARG_file].u_obj);
-    return mp_vfs_proxy_call(vfs, MP_QSTR_open, 2, (mp_obj_t *)&args);
+    mp_obj_t file = mp_vfs_proxy_call(vfs, MP_QSTR_open, 2, (mp_obj_t *)&args);
+
+    #if MICROPY_VFS_FILE_BUFFERING
+    // Ask native file objects to buffer; those that can't (or whose OS already
+    // buffers, like VfsPosix) fail the ioctl, which is fine.
+    mp_int_t buffering = args[ARG_buffering].u_int;
+    if (buffering < 0) {
+        buffering = MICROPY_VFS_FILE_BUFSIZE;
+    }
+    const mp_obj_type_t *type = mp_obj_get_type(file);
+    if (buffering > 1 && mp_obj_is_native_type(type) && type->protocol != NULL) {
+        const mp_stream_p_t *stream_p = type->protocol;
+        if (stream_p->ioctl != NULL) {
+            int errcode;
+            stream_p->ioctl(file, MP_STREAM_SET_BUFFER, buffering, &errcode);
+        }
+    }
+    #endif
+
+    return file;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(mp_vfs_open_obj, 0, mp_vfs_open);
 
@@ -338,6 +377,7 @@ mp_obj_t mp_vfs_chdir(mp_obj_t path_in) {
         mp_vfs_proxy_call(vfs, MP_QSTR_chdir, 1, &path_out);
     }
     MP_STATE_VM(vfs_cur) = vfs;
+    VFS_CHANGED();
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_chdir_obj, mp_vfs_chdir);
@@ -446,6 +486,7 @@ mp_obj_t mp_vfs_mkdir(mp_obj_t path_in) {
     if (vfs == MP_VFS_ROOT || (vfs != MP_VFS_NONE && !strcmp(mp_obj_str_get_str(path_out), "/"))) {
         mp_raise_OSError(MP_EEXIST);
     }
+    VFS_CHANGED();
     return mp_vfs_proxy_call(vfs, MP_QSTR_mkdir, 1, &path_out);
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_mkdir_obj, mp_vfs_mkdir);
@@ -453,6 +494,7 @@ MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_mkdir_obj, mp_vfs_mkdir);
 mp_obj_t mp_vfs_remove(mp_obj_t path_in) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_path(path_in, &path_out);
+    VFS_CHANGED();
     return mp_vfs_proxy_call(vfs, MP_QSTR_remove, 1, &path_out);
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_remove_obj, mp_vfs_remove);
@@ -465,6 +507,7 @@ mp_obj_t mp_vfs_rename(mp_obj_t old_path_in, mp_obj_t new_path_in) {
         // can't rename across filesystems
         mp_raise_OSError(MP_EPERM);
     }
+    VFS_CHANGED();
     return mp_vfs_proxy_call(old_vfs, MP_QSTR_rename, 2, args);
 }
 MP_DEFINE_CONST_FUN_OBJ_2(mp_vfs_rename_obj, mp_vfs_rename);
@@ -472,6 +515,7 @@ MP_DEFINE_CONST_FUN_OBJ_2(mp_vfs_rename_obj, mp_vfs_rename);
 mp_obj_t mp_vfs_rmdir(mp_obj_t path_in) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_path(path_in, &path_out);
+    VFS_CHANGED();
     return mp_vfs_proxy_call(vfs, MP_QSTR_rmdir, 1, &path_out);
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_rmdir_obj, mp_vfs_rmdir);
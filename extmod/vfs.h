@@ -28,6 +28,7 @@
 
 #include "py/builtin.h"
 #include "py/obj.h"
+#include "py/stream.h"
 
 // return values of mp_vfs_lookup_path
 // ROOT is 0 so that the default current directory is the root directory
@@ -43,6 +44,8 @@
 #define MP_BLOCKDEV_FLAG_FREE_OBJ       (0x0002) // fs_user_mount_t obj should be freed on umount
 #define MP_BLOCKDEV_FLAG_HAVE_IOCTL     (0x0004) // new protocol with ioctl
 #define MP_BLOCKDEV_FLAG_NO_FILESYSTEM  (0x0008) // the block device has no filesystem on it
+#define MP_BLOCKDEV_FLAG_CACHE          (0x0010) // the cache fields are initialised
+#define MP_BLOCKDEV_FLAG_BOUNCE         (0x0020) // fs_user_mount_t has a bounce buffer
 
 // constants for block protocol ioctl
 #define MP_BLOCKDEV_IOCTL_INIT          (1)
@@ -70,6 +73,17 @@ typedef struct _mp_vfs_blockdev_t {
             mp_obj_t count[2];
         } old;
     } u;
+    #if MICROPY_VFS_BLOCKDEV_CACHE
+    // block cache, with the buffer allocated on first use
+    uint8_t *cache_buf;
+    size_t cache_block_size; // block size the buffer was allocated for
+    uint32_t cache_tick;
+    uint32_t cache_next_block; // block after the last one read, for readahead
+    uint32_t cache_num_blocks; // size of the device, 0 to not read ahead
+    uint32_t cache_block[MICROPY_VFS_BLOCKDEV_CACHE];
+    uint32_t cache_used[MICROPY_VFS_BLOCKDEV_CACHE]; // tick of last use, 0 if slot is empty
+    uint8_t cache_dirty[MICROPY_VFS_BLOCKDEV_CACHE];
+    #endif
 } mp_vfs_blockdev_t;
 
 typedef struct _mp_vfs_mount_t {
@@ -86,6 +100,25 @@ int mp_vfs_blockdev_write(mp_vfs_blockdev_t *self, size_t block_num, size_t num_
 int mp_vfs_blockdev_write_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t block_off, size_t len, const uint8_t *buf);
 mp_obj_t mp_vfs_blockdev_ioctl(mp_vfs_blockdev_t *self, uintptr_t cmd, uintptr_t arg);
 
+#if MICROPY_VFS_FILE_BUFFERING
+// Buffer for a file opened with a "buffering" size.  It holds either data
+// read ahead of the file position (when write is false) or data written but
+// not yet passed on to the file (when write is true).
+typedef struct _mp_vfs_filebuf_t {
+    uint8_t *buf; // NULL when the file is unbuffered
+    size_t size;
+    size_t len;
+    size_t pos; // position of the next byte to read, when reading
+    bool write;
+} mp_vfs_filebuf_t;
+
+// These wrap the unbuffered stream functions in "raw" and take their place
+// in the stream protocol of a file type that embeds a mp_vfs_filebuf_t.
+mp_uint_t mp_vfs_filebuf_read(mp_obj_t file, mp_vfs_filebuf_t *fb, const mp_stream_p_t *raw, void *buf, mp_uint_t size, int *errcode);
+mp_uint_t mp_vfs_filebuf_write(mp_obj_t file, mp_vfs_filebuf_t *fb, const mp_stream_p_t *raw, const void *buf, mp_uint_t size, int *errcode);
+mp_uint_t mp_vfs_filebuf_ioctl(mp_obj_t file, mp_vfs_filebuf_t *fb, const mp_stream_p_t *raw, mp_uint_t request, uintptr_t arg, int *errcode);
+#endif
+
 mp_vfs_mount_t *mp_vfs_lookup_path(const char *path, const char **path_out);
 mp_import_stat_t mp_vfs_import_stat(const char *path);
 mp_obj_t mp_vfs_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
@@ -32,6 +32,231 @@
 
 #if MICROPY_VFS
 
+STATIC int mp_vfs_blockdev_read_raw(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, uint8_t *buf);
+STATIC int mp_vfs_blockdev_write_raw(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, const uint8_t *buf);
+
+#if MICROPY_VFS_BLOCKDEV_CACHE
+
+// The block cache has MICROPY_VFS_BLOCKDEV_CACHE slots, chosen for reuse by
+// least recent use.  Single-block reads and writes go through it, while
+// larger transfers go straight to the device and keep cached blocks up to
+// date.  A single-block read following on from the previous read is
+// extended to read up to MICROPY_VFS_BLOCKDEV_CACHE_READAHEAD blocks into
+// consecutive slots.  Written blocks are kept dirty until evicted or the
+// device is synced, and consecutive dirty blocks in consecutive slots are
+// then written out together.
+
+#define CACHE_SLOTS (MICROPY_VFS_BLOCKDEV_CACHE)
+
+STATIC uint8_t *cache_slot_buf(mp_vfs_blockdev_t *self, size_t slot) {
+    return self->cache_buf + slot * self->cache_block_size;
+}
+
+STATIC int cache_find(mp_vfs_blockdev_t *self, size_t block_num) {
+    for (size_t i = 0; i < CACHE_SLOTS; ++i) {
+        if (self->cache_used[i] != 0 && self->cache_block[i] == block_num) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+STATIC void cache_touch(mp_vfs_blockdev_t *self, size_t slot) {
+    if (++self->cache_tick == 0) {
+        ++self->cache_tick;
+    }
+    self->cache_used[slot] = self->cache_tick;
+}
+
+// Write out the dirty blocks in slots first to last - 1.
+STATIC int cache_write_back(mp_vfs_blockdev_t *self, size_t first, size_t last) {
+    for (size_t i = first; i < last;) {
+        if (!self->cache_dirty[i]) {
+            ++i;
+            continue;
+        }
+        size_t n = 1;
+        while (i + n < last && self->cache_dirty[i + n] && self->cache_block[i + n] == self->cache_block[i] + n) {
+            ++n;
+        }
+        int ret = mp_vfs_blockdev_write_raw(self, self->cache_block[i], n, cache_slot_buf(self, i));
+        if (ret != 0) {
+            return ret;
+        }
+        memset(&self->cache_dirty[i], 0, n);
+        i += n;
+    }
+    return 0;
+}
+
+// Free n consecutive slots, starting at prefer if that's possible, and
+// return the first one, or a negative error code.
+STATIC int cache_alloc(mp_vfs_blockdev_t *self, size_t n, int prefer) {
+    if (self->cache_buf == NULL || self->cache_block_size != self->block_size) {
+        if (self->cache_buf != NULL) {
+            // write back blocks at the size they were cached with
+            size_t block_size = self->block_size;
+            self->block_size = self->cache_block_size;
+            int ret = cache_write_back(self, 0, CACHE_SLOTS);
+            self->block_size = block_size;
+            if (ret != 0) {
+                return ret;
+            }
+            m_del(uint8_t, self->cache_buf, CACHE_SLOTS * self->cache_block_size);
+        }
+        memset(self->cache_used, 0, sizeof(self->cache_used));
+        memset(self->cache_dirty, 0, sizeof(self->cache_dirty));
+        self->cache_buf = m_new_maybe(uint8_t, CACHE_SLOTS * self->block_size);
+        if (self->cache_buf == NULL) {
+            return -MP_ENOMEM;
+        }
+        self->cache_block_size = self->block_size;
+        // only read ahead if the size of the device is known
+        mp_obj_t ret = mp_vfs_blockdev_ioctl(self, MP_BLOCKDEV_IOCTL_BLOCK_COUNT, 0);
+        self->cache_num_blocks = mp_obj_is_small_int(ret) ? MP_OBJ_SMALL_INT_VALUE(ret) : 0;
+    }
+
+    size_t slot;
+    if (prefer >= 0 && prefer + n <= CACHE_SLOTS) {
+        slot = prefer;
+    } else {
+        slot = 0;
+        for (size_t i = 1; i < CACHE_SLOTS; ++i) {
+            if (self->cache_used[i] < self->cache_used[slot]) {
+                slot = i;
+            }
+        }
+        if (slot + n > CACHE_SLOTS) {
+            slot = CACHE_SLOTS - n;
+        }
+    }
+    int ret = cache_write_back(self, slot, slot + n);
+    if (ret != 0) {
+        return ret;
+    }
+    memset(&self->cache_used[slot], 0, n * sizeof(self->cache_used[0]));
+    return slot;
+}
+
+// Make sure the device has the latest data for a block, and optionally drop
+// it from the cache.
+STATIC int cache_sync_block(mp_vfs_blockdev_t *self, size_t block_num, bool drop) {
+    int slot = cache_find(self, block_num);
+    if (slot < 0) {
+        return 0;
+    }
+    int ret = cache_write_back(self, slot, slot + 1);
+    if (drop) {
+        self->cache_used[slot] = 0;
+    }
+    return ret;
+}
+
+STATIC int cache_read(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, uint8_t *buf) {
+    if (num_blocks != 1) {
+        int ret = mp_vfs_blockdev_read_raw(self, block_num, num_blocks, buf);
+        if (ret != 0) {
+            return ret;
+        }
+        // the device may be behind blocks written to the cache
+        for (size_t i = 0; i < CACHE_SLOTS; ++i) {
+            if (self->cache_used[i] != 0 && self->cache_dirty[i]
+                && self->cache_block[i] - block_num < num_blocks) {
+                memcpy(buf + (self->cache_block[i] - block_num) * self->block_size,
+                    cache_slot_buf(self, i), self->block_size);
+            }
+        }
+        self->cache_next_block = block_num + num_blocks;
+        return 0;
+    }
+
+    int slot = cache_find(self, block_num);
+    if (slot < 0) {
+        size_t n = 1;
+        if (block_num == self->cache_next_block && self->cache_buf != NULL) {
+            while (n < MICROPY_VFS_BLOCKDEV_CACHE_READAHEAD && block_num + n < self->cache_num_blocks
+                   && cache_find(self, block_num + n) < 0) {
+                ++n;
+            }
+        }
+        slot = cache_alloc(self, n, -1);
+        if (slot == -MP_ENOMEM) {
+            return mp_vfs_blockdev_read_raw(self, block_num, 1, buf);
+        } else if (slot < 0) {
+            return slot;
+        }
+        int ret = 0;
+        if (n > 1) {
+            // reading ahead is speculative, so if the device can't do it
+            // (it may only expect the single block asked for) then don't
+            // try again, and just read that block
+            nlr_buf_t nlr;
+            if (nlr_push(&nlr) == 0) {
+                ret = mp_vfs_blockdev_read_raw(self, block_num, n, cache_slot_buf(self, slot));
+                nlr_pop();
+            } else {
+                ret = -MP_EIO;
+            }
+            if (ret != 0) {
+                self->cache_num_blocks = 0;
+                n = 1;
+            }
+        }
+        if (n == 1) {
+            ret = mp_vfs_blockdev_read_raw(self, block_num, 1, cache_slot_buf(self, slot));
+        }
+        if (ret != 0) {
+            return ret;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            self->cache_block[slot + i] = block_num + i;
+            cache_touch(self, slot + i);
+        }
+        // only misses move the stream, so hits on metadata in between
+        // reads of a file don't stop the next miss reading ahead
+        self->cache_next_block = block_num + n;
+    }
+    cache_touch(self, slot);
+    memcpy(buf, cache_slot_buf(self, slot), self->block_size);
+    return 0;
+}
+
+STATIC int cache_write(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, const uint8_t *buf) {
+    if (num_blocks != 1) {
+        int ret = mp_vfs_blockdev_write_raw(self, block_num, num_blocks, buf);
+        if (ret != 0) {
+            return ret;
+        }
+        for (size_t i = 0; i < CACHE_SLOTS; ++i) {
+            if (self->cache_used[i] != 0 && self->cache_block[i] - block_num < num_blocks) {
+                memcpy(cache_slot_buf(self, i),
+                    buf + (self->cache_block[i] - block_num) * self->block_size, self->block_size);
+                self->cache_dirty[i] = 0;
+            }
+        }
+        return 0;
+    }
+
+    int slot = cache_find(self, block_num);
+    if (slot < 0) {
+        // put the block after the previous one, so they can be written together
+        int prev = block_num > 0 ? cache_find(self, block_num - 1) : -1;
+        slot = cache_alloc(self, 1, prev < 0 ? -1 : prev + 1);
+        if (slot == -MP_ENOMEM) {
+            return mp_vfs_blockdev_write_raw(self, block_num, 1, buf);
+        } else if (slot < 0) {
+            return slot;
+        }
+        self->cache_block[slot] = block_num;
+    }
+    memcpy(cache_slot_buf(self, slot), buf, self->block_size);
+    self->cache_dirty[slot] = 1;
+    cache_touch(self, slot);
+    return 0;
+}
+
+#endif // MICROPY_VFS_BLOCKDEV_CACHE
+
 void mp_vfs_blockdev_init(mp_vfs_blockdev_t *self, mp_obj_t bdev) {
     mp_load_method(bdev, MP_QSTR_readblocks, self->readblocks);
     mp_load_method_maybe(bdev, MP_QSTR_writeblocks, self->writeblocks);
@@ -44,9 +269,26 @@ void mp_vfs_blockdev_init(mp_vfs_blockdev_t *self, mp_obj_t bdev) {
         mp_load_method_maybe(bdev, MP_QSTR_sync, self->u.old.sync);
         mp_load_method(bdev, MP_QSTR_count, self->u.old.count);
     }
+    #if MICROPY_VFS_BLOCKDEV_CACHE
+    self->flags |= MP_BLOCKDEV_FLAG_CACHE;
+    self->cache_buf = NULL;
+    self->cache_tick = 0;
+    self->cache_next_block = 0;
+    memset(self->cache_used, 0, sizeof(self->cache_used));
+    memset(self->cache_dirty, 0, sizeof(self->cache_dirty));
+    #endif
 }
 
 int mp_vfs_blockdev_read(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, uint8_t *buf) {
+    #if MICROPY_VFS_BLOCKDEV_CACHE
+    if (self->flags & MP_BLOCKDEV_FLAG_CACHE) {
+        return cache_read(self, block_num, num_blocks, buf);
+    }
+    #endif
+    return mp_vfs_blockdev_read_raw(self, block_num, num_blocks, buf);
+}
+
+STATIC int mp_vfs_blockdev_read_raw(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, uint8_t *buf) {
     if (self->flags & MP_BLOCKDEV_FLAG_NATIVE) {
         mp_uint_t (*f)(uint8_t *, uint32_t, uint32_t) = (void *)(uintptr_t)self->readblocks[2];
         return f(buf, block_num, num_blocks);
@@ -61,6 +303,14 @@ int mp_vfs_blockdev_read(mp_vfs_blockdev_t *self, size_t block_num, size_t num_b
 }
 
 int mp_vfs_blockdev_read_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t block_off, size_t len, uint8_t *buf) {
+    #if MICROPY_VFS_BLOCKDEV_CACHE
+    if (self->flags & MP_BLOCKDEV_FLAG_CACHE) {
+        int ret = cache_sync_block(self, block_num, false);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    #endif
     mp_obj_array_t ar = {{&mp_type_bytearray}, BYTEARRAY_TYPECODE, 0, len, buf};
     self->readblocks[2] = MP_OBJ_NEW_SMALL_INT(block_num);
     self->readblocks[3] = MP_OBJ_FROM_PTR(&ar);
@@ -79,6 +329,15 @@ int mp_vfs_blockdev_write(mp_vfs_blockdev_t *self, size_t block_num, size_t num_
         return -MP_EROFS;
     }
 
+    #if MICROPY_VFS_BLOCKDEV_CACHE
+    if (self->flags & MP_BLOCKDEV_FLAG_CACHE) {
+        return cache_write(self, block_num, num_blocks, buf);
+    }
+    #endif
+    return mp_vfs_blockdev_write_raw(self, block_num, num_blocks, buf);
+}
+
+STATIC int mp_vfs_blockdev_write_raw(mp_vfs_blockdev_t *self, size_t block_num, size_t num_blocks, const uint8_t *buf) {
     if (self->flags & MP_BLOCKDEV_FLAG_NATIVE) {
         mp_uint_t (*f)(const uint8_t *, uint32_t, uint32_t) = (void *)(uintptr_t)self->writeblocks[2];
         return f(buf, block_num, num_blocks);
@@ -98,6 +357,15 @@ int mp_vfs_blockdev_write_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t
         return -MP_EROFS;
     }
 
+    #if MICROPY_VFS_BLOCKDEV_CACHE
+    if (self->flags & MP_BLOCKDEV_FLAG_CACHE) {
+        int ret = cache_sync_block(self, block_num, true);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    #endif
+
     mp_obj_array_t ar = {{&mp_type_bytearray}, BYTEARRAY_TYPECODE, 0, len, (void *)buf};
     self->writeblocks[2] = MP_OBJ_NEW_SMALL_INT(block_num);
     self->writeblocks[3] = MP_OBJ_FROM_PTR(&ar);
@@ -111,6 +379,20 @@ int mp_vfs_blockdev_write_ext(mp_vfs_blockdev_t *self, size_t block_num, size_t
 }
 
 mp_obj_t mp_vfs_blockdev_ioctl(mp_vfs_blockdev_t *self, uintptr_t cmd, uintptr_t arg) {
+    #if MICROPY_VFS_BLOCKDEV_CACHE
+    if ((self->flags & MP_BLOCKDEV_FLAG_CACHE) && self->cache_buf != NULL) {
+        int ret = 0;
+        if (cmd == MP_BLOCKDEV_IOCTL_SYNC || cmd == MP_BLOCKDEV_IOCTL_DEINIT) {
+            ret = cache_write_back(self, 0, CACHE_SLOTS);
+        } else if (cmd == MP_BLOCKDEV_IOCTL_BLOCK_ERASE) {
+            ret = cache_sync_block(self, arg, true);
+        }
+        if (ret != 0) {
+            return MP_OBJ_NEW_SMALL_INT(ret);
+        }
+    }
+    #endif
+
     if (self->flags & MP_BLOCKDEV_FLAG_HAVE_IOCTL) {
         // New protocol with ioctl
         self->u.ioctl[2] = MP_OBJ_NEW_SMALL_INT(cmd);
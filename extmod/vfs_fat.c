@@ -63,7 +63,17 @@ STATIC mp_import_stat_t fat_vfs_import_stat(void *vfs_in, const char *path) {
 }
 
 STATIC mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    #if MICROPY_VFS_FAT_BOUNCE
+    enum { ARG_bdev, ARG_bounce };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_bounce, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t arg_vals[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, args, MP_ARRAY_SIZE(allowed_args), allowed_args, arg_vals);
+    #else
     mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    #endif
 
     // create new object
     fs_user_mount_t *vfs = mp_obj_malloc(fs_user_mount_t, type);
@@ -83,6 +93,15 @@ STATIC mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, size_
         mp_raise_OSError(fresult_to_errno_table[res]);
     }
 
+    #if MICROPY_VFS_FAT_BOUNCE
+    // allocated now the sector size is known, with space to align it
+    if (arg_vals[ARG_bounce].u_int > 0) {
+        vfs->bounce_len = arg_vals[ARG_bounce].u_int * vfs->blockdev.block_size + MICROPY_VFS_FAT_BOUNCE_ALIGN - 1;
+        vfs->bounce_buf = m_new(uint8_t, vfs->bounce_len);
+        vfs->blockdev.flags |= MP_BLOCKDEV_FLAG_BOUNCE;
+    }
+    #endif
+
     return MP_OBJ_FROM_PTR(vfs);
 }
 
@@ -34,6 +34,11 @@ typedef struct _fs_user_mount_t {
     mp_obj_base_t base;
     mp_vfs_blockdev_t blockdev;
     FATFS fatfs;
+    #if MICROPY_VFS_FAT_BOUNCE
+    // aligned buffer for transfers, valid if MP_BLOCKDEV_FLAG_BOUNCE is set
+    uint8_t *bounce_buf;
+    size_t bounce_len;
+    #endif
 } fs_user_mount_t;
 
 extern const byte fresult_to_errno_table[20];
@@ -32,6 +32,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "py/mphal.h"
 
@@ -48,6 +49,42 @@ STATIC fs_user_mount_t *disk_get_device(void *bdev) {
     return (fs_user_mount_t *)bdev;
 }
 
+#if MICROPY_VFS_FAT_BOUNCE
+// Transfer sectors to or from an unaligned buff via the mount's aligned
+// bounce buffer, as many at a time as fit in it.
+STATIC int disk_bounce(fs_user_mount_t *vfs, BYTE *buff, DWORD sector, UINT count, bool write) {
+    size_t block_size = vfs->blockdev.block_size;
+    uint8_t *bounce = (uint8_t *)(((uintptr_t)vfs->bounce_buf + MICROPY_VFS_FAT_BOUNCE_ALIGN - 1) & ~(uintptr_t)(MICROPY_VFS_FAT_BOUNCE_ALIGN - 1));
+    size_t max_count = (vfs->bounce_len - (MICROPY_VFS_FAT_BOUNCE_ALIGN - 1)) / block_size;
+    if (max_count == 0) {
+        // the sector size grew after the buffer was allocated
+        return write ? mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff)
+            : mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff);
+    }
+    while (count > 0) {
+        size_t n = MIN(count, max_count);
+        int ret;
+        if (write) {
+            memcpy(bounce, buff, n * block_size);
+            ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, n, bounce);
+        } else {
+            ret = mp_vfs_blockdev_read(&vfs->blockdev, sector, n, bounce);
+            memcpy(buff, bounce, n * block_size);
+        }
+        if (ret != 0) {
+            return ret;
+        }
+        buff += n * block_size;
+        sector += n;
+        count -= n;
+    }
+    return 0;
+}
+
+#define DISK_NEEDS_BOUNCE(vfs, buff) (((vfs)->blockdev.flags & MP_BLOCKDEV_FLAG_BOUNCE) \
+    && ((uintptr_t)(buff) & (MICROPY_VFS_FAT_BOUNCE_ALIGN - 1)) != 0)
+#endif
+
 /*-----------------------------------------------------------------------*/
 /* Read Sector(s)                                                        */
 /*-----------------------------------------------------------------------*/
@@ -63,7 +100,15 @@ DRESULT disk_read(
         return RES_PARERR;
     }
 
-    int ret = mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff);
+    int ret;
+    #if MICROPY_VFS_FAT_BOUNCE
+    if (DISK_NEEDS_BOUNCE(vfs, buff)) {
+        ret = disk_bounce(vfs, buff, sector, count, false);
+    } else
+    #endif
+    {
+        ret = mp_vfs_blockdev_read(&vfs->blockdev, sector, count, buff);
+    }
 
     return ret == 0 ? RES_OK : RES_ERROR;
 }
@@ -83,7 +128,15 @@ DRESULT disk_write(
         return RES_PARERR;
     }
 
-    int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
+    int ret;
+    #if MICROPY_VFS_FAT_BOUNCE
+    if (DISK_NEEDS_BOUNCE(vfs, buff)) {
+        ret = disk_bounce(vfs, (BYTE *)buff, sector, count, true);
+    } else
+    #endif
+    {
+        ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
+    }
 
     if (ret == -MP_EROFS) {
         // read-only block device
@@ -124,6 +177,12 @@ DRESULT disk_ioctl(
     // Second part: convert the result for return
     switch (cmd) {
         case CTRL_SYNC:
+            #if MICROPY_VFS_BLOCKDEV_CACHE
+            // a negative value is an error writing back cached blocks
+            if (mp_obj_is_small_int(ret) && MP_OBJ_SMALL_INT_VALUE(ret) < 0) {
+                return RES_ERROR;
+            }
+            #endif
             return RES_OK;
 
         case GET_SECTOR_COUNT: {
@@ -62,6 +62,9 @@ const byte fresult_to_errno_table[20] = {
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
+    #if MICROPY_VFS_FILE_BUFFERING
+    mp_vfs_filebuf_t fb;
+    #endif
 } pyb_file_obj_t;
 
 STATIC void file_obj_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
@@ -151,6 +154,37 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
     }
 }
 
+#if MICROPY_VFS_FILE_BUFFERING
+STATIC const mp_stream_p_t file_obj_unbuffered_p = {
+    .read = file_obj_read,
+    .write = file_obj_write,
+    .ioctl = file_obj_ioctl,
+};
+
+STATIC mp_uint_t file_obj_buffered_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_vfs_filebuf_read(self_in, &self->fb, &file_obj_unbuffered_p, buf, size, errcode);
+}
+
+STATIC mp_uint_t file_obj_buffered_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_vfs_filebuf_write(self_in, &self->fb, &file_obj_unbuffered_p, buf, size, errcode);
+}
+
+STATIC mp_uint_t file_obj_buffered_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_vfs_filebuf_ioctl(self_in, &self->fb, &file_obj_unbuffered_p, request, arg, errcode);
+}
+
+#define FILE_OBJ_READ file_obj_buffered_read
+#define FILE_OBJ_WRITE file_obj_buffered_write
+#define FILE_OBJ_IOCTL file_obj_buffered_ioctl
+#else
+#define FILE_OBJ_READ file_obj_read
+#define FILE_OBJ_WRITE file_obj_write
+#define FILE_OBJ_IOCTL file_obj_ioctl
+#endif
+
 // Note: encoding is ignored for now; it's also not a valid kwarg for CPython's FileIO,
 // but by adding it here we can use one single mp_arg_t array for open() and FileIO's constructor
 STATIC const mp_arg_t file_open_args[] = {
@@ -194,6 +228,9 @@ STATIC mp_obj_t file_open(fs_user_mount_t *vfs, const mp_obj_type_t *type, mp_ar
 
     pyb_file_obj_t *o = m_new_obj_with_finaliser(pyb_file_obj_t);
     o->base.type = type;
+    #if MICROPY_VFS_FILE_BUFFERING
+    o->fb.buf = NULL;
+    #endif
 
     const char *fname = mp_obj_str_get_str(args[0].u_obj);
     assert(vfs != NULL);
@@ -238,9 +275,9 @@ STATIC MP_DEFINE_CONST_DICT(vfs_fat_rawfile_locals_dict, vfs_fat_rawfile_locals_
 
 #if MICROPY_PY_IO_FILEIO
 STATIC const mp_stream_p_t vfs_fat_fileio_stream_p = {
-    .read = file_obj_read,
-    .write = file_obj_write,
-    .ioctl = file_obj_ioctl,
+    .read = FILE_OBJ_READ,
+    .write = FILE_OBJ_WRITE,
+    .ioctl = FILE_OBJ_IOCTL,
 };
 
 const mp_obj_type_t mp_type_vfs_fat_fileio = {
@@ -256,9 +293,9 @@ const mp_obj_type_t mp_type_vfs_fat_fileio = {
 #endif
 
 STATIC const mp_stream_p_t vfs_fat_textio_stream_p = {
-    .read = file_obj_read,
-    .write = file_obj_write,
-    .ioctl = file_obj_ioctl,
+    .read = FILE_OBJ_READ,
+    .write = FILE_OBJ_WRITE,
+    .ioctl = FILE_OBJ_IOCTL,
     .is_text = true,
 };
 
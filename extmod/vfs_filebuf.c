@@ -0,0 +1,210 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "py/mperrno.h"
+#include "extmod/vfs.h"
+
+#if MICROPY_VFS && MICROPY_VFS_FILE_BUFFERING
+
+// Pass any pending written data on to the file.  The data is dropped on error.
+// Read-ahead data is left alone.
+STATIC int filebuf_flush_write(mp_obj_t file, mp_vfs_filebuf_t *fb, const mp_stream_p_t *raw) {
+    int errcode = 0;
+    if (fb->write) {
+        size_t done = 0;
+        while (done < fb->len) {
+            mp_uint_t n = raw->write(file, fb->buf + done, fb->len - done, &errcode);
+            if (n == MP_STREAM_ERROR) {
+                break;
+            }
+            if (n == 0) {
+                errcode = MP_ENOSPC;
+                break;
+            }
+            done += n;
+        }
+        fb->write = false;
+        fb->len = 0;
+        fb->pos = 0;
+    }
+    return errcode;
+}
+
+// Drop any read-ahead data, moving the file position back to where the
+// reader has got to.
+STATIC int filebuf_drop_read(mp_obj_t file, mp_vfs_filebuf_t *fb, const mp_stream_p_t *raw) {
+    int errcode = 0;
+    if (!fb->write && fb->pos < fb->len) {
+        struct mp_stream_seek_t seek_s;
+        seek_s.offset = -(mp_off_t)(fb->len - fb->pos);
+        seek_s.whence = MP_SEEK_CUR;
+        raw->ioctl(file, MP_STREAM_SEEK, (uintptr_t)&seek_s, &errcode);
+    }
+    fb->len = 0;
+    fb->pos = 0;
+    return errcode;
+}
+
+mp_uint_t mp_vfs_filebuf_read(mp_obj_t file, mp_vfs_filebuf_t *fb, const mp_stream_p_t *raw, void *buf, mp_uint_t size, int *errcode) {
+    if (fb->buf == NULL) {
+        return raw->read(file, buf, size, errcode);
+    }
+
+    if (fb->write) {
+        *errcode = filebuf_flush_write(file, fb, raw);
+        if (*errcode != 0) {
+            return MP_STREAM_ERROR;
+        }
+    }
+
+    uint8_t *dest = buf;
+    mp_uint_t done = 0;
+    while (size > 0) {
+        if (fb->pos < fb->len) {
+            size_t n = MIN(size, fb->len - fb->pos);
+            memcpy(dest + done, fb->buf + fb->pos, n);
+            fb->pos += n;
+            done += n;
+            size -= n;
+        } else if (size >= fb->size) {
+            // large reads go straight to the file
+            mp_uint_t n = raw->read(file, dest + done, size, errcode);
+            if (n == MP_STREAM_ERROR) {
+                return done > 0 ? done : MP_STREAM_ERROR;
+            }
+            done += n;
+            break;
+        } else {
+            mp_uint_t n = raw->read(file, fb->buf, fb->size, errcode);
+            if (n == MP_STREAM_ERROR) {
+                return done > 0 ? done : MP_STREAM_ERROR;
+            }
+            fb->len = n;
+            fb->pos = 0;
+            if (n == 0) {
+                // end of file
+                break;
+            }
+        }
+    }
+    return done;
+}
+
+mp_uint_t mp_vfs_filebuf_write(mp_obj_t file, mp_vfs_filebuf_t *fb, const mp_stream_p_t *raw, const void *buf, mp_uint_t size, int *errcode) {
+    if (fb->buf == NULL) {
+        return raw->write(file, buf, size, errcode);
+    }
+
+    if (!fb->write) {
+        *errcode = filebuf_drop_read(file, fb, raw);
+        if (*errcode != 0) {
+            return MP_STREAM_ERROR;
+        }
+        fb->write = true;
+    }
+
+    if (fb->len + size > fb->size) {
+        *errcode = filebuf_flush_write(file, fb, raw);
+        fb->write = true;
+        if (*errcode != 0) {
+            return MP_STREAM_ERROR;
+        }
+        if (size >= fb->size) {
+            // large writes go straight to the file
+            return raw->write(file, buf, size, errcode);
+        }
+    }
+
+    memcpy(fb->buf + fb->len, buf, size);
+    fb->len += size;
+    return size;
+}
+
+mp_uint_t mp_vfs_filebuf_ioctl(mp_obj_t file, mp_vfs_filebuf_t *fb, const mp_stream_p_t *raw, mp_uint_t request, uintptr_t arg, int *errcode) {
+    if (fb->buf == NULL && request != MP_STREAM_SET_BUFFER) {
+        return raw->ioctl(file, request, arg, errcode);
+    }
+
+    switch (request) {
+        case MP_STREAM_SET_BUFFER: {
+            // sizes of 0 and 1 both mean unbuffered, as for CPython's open()
+            *errcode = 0;
+            if (fb->buf != NULL) {
+                *errcode = fb->write ? filebuf_flush_write(file, fb, raw) : filebuf_drop_read(file, fb, raw);
+                m_del(uint8_t, fb->buf, fb->size);
+            }
+            fb->buf = arg > 1 ? m_new(uint8_t, arg) : NULL;
+            fb->size = arg;
+            fb->len = 0;
+            fb->pos = 0;
+            fb->write = false;
+            return *errcode != 0 ? MP_STREAM_ERROR : 0;
+        }
+
+        case MP_STREAM_SEEK: {
+            struct mp_stream_seek_t *s = (struct mp_stream_seek_t *)(uintptr_t)arg;
+            if (fb->write) {
+                *errcode = filebuf_flush_write(file, fb, raw);
+                if (*errcode != 0) {
+                    return MP_STREAM_ERROR;
+                }
+            } else {
+                if (s->whence == MP_SEEK_CUR) {
+                    // the file is ahead of the reader by the unread data
+                    s->offset -= (mp_off_t)(fb->len - fb->pos);
+                }
+                fb->len = 0;
+                fb->pos = 0;
+            }
+            return raw->ioctl(file, request, arg, errcode);
+        }
+
+        case MP_STREAM_FLUSH:
+        case MP_STREAM_CLOSE: {
+            *errcode = filebuf_flush_write(file, fb, raw);
+            int errcode2 = 0;
+            mp_uint_t ret = raw->ioctl(file, request, arg, &errcode2);
+            if (request == MP_STREAM_CLOSE) {
+                m_del(uint8_t, fb->buf, fb->size);
+                fb->buf = NULL;
+            }
+            if (*errcode != 0) {
+                return MP_STREAM_ERROR;
+            }
+            *errcode = errcode2;
+            return ret;
+        }
+
+        default:
+            return raw->ioctl(file, request, arg, errcode);
+    }
+}
+
+#endif // MICROPY_VFS && MICROPY_VFS_FILE_BUFFERING
@@ -32,7 +32,7 @@
 
 #if MICROPY_VFS && (MICROPY_VFS_LFS1 || MICROPY_VFS_LFS2)
 
-enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime };
+enum { LFS_MAKE_ARG_bdev, LFS_MAKE_ARG_readsize, LFS_MAKE_ARG_progsize, LFS_MAKE_ARG_lookahead, LFS_MAKE_ARG_mtime, LFS_MAKE_ARG_cachesize, LFS_MAKE_ARG_blockcycles };
 
 static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
@@ -40,8 +40,19 @@ static const mp_arg_t lfs_make_allowed_args[] = {
     { MP_QSTR_progsize, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_lookahead, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
     { MP_QSTR_mtime, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    { MP_QSTR_cachesize, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    { MP_QSTR_blockcycles, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100} },
 };
 
+#if MICROPY_VFS_LFS_STAT_CACHE
+typedef struct _mp_vfs_lfs_stat_cache_t {
+    char *path; // NULL if the entry is unused
+    uint8_t type; // 0 if the path doesn't exist
+    uint32_t size;
+    mp_uint_t mtime;
+} mp_vfs_lfs_stat_cache_t;
+#endif
+
 #if MICROPY_VFS_LFS1
 
 #include "lib/littlefs/lfs1.h"
@@ -61,6 +72,10 @@ typedef struct _mp_obj_vfs_lfs1_t {
     vstr_t cur_dir;
     struct lfs1_config config;
     lfs1_t lfs;
+    #if MICROPY_VFS_LFS_STAT_CACHE
+    mp_vfs_lfs_stat_cache_t stat_cache[MICROPY_VFS_LFS_STAT_CACHE];
+    size_t stat_cache_next;
+    #endif
 } mp_obj_vfs_lfs1_t;
 
 typedef struct _mp_obj_vfs_lfs1_file_t {
@@ -68,6 +83,9 @@ typedef struct _mp_obj_vfs_lfs1_file_t {
     mp_obj_vfs_lfs1_t *vfs;
     lfs1_file_t file;
     struct lfs1_file_config cfg;
+    #if MICROPY_VFS_FILE_BUFFERING
+    mp_vfs_filebuf_t fb;
+    #endif
     uint8_t file_buffer[0];
 } mp_obj_vfs_lfs1_file_t;
 
@@ -111,6 +129,10 @@ typedef struct _mp_obj_vfs_lfs2_t {
     vstr_t cur_dir;
     struct lfs2_config config;
     lfs2_t lfs;
+    #if MICROPY_VFS_LFS_STAT_CACHE
+    mp_vfs_lfs_stat_cache_t stat_cache[MICROPY_VFS_LFS_STAT_CACHE];
+    size_t stat_cache_next;
+    #endif
 } mp_obj_vfs_lfs2_t;
 
 typedef struct _mp_obj_vfs_lfs2_file_t {
@@ -120,6 +142,9 @@ typedef struct _mp_obj_vfs_lfs2_file_t {
     lfs2_file_t file;
     struct lfs2_file_config cfg;
     struct lfs2_attr attrs[1];
+    #if MICROPY_VFS_FILE_BUFFERING
+    mp_vfs_filebuf_t fb;
+    #endif
     uint8_t file_buffer[0];
 } mp_obj_vfs_lfs2_file_t;
 
@@ -61,7 +61,7 @@ STATIC int MP_VFS_LFSx(dev_sync)(const struct LFSx_API (config) * c) {
     return MP_VFS_LFSx(dev_ioctl)(c, MP_BLOCKDEV_IOCTL_SYNC, 0, false);
 }
 
-STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead) {
+STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size_t read_size, size_t prog_size, size_t lookahead, size_t cache_size, int block_cycles) {
     self->blockdev.flags = MP_BLOCKDEV_FLAG_FREE_OBJ;
     mp_vfs_blockdev_init(&self->blockdev, bdev);
 
@@ -90,14 +90,111 @@ STATIC void MP_VFS_LFSx(init_config)(MP_OBJ_VFS_LFSx * self, mp_obj_t bdev, size
     config->read_buffer = m_new(uint8_t, config->read_size);
     config->prog_buffer = m_new(uint8_t, config->prog_size);
     config->lookahead_buffer = m_new(uint8_t, config->lookahead / 8);
+    (void)cache_size;
+    (void)block_cycles;
     #else
-    config->block_cycles = 100;
-    config->cache_size = 4 * MAX(read_size, prog_size);
+    if (cache_size == 0) {
+        cache_size = 4 * MAX(read_size, prog_size);
+    } else if (cache_size % read_size != 0 || cache_size % prog_size != 0 || bs % cache_size != 0) {
+        // littlefs relies on these without checking them
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid cachesize"));
+    }
+    config->block_cycles = block_cycles;
+    config->cache_size = cache_size;
     config->lookahead_size = lookahead;
     config->read_buffer = m_new(uint8_t, config->cache_size);
     config->prog_buffer = m_new(uint8_t, config->cache_size);
     config->lookahead_buffer = m_new(uint8_t, config->lookahead_size);
     #endif
+
+    #if MICROPY_VFS_LFS_STAT_CACHE
+    memset(self->stat_cache, 0, sizeof(self->stat_cache));
+    self->stat_cache_next = 0;
+    #endif
+}
+
+// Forget all stat results, to be called before anything changes on the
+// filesystem.
+STATIC void MP_VFS_LFSx(stat_cache_clear)(MP_OBJ_VFS_LFSx * self) {
+    #if MICROPY_VFS_LFS_STAT_CACHE
+    for (size_t i = 0; i < MICROPY_VFS_LFS_STAT_CACHE; ++i) {
+        mp_vfs_lfs_stat_cache_t *entry = &self->stat_cache[i];
+        if (entry->path != NULL) {
+            m_del(char, entry->path, strlen(entry->path) + 1);
+            entry->path = NULL;
+        }
+    }
+    #else
+    (void)self;
+    #endif
+}
+
+// Get the type, size and (if mtime isn't NULL) modification time of path,
+// returning 0 on success or a negative littlefs error code.
+STATIC int MP_VFS_LFSx(stat_path)(MP_OBJ_VFS_LFSx * self, const char *path, uint8_t *type, uint32_t *size, mp_uint_t *mtime) {
+    #if MICROPY_VFS_LFS_STAT_CACHE
+    for (size_t i = 0; i < MICROPY_VFS_LFS_STAT_CACHE; ++i) {
+        mp_vfs_lfs_stat_cache_t *entry = &self->stat_cache[i];
+        if (entry->path != NULL && strcmp(entry->path, path) == 0) {
+            if (entry->type == 0) {
+                return LFSx_MACRO(_ERR_NOENT);
+            }
+            *type = entry->type;
+            *size = entry->size;
+            if (mtime != NULL) {
+                *mtime = entry->mtime;
+            }
+            return 0;
+        }
+    }
+    // cache the result with its mtime, whether or not this caller wants it
+    mp_uint_t mtime_cache;
+    if (mtime == NULL) {
+        mtime = &mtime_cache;
+    }
+    #endif
+
+    struct LFSx_API (info) info;
+    int ret = LFSx_API(stat)(&self->lfs, path, &info);
+    if (ret == 0) {
+        *type = info.type;
+        *size = info.size;
+        if (mtime != NULL) {
+            *mtime = 0;
+            #if LFS_BUILD_VERSION == 2
+            uint8_t mtime_buf[8];
+            lfs2_ssize_t sz = lfs2_getattr(&self->lfs, path, LFS_ATTR_MTIME, &mtime_buf, sizeof(mtime_buf));
+            if (sz == sizeof(mtime_buf)) {
+                uint64_t ns = 0;
+                for (size_t i = sizeof(mtime_buf); i > 0; --i) {
+                    ns = ns << 8 | mtime_buf[i - 1];
+                }
+                // On-disk storage of timestamps uses 1970 as the Epoch, so convert to host's Epoch.
+                *mtime = timeutils_seconds_since_epoch_from_nanoseconds_since_1970(ns);
+            }
+            #endif
+        }
+    }
+
+    #if MICROPY_VFS_LFS_STAT_CACHE
+    if (ret == 0 || ret == LFSx_MACRO(_ERR_NOENT)) {
+        size_t len = strlen(path) + 1;
+        char *path_copy = m_new_maybe(char, len);
+        if (path_copy != NULL) {
+            mp_vfs_lfs_stat_cache_t *entry = &self->stat_cache[self->stat_cache_next];
+            self->stat_cache_next = (self->stat_cache_next + 1) % MICROPY_VFS_LFS_STAT_CACHE;
+            if (entry->path != NULL) {
+                m_del(char, entry->path, strlen(entry->path) + 1);
+            }
+            entry->path = memcpy(path_copy, path, len);
+            entry->type = ret == 0 ? *type : 0;
+            entry->size = ret == 0 ? *size : 0;
+            entry->mtime = ret == 0 ? *mtime : 0;
+        }
+    }
+    #endif
+
+    return ret;
 }
 
 const char *MP_VFS_LFSx(make_path)(MP_OBJ_VFS_LFSx * self, mp_obj_t path_in) {
@@ -125,7 +222,8 @@ STATIC mp_obj_t MP_VFS_LFSx(make_new)(const mp_obj_type_t * type, size_t n_args,
     self->enable_mtime = args[LFS_MAKE_ARG_mtime].u_bool;
     #endif
     MP_VFS_LFSx(init_config)(self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_cachesize].u_int, args[LFS_MAKE_ARG_blockcycles].u_int);
     int ret = LFSx_API(mount)(&self->lfs, &self->config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -139,7 +237,8 @@ STATIC mp_obj_t MP_VFS_LFSx(mkfs)(size_t n_args, const mp_obj_t *pos_args, mp_ma
 
     MP_OBJ_VFS_LFSx self;
     MP_VFS_LFSx(init_config)(&self, args[LFS_MAKE_ARG_bdev].u_obj,
-        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int);
+        args[LFS_MAKE_ARG_readsize].u_int, args[LFS_MAKE_ARG_progsize].u_int, args[LFS_MAKE_ARG_lookahead].u_int,
+        args[LFS_MAKE_ARG_cachesize].u_int, args[LFS_MAKE_ARG_blockcycles].u_int);
     int ret = LFSx_API(format)(&self.lfs, &self.config);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -218,6 +317,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(MP_VFS_LFSx(ilistdir_obj), 1, 2, MP_V
 STATIC mp_obj_t MP_VFS_LFSx(remove)(mp_obj_t self_in, mp_obj_t path_in) {
     MP_OBJ_VFS_LFSx *self = MP_OBJ_TO_PTR(self_in);
     const char *path = MP_VFS_LFSx(make_path)(self, path_in);
+    MP_VFS_LFSx(stat_cache_clear)(self);
     int ret = LFSx_API(remove)(&self->lfs, path);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -229,6 +329,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(MP_VFS_LFSx(remove_obj), MP_VFS_LFSx(remove));
 STATIC mp_obj_t MP_VFS_LFSx(rmdir)(mp_obj_t self_in, mp_obj_t path_in) {
     MP_OBJ_VFS_LFSx *self = MP_OBJ_TO_PTR(self_in);
     const char *path = MP_VFS_LFSx(make_path)(self, path_in);
+    MP_VFS_LFSx(stat_cache_clear)(self);
     int ret = LFSx_API(remove)(&self->lfs, path);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -247,6 +348,7 @@ STATIC mp_obj_t MP_VFS_LFSx(rename)(mp_obj_t self_in, mp_obj_t path_old_in, mp_o
         vstr_add_strn(&path_new, vstr_str(&self->cur_dir), vstr_len(&self->cur_dir));
     }
     vstr_add_str(&path_new, path);
+    MP_VFS_LFSx(stat_cache_clear)(self);
     int ret = LFSx_API(rename)(&self->lfs, path_old, vstr_null_terminated_str(&path_new));
     vstr_clear(&path_new);
     if (ret < 0) {
@@ -259,6 +361,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_3(MP_VFS_LFSx(rename_obj), MP_VFS_LFSx(rename));
 STATIC mp_obj_t MP_VFS_LFSx(mkdir)(mp_obj_t self_in, mp_obj_t path_o) {
     MP_OBJ_VFS_LFSx *self = MP_OBJ_TO_PTR(self_in);
     const char *path = MP_VFS_LFSx(make_path)(self, path_o);
+    MP_VFS_LFSx(stat_cache_clear)(self);
     int ret = LFSx_API(mkdir)(&self->lfs, path);
     if (ret < 0) {
         mp_raise_OSError(-ret);
@@ -274,9 +377,10 @@ STATIC mp_obj_t MP_VFS_LFSx(chdir)(mp_obj_t self_in, mp_obj_t path_in) {
     const char *path = MP_VFS_LFSx(make_path)(self, path_in);
     if (path[1] != '\0') {
         // Not at root, check it exists
-        struct LFSx_API (info) info;
-        int ret = LFSx_API(stat)(&self->lfs, path, &info);
-        if (ret < 0 || info.type != LFSx_MACRO(_TYPE_DIR)) {
+        uint8_t type;
+        uint32_t size;
+        int ret = MP_VFS_LFSx(stat_path)(self, path, &type, &size, NULL);
+        if (ret < 0 || type != LFSx_MACRO(_TYPE_DIR)) {
             mp_raise_OSError(-MP_ENOENT);
         }
     }
@@ -349,34 +453,22 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(MP_VFS_LFSx(getcwd_obj), MP_VFS_LFSx(getcwd));
 STATIC mp_obj_t MP_VFS_LFSx(stat)(mp_obj_t self_in, mp_obj_t path_in) {
     MP_OBJ_VFS_LFSx *self = MP_OBJ_TO_PTR(self_in);
     const char *path = MP_VFS_LFSx(make_path)(self, path_in);
-    struct LFSx_API (info) info;
-    int ret = LFSx_API(stat)(&self->lfs, path, &info);
+    uint8_t type;
+    uint32_t size;
+    mp_uint_t mtime;
+    int ret = MP_VFS_LFSx(stat_path)(self, path, &type, &size, &mtime);
     if (ret < 0) {
         mp_raise_OSError(-ret);
     }
 
-    mp_uint_t mtime = 0;
-    #if LFS_BUILD_VERSION == 2
-    uint8_t mtime_buf[8];
-    lfs2_ssize_t sz = lfs2_getattr(&self->lfs, path, LFS_ATTR_MTIME, &mtime_buf, sizeof(mtime_buf));
-    if (sz == sizeof(mtime_buf)) {
-        uint64_t ns = 0;
-        for (size_t i = sizeof(mtime_buf); i > 0; --i) {
-            ns = ns << 8 | mtime_buf[i - 1];
-        }
-        // On-disk storage of timestamps uses 1970 as the Epoch, so convert to host's Epoch.
-        mtime = timeutils_seconds_since_epoch_from_nanoseconds_since_1970(ns);
-    }
-    #endif
-
     mp_obj_tuple_t *t = MP_OBJ_TO_PTR(mp_obj_new_tuple(10, NULL));
-    t->items[0] = MP_OBJ_NEW_SMALL_INT(info.type == LFSx_MACRO(_TYPE_REG) ? MP_S_IFREG : MP_S_IFDIR); // st_mode
+    t->items[0] = MP_OBJ_NEW_SMALL_INT(type == LFSx_MACRO(_TYPE_REG) ? MP_S_IFREG : MP_S_IFDIR); // st_mode
     t->items[1] = MP_OBJ_NEW_SMALL_INT(0); // st_ino
     t->items[2] = MP_OBJ_NEW_SMALL_INT(0); // st_dev
     t->items[3] = MP_OBJ_NEW_SMALL_INT(0); // st_nlink
     t->items[4] = MP_OBJ_NEW_SMALL_INT(0); // st_uid
     t->items[5] = MP_OBJ_NEW_SMALL_INT(0); // st_gid
-    t->items[6] = mp_obj_new_int_from_uint(info.size); // st_size
+    t->items[6] = mp_obj_new_int_from_uint(size); // st_size
     t->items[7] = mp_obj_new_int_from_uint(mtime); // st_atime
     t->items[8] = mp_obj_new_int_from_uint(mtime); // st_mtime
     t->items[9] = mp_obj_new_int_from_uint(mtime); // st_ctime
@@ -438,6 +530,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_3(MP_VFS_LFSx(mount_obj), MP_VFS_LFSx(mount));
 
 STATIC mp_obj_t MP_VFS_LFSx(umount)(mp_obj_t self_in) {
     MP_OBJ_VFS_LFSx *self = MP_OBJ_TO_PTR(self_in);
+    MP_VFS_LFSx(stat_cache_clear)(self);
     // LFS unmount never fails
     LFSx_API(unmount)(&self->lfs);
     return mp_const_none;
@@ -463,12 +556,13 @@ STATIC MP_DEFINE_CONST_DICT(MP_VFS_LFSx(locals_dict), MP_VFS_LFSx(locals_dict_ta
 
 STATIC mp_import_stat_t MP_VFS_LFSx(import_stat)(void *self_in, const char *path) {
     MP_OBJ_VFS_LFSx *self = self_in;
-    struct LFSx_API (info) info;
-    mp_obj_str_t path_obj = { { &mp_type_str }, 0, 0, (const byte *)path };
+    mp_obj_str_t path_obj = { { &mp_type_str }, 0, strlen(path), (const byte *)path };
     path = MP_VFS_LFSx(make_path)(self, MP_OBJ_FROM_PTR(&path_obj));
-    int ret = LFSx_API(stat)(&self->lfs, path, &info);
+    uint8_t type;
+    uint32_t size;
+    int ret = MP_VFS_LFSx(stat_path)(self, path, &type, &size, NULL);
     if (ret == 0) {
-        if (info.type == LFSx_MACRO(_TYPE_REG)) {
+        if (type == LFSx_MACRO(_TYPE_REG)) {
             return MP_IMPORT_STAT_FILE;
         } else {
             return MP_IMPORT_STAT_DIR;
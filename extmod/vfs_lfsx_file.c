@@ -95,6 +95,9 @@ mp_obj_t MP_VFS_LFSx(file_open)(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mod
     #endif
     o->base.type = type;
     o->vfs = self;
+    #if MICROPY_VFS_FILE_BUFFERING
+    o->fb.buf = NULL;
+    #endif
     #if !MICROPY_GC_CONSERVATIVE_CLEAR
     memset(&o->file, 0, sizeof(o->file));
     memset(&o->cfg, 0, sizeof(o->cfg));
@@ -113,6 +116,9 @@ mp_obj_t MP_VFS_LFSx(file_open)(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mod
     #endif
 
     const char *path = MP_VFS_LFSx(make_path)(self, path_in);
+    if (flags & LFSx_MACRO(_O_WRONLY)) {
+        MP_VFS_LFSx(stat_cache_clear)(self);
+    }
     int ret = LFSx_API(file_opencfg)(&self->lfs, &o->file, path, flags, &o->cfg);
     if (ret < 0) {
         o->vfs = NULL;
@@ -147,6 +153,7 @@ STATIC mp_uint_t MP_VFS_LFSx(file_write)(mp_obj_t self_in, const void *buf, mp_u
         lfs_get_mtime(&self->mtime[0]);
     }
     #endif
+    MP_VFS_LFSx(stat_cache_clear)(self->vfs);
     LFSx_API(ssize_t) sz = LFSx_API(file_write)(&self->vfs->lfs, &self->file, buf, size);
     if (sz < 0) {
         *errcode = -sz;
@@ -162,6 +169,11 @@ STATIC mp_uint_t MP_VFS_LFSx(file_ioctl)(mp_obj_t self_in, mp_uint_t request, ui
         MP_VFS_LFSx(check_open)(self);
     }
 
+    // the size and mtime of a file being written may change when it's synced
+    if (self->vfs != NULL && (self->file.flags & LFSx_MACRO(_O_WRONLY))) {
+        MP_VFS_LFSx(stat_cache_clear)(self->vfs);
+    }
+
     if (request == MP_STREAM_SEEK) {
         struct mp_stream_seek_t *s = (struct mp_stream_seek_t *)(uintptr_t)arg;
         int res = LFSx_API(file_seek)(&self->vfs->lfs, &self->file, s->offset, s->whence);
@@ -200,6 +212,37 @@ STATIC mp_uint_t MP_VFS_LFSx(file_ioctl)(mp_obj_t self_in, mp_uint_t request, ui
     }
 }
 
+#if MICROPY_VFS_FILE_BUFFERING
+STATIC const mp_stream_p_t MP_VFS_LFSx(file_unbuffered_p) = {
+    .read = MP_VFS_LFSx(file_read),
+    .write = MP_VFS_LFSx(file_write),
+    .ioctl = MP_VFS_LFSx(file_ioctl),
+};
+
+STATIC mp_uint_t MP_VFS_LFSx(file_buffered_read)(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
+    MP_OBJ_VFS_LFSx_FILE *self = MP_OBJ_TO_PTR(self_in);
+    return mp_vfs_filebuf_read(self_in, &self->fb, &MP_VFS_LFSx(file_unbuffered_p), buf, size, errcode);
+}
+
+STATIC mp_uint_t MP_VFS_LFSx(file_buffered_write)(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
+    MP_OBJ_VFS_LFSx_FILE *self = MP_OBJ_TO_PTR(self_in);
+    return mp_vfs_filebuf_write(self_in, &self->fb, &MP_VFS_LFSx(file_unbuffered_p), buf, size, errcode);
+}
+
+STATIC mp_uint_t MP_VFS_LFSx(file_buffered_ioctl)(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    MP_OBJ_VFS_LFSx_FILE *self = MP_OBJ_TO_PTR(self_in);
+    return mp_vfs_filebuf_ioctl(self_in, &self->fb, &MP_VFS_LFSx(file_unbuffered_p), request, arg, errcode);
+}
+
+#define FILE_READ MP_VFS_LFSx(file_buffered_read)
+#define FILE_WRITE MP_VFS_LFSx(file_buffered_write)
+#define FILE_IOCTL MP_VFS_LFSx(file_buffered_ioctl)
+#else
+#define FILE_READ MP_VFS_LFSx(file_read)
+#define FILE_WRITE MP_VFS_LFSx(file_write)
+#define FILE_IOCTL MP_VFS_LFSx(file_ioctl)
+#endif
+
 STATIC const mp_rom_map_elem_t MP_VFS_LFSx(file_locals_dict_table)[] = {
     { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
@@ -218,9 +261,9 @@ STATIC MP_DEFINE_CONST_DICT(MP_VFS_LFSx(file_locals_dict), MP_VFS_LFSx(file_loca
 
 #if MICROPY_PY_IO_FILEIO
 STATIC const mp_stream_p_t MP_VFS_LFSx(fileio_stream_p) = {
-    .read = MP_VFS_LFSx(file_read),
-    .write = MP_VFS_LFSx(file_write),
-    .ioctl = MP_VFS_LFSx(file_ioctl),
+    .read = FILE_READ,
+    .write = FILE_WRITE,
+    .ioctl = FILE_IOCTL,
 };
 
 const mp_obj_type_t MP_TYPE_VFS_LFSx_(_fileio) = {
@@ -235,9 +278,9 @@ const mp_obj_type_t MP_TYPE_VFS_LFSx_(_fileio) = {
 #endif
 
 STATIC const mp_stream_p_t MP_VFS_LFSx(textio_stream_p) = {
-    .read = MP_VFS_LFSx(file_read),
-    .write = MP_VFS_LFSx(file_write),
-    .ioctl = MP_VFS_LFSx(file_ioctl),
+    .read = FILE_READ,
+    .write = FILE_WRITE,
+    .ioctl = FILE_IOCTL,
     .is_text = true,
 };
 
@@ -250,3 +293,7 @@ const mp_obj_type_t MP_TYPE_VFS_LFSx_(_textio) = {
     .protocol = &MP_VFS_LFSx(textio_stream_p),
     .locals_dict = (mp_obj_dict_t *)&MP_VFS_LFSx(file_locals_dict),
 };
+
+#undef FILE_READ
+#undef FILE_WRITE
+#undef FILE_IOCTL
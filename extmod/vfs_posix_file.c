@@ -36,6 +36,8 @@
 #include <unistd.h>
 
 #ifdef _WIN32
+#include <io.h>
+#include <windows.h>
 #define fsync _commit
 #else
 #include <poll.h>
@@ -211,7 +213,34 @@ STATIC mp_uint_t vfs_posix_file_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_
         #if MICROPY_PY_USELECT
         case MP_STREAM_POLL: {
             #ifdef _WIN32
-            mp_raise_NotImplementedError(MP_ERROR_TEXT("poll on file not available on win32"));
+            // There is no poll() for CRT file descriptors, so ask the
+            // underlying handle: disk files are always ready, pipes are
+            // readable when they hold data (or are closed), and the console
+            // is readable when it has input events.
+            HANDLE h = (HANDLE)_get_osfhandle(o->fd);
+            mp_uint_t ret = arg & MP_STREAM_POLL_WR;
+            if (arg & MP_STREAM_POLL_RD) {
+                switch (GetFileType(h)) {
+                    case FILE_TYPE_PIPE: {
+                        DWORD avail;
+                        if (!PeekNamedPipe(h, NULL, 0, NULL, &avail, NULL)) {
+                            ret |= MP_STREAM_POLL_RD | MP_STREAM_POLL_HUP;
+                        } else if (avail > 0) {
+                            ret |= MP_STREAM_POLL_RD;
+                        }
+                        break;
+                    }
+                    case FILE_TYPE_CHAR:
+                        if (WaitForSingleObject(h, 0) == WAIT_OBJECT_0) {
+                            ret |= MP_STREAM_POLL_RD;
+                        }
+                        break;
+                    default:
+                        ret |= MP_STREAM_POLL_RD;
+                        break;
+                }
+            }
+            return ret;
             #else
             mp_uint_t ret = 0;
             uint8_t pollevents = 0;
@@ -247,6 +276,7 @@ STATIC const mp_rom_map_elem_t vfs_posix_rawfile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
     { MP_ROM_QSTR(MP_QSTR_readlines), MP_ROM_PTR(&mp_stream_unbuffered_readlines_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writev), MP_ROM_PTR(&mp_stream_writev_obj) },
     { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp_stream_seek_obj) },
     { MP_ROM_QSTR(MP_QSTR_tell), MP_ROM_PTR(&mp_stream_tell_obj) },
     { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&mp_stream_flush_obj) },
@@ -28,6 +28,7 @@
 #include <string.h>
 
 #include "py/runtime.h"
+#include "py/mperrno.h"
 #include "py/stream.h"
 #include "py/reader.h"
 #include "extmod/vfs.h"
@@ -38,44 +39,83 @@ typedef struct _mp_reader_vfs_t {
     mp_obj_t file;
     uint16_t len;
     uint16_t pos;
-    byte buf[24];
+    byte buf[MICROPY_READER_VFS_BUF_SIZE];
 } mp_reader_vfs_t;
 
-STATIC mp_uint_t mp_reader_vfs_readbyte(void *data) {
-    mp_reader_vfs_t *reader = (mp_reader_vfs_t *)data;
+STATIC bool mp_reader_vfs_fill(mp_reader_vfs_t *reader) {
     if (reader->pos >= reader->len) {
-        if (reader->len < sizeof(reader->buf)) {
-            return MP_READER_EOF;
+        // a read may return fewer bytes than requested, so only a length of
+        // zero indicates the end of the file
+        if (reader->len == 0) {
+            return false;
         } else {
             int errcode;
             reader->len = mp_stream_rw(reader->file, reader->buf, sizeof(reader->buf),
                 &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
+            reader->pos = 0;
             if (errcode != 0) {
                 // TODO handle errors properly
-                return MP_READER_EOF;
+                reader->len = 0;
+                return false;
             }
             if (reader->len == 0) {
-                return MP_READER_EOF;
+                return false;
             }
-            reader->pos = 0;
         }
     }
+    return true;
+}
+
+STATIC mp_uint_t mp_reader_vfs_readbyte(void *data) {
+    mp_reader_vfs_t *reader = (mp_reader_vfs_t *)data;
+    if (!mp_reader_vfs_fill(reader)) {
+        return MP_READER_EOF;
+    }
     return reader->buf[reader->pos++];
 }
 
+#if MICROPY_READER_BULK
+STATIC size_t mp_reader_vfs_read(void *data, byte *buf, size_t len) {
+    mp_reader_vfs_t *reader = (mp_reader_vfs_t *)data;
+    size_t n = 0;
+    while (n < len && mp_reader_vfs_fill(reader)) {
+        size_t avail = MIN(len - n, (size_t)(reader->len - reader->pos));
+        memcpy(buf + n, reader->buf + reader->pos, avail);
+        reader->pos += avail;
+        n += avail;
+    }
+    return n;
+}
+
+STATIC size_t mp_reader_vfs_readchunk(void *data, const byte **buf) {
+    mp_reader_vfs_t *reader = (mp_reader_vfs_t *)data;
+    if (!mp_reader_vfs_fill(reader)) {
+        return 0;
+    }
+    size_t n = reader->len - reader->pos;
+    *buf = reader->buf + reader->pos;
+    reader->pos = reader->len;
+    return n;
+}
+#endif
+
 STATIC void mp_reader_vfs_close(void *data) {
     mp_reader_vfs_t *reader = (mp_reader_vfs_t *)data;
     mp_stream_close(reader->file);
     m_del_obj(mp_reader_vfs_t, reader);
 }
 
-void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
-    mp_reader_vfs_t *rf = m_new_obj(mp_reader_vfs_t);
+STATIC mp_obj_t mp_reader_vfs_open(const char *filename) {
     mp_obj_t args[2] = {
         mp_obj_new_str(filename, strlen(filename)),
         MP_OBJ_NEW_QSTR(MP_QSTR_rb),
     };
-    rf->file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+    return mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+}
+
+STATIC void mp_reader_vfs_new(mp_reader_t *reader, mp_obj_t file) {
+    mp_reader_vfs_t *rf = m_new_obj(mp_reader_vfs_t);
+    rf->file = file;
     int errcode;
     rf->len = mp_stream_rw(rf->file, rf->buf, sizeof(rf->buf), &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
     if (errcode != 0) {
@@ -84,7 +124,39 @@ void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
     rf->pos = 0;
     reader->data = rf;
     reader->readbyte = mp_reader_vfs_readbyte;
+    #if MICROPY_READER_BULK
+    reader->read = mp_reader_vfs_read;
+    reader->readchunk = mp_reader_vfs_readchunk;
+    #endif
     reader->close = mp_reader_vfs_close;
 }
 
+void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
+    mp_obj_t file = mp_reader_vfs_open(filename);
+    #if MICROPY_READER_ROM
+    // A file that exposes its contents as a read-only buffer lives in
+    // memory-mapped storage, so read it in place.
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(file, &bufinfo, MP_BUFFER_READ)) {
+        mp_reader_new_mem(reader, bufinfo.buf, bufinfo.len, MP_READER_IS_ROM);
+        return;
+    }
+    #endif
+    mp_reader_vfs_new(reader, file);
+}
+
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+void mp_reader_new_file_at(mp_reader_t *reader, const char *filename, size_t offset) {
+    mp_obj_t file = mp_reader_vfs_open(filename);
+    const mp_stream_p_t *stream_p = mp_get_stream(file);
+    struct mp_stream_seek_t seek_s = { .offset = offset, .whence = MP_SEEK_SET };
+    int errcode;
+    if (stream_p->ioctl == NULL || stream_p->ioctl(file, MP_STREAM_SEEK, (uintptr_t)&seek_s, &errcode) == MP_STREAM_ERROR) {
+        mp_stream_close(file);
+        mp_raise_OSError(stream_p->ioctl == NULL ? MP_EOPNOTSUPP : errcode);
+    }
+    mp_reader_vfs_new(reader, file);
+}
+#endif
+
 #endif // MICROPY_READER_VFS
@@ -0,0 +1,340 @@
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include "re1.5.h"
+
+// One-pass matching.  A program is one-pass if, at every split, the sets
+// of bytes which each branch can consume first are disjoint, and at most
+// one branch can reach Match without consuming input.  The next input
+// byte then picks the branch the backtracker would succeed on, except
+// that a branch which consumes it may fail later and the backtracker
+// would then match with the other branch right there.  Such a match is
+// checked straight away and remembered, so the subject is walked once per
+// start position, without recursion.
+//
+// Tables, built by re1_5_onepass_build():
+// - ONEPASS_ENTRY_SIZE bytes for the program start: first bytes, flags;
+// - bytelen bytes mapping the offset of each split to its number;
+// - ONEPASS_ENTRY_SIZE bytes for each split: first bytes of the preferred
+//   branch, flags.
+
+#define ONEPASS_ENTRY_SIZE (33)
+#define ONEPASS_PREF_EMPTY (1) // preferred branch may match without input
+#define ONEPASS_ALT_EMPTY (2) // other branch may match without input
+#define ONEPASS_MAX_SPLITS (255)
+
+#define ONEPASS_HAS(set, c) ((set)[(unsigned char)(c) >> 3] & (1 << ((unsigned char)(c) & 7)))
+#define ONEPASS_SPLIT(prog, tables, pc) \
+    ((const unsigned char *)(tables) + ONEPASS_ENTRY_SIZE + (prog)->bytelen \
+    + (unsigned char)(tables)[ONEPASS_ENTRY_SIZE + ((pc) - (prog)->insts)] * ONEPASS_ENTRY_SIZE)
+
+static int _inst_len(const char *pc)
+{
+    switch (*pc) {
+    case Class:
+    case ClassNot:
+        return 2 + *(unsigned char *)(pc + 1) * 2;
+    case Any:
+    case Bol:
+    case Eol:
+    case Match:
+        return 1;
+    default:
+        return 2;
+    }
+}
+
+// Add to first the bytes which may be consumed first from pc, and return
+// whether Match may be reached without consuming input (assuming any
+// assertions hold).  visited marks instructions already walked.
+static int _onepass_first(ByteProg *prog, int pc, unsigned char *first, unsigned char *visited)
+{
+    int empty = 0;
+
+    re1_5_stack_chk();
+
+    for (;;) {
+        const char *p = prog->insts + pc;
+        if (visited[pc >> 3] & (1 << (pc & 7))) {
+            return empty;
+        }
+        visited[pc >> 3] |= 1 << (pc & 7);
+
+        switch (*p) {
+        case Char:
+            first[(unsigned char)p[1] >> 3] |= 1 << ((unsigned char)p[1] & 7);
+            return empty;
+        case Any:
+            memset(first, 0xff, 32);
+            return empty;
+        case Class:
+        case ClassNot:
+        case NamedClass:
+            for (int c = 0; c < 256; c++) {
+                char ch = c;
+                if (*p == NamedClass ? _re1_5_namedclassmatch(p + 1, &ch) : _re1_5_classmatch(p + 1, &ch)) {
+                    first[c >> 3] |= 1 << (c & 7);
+                }
+            }
+            return empty;
+        case Match:
+            return 1;
+        case Jmp:
+            pc += 2 + (signed char)p[1];
+            continue;
+        case Split:
+        case RSplit:
+            empty |= _onepass_first(prog, pc + 2 + (signed char)p[1], first, visited);
+            pc += 2;
+            continue;
+        default: // Save, Bol, Eol
+            pc += _inst_len(p);
+            continue;
+        }
+    }
+}
+
+int re1_5_onepass_size(ByteProg *prog)
+{
+    int splits = 0;
+    for (int pc = NON_ANCHORED_PREFIX; pc < prog->bytelen; pc += _inst_len(prog->insts + pc)) {
+        if (prog->insts[pc] == Split || prog->insts[pc] == RSplit) {
+            splits++;
+        }
+    }
+    return ONEPASS_ENTRY_SIZE + prog->bytelen + splits * ONEPASS_ENTRY_SIZE;
+}
+
+// visited is scratch space of (bytelen + 7) / 8 bytes.  Returns 0 if the
+// program is one-pass and tables were filled in.
+int re1_5_onepass_build(ByteProg *prog, char *tables, unsigned char *visited)
+{
+    int visited_len = (prog->bytelen + 7) / 8;
+    unsigned char *start = (unsigned char *)tables;
+    unsigned char *index = start + ONEPASS_ENTRY_SIZE;
+    unsigned char *entry = index + prog->bytelen;
+    int splits = 0;
+
+    memset(tables, 0, re1_5_onepass_size(prog));
+    memset(visited, 0, visited_len);
+    start[32] = _onepass_first(prog, NON_ANCHORED_PREFIX, start, visited);
+
+    for (int pc = NON_ANCHORED_PREFIX; pc < prog->bytelen; pc += _inst_len(prog->insts + pc)) {
+        const char *p = prog->insts + pc;
+        if (*p != Split && *p != RSplit) {
+            continue;
+        }
+        if (splits == ONEPASS_MAX_SPLITS) {
+            return 1;
+        }
+        index[pc] = splits++;
+
+        int next = pc + 2;
+        int jump = pc + 2 + (signed char)p[1];
+        unsigned char alt_first[32] = {0};
+        memset(visited, 0, visited_len);
+        int pref_empty = _onepass_first(prog, *p == Split ? next : jump, entry, visited);
+        memset(visited, 0, visited_len);
+        int alt_empty = _onepass_first(prog, *p == Split ? jump : next, alt_first, visited);
+
+        if (pref_empty && alt_empty) {
+            return 1;
+        }
+        for (int i = 0; i < 32; i++) {
+            if (entry[i] & alt_first[i]) {
+                return 1;
+            }
+        }
+        entry[32] = (pref_empty ? ONEPASS_PREF_EMPTY : 0) | (alt_empty ? ONEPASS_ALT_EMPTY : 0);
+        entry += ONEPASS_ENTRY_SIZE;
+    }
+
+    return 0;
+}
+
+// Follow pc to Match without consuming input, taking at each split the
+// branch which may do so, and recording saves in subp.
+static int _onepass_empty(ByteProg *prog, const char *tables, const char *pc, const char *sp, Subject *input, const char **subp, int nsubp)
+{
+    for (int steps = prog->bytelen; steps; steps--) {
+        switch (*pc) {
+        case Match:
+            return 1;
+        case Jmp:
+            pc += 2 + (signed char)pc[1];
+            continue;
+        case Split:
+        case RSplit: {
+            int flags = ONEPASS_SPLIT(prog, tables, pc)[32];
+            int take_jump;
+            if (flags & ONEPASS_PREF_EMPTY) {
+                take_jump = *pc == RSplit;
+            } else if (flags & ONEPASS_ALT_EMPTY) {
+                take_jump = *pc == Split;
+            } else {
+                return 0;
+            }
+            pc += 2 + (take_jump ? (signed char)pc[1] : 0);
+            continue;
+        }
+        case Save:
+            if ((unsigned char)pc[1] < nsubp) {
+                subp[(unsigned char)pc[1]] = sp;
+            }
+            pc += 2;
+            continue;
+        case Bol:
+            if (sp != input->begin_line) {
+                return 0;
+            }
+            pc++;
+            continue;
+        case Eol:
+            if (sp != input->end) {
+                return 0;
+            }
+            pc++;
+            continue;
+        default:
+            return 0;
+        }
+    }
+    return 0;
+}
+
+// Match anchored at sp, with scratch space for 2 * nsubp pointers. Returns
+// 1 on match, 0 if none, -1 if the step limit was hit.
+static int _onepass_at(ByteProg *prog, const char *tables, const char *sp, Subject *input, const char **subp, int nsubp, const char **scratch)
+{
+    const char **fallback = scratch + nsubp;
+    int have_fallback = 0;
+    int steps = 0; // instructions run since the last byte was consumed
+    const char *pc = prog->insts + NON_ANCHORED_PREFIX;
+
+    for (;;) {
+        if (++steps > prog->bytelen) {
+            return -1;
+        }
+        if (inst_is_consumer(*pc) && sp >= input->end) {
+            goto fail;
+        }
+        switch (*pc) {
+        case Char:
+            if (*sp != pc[1]) {
+                goto fail;
+            }
+            pc += 2;
+            sp++;
+            steps = 0;
+            continue;
+        case Any:
+            pc++;
+            sp++;
+            steps = 0;
+            continue;
+        case Class:
+        case ClassNot:
+            if (!_re1_5_classmatch(pc + 1, sp)) {
+                goto fail;
+            }
+            pc += _inst_len(pc);
+            sp++;
+            steps = 0;
+            continue;
+        case NamedClass:
+            if (!_re1_5_namedclassmatch(pc + 1, sp)) {
+                goto fail;
+            }
+            pc += 2;
+            sp++;
+            steps = 0;
+            continue;
+        case Match:
+            return 1;
+        case Jmp:
+            pc += 2 + (signed char)pc[1];
+            continue;
+        case Split:
+        case RSplit: {
+            const unsigned char *entry = ONEPASS_SPLIT(prog, tables, pc);
+            const char *pref = pc + 2;
+            const char *alt = pc + 2;
+            if (*pc == Split) {
+                alt += (signed char)pc[1];
+            } else {
+                pref += (signed char)pc[1];
+            }
+            if (sp < input->end && ONEPASS_HAS(entry, *sp)) {
+                // Only the preferred branch can consume the next byte; if it
+                // fails later, the backtracker would match here with the other
+                if (entry[32] & ONEPASS_ALT_EMPTY) {
+                    memcpy(scratch, subp, nsubp * sizeof(*subp));
+                    if (_onepass_empty(prog, tables, alt, sp, input, scratch, nsubp)) {
+                        memcpy(fallback, scratch, nsubp * sizeof(*subp));
+                        have_fallback = 1;
+                    }
+                }
+                pc = pref;
+            } else {
+                // The preferred branch can only match without input
+                if (entry[32] & ONEPASS_PREF_EMPTY) {
+                    memcpy(scratch, subp, nsubp * sizeof(*subp));
+                    if (_onepass_empty(prog, tables, pref, sp, input, scratch, nsubp)) {
+                        memcpy(subp, scratch, nsubp * sizeof(*subp));
+                        return 1;
+                    }
+                }
+                pc = alt;
+            }
+            continue;
+        }
+        case Save:
+            if ((unsigned char)pc[1] < nsubp) {
+                subp[(unsigned char)pc[1]] = sp;
+            }
+            pc += 2;
+            continue;
+        case Bol:
+            if (sp != input->begin_line) {
+                goto fail;
+            }
+            pc++;
+            continue;
+        case Eol:
+            if (sp != input->end) {
+                goto fail;
+            }
+            pc++;
+            continue;
+        }
+        re1_5_fatal("onepass");
+    }
+
+fail:
+    if (have_fallback) {
+        memcpy(subp, fallback, nsubp * sizeof(*subp));
+        return 1;
+    }
+    return 0;
+}
+
+// Same results as re1_5_recursiveloopprog(), for a one-pass program with
+// tables from re1_5_onepass_build(); scratch has space for 2 * nsubp
+// pointers.  Returns -1 if the backtracker should be used instead.
+int re1_5_onepassprog(ByteProg *prog, const char *tables, Subject *input, const char **subp, int nsubp, int is_anchored, const char **scratch)
+{
+    const unsigned char *start = (const unsigned char *)tables;
+    for (const char *sp = input->begin;; sp++) {
+        // skip start positions where no match can begin
+        if ((sp < input->end && ONEPASS_HAS(start, *sp)) || start[32]) {
+            memset((char **)subp, 0, nsubp * sizeof(*subp));
+            int res = _onepass_at(prog, tables, sp, input, subp, nsubp, scratch);
+            if (res != 0) {
+                return res;
+            }
+        }
+        if (is_anchored || sp >= input->end) {
+            return 0;
+        }
+    }
+}
@@ -144,10 +144,13 @@ int re1_5_pikevm(ByteProg*, Subject*, const char**, int, int);
 int re1_5_recursiveloopprog(ByteProg*, Subject*, const char**, int, int);
 int re1_5_recursiveprog(ByteProg*, Subject*, const char**, int, int);
 int re1_5_thompsonvm(ByteProg*, Subject*, const char**, int, int);
+int re1_5_onepassprog(ByteProg*, const char*, Subject*, const char**, int, int, const char**);
 
 int re1_5_sizecode(const char *re);
 int re1_5_compilecode(ByteProg *prog, const char *re);
 void re1_5_dumpcode(ByteProg *prog);
+int re1_5_onepass_size(ByteProg *prog);
+int re1_5_onepass_build(ByteProg *prog, char *tables, unsigned char *visited);
 void cleanmarks(ByteProg *prog);
 int _re1_5_classmatch(const char *pc, const char *sp);
 int _re1_5_namedclassmatch(const char *pc, const char *sp);
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) uzlib authors
+ *
+ * This software is provided 'as-is', without any express
+ * or implied warranty.  In no event will the authors be
+ * held liable for any damages arising from the use of
+ * this software.
+ *
+ * Permission is granted to anyone to use this software
+ * for any purpose, including commercial applications,
+ * and to alter it and redistribute it freely, subject to
+ * the following restrictions:
+ *
+ * 1. The origin of this software must not be
+ *    misrepresented; you must not claim that you
+ *    wrote the original software. If you use this
+ *    software in a product, an acknowledgment in
+ *    the product documentation would be appreciated
+ *    but is not required.
+ *
+ * 2. Altered source versions must be plainly marked
+ *    as such, and must not be misrepresented as
+ *    being the original software.
+ *
+ * 3. This notice may not be removed or altered from
+ *    any source distribution.
+ */
+
+/* Bit output and static Huffman coding for the DEFLATE compressor.  Only
+   the fixed codes of RFC 1951 section 3.2.6 are used, so no trees need to
+   be built or sent.
+
+   outbits() doesn't grow the output buffer: the caller makes sure there
+   is room, which is at most 9 bits per input byte plus block overhead. */
+
+#include "uzlib.h"
+
+void outbits(struct Outbuf *out, unsigned long bits, int nbits)
+{
+    out->outbits |= bits << out->noutbits;
+    out->noutbits += nbits;
+    while (out->noutbits >= 8) {
+        out->outbuf[out->outlen++] = (unsigned char)(out->outbits & 0xff);
+        out->outbits >>= 8;
+        out->noutbits -= 8;
+    }
+}
+
+/* Huffman codes are sent most significant bit first, the rest of the
+   stream is least significant bit first, so codes are mirrored. */
+static const unsigned char mirror4[16] = {
+    0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf,
+};
+
+static unsigned mirror8(unsigned c)
+{
+    return (mirror4[c & 0xf] << 4) | mirror4[(c >> 4) & 0xf];
+}
+
+static void outcode(struct Outbuf *out, unsigned sym)
+{
+    if (sym < 144) {
+        outbits(out, mirror8(0x30 + sym), 8);
+    } else if (sym < 256) {
+        unsigned code = 0x190 + sym - 144;
+        outbits(out, (mirror8(code & 0xff) << 1) | (code >> 8), 9);
+    } else if (sym < 280) {
+        outbits(out, mirror8(sym - 256) >> 1, 7);
+    } else {
+        outbits(out, mirror8(0xc0 + sym - 280), 8);
+    }
+}
+
+static const unsigned short defl_length_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+
+static const unsigned short defl_dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+
+static int length_extra(int code)
+{
+    return (code < 8 || code == 28) ? 0 : (code - 4) >> 2;
+}
+
+static int dist_extra(int code)
+{
+    return code < 4 ? 0 : (code - 2) >> 1;
+}
+
+/* Start a non-final block using the static codes. */
+void zlib_start_block(struct Outbuf *out)
+{
+    outbits(out, 0, 1); /* BFINAL */
+    outbits(out, 1, 2); /* BTYPE = static Huffman */
+}
+
+/* End the current block; the caller decides what follows it. */
+void zlib_finish_block(struct Outbuf *out)
+{
+    outcode(out, 256);
+}
+
+void zlib_literal(struct Outbuf *out, unsigned char c)
+{
+    outcode(out, c);
+}
+
+void zlib_match(struct Outbuf *out, int distance, int len)
+{
+    int code = 28;
+    while (defl_length_base[code] > len) {
+        code--;
+    }
+    outcode(out, 257 + code);
+    outbits(out, len - defl_length_base[code], length_extra(code));
+
+    code = 29;
+    while (defl_dist_base[code] > distance) {
+        code--;
+    }
+    outbits(out, mirror8(code) >> 3, 5);
+    outbits(out, distance - defl_dist_base[code], dist_extra(code));
+}
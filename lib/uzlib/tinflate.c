@@ -121,31 +121,6 @@ static void tinf_build_bits_base(unsigned char *bits, unsigned short *base, int
 }
 #endif
 
-/* build the fixed huffman trees */
-static void tinf_build_fixed_trees(TINF_TREE *lt, TINF_TREE *dt)
-{
-   int i;
-
-   /* build fixed length tree */
-   for (i = 0; i < 7; ++i) lt->table[i] = 0;
-
-   lt->table[7] = 24;
-   lt->table[8] = 152;
-   lt->table[9] = 112;
-
-   for (i = 0; i < 24; ++i) lt->trans[i] = 256 + i;
-   for (i = 0; i < 144; ++i) lt->trans[24 + i] = i;
-   for (i = 0; i < 8; ++i) lt->trans[24 + 144 + i] = 280 + i;
-   for (i = 0; i < 112; ++i) lt->trans[24 + 144 + 8 + i] = 144 + i;
-
-   /* build fixed distance tree */
-   for (i = 0; i < 5; ++i) dt->table[i] = 0;
-
-   dt->table[5] = 32;
-
-   for (i = 0; i < 32; ++i) dt->trans[i] = i;
-}
-
 /* given an array of code lengths, build a tree */
 static void tinf_build_tree(TINF_TREE *t, const unsigned char *lengths, unsigned int num)
 {
@@ -183,13 +158,50 @@ static void tinf_build_tree(TINF_TREE *t, const unsigned char *lengths, unsigned
    {
       if (lengths[i]) t->trans[offs[lengths[i]]++] = i;
    }
+
+#if UZLIB_CONF_LUT_BITS
+   /* fill the lookup table for codes up to UZLIB_CONF_LUT_BITS long; it
+      is indexed by the next bits of the stream, which hold the code
+      mirrored, so each code fills every entry having it as low bits */
+   {
+      unsigned int len, code = 0, idx = 0;
+      for (i = 0; i < (1 << UZLIB_CONF_LUT_BITS); ++i) t->lut[i] = 0;
+      for (len = 1; len <= UZLIB_CONF_LUT_BITS; ++len, code <<= 1)
+      {
+         unsigned int n;
+         for (n = t->table[len]; n; --n, ++code, ++idx)
+         {
+            unsigned int rev = 0, c = code, k;
+            for (k = len; k; --k, c >>= 1) rev = (rev << 1) | (c & 1);
+            for (k = rev; k < (1 << UZLIB_CONF_LUT_BITS); k += 1 << len)
+               t->lut[k] = t->trans[idx] | len << 9;
+         }
+      }
+   }
+#endif
+}
+
+/* build the fixed huffman trees */
+static void tinf_build_fixed_trees(TINF_TREE *lt, TINF_TREE *dt)
+{
+   unsigned char lengths[288];
+   int i;
+
+   for (i = 0; i < 144; ++i) lengths[i] = 8;
+   for (; i < 256; ++i) lengths[i] = 9;
+   for (; i < 280; ++i) lengths[i] = 7;
+   for (; i < 288; ++i) lengths[i] = 8;
+   tinf_build_tree(lt, lengths, 288);
+
+   for (i = 0; i < 32; ++i) lengths[i] = 5;
+   tinf_build_tree(dt, lengths, 32);
 }
 
 /* ---------------------- *
  * -- decode functions -- *
  * ---------------------- */
 
-unsigned char uzlib_get_byte(TINF_DATA *d)
+static unsigned char tinf_get_source_byte(TINF_DATA *d)
 {
     /* If end of source buffer is not reached, return next byte from source
        buffer. */
@@ -215,6 +227,21 @@ unsigned char uzlib_get_byte(TINF_DATA *d)
     return 0;
 }
 
+/* read a whole byte, skipping the rest of a partly used one; bytes the
+   bit reader already loaded ahead are returned first */
+unsigned char uzlib_get_byte(TINF_DATA *d)
+{
+    d->tag >>= d->bitcount & 7;
+    d->bitcount &= ~7;
+    if (d->bitcount) {
+        unsigned char c = d->tag;
+        d->tag >>= 8;
+        d->bitcount -= 8;
+        return c;
+    }
+    return tinf_get_source_byte(d);
+}
+
 uint32_t tinf_get_le_uint32(TINF_DATA *d)
 {
     uint32_t val = 0;
@@ -235,22 +262,27 @@ uint32_t tinf_get_be_uint32(TINF_DATA *d)
     return val;
 }
 
+/* make sure there are at least num bits in tag */
+static void tinf_need_bits(TINF_DATA *d, unsigned int num)
+{
+   while (d->bitcount < num)
+   {
+      d->tag |= (unsigned int)tinf_get_source_byte(d) << d->bitcount;
+      d->bitcount += 8;
+   }
+}
+
 /* get one bit from source stream */
 static int tinf_getbit(TINF_DATA *d)
 {
    unsigned int bit;
 
-   /* check if tag is empty */
-   if (!d->bitcount--)
-   {
-      /* load next tag */
-      d->tag = uzlib_get_byte(d);
-      d->bitcount = 7;
-   }
+   tinf_need_bits(d, 1);
 
    /* shift bit out of tag */
    bit = d->tag & 0x01;
    d->tag >>= 1;
+   d->bitcount--;
 
    return bit;
 }
@@ -258,17 +290,14 @@ static int tinf_getbit(TINF_DATA *d)
 /* read a num bit value from a stream and add base */
 static unsigned int tinf_read_bits(TINF_DATA *d, int num, int base)
 {
-   unsigned int val = 0;
+   unsigned int val;
 
-   /* read num bits */
-   if (num)
-   {
-      unsigned int limit = 1 << (num);
-      unsigned int mask;
+   if (!num) return base;
 
-      for (mask = 1; mask < limit; mask *= 2)
-         if (tinf_getbit(d)) val += mask;
-   }
+   tinf_need_bits(d, num);
+   val = d->tag & ((1u << num) - 1);
+   d->tag >>= num;
+   d->bitcount -= num;
 
    return val + base;
 }
@@ -278,6 +307,28 @@ static int tinf_decode_symbol(TINF_DATA *d, TINF_TREE *t)
 {
    int sum = 0, cur = 0, len = 0;
 
+#if UZLIB_CONF_LUT_BITS
+   /* short codes are looked up in one go; the bits for this are only
+      taken from the source buffer, as reading further ahead with
+      readSource could go past the end of the stream */
+   while (d->bitcount < UZLIB_CONF_LUT_BITS && d->source < d->source_limit)
+   {
+      d->tag |= (unsigned int)*d->source++ << d->bitcount;
+      d->bitcount += 8;
+   }
+   if (d->bitcount >= UZLIB_CONF_LUT_BITS)
+   {
+      unsigned int entry = t->lut[d->tag & ((1 << UZLIB_CONF_LUT_BITS) - 1)];
+      if (entry)
+      {
+         len = entry >> 9;
+         d->tag >>= len;
+         d->bitcount -= len;
+         return entry & 0x1ff;
+      }
+   }
+#endif
+
    /* get more bits while code value is above sum */
    do {
 
@@ -402,9 +453,13 @@ static int tinf_decode_trees(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
  * -- block inflate functions -- *
  * ----------------------------- */
 
-/* given a stream and two trees, inflate next byte of output */
+/* given a stream and two trees, inflate output until dest_limit is reached
+   or the block ends */
 static int tinf_inflate_block_data(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
 {
+  while (d->dest < d->dest_limit) {
+    unsigned int n;
+
     if (d->curlen == 0) {
         unsigned int offs;
         int dist;
@@ -418,7 +473,7 @@ static int tinf_inflate_block_data(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
         /* literal byte */
         if (sym < 256) {
             TINF_PUT(d, sym);
-            return TINF_OK;
+            continue;
         }
 
         /* end of block */
@@ -471,27 +526,37 @@ static int tinf_inflate_block_data(TINF_DATA *d, TINF_TREE *lt, TINF_TREE *dt)
         }
     }
 
-    /* copy next byte from dict substring */
+    /* copy as much of the dict substring as fits */
+    n = d->dest_limit - d->dest;
+    if (n > d->curlen) {
+        n = d->curlen;
+    }
+    d->curlen -= n;
     if (d->dict_ring) {
-        TINF_PUT(d, d->dict_ring[d->lzOff]);
-        if ((unsigned)++d->lzOff == d->dict_size) {
-            d->lzOff = 0;
+        for (; n; --n) {
+            TINF_PUT(d, d->dict_ring[d->lzOff]);
+            if ((unsigned)++d->lzOff == d->dict_size) {
+                d->lzOff = 0;
+            }
         }
     } else {
-        d->dest[0] = d->dest[d->lzOff];
-        d->dest++;
+        for (; n; --n) {
+            d->dest[0] = d->dest[d->lzOff];
+            d->dest++;
+        }
     }
-    d->curlen--;
-    return TINF_OK;
+  }
+  return TINF_OK;
 }
 
-/* inflate next byte from uncompressed block of data */
+/* inflate data from uncompressed block until dest_limit is reached or the
+   block ends */
 static int tinf_inflate_uncompressed_block(TINF_DATA *d)
 {
     if (d->curlen == 0) {
         unsigned int length, invlength;
 
-        /* get length */
+        /* get length, on a byte boundary */
         length = uzlib_get_byte(d);
         length += 256 * uzlib_get_byte(d);
         /* get one's complement of length */
@@ -503,17 +568,16 @@ static int tinf_inflate_uncompressed_block(TINF_DATA *d)
         /* increment length to properly return TINF_DONE below, without
            producing data at the same time */
         d->curlen = length + 1;
-
-        /* make sure we start next block on a byte boundary */
-        d->bitcount = 0;
     }
 
-    if (--d->curlen == 0) {
-        return TINF_DONE;
-    }
+    while (d->dest < d->dest_limit) {
+        if (--d->curlen == 0) {
+            return TINF_DONE;
+        }
 
-    unsigned char c = uzlib_get_byte(d);
-    TINF_PUT(d, c);
+        unsigned char c = uzlib_get_byte(d);
+        TINF_PUT(d, c);
+    }
     return TINF_OK;
 }
 
@@ -540,6 +604,7 @@ void uzlib_uncompress_init(TINF_DATA *d, void *dict, unsigned int dictLen)
 {
    d->eof = 0;
    d->bitcount = 0;
+   d->tag = 0;
    d->bfinal = 0;
    d->btype = -1;
    d->dict_size = dictLen;
@@ -80,6 +80,11 @@ extern "C" {
 typedef struct {
    unsigned short table[16];  /* table of code length counts */
    unsigned short trans[288]; /* code -> symbol translation table */
+#if UZLIB_CONF_LUT_BITS
+   /* next UZLIB_CONF_LUT_BITS bits -> symbol | code length << 9, or 0 if
+      the code is longer */
+   unsigned short lut[1 << UZLIB_CONF_LUT_BITS];
+#endif
 } TINF_TREE;
 
 struct uzlib_uncomp {
@@ -94,6 +99,7 @@ struct uzlib_uncomp {
        source_limit fields, thus allowing for buffered operation. */
     int (*source_read_cb)(struct uzlib_uncomp *uncomp);
 
+    /* bit buffer, holding bitcount bits (whole bytes may be read ahead) */
     unsigned int tag;
     unsigned int bitcount;
 
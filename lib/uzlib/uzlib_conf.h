@@ -19,4 +19,11 @@
 #define UZLIB_CONF_PARANOID_CHECKS 0
 #endif
 
+#ifndef UZLIB_CONF_LUT_BITS
+/* Decode Huffman codes up to this many bits long with a lookup table,
+   costing 2 << UZLIB_CONF_LUT_BITS bytes per tree (there are two in
+   TINF_DATA).  0 decodes a bit at a time. */
+#define UZLIB_CONF_LUT_BITS 0
+#endif
+
 #endif /* UZLIB_CONF_H_INCLUDED */
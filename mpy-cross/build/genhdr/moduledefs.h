@@ -0,0 +1,25 @@
+// Automatically generated by makemoduledefs.py.
+
+extern const struct _mp_obj_module_t mp_module___main__;
+#undef MODULE_DEF_MP_QSTR___MAIN__
+#define MODULE_DEF_MP_QSTR___MAIN__ { MP_ROM_QSTR(MP_QSTR___main__), MP_ROM_PTR(&mp_module___main__) },
+
+extern const struct _mp_obj_module_t mp_module_builtins;
+#undef MODULE_DEF_MP_QSTR_BUILTINS
+#define MODULE_DEF_MP_QSTR_BUILTINS { MP_ROM_QSTR(MP_QSTR_builtins), MP_ROM_PTR(&mp_module_builtins) },
+
+extern const struct _mp_obj_module_t mp_module_micropython;
+#undef MODULE_DEF_MP_QSTR_MICROPYTHON
+#define MODULE_DEF_MP_QSTR_MICROPYTHON { MP_ROM_QSTR(MP_QSTR_micropython), MP_ROM_PTR(&mp_module_micropython) },
+
+extern const struct _mp_obj_module_t mp_module_ustruct;
+#undef MODULE_DEF_MP_QSTR_USTRUCT
+#define MODULE_DEF_MP_QSTR_USTRUCT { MP_ROM_QSTR(MP_QSTR_ustruct), MP_ROM_PTR(&mp_module_ustruct) },
+
+
+#define MICROPY_REGISTERED_MODULES \
+    MODULE_DEF_MP_QSTR_BUILTINS \
+    MODULE_DEF_MP_QSTR_MICROPYTHON \
+    MODULE_DEF_MP_QSTR_USTRUCT \
+    MODULE_DEF_MP_QSTR___MAIN__ \
+// MICROPY_REGISTERED_MODULES
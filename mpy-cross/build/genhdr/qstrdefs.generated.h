@@ -0,0 +1,820 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTRnull, 0, 0, "")
+QDEF(MP_QSTR_, 5381, 0, "")
+QDEF(MP_QSTR___dir__, 36730, 7, "__dir__")
+QDEF(MP_QSTR__0x0a_, 46511, 1, "\x0a")
+QDEF(MP_QSTR__space_, 46469, 1, " ")
+QDEF(MP_QSTR__star_, 46479, 1, "*")
+QDEF(MP_QSTR__slash_, 46474, 1, "/")
+QDEF(MP_QSTR__lt_module_gt_, 38077, 8, "<module>")
+QDEF(MP_QSTR__, 46586, 1, "_")
+QDEF(MP_QSTR___call__, 63911, 8, "__call__")
+QDEF(MP_QSTR___class__, 50475, 9, "__class__")
+QDEF(MP_QSTR___delitem__, 13821, 11, "__delitem__")
+QDEF(MP_QSTR___enter__, 47725, 9, "__enter__")
+QDEF(MP_QSTR___exit__, 63557, 8, "__exit__")
+QDEF(MP_QSTR___getattr__, 63552, 11, "__getattr__")
+QDEF(MP_QSTR___getitem__, 14630, 11, "__getitem__")
+QDEF(MP_QSTR___hash__, 51447, 8, "__hash__")
+QDEF(MP_QSTR___init__, 42335, 8, "__init__")
+QDEF(MP_QSTR___int__, 6934, 7, "__int__")
+QDEF(MP_QSTR___iter__, 13007, 8, "__iter__")
+QDEF(MP_QSTR___len__, 45282, 7, "__len__")
+QDEF(MP_QSTR___main__, 5006, 8, "__main__")
+QDEF(MP_QSTR___module__, 12543, 10, "__module__")
+QDEF(MP_QSTR___name__, 14562, 8, "__name__")
+QDEF(MP_QSTR___new__, 5497, 7, "__new__")
+QDEF(MP_QSTR___next__, 29442, 8, "__next__")
+QDEF(MP_QSTR___qualname__, 107, 12, "__qualname__")
+QDEF(MP_QSTR___repr__, 2832, 8, "__repr__")
+QDEF(MP_QSTR___setitem__, 15922, 11, "__setitem__")
+QDEF(MP_QSTR___str__, 52688, 7, "__str__")
+QDEF(MP_QSTR_ArithmeticError, 35885, 15, "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, 23191, 14, "AssertionError")
+QDEF(MP_QSTR_AttributeError, 56865, 14, "AttributeError")
+QDEF(MP_QSTR_BaseException, 37383, 13, "BaseException")
+QDEF(MP_QSTR_EOFError, 49041, 8, "EOFError")
+QDEF(MP_QSTR_Ellipsis, 57584, 8, "Ellipsis")
+QDEF(MP_QSTR_Exception, 10738, 9, "Exception")
+QDEF(MP_QSTR_GeneratorExit, 25110, 13, "GeneratorExit")
+QDEF(MP_QSTR_ImportError, 39968, 11, "ImportError")
+QDEF(MP_QSTR_IndentationError, 8284, 16, "IndentationError")
+QDEF(MP_QSTR_IndexError, 44419, 10, "IndexError")
+QDEF(MP_QSTR_KeyError, 234, 8, "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, 58031, 17, "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, 27135, 11, "LookupError")
+QDEF(MP_QSTR_MemoryError, 33756, 11, "MemoryError")
+QDEF(MP_QSTR_NameError, 11706, 9, "NameError")
+QDEF(MP_QSTR_NoneType, 26647, 8, "NoneType")
+QDEF(MP_QSTR_NotImplementedError, 39110, 19, "NotImplementedError")
+QDEF(MP_QSTR_OSError, 26017, 7, "OSError")
+QDEF(MP_QSTR_OverflowError, 57729, 13, "OverflowError")
+QDEF(MP_QSTR_RuntimeError, 61793, 12, "RuntimeError")
+QDEF(MP_QSTR_StopIteration, 7402, 13, "StopIteration")
+QDEF(MP_QSTR_SyntaxError, 36756, 11, "SyntaxError")
+QDEF(MP_QSTR_SystemExit, 65312, 10, "SystemExit")
+QDEF(MP_QSTR_TypeError, 38437, 9, "TypeError")
+QDEF(MP_QSTR_ValueError, 34710, 10, "ValueError")
+QDEF(MP_QSTR_ZeroDivisionError, 10166, 17, "ZeroDivisionError")
+QDEF(MP_QSTR_abs, 12949, 3, "abs")
+QDEF(MP_QSTR_all, 13124, 3, "all")
+QDEF(MP_QSTR_any, 13075, 3, "any")
+QDEF(MP_QSTR_append, 38763, 6, "append")
+QDEF(MP_QSTR_args, 50882, 4, "args")
+QDEF(MP_QSTR_bool, 15595, 4, "bool")
+QDEF(MP_QSTR_builtins, 12791, 8, "builtins")
+QDEF(MP_QSTR_bytearray, 41846, 9, "bytearray")
+QDEF(MP_QSTR_bytecode, 32034, 8, "bytecode")
+QDEF(MP_QSTR_bytes, 45660, 5, "bytes")
+QDEF(MP_QSTR_callable, 28685, 8, "callable")
+QDEF(MP_QSTR_chr, 19676, 3, "chr")
+QDEF(MP_QSTR_classmethod, 36020, 11, "classmethod")
+QDEF(MP_QSTR_clear, 41084, 5, "clear")
+QDEF(MP_QSTR_close, 26419, 5, "close")
+QDEF(MP_QSTR_const, 65472, 5, "const")
+QDEF(MP_QSTR_copy, 56288, 4, "copy")
+QDEF(MP_QSTR_count, 19878, 5, "count")
+QDEF(MP_QSTR_dict, 64575, 4, "dict")
+QDEF(MP_QSTR_dir, 7930, 3, "dir")
+QDEF(MP_QSTR_divmod, 1208, 6, "divmod")
+QDEF(MP_QSTR_end, 8970, 3, "end")
+QDEF(MP_QSTR_endswith, 41755, 8, "endswith")
+QDEF(MP_QSTR_eval, 42651, 4, "eval")
+QDEF(MP_QSTR_exec, 49182, 4, "exec")
+QDEF(MP_QSTR_extend, 59491, 6, "extend")
+QDEF(MP_QSTR_find, 13312, 4, "find")
+QDEF(MP_QSTR_format, 13094, 6, "format")
+QDEF(MP_QSTR_from_bytes, 29749, 10, "from_bytes")
+QDEF(MP_QSTR_get, 15155, 3, "get")
+QDEF(MP_QSTR_getattr, 6080, 7, "getattr")
+QDEF(MP_QSTR_globals, 18845, 7, "globals")
+QDEF(MP_QSTR_hasattr, 45196, 7, "hasattr")
+QDEF(MP_QSTR_hash, 28855, 4, "hash")
+QDEF(MP_QSTR_id, 28456, 2, "id")
+QDEF(MP_QSTR_index, 10363, 5, "index")
+QDEF(MP_QSTR_insert, 21522, 6, "insert")
+QDEF(MP_QSTR_int, 21270, 3, "int")
+QDEF(MP_QSTR_isalpha, 14315, 7, "isalpha")
+QDEF(MP_QSTR_isdigit, 39592, 7, "isdigit")
+QDEF(MP_QSTR_isinstance, 48822, 10, "isinstance")
+QDEF(MP_QSTR_islower, 33020, 7, "islower")
+QDEF(MP_QSTR_isspace, 63579, 7, "isspace")
+QDEF(MP_QSTR_issubclass, 32693, 10, "issubclass")
+QDEF(MP_QSTR_isupper, 42973, 7, "isupper")
+QDEF(MP_QSTR_items, 21475, 5, "items")
+QDEF(MP_QSTR_iter, 8591, 4, "iter")
+QDEF(MP_QSTR_join, 23719, 4, "join")
+QDEF(MP_QSTR_key, 27954, 3, "key")
+QDEF(MP_QSTR_keys, 4865, 4, "keys")
+QDEF(MP_QSTR_len, 16482, 3, "len")
+QDEF(MP_QSTR_list, 7463, 4, "list")
+QDEF(MP_QSTR_little, 27273, 6, "little")
+QDEF(MP_QSTR_locals, 41275, 6, "locals")
+QDEF(MP_QSTR_lower, 52166, 5, "lower")
+QDEF(MP_QSTR_lstrip, 47589, 6, "lstrip")
+QDEF(MP_QSTR_main, 47054, 4, "main")
+QDEF(MP_QSTR_map, 17337, 3, "map")
+QDEF(MP_QSTR_micropython, 31755, 11, "micropython")
+QDEF(MP_QSTR_next, 34882, 4, "next")
+QDEF(MP_QSTR_object, 36240, 6, "object")
+QDEF(MP_QSTR_open, 15057, 4, "open")
+QDEF(MP_QSTR_ord, 24092, 3, "ord")
+QDEF(MP_QSTR_pop, 29482, 3, "pop")
+QDEF(MP_QSTR_popitem, 11455, 7, "popitem")
+QDEF(MP_QSTR_pow, 29485, 3, "pow")
+QDEF(MP_QSTR_print, 50772, 5, "print")
+QDEF(MP_QSTR_range, 24090, 5, "range")
+QDEF(MP_QSTR_read, 63927, 4, "read")
+QDEF(MP_QSTR_readinto, 48971, 8, "readinto")
+QDEF(MP_QSTR_readline, 6649, 8, "readline")
+QDEF(MP_QSTR_remove, 35427, 6, "remove")
+QDEF(MP_QSTR_replace, 9545, 7, "replace")
+QDEF(MP_QSTR_repr, 63440, 4, "repr")
+QDEF(MP_QSTR_reverse, 10789, 7, "reverse")
+QDEF(MP_QSTR_rfind, 40146, 5, "rfind")
+QDEF(MP_QSTR_rindex, 11241, 6, "rindex")
+QDEF(MP_QSTR_round, 9703, 5, "round")
+QDEF(MP_QSTR_rsplit, 165, 6, "rsplit")
+QDEF(MP_QSTR_rstrip, 38203, 6, "rstrip")
+QDEF(MP_QSTR_self, 30585, 4, "self")
+QDEF(MP_QSTR_send, 30393, 4, "send")
+QDEF(MP_QSTR_sep, 36643, 3, "sep")
+QDEF(MP_QSTR_set, 36647, 3, "set")
+QDEF(MP_QSTR_setattr, 43220, 7, "setattr")
+QDEF(MP_QSTR_setdefault, 41836, 10, "setdefault")
+QDEF(MP_QSTR_sort, 40383, 4, "sort")
+QDEF(MP_QSTR_sorted, 5470, 6, "sorted")
+QDEF(MP_QSTR_split, 13239, 5, "split")
+QDEF(MP_QSTR_start, 61317, 5, "start")
+QDEF(MP_QSTR_startswith, 59508, 10, "startswith")
+QDEF(MP_QSTR_staticmethod, 44898, 12, "staticmethod")
+QDEF(MP_QSTR_step, 13911, 4, "step")
+QDEF(MP_QSTR_stop, 13981, 4, "stop")
+QDEF(MP_QSTR_str, 36176, 3, "str")
+QDEF(MP_QSTR_strip, 7721, 5, "strip")
+QDEF(MP_QSTR_sum, 36142, 3, "sum")
+QDEF(MP_QSTR_super, 45764, 5, "super")
+QDEF(MP_QSTR_throw, 17587, 5, "throw")
+QDEF(MP_QSTR_to_bytes, 16088, 8, "to_bytes")
+QDEF(MP_QSTR_tuple, 16893, 5, "tuple")
+QDEF(MP_QSTR_type, 32669, 4, "type")
+QDEF(MP_QSTR_update, 30388, 6, "update")
+QDEF(MP_QSTR_upper, 37927, 5, "upper")
+QDEF(MP_QSTR_utf_hyphen_8, 33463, 5, "utf-8")
+QDEF(MP_QSTR_value, 13390, 5, "value")
+QDEF(MP_QSTR_values, 48765, 6, "values")
+QDEF(MP_QSTR_write, 43160, 5, "write")
+QDEF(MP_QSTR_zip, 44262, 3, "zip")
+QDEF(MP_QSTR___add__, 33476, 7, "__add__")
+QDEF(MP_QSTR___aenter__, 33868, 10, "__aenter__")
+QDEF(MP_QSTR___aexit__, 53188, 9, "__aexit__")
+QDEF(MP_QSTR___aiter__, 11086, 9, "__aiter__")
+QDEF(MP_QSTR___anext__, 46211, 9, "__anext__")
+QDEF(MP_QSTR___bases__, 12291, 9, "__bases__")
+QDEF(MP_QSTR___bool__, 25899, 8, "__bool__")
+QDEF(MP_QSTR___build_class__, 34882, 15, "__build_class__")
+QDEF(MP_QSTR___contains__, 24518, 12, "__contains__")
+QDEF(MP_QSTR___dict__, 21631, 8, "__dict__")
+QDEF(MP_QSTR___eq__, 15985, 6, "__eq__")
+QDEF(MP_QSTR___ge__, 18087, 6, "__ge__")
+QDEF(MP_QSTR___gt__, 33462, 6, "__gt__")
+QDEF(MP_QSTR___iadd__, 19053, 8, "__iadd__")
+QDEF(MP_QSTR___import__, 15928, 10, "__import__")
+QDEF(MP_QSTR___isub__, 30728, 8, "__isub__")
+QDEF(MP_QSTR___le__, 5068, 6, "__le__")
+QDEF(MP_QSTR___lt__, 26717, 6, "__lt__")
+QDEF(MP_QSTR___ne__, 2830, 6, "__ne__")
+QDEF(MP_QSTR___path__, 9160, 8, "__path__")
+QDEF(MP_QSTR___repl_print__, 47872, 14, "__repl_print__")
+QDEF(MP_QSTR___reversed__, 65377, 12, "__reversed__")
+QDEF(MP_QSTR___sub__, 2337, 7, "__sub__")
+QDEF(MP_QSTR___traceback__, 53071, 13, "__traceback__")
+QDEF(MP_QSTR__percent__hash_o, 6764, 3, "%#o")
+QDEF(MP_QSTR__percent__hash_x, 6779, 3, "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, 14168, 5, "{:#b}")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, 7795, 32, "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_lambda_gt_, 35968, 8, "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, 5588, 10, "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, 36300, 10, "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, 20820, 9, "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, 27188, 9, "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, 21330, 8, "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, 25571, 7, "<stdin>")
+QDEF(MP_QSTR_None, 53615, 4, "None")
+QDEF(MP_QSTR_StopAsyncIteration, 61676, 18, "StopAsyncIteration")
+QDEF(MP_QSTR_UnicodeError, 53538, 12, "UnicodeError")
+QDEF(MP_QSTR_ViperTypeError, 1501, 14, "ViperTypeError")
+QDEF(MP_QSTR_add, 12868, 3, "add")
+QDEF(MP_QSTR_addi, 31405, 4, "addi")
+QDEF(MP_QSTR_align, 64424, 5, "align")
+QDEF(MP_QSTR_and_, 38033, 4, "and_")
+QDEF(MP_QSTR_asm_thumb, 27971, 9, "asm_thumb")
+QDEF(MP_QSTR_asm_xtensa, 4784, 10, "asm_xtensa")
+QDEF(MP_QSTR_asr, 13669, 3, "asr")
+QDEF(MP_QSTR_b, 46535, 1, "b")
+QDEF(MP_QSTR_ball, 17734, 4, "ball")
+QDEF(MP_QSTR_bany, 17553, 4, "bany")
+QDEF(MP_QSTR_bbc, 18182, 3, "bbc")
+QDEF(MP_QSTR_bbs, 18198, 3, "bbs")
+QDEF(MP_QSTR_beq, 18291, 3, "beq")
+QDEF(MP_QSTR_beqz, 13737, 4, "beqz")
+QDEF(MP_QSTR_bge, 18085, 3, "bge")
+QDEF(MP_QSTR_bgeu, 6960, 4, "bgeu")
+QDEF(MP_QSTR_bin, 18656, 3, "bin")
+QDEF(MP_QSTR_bl, 28363, 2, "bl")
+QDEF(MP_QSTR_blt, 18527, 3, "blt")
+QDEF(MP_QSTR_bnall, 21768, 5, "bnall")
+QDEF(MP_QSTR_bne, 18316, 3, "bne")
+QDEF(MP_QSTR_bnez, 14710, 4, "bnez")
+QDEF(MP_QSTR_bnone, 15693, 5, "bnone")
+QDEF(MP_QSTR_bound_method, 41623, 12, "bound_method")
+QDEF(MP_QSTR_bx, 28383, 2, "bx")
+QDEF(MP_QSTR_calcsize, 14413, 8, "calcsize")
+QDEF(MP_QSTR_callx0, 46639, 6, "callx0")
+QDEF(MP_QSTR_closure, 51828, 7, "closure")
+QDEF(MP_QSTR_clz, 19536, 3, "clz")
+QDEF(MP_QSTR_cmp, 19515, 3, "cmp")
+QDEF(MP_QSTR_complex, 40389, 7, "complex")
+QDEF(MP_QSTR_cpsid, 51176, 5, "cpsid")
+QDEF(MP_QSTR_cpsie, 51177, 5, "cpsie")
+QDEF(MP_QSTR_data, 56341, 4, "data")
+QDEF(MP_QSTR_decode, 22953, 6, "decode")
+QDEF(MP_QSTR_default, 32206, 7, "default")
+QDEF(MP_QSTR_delattr, 51419, 7, "delattr")
+QDEF(MP_QSTR_deleter, 56174, 7, "deleter")
+QDEF(MP_QSTR_dict_view, 43309, 9, "dict_view")
+QDEF(MP_QSTR_difference, 9330, 10, "difference")
+QDEF(MP_QSTR_difference_update, 64156, 17, "difference_update")
+QDEF(MP_QSTR_discard, 28943, 7, "discard")
+QDEF(MP_QSTR_doc, 7981, 3, "doc")
+QDEF(MP_QSTR_encode, 51779, 6, "encode")
+QDEF(MP_QSTR_enumerate, 47729, 9, "enumerate")
+QDEF(MP_QSTR_errno, 4545, 5, "errno")
+QDEF(MP_QSTR_filter, 48677, 6, "filter")
+QDEF(MP_QSTR_float, 17461, 5, "float")
+QDEF(MP_QSTR_fromkeys, 48439, 8, "fromkeys")
+QDEF(MP_QSTR_function, 551, 8, "function")
+QDEF(MP_QSTR_generator, 50070, 9, "generator")
+QDEF(MP_QSTR_getter, 45712, 6, "getter")
+QDEF(MP_QSTR_heap_lock, 36013, 9, "heap_lock")
+QDEF(MP_QSTR_heap_unlock, 11606, 11, "heap_unlock")
+QDEF(MP_QSTR_hex, 20592, 3, "hex")
+QDEF(MP_QSTR_imag, 46919, 4, "imag")
+QDEF(MP_QSTR_intersection, 10792, 12, "intersection")
+QDEF(MP_QSTR_intersection_update, 56582, 19, "intersection_update")
+QDEF(MP_QSTR_isdisjoint, 26871, 10, "isdisjoint")
+QDEF(MP_QSTR_issubset, 49593, 8, "issubset")
+QDEF(MP_QSTR_issuperset, 60668, 10, "issuperset")
+QDEF(MP_QSTR_iterable, 37413, 8, "iterable")
+QDEF(MP_QSTR_iterator, 48711, 8, "iterator")
+QDEF(MP_QSTR_j, 46543, 1, "j")
+QDEF(MP_QSTR_jx, 28631, 2, "jx")
+QDEF(MP_QSTR_l16si, 33556, 5, "l16si")
+QDEF(MP_QSTR_l16ui, 33618, 5, "l16ui")
+QDEF(MP_QSTR_l32i, 36673, 4, "l32i")
+QDEF(MP_QSTR_l8ui, 22893, 4, "l8ui")
+QDEF(MP_QSTR_label, 59203, 5, "label")
+QDEF(MP_QSTR_ldr, 16479, 3, "ldr")
+QDEF(MP_QSTR_ldrb, 19549, 4, "ldrb")
+QDEF(MP_QSTR_ldrex, 55266, 5, "ldrex")
+QDEF(MP_QSTR_ldrh, 19543, 4, "ldrh")
+QDEF(MP_QSTR_lsl, 16822, 3, "lsl")
+QDEF(MP_QSTR_lsr, 16808, 3, "lsr")
+QDEF(MP_QSTR_max, 17329, 3, "max")
+QDEF(MP_QSTR_min, 17071, 3, "min")
+QDEF(MP_QSTR_module, 39359, 6, "module")
+QDEF(MP_QSTR_mov, 17393, 3, "mov")
+QDEF(MP_QSTR_mov_n, 3168, 5, "mov_n")
+QDEF(MP_QSTR_movi, 49784, 4, "movi")
+QDEF(MP_QSTR_movt, 49765, 4, "movt")
+QDEF(MP_QSTR_movw, 49766, 4, "movw")
+QDEF(MP_QSTR_movwt, 3922, 5, "movwt")
+QDEF(MP_QSTR_mrs, 17801, 3, "mrs")
+QDEF(MP_QSTR_mull, 3133, 4, "mull")
+QDEF(MP_QSTR_native, 2948, 6, "native")
+QDEF(MP_QSTR_nop, 22452, 3, "nop")
+QDEF(MP_QSTR_oct, 23805, 3, "oct")
+QDEF(MP_QSTR_opt_level, 26503, 9, "opt_level")
+QDEF(MP_QSTR_or_, 24103, 3, "or_")
+QDEF(MP_QSTR_pack, 53692, 4, "pack")
+QDEF(MP_QSTR_pack_into, 43295, 9, "pack_into")
+QDEF(MP_QSTR_pend_throw, 29939, 10, "pend_throw")
+QDEF(MP_QSTR_property, 10690, 8, "property")
+QDEF(MP_QSTR_ptr, 28755, 3, "ptr")
+QDEF(MP_QSTR_ptr16, 51956, 5, "ptr16")
+QDEF(MP_QSTR_ptr32, 51890, 5, "ptr32")
+QDEF(MP_QSTR_ptr8, 31371, 4, "ptr8")
+QDEF(MP_QSTR_push, 32443, 4, "push")
+QDEF(MP_QSTR_qadd, 19637, 4, "qadd")
+QDEF(MP_QSTR_qsub, 9168, 4, "qsub")
+QDEF(MP_QSTR_rbit, 61160, 4, "rbit")
+QDEF(MP_QSTR_real, 63935, 4, "real")
+QDEF(MP_QSTR_ret_n, 2039, 5, "ret_n")
+QDEF(MP_QSTR_reversed, 28321, 8, "reversed")
+QDEF(MP_QSTR_s16i, 15288, 4, "s16i")
+QDEF(MP_QSTR_s32i, 13374, 4, "s32i")
+QDEF(MP_QSTR_s8i, 34311, 3, "s8i")
+QDEF(MP_QSTR_sdiv, 31437, 4, "sdiv")
+QDEF(MP_QSTR_setter, 22788, 6, "setter")
+QDEF(MP_QSTR_slice, 62645, 5, "slice")
+QDEF(MP_QSTR_strb, 14130, 4, "strb")
+QDEF(MP_QSTR_strex, 7597, 5, "strex")
+QDEF(MP_QSTR_strh, 14136, 4, "strh")
+QDEF(MP_QSTR_sub, 36129, 3, "sub")
+QDEF(MP_QSTR_symmetric_difference, 26574, 20, "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, 63584, 27, "symmetric_difference_update")
+QDEF(MP_QSTR_udiv, 12683, 4, "udiv")
+QDEF(MP_QSTR_uint, 15843, 4, "uint")
+QDEF(MP_QSTR_union, 31990, 5, "union")
+QDEF(MP_QSTR_unpack, 15367, 6, "unpack")
+QDEF(MP_QSTR_unpack_from, 27918, 11, "unpack_from")
+QDEF(MP_QSTR_ustruct, 2119, 7, "ustruct")
+QDEF(MP_QSTR_vcmp, 49581, 4, "vcmp")
+QDEF(MP_QSTR_vcvt_f32_s32, 51527, 12, "vcvt_f32_s32")
+QDEF(MP_QSTR_vcvt_s32_f32, 13063, 12, "vcvt_s32_f32")
+QDEF(MP_QSTR_viper, 9053, 5, "viper")
+QDEF(MP_QSTR_vldr, 1993, 4, "vldr")
+QDEF(MP_QSTR_vmov, 2791, 4, "vmov")
+QDEF(MP_QSTR_vmrs, 2463, 4, "vmrs")
+QDEF(MP_QSTR_vneg, 61183, 4, "vneg")
+QDEF(MP_QSTR_vsqrt, 17143, 5, "vsqrt")
+QDEF(MP_QSTR_vstr, 32454, 4, "vstr")
+QDEF(MP_QSTR_wfi, 32413, 3, "wfi")
+QDEF(MP_QSTR_xor, 37664, 3, "xor")
+
+#ifdef QBUCKET
+QBUCKET(0)
+QBUCKET(3)
+QBUCKET(5)
+QBUCKET(6)
+QBUCKET(9)
+QBUCKET(11)
+QBUCKET(14)
+QBUCKET(16)
+QBUCKET(21)
+QBUCKET(23)
+QBUCKET(25)
+QBUCKET(27)
+QBUCKET(30)
+QBUCKET(32)
+QBUCKET(33)
+QBUCKET(36)
+QBUCKET(39)
+QBUCKET(42)
+QBUCKET(45)
+QBUCKET(46)
+QBUCKET(47)
+QBUCKET(49)
+QBUCKET(51)
+QBUCKET(57)
+QBUCKET(60)
+QBUCKET(61)
+QBUCKET(61)
+QBUCKET(62)
+QBUCKET(64)
+QBUCKET(66)
+QBUCKET(70)
+QBUCKET(71)
+QBUCKET(73)
+QBUCKET(76)
+QBUCKET(81)
+QBUCKET(83)
+QBUCKET(84)
+QBUCKET(84)
+QBUCKET(90)
+QBUCKET(93)
+QBUCKET(101)
+QBUCKET(106)
+QBUCKET(109)
+QBUCKET(110)
+QBUCKET(112)
+QBUCKET(112)
+QBUCKET(120)
+QBUCKET(121)
+QBUCKET(125)
+QBUCKET(127)
+QBUCKET(128)
+QBUCKET(132)
+QBUCKET(135)
+QBUCKET(139)
+QBUCKET(144)
+QBUCKET(148)
+QBUCKET(153)
+QBUCKET(157)
+QBUCKET(160)
+QBUCKET(161)
+QBUCKET(165)
+QBUCKET(166)
+QBUCKET(168)
+QBUCKET(169)
+QBUCKET(174)
+QBUCKET(177)
+QBUCKET(179)
+QBUCKET(183)
+QBUCKET(186)
+QBUCKET(191)
+QBUCKET(193)
+QBUCKET(198)
+QBUCKET(203)
+QBUCKET(204)
+QBUCKET(206)
+QBUCKET(206)
+QBUCKET(208)
+QBUCKET(211)
+QBUCKET(214)
+QBUCKET(219)
+QBUCKET(222)
+QBUCKET(227)
+QBUCKET(228)
+QBUCKET(232)
+QBUCKET(233)
+QBUCKET(237)
+QBUCKET(237)
+QBUCKET(238)
+QBUCKET(241)
+QBUCKET(243)
+QBUCKET(243)
+QBUCKET(243)
+QBUCKET(245)
+QBUCKET(249)
+QBUCKET(254)
+QBUCKET(255)
+QBUCKET(259)
+QBUCKET(263)
+QBUCKET(265)
+QBUCKET(270)
+QBUCKET(275)
+QBUCKET(275)
+QBUCKET(278)
+QBUCKET(280)
+QBUCKET(282)
+QBUCKET(284)
+QBUCKET(286)
+QBUCKET(288)
+QBUCKET(292)
+QBUCKET(295)
+QBUCKET(298)
+QBUCKET(299)
+QBUCKET(300)
+QBUCKET(302)
+QBUCKET(305)
+QBUCKET(307)
+QBUCKET(310)
+QBUCKET(313)
+QBUCKET(313)
+QBUCKET(316)
+QBUCKET(321)
+QBUCKET(322)
+QBUCKET(325)
+QBUCKET(328)
+QBUCKET(330)
+QBUCKET(333)
+QBUCKET(337)
+QBUCKET(337)
+QBUCKET(341)
+#endif
+
+#ifdef QORDER
+QORDER(83)
+QORDER(186)
+QORDER(194)
+QORDER(49)
+QORDER(106)
+QORDER(25)
+QORDER(40)
+QORDER(170)
+QORDER(171)
+QORDER(292)
+QORDER(316)
+QORDER(1)
+QORDER(4)
+QORDER(146)
+QORDER(215)
+QORDER(262)
+QORDER(33)
+QORDER(295)
+QORDER(314)
+QORDER(327)
+QORDER(332)
+QORDER(181)
+QORDER(224)
+QORDER(109)
+QORDER(290)
+QORDER(6)
+QORDER(78)
+QORDER(115)
+QORDER(304)
+QORDER(324)
+QORDER(89)
+QORDER(225)
+QORDER(67)
+QORDER(21)
+QORDER(184)
+QORDER(328)
+QORDER(5)
+QORDER(103)
+QORDER(246)
+QORDER(27)
+QORDER(117)
+QORDER(256)
+QORDER(34)
+QORDER(208)
+QORDER(214)
+QORDER(93)
+QORDER(59)
+QORDER(52)
+QORDER(270)
+QORDER(57)
+QORDER(238)
+QORDER(18)
+QORDER(37)
+QORDER(55)
+QORDER(94)
+QORDER(216)
+QORDER(255)
+QORDER(31)
+QORDER(46)
+QORDER(228)
+QORDER(164)
+QORDER(124)
+QORDER(79)
+QORDER(80)
+QORDER(119)
+QORDER(245)
+QORDER(88)
+QORDER(150)
+QORDER(158)
+QORDER(340)
+QORDER(81)
+QORDER(298)
+QORDER(336)
+QORDER(38)
+QORDER(53)
+QORDER(341)
+QORDER(32)
+QORDER(48)
+QORDER(188)
+QORDER(311)
+QORDER(321)
+QORDER(65)
+QORDER(203)
+QORDER(139)
+QORDER(54)
+QORDER(131)
+QORDER(135)
+QORDER(219)
+QORDER(251)
+QORDER(266)
+QORDER(15)
+QORDER(74)
+QORDER(84)
+QORDER(9)
+QORDER(104)
+QORDER(108)
+QORDER(140)
+QORDER(160)
+QORDER(177)
+QORDER(254)
+QORDER(296)
+QORDER(91)
+QORDER(96)
+QORDER(207)
+QORDER(261)
+QORDER(280)
+QORDER(152)
+QORDER(218)
+QORDER(239)
+QORDER(120)
+QORDER(10)
+QORDER(172)
+QORDER(30)
+QORDER(122)
+QORDER(206)
+QORDER(243)
+QORDER(247)
+QORDER(257)
+QORDER(319)
+QORDER(330)
+QORDER(153)
+QORDER(3)
+QORDER(42)
+QORDER(231)
+QORDER(282)
+QORDER(210)
+QORDER(220)
+QORDER(281)
+QORDER(28)
+QORDER(105)
+QORDER(303)
+QORDER(318)
+QORDER(71)
+QORDER(86)
+QORDER(155)
+QORDER(69)
+QORDER(159)
+QORDER(198)
+QORDER(293)
+QORDER(85)
+QORDER(100)
+QORDER(252)
+QORDER(306)
+QORDER(317)
+QORDER(56)
+QORDER(97)
+QORDER(178)
+QORDER(279)
+QORDER(90)
+QORDER(125)
+QORDER(145)
+QORDER(161)
+QORDER(253)
+QORDER(77)
+QORDER(180)
+QORDER(312)
+QORDER(320)
+QORDER(114)
+QORDER(138)
+QORDER(264)
+QORDER(45)
+QORDER(110)
+QORDER(136)
+QORDER(234)
+QORDER(305)
+QORDER(297)
+QORDER(7)
+QORDER(291)
+QORDER(313)
+QORDER(75)
+QORDER(121)
+QORDER(143)
+QORDER(283)
+QORDER(309)
+QORDER(14)
+QORDER(72)
+QORDER(87)
+QORDER(250)
+QORDER(272)
+QORDER(61)
+QORDER(116)
+QORDER(173)
+QORDER(300)
+QORDER(209)
+QORDER(248)
+QORDER(274)
+QORDER(58)
+QORDER(154)
+QORDER(166)
+QORDER(168)
+QORDER(205)
+QORDER(13)
+QORDER(235)
+QORDER(47)
+QORDER(111)
+QORDER(174)
+QORDER(213)
+QORDER(339)
+QORDER(212)
+QORDER(260)
+QORDER(267)
+QORDER(329)
+QORDER(331)
+QORDER(185)
+QORDER(129)
+QORDER(334)
+QORDER(126)
+QORDER(222)
+QORDER(167)
+QORDER(182)
+QORDER(196)
+QORDER(227)
+QORDER(230)
+QORDER(315)
+QORDER(113)
+QORDER(162)
+QORDER(169)
+QORDER(240)
+QORDER(322)
+QORDER(19)
+QORDER(189)
+QORDER(268)
+QORDER(29)
+QORDER(130)
+QORDER(151)
+QORDER(233)
+QORDER(307)
+QORDER(118)
+QORDER(132)
+QORDER(199)
+QORDER(271)
+QORDER(289)
+QORDER(301)
+QORDER(123)
+QORDER(141)
+QORDER(195)
+QORDER(197)
+QORDER(258)
+QORDER(149)
+QORDER(269)
+QORDER(278)
+QORDER(156)
+QORDER(192)
+QORDER(99)
+QORDER(241)
+QORDER(39)
+QORDER(44)
+QORDER(66)
+QORDER(68)
+QORDER(101)
+QORDER(183)
+QORDER(204)
+QORDER(276)
+QORDER(333)
+QORDER(144)
+QORDER(17)
+QORDER(223)
+QORDER(229)
+QORDER(275)
+QORDER(73)
+QORDER(221)
+QORDER(285)
+QORDER(323)
+QORDER(50)
+QORDER(187)
+QORDER(20)
+QORDER(23)
+QORDER(107)
+QORDER(148)
+QORDER(277)
+QORDER(82)
+QORDER(102)
+QORDER(128)
+QORDER(200)
+QORDER(325)
+QORDER(112)
+QORDER(211)
+QORDER(287)
+QORDER(165)
+QORDER(288)
+QORDER(134)
+QORDER(335)
+QORDER(236)
+QORDER(308)
+QORDER(133)
+QORDER(237)
+QORDER(41)
+QORDER(51)
+QORDER(26)
+QORDER(60)
+QORDER(62)
+QORDER(95)
+QORDER(142)
+QORDER(190)
+QORDER(202)
+QORDER(12)
+QORDER(179)
+QORDER(273)
+QORDER(242)
+QORDER(201)
+QORDER(35)
+QORDER(259)
+QORDER(176)
+QORDER(249)
+QORDER(284)
+QORDER(36)
+QORDER(244)
+QORDER(193)
+QORDER(217)
+QORDER(299)
+QORDER(147)
+QORDER(232)
+QORDER(302)
+QORDER(64)
+QORDER(226)
+QORDER(326)
+QORDER(16)
+QORDER(63)
+QORDER(263)
+QORDER(310)
+QORDER(338)
+QORDER(286)
+QORDER(24)
+QORDER(127)
+QORDER(137)
+QORDER(2)
+QORDER(8)
+QORDER(76)
+QORDER(92)
+QORDER(191)
+QORDER(70)
+QORDER(98)
+QORDER(265)
+QORDER(11)
+QORDER(157)
+QORDER(163)
+QORDER(294)
+QORDER(22)
+QORDER(43)
+QORDER(175)
+QORDER(337)
+#endif
@@ -24,7 +24,10 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "py/runtime.h"
+#include "extmod/machine_bitstream.h"
 #include "modmachine.h"
 #include "mphalport.h"
 #include "modesp32.h"
@@ -44,8 +47,11 @@
 // Originally designed to generate infrared remote control signals, the module is very
 // flexible and quite easy-to-use.
 //
-// This current MicroPython implementation lacks some major features, notably receive pulses
-// and carrier output.
+// Pulses can be given to write_pulses as a buffer of 16-bit values with the same layout as
+// the RMT memory, each being (level << 15 | duration).  These are transmitted in place: the
+// driver refills the RMT memory from the buffer at the threshold interrupt, so sequences of
+// any length are sent without converting them first.  read_pulses fills a buffer with
+// received pulses in the same layout.
 
 // Last available RMT channel that can transmit.
 #if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(4, 4, 0)
@@ -64,7 +70,9 @@ typedef struct _esp32_rmt_obj_t {
     uint8_t clock_div;
     mp_uint_t num_items;
     rmt_item32_t *items;
+    mp_obj_t tx_buf; // buffer being transmitted in place, kept alive until the next write
     bool loop_en;
+    bool rx;
 } esp32_rmt_obj_t;
 
 // Current channel used for machine.bitstream, in the machine_bitstream_high_low_rmt
@@ -76,12 +84,13 @@ int8_t esp32_rmt_bitstream_channel_id = RMT_LAST_TX_CHANNEL;
 typedef struct _rmt_install_state_t {
     SemaphoreHandle_t handle;
     uint8_t channel_id;
+    size_t rx_buf_size;
     esp_err_t ret;
 } rmt_install_state_t;
 
 STATIC void rmt_install_task(void *pvParameter) {
     rmt_install_state_t *state = pvParameter;
-    state->ret = rmt_driver_install(state->channel_id, 0, 0);
+    state->ret = rmt_driver_install(state->channel_id, state->rx_buf_size, 0);
     xSemaphoreGive(state->handle);
     vTaskDelete(NULL);
     for (;;) {
@@ -90,11 +99,12 @@ STATIC void rmt_install_task(void *pvParameter) {
 
 // Call rmt_driver_install on core 1.  This ensures that the RMT interrupt handler is
 // serviced on core 1, so that WiFi (if active) does not interrupt it and cause glitches.
-esp_err_t rmt_driver_install_core1(uint8_t channel_id) {
+esp_err_t rmt_driver_install_core1(uint8_t channel_id, size_t rx_buf_size) {
     TaskHandle_t th;
     rmt_install_state_t state;
     state.handle = xSemaphoreCreateBinary();
     state.channel_id = channel_id;
+    state.rx_buf_size = rx_buf_size;
     xTaskCreatePinnedToCore(rmt_install_task, "rmt_install_task", 2048 / sizeof(StackType_t), &state, ESP_TASK_PRIO_MIN + 1, &th, 1);
     xSemaphoreTake(state.handle, portMAX_DELAY);
     vSemaphoreDelete(state.handle);
@@ -105,8 +115,8 @@ esp_err_t rmt_driver_install_core1(uint8_t channel_id) {
 
 // MicroPython runs on core 1, so we can call the RMT installer directly and its
 // interrupt handler will also run on core 1.
-esp_err_t rmt_driver_install_core1(uint8_t channel_id) {
-    return rmt_driver_install(channel_id, 0, 0);
+esp_err_t rmt_driver_install_core1(uint8_t channel_id, size_t rx_buf_size) {
+    return rmt_driver_install(channel_id, rx_buf_size, 0);
 }
 
 #endif
@@ -118,6 +128,10 @@ STATIC mp_obj_t esp32_rmt_make_new(const mp_obj_type_t *type, size_t n_args, siz
         { MP_QSTR_clock_div,                   MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 8} }, // 100ns resolution
         { MP_QSTR_idle_level,                  MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} }, // low voltage
         { MP_QSTR_tx_carrier,                  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // no carrier
+        { MP_QSTR_rx,                          MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_rx_idle_threshold,           MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 12000} },
+        { MP_QSTR_rx_filter_ticks,             MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} }, // no filter
+        { MP_QSTR_rx_buf,                      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1024} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -126,6 +140,7 @@ STATIC mp_obj_t esp32_rmt_make_new(const mp_obj_type_t *type, size_t n_args, siz
     mp_uint_t clock_div = args[2].u_int;
     mp_uint_t idle_level = args[3].u_bool;
     mp_obj_t tx_carrier_obj = args[4].u_obj;
+    bool rx = args[5].u_bool;
 
     if (esp32_rmt_bitstream_channel_id >= 0 && channel_id == esp32_rmt_bitstream_channel_id) {
         mp_raise_ValueError(MP_ERROR_TEXT("channel used by bitstream"));
@@ -140,13 +155,38 @@ STATIC mp_obj_t esp32_rmt_make_new(const mp_obj_type_t *type, size_t n_args, siz
     self->channel_id = channel_id;
     self->pin = pin_id;
     self->clock_div = clock_div;
+    self->tx_buf = MP_OBJ_NULL;
     self->loop_en = false;
+    self->rx = rx;
 
     rmt_config_t config = {0};
-    config.rmt_mode = RMT_MODE_TX;
     config.channel = (rmt_channel_t)self->channel_id;
     config.gpio_num = self->pin;
     config.mem_block_num = 1;
+    config.clk_div = self->clock_div;
+
+    if (rx) {
+        mp_int_t idle_threshold = args[6].u_int;
+        mp_int_t filter_ticks = args[7].u_int;
+        if (idle_threshold < 1 || idle_threshold > 0xffff) {
+            mp_raise_ValueError(MP_ERROR_TEXT("rx_idle_threshold must be between 1 and 65535"));
+        }
+        if (filter_ticks < 0 || filter_ticks > 255) {
+            mp_raise_ValueError(MP_ERROR_TEXT("rx_filter_ticks must be between 0 and 255"));
+        }
+        config.rmt_mode = RMT_MODE_RX;
+        config.rx_config.idle_threshold = idle_threshold;
+        config.rx_config.filter_en = filter_ticks != 0;
+        config.rx_config.filter_ticks_thresh = filter_ticks;
+
+        check_esp_err(rmt_config(&config));
+        check_esp_err(rmt_driver_install_core1(config.channel, args[8].u_int));
+        check_esp_err(rmt_rx_start(config.channel, true));
+
+        return MP_OBJ_FROM_PTR(self);
+    }
+
+    config.rmt_mode = RMT_MODE_TX;
     config.tx_config.loop_en = 0;
 
     if (tx_carrier_obj != mp_const_none) {
@@ -174,17 +214,18 @@ STATIC mp_obj_t esp32_rmt_make_new(const mp_obj_type_t *type, size_t n_args, siz
     config.tx_config.idle_output_en = 1;
     config.tx_config.idle_level = idle_level;
 
-    config.clk_div = self->clock_div;
-
     check_esp_err(rmt_config(&config));
-    check_esp_err(rmt_driver_install_core1(config.channel));
+    check_esp_err(rmt_driver_install_core1(config.channel, 0));
 
     return MP_OBJ_FROM_PTR(self);
 }
 
 STATIC void esp32_rmt_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     esp32_rmt_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    if (self->pin != -1) {
+    if (self->pin != -1 && self->rx) {
+        mp_printf(print, "RMT(channel=%u, pin=%u, source_freq=%u, clock_div=%u, rx=True)",
+            self->channel_id, self->pin, APB_CLK_FREQ, self->clock_div);
+    } else if (self->pin != -1) {
         bool idle_output_en;
         rmt_idle_level_t idle_level;
         check_esp_err(rmt_get_idle_level(self->channel_id, &idle_output_en, &idle_level));
@@ -202,6 +243,9 @@ STATIC mp_obj_t esp32_rmt_deinit(mp_obj_t self_in) {
         rmt_driver_uninstall(self->channel_id);
         self->pin = -1; // -1 to indicate RMT is unused
         m_free(self->items);
+        self->items = NULL;
+        self->num_items = 0;
+        self->tx_buf = MP_OBJ_NULL;
     }
     return mp_const_none;
 }
@@ -268,8 +312,19 @@ STATIC mp_obj_t esp32_rmt_write_pulses(size_t n_args, const mp_obj_t *args) {
     size_t data_length = 0;
     mp_obj_t *data_ptr = NULL;
     mp_uint_t num_pulses = 0;
+    mp_buffer_info_t bufinfo = {0};
 
-    if (!(mp_obj_is_type(data_obj, &mp_type_tuple) || mp_obj_is_type(data_obj, &mp_type_list))) {
+    if (self->rx) {
+        mp_raise_ValueError(MP_ERROR_TEXT("channel is for rx"));
+    }
+
+    if (n_args == 2 && mp_get_buffer(duration_obj, &bufinfo, MP_BUFFER_READ)) {
+        // Mode 4: buffer of 16-bit (level << 15 | duration) values, transmitted in place
+        if (((uintptr_t)bufinfo.buf & 3) != 0 || bufinfo.len % sizeof(rmt_item32_t) != 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("buffer must be aligned and hold an even number of pulses"));
+        }
+        num_pulses = bufinfo.len / sizeof(uint16_t);
+    } else if (!(mp_obj_is_type(data_obj, &mp_type_tuple) || mp_obj_is_type(data_obj, &mp_type_list))) {
         // Mode 1: array of durations, toggle initial data value
         mp_obj_get_array(duration_obj, &duration_length, &duration_ptr);
         data = mp_obj_is_true(data_obj);
@@ -297,22 +352,28 @@ STATIC mp_obj_t esp32_rmt_write_pulses(size_t n_args, const mp_obj_t *args) {
     }
 
     mp_uint_t num_items = (num_pulses / 2) + (num_pulses % 2);
-    if (num_items > self->num_items) {
-        self->items = (rmt_item32_t *)m_realloc(self->items, num_items * sizeof(rmt_item32_t *));
-        self->num_items = num_items;
-    }
+    rmt_item32_t *items;
+    if (bufinfo.buf != NULL) {
+        items = bufinfo.buf;
+    } else {
+        if (num_items > self->num_items) {
+            self->items = (rmt_item32_t *)m_realloc(self->items, num_items * sizeof(rmt_item32_t *));
+            self->num_items = num_items;
+        }
+        items = self->items;
 
-    for (mp_uint_t item_index = 0, pulse_index = 0; item_index < num_items; item_index++) {
-        self->items[item_index].duration0 = duration_length ? mp_obj_get_int(duration_ptr[pulse_index]) : duration;
-        self->items[item_index].level0 = data_length ? mp_obj_is_true(data_ptr[pulse_index]) : data++;
-        pulse_index++;
-        if (pulse_index < num_pulses) {
-            self->items[item_index].duration1 = duration_length ? mp_obj_get_int(duration_ptr[pulse_index]) : duration;
-            self->items[item_index].level1 = data_length ? mp_obj_is_true(data_ptr[pulse_index]) : data++;
+        for (mp_uint_t item_index = 0, pulse_index = 0; item_index < num_items; item_index++) {
+            self->items[item_index].duration0 = duration_length ? mp_obj_get_int(duration_ptr[pulse_index]) : duration;
+            self->items[item_index].level0 = data_length ? mp_obj_is_true(data_ptr[pulse_index]) : data++;
             pulse_index++;
-        } else {
-            self->items[item_index].duration1 = 0;
-            self->items[item_index].level1 = 0;
+            if (pulse_index < num_pulses) {
+                self->items[item_index].duration1 = duration_length ? mp_obj_get_int(duration_ptr[pulse_index]) : duration;
+                self->items[item_index].level1 = data_length ? mp_obj_is_true(data_ptr[pulse_index]) : data++;
+                pulse_index++;
+            } else {
+                self->items[item_index].duration1 = 0;
+                self->items[item_index].level1 = 0;
+            }
         }
     }
 
@@ -326,7 +387,10 @@ STATIC mp_obj_t esp32_rmt_write_pulses(size_t n_args, const mp_obj_t *args) {
         check_esp_err(rmt_wait_tx_done(self->channel_id, portMAX_DELAY));
     }
 
-    check_esp_err(rmt_write_items(self->channel_id, self->items, num_items, false));
+    check_esp_err(rmt_write_items(self->channel_id, items, num_items, false));
+
+    // The previous sequence has finished, so its buffer can be released.
+    self->tx_buf = bufinfo.buf != NULL ? duration_obj : MP_OBJ_NULL;
 
     if (self->loop_en) {
         check_esp_err(rmt_set_tx_intr_en(self->channel_id, false));
@@ -337,8 +401,59 @@ STATIC mp_obj_t esp32_rmt_write_pulses(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(esp32_rmt_write_pulses_obj, 2, 3, esp32_rmt_write_pulses);
 
+// Wait up to timeout milliseconds (forever if negative) for a sequence of pulses to be
+// received, and copy them into buf as 16-bit (level << 15 | duration) values.  Returns
+// the number of pulses copied, or 0 on timeout.  Pulses that don't fit in buf are dropped.
+STATIC mp_obj_t esp32_rmt_read_pulses(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_self,    MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_buf,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    esp32_rmt_obj_t *self = MP_OBJ_TO_PTR(args[0].u_obj);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    mp_int_t timeout = args[2].u_int;
+
+    if (!self->rx) {
+        mp_raise_ValueError(MP_ERROR_TEXT("channel is for tx"));
+    }
+
+    RingbufHandle_t ringbuf;
+    check_esp_err(rmt_get_ringbuf_handle(self->channel_id, &ringbuf));
+
+    size_t len = 0;
+    MP_THREAD_GIL_EXIT();
+    rmt_item32_t *items = xRingbufferReceive(ringbuf, &len, timeout < 0 ? portMAX_DELAY : timeout / portTICK_PERIOD_MS);
+    MP_THREAD_GIL_ENTER();
+    if (items == NULL) {
+        return MP_OBJ_NEW_SMALL_INT(0);
+    }
+
+    // The sequence ends at the first zero duration, which the idle threshold produces.
+    const uint16_t *pulses = (const uint16_t *)items;
+    size_t max_pulses = MIN(len, bufinfo.len) / sizeof(uint16_t);
+    size_t num_pulses = 0;
+    while (num_pulses < max_pulses && (pulses[num_pulses] & 0x7fff) != 0) {
+        num_pulses++;
+    }
+    memcpy(bufinfo.buf, pulses, num_pulses * sizeof(uint16_t));
+    vRingbufferReturnItem(ringbuf, items);
+
+    return MP_OBJ_NEW_SMALL_INT(num_pulses);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(esp32_rmt_read_pulses_obj, 2, esp32_rmt_read_pulses);
+
 STATIC mp_obj_t esp32_rmt_bitstream_channel(size_t n_args, const mp_obj_t *args) {
     if (n_args > 0) {
+        #if MICROPY_PY_MACHINE_BITSTREAM
+        // Let any output on the current channel finish first.
+        machine_bitstream_deinit();
+        #endif
         if (args[0] == mp_const_none) {
             esp32_rmt_bitstream_channel_id = -1;
         } else {
@@ -366,6 +481,7 @@ STATIC const mp_rom_map_elem_t esp32_rmt_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_wait_done), MP_ROM_PTR(&esp32_rmt_wait_done_obj) },
     { MP_ROM_QSTR(MP_QSTR_loop), MP_ROM_PTR(&esp32_rmt_loop_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_pulses), MP_ROM_PTR(&esp32_rmt_write_pulses_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_pulses), MP_ROM_PTR(&esp32_rmt_read_pulses_obj) },
 
     // Static methods
     { MP_ROM_QSTR(MP_QSTR_bitstream_channel), MP_ROM_PTR(&esp32_rmt_bitstream_channel_obj) },
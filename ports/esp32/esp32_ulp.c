@@ -30,6 +30,24 @@
 
 #include "esp32/ulp.h"
 #include "esp_err.h"
+#include "soc/soc.h"
+
+// The ULP shares the start of RTC slow memory with the main cores.  The ULP can only
+// store the lower 16 bits of a 32-bit word, so all shared data is in 32-bit words.
+//
+// A ring buffer that the ULP fills while the main cores sleep has this layout, starting
+// at a word-aligned byte offset into RTC slow memory:
+//   word 0: write index, advanced by the ULP after it stores an entry
+//   word 1: read index, advanced by ring_read on the main core
+//   word 2: wake threshold, for the ULP program to compare against the number of
+//           unread entries before it executes WAKE
+//   word 3: capacity, the number of entries
+//   word 4...: the entries, with the value in the lower 16 bits
+#define ULP_RING_WRITE (0)
+#define ULP_RING_READ (1)
+#define ULP_RING_THRESHOLD (2)
+#define ULP_RING_CAPACITY (3)
+#define ULP_RING_HEADER_WORDS (4)
 
 typedef struct _esp32_ulp_obj_t {
     mp_obj_base_t base;
@@ -83,11 +101,73 @@ STATIC mp_obj_t esp32_ulp_run(mp_obj_t self_in, mp_obj_t entry_point_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(esp32_ulp_run_obj, esp32_ulp_run);
 
+// Return a memoryview of the 32-bit words of RTC slow memory reserved for the ULP.
+STATIC mp_obj_t esp32_ulp_memory(mp_obj_t self_in) {
+    return mp_obj_new_memoryview('I', CONFIG_ESP32_ULP_COPROC_RESERVE_MEM / sizeof(uint32_t), RTC_SLOW_MEM);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(esp32_ulp_memory_obj, esp32_ulp_memory);
+
+STATIC volatile uint32_t *esp32_ulp_get_ring(mp_obj_t offset_in, size_t capacity) {
+    mp_uint_t offset = mp_obj_get_int(offset_in);
+    if (offset % sizeof(uint32_t) != 0
+        || offset / sizeof(uint32_t) + ULP_RING_HEADER_WORDS + capacity > CONFIG_ESP32_ULP_COPROC_RESERVE_MEM / sizeof(uint32_t)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid offset"));
+    }
+    return (volatile uint32_t *)RTC_SLOW_MEM + offset / sizeof(uint32_t);
+}
+
+// ring_init(offset, capacity, threshold): set up an empty ring buffer at offset.
+STATIC mp_obj_t esp32_ulp_ring_init(size_t n_args, const mp_obj_t *args) {
+    mp_uint_t capacity = mp_obj_get_int(args[2]);
+    mp_uint_t threshold = mp_obj_get_int(args[3]);
+    if (capacity == 0 || capacity > 0xffff || threshold > capacity) {
+        mp_raise_ValueError(NULL);
+    }
+    volatile uint32_t *ring = esp32_ulp_get_ring(args[1], capacity);
+    ring[ULP_RING_WRITE] = 0;
+    ring[ULP_RING_READ] = 0;
+    ring[ULP_RING_THRESHOLD] = threshold;
+    ring[ULP_RING_CAPACITY] = capacity;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(esp32_ulp_ring_init_obj, 4, 4, esp32_ulp_ring_init);
+
+// ring_read(offset, buf): move unread entries from the ring buffer at offset into buf,
+// which holds 16-bit values, and return how many were moved.
+STATIC mp_obj_t esp32_ulp_ring_read(mp_obj_t self_in, mp_obj_t offset_in, mp_obj_t buf_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    volatile uint32_t *ring = esp32_ulp_get_ring(offset_in, 0);
+    uint32_t capacity = ring[ULP_RING_CAPACITY] & 0xffff;
+    ring = esp32_ulp_get_ring(offset_in, capacity);
+    uint32_t write = ring[ULP_RING_WRITE] & 0xffff;
+    uint32_t read = ring[ULP_RING_READ] & 0xffff;
+    if (capacity == 0 || write >= capacity || read >= capacity) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid ring"));
+    }
+    uint16_t *dest = bufinfo.buf;
+    size_t n = 0;
+    size_t max = bufinfo.len / sizeof(uint16_t);
+    while (read != write && n < max) {
+        dest[n++] = ring[ULP_RING_HEADER_WORDS + read];
+        if (++read == capacity) {
+            read = 0;
+        }
+    }
+    ring[ULP_RING_READ] = read;
+    return MP_OBJ_NEW_SMALL_INT(n);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(esp32_ulp_ring_read_obj, esp32_ulp_ring_read);
+
 STATIC const mp_rom_map_elem_t esp32_ulp_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_set_wakeup_period), MP_ROM_PTR(&esp32_ulp_set_wakeup_period_obj) },
     { MP_ROM_QSTR(MP_QSTR_load_binary), MP_ROM_PTR(&esp32_ulp_load_binary_obj) },
     { MP_ROM_QSTR(MP_QSTR_run), MP_ROM_PTR(&esp32_ulp_run_obj) },
+    { MP_ROM_QSTR(MP_QSTR_memory), MP_ROM_PTR(&esp32_ulp_memory_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ring_init), MP_ROM_PTR(&esp32_ulp_ring_init_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ring_read), MP_ROM_PTR(&esp32_ulp_ring_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_RESERVE_MEM), MP_ROM_INT(CONFIG_ESP32_ULP_COPROC_RESERVE_MEM) },
+    { MP_ROM_QSTR(MP_QSTR_MEM_ADDR), MP_ROM_INT(SOC_RTC_DATA_LOW) },
 };
 STATIC MP_DEFINE_CONST_DICT(esp32_ulp_locals_dict, esp32_ulp_locals_dict_table);
 
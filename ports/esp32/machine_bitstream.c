@@ -24,8 +24,11 @@
  * THE SOFTWARE.
  */
 
-#include "py/mpconfig.h"
+#include <string.h>
+
+#include "py/runtime.h"
 #include "py/mphal.h"
+#include "extmod/machine_bitstream.h"
 #include "modesp32.h"
 
 #if MICROPY_PY_MACHINE_BITSTREAM
@@ -150,8 +153,52 @@ STATIC void IRAM_ATTR bitstream_high_low_rmt_adapter(const void *src, rmt_item32
     *item_num = num;
 }
 
+// State of the output running in the background.  The data is copied to
+// machine_bitstream_buf (a root pointer) so the caller can change its buffer,
+// and the translator reads from the copy as the output runs.
+STATIC struct {
+    bool active;
+    rmt_channel_t channel;
+    mp_hal_pin_obj_t pin;
+    uint32_t timeout_ms;
+    size_t buf_alloc;
+} bitstream_rmt;
+
+// Wait for the output in progress (if any) to finish, and release the channel.
+STATIC void machine_bitstream_rmt_finish(bool poll) {
+    if (!bitstream_rmt.active) {
+        return;
+    }
+    if (poll) {
+        uint32_t t0 = mp_hal_ticks_ms();
+        while (rmt_wait_tx_done(bitstream_rmt.channel, 0) == ESP_ERR_TIMEOUT
+               && mp_hal_ticks_ms() - t0 < bitstream_rmt.timeout_ms) {
+            MICROPY_EVENT_POLL_HOOK
+        }
+    } else {
+        rmt_wait_tx_done(bitstream_rmt.channel, pdMS_TO_TICKS(bitstream_rmt.timeout_ms));
+    }
+    bitstream_rmt.active = false;
+
+    // Uninstall the driver.
+    check_esp_err(rmt_driver_uninstall(bitstream_rmt.channel));
+
+    // Cancel RMT output to GPIO pin.
+    gpio_matrix_out(bitstream_rmt.pin, SIG_GPIO_OUT_IDX, false, false);
+}
+
 // Use the reserved RMT channel to stream high/low data on the specified pin.
+// This returns once the output has started.
 STATIC void machine_bitstream_high_low_rmt(mp_hal_pin_obj_t pin, uint32_t *timing_ns, const uint8_t *buf, size_t len, uint8_t channel_id) {
+    // Take a copy of the data, reusing the last buffer if it's big enough.
+    uint8_t *data = MP_STATE_PORT(machine_bitstream_buf);
+    if (data == NULL || bitstream_rmt.buf_alloc < len) {
+        data = m_renew(uint8_t, data, bitstream_rmt.buf_alloc, len);
+        MP_STATE_PORT(machine_bitstream_buf) = data;
+        bitstream_rmt.buf_alloc = len;
+    }
+    memcpy(data, buf, len);
+
     rmt_config_t config = RMT_DEFAULT_CONFIG_TX(pin, channel_id);
 
     // Use 40MHz clock (although 2MHz would probably be sufficient).
@@ -159,7 +206,7 @@ STATIC void machine_bitstream_high_low_rmt(mp_hal_pin_obj_t pin, uint32_t *timin
 
     // Install the driver on this channel & pin.
     check_esp_err(rmt_config(&config));
-    check_esp_err(rmt_driver_install_core1(config.channel));
+    check_esp_err(rmt_driver_install_core1(config.channel, 0));
 
     // Get the tick rate in kHz (this will likely be 40000).
     uint32_t counter_clk_khz = 0;
@@ -182,24 +229,21 @@ STATIC void machine_bitstream_high_low_rmt(mp_hal_pin_obj_t pin, uint32_t *timin
     // Install the bits->highlow translator.
     rmt_translator_init(config.channel, bitstream_high_low_rmt_adapter);
 
-    // Stream the byte data using the translator.
-    check_esp_err(rmt_write_sample(config.channel, buf, len, true));
-
-    // Wait 50% longer than we expect (if every bit takes the maximum time).
-    uint32_t timeout_ms = (3 * len / 2) * (1 + (8 * MAX(timing_ns[0] + timing_ns[1], timing_ns[2] + timing_ns[3])) / 1000);
-    check_esp_err(rmt_wait_tx_done(config.channel, pdMS_TO_TICKS(timeout_ms)));
-
-    // Uninstall the driver.
-    check_esp_err(rmt_driver_uninstall(config.channel));
-
-    // Cancel RMT output to GPIO pin.
-    gpio_matrix_out(pin, SIG_GPIO_OUT_IDX, false, false);
+    // Stream the byte data using the translator, without waiting for it to finish.
+    bitstream_rmt.active = true;
+    bitstream_rmt.channel = config.channel;
+    bitstream_rmt.pin = pin;
+    // Wait up to 50% longer than we expect (if every bit takes the maximum time).
+    bitstream_rmt.timeout_ms = (3 * len / 2) * (1 + (8 * MAX(timing_ns[0] + timing_ns[1], timing_ns[2] + timing_ns[3])) / 1000);
+    check_esp_err(rmt_write_sample(config.channel, data, len, false));
 }
 
 /******************************************************************************/
 // Interface to machine.bitstream
 
 void machine_bitstream_high_low(mp_hal_pin_obj_t pin, uint32_t *timing_ns, const uint8_t *buf, size_t len) {
+    // Only one output runs at a time.
+    machine_bitstream_rmt_finish(true);
     if (esp32_rmt_bitstream_channel_id < 0) {
         machine_bitstream_high_low_bitbang(pin, timing_ns, buf, len);
     } else {
@@ -207,4 +251,10 @@ void machine_bitstream_high_low(mp_hal_pin_obj_t pin, uint32_t *timing_ns, const
     }
 }
 
+void machine_bitstream_deinit(void) {
+    machine_bitstream_rmt_finish(false);
+    MP_STATE_PORT(machine_bitstream_buf) = NULL;
+    bitstream_rmt.buf_alloc = 0;
+}
+
 #endif // MICROPY_PY_MACHINE_BITSTREAM
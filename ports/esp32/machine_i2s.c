@@ -86,14 +86,12 @@
 
 #define DMA_BUF_LEN_IN_I2S_FRAMES (256)
 
-// The transform buffer is used with the readinto() method to bridge the opaque DMA memory on the ESP devices
-// with the app buffer.  It facilitates audio sample transformations.  e.g.  32-bits samples to 16-bit samples.
-// The size of 240 bytes is an engineering optimum that balances transfer performance with an acceptable use of heap space
-#define SIZEOF_TRANSFORM_BUFFER_IN_BYTES (240)
-
-#define NUM_I2S_USER_FORMATS (4)
 #define I2S_RX_FRAME_SIZE_IN_BYTES (8)
 
+// The transform buffer is used with the readinto() method for the last frames, once the unfilled part
+// of the app buffer is smaller than a DMA frame.  That is at most 3 frames, for 16-bit mono.
+#define SIZEOF_TRANSFORM_BUFFER_IN_BYTES (3 * I2S_RX_FRAME_SIZE_IN_BYTES)
+
 typedef enum {
     MONO,
     STEREO
@@ -137,16 +135,6 @@ typedef struct _machine_i2s_obj_t {
 
 STATIC mp_obj_t machine_i2s_deinit(mp_obj_t self_in);
 
-// The frame map is used with the readinto() method to transform the audio sample data coming
-// from DMA memory (32-bit stereo, with the L and R channels reversed) to the format specified
-// in the I2S constructor.  e.g.  16-bit mono
-STATIC const int8_t i2s_frame_map[NUM_I2S_USER_FORMATS][I2S_RX_FRAME_SIZE_IN_BYTES] = {
-    { 6,  7, -1, -1, -1, -1, -1, -1 },  // Mono, 16-bits
-    { 4,  5,  6,  7, -1, -1, -1, -1 },  // Mono, 32-bits
-    { 6,  7,  2,  3, -1, -1, -1, -1 },  // Stereo, 16-bits
-    { 4,  5,  6,  7,  0,  1,  2,  3 },  // Stereo, 32-bits
-};
-
 void machine_i2s_init0() {
     for (i2s_port_t p = 0; p < I2S_NUM_MAX; p++) {
         MP_STATE_PORT(machine_i2s_obj)[p] = NULL;
@@ -187,22 +175,6 @@ STATIC void swap_32_bit_stereo_channels(mp_buffer_info_t *bufinfo) {
     }
 }
 
-STATIC int8_t get_frame_mapping_index(i2s_bits_per_sample_t bits, format_t format) {
-    if (format == MONO) {
-        if (bits == I2S_BITS_PER_SAMPLE_16BIT) {
-            return 0;
-        } else { // 32 bits
-            return 1;
-        }
-    } else { // STEREO
-        if (bits == I2S_BITS_PER_SAMPLE_16BIT) {
-            return 2;
-        } else { // 32 bits
-            return 3;
-        }
-    }
-}
-
 STATIC i2s_bits_per_sample_t get_dma_bits(uint8_t mode, i2s_bits_per_sample_t bits) {
     if (mode == (I2S_MODE_MASTER | I2S_MODE_TX)) {
         return bits;
@@ -235,25 +207,67 @@ STATIC uint32_t get_dma_buf_count(uint8_t mode, i2s_bits_per_sample_t bits, form
     return dma_buf_count;
 }
 
+// Convert frames read from DMA memory (32-bit stereo, with the R channel first) to the format
+// specified in the I2S constructor, keeping the most significant half of each sample for 16 bits.
+// Each converted frame is no longer than the frame it came from, so dest may be the same as src.
+STATIC void convert_dma_frames(machine_i2s_obj_t *self, uint8_t *dest, const uint8_t *src, size_t num_frames) {
+    uint32_t frame[2]; // frame[0] is the R channel, frame[1] the L channel
+    if (self->bits == I2S_BITS_PER_SAMPLE_16BIT) {
+        uint16_t out[2];
+        size_t out_len = self->format == STEREO ? 4 : 2;
+        for (size_t i = 0; i < num_frames; i++) {
+            memcpy(frame, src, I2S_RX_FRAME_SIZE_IN_BYTES);
+            src += I2S_RX_FRAME_SIZE_IN_BYTES;
+            out[0] = frame[1] >> 16;
+            out[1] = frame[0] >> 16;
+            memcpy(dest, out, out_len);
+            dest += out_len;
+        }
+    } else { // 32 bits
+        uint32_t out[2];
+        size_t out_len = self->format == STEREO ? 8 : 4;
+        for (size_t i = 0; i < num_frames; i++) {
+            memcpy(frame, src, I2S_RX_FRAME_SIZE_IN_BYTES);
+            src += I2S_RX_FRAME_SIZE_IN_BYTES;
+            out[0] = frame[1];
+            out[1] = frame[0];
+            memcpy(dest, out, out_len);
+            dest += out_len;
+        }
+    }
+}
+
 STATIC uint32_t fill_appbuf_from_dma(machine_i2s_obj_t *self, mp_buffer_info_t *appbuf) {
 
     // copy audio samples from DMA memory to the app buffer
     // audio samples are read from DMA memory in chunks
-    // loop, reading and copying chunks until the app buffer is filled
+    // loop, reading and converting chunks until the app buffer is filled
     // For uasyncio mode, the loop will make an early exit if DMA memory becomes empty
     // Example:
     //   a MicroPython I2S object is configured for 16-bit mono (2 bytes per audio sample).
-    //   For every frame coming from DMA (8 bytes), 2 bytes are "cherry picked" and
-    //   copied to the supplied app buffer.
+    //   For every frame coming from DMA (8 bytes), 2 bytes are kept in the app buffer.
     //   Thus, for every 1 byte copied to the app buffer, 4 bytes are read from DMA memory.
     //   If a 8kB app buffer is supplied, 32kB of audio samples is read from DMA memory.
+    //
+    // Each chunk is read straight into the unfilled part of the app buffer and converted in
+    // place, so the samples are only copied once.  The transform buffer is only used for the
+    // last few frames, when the unfilled part of the app buffer is smaller than a DMA frame.
 
-    uint32_t a_index = 0;
     uint8_t *app_p = appbuf->buf;
+    uint8_t *app_end = app_p + appbuf->len;
     uint8_t appbuf_sample_size_in_bytes = (self->bits / 8) * (self->format == STEREO ? 2: 1);
-    uint32_t num_bytes_needed_from_dma = appbuf->len * (I2S_RX_FRAME_SIZE_IN_BYTES / appbuf_sample_size_in_bytes);
-    while (num_bytes_needed_from_dma) {
-        size_t num_bytes_requested_from_dma = MIN(sizeof(self->transform_buffer), num_bytes_needed_from_dma);
+    size_t num_frames_needed = appbuf->len / appbuf_sample_size_in_bytes;
+    while (num_frames_needed) {
+        uint8_t *dma_p;
+        size_t num_frames_to_read;
+        if (app_end - app_p >= I2S_RX_FRAME_SIZE_IN_BYTES) {
+            dma_p = app_p;
+            num_frames_to_read = (app_end - app_p) / I2S_RX_FRAME_SIZE_IN_BYTES;
+        } else {
+            dma_p = self->transform_buffer;
+            num_frames_to_read = sizeof(self->transform_buffer) / I2S_RX_FRAME_SIZE_IN_BYTES;
+        }
+        size_t num_bytes_requested_from_dma = MIN(num_frames_to_read, num_frames_needed) * I2S_RX_FRAME_SIZE_IN_BYTES;
         size_t num_bytes_received_from_dma = 0;
 
         TickType_t delay;
@@ -265,7 +279,7 @@ STATIC uint32_t fill_appbuf_from_dma(machine_i2s_obj_t *self, mp_buffer_info_t *
 
         esp_err_t ret = i2s_read(
             self->port,
-            self->transform_buffer,
+            dma_p,
             num_bytes_requested_from_dma,
             &num_bytes_received_from_dma,
             delay);
@@ -280,32 +294,10 @@ STATIC uint32_t fill_appbuf_from_dma(machine_i2s_obj_t *self, mp_buffer_info_t *
 
         check_esp_err(ret);
 
-        // process the transform buffer one frame at a time.
-        // copy selected bytes from the transform buffer into the user supplied appbuf.
-        // Example:
-        //   a MicroPython I2S object is configured for 16-bit mono.  This configuration associates to
-        //   a frame map index of 0 = { 6,  7, -1, -1, -1, -1, -1, -1 } in the i2s_frame_map array
-        //   This mapping indicates:
-        //      appbuf[x+0] = frame[6]
-        //      appbuf[x+1] = frame[7]
-        //      frame bytes 0-5 are not used
-
-        uint32_t t_index = 0;
-        uint8_t f_index = get_frame_mapping_index(self->bits, self->format);
-        while (t_index < num_bytes_received_from_dma) {
-            uint8_t *transform_p = self->transform_buffer + t_index;
-
-            for (uint8_t i = 0; i < I2S_RX_FRAME_SIZE_IN_BYTES; i++) {
-                int8_t t_to_a_mapping = i2s_frame_map[f_index][i];
-                if (t_to_a_mapping != -1) {
-                    *app_p++ = transform_p[t_to_a_mapping];
-                    a_index++;
-                }
-                t_index++;
-            }
-        }
-
-        num_bytes_needed_from_dma -= num_bytes_received_from_dma;
+        size_t num_frames_received = num_bytes_received_from_dma / I2S_RX_FRAME_SIZE_IN_BYTES;
+        convert_dma_frames(self, app_p, dma_p, num_frames_received);
+        app_p += num_frames_received * appbuf_sample_size_in_bytes;
+        num_frames_needed -= num_frames_received;
 
         if ((self->io_mode == UASYNCIO) && (num_bytes_received_from_dma < num_bytes_requested_from_dma)) {
             // Unable to fill the entire app buffer from DMA memory.  This indicates all DMA RX buffers are empty.
@@ -316,7 +308,7 @@ STATIC uint32_t fill_appbuf_from_dma(machine_i2s_obj_t *self, mp_buffer_info_t *
         }
     }
 
-    return a_index;
+    return app_p - (uint8_t *)appbuf->buf;
 }
 
 STATIC size_t copy_appbuf_to_dma(machine_i2s_obj_t *self, mp_buffer_info_t *appbuf) {
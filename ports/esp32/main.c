@@ -34,6 +34,7 @@
 #include "freertos/task.h"
 #include "esp_system.h"
 #include "nvs_flash.h"
+#include "nvs.h"
 #include "esp_task.h"
 #include "soc/cpu.h"
 #include "esp_log.h"
@@ -64,6 +65,7 @@
 #include "mpthreadport.h"
 
 #if MICROPY_BLUETOOTH_NIMBLE
+#include "extmod/machine_bitstream.h"
 #include "extmod/modbluetooth.h"
 #endif
 
@@ -78,11 +80,31 @@
 #define MP_TASK_STACK_LIMIT_MARGIN (1024)
 #endif
 
+// When SPIRAM is used for the heap, this much internal RAM is the first area
+// of the heap, which small objects are allocated from first, and the tables
+// of the SPIRAM area are put in internal RAM too; but only while this much
+// internal RAM is left for the system.
+#ifndef MICROPY_ESP32_GC_INTERNAL_HEAP_SIZE
+#define MICROPY_ESP32_GC_INTERNAL_HEAP_SIZE (64 * 1024)
+#endif
+#ifndef MICROPY_ESP32_INTERNAL_RAM_RESERVE
+#define MICROPY_ESP32_INTERNAL_RAM_RESERVE (96 * 1024)
+#endif
+
 int vprintf_null(const char *format, va_list ap) {
     // do nothing: this is used as a log target during raw repl mode
     return 0;
 }
 
+#if MICROPY_GC_SPLIT_HEAP
+STATIC void *esp32_internal_alloc(size_t len) {
+    if (heap_caps_get_free_size(MALLOC_CAP_INTERNAL) < len + MICROPY_ESP32_INTERNAL_RAM_RESERVE) {
+        return NULL;
+    }
+    return heap_caps_malloc(len, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+#endif
+
 void mp_task(void *pvParameter) {
     volatile uint32_t sp = (uint32_t)get_sp();
     #if MICROPY_PY_THREAD
@@ -129,6 +151,24 @@ void mp_task(void *pvParameter) {
     }
     #endif
 
+    #if MICROPY_GC_SPLIT_HEAP
+    void *spiram_heap = NULL;
+    size_t spiram_heap_size = 0;
+    void *spiram_tables = NULL;
+    if (mp_task_heap != NULL) {
+        // Access to SPIRAM goes through the cache, so keep the objects that
+        // are used the most, and the tables that the GC scans, in internal RAM
+        void *internal_heap = esp32_internal_alloc(MICROPY_ESP32_GC_INTERNAL_HEAP_SIZE);
+        if (internal_heap != NULL) {
+            spiram_heap = mp_task_heap;
+            spiram_heap_size = mp_task_heap_size;
+            spiram_tables = esp32_internal_alloc(gc_area_tables_size(spiram_heap_size));
+            mp_task_heap = internal_heap;
+            mp_task_heap_size = MICROPY_ESP32_GC_INTERNAL_HEAP_SIZE;
+        }
+    }
+    #endif
+
     if (mp_task_heap == NULL) {
         // Allocate the uPy heap using malloc and get the largest available region,
         // limiting to 1/2 total available memory to leave memory for the OS.
@@ -148,6 +188,13 @@ soft_reset:
     mp_stack_set_top((void *)sp);
     mp_stack_set_limit(MP_TASK_STACK_SIZE - MP_TASK_STACK_LIMIT_MARGIN);
     gc_init(mp_task_heap, mp_task_heap + mp_task_heap_size);
+    #if MICROPY_GC_SPLIT_HEAP
+    if (spiram_tables != NULL) {
+        gc_add_with_tables(spiram_tables, spiram_heap, spiram_heap + spiram_heap_size);
+    } else if (spiram_heap != NULL) {
+        gc_add(spiram_heap, spiram_heap + spiram_heap_size);
+    }
+    #endif
     mp_init();
     mp_obj_list_append(mp_sys_path, MP_OBJ_NEW_QSTR(MP_QSTR__slash_lib));
     readline_init0();
@@ -192,6 +239,10 @@ soft_reset_exit:
 
     machine_timer_deinit_all();
 
+    #if MICROPY_PY_MACHINE_BITSTREAM
+    machine_bitstream_deinit();
+    #endif
+
     #if MICROPY_PY_THREAD
     mp_thread_deinit();
     #endif
@@ -216,6 +267,12 @@ soft_reset_exit:
     machine_pins_deinit();
     machine_deinit();
     usocket_events_deinit();
+    #if MICROPY_PY_ESPNOW
+    espnow_deinit();
+    #endif
+    #if MICROPY_PY_NETWORK_WLAN
+    network_wlan_deinit();
+    #endif
 
     mp_deinit();
     fflush(stdout);
@@ -230,13 +287,27 @@ void boardctrl_startup(void) {
     }
 }
 
+STATIC BaseType_t mp_task_coreid(void) {
+    BaseType_t coreid = MP_TASK_COREID;
+    nvs_handle_t handle;
+    if (nvs_open(MP_TASK_NVS_NAMESPACE, NVS_READONLY, &handle) == ESP_OK) {
+        int8_t value;
+        if (nvs_get_i8(handle, MP_TASK_NVS_COREID_KEY, &value) == ESP_OK
+            && value >= 0 && value < portNUM_PROCESSORS) {
+            coreid = value;
+        }
+        nvs_close(handle);
+    }
+    return coreid;
+}
+
 void app_main(void) {
     // Hook for a board to run code at start up.
     // This defaults to initialising NVS.
     MICROPY_BOARD_STARTUP();
 
     // Create and transfer control to the MicroPython task.
-    xTaskCreatePinnedToCore(mp_task, "mp_task", MP_TASK_STACK_SIZE / sizeof(StackType_t), NULL, MP_TASK_PRIORITY, &mp_main_task_handle, MP_TASK_COREID);
+    xTaskCreatePinnedToCore(mp_task, "mp_task", MP_TASK_STACK_SIZE / sizeof(StackType_t), NULL, MP_TASK_PRIORITY, &mp_main_task_handle, mp_task_coreid());
 }
 
 void nlr_jump_fail(void *val) {
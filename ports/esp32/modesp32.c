@@ -33,7 +33,9 @@
 #include "driver/gpio.h"
 #include "driver/adc.h"
 #include "esp_heap_caps.h"
+#include "esp_task.h"
 #include "multi_heap.h"
+#include "nvs.h"
 
 #include "py/nlr.h"
 #include "py/obj.h"
@@ -63,6 +65,14 @@ STATIC mp_obj_t esp32_wake_on_touch(const mp_obj_t wake) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(esp32_wake_on_touch_obj, esp32_wake_on_touch);
 
+#if CONFIG_IDF_TARGET_ESP32
+STATIC mp_obj_t esp32_wake_on_ulp(const mp_obj_t wake) {
+    machine_rtc_config.wake_on_ulp = mp_obj_is_true(wake);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(esp32_wake_on_ulp_obj, esp32_wake_on_ulp);
+#endif
+
 STATIC mp_obj_t esp32_wake_on_ext0(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
 
     if (machine_rtc_config.wake_on_touch) {
@@ -191,10 +201,69 @@ STATIC mp_obj_t esp32_idf_heap_info(const mp_obj_t cap_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(esp32_idf_heap_info_obj, esp32_idf_heap_info);
 
+#if MICROPY_PY_THREAD
+STATIC mp_obj_t esp32_thread_config(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum {ARG_core, ARG_priority, ARG_main_core};
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_core, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_priority, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_main_core, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    BaseType_t core;
+    UBaseType_t priority;
+    mp_thread_get_config(&core, &priority);
+
+    if (args[ARG_core].u_obj != mp_const_none) {
+        core = mp_obj_get_int(args[ARG_core].u_obj);
+        if (core < 0 || core >= portNUM_PROCESSORS) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid core"));
+        }
+    }
+    if (args[ARG_priority].u_obj != mp_const_none) {
+        mp_int_t value = mp_obj_get_int(args[ARG_priority].u_obj);
+        if (value <= ESP_TASK_PRIO_MIN || value >= configMAX_PRIORITIES) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid priority"));
+        }
+        priority = value;
+    }
+    mp_thread_set_config(core, priority);
+
+    if (args[ARG_main_core].u_obj != mp_const_none) {
+        mp_int_t main_core = mp_obj_get_int(args[ARG_main_core].u_obj);
+        if (main_core < 0 || main_core >= portNUM_PROCESSORS) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid core"));
+        }
+        // A running task can't be moved, so this takes effect from the next hard reset.
+        nvs_handle_t handle;
+        check_esp_err(nvs_open(MP_TASK_NVS_NAMESPACE, NVS_READWRITE, &handle));
+        esp_err_t err = nvs_set_i8(handle, MP_TASK_NVS_COREID_KEY, main_core);
+        if (err == ESP_OK) {
+            err = nvs_commit(handle);
+        }
+        nvs_close(handle);
+        check_esp_err(err);
+    }
+
+    mp_obj_t tuple[3] = {
+        MP_OBJ_NEW_SMALL_INT(core),
+        MP_OBJ_NEW_SMALL_INT(priority),
+        MP_OBJ_NEW_SMALL_INT(xTaskGetAffinity(mp_main_task_handle)),
+    };
+    return mp_obj_new_tuple(3, tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(esp32_thread_config_obj, 0, esp32_thread_config);
+#endif
+
 STATIC const mp_rom_map_elem_t esp32_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_esp32) },
 
     { MP_ROM_QSTR(MP_QSTR_wake_on_touch), MP_ROM_PTR(&esp32_wake_on_touch_obj) },
+    #if CONFIG_IDF_TARGET_ESP32
+    { MP_ROM_QSTR(MP_QSTR_wake_on_ulp), MP_ROM_PTR(&esp32_wake_on_ulp_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_wake_on_ext0), MP_ROM_PTR(&esp32_wake_on_ext0_obj) },
     { MP_ROM_QSTR(MP_QSTR_wake_on_ext1), MP_ROM_PTR(&esp32_wake_on_ext1_obj) },
     { MP_ROM_QSTR(MP_QSTR_gpio_deep_sleep_hold), MP_ROM_PTR(&esp32_gpio_deep_sleep_hold_obj) },
@@ -203,6 +272,9 @@ STATIC const mp_rom_map_elem_t esp32_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_hall_sensor), MP_ROM_PTR(&esp32_hall_sensor_obj) },
     #endif
     { MP_ROM_QSTR(MP_QSTR_idf_heap_info), MP_ROM_PTR(&esp32_idf_heap_info_obj) },
+    #if MICROPY_PY_THREAD
+    { MP_ROM_QSTR(MP_QSTR_thread_config), MP_ROM_PTR(&esp32_thread_config_obj) },
+    #endif
 
     { MP_ROM_QSTR(MP_QSTR_NVS), MP_ROM_PTR(&esp32_nvs_type) },
     { MP_ROM_QSTR(MP_QSTR_Partition), MP_ROM_PTR(&esp32_partition_type) },
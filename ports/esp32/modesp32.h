@@ -66,6 +66,6 @@ extern const mp_obj_type_t esp32_partition_type;
 extern const mp_obj_type_t esp32_rmt_type;
 extern const mp_obj_type_t esp32_ulp_type;
 
-esp_err_t rmt_driver_install_core1(uint8_t channel_id);
+esp_err_t rmt_driver_install_core1(uint8_t channel_id, size_t rx_buf_size);
 
 #endif // MICROPY_INCLUDED_ESP32_MODESP32_H
@@ -0,0 +1,415 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "py/stream.h"
+#include "modnetwork.h"
+
+#include "esp_now.h"
+#include "freertos/ringbuf.h"
+#include "freertos/semphr.h"
+
+#if MICROPY_PY_ESPNOW
+
+// The espnow module sends and receives ESP-NOW packets, which go directly between
+// devices on the WiFi radio without an access point or the TCP/IP stack.
+//
+// Received packets are put by the WiFi task into a ring buffer in C, one item per packet
+// holding the sender's MAC address followed by the data, and the main task is woken.
+// recvinto() then copies a packet into buffers supplied by Python, so receiving doesn't
+// allocate from the heap.  send() returns once the packet is queued and doesn't wait for
+// the ACK unless sync=True; the ACK callback only counts responses and failures.
+
+#define ESPNOW_DEFAULT_RXBUF (526 * 4)
+#define ESPNOW_DEFAULT_TIMEOUT_MS (300000)
+#define ESPNOW_MAC_LEN (6)
+
+typedef struct _espnow_state_t {
+    RingbufHandle_t ringbuf;
+    SemaphoreHandle_t tx_sem;
+    size_t rxbuf;
+    mp_int_t timeout_ms;
+    volatile uint32_t tx_pkts;
+    volatile uint32_t tx_responses;
+    volatile uint32_t tx_failures;
+    volatile uint32_t rx_packets;
+    volatile uint32_t rx_dropped;
+} espnow_state_t;
+
+STATIC espnow_state_t espnow_state = {
+    .rxbuf = ESPNOW_DEFAULT_RXBUF,
+    .timeout_ms = ESPNOW_DEFAULT_TIMEOUT_MS,
+};
+
+// Called in the WiFi task when a packet arrives.
+STATIC void espnow_recv_cb(const uint8_t *mac_addr, const uint8_t *data, int data_len) {
+    uint8_t *item;
+    if (xRingbufferSendAcquire(espnow_state.ringbuf, (void **)&item, ESPNOW_MAC_LEN + data_len, 0) != pdTRUE) {
+        espnow_state.rx_dropped++;
+        return;
+    }
+    memcpy(item, mac_addr, ESPNOW_MAC_LEN);
+    memcpy(item + ESPNOW_MAC_LEN, data, data_len);
+    xRingbufferSendComplete(espnow_state.ringbuf, item);
+    espnow_state.rx_packets++;
+    xTaskNotifyGive(mp_main_task_handle);
+}
+
+// Called in the WiFi task when a sent packet is ACKed or has failed.
+STATIC void espnow_send_cb(const uint8_t *mac_addr, esp_now_send_status_t status) {
+    if (status != ESP_NOW_SEND_SUCCESS) {
+        espnow_state.tx_failures++;
+    }
+    espnow_state.tx_responses++;
+    xSemaphoreGive(espnow_state.tx_sem);
+}
+
+STATIC void espnow_check_active(void) {
+    if (espnow_state.ringbuf == NULL) {
+        mp_raise_OSError(MP_EPERM);
+    }
+}
+
+STATIC void espnow_get_mac(mp_obj_t mac_in, uint8_t **mac) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(mac_in, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len != ESPNOW_MAC_LEN) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid MAC address"));
+    }
+    *mac = bufinfo.buf;
+}
+
+// Wait for a received packet, returning the ring buffer item or NULL on timeout.
+STATIC uint8_t *espnow_wait_recv(size_t *len, mp_int_t timeout_ms) {
+    mp_uint_t start = mp_hal_ticks_ms();
+    for (;;) {
+        uint8_t *item = xRingbufferReceive(espnow_state.ringbuf, len, 0);
+        if (item != NULL || (timeout_ms >= 0 && mp_hal_ticks_ms() - start >= (mp_uint_t)timeout_ms)) {
+            return item;
+        }
+        MICROPY_EVENT_POLL_HOOK
+    }
+}
+
+void espnow_deinit(void) {
+    if (espnow_state.ringbuf != NULL) {
+        esp_now_unregister_recv_cb();
+        esp_now_unregister_send_cb();
+        esp_now_deinit();
+        vRingbufferDelete(espnow_state.ringbuf);
+        vSemaphoreDelete(espnow_state.tx_sem);
+        espnow_state.ringbuf = NULL;
+    }
+    espnow_state.rxbuf = ESPNOW_DEFAULT_RXBUF;
+    espnow_state.timeout_ms = ESPNOW_DEFAULT_TIMEOUT_MS;
+}
+
+STATIC mp_obj_t espnow_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    mp_obj_base_t *self = mp_obj_malloc(mp_obj_base_t, type);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t espnow_active(size_t n_args, const mp_obj_t *args) {
+    if (n_args > 1) {
+        if (mp_obj_is_true(args[1])) {
+            if (espnow_state.ringbuf == NULL) {
+                RingbufHandle_t ringbuf = xRingbufferCreate(espnow_state.rxbuf, RINGBUF_TYPE_NOSPLIT);
+                if (ringbuf == NULL) {
+                    mp_raise_OSError(MP_ENOMEM);
+                }
+                esp_err_t err = esp_now_init();
+                if (err != ESP_OK) {
+                    vRingbufferDelete(ringbuf);
+                    check_esp_err(err);
+                }
+                espnow_state.tx_sem = xSemaphoreCreateCounting(UINT32_MAX, 0);
+                espnow_state.tx_pkts = 0;
+                espnow_state.tx_responses = 0;
+                espnow_state.tx_failures = 0;
+                espnow_state.rx_packets = 0;
+                espnow_state.rx_dropped = 0;
+                espnow_state.ringbuf = ringbuf;
+                check_esp_err(esp_now_register_recv_cb(espnow_recv_cb));
+                check_esp_err(esp_now_register_send_cb(espnow_send_cb));
+            }
+        } else {
+            mp_int_t timeout_ms = espnow_state.timeout_ms;
+            size_t rxbuf = espnow_state.rxbuf;
+            espnow_deinit();
+            espnow_state.timeout_ms = timeout_ms;
+            espnow_state.rxbuf = rxbuf;
+        }
+    }
+    return mp_obj_new_bool(espnow_state.ringbuf != NULL);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espnow_active_obj, 1, 2, espnow_active);
+
+STATIC mp_obj_t espnow_config(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_rxbuf, ARG_timeout_ms };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_rxbuf, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_timeout_ms, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (args[ARG_rxbuf].u_int >= 0) {
+        // takes effect when next made active
+        espnow_state.rxbuf = args[ARG_rxbuf].u_int;
+    }
+    if (args[ARG_timeout_ms].u_obj != mp_const_none) {
+        espnow_state.timeout_ms = mp_obj_get_int(args[ARG_timeout_ms].u_obj);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(espnow_config_obj, 1, espnow_config);
+
+STATIC mp_obj_t espnow_add_peer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_mac, ARG_lmk, ARG_channel, ARG_ifidx, ARG_encrypt };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_mac, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_lmk, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_channel, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_ifidx, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = WIFI_IF_STA} },
+        { MP_QSTR_encrypt, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    espnow_check_active();
+
+    esp_now_peer_info_t peer = {0};
+    uint8_t *mac;
+    espnow_get_mac(args[ARG_mac].u_obj, &mac);
+    memcpy(peer.peer_addr, mac, ESPNOW_MAC_LEN);
+    if (args[ARG_lmk].u_obj != mp_const_none) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(args[ARG_lmk].u_obj, &bufinfo, MP_BUFFER_READ);
+        if (bufinfo.len != ESP_NOW_KEY_LEN) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid key"));
+        }
+        memcpy(peer.lmk, bufinfo.buf, ESP_NOW_KEY_LEN);
+    }
+    peer.channel = args[ARG_channel].u_int;
+    peer.ifidx = args[ARG_ifidx].u_int;
+    if (args[ARG_encrypt].u_obj != mp_const_none) {
+        peer.encrypt = mp_obj_is_true(args[ARG_encrypt].u_obj);
+    } else {
+        peer.encrypt = args[ARG_lmk].u_obj != mp_const_none;
+    }
+    check_esp_err(esp_now_add_peer(&peer));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(espnow_add_peer_obj, 2, espnow_add_peer);
+
+STATIC mp_obj_t espnow_del_peer(mp_obj_t self_in, mp_obj_t mac_in) {
+    espnow_check_active();
+    uint8_t *mac;
+    espnow_get_mac(mac_in, &mac);
+    check_esp_err(esp_now_del_peer(mac));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(espnow_del_peer_obj, espnow_del_peer);
+
+// send(mac, msg, sync=False): mac may be None to send to all peers.
+STATIC mp_obj_t espnow_send(size_t n_args, const mp_obj_t *args) {
+    espnow_check_active();
+    uint8_t *mac = NULL;
+    if (args[1] != mp_const_none) {
+        espnow_get_mac(args[1], &mac);
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
+    bool sync = n_args > 3 && mp_obj_is_true(args[3]);
+
+    uint32_t tx_failures = espnow_state.tx_failures;
+    esp_err_t err;
+    for (;;) {
+        err = esp_now_send(mac, bufinfo.buf, bufinfo.len);
+        if (err != ESP_ERR_ESPNOW_NO_MEM) {
+            break;
+        }
+        // the WiFi transmit queue is full, so wait for a response to free a slot
+        MICROPY_EVENT_POLL_HOOK
+    }
+    check_esp_err(err);
+    espnow_state.tx_pkts++;
+
+    if (!sync) {
+        return mp_const_true;
+    }
+
+    // Wait for the responses to all packets sent so far, including this one.
+    mp_uint_t start = mp_hal_ticks_ms();
+    while (espnow_state.tx_responses != espnow_state.tx_pkts) {
+        if (espnow_state.timeout_ms >= 0 && mp_hal_ticks_ms() - start >= (mp_uint_t)espnow_state.timeout_ms) {
+            mp_raise_OSError(MP_ETIMEDOUT);
+        }
+        mp_handle_pending(true);
+        MP_THREAD_GIL_EXIT();
+        xSemaphoreTake(espnow_state.tx_sem, 1);
+        MP_THREAD_GIL_ENTER();
+    }
+    return mp_obj_new_bool(espnow_state.tx_failures == tx_failures);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espnow_send_obj, 3, 4, espnow_send);
+
+STATIC mp_int_t espnow_get_timeout(size_t n_args, const mp_obj_t *args, size_t timeout_arg) {
+    if (n_args > timeout_arg && args[timeout_arg] != mp_const_none) {
+        return mp_obj_get_int(args[timeout_arg]);
+    }
+    return espnow_state.timeout_ms;
+}
+
+// recvinto(mac, msg, timeout_ms=None): copy the next packet into the given buffers and
+// return its length, or 0 on timeout.  mac may be None; data that doesn't fit in msg is
+// dropped.
+STATIC mp_obj_t espnow_recvinto(size_t n_args, const mp_obj_t *args) {
+    espnow_check_active();
+    mp_buffer_info_t mac_buf = {0};
+    if (args[1] != mp_const_none) {
+        mp_get_buffer_raise(args[1], &mac_buf, MP_BUFFER_WRITE);
+        if (mac_buf.len < ESPNOW_MAC_LEN) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid MAC address"));
+        }
+    }
+    mp_buffer_info_t msg_buf;
+    mp_get_buffer_raise(args[2], &msg_buf, MP_BUFFER_WRITE);
+
+    size_t len;
+    uint8_t *item = espnow_wait_recv(&len, espnow_get_timeout(n_args, args, 3));
+    if (item == NULL) {
+        return MP_OBJ_NEW_SMALL_INT(0);
+    }
+    if (mac_buf.buf != NULL) {
+        memcpy(mac_buf.buf, item, ESPNOW_MAC_LEN);
+    }
+    len = MIN(len - ESPNOW_MAC_LEN, msg_buf.len);
+    memcpy(msg_buf.buf, item + ESPNOW_MAC_LEN, len);
+    vRingbufferReturnItem(espnow_state.ringbuf, item);
+    return MP_OBJ_NEW_SMALL_INT(len);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espnow_recvinto_obj, 3, 4, espnow_recvinto);
+
+// recv(timeout_ms=None): return (mac, msg) for the next packet, or (None, None) on timeout.
+STATIC mp_obj_t espnow_recv(size_t n_args, const mp_obj_t *args) {
+    espnow_check_active();
+    size_t len;
+    uint8_t *item = espnow_wait_recv(&len, espnow_get_timeout(n_args, args, 1));
+    mp_obj_t tuple[2] = { mp_const_none, mp_const_none };
+    if (item != NULL) {
+        tuple[0] = mp_obj_new_bytes(item, ESPNOW_MAC_LEN);
+        tuple[1] = mp_obj_new_bytes(item + ESPNOW_MAC_LEN, len - ESPNOW_MAC_LEN);
+        vRingbufferReturnItem(espnow_state.ringbuf, item);
+    }
+    return mp_obj_new_tuple(2, tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espnow_recv_obj, 1, 2, espnow_recv);
+
+STATIC mp_obj_t espnow_any(mp_obj_t self_in) {
+    espnow_check_active();
+    UBaseType_t waiting;
+    vRingbufferGetInfo(espnow_state.ringbuf, NULL, NULL, NULL, NULL, &waiting);
+    return mp_obj_new_bool(waiting != 0);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(espnow_any_obj, espnow_any);
+
+// stats(): return (tx_pkts, tx_responses, tx_failures, rx_packets, rx_dropped).
+STATIC mp_obj_t espnow_stats(mp_obj_t self_in) {
+    mp_obj_t tuple[5] = {
+        mp_obj_new_int_from_uint(espnow_state.tx_pkts),
+        mp_obj_new_int_from_uint(espnow_state.tx_responses),
+        mp_obj_new_int_from_uint(espnow_state.tx_failures),
+        mp_obj_new_int_from_uint(espnow_state.rx_packets),
+        mp_obj_new_int_from_uint(espnow_state.rx_dropped),
+    };
+    return mp_obj_new_tuple(5, tuple);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(espnow_stats_obj, espnow_stats);
+
+STATIC mp_uint_t espnow_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    if (request == MP_STREAM_POLL) {
+        mp_uint_t ret = 0;
+        if (espnow_state.ringbuf != NULL) {
+            UBaseType_t waiting;
+            vRingbufferGetInfo(espnow_state.ringbuf, NULL, NULL, NULL, NULL, &waiting);
+            if ((arg & MP_STREAM_POLL_RD) && waiting != 0) {
+                ret |= MP_STREAM_POLL_RD;
+            }
+            ret |= arg & MP_STREAM_POLL_WR;
+        }
+        return ret;
+    }
+    *errcode = MP_EINVAL;
+    return MP_STREAM_ERROR;
+}
+
+STATIC const mp_stream_p_t espnow_stream_p = {
+    .ioctl = espnow_ioctl,
+};
+
+STATIC const mp_rom_map_elem_t espnow_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_active), MP_ROM_PTR(&espnow_active_obj) },
+    { MP_ROM_QSTR(MP_QSTR_config), MP_ROM_PTR(&espnow_config_obj) },
+    { MP_ROM_QSTR(MP_QSTR_add_peer), MP_ROM_PTR(&espnow_add_peer_obj) },
+    { MP_ROM_QSTR(MP_QSTR_del_peer), MP_ROM_PTR(&espnow_del_peer_obj) },
+    { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&espnow_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recvinto), MP_ROM_PTR(&espnow_recvinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recv), MP_ROM_PTR(&espnow_recv_obj) },
+    { MP_ROM_QSTR(MP_QSTR_any), MP_ROM_PTR(&espnow_any_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&espnow_stats_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(espnow_locals_dict, espnow_locals_dict_table);
+
+STATIC const mp_obj_type_t espnow_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_ESPNow,
+    .make_new = espnow_make_new,
+    .protocol = &espnow_stream_p,
+    .locals_dict = (mp_obj_dict_t *)&espnow_locals_dict,
+};
+
+STATIC const mp_rom_map_elem_t espnow_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_espnow) },
+    { MP_ROM_QSTR(MP_QSTR_ESPNow), MP_ROM_PTR(&espnow_type) },
+    { MP_ROM_QSTR(MP_QSTR_MAX_DATA_LEN), MP_ROM_INT(ESP_NOW_MAX_DATA_LEN) },
+    { MP_ROM_QSTR(MP_QSTR_KEY_LEN), MP_ROM_INT(ESP_NOW_KEY_LEN) },
+};
+STATIC MP_DEFINE_CONST_DICT(espnow_module_globals, espnow_module_globals_table);
+
+const mp_obj_module_t espnow_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&espnow_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_espnow, espnow_module);
+
+#endif // MICROPY_PY_ESPNOW
@@ -0,0 +1,21 @@
+# uasyncio support for the espnow module on ESP32
+# MIT license; Copyright (c) 2026 agent
+
+from espnow import ESPNow
+from uasyncio import core
+
+
+class AIOESPNow(ESPNow):
+    async def arecvinto(self, mac, msg):
+        yield core._io_queue.queue_read(self)
+        return self.recvinto(mac, msg, 0)
+
+    async def arecv(self):
+        yield core._io_queue.queue_read(self)
+        return self.recv(0)
+
+    def __aiter__(self):
+        return self
+
+    async def __anext__(self):
+        return await self.arecv()
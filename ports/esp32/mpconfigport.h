@@ -43,6 +43,12 @@
 // Python internal features
 #define MICROPY_READER_VFS                  (1)
 #define MICROPY_ENABLE_GC                   (1)
+#if CONFIG_ESP32_SPIRAM_SUPPORT || CONFIG_ESP32S2_SPIRAM_SUPPORT || CONFIG_ESP32S3_SPIRAM_SUPPORT
+// With SPIRAM the heap has an area in internal RAM for small objects, and
+// large buffers go to the SPIRAM area
+#define MICROPY_GC_SPLIT_HEAP               (1)
+#define MICROPY_GC_SPLIT_HEAP_LARGE_ALLOC_BYTES (512)
+#endif
 #define MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF (1)
 #define MICROPY_LONGINT_IMPL                (MICROPY_LONGINT_IMPL_MPZ)
 #define MICROPY_ERROR_REPORTING             (MICROPY_ERROR_REPORTING_NORMAL)
@@ -81,6 +87,7 @@
 #define MICROPY_PY_URANDOM_SEED_INIT_FUNC   (esp_random())
 #define MICROPY_PY_UOS_INCLUDEFILE          "ports/esp32/moduos.c"
 #define MICROPY_PY_OS_DUPTERM               (1)
+#define MICROPY_PY_OS_DUPTERM_TX_BUF_SIZE   (512)
 #define MICROPY_PY_UOS_DUPTERM_NOTIFY       (1)
 #define MICROPY_PY_UOS_UNAME                (1)
 #define MICROPY_PY_UOS_URANDOM              (1)
@@ -109,6 +116,9 @@
 #ifndef MICROPY_PY_NETWORK_WLAN
 #define MICROPY_PY_NETWORK_WLAN             (1)
 #endif
+#ifndef MICROPY_PY_ESPNOW
+#define MICROPY_PY_ESPNOW                   (MICROPY_PY_NETWORK_WLAN)
+#endif
 #ifndef MICROPY_HW_ENABLE_SDCARD
 #define MICROPY_HW_ENABLE_SDCARD            (1)
 #endif
@@ -148,9 +158,11 @@ struct mp_bluetooth_nimble_root_pointers_t;
 #define MICROPY_PORT_ROOT_POINTERS \
     const char *readline_hist[8]; \
     mp_obj_t machine_pin_irq_handler[40]; \
+    mp_obj_t network_wlan_irq_handler; \
     struct _machine_timer_obj_t *machine_timer_obj_head; \
     struct _machine_i2s_obj_t *machine_i2s_obj[I2S_NUM_MAX]; \
     mp_obj_t native_code_pointers; \
+    void *machine_bitstream_buf; \
     MICROPY_PORT_ROOT_POINTER_BLUETOOTH_NIMBLE
 
 // type definitions for the specific machine
@@ -183,6 +195,26 @@ void *esp_native_code_commit(void *, size_t, void *);
         ulTaskNotifyTake(pdFALSE, 1); \
         MP_THREAD_GIL_ENTER(); \
     } while (0);
+
+// The longest that uselect (and so an idle uasyncio loop) blocks the main task
+// before polling its objects again.  Pin and timer IRQs end the wait early, but
+// sockets are only polled, so this bounds their latency.  The default of one
+// tick keeps the previous behaviour; a board that enables automatic light sleep
+// (CONFIG_FREERTOS_USE_TICKLESS_IDLE) can raise it to sleep for longer.
+#ifndef MICROPY_HW_EVENT_POLL_MAX_MS
+#define MICROPY_HW_EVENT_POLL_MAX_MS (portTICK_PERIOD_MS)
+#endif
+
+#define MICROPY_EVENT_POLL_HOOK_TIMEOUT(timeout_ms) \
+    do { \
+        extern void mp_handle_pending(bool); \
+        mp_uint_t wait_ms = MIN((timeout_ms), MICROPY_HW_EVENT_POLL_MAX_MS); \
+        mp_handle_pending(true); \
+        MICROPY_PY_USOCKET_EVENTS_HANDLER \
+        MP_THREAD_GIL_EXIT(); \
+        ulTaskNotifyTake(pdFALSE, MAX(1, wait_ms / portTICK_PERIOD_MS)); \
+        MP_THREAD_GIL_ENTER(); \
+    } while (0);
 #else
 #define MICROPY_EVENT_POLL_HOOK \
     do { \
@@ -48,6 +48,11 @@
 #define MP_TASK_COREID (0)
 #endif
 
+// esp32.thread_config(main_core=...) stores the core for the MicroPython task
+// here, and it's used from the next hard reset.
+#define MP_TASK_NVS_NAMESPACE "micropython"
+#define MP_TASK_NVS_COREID_KEY "mp_task_core"
+
 extern TaskHandle_t mp_main_task_handle;
 
 extern ringbuf_t stdin_ringbuf;
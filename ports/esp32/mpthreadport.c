@@ -56,6 +56,11 @@ STATIC mp_thread_mutex_t thread_mutex;
 STATIC mp_thread_t thread_entry0;
 STATIC mp_thread_t *thread = NULL; // root pointer, handled by mp_thread_gc_others
 
+// core and priority of new threads, set by esp32.thread_config; by default
+// threads run on the same core as the main task
+STATIC BaseType_t thread_core;
+STATIC UBaseType_t thread_priority;
+
 void mp_thread_init(void *stack, uint32_t stack_len) {
     mp_thread_set_state(&mp_state_ctx.thread);
     // create the first entry in the linked list of all threads
@@ -66,6 +71,7 @@ void mp_thread_init(void *stack, uint32_t stack_len) {
     thread_entry0.stack_len = stack_len;
     thread_entry0.next = NULL;
     mp_thread_mutex_init(&thread_mutex);
+    mp_thread_set_config(xPortGetCoreID(), MP_THREAD_PRIORITY);
 
     // memory barrier to ensure above data is committed
     __sync_synchronize();
@@ -136,7 +142,7 @@ void mp_thread_create_ex(void *(*entry)(void *), void *arg, size_t *stack_size,
     mp_thread_mutex_lock(&thread_mutex, 1);
 
     // create thread
-    BaseType_t result = xTaskCreatePinnedToCore(freertos_entry, name, *stack_size / sizeof(StackType_t), arg, priority, &th->id, MP_TASK_COREID);
+    BaseType_t result = xTaskCreatePinnedToCore(freertos_entry, name, *stack_size / sizeof(StackType_t), arg, priority, &th->id, thread_core);
     if (result != pdPASS) {
         mp_thread_mutex_unlock(&thread_mutex);
         mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("can't create thread"));
@@ -157,7 +163,17 @@ void mp_thread_create_ex(void *(*entry)(void *), void *arg, size_t *stack_size,
 }
 
 void mp_thread_create(void *(*entry)(void *), void *arg, size_t *stack_size) {
-    mp_thread_create_ex(entry, arg, stack_size, MP_THREAD_PRIORITY, "mp_thread");
+    mp_thread_create_ex(entry, arg, stack_size, thread_priority, "mp_thread");
+}
+
+void mp_thread_get_config(BaseType_t *core, UBaseType_t *priority) {
+    *core = thread_core;
+    *priority = thread_priority;
+}
+
+void mp_thread_set_config(BaseType_t core, UBaseType_t priority) {
+    thread_core = core;
+    thread_priority = priority;
 }
 
 void mp_thread_finish(void) {
@@ -233,6 +249,9 @@ void mp_thread_deinit(void) {
             vTaskDelete(id);
         }
     }
+
+    // new threads go back to the default core and priority
+    mp_thread_set_config(xPortGetCoreID(), MP_THREAD_PRIORITY);
 }
 
 #else
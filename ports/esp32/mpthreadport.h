@@ -41,5 +41,7 @@ typedef struct _mp_thread_mutex_t {
 void mp_thread_init(void *stack, uint32_t stack_len);
 void mp_thread_gc_others(void);
 void mp_thread_deinit(void);
+void mp_thread_get_config(BaseType_t *core, UBaseType_t *priority);
+void mp_thread_set_config(BaseType_t core, UBaseType_t priority);
 
 #endif // MICROPY_INCLUDED_ESP32_MPTHREADPORT_H
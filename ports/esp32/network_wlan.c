@@ -35,6 +35,8 @@
 
 #include "py/objlist.h"
 #include "py/runtime.h"
+#include "py/mperrno.h"
+#include "py/mphal.h"
 #include "modnetwork.h"
 
 #include "esp_wifi.h"
@@ -72,6 +74,18 @@ static bool mdns_initialised = false;
 static uint8_t conf_wifi_sta_reconnects = 0;
 static uint8_t wifi_sta_reconnects;
 
+// Events for the handler given to WLAN.irq()
+#define WLAN_IRQ_SCAN_DONE (0x0001)
+#define WLAN_IRQ_STATUS (0x0002)
+
+// Events that call the handler given to WLAN.irq()
+static uint16_t wifi_irq_trigger = 0;
+
+// Set to "true" while a scan started by scan_async() is running.
+static bool wifi_scan_async = false;
+
+STATIC void network_wlan_irq_schedule(uint16_t event);
+
 // This function is called by the system-event task and so runs in a different
 // thread to the main MicroPython task.  It must not raise any Python exceptions.
 void network_wlan_event_handler(system_event_t *event) {
@@ -82,6 +96,7 @@ void network_wlan_event_handler(system_event_t *event) {
             break;
         case SYSTEM_EVENT_STA_CONNECTED:
             ESP_LOGI("network", "CONNECTED");
+            network_wlan_irq_schedule(WLAN_IRQ_STATUS);
             break;
         case SYSTEM_EVENT_STA_GOT_IP:
             ESP_LOGI("network", "GOT_IP");
@@ -101,6 +116,7 @@ void network_wlan_event_handler(system_event_t *event) {
                 mdns_initialised = true;
             }
             #endif
+            network_wlan_irq_schedule(WLAN_IRQ_STATUS);
             break;
         case SYSTEM_EVENT_STA_DISCONNECTED: {
             // This is a workaround as ESP32 WiFi libs don't currently
@@ -128,6 +144,7 @@ void network_wlan_event_handler(system_event_t *event) {
             ESP_LOGI("wifi", "STA_DISCONNECTED, reason:%d%s", disconn->reason, message);
 
             wifi_sta_connected = false;
+            network_wlan_irq_schedule(WLAN_IRQ_STATUS);
             if (wifi_sta_connect_requested) {
                 wifi_mode_t mode;
                 if (esp_wifi_get_mode(&mode) != ESP_OK) {
@@ -150,6 +167,12 @@ void network_wlan_event_handler(system_event_t *event) {
             }
             break;
         }
+        case SYSTEM_EVENT_SCAN_DONE:
+            if (wifi_scan_async) {
+                wifi_scan_async = false;
+                network_wlan_irq_schedule(WLAN_IRQ_SCAN_DONE);
+            }
+            break;
         default:
             break;
     }
@@ -328,43 +351,123 @@ STATIC mp_obj_t network_wlan_status(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(network_wlan_status_obj, 1, 2, network_wlan_status);
 
-STATIC mp_obj_t network_wlan_scan(mp_obj_t self_in) {
+// Get the results of the last scan, which frees them in the WiFi driver.
+STATIC mp_obj_t network_wlan_scan_results(void) {
+    mp_obj_t list = mp_obj_new_list(0, NULL);
+    uint16_t count = 0;
+    esp_exceptions(esp_wifi_scan_get_ap_num(&count));
+    wifi_ap_record_t *wifi_ap_records = calloc(count, sizeof(wifi_ap_record_t));
+    esp_exceptions(esp_wifi_scan_get_ap_records(&count, wifi_ap_records));
+    for (uint16_t i = 0; i < count; i++) {
+        mp_obj_tuple_t *t = mp_obj_new_tuple(6, NULL);
+        uint8_t *x = memchr(wifi_ap_records[i].ssid, 0, sizeof(wifi_ap_records[i].ssid));
+        int ssid_len = x ? x - wifi_ap_records[i].ssid : sizeof(wifi_ap_records[i].ssid);
+        t->items[0] = mp_obj_new_bytes(wifi_ap_records[i].ssid, ssid_len);
+        t->items[1] = mp_obj_new_bytes(wifi_ap_records[i].bssid, sizeof(wifi_ap_records[i].bssid));
+        t->items[2] = MP_OBJ_NEW_SMALL_INT(wifi_ap_records[i].primary);
+        t->items[3] = MP_OBJ_NEW_SMALL_INT(wifi_ap_records[i].rssi);
+        t->items[4] = MP_OBJ_NEW_SMALL_INT(wifi_ap_records[i].authmode);
+        // a hidden network is found by a scan with show_hidden and has no SSID
+        t->items[5] = mp_obj_new_bool(ssid_len == 0);
+        mp_obj_list_append(list, MP_OBJ_FROM_PTR(t));
+    }
+    free(wifi_ap_records);
+    return list;
+}
+
+STATIC esp_err_t network_wlan_scan_start(bool block) {
     // check that STA mode is active
     wifi_mode_t mode;
     esp_exceptions(esp_wifi_get_mode(&mode));
     if ((mode & WIFI_MODE_STA) == 0) {
         mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("STA must be active"));
     }
+    if (wifi_scan_async) {
+        mp_raise_OSError(MP_EBUSY);
+    }
 
-    mp_obj_t list = mp_obj_new_list(0, NULL);
     wifi_scan_config_t config = { 0 };
     config.show_hidden = true;
+    wifi_scan_async = !block;
     MP_THREAD_GIL_EXIT();
-    esp_err_t status = esp_wifi_scan_start(&config, 1);
+    esp_err_t status = esp_wifi_scan_start(&config, block);
     MP_THREAD_GIL_ENTER();
-    if (status == 0) {
-        uint16_t count = 0;
-        esp_exceptions(esp_wifi_scan_get_ap_num(&count));
-        wifi_ap_record_t *wifi_ap_records = calloc(count, sizeof(wifi_ap_record_t));
-        esp_exceptions(esp_wifi_scan_get_ap_records(&count, wifi_ap_records));
-        for (uint16_t i = 0; i < count; i++) {
-            mp_obj_tuple_t *t = mp_obj_new_tuple(6, NULL);
-            uint8_t *x = memchr(wifi_ap_records[i].ssid, 0, sizeof(wifi_ap_records[i].ssid));
-            int ssid_len = x ? x - wifi_ap_records[i].ssid : sizeof(wifi_ap_records[i].ssid);
-            t->items[0] = mp_obj_new_bytes(wifi_ap_records[i].ssid, ssid_len);
-            t->items[1] = mp_obj_new_bytes(wifi_ap_records[i].bssid, sizeof(wifi_ap_records[i].bssid));
-            t->items[2] = MP_OBJ_NEW_SMALL_INT(wifi_ap_records[i].primary);
-            t->items[3] = MP_OBJ_NEW_SMALL_INT(wifi_ap_records[i].rssi);
-            t->items[4] = MP_OBJ_NEW_SMALL_INT(wifi_ap_records[i].authmode);
-            t->items[5] = mp_const_false; // XXX hidden?
-            mp_obj_list_append(list, MP_OBJ_FROM_PTR(t));
-        }
-        free(wifi_ap_records);
+    if (status != ESP_OK) {
+        wifi_scan_async = false;
     }
-    return list;
+    return status;
+}
+
+STATIC mp_obj_t network_wlan_scan(mp_obj_t self_in) {
+    if (network_wlan_scan_start(true) != ESP_OK) {
+        return mp_obj_new_list(0, NULL);
+    }
+    return network_wlan_scan_results();
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(network_wlan_scan_obj, network_wlan_scan);
 
+STATIC mp_obj_t network_wlan_scan_async(mp_obj_t self_in) {
+    esp_exceptions(network_wlan_scan_start(false));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(network_wlan_scan_async_obj, network_wlan_scan_async);
+
+// Runs from the scheduler to call the handler given to WLAN.irq().
+STATIC mp_obj_t network_wlan_irq_dispatch(mp_obj_t event_in) {
+    uint16_t event = MP_OBJ_SMALL_INT_VALUE(event_in);
+    mp_obj_t data;
+    if (event == WLAN_IRQ_SCAN_DONE) {
+        // Always fetch the results, to free them in the WiFi driver
+        data = network_wlan_scan_results();
+    } else {
+        mp_obj_t sta = MP_OBJ_FROM_PTR(&wlan_sta_obj);
+        data = network_wlan_status(1, &sta);
+    }
+    mp_obj_t handler = MP_STATE_PORT(network_wlan_irq_handler);
+    if (handler != MP_OBJ_NULL && (wifi_irq_trigger & event)) {
+        mp_call_function_2(handler, event_in, data);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(network_wlan_irq_dispatch_obj, network_wlan_irq_dispatch);
+
+// Called by the system-event task.
+STATIC void network_wlan_irq_schedule(uint16_t event) {
+    if (event != WLAN_IRQ_SCAN_DONE && !(wifi_irq_trigger & event)) {
+        return;
+    }
+    if (mp_sched_schedule_ex(MP_OBJ_FROM_PTR(&network_wlan_irq_dispatch_obj), MP_OBJ_NEW_SMALL_INT(event), MP_SCHED_COALESCE)) {
+        xTaskNotifyGive(mp_main_task_handle);
+    }
+}
+
+STATIC mp_obj_t network_wlan_irq(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_handler, ARG_trigger };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_handler, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_trigger, MP_ARG_INT, {.u_int = WLAN_IRQ_SCAN_DONE | WLAN_IRQ_STATUS} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    require_if(pos_args[0], WIFI_IF_STA);
+    if (args[ARG_handler].u_obj == mp_const_none) {
+        wifi_irq_trigger = 0;
+        MP_STATE_PORT(network_wlan_irq_handler) = MP_OBJ_NULL;
+    } else {
+        MP_STATE_PORT(network_wlan_irq_handler) = args[ARG_handler].u_obj;
+        wifi_irq_trigger = args[ARG_trigger].u_int;
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(network_wlan_irq_obj, 1, network_wlan_irq);
+
+void network_wlan_deinit(void) {
+    // The handler is on the heap, which doesn't survive a soft reset
+    wifi_irq_trigger = 0;
+    MP_STATE_PORT(network_wlan_irq_handler) = MP_OBJ_NULL;
+}
+
 STATIC mp_obj_t network_wlan_isconnected(mp_obj_t self_in) {
     wlan_if_obj_t *self = MP_OBJ_TO_PTR(self_in);
     if (self->if_id == WIFI_IF_STA) {
@@ -570,9 +673,14 @@ STATIC const mp_rom_map_elem_t wlan_if_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_disconnect), MP_ROM_PTR(&network_wlan_disconnect_obj) },
     { MP_ROM_QSTR(MP_QSTR_status), MP_ROM_PTR(&network_wlan_status_obj) },
     { MP_ROM_QSTR(MP_QSTR_scan), MP_ROM_PTR(&network_wlan_scan_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scan_async), MP_ROM_PTR(&network_wlan_scan_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_irq), MP_ROM_PTR(&network_wlan_irq_obj) },
     { MP_ROM_QSTR(MP_QSTR_isconnected), MP_ROM_PTR(&network_wlan_isconnected_obj) },
     { MP_ROM_QSTR(MP_QSTR_config), MP_ROM_PTR(&network_wlan_config_obj) },
     { MP_ROM_QSTR(MP_QSTR_ifconfig), MP_ROM_PTR(&esp_ifconfig_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_IRQ_SCAN_DONE), MP_ROM_INT(WLAN_IRQ_SCAN_DONE) },
+    { MP_ROM_QSTR(MP_QSTR_IRQ_STATUS), MP_ROM_INT(WLAN_IRQ_STATUS) },
 };
 STATIC MP_DEFINE_CONST_DICT(wlan_if_locals_dict, wlan_if_locals_dict_table);
 
@@ -83,6 +83,7 @@
 #define MICROPY_PY_UOS              (1)
 #define MICROPY_PY_UOS_INCLUDEFILE  "ports/esp8266/moduos.c"
 #define MICROPY_PY_OS_DUPTERM       (2)
+#define MICROPY_PY_OS_DUPTERM_TX_BUF_SIZE (256)
 #define MICROPY_PY_UOS_DUPTERM_NOTIFY (1)
 #define MICROPY_PY_UOS_DUPTERM_STREAM_DETACHED_ATTACHED (1)
 #define MICROPY_PY_UOS_UNAME        (1)
@@ -29,3 +29,7 @@
 extern void mp_js_write(const char *str, mp_uint_t len);
 extern int mp_js_ticks_ms(void);
 extern void mp_js_hook(void);
+
+void mp_js_vm_hook(void);
+void mp_js_event_poll_hook(void);
+bool mp_js_can_yield(void);
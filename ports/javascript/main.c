@@ -24,6 +24,7 @@
  * THE SOFTWARE.
  */
 
+#include <math.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -35,6 +36,7 @@
 #include "py/repl.h"
 #include "py/gc.h"
 #include "py/mperrno.h"
+#include "py/mphal.h"
 #include "shared/runtime/pyexec.h"
 
 #include "emscripten.h"
@@ -80,6 +82,132 @@ int mp_js_process_char(int c) {
     return pyexec_event_repl_process_char(c);
 }
 
+// Code run via mp_js_do_str_async may yield to the JS event loop (this relies
+// on ASYNCIFY).  Synchronous callers can't be suspended, so yielding is only
+// done while this count is non-zero.
+STATIC int js_async_depth;
+STATIC mp_uint_t js_last_yield_ms;
+
+void mp_js_set_async(int enable) {
+    js_async_depth += enable ? 1 : -1;
+    js_last_yield_ms = mp_hal_ticks_ms();
+}
+
+bool mp_js_can_yield(void) {
+    return js_async_depth > 0;
+}
+
+// Called from the VM hook: give the browser a chance to run every
+// MICROPY_JS_YIELD_PERIOD_MS of continuous Python execution.
+void mp_js_vm_hook(void) {
+    mp_js_hook();
+    if (js_async_depth > 0 && mp_hal_ticks_ms() - js_last_yield_ms >= MICROPY_JS_YIELD_PERIOD_MS) {
+        emscripten_sleep(0);
+        js_last_yield_ms = mp_hal_ticks_ms();
+    }
+}
+
+// Called while waiting for an event, eg in uselect.poll.
+void mp_js_event_poll_hook(void) {
+    if (js_async_depth > 0) {
+        emscripten_sleep(1);
+        js_last_yield_ms = mp_hal_ticks_ms();
+    }
+}
+
+// Handles let JS keep references to Python objects, so functions can be
+// called repeatedly without compiling any source.  A handle is an index into
+// a list held in a root pointer; freed slots hold None and are reused.
+
+STATIC int js_handle_new(mp_obj_t obj) {
+    mp_obj_list_t *handles = MP_OBJ_TO_PTR(MP_STATE_PORT(js_handles));
+    for (size_t i = 0; i < handles->len; ++i) {
+        if (handles->items[i] == mp_const_none) {
+            handles->items[i] = obj;
+            return i;
+        }
+    }
+    mp_obj_list_append(MP_STATE_PORT(js_handles), obj);
+    return handles->len - 1;
+}
+
+STATIC mp_obj_t js_handle_get(int handle) {
+    mp_obj_list_t *handles = MP_OBJ_TO_PTR(MP_STATE_PORT(js_handles));
+    if (handle < 0 || (size_t)handle >= handles->len || handles->items[handle] == mp_const_none) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid handle"));
+    }
+    return handles->items[handle];
+}
+
+// Return a handle to the global variable name of __main__, or -1 on error.
+int mp_js_get_handle(const char *name) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t obj = mp_load_name(qstr_from_str(name));
+        int handle = js_handle_new(obj);
+        nlr_pop();
+        return handle;
+    } else {
+        mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+        return -1;
+    }
+}
+
+void mp_js_free_handle(int handle) {
+    mp_obj_list_t *handles = MP_OBJ_TO_PTR(MP_STATE_PORT(js_handles));
+    if (handle >= 0 && (size_t)handle < handles->len) {
+        handles->items[handle] = mp_const_none;
+    }
+}
+
+// Call the object of handle with n_args numbers, storing a numeric return
+// value in *result (NaN if it isn't a number).  Returns 0 on success, or 1
+// if an exception was raised, which is printed.
+int mp_js_call(int handle, int n_args, const double *args, double *result) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t fun = js_handle_get(handle);
+        mp_obj_t *call_args = mp_local_alloc(n_args * sizeof(mp_obj_t));
+        for (int i = 0; i < n_args; ++i) {
+            double a = args[i];
+            if (a >= -0x40000000 && a < 0x40000000 && a == (double)(mp_int_t)a) {
+                call_args[i] = MP_OBJ_NEW_SMALL_INT((mp_int_t)a);
+            } else {
+                call_args[i] = mp_obj_new_float(a);
+            }
+        }
+        mp_obj_t ret = mp_call_function_n_kw(fun, n_args, 0, call_args);
+        mp_local_free(call_args);
+        if (!mp_obj_get_float_maybe(ret, result)) {
+            *result = NAN;
+        }
+        nlr_pop();
+        return 0;
+    } else {
+        mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+        return 1;
+    }
+}
+
+// Return the address of the data of a buffer object (eg bytearray or array),
+// so JS can make a typed array view over it without copying, or NULL if the
+// handle is invalid.  The view is valid while the handle is held and the
+// object isn't resized.
+void *mp_js_buffer_ptr(int handle, size_t *len) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(js_handle_get(handle), &bufinfo, MP_BUFFER_RW);
+        *len = bufinfo.len;
+        nlr_pop();
+        return bufinfo.buf;
+    } else {
+        mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+        *len = 0;
+        return NULL;
+    }
+}
+
 void mp_js_init(int heap_size) {
     #if MICROPY_ENABLE_GC
     char *heap = (char *)malloc(heap_size * sizeof(char));
@@ -92,6 +220,8 @@ void mp_js_init(int heap_size) {
     #endif
 
     mp_init();
+
+    MP_STATE_PORT(js_handles) = mp_obj_new_list(0, NULL);
 }
 
 void mp_js_init_repl() {
@@ -145,7 +145,9 @@
 #define MICROPY_EVENT_POLL_HOOK \
     do { \
         extern void mp_handle_pending(bool); \
+        extern void mp_js_event_poll_hook(void); \
         mp_handle_pending(true); \
+        mp_js_event_poll_hook(); \
     } while (0);
 
 #define MICROPY_THREAD_YIELD()
@@ -155,9 +157,14 @@
 #define MICROPY_VM_HOOK_INIT static uint vm_hook_divisor = MICROPY_VM_HOOK_COUNT;
 #define MICROPY_VM_HOOK_POLL if (--vm_hook_divisor == 0) { \
         vm_hook_divisor = MICROPY_VM_HOOK_COUNT; \
-        extern void mp_js_hook(void); \
-        mp_js_hook(); \
+        extern void mp_js_vm_hook(void); \
+        mp_js_vm_hook(); \
 }
+
+// How long code run by mp_js_do_str_async runs before yielding to the browser
+#ifndef MICROPY_JS_YIELD_PERIOD_MS
+#define MICROPY_JS_YIELD_PERIOD_MS (16)
+#endif
 #define MICROPY_VM_HOOK_LOOP MICROPY_VM_HOOK_POLL
 #define MICROPY_VM_HOOK_RETURN MICROPY_VM_HOOK_POLL
 
@@ -184,4 +191,5 @@ typedef long mp_off_t;
 #define MP_STATE_PORT MP_STATE_VM
 
 #define MICROPY_PORT_ROOT_POINTERS \
-    const char *readline_hist[8];
+    const char *readline_hist[8]; \
+    mp_obj_t js_handles;
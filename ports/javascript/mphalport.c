@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include "emscripten.h"
+
 #include "library.h"
 #include "mphalport.h"
 
@@ -32,6 +34,11 @@ void mp_hal_stdout_tx_strn(const char *str, size_t len) {
 }
 
 void mp_hal_delay_ms(mp_uint_t ms) {
+    if (mp_js_can_yield()) {
+        // let the browser run while sleeping
+        emscripten_sleep(ms);
+        return;
+    }
     uint32_t start = mp_hal_ticks_ms();
     while (mp_hal_ticks_ms() - start < ms) {
     }
@@ -32,6 +32,54 @@ var mainProgram = function()
   mp_js_do_str = Module.cwrap('mp_js_do_str', 'number', ['string']);
   mp_js_init_repl = Module.cwrap('mp_js_init_repl', 'null', ['null']);
   mp_js_process_char = Module.cwrap('mp_js_process_char', 'number', ['number']);
+  mp_js_get_handle = Module.cwrap('mp_js_get_handle', 'number', ['string']);
+  mp_js_free_handle = Module.cwrap('mp_js_free_handle', 'null', ['number']);
+
+  var mp_js_set_async = Module.cwrap('mp_js_set_async', 'null', ['number']);
+  var do_str_async = Module.cwrap('mp_js_do_str', 'number', ['string'], {async: true});
+  var call = Module.cwrap('mp_js_call', 'number', ['number', 'number', 'number', 'number']);
+  var buffer_ptr = Module.cwrap('mp_js_buffer_ptr', 'number', ['number', 'number']);
+
+  // Scratch space in the heap for arguments and results, grown as needed
+  var scratch = 0;
+  var scratch_len = 0;
+  var get_scratch = function(len) {
+      if (len > scratch_len) {
+          Module._free(scratch);
+          scratch_len = Math.max(len, 64);
+          scratch = Module._malloc(scratch_len);
+      }
+      return scratch;
+  };
+
+  mp_js_do_str_async = function(code) {
+      mp_js_set_async(1);
+      return do_str_async(code).finally(function() {
+          mp_js_set_async(0);
+      });
+  };
+
+  mp_js_call = function(handle, args) {
+      args = args || [];
+      var n = args.length;
+      var buf = get_scratch(8 * (n + 1));
+      for (var i = 0; i < n; i++) {
+          HEAPF64[(buf >> 3) + i] = args[i];
+      }
+      if (call(handle, n, buf, buf + 8 * n) !== 0) {
+          throw new Error('MicroPython exception');
+      }
+      return HEAPF64[(buf >> 3) + n];
+  };
+
+  mp_js_buffer = function(handle) {
+      var len_ptr = get_scratch(4);
+      var ptr = buffer_ptr(handle, len_ptr);
+      if (ptr === 0) {
+          return null;
+      }
+      return new Uint8Array(HEAPU8.buffer, ptr, HEAPU32[len_ptr >> 2]);
+  };
 
   MP_JS_EPOCH = (new Date()).getTime();
 
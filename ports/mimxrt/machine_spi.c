@@ -30,6 +30,7 @@
 #include "py/mperrno.h"
 #include "extmod/machine_spi.h"
 #include "modmachine.h"
+#include "dma_manager.h"
 #include CLOCK_CONFIG_H
 
 #include "fsl_cache.h"
@@ -45,6 +46,9 @@
 #define DEFAULT_SPI_FIRSTBIT    (kLPSPI_MsbFirst)
 #define DEFAULT_SPI_DRIVE       (6)
 
+// Transfers shorter than the FIFO are done by polling, longer ones by DMA.
+#define SPI_DMA_MIN_SIZE        (16)
+
 #define MICROPY_HW_SPI_NUM MP_ARRAY_SIZE(spi_index_table)
 
 #define SCK (iomux_table[index])
@@ -77,6 +81,19 @@ static const iomux_table_t iomux_table[] = {
     IOMUX_TABLE_SPI
 };
 
+STATIC const dma_request_source_t spi_dma_req_src_rx[] = {
+    0, kDmaRequestMuxLPSPI1Rx, kDmaRequestMuxLPSPI2Rx,
+    #if defined(LPSPI3)
+    kDmaRequestMuxLPSPI3Rx, kDmaRequestMuxLPSPI4Rx,
+    #endif
+};
+STATIC const dma_request_source_t spi_dma_req_src_tx[] = {
+    0, kDmaRequestMuxLPSPI1Tx, kDmaRequestMuxLPSPI2Tx,
+    #if defined(LPSPI3)
+    kDmaRequestMuxLPSPI3Tx, kDmaRequestMuxLPSPI4Tx,
+    #endif
+};
+
 bool lpspi_set_iomux(int8_t spi, uint8_t drive, uint8_t cs) {
     int index = (spi - 1) * 5;
 
@@ -226,6 +243,21 @@ STATIC void machine_spi_init(mp_obj_base_t *self_in, size_t n_args, const mp_obj
     LPSPI_MasterInit(self->spi_inst, self->master_config, BOARD_BOOTCLOCKRUN_LPSPI_CLK_ROOT);
 }
 
+STATIC void machine_spi_edma_callback(LPSPI_Type *base, lpspi_master_edma_handle_t *handle, status_t status, void *self_in) {
+    machine_spi_obj_t *self = self_in;
+    self->transfer_busy = false;
+}
+
+// Set the TCR back to the configured format, because an EDMA transfer leaves
+// it with the RX/TX masks and byte swap of that transfer.
+STATIC void machine_spi_reset_tcr(machine_spi_obj_t *self) {
+    LPSPI_Enable(self->spi_inst, false);
+    self->spi_inst->TCR = LPSPI_TCR_CPOL(self->master_config->cpol) | LPSPI_TCR_CPHA(self->master_config->cpha)
+        | LPSPI_TCR_LSBF(self->master_config->direction) | LPSPI_TCR_FRAMESZ(self->master_config->bitsPerFrame - 1)
+        | (self->spi_inst->TCR & LPSPI_TCR_PRESCALE_MASK) | LPSPI_TCR_PCS(self->master_config->whichPcs);
+    LPSPI_Enable(self->spi_inst, true);
+}
+
 STATIC void machine_spi_transfer(mp_obj_base_t *self_in, size_t len, const uint8_t *src, uint8_t *dest) {
     machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
 
@@ -238,7 +270,63 @@ STATIC void machine_spi_transfer(mp_obj_base_t *self_in, size_t len, const uint8
     masterXfer.dataSize = len;
     masterXfer.configFlags = (self->master_config->whichPcs << LPSPI_MASTER_PCS_SHIFT) | kLPSPI_MasterPcsContinuous | kLPSPI_MasterByteSwap;
 
-    if (LPSPI_MasterTransferBlocking(self->spi_inst, &masterXfer) != kStatus_Success) {
+    // Use DMA for longer transfers, with a channel for each FIFO, if channels are free.
+    int chan_rx = -1;
+    int chan_tx = -1;
+    if (len >= SPI_DMA_MIN_SIZE) {
+        chan_rx = allocate_dma_channel();
+        chan_tx = allocate_dma_channel();
+    }
+
+    status_t status;
+    if (chan_rx >= 0 && chan_tx >= 0) {
+        DMAMUX_Init(DMAMUX);
+        DMAMUX_SetSource(DMAMUX, chan_rx, spi_dma_req_src_rx[self->spi_hw_id]);
+        DMAMUX_EnableChannel(DMAMUX, chan_rx);
+        DMAMUX_SetSource(DMAMUX, chan_tx, spi_dma_req_src_tx[self->spi_hw_id]);
+        DMAMUX_EnableChannel(DMAMUX, chan_tx);
+        dma_init();
+
+        edma_handle_t edma_rx_handle;
+        edma_handle_t edma_tx_handle;
+        lpspi_master_edma_handle_t master_edma_handle;
+        EDMA_CreateHandle(&edma_rx_handle, DMA0, chan_rx);
+        EDMA_CreateHandle(&edma_tx_handle, DMA0, chan_tx);
+        LPSPI_MasterTransferCreateHandleEDMA(self->spi_inst, &master_edma_handle, machine_spi_edma_callback, self,
+            &edma_rx_handle, &edma_tx_handle);
+
+        // The DMA works on memory, not on the cache.
+        if (src != NULL) {
+            MP_HAL_CLEAN_DCACHE(src, len);
+        }
+        if (dest != NULL) {
+            MP_HAL_CLEANINVALIDATE_DCACHE(dest, len);
+        }
+
+        machine_spi_reset_tcr(self);
+        self->transfer_busy = true;
+        status = LPSPI_MasterTransferEDMA(self->spi_inst, &master_edma_handle, &masterXfer);
+        if (status == kStatus_Success) {
+            // Sleep until the completion IRQ, instead of polling the FIFOs.
+            while (self->transfer_busy) {
+                __WFI();
+            }
+        }
+        self->transfer_busy = false;
+        machine_spi_reset_tcr(self);
+    } else {
+        status = LPSPI_MasterTransferBlocking(self->spi_inst, &masterXfer);
+    }
+
+    // Release the DMA channels, even if only one was allocated.
+    if (chan_rx >= 0) {
+        free_dma_channel(chan_rx);
+    }
+    if (chan_tx >= 0) {
+        free_dma_channel(chan_tx);
+    }
+
+    if (status != kStatus_Success) {
         mp_raise_OSError(EIO);
     }
 }
@@ -25,10 +25,13 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "py/compile.h"
 #include "py/runtime.h"
 #include "py/gc.h"
 #include "py/mperrno.h"
+#include "py/persistentcode.h"
 #include "py/stackctrl.h"
 #include "shared/readline/readline.h"
 #include "shared/runtime/gchelper.h"
@@ -47,9 +50,35 @@
 #include "extmod/modnetwork.h"
 
 extern uint8_t _sstack, _estack, _gc_heap_start, _gc_heap_end;
+extern uint8_t _dtcm_free_start, _dtcm_free_end, _itcm_free_start, _itcm_free_end;
+extern uint8_t _ocrm_start, _ocrm_end;
+
+// Free DTCM smaller than this is not worth a separate heap area.
+#ifndef MICROPY_HW_GC_DTCM_MIN_SIZE
+#define MICROPY_HW_GC_DTCM_MIN_SIZE (8 * 1024)
+#endif
+
+// Next free address in ITCM for native code, which is reset on soft reset.
+STATIC uint8_t *itcm_next;
 
 void board_init(void);
 
+// The first area of the heap is the free DTCM, which has no wait states, and it
+// holds small objects.  Larger ones go in OCRAM and then SDRAM, if available.
+STATIC void gc_heap_init(void) {
+    void (*add)(void *, void *) = gc_init;
+    if (&_dtcm_free_end - &_dtcm_free_start >= MICROPY_HW_GC_DTCM_MIN_SIZE) {
+        add(&_dtcm_free_start, &_dtcm_free_end);
+        add = gc_add;
+    }
+    #ifdef MICROPY_HW_SDRAM_AVAIL
+    // The main heap is in SDRAM, which is slower than the OCRAM.
+    add(&_ocrm_start, &_ocrm_end);
+    add = gc_add;
+    #endif
+    add(&_gc_heap_start, &_gc_heap_end);
+}
+
 int main(void) {
     board_init();
     ticks_init();
@@ -72,7 +101,7 @@ int main(void) {
     #endif
 
     for (;;) {
-        gc_init(&_gc_heap_start, &_gc_heap_end);
+        gc_heap_init();
         mp_init();
 
         #if MICROPY_PY_NETWORK
@@ -120,6 +149,7 @@ int main(void) {
         mod_network_deinit();
         #endif
         machine_pwm_deinit_all();
+        itcm_next = NULL;
         gc_sweep_all();
         mp_deinit();
     }
@@ -133,6 +163,38 @@ void gc_collect(void) {
     gc_collect_end();
 }
 
+// Native code is copied from the heap to ITCM, which is not cached, so it runs
+// without wait states.  Code that doesn't fit stays in the heap.
+void *mimxrt_native_code_commit(void *buf, size_t len, void *reloc) {
+    if (itcm_next == NULL) {
+        itcm_next = &_itcm_free_start;
+    }
+    size_t alloc_len = (len + 7) & ~7;
+    uint8_t *p;
+    if (alloc_len <= (size_t)(&_itcm_free_end - itcm_next)) {
+        p = itcm_next;
+        itcm_next += alloc_len;
+    } else {
+        // Relocated code may only be referenced from within itself, so keep it reachable.
+        p = buf;
+        if (reloc) {
+            if (MP_STATE_PORT(track_reloc_code_list) == MP_OBJ_NULL) {
+                MP_STATE_PORT(track_reloc_code_list) = mp_obj_new_list(0, NULL);
+            }
+            mp_obj_list_append(MP_STATE_PORT(track_reloc_code_list), MP_OBJ_FROM_PTR(buf));
+        }
+    }
+    if (reloc) {
+        mp_native_relocate(reloc, buf, (uintptr_t)p);
+    }
+    if (p != buf) {
+        memcpy(p, buf, len);
+        __DSB();
+        __ISB();
+    }
+    return p;
+}
+
 void nlr_jump_fail(void *val) {
     for (;;) {
     }
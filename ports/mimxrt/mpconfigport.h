@@ -35,6 +35,8 @@ uint32_t trng_random_u32(void);
 // Memory allocation policies
 #define MICROPY_GC_STACK_ENTRY_TYPE         uint16_t
 #define MICROPY_GC_ALLOC_THRESHOLD          (0)
+#define MICROPY_GC_SPLIT_HEAP               (1)
+#define MICROPY_GC_SPLIT_HEAP_LARGE_ALLOC_BYTES (512)
 #define MICROPY_ALLOC_PARSE_CHUNK_INIT      (32)
 #define MICROPY_ALLOC_PATH_MAX              (256)
 
@@ -262,6 +264,11 @@ extern const struct _mp_obj_type_t network_lan_type;
 
 #define MICROPY_MAKE_POINTER_CALLABLE(p) ((void *)((mp_uint_t)(p) | 1))
 
+// Native code is copied to the free ITCM while there is room, see main.c.
+void *mimxrt_native_code_commit(void *buf, size_t len, void *reloc);
+#define MP_PLAT_COMMIT_EXEC(buf, len, reloc) mimxrt_native_code_commit(buf, len, reloc)
+#define MICROPY_PERSISTENT_CODE_TRACK_RELOC_CODE (1)
+
 #define MP_HAL_CLEANINVALIDATE_DCACHE(addr, size) \
     (SCB_CleanInvalidateDCache_by_Addr((uint32_t *)((uint32_t)addr & ~0x1f), \
     ((uint32_t)((uint8_t *)addr + size + 0x1f) & ~0x1f) - ((uint32_t)addr & ~0x1f)))
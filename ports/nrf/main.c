@@ -76,6 +76,10 @@
 #include "usb_cdc.h"
 #endif
 
+#if MICROPY_PY_NRF_PPI
+#include "ppi.h"
+#endif
+
 #if MICROPY_HW_ENABLE_INTERNAL_FLASH_STORAGE
 #include "extmod/vfs_fat.h"
 #include "lib/oofatfs/ff.h"
@@ -171,6 +175,10 @@ soft_reset:
 
     pin_init0();
 
+    #if MICROPY_PY_NRF_PPI
+    ppi_init0();
+    #endif
+
     #if MICROPY_HW_ENABLE_INTERNAL_FLASH_STORAGE
     flashbdev_init();
 
@@ -30,6 +30,7 @@
 #include "py/nlr.h"
 #include "py/runtime.h"
 #include "py/mphal.h"
+#include "py/mperrno.h"
 
 #if MICROPY_PY_MACHINE_ADC
 
@@ -41,6 +42,29 @@
     #include "nrfx_saadc.h"
 #endif
 
+#if MICROPY_PY_MACHINE_ADC_READ_TIMED && defined(NRF52_SERIES)
+#define ADC_READ_TIMED (1)
+#else
+#define ADC_READ_TIMED (0)
+#endif
+
+#if ADC_READ_TIMED
+#if BLUETOOTH_SD
+#include "ble_drv.h"
+#include "nrf_soc.h"
+#define BLUETOOTH_STACK_ENABLED() (ble_drv_stack_enabled())
+#endif // BLUETOOTH_SD
+
+// ADC.read_timed paces the SAADC with TIMER4, whose COMPARE0 event starts each
+// sample through a PPI channel, and the SAADC writes the samples to the buffer
+// with EasyDMA, so the CPU is only woken when the buffer is full.
+#define ADC_TIMED_TIMER        NRF_TIMER4
+#define ADC_TIMED_TIMER_FREQ   (1000000) // 16MHz / 2^4
+#define ADC_TIMED_PPI_CHANNEL  (0)
+
+STATIC volatile bool adc_timed_busy;
+#endif
+
 typedef struct _machine_adc_obj_t {
     mp_obj_base_t base;
     uint8_t       id;
@@ -71,7 +95,64 @@ STATIC const machine_adc_obj_t machine_adc_obj[] = {
 #endif
 };
 
+#if ADC_READ_TIMED
+STATIC void adc_timed_ppi_set(bool enable) {
+    uint32_t eep = (uint32_t)&ADC_TIMED_TIMER->EVENTS_COMPARE[0];
+    uint32_t tep = (uint32_t)&NRF_SAADC->TASKS_SAMPLE;
+#if BLUETOOTH_SD
+    // The SoftDevice owns the PPI while it is enabled.
+    if (BLUETOOTH_STACK_ENABLED() == 1) {
+        if (enable) {
+            sd_ppi_channel_assign(ADC_TIMED_PPI_CHANNEL, (const volatile void *)eep, (const volatile void *)tep);
+            sd_ppi_channel_enable_set(1 << ADC_TIMED_PPI_CHANNEL);
+        } else {
+            sd_ppi_channel_enable_clr(1 << ADC_TIMED_PPI_CHANNEL);
+        }
+        return;
+    }
+#endif // BLUETOOTH_SD
+    if (enable) {
+        NRF_PPI->CH[ADC_TIMED_PPI_CHANNEL].EEP = eep;
+        NRF_PPI->CH[ADC_TIMED_PPI_CHANNEL].TEP = tep;
+        NRF_PPI->CHENSET = 1 << ADC_TIMED_PPI_CHANNEL;
+    } else {
+        NRF_PPI->CHENCLR = 1 << ADC_TIMED_PPI_CHANNEL;
+    }
+}
+
+STATIC void adc_timed_stop(void) {
+    ADC_TIMED_TIMER->TASKS_STOP = 1;
+    adc_timed_ppi_set(false);
+    adc_timed_busy = false;
+}
+
+STATIC void adc_timed_event_handler(nrfx_saadc_evt_t const *p_event) {
+    if (p_event->type == NRFX_SAADC_EVT_READY) {
+        // The SAADC is started, so start pacing the samples.
+        ADC_TIMED_TIMER->TASKS_START = 1;
+    } else if (p_event->type == NRFX_SAADC_EVT_DONE) {
+        adc_timed_stop();
+        mp_obj_t callback = MP_STATE_PORT(adc_timed_callback);
+        if (callback != mp_const_none) {
+            #if MICROPY_ENABLE_SCHEDULER
+            mp_sched_schedule(callback, MP_STATE_PORT(adc_timed_buf));
+            #else
+            mp_call_function_1(callback, MP_STATE_PORT(adc_timed_buf));
+            #endif
+        }
+    }
+}
+#endif
+
 void adc_init0(void) {
+#if ADC_READ_TIMED
+    if (adc_timed_busy) {
+        adc_timed_stop();
+        nrfx_saadc_abort();
+    }
+    MP_STATE_PORT(adc_timed_buf) = mp_const_none;
+    MP_STATE_PORT(adc_timed_callback) = mp_const_none;
+#endif
 #if defined(NRF52_SERIES)
     const uint8_t interrupt_priority = 6;
     nrfx_saadc_init(interrupt_priority);
@@ -197,6 +278,82 @@ mp_obj_t machine_adc_value(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mp_machine_adc_value_obj, machine_adc_value);
 
+#if ADC_READ_TIMED
+/// \method read_timed(buf, freq, *, callback=None)
+/// Fill the array buf, of typecode 'h', with 12-bit samples taken at freq Hz.
+/// Without a callback this waits until buf is full; otherwise it returns at
+/// once and callback(buf) is called when buf is full.
+STATIC mp_obj_t machine_adc_read_timed(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buf, ARG_freq, ARG_callback };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buf,      MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_freq,     MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_callback, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+
+    machine_adc_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buf].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.typecode != 'h' || bufinfo.len == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buf must be a non-empty array of type 'h'"));
+    }
+    size_t n = bufinfo.len / sizeof(nrf_saadc_value_t);
+    mp_int_t freq = args[ARG_freq].u_int;
+    if (freq <= 0 || freq > ADC_TIMED_TIMER_FREQ / 8) {
+        mp_raise_ValueError(MP_ERROR_TEXT("freq out of range"));
+    }
+    if (adc_timed_busy) {
+        mp_raise_OSError(MP_EBUSY);
+    }
+
+    // Pace the samples with the timer, clearing it on each compare.
+    ADC_TIMED_TIMER->TASKS_STOP = 1;
+    ADC_TIMED_TIMER->TASKS_CLEAR = 1;
+    ADC_TIMED_TIMER->MODE = TIMER_MODE_MODE_Timer;
+    ADC_TIMED_TIMER->BITMODE = TIMER_BITMODE_BITMODE_32Bit << TIMER_BITMODE_BITMODE_Pos;
+    ADC_TIMED_TIMER->PRESCALER = 4;
+    ADC_TIMED_TIMER->CC[0] = ADC_TIMED_TIMER_FREQ / freq;
+    ADC_TIMED_TIMER->SHORTS = TIMER_SHORTS_COMPARE0_CLEAR_Msk;
+    ADC_TIMED_TIMER->INTENCLR = 0xffffffff;
+    adc_timed_ppi_set(true);
+
+    // Keep the buffer reachable while the SAADC writes to it.
+    MP_STATE_PORT(adc_timed_buf) = args[ARG_buf].u_obj;
+    MP_STATE_PORT(adc_timed_callback) = args[ARG_callback].u_obj;
+    adc_timed_busy = true;
+
+    nrfx_saadc_adv_config_t adv_config = {
+        .oversampling      = NRF_SAADC_OVERSAMPLE_DISABLED,
+        .burst             = NRF_SAADC_BURST_DISABLED,
+        .internal_timer_cc = 0,
+        .start_on_end      = false,
+    };
+    nrfx_err_t err = nrfx_saadc_advanced_mode_set((1 << self->id), NRF_SAADC_RESOLUTION_12BIT, &adv_config, adc_timed_event_handler);
+    if (err == NRFX_SUCCESS) {
+        err = nrfx_saadc_buffer_set(bufinfo.buf, n);
+    }
+    if (err == NRFX_SUCCESS) {
+        err = nrfx_saadc_mode_trigger();
+    }
+    if (err != NRFX_SUCCESS) {
+        adc_timed_stop();
+        mp_raise_OSError(MP_EIO);
+    }
+
+    if (args[ARG_callback].u_obj == mp_const_none) {
+        while (adc_timed_busy) {
+            MICROPY_EVENT_POLL_HOOK
+        }
+    }
+
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(mp_machine_adc_read_timed_obj, 3, machine_adc_read_timed);
+#endif
+
 #if NRF51
 
 #define ADC_REF_VOLTAGE_IN_MILLIVOLT (1200) // Reference voltage in mV (1.2V).
@@ -287,6 +444,9 @@ STATIC const mp_rom_map_elem_t machine_adc_locals_dict_table[] = {
     // instance methods
     { MP_ROM_QSTR(MP_QSTR_read_u16), MP_ROM_PTR(&mp_machine_adc_read_u16_obj) },
     { MP_ROM_QSTR(MP_QSTR_value), MP_ROM_PTR(&mp_machine_adc_value_obj) },
+#if ADC_READ_TIMED
+    { MP_ROM_QSTR(MP_QSTR_read_timed), MP_ROM_PTR(&mp_machine_adc_read_timed_obj) },
+#endif
 
     // class methods
     { MP_ROM_QSTR(MP_QSTR_battery_level), MP_ROM_PTR(&mp_machine_adc_battery_level_obj) },
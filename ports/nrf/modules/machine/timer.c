@@ -124,6 +124,12 @@ STATIC mp_obj_t machine_timer_make_new(const mp_obj_type_t *type, size_t n_args,
     }
 #endif
 
+#if MICROPY_PY_MACHINE_ADC && MICROPY_PY_MACHINE_ADC_READ_TIMED && defined(NRF52_SERIES)
+    if (timer_id == 4) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Timer reserved by ADC.read_timed"));
+    }
+#endif
+
     machine_timer_obj_t *self = (machine_timer_obj_t*)&machine_timer_obj[timer_id];
 
     if (mp_obj_is_fun(args[ARG_callback].u_obj)) {
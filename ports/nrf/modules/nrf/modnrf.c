@@ -32,6 +32,7 @@
 #include "flashbdev.h"
 #include "flash.h"
 #include "nrf_power.h"
+#include "ppi.h"
 
 #if BLUETOOTH_SD
 #include "nrf_soc.h"
@@ -82,6 +83,10 @@ STATIC const mp_rom_map_elem_t nrf_module_globals_table[] = {
     #if NRF_POWER_HAS_DCDCEN
     { MP_ROM_QSTR(MP_QSTR_dcdc), MP_ROM_PTR(&dcdc_obj) },
     #endif
+    #if MICROPY_PY_NRF_PPI
+    { MP_ROM_QSTR(MP_QSTR_PPI), MP_ROM_PTR(&nrf_ppi_type) },
+    { MP_ROM_QSTR(MP_QSTR_GPIOTE), MP_ROM_PTR(&nrf_gpiote_type) },
+    #endif
     #if MICROPY_HW_ENABLE_INTERNAL_FLASH_STORAGE
     { MP_ROM_QSTR(MP_QSTR_Flash), MP_ROM_PTR(&nrf_flashbdev_type) },
     { MP_ROM_QSTR(MP_QSTR_unused_flash_start), MP_ROM_PTR(&nrf_modnrf_freeflash_start_aligned_obj) },
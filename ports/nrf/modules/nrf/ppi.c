@@ -0,0 +1,320 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "py/mperrno.h"
+#include "py/mphal.h"
+
+#if MICROPY_PY_NRF_PPI
+
+#include "ppi.h"
+
+#if BLUETOOTH_SD
+#include "nrf_soc.h"
+#include "ble_drv.h"
+#define BLUETOOTH_STACK_ENABLED() (ble_drv_stack_enabled())
+#endif
+
+// nrf.PPI connects the event register of one peripheral to the task register of
+// another, and nrf.GPIOTE gives a pin an event or a task, so that the hardware
+// runs a task on an event without the CPU.  Events and tasks are given as the
+// addresses of their registers, from the product specification.  Pin IRQs
+// take GPIOTE channels from 0 upwards, so nrf.GPIOTE should use the high ones.
+
+#define PPI_NUM_CHANNELS MP_ARRAY_SIZE(NRF_PPI->CH)
+#define GPIOTE_NUM_CHANNELS MP_ARRAY_SIZE(NRF_GPIOTE->CONFIG)
+
+// Channels that were set up from Python, to reset on soft reset.
+STATIC uint32_t ppi_channels_used;
+STATIC uint32_t gpiote_channels_used;
+
+typedef struct _nrf_ppi_obj_t {
+    mp_obj_base_t base;
+    uint8_t channel;
+} nrf_ppi_obj_t;
+
+typedef struct _nrf_gpiote_obj_t {
+    mp_obj_base_t base;
+    uint8_t channel;
+} nrf_gpiote_obj_t;
+
+enum {
+    GPIOTE_MODE_EVENT = GPIOTE_CONFIG_MODE_Event,
+    GPIOTE_MODE_TASK = GPIOTE_CONFIG_MODE_Task,
+};
+
+STATIC void ppi_channel_disable(uint8_t channel) {
+    #if BLUETOOTH_SD
+    if (BLUETOOTH_STACK_ENABLED() == 1) {
+        sd_ppi_channel_enable_clr(1 << channel);
+        return;
+    }
+    #endif
+    NRF_PPI->CHENCLR = 1 << channel;
+}
+
+void ppi_init0(void) {
+    for (uint8_t i = 0; i < PPI_NUM_CHANNELS; ++i) {
+        if (ppi_channels_used & (1 << i)) {
+            ppi_channel_disable(i);
+        }
+    }
+    ppi_channels_used = 0;
+    for (uint8_t i = 0; i < GPIOTE_NUM_CHANNELS; ++i) {
+        if (gpiote_channels_used & (1 << i)) {
+            NRF_GPIOTE->CONFIG[i] = 0;
+        }
+    }
+    gpiote_channels_used = 0;
+}
+
+/******************************************************************************/
+// nrf.PPI
+
+STATIC void nrf_ppi_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    nrf_ppi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "PPI(%u)", self->channel);
+}
+
+/// \method init(event, task, *, fork=None)
+/// Connect the event register to the task register (and the fork task
+/// register, if given) and enable the channel.
+STATIC mp_obj_t nrf_ppi_init_helper(nrf_ppi_obj_t *self, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_event, ARG_task, ARG_fork };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_event, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_task,  MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_fork,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint32_t eep = mp_obj_get_int_truncated(args[ARG_event].u_obj);
+    uint32_t tep = mp_obj_get_int_truncated(args[ARG_task].u_obj);
+    uint32_t fork = 0;
+    if (args[ARG_fork].u_obj != mp_const_none) {
+        fork = mp_obj_get_int_truncated(args[ARG_fork].u_obj);
+    }
+
+    #if BLUETOOTH_SD
+    if (BLUETOOTH_STACK_ENABLED() == 1) {
+        // The SoftDevice owns the PPI while it is enabled, and has no API for forks.
+        if (fork != 0) {
+            mp_raise_ValueError(MP_ERROR_TEXT("fork not supported with Bluetooth LE stack"));
+        }
+        if (sd_ppi_channel_assign(self->channel, (const volatile void *)eep, (const volatile void *)tep) != NRF_SUCCESS
+            || sd_ppi_channel_enable_set(1 << self->channel) != NRF_SUCCESS) {
+            mp_raise_ValueError(MP_ERROR_TEXT("PPI channel reserved by Bluetooth LE stack"));
+        }
+        ppi_channels_used |= 1 << self->channel;
+        return mp_const_none;
+    }
+    #endif
+
+    NRF_PPI->CH[self->channel].EEP = eep;
+    NRF_PPI->CH[self->channel].TEP = tep;
+    #if defined(PPI_FORK_TEP_TEP_Msk)
+    NRF_PPI->FORK[self->channel].TEP = fork;
+    #else
+    if (fork != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("fork not supported"));
+    }
+    #endif
+    NRF_PPI->CHENSET = 1 << self->channel;
+    ppi_channels_used |= 1 << self->channel;
+
+    return mp_const_none;
+}
+
+STATIC mp_obj_t nrf_ppi_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    mp_arg_check_num(n_args, n_kw, 1, MP_OBJ_FUN_ARGS_MAX, true);
+
+    mp_int_t channel = mp_obj_get_int(all_args[0]);
+    if (channel < 0 || channel >= PPI_NUM_CHANNELS) {
+        mp_raise_ValueError(MP_ERROR_TEXT("PPI channel doesn't exist"));
+    }
+    #if MICROPY_PY_MACHINE_ADC && MICROPY_PY_MACHINE_ADC_READ_TIMED && defined(NRF52_SERIES)
+    if (channel == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("PPI channel reserved by ADC.read_timed"));
+    }
+    #endif
+
+    nrf_ppi_obj_t *self = mp_obj_malloc(nrf_ppi_obj_t, type);
+    self->channel = channel;
+
+    if (n_args > 1 || n_kw > 0) {
+        mp_map_t kw_args;
+        mp_map_init_fixed_table(&kw_args, n_kw, all_args + n_args);
+        nrf_ppi_init_helper(self, n_args - 1, all_args + 1, &kw_args);
+    }
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t nrf_ppi_init(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return nrf_ppi_init_helper(MP_OBJ_TO_PTR(pos_args[0]), n_args - 1, pos_args + 1, kw_args);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(nrf_ppi_init_obj, 1, nrf_ppi_init);
+
+/// \method deinit()
+/// Disable the channel.
+STATIC mp_obj_t nrf_ppi_deinit(mp_obj_t self_in) {
+    nrf_ppi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    ppi_channel_disable(self->channel);
+    ppi_channels_used &= ~(1 << self->channel);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nrf_ppi_deinit_obj, nrf_ppi_deinit);
+
+STATIC const mp_rom_map_elem_t nrf_ppi_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_init), MP_ROM_PTR(&nrf_ppi_init_obj) },
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&nrf_ppi_deinit_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(nrf_ppi_locals_dict, nrf_ppi_locals_dict_table);
+
+const mp_obj_type_t nrf_ppi_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_PPI,
+    .print = nrf_ppi_print,
+    .make_new = nrf_ppi_make_new,
+    .locals_dict = (mp_obj_dict_t *)&nrf_ppi_locals_dict,
+};
+
+/******************************************************************************/
+// nrf.GPIOTE
+
+STATIC void nrf_gpiote_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    nrf_gpiote_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "GPIOTE(%u)", self->channel);
+}
+
+/// \method init(pin, *, mode=GPIOTE.EVENT, polarity=GPIOTE.TOGGLE, value=0)
+/// Give the pin an event (mode=EVENT) or a task (mode=TASK) on this channel.
+STATIC mp_obj_t nrf_gpiote_init_helper(nrf_gpiote_obj_t *self, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_pin, ARG_mode, ARG_polarity, ARG_value };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_pin,      MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_mode,     MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = GPIOTE_MODE_EVENT} },
+        { MP_QSTR_polarity, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = GPIOTE_CONFIG_POLARITY_Toggle} },
+        { MP_QSTR_value,    MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const pin_obj_t *pin = mp_hal_get_pin_obj(args[ARG_pin].u_obj);
+    mp_int_t mode = args[ARG_mode].u_int;
+    if (mode != GPIOTE_MODE_EVENT && mode != GPIOTE_MODE_TASK) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid mode"));
+    }
+
+    uint32_t config = (mode << GPIOTE_CONFIG_MODE_Pos)
+        | ((pin->pin & 31) << GPIOTE_CONFIG_PSEL_Pos)
+        | ((args[ARG_polarity].u_int & 3) << GPIOTE_CONFIG_POLARITY_Pos)
+        | ((args[ARG_value].u_int ? 1 : 0) << GPIOTE_CONFIG_OUTINIT_Pos);
+    #if defined(GPIOTE_CONFIG_PORT_Pos)
+    config |= (pin->pin >> 5) << GPIOTE_CONFIG_PORT_Pos;
+    #endif
+    NRF_GPIOTE->CONFIG[self->channel] = config;
+    NRF_GPIOTE->EVENTS_IN[self->channel] = 0;
+    gpiote_channels_used |= 1 << self->channel;
+
+    return mp_const_none;
+}
+
+STATIC mp_obj_t nrf_gpiote_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    mp_arg_check_num(n_args, n_kw, 1, MP_OBJ_FUN_ARGS_MAX, true);
+
+    mp_int_t channel = mp_obj_get_int(all_args[0]);
+    if (channel < 0 || channel >= GPIOTE_NUM_CHANNELS) {
+        mp_raise_ValueError(MP_ERROR_TEXT("GPIOTE channel doesn't exist"));
+    }
+
+    nrf_gpiote_obj_t *self = mp_obj_malloc(nrf_gpiote_obj_t, type);
+    self->channel = channel;
+
+    if (n_args > 1 || n_kw > 0) {
+        mp_map_t kw_args;
+        mp_map_init_fixed_table(&kw_args, n_kw, all_args + n_args);
+        nrf_gpiote_init_helper(self, n_args - 1, all_args + 1, &kw_args);
+    }
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t nrf_gpiote_init(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return nrf_gpiote_init_helper(MP_OBJ_TO_PTR(pos_args[0]), n_args - 1, pos_args + 1, kw_args);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(nrf_gpiote_init_obj, 1, nrf_gpiote_init);
+
+/// \method deinit()
+/// Release the pin from the channel.
+STATIC mp_obj_t nrf_gpiote_deinit(mp_obj_t self_in) {
+    nrf_gpiote_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    NRF_GPIOTE->CONFIG[self->channel] = 0;
+    gpiote_channels_used &= ~(1 << self->channel);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nrf_gpiote_deinit_obj, nrf_gpiote_deinit);
+
+/// \method event()
+/// Return the address of the IN event register of the channel.
+STATIC mp_obj_t nrf_gpiote_event(mp_obj_t self_in) {
+    nrf_gpiote_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint((uint32_t)&NRF_GPIOTE->EVENTS_IN[self->channel]);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nrf_gpiote_event_obj, nrf_gpiote_event);
+
+/// \method task()
+/// Return the address of the OUT task register of the channel.
+STATIC mp_obj_t nrf_gpiote_task(mp_obj_t self_in) {
+    nrf_gpiote_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint((uint32_t)&NRF_GPIOTE->TASKS_OUT[self->channel]);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(nrf_gpiote_task_obj, nrf_gpiote_task);
+
+STATIC const mp_rom_map_elem_t nrf_gpiote_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_init), MP_ROM_PTR(&nrf_gpiote_init_obj) },
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&nrf_gpiote_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_event), MP_ROM_PTR(&nrf_gpiote_event_obj) },
+    { MP_ROM_QSTR(MP_QSTR_task), MP_ROM_PTR(&nrf_gpiote_task_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_EVENT), MP_ROM_INT(GPIOTE_MODE_EVENT) },
+    { MP_ROM_QSTR(MP_QSTR_TASK), MP_ROM_INT(GPIOTE_MODE_TASK) },
+    { MP_ROM_QSTR(MP_QSTR_LOTOHI), MP_ROM_INT(GPIOTE_CONFIG_POLARITY_LoToHi) },
+    { MP_ROM_QSTR(MP_QSTR_HITOLO), MP_ROM_INT(GPIOTE_CONFIG_POLARITY_HiToLo) },
+    { MP_ROM_QSTR(MP_QSTR_TOGGLE), MP_ROM_INT(GPIOTE_CONFIG_POLARITY_Toggle) },
+};
+STATIC MP_DEFINE_CONST_DICT(nrf_gpiote_locals_dict, nrf_gpiote_locals_dict_table);
+
+const mp_obj_type_t nrf_gpiote_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_GPIOTE,
+    .print = nrf_gpiote_print,
+    .make_new = nrf_gpiote_make_new,
+    .locals_dict = (mp_obj_dict_t *)&nrf_gpiote_locals_dict,
+};
+
+#endif // MICROPY_PY_NRF_PPI
@@ -521,6 +521,10 @@ mp_lexer_t *uos_mbfs_new_reader(const char *filename) {
     mp_reader_t reader;
     reader.data = fd;
     reader.readbyte = (mp_uint_t(*)(void*))file_read_byte;
+    #if MICROPY_READER_BULK
+    reader.read = NULL;
+    reader.readchunk = NULL;
+    #endif
     reader.close = (void(*)(void*))microbit_file_close; // no-op
     return mp_lexer_new(qstr_from_str(filename), reader);
 }
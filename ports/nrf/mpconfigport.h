@@ -88,6 +88,15 @@
 #define MICROPY_PY_NRF                     (CORE_FEAT)
 #endif
 
+// nrf.PPI and nrf.GPIOTE; DPPI (nRF91) is not supported
+#ifndef MICROPY_PY_NRF_PPI
+#if defined(NRF51) || defined(NRF52_SERIES)
+#define MICROPY_PY_NRF_PPI                 (MICROPY_PY_NRF)
+#else
+#define MICROPY_PY_NRF_PPI                 (0)
+#endif
+#endif
+
 #ifndef MICROPY_HW_ENABLE_INTERNAL_FLASH_STORAGE
 #define MICROPY_HW_ENABLE_INTERNAL_FLASH_STORAGE (CORE_FEAT)
 #endif
@@ -194,6 +203,11 @@
 #define MICROPY_PY_MACHINE_ADC      (0)
 #endif
 
+// ADC.read_timed, which uses TIMER4 and PPI on nRF52
+#ifndef MICROPY_PY_MACHINE_ADC_READ_TIMED
+#define MICROPY_PY_MACHINE_ADC_READ_TIMED (MICROPY_PY_MACHINE_ADC)
+#endif
+
 #ifndef MICROPY_PY_MACHINE_I2C
 #define MICROPY_PY_MACHINE_I2C      (0)
 #endif
@@ -330,6 +344,14 @@ extern const struct _mp_obj_module_t music_module;
 #define ROOT_POINTERS_SOFTPWM
 #endif
 
+#if MICROPY_PY_MACHINE_ADC_READ_TIMED
+#define ROOT_POINTERS_ADC \
+    mp_obj_t adc_timed_buf; \
+    mp_obj_t adc_timed_callback;
+#else
+#define ROOT_POINTERS_ADC
+#endif
+
 #if defined(NRF52840_XXAA)
 #define NUM_OF_PINS 48
 #else
@@ -347,6 +369,7 @@ extern const struct _mp_obj_module_t music_module;
     \
     ROOT_POINTERS_MUSIC \
     ROOT_POINTERS_SOFTPWM \
+    ROOT_POINTERS_ADC \
     \
     /* micro:bit root pointers */ \
     void *async_data[2]; \
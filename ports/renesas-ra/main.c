@@ -52,7 +52,7 @@
 #include "gccollect.h"
 #include "factoryreset.h"
 #include "modmachine.h"
-#include "softtimer.h"
+#include "shared/runtime/softtimer.h"
 #include "spi.h"
 #include "uart.h"
 #include "timer.h"
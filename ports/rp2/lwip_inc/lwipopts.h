@@ -2,6 +2,7 @@
 #define MICROPY_INCLUDED_RP2_LWIP_LWIPOPTS_H
 
 #include <stdint.h>
+#include "py/mpconfig.h"
 
 // This protection is not needed, instead protect lwIP code with flags
 #define SYS_ARCH_DECL_PROTECT(lev) do { } while (0)
@@ -44,12 +45,27 @@
 extern uint32_t rosc_random_u32(void);
 #define LWIP_RAND() rosc_random_u32()
 
-// lwip takes 26700 bytes
-#define MEM_SIZE (8000)
-#define TCP_MSS (800)
-#define TCP_WND (8 * TCP_MSS)
-#define TCP_SND_BUF (8 * TCP_MSS)
-#define MEMP_NUM_TCP_SEG (32)
+// lwIP heap and TCP buffer sizes; a board can override them to trade RAM for throughput.
+#ifndef MICROPY_HW_LWIP_MEM_SIZE
+#define MICROPY_HW_LWIP_MEM_SIZE (8000)
+#endif
+#ifndef MICROPY_HW_LWIP_TCP_MSS
+#define MICROPY_HW_LWIP_TCP_MSS (800)
+#endif
+#ifndef MICROPY_HW_LWIP_TCP_WND
+#define MICROPY_HW_LWIP_TCP_WND (8 * MICROPY_HW_LWIP_TCP_MSS)
+#endif
+#ifndef MICROPY_HW_LWIP_TCP_SND_BUF
+#define MICROPY_HW_LWIP_TCP_SND_BUF (8 * MICROPY_HW_LWIP_TCP_MSS)
+#endif
+
+#define MEM_SIZE (MICROPY_HW_LWIP_MEM_SIZE)
+#define TCP_MSS (MICROPY_HW_LWIP_TCP_MSS)
+#define TCP_WND (MICROPY_HW_LWIP_TCP_WND)
+#define TCP_SND_BUF (MICROPY_HW_LWIP_TCP_SND_BUF)
+// Enough segments for a full send queue, which lwIP checks at compile time
+#define MEMP_NUM_TCP_SEG ((4 * TCP_SND_BUF + TCP_MSS - 1) / TCP_MSS)
+
 
 typedef uint32_t sys_prot_t;
 
@@ -24,17 +24,27 @@
  * THE SOFTWARE.
  */
 
-// This is a translation of the cycle counter implementation in ports/stm32/machine_bitstream.c.
+#include <string.h>
 
-#include "py/mpconfig.h"
+#include "py/runtime.h"
 #include "py/mphal.h"
+#include "extmod/machine_bitstream.h"
+#include "modrp2.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
 #include "hardware/structs/systick.h"
 
 #if MICROPY_PY_MACHINE_BITSTREAM
 
+/******************************************************************************/
+// Bit-bang implementation
+
+// This is a translation of the cycle counter implementation in ports/stm32/machine_bitstream.c.
+
 #define MP_HAL_BITSTREAM_NS_OVERHEAD  (9)
 
-void __time_critical_func(machine_bitstream_high_low)(mp_hal_pin_obj_t pin, uint32_t *timing_ns, const uint8_t *buf, size_t len) {
+STATIC void __time_critical_func(machine_bitstream_high_low_bitbang)(mp_hal_pin_obj_t pin, uint32_t *timing_ns, const uint8_t *buf, size_t len) {
     uint32_t fcpu_mhz = mp_hal_get_cpu_freq() / 1000000;
     // Convert ns to clock ticks [high_time_0, period_0, high_time_1, period_1].
     for (size_t i = 0; i < 4; ++i) {
@@ -71,4 +81,171 @@ void __time_critical_func(machine_bitstream_high_low)(mp_hal_pin_obj_t pin, uint
     mp_hal_quiet_timing_exit(irq_state);
 }
 
+/******************************************************************************/
+// PIO and DMA implementation
+
+// The program is the usual WS2812 one, where each bit starts with t1 cycles
+// high, then has t2 cycles high for a 1 or low for a 0, then t3 cycles low:
+//
+//  0: out x, 1     side 0 [t3 - 1]
+//  1: jmp !x, 3    side 1 [t1 - 1]
+//  2: jmp 0        side 1 [t2 - 1]
+//  3: nop          side 0 [t2 - 1]
+//
+// With one side-set bit the delays can be up to 16 cycles, so the state
+// machine is clocked at 1/16th of the longest of t1, t2 and t3.
+#define BITSTREAM_PIO_MAX_CYCLES (16)
+
+// The data is copied to machine_bitstream_buf (a root pointer) so the caller
+// can change its buffer while the output runs in the background.
+typedef struct _bitstream_pio_t {
+    PIO pio;
+    int sm;
+    int dma;
+    uint offset;
+    mp_hal_pin_obj_t pin;
+    size_t buf_alloc;
+} bitstream_pio_t;
+
+STATIC bitstream_pio_t bitstream_pio = { .sm = -1, .dma = -1 };
+STATIC uint16_t bitstream_pio_instructions[4];
+STATIC const struct pio_program bitstream_pio_program = {
+    .instructions = bitstream_pio_instructions,
+    .length = 4,
+    .origin = -1,
+};
+
+STATIC bool bitstream_pio_busy(void) {
+    if (dma_channel_is_busy(bitstream_pio.dma) || !pio_sm_is_tx_fifo_empty(bitstream_pio.pio, bitstream_pio.sm)) {
+        return true;
+    }
+    // The last byte has been pulled, wait for it to be shifted out.
+    uint32_t stall = 1u << (PIO_FDEBUG_TXSTALL_LSB + bitstream_pio.sm);
+    bitstream_pio.pio->fdebug = stall;
+    return !(bitstream_pio.pio->fdebug & stall);
+}
+
+// Wait for any output in progress to finish, then release the state machine,
+// DMA channel and program memory so they're free for other uses.
+STATIC void bitstream_pio_finish(void) {
+    if (bitstream_pio.sm < 0) {
+        return;
+    }
+    while (bitstream_pio_busy()) {
+        tight_loop_contents();
+    }
+    pio_sm_set_enabled(bitstream_pio.pio, bitstream_pio.sm, false);
+    pio_remove_program(bitstream_pio.pio, &bitstream_pio_program, bitstream_pio.offset);
+    pio_sm_unclaim(bitstream_pio.pio, bitstream_pio.sm);
+    dma_channel_unclaim(bitstream_pio.dma);
+    mp_hal_pin_low(bitstream_pio.pin);
+    mp_hal_pin_output(bitstream_pio.pin);
+    bitstream_pio.sm = -1;
+    bitstream_pio.dma = -1;
+}
+
+// Start the output in the background, returning false if the timing doesn't
+// suit the program or no PIO resources are free.
+STATIC bool machine_bitstream_high_low_pio(mp_hal_pin_obj_t pin, uint32_t *timing_ns, const uint8_t *buf, size_t len) {
+    // The timing must be a 0 and a 1 of the same period, with the 1 high for longer.
+    if (timing_ns[2] <= timing_ns[0] || timing_ns[0] == 0 || timing_ns[3] == 0
+        || timing_ns[0] + timing_ns[1] != timing_ns[2] + timing_ns[3]) {
+        return false;
+    }
+    uint32_t t_ns[3] = { timing_ns[0], timing_ns[2] - timing_ns[0], timing_ns[3] };
+    uint32_t t_max = MAX(t_ns[0], MAX(t_ns[1], t_ns[2]));
+    uint32_t t[3];
+    for (size_t i = 0; i < 3; ++i) {
+        t[i] = MAX(1, (BITSTREAM_PIO_MAX_CYCLES * t_ns[i] + t_max / 2) / t_max);
+    }
+    uint64_t div = (uint64_t)clock_get_hz(clk_sys) * t_max * 256 / (BITSTREAM_PIO_MAX_CYCLES * 1000000000ULL);
+    if (div < 256 || div >= 65536 * 256) {
+        return false;
+    }
+
+    bitstream_pio_instructions[0] = pio_encode_out(pio_x, 1) | pio_encode_sideset(1, 0) | pio_encode_delay(t[2] - 1);
+    bitstream_pio_instructions[1] = pio_encode_jmp_not_x(3) | pio_encode_sideset(1, 1) | pio_encode_delay(t[0] - 1);
+    bitstream_pio_instructions[2] = pio_encode_jmp(0) | pio_encode_sideset(1, 1) | pio_encode_delay(t[1] - 1);
+    bitstream_pio_instructions[3] = pio_encode_nop() | pio_encode_sideset(1, 0) | pio_encode_delay(t[1] - 1);
+
+    PIO pio = pio1;
+    if (!pio_can_add_program(pio, &bitstream_pio_program)) {
+        return false;
+    }
+    int sm = rp2_pio_claim_unused_sm(pio);
+    if (sm < 0) {
+        return false;
+    }
+    int dma = dma_claim_unused_channel(false);
+    if (dma < 0) {
+        pio_sm_unclaim(pio, sm);
+        return false;
+    }
+
+    // Take a copy of the data, reusing the last buffer if it's big enough.
+    uint8_t *data = MP_STATE_PORT(machine_bitstream_buf);
+    if (data == NULL || bitstream_pio.buf_alloc < len) {
+        data = m_renew_maybe(uint8_t, data, bitstream_pio.buf_alloc, len, false);
+        if (data == NULL) {
+            pio_sm_unclaim(pio, sm);
+            dma_channel_unclaim(dma);
+            return false;
+        }
+        MP_STATE_PORT(machine_bitstream_buf) = data;
+        bitstream_pio.buf_alloc = len;
+    }
+    memcpy(data, buf, len);
+
+    bitstream_pio.pio = pio;
+    bitstream_pio.sm = sm;
+    bitstream_pio.dma = dma;
+    bitstream_pio.pin = pin;
+    bitstream_pio.offset = pio_add_program(pio, &bitstream_pio_program);
+
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, bitstream_pio.offset, bitstream_pio.offset + 3);
+    sm_config_set_sideset(&c, 1, false, false);
+    sm_config_set_sideset_pins(&c, pin);
+    // MSB first, pulling a byte at a time (8-bit DMA writes fill the whole FIFO
+    // word with copies of the byte, and the first 8 bits are shifted out).
+    sm_config_set_out_shift(&c, false, true, 8);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    sm_config_set_clkdiv_int_frac(&c, div / 256, div & 0xff);
+    pio_gpio_init(pio, pin);
+    pio_sm_set_consecutive_pindirs(pio, sm, pin, 1, true);
+    pio_sm_init(pio, sm, bitstream_pio.offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+
+    dma_channel_config dc = dma_channel_get_default_config(dma);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_8);
+    channel_config_set_read_increment(&dc, true);
+    channel_config_set_write_increment(&dc, false);
+    channel_config_set_dreq(&dc, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(dma, &dc, &pio->txf[sm], data, len, true);
+
+    return true;
+}
+
+/******************************************************************************/
+// Interface to machine.bitstream
+
+void machine_bitstream_high_low(mp_hal_pin_obj_t pin, uint32_t *timing_ns, const uint8_t *buf, size_t len) {
+    // Only one output runs at a time.
+    if (bitstream_pio.sm >= 0) {
+        while (bitstream_pio_busy()) {
+            MICROPY_EVENT_POLL_HOOK
+        }
+        bitstream_pio_finish();
+    }
+    if (len == 0 || !machine_bitstream_high_low_pio(pin, timing_ns, buf, len)) {
+        machine_bitstream_high_low_bitbang(pin, timing_ns, buf, len);
+    }
+}
+
+void machine_bitstream_deinit(void) {
+    bitstream_pio_finish();
+    MP_STATE_PORT(machine_bitstream_buf) = NULL;
+    bitstream_pio.buf_alloc = 0;
+}
+
 #endif // MICROPY_PY_MACHINE_BITSTREAM
@@ -62,6 +62,16 @@ STATIC machine_i2c_obj_t machine_i2c_obj[] = {
     {{&machine_hw_i2c_type}, i2c1, 1, MICROPY_HW_I2C1_SCL, MICROPY_HW_I2C1_SDA, 0},
 };
 
+// Reprogram the bus timing of the active I2C buses after clk_sys has changed.
+void machine_i2c_clock_changed(void) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(machine_i2c_obj); ++i) {
+        machine_i2c_obj_t *self = &machine_i2c_obj[i];
+        if (self->freq != 0) {
+            i2c_set_baudrate(self->i2c_inst, self->freq);
+        }
+    }
+}
+
 STATIC void machine_i2c_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     machine_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
     mp_printf(print, "I2C(%u, freq=%u, scl=%u, sda=%u)",
@@ -505,20 +505,19 @@ STATIC void feed_dma(machine_i2s_obj_t *self, uint8_t *dma_buffer_p) {
 
 STATIC void irq_configure(machine_i2s_obj_t *self) {
     if (self->i2s_id == 0) {
-        irq_set_exclusive_handler(DMA_IRQ_0, dma_irq0_handler);
+        irq_add_shared_handler(DMA_IRQ_0, dma_irq0_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
         irq_set_enabled(DMA_IRQ_0, true);
     } else {
-        irq_set_exclusive_handler(DMA_IRQ_1, dma_irq1_handler);
+        irq_add_shared_handler(DMA_IRQ_1, dma_irq1_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
         irq_set_enabled(DMA_IRQ_1, true);
     }
 }
 
 STATIC void irq_deinit(machine_i2s_obj_t *self) {
+    // The IRQ lines stay enabled because rp2.DMA may also be using them.
     if (self->i2s_id == 0) {
-        irq_set_enabled(DMA_IRQ_0, false);
         irq_remove_handler(DMA_IRQ_0, dma_irq0_handler);
     } else {
-        irq_set_enabled(DMA_IRQ_1, false);
         irq_remove_handler(DMA_IRQ_1, dma_irq1_handler);
     }
 }
@@ -632,10 +631,11 @@ STATIC uint8_t dma_get_bits(i2s_mode_t mode, int8_t bits) {
 }
 
 // determine which DMA channel is associated to this IRQ
-STATIC uint dma_map_irq_to_channel(uint irq_index) {
-    for (uint ch = 0; ch < NUM_DMA_CHANNELS; ch++) {
-        if ((dma_irqn_get_channel_status(irq_index, ch))) {
-            return ch;
+// The DMA IRQ is shared with rp2.DMA so only this instance's channels are checked.
+STATIC uint dma_map_irq_to_channel(machine_i2s_obj_t *self, uint irq_index) {
+    for (uint8_t ch = 0; ch < I2S_NUM_DMA_CHANNELS; ch++) {
+        if ((dma_irqn_get_channel_status(irq_index, self->dma_channel[ch]))) {
+            return self->dma_channel[ch];
         }
     }
     // This should never happen
@@ -724,15 +724,15 @@ STATIC void dma_deinit(machine_i2s_obj_t *self) {
 }
 
 STATIC void dma_irq_handler(uint8_t irq_index) {
-    int dma_channel = dma_map_irq_to_channel(irq_index);
-    if (dma_channel == -1) {
+    machine_i2s_obj_t *self = MP_STATE_PORT(machine_i2s_obj[irq_index]);
+    if (self == NULL) {
         // This should never happen
         return;
     }
 
-    machine_i2s_obj_t *self = MP_STATE_PORT(machine_i2s_obj[irq_index]);
-    if (self == NULL) {
-        // This should never happen
+    int dma_channel = dma_map_irq_to_channel(self, irq_index);
+    if (dma_channel == -1) {
+        // The IRQ is for another user of this DMA IRQ line.
         return;
     }
 
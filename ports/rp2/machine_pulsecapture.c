@@ -0,0 +1,218 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "modmachine.h"
+#include "modrp2.h"
+
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+
+// The state machine runs at 10MHz and each count takes 10 cycles, so the
+// durations are in microseconds.
+#define PULSECAPTURE_SM_FREQ (10000000)
+
+// Longest program: 2 to wait for the start edge, then 6 + 5 for the levels.
+#define PULSECAPTURE_PROG_LEN (13)
+
+typedef struct _machine_pulsecapture_obj_t {
+    mp_obj_base_t base;
+    mp_obj_t buf_obj;
+    uint32_t *buf;
+    size_t len;
+    PIO pio;
+    int sm;
+    int dma;
+    uint offset;
+    uint16_t instructions[PULSECAPTURE_PROG_LEN];
+    struct pio_program program;
+} machine_pulsecapture_obj_t;
+
+// Add a loop counting while the pin is at the given level, then pushing the
+// count, at the current end of the program.
+STATIC void pulsecapture_add_level(machine_pulsecapture_obj_t *self, bool level) {
+    uint16_t *instr = self->instructions;
+    uint b = self->program.length;
+    instr[b] = pio_encode_mov_not(pio_x, pio_null);
+    if (level) {
+        instr[b + 1] = pio_encode_jmp_pin(b + 3) | pio_encode_delay(1);
+        instr[b + 2] = pio_encode_jmp(b + 4);
+        instr[b + 3] = pio_encode_jmp_x_dec(b + 1) | pio_encode_delay(7);
+        b += 4;
+    } else {
+        instr[b + 1] = pio_encode_jmp_pin(b + 3) | pio_encode_delay(1);
+        instr[b + 2] = pio_encode_jmp_x_dec(b + 1) | pio_encode_delay(7);
+        b += 3;
+    }
+    // The count is the number of decrements of x from 0xffffffff.
+    instr[b] = pio_encode_mov_not(pio_isr, pio_x);
+    instr[b + 1] = pio_encode_push(false, true);
+    self->program.length = b + 2;
+}
+
+STATIC void pulsecapture_deinit(machine_pulsecapture_obj_t *self) {
+    if (self->sm < 0) {
+        return;
+    }
+    dma_channel_abort(self->dma);
+    dma_channel_unclaim(self->dma);
+    pio_sm_set_enabled(self->pio, self->sm, false);
+    pio_remove_program(self->pio, &self->program, self->offset);
+    pio_sm_unclaim(self->pio, self->sm);
+    MP_STATE_PORT(machine_pulsecapture_obj[pio_get_index(self->pio) * 4 + self->sm]) = NULL;
+    self->sm = -1;
+}
+
+void machine_pulsecapture_deinit_all(void) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(MP_STATE_PORT(machine_pulsecapture_obj)); ++i) {
+        machine_pulsecapture_obj_t *self = MP_STATE_PORT(machine_pulsecapture_obj[i]);
+        if (self != NULL) {
+            pulsecapture_deinit(self);
+        }
+    }
+}
+
+// PulseCapture(pin, edge, buf)
+STATIC mp_obj_t machine_pulsecapture_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    mp_arg_check_num(n_args, n_kw, 3, 3, false);
+    mp_hal_pin_obj_t pin = mp_hal_get_pin_obj(all_args[0]);
+    mp_int_t edge = mp_obj_get_int(all_args[1]);
+    if (edge != GPIO_IRQ_EDGE_RISE && edge != GPIO_IRQ_EDGE_FALL) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid edge"));
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(all_args[2], &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.len < 4 || ((uintptr_t)bufinfo.buf & 3) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer must hold 32-bit values"));
+    }
+
+    machine_pulsecapture_obj_t *self = m_new_obj(machine_pulsecapture_obj_t);
+    self->base.type = type;
+    self->buf_obj = all_args[2];
+    self->buf = bufinfo.buf;
+    self->len = bufinfo.len / 4;
+    self->sm = -1;
+
+    // Build the program: wait for the start edge, then measure the level it
+    // starts, then the other level, and repeat those two.
+    bool level = edge == GPIO_IRQ_EDGE_RISE;
+    self->instructions[0] = pio_encode_wait_gpio(!level, pin);
+    self->instructions[1] = pio_encode_wait_gpio(level, pin);
+    self->program.instructions = self->instructions;
+    self->program.length = 2;
+    self->program.origin = -1;
+    pulsecapture_add_level(self, level);
+    pulsecapture_add_level(self, !level);
+
+    // Find PIO resources, trying PIO0 then PIO1.
+    for (uint i = 0; i < NUM_PIOS && self->sm < 0; ++i) {
+        PIO pio = pio_get_instance(i);
+        if (pio_can_add_program(pio, &self->program)) {
+            self->sm = rp2_pio_claim_unused_sm(pio);
+            self->pio = pio;
+        }
+    }
+    if (self->sm < 0) {
+        mp_raise_OSError(MP_EBUSY);
+    }
+    self->dma = dma_claim_unused_channel(false);
+    if (self->dma < 0) {
+        pio_sm_unclaim(self->pio, self->sm);
+        mp_raise_OSError(MP_EBUSY);
+    }
+    self->offset = pio_add_program(self->pio, &self->program);
+    MP_STATE_PORT(machine_pulsecapture_obj[pio_get_index(self->pio) * 4 + self->sm]) = self;
+
+    // Configure the state machine, looping over the two levels.
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, self->offset + 2, self->offset + self->program.length - 1);
+    sm_config_set_jmp_pin(&c, pin);
+    sm_config_set_in_shift(&c, false, false, 32);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+    uint64_t div = (uint64_t)clock_get_hz(clk_sys) * 256 / PULSECAPTURE_SM_FREQ;
+    sm_config_set_clkdiv_int_frac(&c, div / 256, div & 0xff);
+    pio_sm_init(self->pio, self->sm, self->offset, &c);
+
+    // Move each count to the buffer with DMA.
+    dma_channel_config dc = dma_channel_get_default_config(self->dma);
+    channel_config_set_transfer_data_size(&dc, DMA_SIZE_32);
+    channel_config_set_read_increment(&dc, false);
+    channel_config_set_write_increment(&dc, true);
+    channel_config_set_dreq(&dc, pio_get_dreq(self->pio, self->sm, false));
+    dma_channel_configure(self->dma, &dc, self->buf, &self->pio->rxf[self->sm], self->len, true);
+
+    pio_sm_set_enabled(self->pio, self->sm, true);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Return the number of durations recorded so far.
+STATIC size_t pulsecapture_count(machine_pulsecapture_obj_t *self) {
+    if (self->sm < 0) {
+        return 0;
+    }
+    return self->len - dma_channel_hw_addr(self->dma)->transfer_count;
+}
+
+STATIC void machine_pulsecapture_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    machine_pulsecapture_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "<PulseCapture %u/%u>", (uint)pulsecapture_count(self), (uint)self->len);
+}
+
+STATIC mp_obj_t machine_pulsecapture_count(mp_obj_t self_in) {
+    return MP_OBJ_NEW_SMALL_INT(pulsecapture_count(MP_OBJ_TO_PTR(self_in)));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(machine_pulsecapture_count_obj, machine_pulsecapture_count);
+
+STATIC mp_obj_t machine_pulsecapture_done(mp_obj_t self_in) {
+    machine_pulsecapture_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(self->sm < 0 || !dma_channel_is_busy(self->dma));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(machine_pulsecapture_done_obj, machine_pulsecapture_done);
+
+STATIC mp_obj_t machine_pulsecapture_deinit(mp_obj_t self_in) {
+    pulsecapture_deinit(MP_OBJ_TO_PTR(self_in));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(machine_pulsecapture_deinit_obj, machine_pulsecapture_deinit);
+
+STATIC const mp_rom_map_elem_t machine_pulsecapture_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_count), MP_ROM_PTR(&machine_pulsecapture_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_done), MP_ROM_PTR(&machine_pulsecapture_done_obj) },
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&machine_pulsecapture_deinit_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(machine_pulsecapture_locals_dict, machine_pulsecapture_locals_dict_table);
+
+const mp_obj_type_t machine_pulsecapture_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_PulseCapture,
+    .print = machine_pulsecapture_print,
+    .make_new = machine_pulsecapture_make_new,
+    .locals_dict = (mp_obj_dict_t *)&machine_pulsecapture_locals_dict,
+};
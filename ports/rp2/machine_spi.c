@@ -68,6 +68,10 @@ typedef struct _machine_spi_obj_t {
     uint8_t mosi;
     uint8_t miso;
     uint32_t baudrate;
+    bool dma_active; // dma_tx and dma_rx are claimed, for a transfer in progress
+    uint8_t dma_tx;
+    uint8_t dma_rx;
+    uint8_t dma_dummy; // receives data for write-only transfers
 } machine_spi_obj_t;
 
 STATIC machine_spi_obj_t machine_spi_obj[] = {
@@ -85,6 +89,16 @@ STATIC machine_spi_obj_t machine_spi_obj[] = {
     },
 };
 
+// Reprogram the baudrate of the active SPI buses after clk_peri has changed.
+void machine_spi_clock_changed(void) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(machine_spi_obj); ++i) {
+        machine_spi_obj_t *self = &machine_spi_obj[i];
+        if (self->baudrate != 0) {
+            self->baudrate = spi_set_baudrate(self->spi_inst, self->baudrate);
+        }
+    }
+}
+
 STATIC void machine_spi_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     machine_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
     mp_printf(print, "SPI(%u, baudrate=%u, polarity=%u, phase=%u, bits=%u, sck=%u, mosi=%u, miso=%u)",
@@ -209,63 +223,93 @@ STATIC void machine_spi_init(mp_obj_base_t *self_in, size_t n_args, const mp_obj
     }
 }
 
-STATIC void machine_spi_transfer(mp_obj_base_t *self_in, size_t len, const uint8_t *src, uint8_t *dest) {
-    machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
-    // Use DMA for large transfers if channels are available
-    const size_t dma_min_size_threshold = 32;
-    int chan_tx = -1;
-    int chan_rx = -1;
-    if (len >= dma_min_size_threshold) {
-        // Use two DMA channels to service the two FIFOs
-        chan_tx = dma_claim_unused_channel(false);
-        chan_rx = dma_claim_unused_channel(false);
+// Use DMA for transfers of at least this many bytes, if channels are available
+#define DMA_MIN_SIZE_THRESHOLD (32)
+
+// Start a DMA transfer, returning false if two DMA channels couldn't be claimed.
+STATIC bool machine_spi_dma_start(machine_spi_obj_t *self, size_t len, const uint8_t *src, uint8_t *dest) {
+    // Use two DMA channels to service the two FIFOs
+    int chan_tx = dma_claim_unused_channel(false);
+    int chan_rx = dma_claim_unused_channel(false);
+    if (chan_tx < 0 || chan_rx < 0) {
+        // If we have claimed only one channel successfully, we should release immediately
+        if (chan_rx >= 0) {
+            dma_channel_unclaim(chan_rx);
+        }
+        if (chan_tx >= 0) {
+            dma_channel_unclaim(chan_tx);
+        }
+        return false;
     }
-    bool use_dma = chan_rx >= 0 && chan_tx >= 0;
     // note src is guaranteed to be non-NULL
     bool write_only = dest == NULL;
 
-    if (use_dma) {
-        uint8_t dev_null;
-        dma_channel_config c = dma_channel_get_default_config(chan_tx);
-        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-        channel_config_set_dreq(&c, spi_get_index(self->spi_inst) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
-        dma_channel_configure(chan_tx, &c,
-            &spi_get_hw(self->spi_inst)->dr,
-            src,
-            len,
-            false);
-
-        c = dma_channel_get_default_config(chan_rx);
-        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-        channel_config_set_dreq(&c, spi_get_index(self->spi_inst) ? DREQ_SPI1_RX : DREQ_SPI0_RX);
-        channel_config_set_read_increment(&c, false);
-        channel_config_set_write_increment(&c, !write_only);
-        dma_channel_configure(chan_rx, &c,
-            write_only ? &dev_null : dest,
-            &spi_get_hw(self->spi_inst)->dr,
-            len,
-            false);
-
-        dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
-        dma_channel_wait_for_finish_blocking(chan_rx);
-        dma_channel_wait_for_finish_blocking(chan_tx);
+    dma_channel_config c = dma_channel_get_default_config(chan_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(self->spi_inst) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
+    dma_channel_configure(chan_tx, &c,
+        &spi_get_hw(self->spi_inst)->dr,
+        src,
+        len,
+        false);
+
+    c = dma_channel_get_default_config(chan_rx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(self->spi_inst) ? DREQ_SPI1_RX : DREQ_SPI0_RX);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, !write_only);
+    dma_channel_configure(chan_rx, &c,
+        write_only ? &self->dma_dummy : dest,
+        &spi_get_hw(self->spi_inst)->dr,
+        len,
+        false);
+
+    self->dma_tx = chan_tx;
+    self->dma_rx = chan_rx;
+    self->dma_active = true;
+    dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
+    return true;
+}
+
+// Check for the end of a DMA transfer, releasing the channels once it's done.
+STATIC bool machine_spi_transfer_busy(mp_obj_base_t *self_in) {
+    machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
+    if (!self->dma_active) {
+        return false;
+    }
+    if (dma_channel_is_busy(self->dma_rx) || dma_channel_is_busy(self->dma_tx)) {
+        return true;
     }
+    dma_channel_unclaim(self->dma_rx);
+    dma_channel_unclaim(self->dma_tx);
+    self->dma_active = false;
+    return false;
+}
 
-    // If we have claimed only one channel successfully, we should release immediately
-    if (chan_rx >= 0) {
-        dma_channel_unclaim(chan_rx);
+STATIC void machine_spi_transfer_blocking(machine_spi_obj_t *self, size_t len, const uint8_t *src, uint8_t *dest) {
+    // Use software for small transfers, or if couldn't claim two DMA channels
+    if (dest == NULL) {
+        spi_write_blocking(self->spi_inst, src, len);
+    } else {
+        spi_write_read_blocking(self->spi_inst, src, dest, len);
     }
-    if (chan_tx >= 0) {
-        dma_channel_unclaim(chan_tx);
+}
+
+STATIC void machine_spi_transfer(mp_obj_base_t *self_in, size_t len, const uint8_t *src, uint8_t *dest) {
+    machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
+    if (len >= DMA_MIN_SIZE_THRESHOLD && machine_spi_dma_start(self, len, src, dest)) {
+        dma_channel_wait_for_finish_blocking(self->dma_rx);
+        dma_channel_wait_for_finish_blocking(self->dma_tx);
+        machine_spi_transfer_busy(self_in);
+    } else {
+        machine_spi_transfer_blocking(self, len, src, dest);
     }
+}
 
-    if (!use_dma) {
-        // Use software for small transfers, or if couldn't claim two DMA channels
-        if (write_only) {
-            spi_write_blocking(self->spi_inst, src, len);
-        } else {
-            spi_write_read_blocking(self->spi_inst, src, dest, len);
-        }
+STATIC void machine_spi_transfer_start(mp_obj_base_t *self_in, size_t len, const uint8_t *src, uint8_t *dest) {
+    machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
+    if (len < DMA_MIN_SIZE_THRESHOLD || !machine_spi_dma_start(self, len, src, dest)) {
+        machine_spi_transfer_blocking(self, len, src, dest);
     }
 }
 
@@ -281,6 +325,8 @@ machine_spi_obj_t *spi_from_mp_obj(mp_obj_t o) {
 STATIC const mp_machine_spi_p_t machine_spi_p = {
     .init = machine_spi_init,
     .transfer = machine_spi_transfer,
+    .transfer_start = machine_spi_transfer_start,
+    .transfer_busy = machine_spi_transfer_busy,
 };
 
 const mp_obj_type_t machine_spi_type = {
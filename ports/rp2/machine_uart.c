@@ -403,6 +403,16 @@ STATIC mp_obj_t machine_uart_init(size_t n_args, const mp_obj_t *args, mp_map_t
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(machine_uart_init_obj, 1, machine_uart_init);
 
+// Reprogram the baudrate of the active UARTs after clk_peri has changed.
+void machine_uart_clock_changed(void) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(machine_uart_obj); ++i) {
+        machine_uart_obj_t *self = &machine_uart_obj[i];
+        if (self->baudrate != 0) {
+            uart_set_baudrate(self->uart, self->baudrate);
+        }
+    }
+}
+
 STATIC mp_obj_t machine_uart_deinit(mp_obj_t self_in) {
     machine_uart_obj_t *self = MP_OBJ_TO_PTR(self_in);
     uart_deinit(self->uart);
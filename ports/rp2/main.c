@@ -32,6 +32,7 @@
 #include "py/mperrno.h"
 #include "py/mphal.h"
 #include "py/stackctrl.h"
+#include "extmod/machine_bitstream.h"
 #include "extmod/modbluetooth.h"
 #include "extmod/modnetwork.h"
 #include "shared/readline/readline.h"
@@ -128,6 +129,7 @@ int main(int argc, char **argv) {
         readline_init0();
         machine_pin_init();
         rp2_pio_init();
+        rp2_dma_init();
         machine_i2s_init0();
 
         #if MICROPY_PY_BLUETOOTH
@@ -176,7 +178,13 @@ int main(int argc, char **argv) {
         #if MICROPY_PY_NETWORK
         mod_network_deinit();
         #endif
+        #if MICROPY_PY_MACHINE_BITSTREAM
+        machine_bitstream_deinit();
+        #endif
+        machine_pulsecapture_deinit_all();
         rp2_pio_deinit();
+        rp2_dma_deinit();
+        rp2_clock_deinit();
         #if MICROPY_PY_BLUETOOTH
         mp_bluetooth_deinit();
         #endif
@@ -184,6 +192,9 @@ int main(int argc, char **argv) {
         #if MICROPY_PY_THREAD
         mp_thread_deinit();
         #endif
+        #if MICROPY_PY_RP2_WORKER
+        rp2_worker_deinit();
+        #endif
         gc_sweep_all();
         mp_deinit();
     }
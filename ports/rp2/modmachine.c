@@ -36,6 +36,7 @@
 #include "extmod/machine_spi.h"
 
 #include "modmachine.h"
+#include "modrp2.h"
 #include "uart.h"
 #include "hardware/clocks.h"
 #include "hardware/watchdog.h"
@@ -92,9 +93,11 @@ STATIC mp_obj_t machine_freq(size_t n_args, const mp_obj_t *args) {
         return MP_OBJ_NEW_SMALL_INT(mp_hal_get_cpu_freq());
     } else {
         mp_int_t freq = mp_obj_get_int(args[0]);
+        uint32_t old_hz = clock_get_hz(clk_sys);
         if (!set_sys_clock_khz(freq / 1000, false)) {
             mp_raise_ValueError(MP_ERROR_TEXT("cannot change frequency"));
         }
+        rp2_clock_changed(old_hz);
         #if MICROPY_HW_ENABLE_UART_REPL
         setup_default_uart();
         mp_uart_init();
@@ -171,6 +174,7 @@ STATIC const mp_rom_map_elem_t machine_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_SoftI2C),             MP_ROM_PTR(&mp_machine_soft_i2c_type) },
     { MP_ROM_QSTR(MP_QSTR_I2S),                 MP_ROM_PTR(&machine_i2s_type) },
     { MP_ROM_QSTR(MP_QSTR_Pin),                 MP_ROM_PTR(&machine_pin_type) },
+    { MP_ROM_QSTR(MP_QSTR_PulseCapture),        MP_ROM_PTR(&machine_pulsecapture_type) },
     { MP_ROM_QSTR(MP_QSTR_PWM),                 MP_ROM_PTR(&machine_pwm_type) },
     { MP_ROM_QSTR(MP_QSTR_RTC),                 MP_ROM_PTR(&machine_rtc_type) },
     { MP_ROM_QSTR(MP_QSTR_Signal),              MP_ROM_PTR(&machine_signal_type) },
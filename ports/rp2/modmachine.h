@@ -7,6 +7,7 @@ extern const mp_obj_type_t machine_adc_type;
 extern const mp_obj_type_t machine_hw_i2c_type;
 extern const mp_obj_type_t machine_i2s_type;
 extern const mp_obj_type_t machine_pin_type;
+extern const mp_obj_type_t machine_pulsecapture_type;
 extern const mp_obj_type_t machine_rtc_type;
 extern const mp_obj_type_t machine_spi_type;
 extern const mp_obj_type_t machine_timer_type;
@@ -16,6 +17,10 @@ extern const mp_obj_type_t machine_wdt_type;
 void machine_pin_init(void);
 void machine_pin_deinit(void);
 void machine_i2s_init0(void);
+void machine_pulsecapture_deinit_all(void);
+void machine_uart_clock_changed(void);
+void machine_spi_clock_changed(void);
+void machine_i2c_clock_changed(void);
 
 struct _machine_spi_obj_t *spi_from_mp_obj(mp_obj_t o);
 
@@ -27,12 +27,36 @@
 #define MICROPY_INCLUDED_RP2_MODRP2_H
 
 #include "py/obj.h"
+#include "hardware/pio.h"
 
 extern const mp_obj_type_t rp2_flash_type;
 extern const mp_obj_type_t rp2_pio_type;
 extern const mp_obj_type_t rp2_state_machine_type;
+extern const mp_obj_type_t rp2_dma_type;
+extern const mp_obj_type_t rp2_worker_type;
 
 void rp2_pio_init(void);
 void rp2_pio_deinit(void);
+int rp2_pio_claim_unused_sm(PIO pio);
+uint32_t rp2_state_machine_get_fifo(mp_obj_t sm_in, bool is_tx, uint *dreq);
+
+void rp2_dma_init(void);
+void rp2_dma_deinit(void);
+
+extern volatile uint8_t rp2_clock_state;
+MP_DECLARE_CONST_FUN_OBJ_VAR(rp2_idle_clock_obj);
+void rp2_clock_changed(uint32_t old_hz);
+void rp2_clock_poll_idle(void);
+void rp2_clock_set_busy(void);
+void rp2_clock_deinit(void);
+
+#if MICROPY_PY_RP2_WORKER
+bool rp2_worker_running(void);
+void rp2_worker_deinit(void);
+#else
+static inline bool rp2_worker_running(void) {
+    return false;
+}
+#endif
 
 #endif // MICROPY_INCLUDED_RP2_MODRP2_H
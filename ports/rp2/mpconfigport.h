@@ -51,21 +51,42 @@
 
 // MicroPython emitters
 #define MICROPY_PERSISTENT_CODE_LOAD            (1)
+#ifndef MICROPY_EMIT_THUMB
 #define MICROPY_EMIT_THUMB                      (1)
+#endif
 #define MICROPY_EMIT_THUMB_ARMV7M               (0)
+#ifndef MICROPY_EMIT_INLINE_THUMB
 #define MICROPY_EMIT_INLINE_THUMB               (1)
+#endif
 #define MICROPY_EMIT_INLINE_THUMB_FLOAT         (0)
 
 // Optimisations
 #define MICROPY_OPT_COMPUTED_GOTO               (1)
 
+// Run the VM and the runtime functions it calls most from SRAM, so they don't
+// stall on XIP cache misses.  A board enabling this may need a smaller
+// MICROPY_GC_HEAP_SIZE to make room for them.
+#ifndef MICROPY_HW_VM_IN_RAM
+#define MICROPY_HW_VM_IN_RAM                    (0)
+#endif
+#if MICROPY_HW_VM_IN_RAM
+#define MICROPY_WRAP_MP_BINARY_OP(f)            __not_in_flash_func(f)
+#define MICROPY_WRAP_MP_EXECUTE_BYTECODE(f)     __not_in_flash_func(f)
+#define MICROPY_WRAP_MP_LOAD_GLOBAL(f)          __not_in_flash_func(f)
+#define MICROPY_WRAP_MP_LOAD_NAME(f)            __not_in_flash_func(f)
+#define MICROPY_WRAP_MP_MAP_LOOKUP(f)           __not_in_flash_func(f)
+#define MICROPY_WRAP_MP_OBJ_GET_TYPE(f)         __not_in_flash_func(f)
+#endif
+
 // Python internal features
 #define MICROPY_TRACKED_ALLOC                   (MICROPY_SSL_MBEDTLS)
 #define MICROPY_READER_VFS                      (1)
 #define MICROPY_ENABLE_GC                       (1)
 #define MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF  (1)
 #define MICROPY_LONGINT_IMPL                    (MICROPY_LONGINT_IMPL_MPZ)
+#ifndef MICROPY_FLOAT_IMPL
 #define MICROPY_FLOAT_IMPL                      (MICROPY_FLOAT_IMPL_FLOAT)
+#endif
 #define MICROPY_SCHEDULER_DEPTH                 (8)
 #define MICROPY_SCHEDULER_STATIC_NODES          (1)
 #ifndef MICROPY_USE_INTERNAL_ERRNO
@@ -79,6 +100,17 @@
 #define MICROPY_PY_THREAD_GIL                   (0)
 #define MICROPY_THREAD_YIELD()                  mp_handle_pending(true)
 
+// rp2.Worker runs a second interpreter on core1, so the interpreter state is
+// selected by the core that is running, using the SIO CPUID register.
+#ifndef MICROPY_PY_RP2_WORKER
+#define MICROPY_PY_RP2_WORKER                   (1)
+#endif
+#if MICROPY_PY_RP2_WORKER
+#define MICROPY_MULTIPLE_INTERPRETERS           (1)
+#define MP_STATE_CTX_PTR                        (rp2_state_ctx_ptr[get_core_num()])
+extern struct _mp_state_ctx_t *rp2_state_ctx_ptr[2];
+#endif
+
 // Extended modules
 #define MICROPY_EPOCH_IS_1970                   (1)
 #define MICROPY_PY_UOS_INCLUDEFILE              "ports/rp2/moduos.c"
@@ -91,6 +123,7 @@
 #define MICROPY_PY_URANDOM_SEED_INIT_FUNC       (rosc_random_u32())
 #define MICROPY_PY_MACHINE                      (1)
 #define MICROPY_PY_MACHINE_PIN_MAKE_NEW         mp_pin_make_new
+#define MICROPY_PY_MACHINE_IRQ_STATS            (1)
 #define MICROPY_PY_MACHINE_BITSTREAM            (1)
 #define MICROPY_PY_MACHINE_PULSE                (1)
 #define MICROPY_PY_MACHINE_PWM                  (1)
@@ -193,9 +226,13 @@ extern const struct _mod_network_nic_type_t mod_network_nic_type_wiznet5k;
     void *machine_pin_irq_obj[30]; \
     void *rp2_pio_irq_obj[2]; \
     void *rp2_state_machine_irq_obj[8]; \
+    void *rp2_dma_irq_obj[12]; \
     void *rp2_uart_rx_buffer[2]; \
     void *rp2_uart_tx_buffer[2]; \
     void *machine_i2s_obj[2]; \
+    void *machine_bitstream_buf; \
+    void *machine_pulsecapture_obj[8]; \
+    void *rp2_worker_mem; \
     NETWORK_ROOT_POINTERS \
     MICROPY_BOARD_ROOT_POINTERS \
     MICROPY_PORT_ROOT_POINTER_NINAW10 \
@@ -217,31 +254,64 @@ extern const struct _mod_network_nic_type_t mod_network_nic_type_wiznet5k;
 
 #if MICROPY_HW_ENABLE_USBDEV
 #define MICROPY_HW_USBDEV_TASK_HOOK extern void tud_task(void); tud_task();
+#else
+#define MICROPY_HW_USBDEV_TASK_HOOK
+#endif
+
+// Restore the full clock after rp2.idle_clock has slowed it, once Python code runs.
+#define MICROPY_HW_CLOCK_BUSY_HOOK \
+    extern volatile uint8_t rp2_clock_state; \
+    if (rp2_clock_state) { \
+        extern void rp2_clock_set_busy(void); \
+        rp2_clock_set_busy(); \
+    }
+
 #define MICROPY_VM_HOOK_COUNT (10)
 #define MICROPY_VM_HOOK_INIT static uint vm_hook_divisor = MICROPY_VM_HOOK_COUNT;
 #define MICROPY_VM_HOOK_POLL if (--vm_hook_divisor == 0) { \
         vm_hook_divisor = MICROPY_VM_HOOK_COUNT; \
         MICROPY_HW_USBDEV_TASK_HOOK \
+        MICROPY_HW_CLOCK_BUSY_HOOK \
 }
 #define MICROPY_VM_HOOK_LOOP MICROPY_VM_HOOK_POLL
 #define MICROPY_VM_HOOK_RETURN MICROPY_VM_HOOK_POLL
-#else
-#define MICROPY_HW_USBDEV_TASK_HOOK
-#endif
 
 #define MICROPY_EVENT_POLL_HOOK \
     do { \
         extern void mp_handle_pending(bool); \
+        extern void rp2_clock_poll_idle(void); \
         mp_handle_pending(true); \
+        rp2_clock_poll_idle(); \
         best_effort_wfe_or_timeout(make_timeout_time_ms(1)); \
         MICROPY_HW_USBDEV_TASK_HOOK \
     } while (0);
 
-#define MICROPY_MAKE_POINTER_CALLABLE(p) ((void *)((mp_uint_t)(p) | 1))
+// The longest that uselect (and so an idle uasyncio loop) waits for an event
+// before polling its objects again.  Interrupts end the wait early, so this
+// only bounds the latency of objects made ready without one, such as by code
+// running on the other core.
+#ifndef MICROPY_HW_EVENT_POLL_MAX_MS
+#define MICROPY_HW_EVENT_POLL_MAX_MS (10)
+#endif
+
+#define MICROPY_EVENT_POLL_HOOK_TIMEOUT(timeout_ms) \
+    do { \
+        extern void mp_handle_pending(bool); \
+        extern void rp2_clock_poll_idle(void); \
+        mp_uint_t wait_ms = MIN((timeout_ms), MICROPY_HW_EVENT_POLL_MAX_MS); \
+        mp_handle_pending(true); \
+        rp2_clock_poll_idle(); \
+        best_effort_wfe_or_timeout(make_timeout_time_ms(wait_ms)); \
+        MICROPY_HW_USBDEV_TASK_HOOK \
+    } while (0);
+
+#define MICROPY_MAKE_POINTER_CALLABLE(p) ((void *)((uintptr_t)(p) | 1))
 
 #define MP_SSIZE_MAX (0x7fffffff)
+#ifndef MICROPY_OBJ_REPR
 typedef intptr_t mp_int_t; // must be pointer size
 typedef uintptr_t mp_uint_t; // must be pointer size
+#endif
 typedef intptr_t mp_off_t;
 
 // We need to provide a declaration/definition of alloca()
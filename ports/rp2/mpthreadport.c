@@ -29,6 +29,7 @@
 #include "py/mpthread.h"
 #include "pico/stdlib.h"
 #include "pico/multicore.h"
+#include "modrp2.h"
 
 #if MICROPY_PY_THREAD
 
@@ -36,6 +37,11 @@ extern uint8_t __StackTop, __StackBottom;
 
 void *core_state[2];
 
+#if MICROPY_MULTIPLE_INTERPRETERS
+// The interpreter that each core is running; both the same unless a Worker is active.
+mp_state_ctx_t *rp2_state_ctx_ptr[2] = { &mp_state_ctx, &mp_state_ctx };
+#endif
+
 STATIC void *(*core1_entry)(void *) = NULL;
 STATIC void *core1_arg = NULL;
 STATIC uint32_t *core1_stack = NULL;
@@ -57,12 +63,16 @@ void mp_thread_gc_others(void) {
         gc_collect_root((void **)&core1_stack, 1);
         gc_collect_root((void **)&core1_arg, 1);
     }
-    if (get_core_num() == 1) {
+    if (get_core_num() == 1 && !rp2_worker_running()) {
         // GC running on core1, trace core0's stack.
         gc_collect_root((void **)&__StackBottom, (&__StackTop - &__StackBottom) / sizeof(uintptr_t));
     }
 }
 
+bool mp_thread_core1_in_use(void) {
+    return core1_entry != NULL;
+}
+
 STATIC void core1_entry_wrapper(void) {
     if (core1_entry) {
         core1_entry(core1_arg);
@@ -73,7 +83,7 @@ STATIC void core1_entry_wrapper(void) {
 
 void mp_thread_create(void *(*entry)(void *), void *arg, size_t *stack_size) {
     // Check if core1 is already in use.
-    if (core1_entry != NULL) {
+    if (core1_entry != NULL || rp2_worker_running()) {
         mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("core1 in use"));
     }
 
@@ -36,6 +36,7 @@ extern void *core_state[2];
 void mp_thread_init(void);
 void mp_thread_deinit(void);
 void mp_thread_gc_others(void);
+bool mp_thread_core1_in_use(void);
 
 static inline void mp_thread_set_state(struct _mp_state_thread_t *state) {
     core_state[get_core_num()] = state;
@@ -0,0 +1,189 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "py/mphal.h"
+#include "modmachine.h"
+#include "modrp2.h"
+
+#include "hardware/clocks.h"
+#include "hardware/pio.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+
+// State of the idle clock policy, checked by the VM hook.
+#define CLOCK_STATE_BUSY (0)
+#define CLOCK_STATE_WAITING (1)
+#define CLOCK_STATE_IDLE (2)
+
+volatile uint8_t rp2_clock_state;
+
+STATIC uint32_t rp2_clock_idle_div = 1;
+STATIC uint32_t rp2_clock_idle_delay_us;
+STATIC uint32_t rp2_clock_wait_start;
+STATIC uint32_t rp2_clock_busy_hz;
+
+// Dividers as they were before going idle, so they are restored exactly.
+STATIC uint32_t rp2_clock_saved_pio_clkdiv[2][NUM_PIO_STATE_MACHINES];
+STATIC uint32_t rp2_clock_saved_pwm_div[NUM_PWM_SLICES];
+
+// Scale the dividers of the running PIO state machines and PWM slices, which
+// are clocked from clk_sys, so that they keep their rate.
+STATIC void rp2_clock_scale_dividers(uint32_t old_hz, uint32_t new_hz) {
+    for (uint i = 0; i < 2; ++i) {
+        PIO pio = i == 0 ? pio0 : pio1;
+        for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm) {
+            if (pio->ctrl & (1u << (PIO_CTRL_SM_ENABLE_LSB + sm))) {
+                // 16.8 fixed point divider in the top 24 bits.
+                uint64_t div = (uint64_t)(pio->sm[sm].clkdiv >> 8) * new_hz / old_hz;
+                div = MAX(MIN(div, 0xffffff), 0x100);
+                pio->sm[sm].clkdiv = div << 8;
+            }
+        }
+    }
+    for (uint slice = 0; slice < NUM_PWM_SLICES; ++slice) {
+        if (pwm_hw->en & (1u << slice)) {
+            // 8.4 fixed point divider.
+            uint64_t div = (uint64_t)pwm_hw->slice[slice].div * new_hz / old_hz;
+            pwm_hw->slice[slice].div = MAX(MIN(div, 0xfff), 0x10);
+        }
+    }
+}
+
+// Called after machine.freq() has changed clk_sys, and with it clk_peri, from
+// old_hz so that the active peripherals keep running at the rate they were
+// configured for.
+void rp2_clock_changed(uint32_t old_hz) {
+    uint32_t new_hz = clock_get_hz(clk_sys);
+    rp2_clock_scale_dividers(old_hz, new_hz);
+    machine_uart_clock_changed();
+    machine_spi_clock_changed();
+    machine_i2c_clock_changed();
+    if (rp2_clock_idle_div > 1) {
+        // set_sys_clock_khz runs clk_peri from clk_sys; keep it on the PLL
+        // so that UART and SPI don't see the idle clock.
+        clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_SYS, new_hz, new_hz);
+    }
+}
+
+// clk_sys can only be divided down when it runs straight from the PLL.
+STATIC bool rp2_clock_sys_is_pll(void) {
+    uint32_t ctrl = clocks_hw->clk[clk_sys].ctrl;
+    return (ctrl & CLOCKS_CLK_SYS_CTRL_SRC_BITS) == (CLOCKS_CLK_SYS_CTRL_SRC_VALUE_CLKSRC_CLK_SYS_AUX << CLOCKS_CLK_SYS_CTRL_SRC_LSB)
+           && (ctrl & CLOCKS_CLK_SYS_CTRL_AUXSRC_BITS) == (CLOCKS_CLK_SYS_CTRL_AUXSRC_VALUE_CLKSRC_PLL_SYS << CLOCKS_CLK_SYS_CTRL_AUXSRC_LSB)
+           && clocks_hw->clk[clk_sys].div == 1 << CLOCKS_CLK_SYS_DIV_INT_LSB;
+}
+
+STATIC void rp2_clock_set_sys(uint32_t pll_hz, uint32_t hz) {
+    uint32_t state = save_and_disable_interrupts();
+    clock_configure(clk_sys, CLOCKS_CLK_SYS_CTRL_SRC_VALUE_CLKSRC_CLK_SYS_AUX, CLOCKS_CLK_SYS_CTRL_AUXSRC_VALUE_CLKSRC_PLL_SYS, pll_hz, hz);
+    restore_interrupts(state);
+}
+
+// Called by MICROPY_EVENT_POLL_HOOK.  Drops clk_sys once core0 has been
+// waiting for longer than the idle delay, as long as core1 isn't in use.
+void rp2_clock_poll_idle(void) {
+    if (rp2_clock_idle_div <= 1 || rp2_clock_state == CLOCK_STATE_IDLE || get_core_num() != 0) {
+        return;
+    }
+    uint32_t now = time_us_32();
+    if (rp2_clock_state == CLOCK_STATE_BUSY) {
+        rp2_clock_state = CLOCK_STATE_WAITING;
+        rp2_clock_wait_start = now;
+        return;
+    }
+    if (now - rp2_clock_wait_start < rp2_clock_idle_delay_us) {
+        return;
+    }
+    #if MICROPY_PY_THREAD
+    if (mp_thread_core1_in_use() || rp2_worker_running()) {
+        return;
+    }
+    #endif
+    if (!rp2_clock_sys_is_pll()) {
+        return;
+    }
+
+    for (uint i = 0; i < NUM_PIO_STATE_MACHINES; ++i) {
+        rp2_clock_saved_pio_clkdiv[0][i] = pio0->sm[i].clkdiv;
+        rp2_clock_saved_pio_clkdiv[1][i] = pio1->sm[i].clkdiv;
+    }
+    for (uint i = 0; i < NUM_PWM_SLICES; ++i) {
+        rp2_clock_saved_pwm_div[i] = pwm_hw->slice[i].div;
+    }
+    rp2_clock_busy_hz = clock_get_hz(clk_sys);
+    uint32_t idle_hz = rp2_clock_busy_hz / rp2_clock_idle_div;
+    rp2_clock_set_sys(rp2_clock_busy_hz, idle_hz);
+    rp2_clock_scale_dividers(rp2_clock_busy_hz, idle_hz);
+    machine_i2c_clock_changed();
+    rp2_clock_state = CLOCK_STATE_IDLE;
+}
+
+// Called by the VM hook when rp2_clock_state is not CLOCK_STATE_BUSY, so
+// that Python code always runs at the full clock.
+void rp2_clock_set_busy(void) {
+    if (get_core_num() != 0) {
+        return;
+    }
+    if (rp2_clock_state == CLOCK_STATE_IDLE) {
+        rp2_clock_set_sys(rp2_clock_busy_hz, rp2_clock_busy_hz);
+        for (uint i = 0; i < NUM_PIO_STATE_MACHINES; ++i) {
+            pio0->sm[i].clkdiv = rp2_clock_saved_pio_clkdiv[0][i];
+            pio1->sm[i].clkdiv = rp2_clock_saved_pio_clkdiv[1][i];
+        }
+        for (uint i = 0; i < NUM_PWM_SLICES; ++i) {
+            pwm_hw->slice[i].div = rp2_clock_saved_pwm_div[i];
+        }
+        machine_i2c_clock_changed();
+    }
+    rp2_clock_state = CLOCK_STATE_BUSY;
+}
+
+void rp2_clock_deinit(void) {
+    rp2_clock_set_busy();
+    rp2_clock_idle_div = 1;
+}
+
+// idle_clock([div[, delay_ms]])
+STATIC mp_obj_t rp2_idle_clock(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return MP_OBJ_NEW_SMALL_INT(rp2_clock_idle_div);
+    }
+    mp_int_t div = mp_obj_get_int(args[0]);
+    if (div < 1 || div > 255) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid divider"));
+    }
+    rp2_clock_idle_delay_us = (n_args > 1 ? mp_obj_get_int(args[1]) : 10) * 1000;
+    if (div > 1 && rp2_clock_idle_div <= 1) {
+        // Run clk_peri straight from the PLL so that dividing clk_sys
+        // doesn't change the rate of UART and SPI.
+        uint32_t hz = clock_get_hz(clk_sys);
+        clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_SYS, hz, hz);
+    }
+    rp2_clock_idle_div = div;
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(rp2_idle_clock_obj, 0, 2, rp2_idle_clock);
@@ -0,0 +1,459 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/mperrno.h"
+#include "shared/runtime/mpirq.h"
+#include "modrp2.h"
+
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// A field of the channel's CTRL register, as named in pack_ctrl/unpack_ctrl.
+typedef struct _rp2_dma_ctrl_field_t {
+    qstr name;
+    uint8_t shift : 5;
+    uint8_t length : 3;
+    uint8_t read_only : 1;
+} rp2_dma_ctrl_field_t;
+
+STATIC const rp2_dma_ctrl_field_t rp2_dma_ctrl_fields[] = {
+    { MP_QSTR_enable, 0, 1, 0 },
+    { MP_QSTR_high_pri, 1, 1, 0 },
+    { MP_QSTR_size, 2, 2, 0 },
+    { MP_QSTR_inc_read, 4, 1, 0 },
+    { MP_QSTR_inc_write, 5, 1, 0 },
+    { MP_QSTR_ring_size, 6, 4, 0 },
+    { MP_QSTR_ring_sel, 10, 1, 0 },
+    { MP_QSTR_chain_to, 11, 4, 0 },
+    { MP_QSTR_treq_sel, 15, 6, 0 },
+    { MP_QSTR_irq_quiet, 21, 1, 0 },
+    { MP_QSTR_bswap, 22, 1, 0 },
+    { MP_QSTR_sniff_en, 23, 1, 0 },
+    { MP_QSTR_busy, 24, 1, 1 },
+    // bits 25-28 are reserved
+    { MP_QSTR_write_err, 29, 1, 0 },
+    { MP_QSTR_read_err, 30, 1, 0 },
+    { MP_QSTR_ahb_err, 31, 1, 1 },
+};
+
+#define CHANNEL_CLOSED (0xff)
+
+typedef struct _rp2_dma_obj_t {
+    mp_obj_base_t base;
+    uint8_t channel;
+    // Buffers given as source and destination, kept alive while in use.
+    mp_obj_t read_obj;
+    mp_obj_t write_obj;
+} rp2_dma_obj_t;
+
+typedef struct _rp2_dma_irq_obj_t {
+    mp_irq_obj_t base;
+    uint32_t flags;
+    uint32_t trigger;
+} rp2_dma_irq_obj_t;
+
+STATIC const mp_irq_methods_t rp2_dma_irq_methods;
+
+// Channels claimed by DMA objects, released on soft reset.
+STATIC uint32_t rp2_dma_claimed;
+
+// Shared with machine.I2S, so only acknowledge the channels that have a handler.
+STATIC void rp2_dma_irq_handler(void) {
+    uint32_t ints = dma_hw->ints0;
+    for (uint ch = 0; ch < NUM_DMA_CHANNELS; ++ch) {
+        rp2_dma_irq_obj_t *irq = MP_STATE_PORT(rp2_dma_irq_obj[ch]);
+        if (irq != NULL && (ints & (1u << ch))) {
+            dma_hw->ints0 = 1u << ch;
+            irq->flags = 1;
+            mp_irq_handler(&irq->base);
+        }
+    }
+}
+
+void rp2_dma_init(void) {
+    memset(MP_STATE_PORT(rp2_dma_irq_obj), 0, sizeof(MP_STATE_PORT(rp2_dma_irq_obj)));
+    irq_add_shared_handler(DMA_IRQ_0, rp2_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+}
+
+void rp2_dma_deinit(void) {
+    for (uint ch = 0; ch < NUM_DMA_CHANNELS; ++ch) {
+        if (rp2_dma_claimed & (1u << ch)) {
+            dma_channel_set_irq0_enabled(ch, false);
+            dma_channel_abort(ch);
+            dma_channel_unclaim(ch);
+        }
+    }
+    rp2_dma_claimed = 0;
+    irq_remove_handler(DMA_IRQ_0, rp2_dma_irq_handler);
+}
+
+STATIC uint rp2_dma_get_channel(rp2_dma_obj_t *self) {
+    if (self->channel == CHANNEL_CLOSED) {
+        mp_raise_ValueError(MP_ERROR_TEXT("DMA closed"));
+    }
+    return self->channel;
+}
+
+// Convert a source or destination to an address.  It can be an integer, a
+// StateMachine (meaning its TX FIFO as destination or RX FIFO as source),
+// or an object with the buffer protocol.
+STATIC uint32_t rp2_dma_get_addr(mp_obj_t obj, bool is_write, int *dreq) {
+    if (mp_obj_is_int(obj)) {
+        return mp_obj_get_int_truncated(obj);
+    }
+    if (mp_obj_is_type(obj, &rp2_state_machine_type)) {
+        uint sm_dreq;
+        uint32_t addr = rp2_state_machine_get_fifo(obj, is_write, &sm_dreq);
+        *dreq = sm_dreq;
+        return addr;
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(obj, &bufinfo, is_write ? MP_BUFFER_WRITE : MP_BUFFER_READ);
+    return (uint32_t)bufinfo.buf;
+}
+
+STATIC uint32_t rp2_dma_default_ctrl(uint channel) {
+    dma_channel_config config = dma_channel_get_default_config(channel);
+    return channel_config_get_ctrl_value(&config);
+}
+
+STATIC uint32_t rp2_dma_pack_ctrl_helper(uint32_t value, mp_map_t *kw_args) {
+    for (size_t i = 0; i < kw_args->alloc; ++i) {
+        if (!mp_map_slot_is_filled(kw_args, i)) {
+            continue;
+        }
+        qstr name = mp_obj_str_get_qstr(kw_args->table[i].key);
+        const rp2_dma_ctrl_field_t *field = NULL;
+        for (size_t j = 0; j < MP_ARRAY_SIZE(rp2_dma_ctrl_fields); ++j) {
+            if (rp2_dma_ctrl_fields[j].name == name) {
+                field = &rp2_dma_ctrl_fields[j];
+                break;
+            }
+        }
+        if (field == NULL || field->read_only) {
+            mp_raise_msg_varg(&mp_type_TypeError, MP_ERROR_TEXT("unexpected keyword argument '%q'"), name);
+        }
+        uint32_t mask = ((1u << field->length) - 1) << field->shift;
+        value = (value & ~mask) | ((mp_obj_get_int_truncated(kw_args->table[i].value) << field->shift) & mask);
+    }
+    return value;
+}
+
+STATIC void rp2_dma_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    rp2_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->channel == CHANNEL_CLOSED) {
+        mp_printf(print, "DMA(closed)");
+    } else {
+        mp_printf(print, "DMA(%u)", self->channel);
+    }
+}
+
+// constructor()
+STATIC mp_obj_t rp2_dma_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+
+    int channel = dma_claim_unused_channel(false);
+    if (channel < 0) {
+        mp_raise_OSError(MP_EBUSY);
+    }
+    rp2_dma_claimed |= 1u << channel;
+
+    rp2_dma_obj_t *self = m_new_obj_with_finaliser(rp2_dma_obj_t);
+    self->base.type = &rp2_dma_type;
+    self->channel = channel;
+    self->read_obj = mp_const_none;
+    self->write_obj = mp_const_none;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// DMA.config(read=None, write=None, count=None, ctrl=None, trigger=False)
+STATIC mp_obj_t rp2_dma_config(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_read, ARG_write, ARG_count, ARG_ctrl, ARG_trigger };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_read, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_write, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_count, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_ctrl, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_trigger, MP_ARG_BOOL, {.u_bool = false} },
+    };
+
+    rp2_dma_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint channel = rp2_dma_get_channel(self);
+    dma_channel_hw_t *hw = dma_channel_hw_addr(channel);
+
+    // A StateMachine paces the transfer if no ctrl is given.
+    int dreq = -1;
+    if (args[ARG_read].u_obj != mp_const_none) {
+        hw->read_addr = rp2_dma_get_addr(args[ARG_read].u_obj, false, &dreq);
+        self->read_obj = args[ARG_read].u_obj;
+    }
+    if (args[ARG_write].u_obj != mp_const_none) {
+        hw->write_addr = rp2_dma_get_addr(args[ARG_write].u_obj, true, &dreq);
+        self->write_obj = args[ARG_write].u_obj;
+    }
+    if (args[ARG_count].u_obj != mp_const_none) {
+        hw->transfer_count = mp_obj_get_int_truncated(args[ARG_count].u_obj);
+    }
+
+    uint32_t ctrl;
+    bool set_ctrl = true;
+    if (args[ARG_ctrl].u_obj != mp_const_none) {
+        ctrl = mp_obj_get_int_truncated(args[ARG_ctrl].u_obj);
+    } else if (dreq >= 0) {
+        dma_channel_config config = dma_channel_get_default_config(channel);
+        channel_config_set_read_increment(&config, !mp_obj_is_type(self->read_obj, &rp2_state_machine_type));
+        channel_config_set_write_increment(&config, !mp_obj_is_type(self->write_obj, &rp2_state_machine_type));
+        channel_config_set_dreq(&config, dreq);
+        ctrl = channel_config_get_ctrl_value(&config);
+    } else {
+        ctrl = hw->al1_ctrl;
+        set_ctrl = false;
+    }
+
+    if (args[ARG_trigger].u_bool) {
+        hw->ctrl_trig = ctrl;
+    } else if (set_ctrl) {
+        hw->al1_ctrl = ctrl;
+    }
+
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(rp2_dma_config_obj, 1, rp2_dma_config);
+
+// DMA.active([value])
+STATIC mp_obj_t rp2_dma_active(size_t n_args, const mp_obj_t *args) {
+    rp2_dma_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    uint channel = rp2_dma_get_channel(self);
+    if (n_args > 1) {
+        if (mp_obj_is_true(args[1])) {
+            dma_channel_start(channel);
+        } else {
+            dma_channel_abort(channel);
+        }
+    }
+    return mp_obj_new_bool(dma_channel_is_busy(channel));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(rp2_dma_active_obj, 1, 2, rp2_dma_active);
+
+// DMA.pack_ctrl(default=None, **kwargs)
+STATIC mp_obj_t rp2_dma_pack_ctrl(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    rp2_dma_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    uint32_t value;
+    if (n_args > 1) {
+        value = mp_obj_get_int_truncated(pos_args[1]);
+    } else {
+        value = rp2_dma_default_ctrl(rp2_dma_get_channel(self));
+    }
+    return mp_obj_new_int_from_uint(rp2_dma_pack_ctrl_helper(value, kw_args));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(rp2_dma_pack_ctrl_obj, 1, rp2_dma_pack_ctrl);
+
+// DMA.unpack_ctrl(value)
+STATIC mp_obj_t rp2_dma_unpack_ctrl(mp_obj_t value_in) {
+    uint32_t value = mp_obj_get_int_truncated(value_in);
+    mp_obj_t dict = mp_obj_new_dict(MP_ARRAY_SIZE(rp2_dma_ctrl_fields));
+    for (size_t i = 0; i < MP_ARRAY_SIZE(rp2_dma_ctrl_fields); ++i) {
+        const rp2_dma_ctrl_field_t *field = &rp2_dma_ctrl_fields[i];
+        uint32_t field_value = (value >> field->shift) & ((1u << field->length) - 1);
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(field->name), MP_OBJ_NEW_SMALL_INT(field_value));
+    }
+    return dict;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(rp2_dma_unpack_ctrl_fun_obj, rp2_dma_unpack_ctrl);
+STATIC MP_DEFINE_CONST_STATICMETHOD_OBJ(rp2_dma_unpack_ctrl_obj, MP_ROM_PTR(&rp2_dma_unpack_ctrl_fun_obj));
+
+// DMA.irq(handler=None, hard=False)
+STATIC mp_obj_t rp2_dma_irq(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_handler, ARG_hard };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_handler, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_hard, MP_ARG_BOOL, {.u_bool = false} },
+    };
+
+    // Parse the arguments.
+    rp2_dma_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    uint channel = rp2_dma_get_channel(self);
+
+    // Get the IRQ object, allocating it if it doesn't already exist.
+    rp2_dma_irq_obj_t *irq = MP_STATE_PORT(rp2_dma_irq_obj[channel]);
+    if (irq == NULL) {
+        irq = m_new_obj(rp2_dma_irq_obj_t);
+        irq->base.base.type = &mp_irq_type;
+        irq->base.methods = (mp_irq_methods_t *)&rp2_dma_irq_methods;
+        irq->base.parent = MP_OBJ_FROM_PTR(self);
+        irq->base.handler = mp_const_none;
+        irq->base.ishard = false;
+        irq->trigger = 1;
+        MP_STATE_PORT(rp2_dma_irq_obj[channel]) = irq;
+    }
+
+    if (n_args > 1 || kw_args->used != 0) {
+        // Configure IRQ, with this channel's IRQ disabled while data is updated.
+        dma_channel_set_irq0_enabled(channel, false);
+        irq->base.handler = args[ARG_handler].u_obj;
+        irq->base.ishard = args[ARG_hard].u_bool;
+        irq->flags = 0;
+        if (args[ARG_handler].u_obj != mp_const_none) {
+            dma_channel_set_irq0_enabled(channel, true);
+            irq_set_enabled(DMA_IRQ_0, true);
+        }
+    }
+
+    return MP_OBJ_FROM_PTR(irq);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(rp2_dma_irq_obj, 1, rp2_dma_irq);
+
+// DMA.close()
+STATIC mp_obj_t rp2_dma_close(mp_obj_t self_in) {
+    rp2_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint channel = self->channel;
+    // The channel may already have been released by a soft reset.
+    if (channel != CHANNEL_CLOSED && (rp2_dma_claimed & (1u << channel))) {
+        dma_channel_set_irq0_enabled(channel, false);
+        dma_channel_abort(channel);
+        dma_channel_unclaim(channel);
+        rp2_dma_claimed &= ~(1u << channel);
+        MP_STATE_PORT(rp2_dma_irq_obj[channel]) = NULL;
+    }
+    self->channel = CHANNEL_CLOSED;
+    self->read_obj = mp_const_none;
+    self->write_obj = mp_const_none;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(rp2_dma_close_obj, rp2_dma_close);
+
+STATIC void rp2_dma_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
+    rp2_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (attr != MP_QSTR_read && attr != MP_QSTR_write && attr != MP_QSTR_count
+        && attr != MP_QSTR_ctrl && attr != MP_QSTR_channel && attr != MP_QSTR_registers) {
+        // Continue lookup in locals_dict.
+        dest[1] = MP_OBJ_SENTINEL;
+        return;
+    }
+
+    uint channel = rp2_dma_get_channel(self);
+    dma_channel_hw_t *hw = dma_channel_hw_addr(channel);
+    if (dest[0] == MP_OBJ_NULL) {
+        // Load attribute.
+        if (attr == MP_QSTR_read) {
+            dest[0] = mp_obj_new_int_from_uint(hw->read_addr);
+        } else if (attr == MP_QSTR_write) {
+            dest[0] = mp_obj_new_int_from_uint(hw->write_addr);
+        } else if (attr == MP_QSTR_count) {
+            dest[0] = mp_obj_new_int_from_uint(hw->transfer_count);
+        } else if (attr == MP_QSTR_ctrl) {
+            dest[0] = mp_obj_new_int_from_uint(hw->al1_ctrl);
+        } else if (attr == MP_QSTR_channel) {
+            dest[0] = MP_OBJ_NEW_SMALL_INT(channel);
+        } else {
+            // The four aliases of the channel's control registers, for chaining
+            // one channel's configuration from a list of control blocks.
+            dest[0] = mp_obj_new_memoryview('I', sizeof(dma_channel_hw_t) / sizeof(uint32_t), (void *)hw);
+        }
+    } else if (dest[1] != MP_OBJ_NULL) {
+        // Store attribute.
+        int dreq;
+        if (attr == MP_QSTR_read) {
+            hw->read_addr = rp2_dma_get_addr(dest[1], false, &dreq);
+            self->read_obj = dest[1];
+        } else if (attr == MP_QSTR_write) {
+            hw->write_addr = rp2_dma_get_addr(dest[1], true, &dreq);
+            self->write_obj = dest[1];
+        } else if (attr == MP_QSTR_count) {
+            hw->transfer_count = mp_obj_get_int_truncated(dest[1]);
+        } else if (attr == MP_QSTR_ctrl) {
+            hw->al1_ctrl = mp_obj_get_int_truncated(dest[1]);
+        } else {
+            return;
+        }
+        dest[0] = MP_OBJ_NULL;
+    }
+}
+
+STATIC const mp_rom_map_elem_t rp2_dma_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_config), MP_ROM_PTR(&rp2_dma_config_obj) },
+    { MP_ROM_QSTR(MP_QSTR_active), MP_ROM_PTR(&rp2_dma_active_obj) },
+    { MP_ROM_QSTR(MP_QSTR_irq), MP_ROM_PTR(&rp2_dma_irq_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&rp2_dma_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&rp2_dma_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_ctrl), MP_ROM_PTR(&rp2_dma_pack_ctrl_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_ctrl), MP_ROM_PTR(&rp2_dma_unpack_ctrl_obj) },
+
+    // DREQs of peripherals that aren't given as objects; a StateMachine
+    // gives its own.
+    { MP_ROM_QSTR(MP_QSTR_DREQ_SPI0_TX), MP_ROM_INT(DREQ_SPI0_TX) },
+    { MP_ROM_QSTR(MP_QSTR_DREQ_SPI0_RX), MP_ROM_INT(DREQ_SPI0_RX) },
+    { MP_ROM_QSTR(MP_QSTR_DREQ_SPI1_TX), MP_ROM_INT(DREQ_SPI1_TX) },
+    { MP_ROM_QSTR(MP_QSTR_DREQ_SPI1_RX), MP_ROM_INT(DREQ_SPI1_RX) },
+    { MP_ROM_QSTR(MP_QSTR_DREQ_ADC), MP_ROM_INT(DREQ_ADC) },
+    { MP_ROM_QSTR(MP_QSTR_DREQ_TIMER0), MP_ROM_INT(DREQ_DMA_TIMER0) },
+    { MP_ROM_QSTR(MP_QSTR_DREQ_PERMANENT), MP_ROM_INT(DREQ_FORCE) },
+};
+STATIC MP_DEFINE_CONST_DICT(rp2_dma_locals_dict, rp2_dma_locals_dict_table);
+
+const mp_obj_type_t rp2_dma_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_DMA,
+    .print = rp2_dma_print,
+    .make_new = rp2_dma_make_new,
+    .attr = rp2_dma_attr,
+    .locals_dict = (mp_obj_dict_t *)&rp2_dma_locals_dict,
+};
+
+STATIC mp_uint_t rp2_dma_irq_trigger(mp_obj_t self_in, mp_uint_t new_trigger) {
+    rp2_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint channel = rp2_dma_get_channel(self);
+    rp2_dma_irq_obj_t *irq = MP_STATE_PORT(rp2_dma_irq_obj[channel]);
+    dma_channel_set_irq0_enabled(channel, false);
+    irq->flags = 0;
+    irq->trigger = new_trigger;
+    dma_channel_set_irq0_enabled(channel, new_trigger != 0);
+    return 0;
+}
+
+STATIC mp_uint_t rp2_dma_irq_info(mp_obj_t self_in, mp_uint_t info_type) {
+    rp2_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    rp2_dma_irq_obj_t *irq = MP_STATE_PORT(rp2_dma_irq_obj[rp2_dma_get_channel(self)]);
+    if (info_type == MP_IRQ_INFO_FLAGS) {
+        return irq->flags;
+    } else if (info_type == MP_IRQ_INFO_TRIGGERS) {
+        return irq->trigger;
+    }
+    return 0;
+}
+
+STATIC const mp_irq_methods_t rp2_dma_irq_methods = {
+    .trigger = rp2_dma_irq_trigger,
+    .info = rp2_dma_irq_info,
+};
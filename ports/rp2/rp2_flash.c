@@ -143,10 +143,31 @@ STATIC mp_obj_t rp2_flash_ioctl(mp_obj_t self_in, mp_obj_t cmd_in, mp_obj_t arg_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(rp2_flash_ioctl_obj, rp2_flash_ioctl);
 
+// Flash.mmap(offset=0, length=None)
+// Return a read-only memoryview of the storage as mapped by XIP, so data
+// can be used in place, through the XIP cache, without copying it to RAM.
+STATIC mp_obj_t rp2_flash_mmap(size_t n_args, const mp_obj_t *args) {
+    rp2_flash_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_int_t offset = 0;
+    if (n_args > 1) {
+        offset = mp_obj_get_int(args[1]);
+    }
+    mp_int_t length = self->flash_size - offset;
+    if (n_args > 2 && args[2] != mp_const_none) {
+        length = mp_obj_get_int(args[2]);
+    }
+    if (offset < 0 || length < 0 || offset + length > (mp_int_t)self->flash_size) {
+        mp_raise_ValueError(NULL);
+    }
+    return mp_obj_new_memoryview('B', length, (void *)(XIP_BASE + self->flash_base + offset));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(rp2_flash_mmap_obj, 1, 3, rp2_flash_mmap);
+
 STATIC const mp_rom_map_elem_t rp2_flash_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&rp2_flash_readblocks_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&rp2_flash_writeblocks_obj) },
     { MP_ROM_QSTR(MP_QSTR_ioctl), MP_ROM_PTR(&rp2_flash_ioctl_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mmap), MP_ROM_PTR(&rp2_flash_mmap_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(rp2_flash_locals_dict, rp2_flash_locals_dict_table);
 
@@ -120,6 +120,20 @@ void rp2_pio_deinit(void) {
     irq_remove_handler(PIO1_IRQ_0, pio1_irq0);
 }
 
+// Claim a state machine for use by a C driver, returning -1 if none are free.
+// StateMachine objects don't claim theirs, so a state machine that's running
+// is taken to be in use.  Search from the last one, as StateMachine ids tend
+// to be used from 0 upwards.
+int rp2_pio_claim_unused_sm(PIO pio) {
+    for (int sm = 3; sm >= 0; --sm) {
+        if (!pio_sm_is_claimed(pio, sm) && !(pio->ctrl & (1u << (PIO_CTRL_SM_ENABLE_LSB + sm)))) {
+            pio_sm_claim(pio, sm);
+            return sm;
+        }
+    }
+    return -1;
+}
+
 /******************************************************************************/
 // Helper functions to manage asm_pio data structure.
 
@@ -734,6 +748,14 @@ STATIC mp_obj_t rp2_state_machine_tx_fifo(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(rp2_state_machine_tx_fifo_obj, rp2_state_machine_tx_fifo);
 
+// Get the address of the TX or RX FIFO of a StateMachine and the DREQ that
+// paces it, for use as a DMA source or destination.
+uint32_t rp2_state_machine_get_fifo(mp_obj_t sm_in, bool is_tx, uint *dreq) {
+    rp2_state_machine_obj_t *self = MP_OBJ_TO_PTR(sm_in);
+    *dreq = pio_get_dreq(self->pio, self->sm, is_tx);
+    return is_tx ? (uint32_t)&self->pio->txf[self->sm] : (uint32_t)&self->pio->rxf[self->sm];
+}
+
 // StateMachine.irq(handler=None, trigger=0|1, hard=False)
 STATIC mp_obj_t rp2_state_machine_irq(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_handler, ARG_trigger, ARG_hard };
@@ -0,0 +1,329 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/compile.h"
+#include "py/runtime.h"
+#include "py/gc.h"
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "py/stackctrl.h"
+#include "modrp2.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+
+#if MICROPY_PY_RP2_WORKER
+
+// Size of each message ring, must be a power of 2.
+#ifndef MICROPY_HW_RP2_WORKER_RING_SIZE
+#define MICROPY_HW_RP2_WORKER_RING_SIZE (1024)
+#endif
+
+#define RING_SIZE (MICROPY_HW_RP2_WORKER_RING_SIZE)
+#define RING_MASK (RING_SIZE - 1)
+
+// Messages are stored as a 16-bit length followed by the data.
+#define MSG_HEADER_LEN (2)
+
+// A ring with a single producer core and a single consumer core.  head is
+// only written by the producer and tail only by the consumer, and the counts
+// run freely so that head == tail means empty.
+typedef struct _rp2_worker_ring_t {
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint8_t buf[RING_SIZE];
+} rp2_worker_ring_t;
+
+typedef struct _rp2_worker_t {
+    mp_state_ctx_t ctx;
+    // ring[0] carries messages to the worker, ring[1] messages from it.
+    rp2_worker_ring_t ring[2];
+    const char *source;
+    size_t source_len;
+    uint32_t *stack;
+    size_t stack_size;
+    uint8_t *heap;
+    size_t heap_size;
+    volatile bool running;
+} rp2_worker_t;
+
+typedef struct _rp2_worker_obj_t {
+    mp_obj_base_t base;
+    uint8_t end;
+} rp2_worker_obj_t;
+
+STATIC rp2_worker_t rp2_worker;
+
+// The first end is used by core0, the second is the worker's global "worker".
+// They hold no heap memory so can be shared by both interpreters.
+STATIC const rp2_worker_obj_t rp2_worker_obj[2] = {
+    {{&rp2_worker_type}, 0},
+    {{&rp2_worker_type}, 1},
+};
+
+bool rp2_worker_running(void) {
+    return rp2_worker.running;
+}
+
+void rp2_worker_deinit(void) {
+    // core1 has already been reset by mp_thread_deinit.
+    rp2_worker.running = false;
+    rp2_state_ctx_ptr[1] = &mp_state_ctx;
+    MP_STATE_PORT(rp2_worker_mem) = NULL;
+}
+
+STATIC void ring_copy_in(rp2_worker_ring_t *ring, uint32_t pos, const uint8_t *src, size_t len) {
+    size_t i = pos & RING_MASK;
+    size_t n = MIN(len, RING_SIZE - i);
+    memcpy(&ring->buf[i], src, n);
+    memcpy(&ring->buf[0], src + n, len - n);
+}
+
+STATIC void ring_copy_out(rp2_worker_ring_t *ring, uint32_t pos, uint8_t *dest, size_t len) {
+    size_t i = pos & RING_MASK;
+    size_t n = MIN(len, RING_SIZE - i);
+    memcpy(dest, &ring->buf[i], n);
+    memcpy(dest + n, &ring->buf[0], len - n);
+}
+
+// Whether the other end can still produce or consume messages.
+STATIC bool rp2_worker_peer_alive(const rp2_worker_obj_t *self) {
+    return self->end == 1 || rp2_worker.running;
+}
+
+STATIC void rp2_worker_entry(void) {
+    rp2_state_ctx_ptr[1] = &rp2_worker.ctx;
+    mp_thread_set_state(&rp2_worker.ctx.thread);
+    mp_stack_set_top(rp2_worker.stack + rp2_worker.stack_size / sizeof(uint32_t));
+    mp_stack_set_limit(rp2_worker.stack_size - 512);
+    gc_init(rp2_worker.heap, rp2_worker.heap + rp2_worker.heap_size);
+    mp_init();
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_store_global(MP_QSTR_worker, MP_OBJ_FROM_PTR(&rp2_worker_obj[1]));
+        mp_lexer_t *lex = mp_lexer_new_from_str_len(MP_QSTR__lt_worker_gt_, rp2_worker.source, rp2_worker.source_len, 0);
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_obj_t module_fun = mp_compile(&parse_tree, source_name, false);
+        mp_call_function_0(module_fun);
+        nlr_pop();
+    } else {
+        mp_obj_t exc = MP_OBJ_FROM_PTR(nlr.ret_val);
+        if (!mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(mp_obj_get_type(exc)), MP_OBJ_FROM_PTR(&mp_type_SystemExit))) {
+            mp_obj_print_exception(&mp_plat_print, exc);
+        }
+    }
+
+    gc_sweep_all();
+    mp_deinit();
+    rp2_state_ctx_ptr[1] = &mp_state_ctx;
+    __dmb();
+    rp2_worker.running = false;
+    __sev();
+}
+
+STATIC mp_obj_t rp2_worker_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_source, ARG_heap, ARG_stack };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_source, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_heap, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 16384} },
+        { MP_QSTR_stack, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 4096} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    // Only one interpreter can run on core1, and not while it runs a thread.
+    if (rp2_worker.running || mp_thread_core1_in_use()) {
+        mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("core1 in use"));
+    }
+
+    size_t source_len;
+    const char *source = mp_obj_str_get_data(args[ARG_source].u_obj, &source_len);
+    size_t stack_size = MAX(args[ARG_stack].u_int, 2048) & ~(sizeof(uint32_t) - 1);
+    size_t heap_size = MAX(args[ARG_heap].u_int, 4096) & ~(sizeof(uint32_t) - 1);
+
+    // Free the memory of any previous worker before taking a new partition of
+    // the heap for this one's stack, heap and copy of the source.
+    MP_STATE_PORT(rp2_worker_mem) = NULL;
+    uint8_t *mem = m_new(uint8_t, stack_size + heap_size + source_len);
+    MP_STATE_PORT(rp2_worker_mem) = mem;
+    rp2_worker.stack = (uint32_t *)mem;
+    rp2_worker.stack_size = stack_size;
+    rp2_worker.heap = mem + stack_size;
+    rp2_worker.heap_size = heap_size;
+    memcpy(mem + stack_size + heap_size, source, source_len);
+    rp2_worker.source = (const char *)mem + stack_size + heap_size;
+    rp2_worker.source_len = source_len;
+
+    memset(&rp2_worker.ctx, 0, sizeof(rp2_worker.ctx));
+    for (size_t i = 0; i < 2; ++i) {
+        rp2_worker.ring[i].head = 0;
+        rp2_worker.ring[i].tail = 0;
+    }
+    rp2_worker.running = true;
+
+    // Calls to mp_thread_create check rp2_worker_running to keep off core1.
+    multicore_reset_core1();
+    multicore_launch_core1_with_stack(rp2_worker_entry, rp2_worker.stack, stack_size);
+
+    return MP_OBJ_FROM_PTR(&rp2_worker_obj[0]);
+}
+
+// send(buf, block=True)
+STATIC mp_obj_t rp2_worker_send(size_t n_args, const mp_obj_t *args) {
+    const rp2_worker_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_READ);
+    bool block = n_args < 3 || mp_obj_is_true(args[2]);
+    if (bufinfo.len > RING_SIZE - MSG_HEADER_LEN) {
+        mp_raise_ValueError(MP_ERROR_TEXT("message too long"));
+    }
+
+    rp2_worker_ring_t *ring = &rp2_worker.ring[self->end];
+    size_t needed = MSG_HEADER_LEN + bufinfo.len;
+    while (RING_SIZE - (ring->head - ring->tail) < needed) {
+        if (!block || !rp2_worker_peer_alive(self)) {
+            return mp_const_false;
+        }
+        MICROPY_EVENT_POLL_HOOK
+    }
+
+    uint32_t head = ring->head;
+    uint8_t header[MSG_HEADER_LEN] = { bufinfo.len & 0xff, bufinfo.len >> 8 };
+    ring_copy_in(ring, head, header, MSG_HEADER_LEN);
+    ring_copy_in(ring, head + MSG_HEADER_LEN, bufinfo.buf, bufinfo.len);
+    // The data must be visible to the other core before the new head is.
+    __dmb();
+    ring->head = head + needed;
+    __sev();
+
+    return mp_const_true;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(rp2_worker_send_obj, 2, 3, rp2_worker_send);
+
+// recv(block=True)
+STATIC mp_obj_t rp2_worker_recv(size_t n_args, const mp_obj_t *args) {
+    const rp2_worker_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    bool block = n_args < 2 || mp_obj_is_true(args[1]);
+
+    rp2_worker_ring_t *ring = &rp2_worker.ring[self->end ^ 1];
+    while (ring->head == ring->tail) {
+        if (!block || !rp2_worker_peer_alive(self)) {
+            return mp_const_none;
+        }
+        MICROPY_EVENT_POLL_HOOK
+    }
+    // Read the data only after seeing the head that published it.
+    __dmb();
+
+    uint32_t tail = ring->tail;
+    uint8_t header[MSG_HEADER_LEN];
+    ring_copy_out(ring, tail, header, MSG_HEADER_LEN);
+    size_t len = header[0] | header[1] << 8;
+    vstr_t vstr;
+    vstr_init_len(&vstr, len);
+    ring_copy_out(ring, tail + MSG_HEADER_LEN, (uint8_t *)vstr.buf, len);
+    // Finish reading before the producer may reuse the space.
+    __dmb();
+    ring->tail = tail + MSG_HEADER_LEN + len;
+    __sev();
+
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(rp2_worker_recv_obj, 1, 2, rp2_worker_recv);
+
+STATIC mp_obj_t rp2_worker_any(mp_obj_t self_in) {
+    const rp2_worker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    rp2_worker_ring_t *ring = &rp2_worker.ring[self->end ^ 1];
+    return mp_obj_new_bool(ring->head != ring->tail);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(rp2_worker_any_obj, rp2_worker_any);
+
+STATIC mp_obj_t rp2_worker_is_running(mp_obj_t self_in) {
+    (void)self_in;
+    return mp_obj_new_bool(rp2_worker.running);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(rp2_worker_running_obj, rp2_worker_is_running);
+
+// join(timeout_ms=-1)
+STATIC mp_obj_t rp2_worker_join(size_t n_args, const mp_obj_t *args) {
+    const rp2_worker_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (self->end != 0) {
+        mp_raise_ValueError(NULL);
+    }
+    mp_int_t timeout_ms = n_args < 2 ? -1 : mp_obj_get_int(args[1]);
+    mp_uint_t start = mp_hal_ticks_ms();
+    while (rp2_worker.running) {
+        if (timeout_ms >= 0 && mp_hal_ticks_ms() - start >= (mp_uint_t)timeout_ms) {
+            return mp_const_false;
+        }
+        MICROPY_EVENT_POLL_HOOK
+    }
+    return mp_const_true;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(rp2_worker_join_obj, 1, 2, rp2_worker_join);
+
+// Raise KeyboardInterrupt in the worker, as Ctrl-C does for the main interpreter.
+STATIC mp_obj_t rp2_worker_stop(mp_obj_t self_in) {
+    const rp2_worker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->end != 0) {
+        mp_raise_ValueError(NULL);
+    }
+    if (rp2_worker.running) {
+        mp_state_ctx_t *ctx = &rp2_worker.ctx;
+        ctx->vm.mp_kbd_exception.traceback_data = NULL;
+        ctx->thread.mp_pending_exception = MP_OBJ_FROM_PTR(&ctx->vm.mp_kbd_exception);
+        #if MICROPY_ENABLE_SCHEDULER
+        if (ctx->vm.sched_state == MP_SCHED_IDLE) {
+            ctx->vm.sched_state = MP_SCHED_PENDING;
+        }
+        #endif
+        __sev();
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(rp2_worker_stop_obj, rp2_worker_stop);
+
+STATIC const mp_rom_map_elem_t rp2_worker_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&rp2_worker_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recv), MP_ROM_PTR(&rp2_worker_recv_obj) },
+    { MP_ROM_QSTR(MP_QSTR_any), MP_ROM_PTR(&rp2_worker_any_obj) },
+    { MP_ROM_QSTR(MP_QSTR_running), MP_ROM_PTR(&rp2_worker_running_obj) },
+    { MP_ROM_QSTR(MP_QSTR_join), MP_ROM_PTR(&rp2_worker_join_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&rp2_worker_stop_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(rp2_worker_locals_dict, rp2_worker_locals_dict_table);
+
+const mp_obj_type_t rp2_worker_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Worker,
+    .make_new = rp2_worker_make_new,
+    .locals_dict = (mp_obj_dict_t *)&rp2_worker_locals_dict,
+};
+
+#endif // MICROPY_PY_RP2_WORKER
@@ -0,0 +1,240 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "py/mphal.h"
+#include "py/mperrno.h"
+#include "extmod/machine_i2c.h"
+#include "modmachine.h"
+#include "samd_sercom.h"
+
+#define DEFAULT_I2C_FREQ    (400000)
+#define DEFAULT_I2C_TIMEOUT (50) // ms
+
+// Bus commands written to CTRLB.CMD.
+#define I2C_CMD_READ        (2) // ACK (or NACK, per ACKACT) and read the next byte
+#define I2C_CMD_STOP        (3) // ACK (or NACK, per ACKACT) and send a stop condition
+
+typedef struct _machine_i2c_obj_t {
+    mp_obj_base_t base;
+    Sercom *instance;
+    uint8_t id;
+    uint8_t scl;
+    uint8_t sda;
+    uint16_t timeout;
+    uint32_t freq;
+} machine_i2c_obj_t;
+
+STATIC void machine_i2c_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    machine_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "I2C(%u, freq=%u, scl=%u, sda=%u)",
+        self->id, self->freq, self->scl, self->sda);
+}
+
+STATIC void machine_i2c_sync(Sercom *i2c) {
+    while (i2c->I2CM.SYNCBUSY.bit.SYSOP) {
+    }
+}
+
+STATIC mp_obj_t machine_i2c_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_id, ARG_freq, ARG_scl, ARG_sda, ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_id, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_freq, MP_ARG_INT, {.u_int = DEFAULT_I2C_FREQ} },
+        { MP_QSTR_scl, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_sda, MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = DEFAULT_I2C_TIMEOUT} },
+    };
+
+    // Parse args.
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    // The I2C bus id is the number of the SERCOM.
+    int id = args[ARG_id].u_int;
+    Sercom *i2c = sercom_get_instance(id);
+
+    // SDA must be on pad 0 and SCL on pad 1.
+    mp_hal_pin_obj_t scl = mp_hal_get_pin_obj(args[ARG_scl].u_obj);
+    mp_hal_pin_obj_t sda = mp_hal_get_pin_obj(args[ARG_sda].u_obj);
+    if (sercom_pin_pad(scl, id) != 1) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad SCL pin"));
+    }
+    if (sercom_pin_pad(sda, id) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad SDA pin"));
+    }
+    mp_int_t freq = args[ARG_freq].u_int;
+    if (freq <= 0 || freq > 1000000) {
+        mp_raise_ValueError(MP_ERROR_TEXT("freq out of range"));
+    }
+
+    machine_i2c_obj_t *self = mp_obj_malloc(machine_i2c_obj_t, &machine_i2c_type);
+    self->instance = i2c;
+    self->id = id;
+    self->scl = scl;
+    self->sda = sda;
+    self->timeout = args[ARG_timeout].u_int;
+
+    // SCL runs at GCLK0 / (2 * (BAUD + 5)), ignoring the rise time.
+    uint32_t baud = CPU_FREQ / (2 * freq);
+    baud = baud > 5 + 255 ? 255 : baud > 6 ? baud - 5 : 1;
+    self->freq = CPU_FREQ / (2 * (baud + 5));
+
+    sercom_enable(id);
+    i2c->I2CM.CTRLA.bit.ENABLE = 0;
+    while (i2c->I2CM.SYNCBUSY.bit.ENABLE) {
+    }
+    i2c->I2CM.CTRLA.reg = SERCOM_I2CM_CTRLA_SWRST;
+    while (i2c->I2CM.SYNCBUSY.bit.SWRST) {
+    }
+    i2c->I2CM.CTRLA.reg = SERCOM_I2CM_CTRLA_MODE(5) // I2C master
+        | SERCOM_I2CM_CTRLA_SDAHOLD(2) // 300-600ns
+        | SERCOM_I2CM_CTRLA_SPEED(freq > 400000 ? 1 : 0);
+    i2c->I2CM.BAUD.reg = SERCOM_I2CM_BAUD_BAUD(baud);
+    i2c->I2CM.CTRLA.bit.ENABLE = 1;
+    while (i2c->I2CM.SYNCBUSY.bit.ENABLE) {
+    }
+
+    // The bus state is unknown after reset, force it to idle.
+    i2c->I2CM.STATUS.reg = SERCOM_I2CM_STATUS_BUSSTATE(1);
+    machine_i2c_sync(i2c);
+
+    sercom_pin_connect(scl, id);
+    sercom_pin_connect(sda, id);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Wait for the master (MB) or slave (SB) on bus flag, which is how the I2CM
+// signals the end of each byte, and check for errors.
+STATIC int machine_i2c_wait(machine_i2c_obj_t *self) {
+    Sercom *i2c = self->instance;
+    uint32_t t0 = mp_hal_ticks_ms();
+    while (!(i2c->I2CM.INTFLAG.reg & (SERCOM_I2CM_INTFLAG_MB | SERCOM_I2CM_INTFLAG_SB))) {
+        if (mp_hal_ticks_ms() - t0 > self->timeout) {
+            return -MP_ETIMEDOUT;
+        }
+    }
+    if (i2c->I2CM.STATUS.reg & (SERCOM_I2CM_STATUS_BUSERR | SERCOM_I2CM_STATUS_ARBLOST)) {
+        return -MP_EIO;
+    }
+    return 0;
+}
+
+STATIC void machine_i2c_command(Sercom *i2c, bool nack, uint32_t cmd) {
+    i2c->I2CM.CTRLB.reg = (nack ? SERCOM_I2CM_CTRLB_ACKACT : 0) | SERCOM_I2CM_CTRLB_CMD(cmd);
+    machine_i2c_sync(i2c);
+}
+
+STATIC int machine_i2c_transfer_single(mp_obj_base_t *self_in, uint16_t addr, size_t len, uint8_t *buf, unsigned int flags) {
+    machine_i2c_obj_t *self = (machine_i2c_obj_t *)self_in;
+    Sercom *i2c = self->instance;
+    bool read = flags & MP_MACHINE_I2C_FLAG_READ;
+    int ret;
+
+    // Clear any previous errors, and ACK the bytes that are read.
+    i2c->I2CM.STATUS.reg = SERCOM_I2CM_STATUS_BUSERR | SERCOM_I2CM_STATUS_ARBLOST;
+    machine_i2c_sync(i2c);
+    i2c->I2CM.CTRLB.reg = 0;
+    machine_i2c_sync(i2c);
+
+    // Send a (repeated) start condition and the address.
+    i2c->I2CM.ADDR.reg = addr << 1 | read;
+    machine_i2c_sync(i2c);
+    ret = machine_i2c_wait(self);
+    if (ret < 0) {
+        goto stop;
+    }
+    if (i2c->I2CM.INTFLAG.bit.MB && i2c->I2CM.STATUS.bit.RXNACK) {
+        ret = -MP_ENODEV;
+        goto stop;
+    }
+
+    if (read) {
+        // Each byte is on the bus (SB) when it's received, and is then
+        // acknowledged by the command that reads the next byte.  The last byte
+        // is not acknowledged.
+        for (size_t i = 0; i < len; ++i) {
+            if (i > 0) {
+                ret = machine_i2c_wait(self);
+                if (ret < 0) {
+                    goto stop;
+                }
+            }
+            buf[i] = i2c->I2CM.DATA.reg;
+            machine_i2c_sync(i2c);
+            if (i + 1 < len) {
+                machine_i2c_command(i2c, false, I2C_CMD_READ);
+            }
+        }
+        if (flags & MP_MACHINE_I2C_FLAG_STOP) {
+            machine_i2c_command(i2c, true, I2C_CMD_STOP);
+        } else {
+            // The NACK is sent with the next repeated start.
+            i2c->I2CM.CTRLB.reg = SERCOM_I2CM_CTRLB_ACKACT;
+            machine_i2c_sync(i2c);
+        }
+        return len;
+    }
+
+    // Write the data, and return the number of bytes that were acknowledged.
+    for (ret = 0; (size_t)ret < len; ++ret) {
+        i2c->I2CM.DATA.reg = buf[ret];
+        machine_i2c_sync(i2c);
+        int err = machine_i2c_wait(self);
+        if (err < 0) {
+            ret = err;
+            goto stop;
+        }
+        if (i2c->I2CM.STATUS.bit.RXNACK) {
+            // Stop sending data when the device doesn't acknowledge a byte.
+            flags |= MP_MACHINE_I2C_FLAG_STOP;
+            break;
+        }
+    }
+    if (flags & MP_MACHINE_I2C_FLAG_STOP) {
+        machine_i2c_command(i2c, false, I2C_CMD_STOP);
+    }
+    return ret;
+
+stop:
+    machine_i2c_command(i2c, read, I2C_CMD_STOP);
+    return ret;
+}
+
+STATIC const mp_machine_i2c_p_t machine_i2c_p = {
+    .transfer = mp_machine_i2c_transfer_adaptor,
+    .transfer_single = machine_i2c_transfer_single,
+};
+
+const mp_obj_type_t machine_i2c_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_I2C,
+    .print = machine_i2c_print,
+    .make_new = machine_i2c_make_new,
+    .protocol = &machine_i2c_p,
+    .locals_dict = (mp_obj_dict_t *)&mp_machine_i2c_locals_dict,
+};
@@ -0,0 +1,339 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "py/mphal.h"
+#include "extmod/machine_spi.h"
+#include "modmachine.h"
+#include "samd_dma.h"
+#include "samd_sercom.h"
+
+#define DEFAULT_SPI_BAUDRATE    (1000000)
+#define DEFAULT_SPI_POLARITY    (0)
+#define DEFAULT_SPI_PHASE       (0)
+#define DEFAULT_SPI_BITS        (8)
+#define DEFAULT_SPI_FIRSTBIT    (MICROPY_PY_MACHINE_SPI_MSB)
+
+// Use DMA for transfers of at least this many bytes, if channels are available
+#define DMA_MIN_SIZE_THRESHOLD  (16)
+
+typedef struct _machine_spi_obj_t {
+    mp_obj_base_t base;
+    Sercom *instance;
+    uint8_t id;
+    uint8_t polarity;
+    uint8_t phase;
+    uint8_t firstbit;
+    uint8_t sck;
+    uint8_t mosi;
+    uint8_t miso;
+    uint8_t dopo;
+    uint8_t dipo;
+    int8_t dma_tx; // DMA channels of a transfer in progress, or -1
+    int8_t dma_rx;
+    uint8_t dma_dummy; // receives data for write-only transfers
+    uint32_t baudrate;
+} machine_spi_obj_t;
+
+STATIC void machine_spi_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    machine_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "SPI(%u, baudrate=%u, polarity=%u, phase=%u, bits=8, firstbit=%u, sck=%u, mosi=%u, miso=%u)",
+        self->id, self->baudrate, self->polarity, self->phase, self->firstbit,
+        self->sck, self->mosi, self->miso);
+}
+
+// Get the data out pinout (DOPO) for the pads of MOSI and SCK, or -1 if the
+// SERCOM can't use that combination.
+STATIC int spi_dopo(int mosi_pad, int sck_pad) {
+    if (mosi_pad == 0 && sck_pad == 1) {
+        return 0;
+    }
+    if (mosi_pad == 3 && sck_pad == 1) {
+        return 2;
+    }
+    #if defined(MCU_SAMD21)
+    if (mosi_pad == 2 && sck_pad == 3) {
+        return 1;
+    }
+    if (mosi_pad == 0 && sck_pad == 3) {
+        return 3;
+    }
+    #endif
+    return -1;
+}
+
+STATIC void machine_spi_configure(machine_spi_obj_t *self) {
+    Sercom *spi = self->instance;
+
+    // The SPI clock is GCLK0 divided by 2 * (BAUD + 1).
+    uint32_t baud = CPU_FREQ / (2 * self->baudrate);
+    if (baud > 0) {
+        baud -= 1;
+    }
+    if (baud > 255) {
+        baud = 255;
+    }
+    self->baudrate = CPU_FREQ / (2 * (baud + 1));
+
+    spi->SPI.CTRLA.bit.ENABLE = 0;
+    while (spi->SPI.SYNCBUSY.bit.ENABLE) {
+    }
+    spi->SPI.CTRLA.reg = SERCOM_SPI_CTRLA_SWRST;
+    while (spi->SPI.SYNCBUSY.bit.SWRST) {
+    }
+    spi->SPI.CTRLA.reg = SERCOM_SPI_CTRLA_MODE(3) // SPI master
+        | SERCOM_SPI_CTRLA_DOPO(self->dopo)
+        | SERCOM_SPI_CTRLA_DIPO(self->dipo)
+        | (self->polarity ? SERCOM_SPI_CTRLA_CPOL : 0)
+        | (self->phase ? SERCOM_SPI_CTRLA_CPHA : 0)
+        | (self->firstbit == MICROPY_PY_MACHINE_SPI_LSB ? SERCOM_SPI_CTRLA_DORD : 0);
+    spi->SPI.CTRLB.reg = SERCOM_SPI_CTRLB_RXEN; // 8 bit characters
+    while (spi->SPI.SYNCBUSY.bit.CTRLB) {
+    }
+    spi->SPI.BAUD.reg = baud;
+    spi->SPI.CTRLA.bit.ENABLE = 1;
+    while (spi->SPI.SYNCBUSY.bit.ENABLE) {
+    }
+}
+
+STATIC void machine_spi_set_format(machine_spi_obj_t *self, mp_int_t polarity, mp_int_t phase, mp_int_t bits, mp_int_t firstbit) {
+    if (polarity != -1) {
+        self->polarity = polarity;
+    }
+    if (phase != -1) {
+        self->phase = phase;
+    }
+    if (bits != -1 && bits != 8) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits must be 8"));
+    }
+    if (firstbit != -1) {
+        self->firstbit = firstbit;
+    }
+}
+
+STATIC mp_obj_t machine_spi_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_id, ARG_baudrate, ARG_polarity, ARG_phase, ARG_bits, ARG_firstbit, ARG_sck, ARG_mosi, ARG_miso };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_id,       MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_baudrate, MP_ARG_INT, {.u_int = DEFAULT_SPI_BAUDRATE} },
+        { MP_QSTR_polarity, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = DEFAULT_SPI_POLARITY} },
+        { MP_QSTR_phase,    MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = DEFAULT_SPI_PHASE} },
+        { MP_QSTR_bits,     MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = DEFAULT_SPI_BITS} },
+        { MP_QSTR_firstbit, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = DEFAULT_SPI_FIRSTBIT} },
+        { MP_QSTR_sck,      MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_mosi,     MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_miso,     MP_ARG_KW_ONLY | MP_ARG_REQUIRED | MP_ARG_OBJ },
+    };
+
+    // Parse the arguments.
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    // The SPI bus id is the number of the SERCOM.
+    int id = args[ARG_id].u_int;
+    Sercom *instance = sercom_get_instance(id);
+
+    // Check that the pins connect to suitable pads of the SERCOM.
+    mp_hal_pin_obj_t sck = mp_hal_get_pin_obj(args[ARG_sck].u_obj);
+    mp_hal_pin_obj_t mosi = mp_hal_get_pin_obj(args[ARG_mosi].u_obj);
+    mp_hal_pin_obj_t miso = mp_hal_get_pin_obj(args[ARG_miso].u_obj);
+    int sck_pad = sercom_pin_pad(sck, id);
+    int mosi_pad = sercom_pin_pad(mosi, id);
+    int miso_pad = sercom_pin_pad(miso, id);
+    int dopo = spi_dopo(mosi_pad, sck_pad);
+    if (dopo < 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad SCK or MOSI pin"));
+    }
+    if (miso_pad < 0 || miso_pad == sck_pad || miso_pad == mosi_pad) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad MISO pin"));
+    }
+
+    machine_spi_obj_t *self = mp_obj_malloc(machine_spi_obj_t, &machine_spi_type);
+    self->instance = instance;
+    self->id = id;
+    self->sck = sck;
+    self->mosi = mosi;
+    self->miso = miso;
+    self->dopo = dopo;
+    self->dipo = miso_pad;
+    self->dma_tx = -1;
+    self->dma_rx = -1;
+    self->baudrate = args[ARG_baudrate].u_int;
+    machine_spi_set_format(self, args[ARG_polarity].u_int, args[ARG_phase].u_int,
+        args[ARG_bits].u_int, args[ARG_firstbit].u_int);
+
+    sercom_enable(id);
+    machine_spi_configure(self);
+    sercom_pin_connect(sck, id);
+    sercom_pin_connect(mosi, id);
+    sercom_pin_connect(miso, id);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC void machine_spi_init(mp_obj_base_t *self_in, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_baudrate, ARG_polarity, ARG_phase, ARG_bits, ARG_firstbit };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_baudrate, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_polarity, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_phase,    MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_bits,     MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_firstbit, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+    };
+
+    // Parse the arguments.
+    machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (args[ARG_baudrate].u_int != -1) {
+        self->baudrate = args[ARG_baudrate].u_int;
+    }
+    machine_spi_set_format(self, args[ARG_polarity].u_int, args[ARG_phase].u_int,
+        args[ARG_bits].u_int, args[ARG_firstbit].u_int);
+    machine_spi_configure(self);
+}
+
+STATIC void machine_spi_deinit(mp_obj_base_t *self_in) {
+    machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
+    self->instance->SPI.CTRLA.bit.ENABLE = 0;
+    gpio_set_pin_function(self->sck, GPIO_PIN_FUNCTION_OFF);
+    gpio_set_pin_function(self->mosi, GPIO_PIN_FUNCTION_OFF);
+    gpio_set_pin_function(self->miso, GPIO_PIN_FUNCTION_OFF);
+}
+
+// Start a DMA transfer, returning false if two DMA channels couldn't be claimed.
+// One channel feeds DATA on each DRE trigger and the other drains it on each
+// RXC trigger, so the bus runs back to back without the CPU.
+STATIC bool machine_spi_dma_start(machine_spi_obj_t *self, size_t len, const uint8_t *src, uint8_t *dest) {
+    if (len > DMA_MAX_TRANSFER) {
+        return false;
+    }
+    int chan_tx = dma_alloc_channel();
+    int chan_rx = dma_alloc_channel();
+    if (chan_tx < 0 || chan_rx < 0) {
+        if (chan_rx >= 0) {
+            dma_free_channel(chan_rx);
+        }
+        if (chan_tx >= 0) {
+            dma_free_channel(chan_tx);
+        }
+        return false;
+    }
+
+    Sercom *spi = self->instance;
+    while (spi->SPI.INTFLAG.bit.RXC) {
+        (void)spi->SPI.DATA.reg;
+    }
+
+    // Start receiving before sending so that no byte is missed.
+    bool write_only = dest == NULL;
+    dma_start(chan_rx, sercom_dma_trigger_rx(self->id), &spi->SPI.DATA.reg, false,
+        write_only ? &self->dma_dummy : dest, !write_only, len);
+    dma_start(chan_tx, sercom_dma_trigger_tx(self->id), src, true, &spi->SPI.DATA.reg, false, len);
+
+    self->dma_tx = chan_tx;
+    self->dma_rx = chan_rx;
+    return true;
+}
+
+// Check for the end of a DMA transfer, releasing the channels once it's done.
+STATIC bool machine_spi_transfer_busy(mp_obj_base_t *self_in) {
+    machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
+    if (self->dma_rx < 0) {
+        return false;
+    }
+    // The last byte is received after it has been sent, so the RX channel
+    // finishes last.
+    if (dma_busy(self->dma_rx)) {
+        return true;
+    }
+    dma_free_channel(self->dma_rx);
+    dma_free_channel(self->dma_tx);
+    self->dma_rx = -1;
+    self->dma_tx = -1;
+    return false;
+}
+
+STATIC void machine_spi_transfer_blocking(machine_spi_obj_t *self, size_t len, const uint8_t *src, uint8_t *dest) {
+    Sercom *spi = self->instance;
+    while (spi->SPI.INTFLAG.bit.RXC) {
+        (void)spi->SPI.DATA.reg;
+    }
+    for (size_t i = 0; i < len; ++i) {
+        while (!spi->SPI.INTFLAG.bit.DRE) {
+        }
+        spi->SPI.DATA.reg = src[i];
+        while (!spi->SPI.INTFLAG.bit.RXC) {
+        }
+        uint8_t data = spi->SPI.DATA.reg;
+        if (dest != NULL) {
+            dest[i] = data;
+        }
+    }
+}
+
+STATIC void machine_spi_transfer(mp_obj_base_t *self_in, size_t len, const uint8_t *src, uint8_t *dest) {
+    machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
+    while (len > 0) {
+        size_t n = MIN(len, DMA_MAX_TRANSFER);
+        if (n >= DMA_MIN_SIZE_THRESHOLD && machine_spi_dma_start(self, n, src, dest)) {
+            while (machine_spi_transfer_busy(self_in)) {
+            }
+        } else {
+            machine_spi_transfer_blocking(self, n, src, dest);
+        }
+        len -= n;
+        src += n;
+        if (dest != NULL) {
+            dest += n;
+        }
+    }
+}
+
+STATIC void machine_spi_transfer_start(mp_obj_base_t *self_in, size_t len, const uint8_t *src, uint8_t *dest) {
+    machine_spi_obj_t *self = (machine_spi_obj_t *)self_in;
+    if (len < DMA_MIN_SIZE_THRESHOLD || !machine_spi_dma_start(self, len, src, dest)) {
+        machine_spi_transfer(self_in, len, src, dest);
+    }
+}
+
+STATIC const mp_machine_spi_p_t machine_spi_p = {
+    .init = machine_spi_init,
+    .deinit = machine_spi_deinit,
+    .transfer = machine_spi_transfer,
+    .transfer_start = machine_spi_transfer_start,
+    .transfer_busy = machine_spi_transfer_busy,
+};
+
+const mp_obj_type_t machine_spi_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_SPI,
+    .print = machine_spi_print,
+    .make_new = machine_spi_make_new,
+    .protocol = &machine_spi_p,
+    .locals_dict = (mp_obj_dict_t *)&mp_machine_spi_locals_dict,
+};
@@ -0,0 +1,425 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "py/mphal.h"
+#include "py/mperrno.h"
+#include "py/ringbuf.h"
+#include "modmachine.h"
+#include "samd_dma.h"
+#include "samd_sercom.h"
+
+#define DEFAULT_UART_BAUDRATE (115200)
+#define DEFAULT_UART_BITS (8)
+#define DEFAULT_UART_STOP (1)
+#define DEFAULT_BUFFER_SIZE (256)
+#define MIN_BUFFER_SIZE  (32)
+#define MAX_BUFFER_SIZE  (32766)
+
+// Use DMA for writes of at least this many bytes, if a channel is available
+#define DMA_MIN_SIZE_THRESHOLD (16)
+
+#define UART_PARITY_NONE (0xff)
+
+typedef struct _machine_uart_obj_t {
+    mp_obj_base_t base;
+    Sercom *instance;
+    uint8_t id;
+    uint8_t tx;
+    uint8_t rx;
+    uint8_t txpo;
+    uint8_t rxpo;
+    uint8_t bits;
+    uint8_t parity;
+    uint8_t stop;
+    uint32_t baudrate;
+    uint16_t timeout;       // timeout waiting for first char (in ms)
+    uint16_t timeout_char;  // timeout waiting between chars (in ms)
+    ringbuf_t read_buffer;
+} machine_uart_obj_t;
+
+STATIC const char *_parity_name[] = {"0", "1"};
+
+/******************************************************************************/
+// IRQ and buffer handling
+
+// Move received characters to the buffer, dropping them if it is full.
+STATIC void machine_uart_irq_handler(int sercom_id) {
+    machine_uart_obj_t *self = MP_STATE_PORT(sercom_table[sercom_id]);
+    if (self == NULL) {
+        return;
+    }
+    Sercom *uart = self->instance;
+    while (uart->USART.INTFLAG.bit.RXC) {
+        uint8_t c = uart->USART.DATA.reg;
+        ringbuf_put(&self->read_buffer, c);
+    }
+    // Clear frame, parity and overflow errors.
+    uart->USART.STATUS.reg = SERCOM_USART_STATUS_FERR | SERCOM_USART_STATUS_PERR | SERCOM_USART_STATUS_BUFOVF;
+}
+
+/******************************************************************************/
+// MicroPython bindings for UART
+
+STATIC void machine_uart_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    machine_uart_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "UART(%u, baudrate=%u, bits=%u, parity=%s, stop=%u, tx=%u, rx=%u, timeout=%u, timeout_char=%u, rxbuf=%d)",
+        self->id, self->baudrate, self->bits,
+        self->parity == UART_PARITY_NONE ? "None" : _parity_name[self->parity],
+        self->stop, self->tx, self->rx, self->timeout, self->timeout_char, self->read_buffer.size - 1);
+}
+
+STATIC void machine_uart_configure(machine_uart_obj_t *self) {
+    Sercom *uart = self->instance;
+
+    // Disable the interrupt while the SERCOM and the buffer change.
+    sercom_set_irq_handler(self->id, NULL);
+
+    uart->USART.CTRLA.bit.ENABLE = 0;
+    while (uart->USART.SYNCBUSY.bit.ENABLE) {
+    }
+    uart->USART.CTRLA.reg = SERCOM_USART_CTRLA_SWRST;
+    while (uart->USART.SYNCBUSY.bit.SWRST) {
+    }
+    uart->USART.CTRLA.reg = SERCOM_USART_CTRLA_DORD // LSB first
+        | SERCOM_USART_CTRLA_RXPO(self->rxpo)
+        | SERCOM_USART_CTRLA_TXPO(self->txpo)
+        | SERCOM_USART_CTRLA_MODE(1) // USART with internal clock
+        | SERCOM_USART_CTRLA_FORM(self->parity == UART_PARITY_NONE ? 0 : 1);
+    uart->USART.CTRLB.reg = SERCOM_USART_CTRLB_RXEN | SERCOM_USART_CTRLB_TXEN
+        | SERCOM_USART_CTRLB_CHSIZE(self->bits & 7) // 8 bits is 0
+        | (self->stop == 2 ? SERCOM_USART_CTRLB_SBMODE : 0)
+        | (self->parity == 1 ? SERCOM_USART_CTRLB_PMODE : 0);
+    while (uart->USART.SYNCBUSY.bit.CTRLB) {
+    }
+    // Arithmetic baud rate with 16x oversampling: 65536 * (1 - 16 * baudrate / GCLK0).
+    uart->USART.BAUD.reg = 65536 - ((uint64_t)65536 * 16 * self->baudrate + CPU_FREQ / 2) / CPU_FREQ;
+    uart->USART.INTENSET.reg = SERCOM_USART_INTENSET_RXC;
+    uart->USART.CTRLA.bit.ENABLE = 1;
+    while (uart->USART.SYNCBUSY.bit.ENABLE) {
+    }
+
+    sercom_set_irq_handler(self->id, machine_uart_irq_handler);
+}
+
+// Check the pins and connect them to the SERCOM.
+STATIC void machine_uart_set_pins(machine_uart_obj_t *self, mp_obj_t tx_in, mp_obj_t rx_in) {
+    // TX must be on pad 0 (or pad 2 on the SAMD21), RX on any other pad.
+    mp_hal_pin_obj_t tx = mp_hal_get_pin_obj(tx_in);
+    mp_hal_pin_obj_t rx = mp_hal_get_pin_obj(rx_in);
+    int tx_pad = sercom_pin_pad(tx, self->id);
+    int rx_pad = sercom_pin_pad(rx, self->id);
+    #if defined(MCU_SAMD21)
+    if (tx_pad != 0 && tx_pad != 2) {
+    #else
+    if (tx_pad != 0) {
+    #endif
+        mp_raise_ValueError(MP_ERROR_TEXT("bad TX pin"));
+    }
+    if (rx_pad < 0 || rx_pad == tx_pad) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad RX pin"));
+    }
+    self->tx = tx;
+    self->rx = rx;
+    self->txpo = tx_pad >> 1;
+    self->rxpo = rx_pad;
+    sercom_pin_connect(tx, self->id);
+    sercom_pin_connect(rx, self->id);
+}
+
+STATIC void machine_uart_init_helper(machine_uart_obj_t *self, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_baudrate, ARG_bits, ARG_parity, ARG_stop, ARG_tx, ARG_rx, ARG_timeout, ARG_timeout_char, ARG_rxbuf };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_baudrate, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_bits, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_parity, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_INT(-1)} },
+        { MP_QSTR_stop, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_tx, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_rx, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_timeout_char, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_rxbuf, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
+    };
+
+    // Parse args.
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    // Set baudrate if configured.
+    if (args[ARG_baudrate].u_int > 0) {
+        if (args[ARG_baudrate].u_int * 16 > CPU_FREQ) {
+            mp_raise_ValueError(MP_ERROR_TEXT("baudrate too high"));
+        }
+        self->baudrate = args[ARG_baudrate].u_int;
+    }
+
+    // Set bits if configured.
+    if (args[ARG_bits].u_int > 0) {
+        if (args[ARG_bits].u_int < 5 || args[ARG_bits].u_int > 8) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid data bits"));
+        }
+        self->bits = args[ARG_bits].u_int;
+    }
+
+    // Set parity if configured.
+    if (args[ARG_parity].u_obj != MP_OBJ_NEW_SMALL_INT(-1)) {
+        if (args[ARG_parity].u_obj == mp_const_none) {
+            self->parity = UART_PARITY_NONE;
+        } else {
+            self->parity = mp_obj_get_int(args[ARG_parity].u_obj) & 1;
+        }
+    }
+
+    // Set stop bits if configured.
+    if (args[ARG_stop].u_int > 0) {
+        if (args[ARG_stop].u_int > 2) {
+            mp_raise_ValueError(MP_ERROR_TEXT("invalid stop bits"));
+        }
+        self->stop = args[ARG_stop].u_int;
+    }
+
+    // Set the pins if configured; they must be given the first time.
+    if (args[ARG_tx].u_obj != mp_const_none || args[ARG_rx].u_obj != mp_const_none) {
+        if (args[ARG_tx].u_obj == mp_const_none || args[ARG_rx].u_obj == mp_const_none) {
+            mp_raise_ValueError(MP_ERROR_TEXT("tx and rx pins must be given together"));
+        }
+        machine_uart_set_pins(self, args[ARG_tx].u_obj, args[ARG_rx].u_obj);
+    } else if (self->read_buffer.buf == NULL) {
+        mp_raise_ValueError(MP_ERROR_TEXT("tx and rx pins must be given"));
+    }
+
+    // Set timeout if configured.
+    if (args[ARG_timeout].u_int >= 0) {
+        self->timeout = args[ARG_timeout].u_int;
+    }
+
+    // Set timeout_char if configured.
+    if (args[ARG_timeout_char].u_int >= 0) {
+        self->timeout_char = args[ARG_timeout_char].u_int;
+    }
+
+    // Make sure timeout_char is at least as long as a whole character (13 bits to be safe).
+    uint32_t min_timeout_char = 13000 / self->baudrate + 1;
+    if (self->timeout_char < min_timeout_char) {
+        self->timeout_char = min_timeout_char;
+    }
+
+    // Allocate the RX buffer if a size is given, or it has none yet.
+    if (args[ARG_rxbuf].u_int >= 0 || self->read_buffer.buf == NULL) {
+        size_t rxbuf_len = DEFAULT_BUFFER_SIZE;
+        if (args[ARG_rxbuf].u_int >= 0) {
+            rxbuf_len = MAX(MIN_BUFFER_SIZE, MIN(args[ARG_rxbuf].u_int, MAX_BUFFER_SIZE));
+        }
+        sercom_set_irq_handler(self->id, NULL);
+        ringbuf_alloc(&self->read_buffer, rxbuf_len + 1);
+    }
+
+    machine_uart_configure(self);
+    MP_STATE_PORT(sercom_table[self->id]) = self;
+}
+
+STATIC mp_obj_t machine_uart_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, MP_OBJ_FUN_ARGS_MAX, true);
+
+    // The UART id is the number of the SERCOM.
+    int id = mp_obj_get_int(args[0]);
+    Sercom *instance = sercom_get_instance(id);
+
+    // Reuse the UART object of the SERCOM, if there is one.
+    machine_uart_obj_t *self = MP_STATE_PORT(sercom_table[id]);
+    if (self == NULL) {
+        self = m_new0(machine_uart_obj_t, 1);
+        self->base.type = &machine_uart_type;
+        self->instance = instance;
+        self->id = id;
+        self->baudrate = DEFAULT_UART_BAUDRATE;
+        self->bits = DEFAULT_UART_BITS;
+        self->parity = UART_PARITY_NONE;
+        self->stop = DEFAULT_UART_STOP;
+        sercom_enable(id);
+    }
+
+    // Initialise the UART peripheral.
+    mp_map_t kw_args;
+    mp_map_init_fixed_table(&kw_args, n_kw, args + n_args);
+    machine_uart_init_helper(self, n_args - 1, args + 1, &kw_args);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// uart.init(baudrate, bits, parity, stop, *, tx, rx, timeout, timeout_char, rxbuf)
+STATIC mp_obj_t machine_uart_obj_init(size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    machine_uart_init_helper(args[0], n_args - 1, args + 1, kw_args);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(machine_uart_obj_init_obj, 1, machine_uart_obj_init);
+
+STATIC void machine_uart_deinit_helper(machine_uart_obj_t *self) {
+    sercom_set_irq_handler(self->id, NULL);
+    self->instance->USART.CTRLA.bit.ENABLE = 0;
+    gpio_set_pin_function(self->tx, GPIO_PIN_FUNCTION_OFF);
+    gpio_set_pin_function(self->rx, GPIO_PIN_FUNCTION_OFF);
+    MP_STATE_PORT(sercom_table[self->id]) = NULL;
+    if (self->instance == USARTx) {
+        // Give the REPL its UART back.
+        machine_uart_init();
+    }
+}
+
+STATIC mp_obj_t machine_uart_obj_deinit(mp_obj_t self_in) {
+    machine_uart_deinit_helper(MP_OBJ_TO_PTR(self_in));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(machine_uart_obj_deinit_obj, machine_uart_obj_deinit);
+
+// Release the UARTs on soft reset, before their buffers are freed.
+void machine_uart_deinit_all(void) {
+    for (size_t i = 0; i < SERCOM_INST_NUM; ++i) {
+        if (MP_STATE_PORT(sercom_table[i]) != NULL) {
+            machine_uart_deinit_helper(MP_STATE_PORT(sercom_table[i]));
+        }
+    }
+}
+
+STATIC mp_obj_t machine_uart_any(mp_obj_t self_in) {
+    machine_uart_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(ringbuf_avail(&self->read_buffer));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(machine_uart_any_obj, machine_uart_any);
+
+STATIC const mp_rom_map_elem_t machine_uart_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_init), MP_ROM_PTR(&machine_uart_obj_init_obj) },
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&machine_uart_obj_deinit_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_any), MP_ROM_PTR(&machine_uart_any_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(machine_uart_locals_dict, machine_uart_locals_dict_table);
+
+STATIC mp_uint_t machine_uart_read(mp_obj_t self_in, void *buf_in, mp_uint_t size, int *errcode) {
+    machine_uart_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint32_t t0 = mp_hal_ticks_ms();
+    uint32_t timeout = self->timeout;
+    uint8_t *dest = buf_in;
+
+    for (size_t i = 0; i < size; i++) {
+        // Wait for the first/next character
+        while (ringbuf_avail(&self->read_buffer) == 0) {
+            if (mp_hal_ticks_ms() - t0 > timeout) {  // timed out
+                if (i <= 0) {
+                    *errcode = MP_EAGAIN;
+                    return MP_STREAM_ERROR;
+                } else {
+                    return i;
+                }
+            }
+            MICROPY_EVENT_POLL_HOOK
+        }
+        *dest++ = ringbuf_get(&self->read_buffer);
+        t0 = mp_hal_ticks_ms();
+        timeout = self->timeout_char;
+    }
+    return size;
+}
+
+STATIC mp_uint_t machine_uart_write(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
+    machine_uart_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    Sercom *uart = self->instance;
+    const uint8_t *src = buf_in;
+    size_t len = size;
+
+    // Let the DMA feed long writes to DATA on each DRE trigger.  The buffer
+    // must stay valid until it's done, so wait for it without handling any
+    // pending exceptions.
+    int channel = -1;
+    if (len >= DMA_MIN_SIZE_THRESHOLD) {
+        channel = dma_alloc_channel();
+    }
+    if (channel >= 0) {
+        while (len > 0) {
+            size_t n = MIN(len, DMA_MAX_TRANSFER);
+            dma_start(channel, sercom_dma_trigger_tx(self->id), src, true, &uart->USART.DATA.reg, false, n);
+            while (dma_busy(channel)) {
+                __WFI();
+            }
+            src += n;
+            len -= n;
+        }
+        dma_free_channel(channel);
+    } else {
+        while (len--) {
+            while (!uart->USART.INTFLAG.bit.DRE) {
+            }
+            uart->USART.DATA.reg = *src++;
+        }
+    }
+
+    // Wait for the last character to be sent.
+    while (!uart->USART.INTFLAG.bit.TXC) {
+    }
+    return size;
+}
+
+STATIC mp_uint_t machine_uart_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    machine_uart_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_uint_t ret;
+    if (request == MP_STREAM_POLL) {
+        uintptr_t flags = arg;
+        ret = 0;
+        if ((flags & MP_STREAM_POLL_RD) && ringbuf_avail(&self->read_buffer) > 0) {
+            ret |= MP_STREAM_POLL_RD;
+        }
+        if ((flags & MP_STREAM_POLL_WR) && self->instance->USART.INTFLAG.bit.DRE) {
+            ret |= MP_STREAM_POLL_WR;
+        }
+    } else {
+        *errcode = MP_EINVAL;
+        ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
+STATIC const mp_stream_p_t uart_stream_p = {
+    .read = machine_uart_read,
+    .write = machine_uart_write,
+    .ioctl = machine_uart_ioctl,
+    .is_text = false,
+};
+
+const mp_obj_type_t machine_uart_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_UART,
+    .print = machine_uart_print,
+    .make_new = machine_uart_make_new,
+    .getiter = mp_identity_getiter,
+    .iternext = mp_stream_unbuffered_iter,
+    .protocol = &uart_stream_p,
+    .locals_dict = (mp_obj_dict_t *)&machine_uart_locals_dict,
+};
@@ -31,6 +31,7 @@
 #include "py/stackctrl.h"
 #include "shared/runtime/gchelper.h"
 #include "shared/runtime/pyexec.h"
+#include "modmachine.h"
 
 extern uint8_t _sstack, _estack, _sheap, _eheap;
 
@@ -62,6 +63,7 @@ void samd_main(void) {
         }
 
         mp_printf(MP_PYTHON_PRINTER, "MPY: soft reboot\n");
+        machine_uart_deinit_all();
         gc_sweep_all();
         mp_deinit();
     }
@@ -30,8 +30,12 @@
 
 extern const mp_obj_type_t machine_pin_type;
 extern const mp_obj_type_t machine_led_type;
+extern const mp_obj_type_t machine_i2c_type;
+extern const mp_obj_type_t machine_spi_type;
+extern const mp_obj_type_t machine_uart_type;
 
 mp_obj_t machine_uart_init(void);
 mp_obj_t machine_uart_deinit(void);
+void machine_uart_deinit_all(void);
 
 #endif // MICROPY_INCLUDED_SAMD_MODMACHINE_H
@@ -83,6 +83,8 @@
 // Extended modules
 #define MICROPY_PY_UTIME_MP_HAL             (1)
 #define MICROPY_PY_MACHINE                  (1)
+#define MICROPY_PY_MACHINE_I2C              (1)
+#define MICROPY_PY_MACHINE_SPI              (1)
 #define MICROPY_PY_UOS                      (1)
 #define MICROPY_READER_VFS                  (1)
 #define MICROPY_VFS                         (1)
@@ -100,7 +102,8 @@
 #define mp_type_textio mp_type_vfs_lfs1_textio
 
 #define MICROPY_PORT_ROOT_POINTERS \
-    const char *readline_hist[8];
+    const char *readline_hist[8]; \
+    void *sercom_table[SERCOM_INST_NUM];
 
 #define MP_STATE_PORT MP_STATE_VM
 
@@ -0,0 +1,111 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/mpconfig.h"
+#include "samd_soc.h"
+#include "samd_dma.h"
+
+// The DMAC reads the descriptors of the channels from RAM, and writes back the
+// state of a channel when it's suspended.  Both must be 128-bit aligned.
+STATIC DmacDescriptor dma_descriptor[DMA_CHANNELS] __attribute__((aligned(16)));
+STATIC DmacDescriptor dma_write_back[DMA_CHANNELS] __attribute__((aligned(16)));
+
+STATIC uint32_t dma_channels_used;
+
+STATIC void dma_init(void) {
+    #if defined(MCU_SAMD21)
+    PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+    PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+    #elif defined(MCU_SAMD51)
+    MCLK->AHBMASK.reg |= MCLK_AHBMASK_DMAC;
+    #endif
+    DMAC->CTRL.reg = 0;
+    DMAC->CTRL.reg = DMAC_CTRL_SWRST;
+    while (DMAC->CTRL.bit.SWRST) {
+    }
+    DMAC->BASEADDR.reg = (uint32_t)dma_descriptor;
+    DMAC->WRBADDR.reg = (uint32_t)dma_write_back;
+    DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xf);
+}
+
+// Claim a free DMA channel, returning -1 if there is none.  Channels are only
+// held for the duration of a transfer.
+int dma_alloc_channel(void) {
+    if (!DMAC->CTRL.bit.DMAENABLE) {
+        dma_init();
+    }
+    for (int channel = 0; channel < DMA_CHANNELS; ++channel) {
+        if (!(dma_channels_used & (1 << channel))) {
+            dma_channels_used |= 1 << channel;
+            return channel;
+        }
+    }
+    return -1;
+}
+
+void dma_free_channel(int channel) {
+    dma_channels_used &= ~(1 << channel);
+}
+
+// Move len bytes, one byte on each trigger from the peripheral.  The channel
+// disables itself when the transfer is complete.
+void dma_start(int channel, uint8_t trigger, const volatile void *src, bool src_inc, volatile void *dest, bool dest_inc, size_t len) {
+    DmacDescriptor *desc = &dma_descriptor[channel];
+    desc->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE
+        | (src_inc ? DMAC_BTCTRL_SRCINC : 0) | (dest_inc ? DMAC_BTCTRL_DSTINC : 0);
+    desc->BTCNT.reg = len;
+    // An incrementing address must point to the end of the buffer.
+    desc->SRCADDR.reg = (uint32_t)src + (src_inc ? len : 0);
+    desc->DSTADDR.reg = (uint32_t)dest + (dest_inc ? len : 0);
+    desc->DESCADDR.reg = 0;
+
+    #if defined(MCU_SAMD21)
+    DMAC->CHID.reg = DMAC_CHID_ID(channel);
+    DMAC->CHCTRLA.reg = 0;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+    while (DMAC->CHCTRLA.bit.SWRST) {
+    }
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_TRIGSRC(trigger) | DMAC_CHCTRLB_TRIGACT_BEAT;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_ENABLE;
+    #elif defined(MCU_SAMD51)
+    DmacChannel *ch = &DMAC->Channel[channel];
+    ch->CHCTRLA.reg = 0;
+    ch->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+    while (ch->CHCTRLA.bit.SWRST) {
+    }
+    ch->CHCTRLA.reg = DMAC_CHCTRLA_TRIGSRC(trigger) | DMAC_CHCTRLA_TRIGACT_BURST
+        | DMAC_CHCTRLA_BURSTLEN_SINGLE | DMAC_CHCTRLA_ENABLE;
+    #endif
+}
+
+bool dma_busy(int channel) {
+    #if defined(MCU_SAMD21)
+    DMAC->CHID.reg = DMAC_CHID_ID(channel);
+    return DMAC->CHCTRLA.bit.ENABLE;
+    #elif defined(MCU_SAMD51)
+    return DMAC->Channel[channel].CHCTRLA.bit.ENABLE;
+    #endif
+}
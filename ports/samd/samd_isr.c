@@ -114,12 +114,21 @@ const ISR isr_vector[] __attribute__((section(".isr_vector"))) = {
     0,
     #endif
     0,
+    #if defined(MCU_SAMD21)
+    &Sercom0_Handler, // line 9
+    &Sercom1_Handler,
+    &Sercom2_Handler,
+    &Sercom3_Handler,
+    &Sercom4_Handler,
+    &Sercom5_Handler,
+    #else
     0,
     0,
     0,
     0,
     0,
     0,
+    #endif
     0,
     0,
     0,
@@ -151,6 +160,40 @@ const ISR isr_vector[] __attribute__((section(".isr_vector"))) = {
     0,
     0,
     0,
+    #if defined(MCU_SAMD51)
+    &Sercom0_Handler, // line 46
+    &Sercom0_Handler,
+    &Sercom0_Handler,
+    &Sercom0_Handler,
+    &Sercom1_Handler, // line 50
+    &Sercom1_Handler,
+    &Sercom1_Handler,
+    &Sercom1_Handler,
+    &Sercom2_Handler, // line 54
+    &Sercom2_Handler,
+    &Sercom2_Handler,
+    &Sercom2_Handler,
+    &Sercom3_Handler, // line 58
+    &Sercom3_Handler,
+    &Sercom3_Handler,
+    &Sercom3_Handler,
+    &Sercom4_Handler, // line 62
+    &Sercom4_Handler,
+    &Sercom4_Handler,
+    &Sercom4_Handler,
+    &Sercom5_Handler, // line 66
+    &Sercom5_Handler,
+    &Sercom5_Handler,
+    &Sercom5_Handler,
+    &Sercom6_Handler, // line 70
+    &Sercom6_Handler,
+    &Sercom6_Handler,
+    &Sercom6_Handler,
+    &Sercom7_Handler, // line 74
+    &Sercom7_Handler,
+    &Sercom7_Handler,
+    &Sercom7_Handler,
+    #else
     0,
     0,
     0,
@@ -183,6 +226,7 @@ const ISR isr_vector[] __attribute__((section(".isr_vector"))) = {
     0,
     0,
     0,
+    #endif
     0,
     0,
     #if defined(MCU_SAMD51)
@@ -0,0 +1,300 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "samd_sercom.h"
+
+// ASF4
+#include "hal_gpio.h"
+
+// The SERCOM pads of each pin, for peripheral functions C (SERCOM) and D
+// (SERCOM-ALT), from the "I/O Multiplexing and Considerations" chapter of the
+// datasheet.  Each pad is encoded as (sercom << 4 | pad).
+#define PA(n) (n)
+#define PB(n) (32 + (n))
+#define SP(sercom, pad) ((sercom) << 4 | (pad))
+#define NO_PAD (0xff)
+
+typedef struct _sercom_pin_af_t {
+    uint8_t pin;
+    uint8_t alt_c;
+    uint8_t alt_d;
+} sercom_pin_af_t;
+
+STATIC const sercom_pin_af_t sercom_pin_af_table[] = {
+    { PA(0), NO_PAD, SP(1, 0) },
+    { PA(1), NO_PAD, SP(1, 1) },
+    { PA(4), NO_PAD, SP(0, 0) },
+    { PA(5), NO_PAD, SP(0, 1) },
+    { PA(6), NO_PAD, SP(0, 2) },
+    { PA(7), NO_PAD, SP(0, 3) },
+    #if defined(MCU_SAMD21)
+    { PA(8), SP(0, 0), SP(2, 0) },
+    { PA(9), SP(0, 1), SP(2, 1) },
+    #else
+    { PA(8), SP(0, 0), SP(2, 1) },
+    { PA(9), SP(0, 1), SP(2, 0) },
+    #endif
+    { PA(10), SP(0, 2), SP(2, 2) },
+    { PA(11), SP(0, 3), SP(2, 3) },
+    #if defined(MCU_SAMD21)
+    { PA(12), SP(2, 0), SP(4, 0) },
+    { PA(13), SP(2, 1), SP(4, 1) },
+    #else
+    { PA(12), SP(2, 0), SP(4, 1) },
+    { PA(13), SP(2, 1), SP(4, 0) },
+    #endif
+    { PA(14), SP(2, 2), SP(4, 2) },
+    { PA(15), SP(2, 3), SP(4, 3) },
+    #if defined(MCU_SAMD21)
+    { PA(16), SP(1, 0), SP(3, 0) },
+    { PA(17), SP(1, 1), SP(3, 1) },
+    #else
+    { PA(16), SP(1, 0), SP(3, 1) },
+    { PA(17), SP(1, 1), SP(3, 0) },
+    #endif
+    { PA(18), SP(1, 2), SP(3, 2) },
+    { PA(19), SP(1, 3), SP(3, 3) },
+    { PA(20), SP(5, 2), SP(3, 2) },
+    { PA(21), SP(5, 3), SP(3, 3) },
+    #if defined(MCU_SAMD21)
+    { PA(22), SP(3, 0), SP(5, 0) },
+    { PA(23), SP(3, 1), SP(5, 1) },
+    #else
+    { PA(22), SP(3, 0), SP(5, 1) },
+    { PA(23), SP(3, 1), SP(5, 0) },
+    #endif
+    { PA(24), SP(3, 2), SP(5, 2) },
+    { PA(25), SP(3, 3), SP(5, 3) },
+    #if defined(MCU_SAMD21)
+    { PA(30), NO_PAD, SP(1, 2) },
+    { PA(31), NO_PAD, SP(1, 3) },
+    #else
+    { PA(30), SP(7, 2), SP(1, 2) },
+    { PA(31), SP(7, 3), SP(1, 3) },
+    #endif
+    { PB(0), NO_PAD, SP(5, 2) },
+    { PB(1), NO_PAD, SP(5, 3) },
+    { PB(2), NO_PAD, SP(5, 0) },
+    { PB(3), NO_PAD, SP(5, 1) },
+    { PB(8), NO_PAD, SP(4, 0) },
+    { PB(9), NO_PAD, SP(4, 1) },
+    { PB(10), NO_PAD, SP(4, 2) },
+    { PB(11), NO_PAD, SP(4, 3) },
+    { PB(12), SP(4, 0), NO_PAD },
+    { PB(13), SP(4, 1), NO_PAD },
+    { PB(14), SP(4, 2), NO_PAD },
+    { PB(15), SP(4, 3), NO_PAD },
+    { PB(16), SP(5, 0), NO_PAD },
+    { PB(17), SP(5, 1), NO_PAD },
+    #if defined(MCU_SAMD21)
+    { PB(22), NO_PAD, SP(5, 2) },
+    { PB(23), NO_PAD, SP(5, 3) },
+    { PB(30), NO_PAD, SP(5, 0) },
+    { PB(31), NO_PAD, SP(5, 1) },
+    #else
+    { PB(22), SP(1, 2), SP(5, 2) },
+    { PB(23), SP(1, 3), SP(5, 3) },
+    { PB(24), SP(0, 0), SP(2, 1) },
+    { PB(25), SP(0, 1), SP(2, 0) },
+    { PB(26), SP(2, 1), SP(4, 1) },
+    { PB(27), SP(2, 0), SP(4, 0) },
+    { PB(28), SP(2, 2), SP(4, 2) },
+    { PB(29), SP(2, 3), SP(4, 3) },
+    { PB(30), SP(7, 0), SP(5, 1) },
+    { PB(31), SP(7, 1), SP(5, 0) },
+    #endif
+};
+
+STATIC Sercom *const sercom_instance[] = SERCOM_INSTS;
+
+STATIC const uint8_t sercom_dma_trigger[] = {
+    SERCOM0_DMAC_ID_RX,
+    SERCOM1_DMAC_ID_RX,
+    SERCOM2_DMAC_ID_RX,
+    SERCOM3_DMAC_ID_RX,
+    #if SERCOM_INST_NUM > 4
+    SERCOM4_DMAC_ID_RX,
+    SERCOM5_DMAC_ID_RX,
+    #endif
+    #if SERCOM_INST_NUM > 6
+    SERCOM6_DMAC_ID_RX,
+    SERCOM7_DMAC_ID_RX,
+    #endif
+};
+
+STATIC sercom_irq_handler_t sercom_irq_handler[SERCOM_INST_NUM];
+
+Sercom *sercom_get_instance(int sercom_id) {
+    if (sercom_id < 0 || sercom_id >= SERCOM_INST_NUM) {
+        mp_raise_msg_varg(&mp_type_ValueError, MP_ERROR_TEXT("SERCOM(%d) doesn't exist"), sercom_id);
+    }
+    return sercom_instance[sercom_id];
+}
+
+// Turn on the bus clock and the core clock (GCLK0) of a SERCOM.
+void sercom_enable(int sercom_id) {
+    #if defined(MCU_SAMD21)
+    PM->APBCMASK.reg |= PM_APBCMASK_SERCOM0 << sercom_id;
+    GCLK->CLKCTRL.reg = GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN_GCLK0 | GCLK_CLKCTRL_ID(SERCOM0_GCLK_ID_CORE + sercom_id);
+    while (GCLK->STATUS.bit.SYNCBUSY) {
+    }
+    #elif defined(MCU_SAMD51)
+    static const uint8_t gclk_id[] = {
+        SERCOM0_GCLK_ID_CORE, SERCOM1_GCLK_ID_CORE, SERCOM2_GCLK_ID_CORE, SERCOM3_GCLK_ID_CORE,
+        SERCOM4_GCLK_ID_CORE, SERCOM5_GCLK_ID_CORE,
+        #if SERCOM_INST_NUM > 6
+        SERCOM6_GCLK_ID_CORE, SERCOM7_GCLK_ID_CORE,
+        #endif
+    };
+    GCLK->PCHCTRL[gclk_id[sercom_id]].reg = GCLK_PCHCTRL_CHEN | GCLK_PCHCTRL_GEN_GCLK0;
+    while (GCLK->PCHCTRL[gclk_id[sercom_id]].bit.CHEN == 0) {
+    }
+    switch (sercom_id) {
+        case 0:
+            MCLK->APBAMASK.reg |= MCLK_APBAMASK_SERCOM0;
+            break;
+        case 1:
+            MCLK->APBAMASK.reg |= MCLK_APBAMASK_SERCOM1;
+            break;
+        case 2:
+            MCLK->APBBMASK.reg |= MCLK_APBBMASK_SERCOM2;
+            break;
+        case 3:
+            MCLK->APBBMASK.reg |= MCLK_APBBMASK_SERCOM3;
+            break;
+        default:
+            // SERCOM4 and up are contiguous in APBDMASK.
+            MCLK->APBDMASK.reg |= MCLK_APBDMASK_SERCOM4 << (sercom_id - 4);
+            break;
+    }
+    #endif
+}
+
+// Route the interrupts of a SERCOM to the given handler, or disable them if
+// the handler is NULL.
+void sercom_set_irq_handler(int sercom_id, sercom_irq_handler_t handler) {
+    sercom_irq_handler[sercom_id] = handler;
+    #if defined(MCU_SAMD21)
+    IRQn_Type irqs[] = { SERCOM0_IRQn + sercom_id };
+    #elif defined(MCU_SAMD51)
+    // SERCOMs on the SAMD51 have four interrupt lines each.
+    IRQn_Type irq0 = SERCOM0_0_IRQn + 4 * sercom_id;
+    IRQn_Type irqs[] = { irq0, irq0 + 1, irq0 + 2, irq0 + 3 };
+    #endif
+    for (size_t i = 0; i < MP_ARRAY_SIZE(irqs); ++i) {
+        if (handler != NULL) {
+            NVIC_ClearPendingIRQ(irqs[i]);
+            NVIC_EnableIRQ(irqs[i]);
+        } else {
+            NVIC_DisableIRQ(irqs[i]);
+        }
+    }
+}
+
+uint8_t sercom_dma_trigger_rx(int sercom_id) {
+    return sercom_dma_trigger[sercom_id];
+}
+
+uint8_t sercom_dma_trigger_tx(int sercom_id) {
+    // The TX trigger always follows the RX trigger.
+    return sercom_dma_trigger[sercom_id] + 1;
+}
+
+STATIC const sercom_pin_af_t *sercom_pin_af_find(mp_hal_pin_obj_t pin, int sercom_id, uint8_t *alt) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(sercom_pin_af_table); ++i) {
+        const sercom_pin_af_t *af = &sercom_pin_af_table[i];
+        if (af->pin == pin) {
+            if (af->alt_c != NO_PAD && af->alt_c >> 4 == sercom_id) {
+                *alt = SERCOM_ALT_C;
+                return af;
+            }
+            if (af->alt_d != NO_PAD && af->alt_d >> 4 == sercom_id) {
+                *alt = SERCOM_ALT_D;
+                return af;
+            }
+            break;
+        }
+    }
+    return NULL;
+}
+
+// Return the pad of the SERCOM that the pin connects to, or -1 if it can't.
+int sercom_pin_pad(mp_hal_pin_obj_t pin, int sercom_id) {
+    uint8_t alt;
+    const sercom_pin_af_t *af = sercom_pin_af_find(pin, sercom_id, &alt);
+    if (af == NULL) {
+        return -1;
+    }
+    return (alt == SERCOM_ALT_C ? af->alt_c : af->alt_d) & 0xf;
+}
+
+// Connect the pin to the SERCOM, which sercom_pin_pad() must have accepted.
+void sercom_pin_connect(mp_hal_pin_obj_t pin, int sercom_id) {
+    uint8_t alt;
+    if (sercom_pin_af_find(pin, sercom_id, &alt) != NULL) {
+        gpio_set_pin_function(pin, alt);
+    }
+}
+
+STATIC void sercom_irq_dispatch(int sercom_id) {
+    if (sercom_id < SERCOM_INST_NUM && sercom_irq_handler[sercom_id] != NULL) {
+        sercom_irq_handler[sercom_id](sercom_id);
+    }
+}
+
+// The vector table has an entry for each SERCOM that the family can have.
+void Sercom0_Handler(void) {
+    sercom_irq_dispatch(0);
+}
+
+void Sercom1_Handler(void) {
+    sercom_irq_dispatch(1);
+}
+
+void Sercom2_Handler(void) {
+    sercom_irq_dispatch(2);
+}
+
+void Sercom3_Handler(void) {
+    sercom_irq_dispatch(3);
+}
+
+void Sercom4_Handler(void) {
+    sercom_irq_dispatch(4);
+}
+
+void Sercom5_Handler(void) {
+    sercom_irq_dispatch(5);
+}
+
+void Sercom6_Handler(void) {
+    sercom_irq_dispatch(6);
+}
+
+void Sercom7_Handler(void) {
+    sercom_irq_dispatch(7);
+}
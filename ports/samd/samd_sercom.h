@@ -0,0 +1,45 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef MICROPY_INCLUDED_SAMD_SAMD_SERCOM_H
+#define MICROPY_INCLUDED_SAMD_SAMD_SERCOM_H
+
+#include "py/mphal.h"
+#include "samd_soc.h"
+
+#define SERCOM_ALT_C (2)
+#define SERCOM_ALT_D (3)
+
+typedef void (*sercom_irq_handler_t)(int sercom_id);
+
+Sercom *sercom_get_instance(int sercom_id);
+void sercom_enable(int sercom_id);
+void sercom_set_irq_handler(int sercom_id, sercom_irq_handler_t handler);
+uint8_t sercom_dma_trigger_rx(int sercom_id);
+uint8_t sercom_dma_trigger_tx(int sercom_id);
+int sercom_pin_pad(mp_hal_pin_obj_t pin, int sercom_id);
+void sercom_pin_connect(mp_hal_pin_obj_t pin, int sercom_id);
+
+#endif // MICROPY_INCLUDED_SAMD_SAMD_SERCOM_H
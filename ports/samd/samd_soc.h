@@ -38,4 +38,13 @@ void USB_1_Handler_wrapper(void);
 void USB_2_Handler_wrapper(void);
 void USB_3_Handler_wrapper(void);
 
+void Sercom0_Handler(void);
+void Sercom1_Handler(void);
+void Sercom2_Handler(void);
+void Sercom3_Handler(void);
+void Sercom4_Handler(void);
+void Sercom5_Handler(void);
+void Sercom6_Handler(void);
+void Sercom7_Handler(void);
+
 #endif // MICROPY_INCLUDED_SAMD_SAMD_SOC_H
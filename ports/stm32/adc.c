@@ -31,6 +31,7 @@
 #include "py/binary.h"
 #include "py/mphal.h"
 #include "adc.h"
+#include "dma.h"
 #include "pin.h"
 #include "timer.h"
 
@@ -695,10 +696,209 @@ STATIC mp_obj_t adc_read_timed_multi(mp_obj_t adc_array_in, mp_obj_t buf_array_i
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(adc_read_timed_multi_fun_obj, adc_read_timed_multi);
 STATIC MP_DEFINE_CONST_STATICMETHOD_OBJ(adc_read_timed_multi_obj, MP_ROM_PTR(&adc_read_timed_multi_fun_obj));
 
+#if MICROPY_HW_ADC_DMA
+
+// read_timed_stream uses ADC1 in scan mode, triggered by a timer, with a DMA
+// stream in circular mode, so only one can run at a time.
+STATIC ADC_HandleTypeDef adc_stream_handle;
+STATIC DMA_HandleTypeDef adc_stream_dma;
+
+STATIC void adc_stream_call(mp_int_t half) {
+    mp_obj_t buf = MP_STATE_PORT(pyb_adc_stream_buf);
+    mp_obj_t callback = MP_STATE_PORT(pyb_adc_stream_callback);
+    if (buf == MP_OBJ_NULL) {
+        return;
+    }
+
+    // Make the samples written by DMA to this half visible to the CPU
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer(buf, &bufinfo, MP_BUFFER_READ);
+    MP_HAL_CLEANINVALIDATE_DCACHE((uint8_t *)bufinfo.buf + half * bufinfo.len / 2, bufinfo.len / 2);
+
+    if (callback != mp_const_none) {
+        mp_sched_lock();
+        // When executing code within a handler we must lock the GC to prevent
+        // any memory allocations.  We must also catch any exceptions.
+        gc_lock();
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            mp_call_function_1(callback, MP_OBJ_NEW_SMALL_INT(half));
+            nlr_pop();
+        } else {
+            // Uncaught exception; disable the callback so it doesn't run again.
+            MP_STATE_PORT(pyb_adc_stream_callback) = mp_const_none;
+            mp_printf(MICROPY_ERROR_PRINTER, "uncaught exception in ADC stream interrupt handler\n");
+            mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+        }
+        gc_unlock();
+        mp_sched_unlock();
+    }
+}
+
+STATIC void adc_stream_half_cplt(DMA_HandleTypeDef *dma) {
+    adc_stream_call(0);
+}
+
+STATIC void adc_stream_cplt(DMA_HandleTypeDef *dma) {
+    adc_stream_call(1);
+}
+
+STATIC uint32_t adc_stream_get_trigger(TIM_TypeDef *instance) {
+    #if defined(ADC_EXTERNALTRIGCONV_T1_TRGO)
+    if (instance == TIM1) {
+        return ADC_EXTERNALTRIGCONV_T1_TRGO;
+    }
+    #endif
+    #if defined(ADC_EXTERNALTRIGCONV_T2_TRGO)
+    if (instance == TIM2) {
+        return ADC_EXTERNALTRIGCONV_T2_TRGO;
+    }
+    #endif
+    #if defined(ADC_EXTERNALTRIGCONV_T3_TRGO)
+    if (instance == TIM3) {
+        return ADC_EXTERNALTRIGCONV_T3_TRGO;
+    }
+    #endif
+    #if defined(ADC_EXTERNALTRIGCONV_T4_TRGO)
+    if (instance == TIM4) {
+        return ADC_EXTERNALTRIGCONV_T4_TRGO;
+    }
+    #endif
+    #if defined(ADC_EXTERNALTRIGCONV_T5_TRGO)
+    if (instance == TIM5) {
+        return ADC_EXTERNALTRIGCONV_T5_TRGO;
+    }
+    #endif
+    #if defined(ADC_EXTERNALTRIGCONV_T6_TRGO)
+    if (instance == TIM6) {
+        return ADC_EXTERNALTRIGCONV_T6_TRGO;
+    }
+    #endif
+    #if defined(ADC_EXTERNALTRIGCONV_T8_TRGO) && defined(TIM8)
+    if (instance == TIM8) {
+        return ADC_EXTERNALTRIGCONV_T8_TRGO;
+    }
+    #endif
+    mp_raise_ValueError(MP_ERROR_TEXT("timer can't trigger the ADC"));
+}
+
+void adc_stream_deinit(void) {
+    if (MP_STATE_PORT(pyb_adc_stream_buf) == MP_OBJ_NULL) {
+        return;
+    }
+
+    // Stop conversions and the DMA, then put ADC1 back to single conversions
+    __HAL_ADC_DISABLE(&adc_stream_handle);
+    adc_stream_handle.Instance->CR2 &= ~(ADC_CR2_DMA | ADC_CR2_DDS);
+    HAL_DMA_Abort(&adc_stream_dma);
+    dma_deinit(&dma_ADC_1_RX);
+    adcx_init_periph(&adc_stream_handle, ADC_RESOLUTION_12B);
+
+    MP_STATE_PORT(pyb_adc_stream_buf) = MP_OBJ_NULL;
+    MP_STATE_PORT(pyb_adc_stream_callback) = MP_OBJ_NULL;
+}
+
+// read_timed_stream((adcx, adcy, ...), buf, timer, callback=None)
+//
+// Start sampling the given ADC channels each time the timer overflows, and
+// store the samples, interleaved, in buf using circular DMA.  The callback is
+// called with 0 when the first half of buf has been filled, and with 1 when the
+// second half has been filled, after which the first half is written again.
+// Passing None for the channels stops the stream.
+//
+// The CPU does no work per sample, and this function does not allocate any heap
+// memory once the stream is running.
+STATIC mp_obj_t adc_read_timed_stream(size_t n_args, const mp_obj_t *args) {
+    adc_stream_deinit();
+    if (args[0] == mp_const_none) {
+        return mp_const_none;
+    }
+    if (n_args < 3) {
+        mp_raise_TypeError(NULL);
+    }
+
+    size_t nadcs;
+    mp_obj_t *adc_array;
+    mp_obj_get_array(args[0], &nadcs, &adc_array);
+    if (nadcs < 1 || nadcs > 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("need 1 to 16 ADCs"));
+    }
+
+    // The buffer holds 16-bit samples, and each half must hold whole scans
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+    size_t nelems = bufinfo.len / 2;
+    if (mp_binary_get_size('@', bufinfo.typecode, NULL) != 2
+        || nelems == 0 || nelems % (2 * nadcs) != 0 || nelems > 0xffff
+        || ((uintptr_t)bufinfo.buf & 1) != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer must be 16-bit and hold an even number of scans"));
+    }
+
+    mp_obj_t callback = n_args > 3 ? args[3] : mp_const_none;
+    if (callback != mp_const_none && !mp_obj_is_callable(callback)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("callback must be None or a callable object"));
+    }
+
+    // The timer's update event triggers each scan
+    TIM_HandleTypeDef *tim = pyb_timer_get_handle(args[2]);
+    uint32_t trigger = adc_stream_get_trigger(tim->Instance);
+    tim->Instance->CR2 = (tim->Instance->CR2 & ~TIM_CR2_MMS) | TIM_TRGO_UPDATE;
+
+    // Configure ADC1 to convert the channels in sequence on each trigger
+    adc_stream_handle.Instance = ADCx;
+    adcx_init_periph(&adc_stream_handle, ADC_RESOLUTION_12B);
+    adc_stream_handle.Init.ScanConvMode = ENABLE;
+    adc_stream_handle.Init.NbrOfConversion = nadcs;
+    adc_stream_handle.Init.EOCSelection = ADC_EOC_SEQ_CONV;
+    adc_stream_handle.Init.ExternalTrigConv = trigger;
+    adc_stream_handle.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+    adc_stream_handle.Init.DMAContinuousRequests = ENABLE;
+    HAL_ADC_Init(&adc_stream_handle);
+    for (size_t i = 0; i < nadcs; ++i) {
+        if (!mp_obj_is_type(adc_array[i], &pyb_adc_type)) {
+            mp_raise_TypeError(NULL);
+        }
+        pyb_obj_adc_t *adc = MP_OBJ_TO_PTR(adc_array[i]);
+        ADC_ChannelConfTypeDef sConfig;
+        sConfig.Channel = adc->channel;
+        sConfig.Rank = i + 1;
+        if (__HAL_ADC_IS_CHANNEL_INTERNAL(adc->channel)) {
+            sConfig.SamplingTime = ADC_SAMPLETIME_480CYCLES;
+        } else {
+            sConfig.SamplingTime = ADC_SAMPLETIME_15CYCLES;
+        }
+        sConfig.Offset = 0;
+        HAL_ADC_ConfigChannel(&adc_stream_handle, &sConfig);
+    }
+
+    // Keep the buffer and callback alive while the stream is running
+    MP_STATE_PORT(pyb_adc_stream_buf) = args[1];
+    MP_STATE_PORT(pyb_adc_stream_callback) = callback;
+
+    // Start the DMA, which interrupts at half and full, then enable the ADC
+    MP_HAL_CLEANINVALIDATE_DCACHE(bufinfo.buf, bufinfo.len);
+    dma_init(&adc_stream_dma, &dma_ADC_1_RX, DMA_PERIPH_TO_MEMORY, &adc_stream_handle);
+    adc_stream_handle.DMA_Handle = &adc_stream_dma;
+    adc_stream_dma.XferHalfCpltCallback = adc_stream_half_cplt;
+    adc_stream_dma.XferCpltCallback = adc_stream_cplt;
+    HAL_DMA_Start_IT(&adc_stream_dma, (uint32_t)&adc_stream_handle.Instance->DR, (uint32_t)bufinfo.buf, nelems);
+    adc_stream_handle.Instance->CR2 |= ADC_CR2_DMA | ADC_CR2_DDS;
+    __HAL_ADC_ENABLE(&adc_stream_handle);
+
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(adc_read_timed_stream_fun_obj, 1, 4, adc_read_timed_stream);
+STATIC MP_DEFINE_CONST_STATICMETHOD_OBJ(adc_read_timed_stream_obj, MP_ROM_PTR(&adc_read_timed_stream_fun_obj));
+
+#endif // MICROPY_HW_ADC_DMA
+
 STATIC const mp_rom_map_elem_t adc_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&adc_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_timed), MP_ROM_PTR(&adc_read_timed_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_timed_multi), MP_ROM_PTR(&adc_read_timed_multi_obj) },
+    #if MICROPY_HW_ADC_DMA
+    { MP_ROM_QSTR(MP_QSTR_read_timed_stream), MP_ROM_PTR(&adc_read_timed_stream_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(adc_locals_dict, adc_locals_dict_table);
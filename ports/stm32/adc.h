@@ -32,6 +32,7 @@ extern const mp_obj_type_t pyb_adc_all_type;
 #endif
 
 void adc_config(ADC_TypeDef *adc, uint32_t bits);
+void adc_stream_deinit(void);
 uint32_t adc_config_and_read_u16(ADC_TypeDef *adc, uint32_t channel, uint32_t sample_time);
 
 #if defined(ADC_CHANNEL_VBAT)
@@ -102,6 +102,10 @@ extern struct _spi_bdev_t spi_bdev;
 extern const struct _mp_spiflash_config_t spiflash2_config;
 extern struct _spi_bdev_t spi_bdev2;
 
+// Import .mpy files in place when a filesystem presents them as memory-mapped
+// buffers, eg a user VFS over the XIP region of SPI flash #2.
+#define MICROPY_READER_ROM          (1)
+
 // UART config
 #define MICROPY_HW_UART1_NAME       "YA"
 #define MICROPY_HW_UART1_TX         (pyb_pin_Y1)
@@ -64,3 +64,7 @@
 #define MICROPY_HW_ETH_RMII_TX_EN   (pyb_pin_W8)
 #define MICROPY_HW_ETH_RMII_TXD0    (pyb_pin_W45)
 #define MICROPY_HW_ETH_RMII_TXD1    (pyb_pin_W49)
+
+// Larger lwIP buffers, for higher TCP throughput over WiFi and Ethernet
+#define MICROPY_HW_LWIP_MEM_SIZE    (16000)
+#define MICROPY_HW_LWIP_TCP_MSS     (1460)
@@ -131,6 +131,8 @@ bool can_init(pyb_can_obj_t *can_obj, uint32_t mode, uint32_t prescaler, uint32_
 
 void can_deinit(pyb_can_obj_t *self) {
     self->is_enabled = false;
+    self->rxbuf[0] = NULL;
+    self->rxbuf[1] = NULL;
     HAL_CAN_DeInit(&self->can);
     if (self->can.Instance == CAN1) {
         HAL_NVIC_DisableIRQ(CAN1_RX0_IRQn);
@@ -328,6 +330,13 @@ STATIC void can_rx_irq_handler(uint can_id, uint fifo_id) {
         state = &self->rx_state1;
     }
 
+    if (self->rxbuf[fifo_id == CAN_FIFO0 ? 0 : 1] != NULL) {
+        // Move all pending messages to the software FIFO, which also clears FMP
+        irq_reason = pyb_can_rxbuf_fill(self, fifo_id);
+        pyb_can_handle_callback(self, fifo_id, callback, irq_reason);
+        return;
+    }
+
     switch (*state) {
         case RX_STATE_FIFO_EMPTY:
             __HAL_CAN_DISABLE_IT(&self->can,  (fifo_id == CAN_FIFO0) ? CAN_IT_FMP0 : CAN_IT_FMP1);
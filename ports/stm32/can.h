@@ -61,6 +61,8 @@ typedef enum _rx_state_t {
     RX_STATE_FIFO_OVERFLOW,
 } rx_state_t;
 
+struct _pyb_can_rxbuf_t;
+
 typedef struct _pyb_can_obj_t {
     mp_obj_base_t base;
     mp_obj_t rxcallback0;
@@ -72,6 +74,7 @@ typedef struct _pyb_can_obj_t {
     uint16_t num_error_warning;
     uint16_t num_error_passive;
     uint16_t num_bus_off;
+    struct _pyb_can_rxbuf_t *rxbuf[2];
     CAN_HandleTypeDef can;
 } pyb_can_obj_t;
 
@@ -85,6 +88,7 @@ void can_deinit(pyb_can_obj_t *self);
 void can_clearfilter(pyb_can_obj_t *self, uint32_t f, uint8_t bank);
 int can_receive(CAN_HandleTypeDef *can, int fifo, CanRxMsgTypeDef *msg, uint8_t *data, uint32_t timeout_ms);
 HAL_StatusTypeDef CAN_Transmit(CAN_HandleTypeDef *hcan, uint32_t Timeout);
+mp_obj_t pyb_can_rxbuf_fill(pyb_can_obj_t *self, uint fifo);
 void pyb_can_handle_callback(pyb_can_obj_t *self, uint fifo_id, mp_obj_t callback, mp_obj_t irq_reason);
 
 #endif // MICROPY_HW_ENABLE_CAN
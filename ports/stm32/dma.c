@@ -28,7 +28,9 @@
 #include <string.h>
 #include <stdint.h>
 
-#include "py/obj.h"
+#include "py/runtime.h"
+#include "py/gc.h"
+#include "py/mperrno.h"
 #include "py/mphal.h"
 #include "systick.h"
 #include "dma.h"
@@ -113,6 +115,44 @@ static const DMA_InitTypeDef dma_init_struct_spi_i2c = {
     #endif
 };
 
+#if MICROPY_HW_UART_DMA
+// Parameters to dma_init() for UART rx, which runs continuously into a ring
+// buffer; UART tx uses the spi/i2c parameters
+static const DMA_InitTypeDef dma_init_struct_uart_rx = {
+    .Channel = 0,
+    .Direction = DMA_PERIPH_TO_MEMORY,
+    .PeriphInc = DMA_PINC_DISABLE,
+    .MemInc = DMA_MINC_ENABLE,
+    .PeriphDataAlignment = DMA_PDATAALIGN_BYTE,
+    .MemDataAlignment = DMA_MDATAALIGN_BYTE,
+    .Mode = DMA_CIRCULAR,
+    .Priority = DMA_PRIORITY_HIGH,
+    .FIFOMode = DMA_FIFOMODE_DISABLE,
+    .FIFOThreshold = DMA_FIFO_THRESHOLD_FULL,
+    .MemBurst = DMA_MBURST_SINGLE,
+    .PeriphBurst = DMA_PBURST_SINGLE
+};
+#endif
+
+#if MICROPY_HW_ADC_DMA
+// Parameters to dma_init() for ADC, which runs continuously into a buffer
+// of 16-bit samples
+static const DMA_InitTypeDef dma_init_struct_adc = {
+    .Channel = 0,
+    .Direction = DMA_PERIPH_TO_MEMORY,
+    .PeriphInc = DMA_PINC_DISABLE,
+    .MemInc = DMA_MINC_ENABLE,
+    .PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD,
+    .MemDataAlignment = DMA_MDATAALIGN_HALFWORD,
+    .Mode = DMA_CIRCULAR,
+    .Priority = DMA_PRIORITY_HIGH,
+    .FIFOMode = DMA_FIFOMODE_DISABLE,
+    .FIFOThreshold = DMA_FIFO_THRESHOLD_FULL,
+    .MemBurst = DMA_MBURST_SINGLE,
+    .PeriphBurst = DMA_PBURST_SINGLE
+};
+#endif
+
 #if MICROPY_HW_ENABLE_I2S
 // Default parameters to dma_init() for i2s; Channel and Direction
 // vary depending on the peripheral instance so they get passed separately
@@ -292,6 +332,16 @@ const dma_descr_t dma_DAC_2_TX = { DMA1_Stream6, DMA_CHANNEL_7, dma_id_6,   &dma
 const dma_descr_t dma_SPI_3_TX = { DMA1_Stream7, DMA_CHANNEL_0, dma_id_7,   &dma_init_struct_spi_i2c };
 const dma_descr_t dma_I2C_1_TX = { DMA1_Stream7, DMA_CHANNEL_1, dma_id_7,   &dma_init_struct_spi_i2c };
 const dma_descr_t dma_I2C_2_TX = { DMA1_Stream7, DMA_CHANNEL_7, dma_id_7,   &dma_init_struct_spi_i2c };
+#if MICROPY_HW_UART_DMA
+const dma_descr_t dma_UART_5_RX = { DMA1_Stream0, DMA_CHANNEL_4, dma_id_0,   &dma_init_struct_uart_rx };
+const dma_descr_t dma_UART_3_RX = { DMA1_Stream1, DMA_CHANNEL_4, dma_id_1,   &dma_init_struct_uart_rx };
+const dma_descr_t dma_UART_4_RX = { DMA1_Stream2, DMA_CHANNEL_4, dma_id_2,   &dma_init_struct_uart_rx };
+const dma_descr_t dma_UART_3_TX = { DMA1_Stream3, DMA_CHANNEL_4, dma_id_3,   &dma_init_struct_spi_i2c };
+const dma_descr_t dma_UART_4_TX = { DMA1_Stream4, DMA_CHANNEL_4, dma_id_4,   &dma_init_struct_spi_i2c };
+const dma_descr_t dma_UART_2_RX = { DMA1_Stream5, DMA_CHANNEL_4, dma_id_5,   &dma_init_struct_uart_rx };
+const dma_descr_t dma_UART_2_TX = { DMA1_Stream6, DMA_CHANNEL_4, dma_id_6,   &dma_init_struct_spi_i2c };
+const dma_descr_t dma_UART_5_TX = { DMA1_Stream7, DMA_CHANNEL_4, dma_id_7,   &dma_init_struct_spi_i2c };
+#endif
 /* not preferred streams
 const dma_descr_t dma_SPI_3_RX = { DMA1_Stream0, DMA_CHANNEL_0, dma_id_0,   &dma_init_struct_spi_i2c };
 const dma_descr_t dma_I2C_1_TX = { DMA1_Stream6, DMA_CHANNEL_1, dma_id_6,   &dma_init_struct_spi_i2c };
@@ -301,6 +351,9 @@ const dma_descr_t dma_I2C_1_TX = { DMA1_Stream6, DMA_CHANNEL_1, dma_id_6,   &dma
 #if defined(STM32F7) && defined(SDMMC2) && ENABLE_SDIO
 const dma_descr_t dma_SDMMC_2 = { DMA2_Stream0, DMA_CHANNEL_11, dma_id_8,  &dma_init_struct_sdio };
 #endif
+#if MICROPY_HW_ADC_DMA
+const dma_descr_t dma_ADC_1_RX = { DMA2_Stream0, DMA_CHANNEL_0, dma_id_8,   &dma_init_struct_adc };
+#endif
 #if MICROPY_HW_ENABLE_DCMI
 const dma_descr_t dma_DCMI_0 = { DMA2_Stream1, DMA_CHANNEL_1, dma_id_9,  &dma_init_struct_dcmi };
 #endif
@@ -326,6 +379,12 @@ const dma_descr_t dma_I2S_1_TX = { DMA2_Stream5, DMA_CHANNEL_3, dma_id_13,  &dma
 // const dma_descr_t dma_SDMMC_2 = { DMA2_Stream5, DMA_CHANNEL_11, dma_id_13,  &dma_init_struct_sdio };
 // #endif
 const dma_descr_t dma_SPI_6_RX = { DMA2_Stream6, DMA_CHANNEL_1, dma_id_14,  &dma_init_struct_spi_i2c };
+#if MICROPY_HW_UART_DMA
+const dma_descr_t dma_UART_6_RX = { DMA2_Stream1, DMA_CHANNEL_5, dma_id_9,   &dma_init_struct_uart_rx };
+const dma_descr_t dma_UART_1_RX = { DMA2_Stream2, DMA_CHANNEL_4, dma_id_10,  &dma_init_struct_uart_rx };
+const dma_descr_t dma_UART_6_TX = { DMA2_Stream6, DMA_CHANNEL_5, dma_id_14,  &dma_init_struct_spi_i2c };
+const dma_descr_t dma_UART_1_TX = { DMA2_Stream7, DMA_CHANNEL_4, dma_id_15,  &dma_init_struct_spi_i2c };
+#endif
 // #if ENABLE_SDIO
 // const dma_descr_t dma_SDIO_0 = { DMA2_Stream6, DMA_CHANNEL_4, dma_id_14,  &dma_init_struct_sdio };
 // #endif
@@ -1577,3 +1636,360 @@ void dma_external_acquire(uint32_t controller, uint32_t stream) {
 void dma_external_release(uint32_t controller, uint32_t stream) {
     dma_disable_clock(DMA_ID_FROM_CONTROLLER_STREAM(controller, stream));
 }
+
+#if MICROPY_PY_STM_DMA
+
+/******************************************************************************/
+// MicroPython bindings for stm.DMA
+//
+// A DMA object owns one stream of DMA1 or DMA2 and is configured directly via
+// the HAL.  It is up to the user to pick a stream that is not also used by a
+// driver (eg SPI, I2C, SDIO), and the channel that connects that stream to the
+// wanted request line, from the "DMA request mapping" table of the reference
+// manual.
+
+#define STM_DMA_IRQ_HALF (1)
+#define STM_DMA_IRQ_FULL (2)
+
+typedef struct _stm_dma_obj_t {
+    mp_obj_base_t base;
+    uint8_t controller;
+    uint8_t stream;
+    uint8_t channel;
+    DMA_HandleTypeDef dma;
+    mp_obj_t callback;
+    // Buffers are kept here so they can't be freed while the DMA uses them.
+    mp_obj_t src;
+    mp_obj_t dst;
+    // The memory the DMA writes to, which must be invalidated in the D-cache.
+    void *cache_buf;
+    size_t cache_len;
+} stm_dma_obj_t;
+
+static DMA_Stream_TypeDef *const stm_dma_stream[NSTREAM] = {
+    DMA1_Stream0, DMA1_Stream1, DMA1_Stream2, DMA1_Stream3,
+    DMA1_Stream4, DMA1_Stream5, DMA1_Stream6, DMA1_Stream7,
+    DMA2_Stream0, DMA2_Stream1, DMA2_Stream2, DMA2_Stream3,
+    DMA2_Stream4, DMA2_Stream5, DMA2_Stream6, DMA2_Stream7,
+};
+
+static void stm_dma_handle_irq(stm_dma_obj_t *self, mp_int_t event) {
+    if (self->cache_buf != NULL) {
+        MP_HAL_CLEANINVALIDATE_DCACHE(self->cache_buf, self->cache_len);
+    }
+    mp_obj_t callback = self->callback;
+    if (callback == mp_const_none) {
+        return;
+    }
+    mp_sched_lock();
+    // When executing code within a handler we must lock the GC to prevent
+    // any memory allocations.  We must also catch any exceptions.
+    gc_lock();
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_call_function_1(callback, MP_OBJ_NEW_SMALL_INT(event));
+        nlr_pop();
+    } else {
+        // Uncaught exception; disable the callback so it doesn't run again.
+        self->callback = mp_const_none;
+        mp_printf(MICROPY_ERROR_PRINTER, "uncaught exception in DMA(%u, %u) interrupt handler\n", self->controller, self->stream);
+        mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
+    }
+    gc_unlock();
+    mp_sched_unlock();
+}
+
+static void stm_dma_xfer_half_cplt(DMA_HandleTypeDef *dma) {
+    stm_dma_handle_irq(dma->Parent, STM_DMA_IRQ_HALF);
+}
+
+static void stm_dma_xfer_cplt(DMA_HandleTypeDef *dma) {
+    stm_dma_handle_irq(dma->Parent, STM_DMA_IRQ_FULL);
+}
+
+static void stm_dma_stop_internal(stm_dma_obj_t *self) {
+    if (self->dma.State == HAL_DMA_STATE_BUSY) {
+        HAL_DMA_Abort(&self->dma);
+    }
+    self->src = MP_OBJ_NULL;
+    self->dst = MP_OBJ_NULL;
+    self->cache_buf = NULL;
+}
+
+static void stm_dma_release(stm_dma_obj_t *self) {
+    dma_id_t dma_id = DMA_ID_FROM_CONTROLLER_STREAM(self->controller - 1, self->stream);
+    stm_dma_stop_internal(self);
+    HAL_NVIC_DisableIRQ(dma_irqn[dma_id]);
+    dma_handle[dma_id] = NULL;
+    dma_last_sub_instance[dma_id] = DMA_INVALID_CHANNEL;
+    dma_disable_clock(dma_id);
+    self->callback = mp_const_none;
+    MP_STATE_PORT(stm_dma_obj_all)[dma_id] = NULL;
+}
+
+void stm_dma_deinit_all(void) {
+    for (size_t i = 0; i < NSTREAM; ++i) {
+        stm_dma_obj_t *self = MP_STATE_PORT(stm_dma_obj_all)[i];
+        if (self != NULL) {
+            stm_dma_release(self);
+        }
+    }
+}
+
+static void stm_dma_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    stm_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_printf(print, "DMA(%u, %u, channel=%u)", self->controller, self->stream, self->channel);
+}
+
+// DMA(controller, stream, channel=0)
+static mp_obj_t stm_dma_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_controller, ARG_stream, ARG_channel };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_controller, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_channel, MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_uint_t controller = args[ARG_controller].u_int;
+    mp_uint_t stream = args[ARG_stream].u_int;
+    mp_uint_t channel = args[ARG_channel].u_int;
+    if (controller < 1 || controller > NCONTROLLERS) {
+        mp_raise_msg_varg(&mp_type_ValueError, MP_ERROR_TEXT("DMA(%d) doesn't exist"), (int)controller);
+    }
+    if (stream >= NSTREAMS_PER_CONTROLLER) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid stream"));
+    }
+    if (channel > (DMA_SxCR_CHSEL >> DMA_SxCR_CHSEL_Pos)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid channel"));
+    }
+
+    dma_id_t dma_id = DMA_ID_FROM_CONTROLLER_STREAM(controller - 1, stream);
+    stm_dma_obj_t *self = MP_STATE_PORT(stm_dma_obj_all)[dma_id];
+    if (self != NULL) {
+        // Re-use the existing object, stopping any transfer it has running.
+        stm_dma_stop_internal(self);
+        self->channel = channel;
+        return MP_OBJ_FROM_PTR(self);
+    }
+
+    if (dma_handle[dma_id] != NULL || (dma_enable_mask & (1 << dma_id))) {
+        // This stream is in use by a driver.
+        mp_raise_OSError(MP_EBUSY);
+    }
+
+    self = m_new0(stm_dma_obj_t, 1);
+    self->base.type = &stm_dma_type;
+    self->controller = controller;
+    self->stream = stream;
+    self->channel = channel;
+    self->dma.Instance = stm_dma_stream[dma_id];
+    self->dma.Parent = self;
+    self->callback = mp_const_none;
+    MP_STATE_PORT(stm_dma_obj_all)[dma_id] = self;
+
+    // Claim the stream for the IRQ handler and make sure drivers that used it
+    // previously fully reconfigure it when they get it back.
+    dma_handle[dma_id] = &self->dma;
+    dma_last_sub_instance[dma_id] = DMA_INVALID_CHANNEL;
+    dma_enable_clock(dma_id);
+    NVIC_SetPriority(IRQn_NONNEG(dma_irqn[dma_id]), IRQ_PRI_DMA);
+    HAL_NVIC_EnableIRQ(dma_irqn[dma_id]);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static uint32_t stm_dma_get_addr(mp_obj_t obj, mp_uint_t flags, size_t *len) {
+    if (mp_obj_is_int(obj)) {
+        *len = 0;
+        return mp_obj_get_int_truncated(obj);
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(obj, &bufinfo, flags);
+    *len = bufinfo.len;
+    return (uint32_t)bufinfo.buf;
+}
+
+// DMA.start(src, dst, count=-1, *, size=1, src_inc=None, dst_inc=None, circular=False, callback=None)
+static mp_obj_t stm_dma_start(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_src, ARG_dst, ARG_count, ARG_size, ARG_src_inc, ARG_dst_inc, ARG_circular, ARG_callback };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_src, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_dst, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_count, MP_ARG_INT, {.u_int = -1} },
+        { MP_QSTR_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+        { MP_QSTR_src_inc, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_dst_inc, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_circular, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_callback, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+    };
+    stm_dma_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (MP_STATE_PORT(stm_dma_obj_all)[DMA_ID_FROM_CONTROLLER_STREAM(self->controller - 1, self->stream)] != self) {
+        mp_raise_OSError(MP_ENODEV);
+    }
+
+    stm_dma_stop_internal(self);
+
+    size_t src_len, dst_len;
+    uint32_t src_addr = stm_dma_get_addr(args[ARG_src].u_obj, MP_BUFFER_READ, &src_len);
+    uint32_t dst_addr = stm_dma_get_addr(args[ARG_dst].u_obj, MP_BUFFER_WRITE, &dst_len);
+    bool src_is_mem = !mp_obj_is_int(args[ARG_src].u_obj);
+    bool dst_is_mem = !mp_obj_is_int(args[ARG_dst].u_obj);
+    bool src_inc = args[ARG_src_inc].u_obj == mp_const_none ? src_is_mem : mp_obj_is_true(args[ARG_src_inc].u_obj);
+    bool dst_inc = args[ARG_dst_inc].u_obj == mp_const_none ? dst_is_mem : mp_obj_is_true(args[ARG_dst_inc].u_obj);
+    bool circular = args[ARG_circular].u_bool;
+
+    uint32_t size = args[ARG_size].u_int;
+    uint32_t align;
+    if (size == 1) {
+        align = DMA_PDATAALIGN_BYTE;
+    } else if (size == 2) {
+        align = DMA_PDATAALIGN_HALFWORD;
+    } else if (size == 4) {
+        align = DMA_PDATAALIGN_WORD;
+    } else {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid size"));
+    }
+    if ((src_addr | dst_addr) & (size - 1)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("address not aligned to size"));
+    }
+
+    // Work out the number of items to transfer, which must fit in the buffers.
+    mp_int_t count = args[ARG_count].u_int;
+    size_t max_len = SIZE_MAX;
+    if (src_is_mem && src_inc) {
+        max_len = src_len;
+    }
+    if (dst_is_mem && dst_inc && dst_len < max_len) {
+        max_len = dst_len;
+    }
+    if (count < 0) {
+        if (max_len == SIZE_MAX) {
+            mp_raise_TypeError(MP_ERROR_TEXT("count required"));
+        }
+        count = max_len / size;
+    }
+    if (count < 1 || count > 0xffff || (size_t)count * size > max_len
+        || (src_is_mem && !src_inc && src_len < size) || (dst_is_mem && !dst_inc && dst_len < size)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("invalid count"));
+    }
+
+    DMA_HandleTypeDef *dma = &self->dma;
+    DMA_InitTypeDef *init = &dma->Init;
+    init->Channel = self->channel << DMA_SxCR_CHSEL_Pos;
+    init->PeriphDataAlignment = align;
+    init->MemDataAlignment = align << (DMA_SxCR_MSIZE_Pos - DMA_SxCR_PSIZE_Pos);
+    init->Mode = circular ? DMA_CIRCULAR : DMA_NORMAL;
+    init->Priority = DMA_PRIORITY_HIGH;
+    init->FIFOMode = DMA_FIFOMODE_DISABLE;
+    init->FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+    init->MemBurst = DMA_MBURST_SINGLE;
+    init->PeriphBurst = DMA_PBURST_SINGLE;
+    bool mem_inc = dst_inc;
+    bool periph_inc = src_inc;
+    if (src_is_mem && dst_is_mem) {
+        // Memory-to-memory needs DMA2 and the FIFO, and can't be circular.
+        if (self->controller != 2 || circular) {
+            mp_raise_ValueError(MP_ERROR_TEXT("memory copy needs DMA2, not circular"));
+        }
+        init->Direction = DMA_MEMORY_TO_MEMORY;
+        init->FIFOMode = DMA_FIFOMODE_ENABLE;
+    } else if (src_is_mem) {
+        init->Direction = DMA_MEMORY_TO_PERIPH;
+        mem_inc = src_inc;
+        periph_inc = dst_inc;
+    } else {
+        init->Direction = DMA_PERIPH_TO_MEMORY;
+    }
+    init->PeriphInc = periph_inc ? DMA_PINC_ENABLE : DMA_PINC_DISABLE;
+    init->MemInc = mem_inc ? DMA_MINC_ENABLE : DMA_MINC_DISABLE;
+
+    self->callback = args[ARG_callback].u_obj;
+    dma->XferCpltCallback = stm_dma_xfer_cplt;
+    dma->XferHalfCpltCallback = self->callback == mp_const_none ? NULL : stm_dma_xfer_half_cplt;
+    dma->XferErrorCallback = NULL;
+    dma->XferAbortCallback = NULL;
+    dma->Lock = HAL_UNLOCKED;
+    dma->State = HAL_DMA_STATE_RESET;
+    HAL_DMA_Init(dma);
+
+    // Write back what the DMA will read, and make sure no dirty cache line is
+    // later written over what the DMA has written.
+    self->src = args[ARG_src].u_obj;
+    self->dst = args[ARG_dst].u_obj;
+    if (src_is_mem) {
+        MP_HAL_CLEAN_DCACHE((void *)src_addr, src_len);
+    }
+    if (dst_is_mem) {
+        self->cache_buf = (void *)dst_addr;
+        self->cache_len = dst_len;
+        MP_HAL_CLEANINVALIDATE_DCACHE(self->cache_buf, self->cache_len);
+    }
+
+    if (HAL_DMA_Start_IT(dma, src_addr, dst_addr, count) != HAL_OK) {
+        stm_dma_stop_internal(self);
+        mp_raise_OSError(MP_EIO);
+    }
+
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(stm_dma_start_obj, 3, stm_dma_start);
+
+// DMA.stop()
+static mp_obj_t stm_dma_stop(mp_obj_t self_in) {
+    stm_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    stm_dma_stop_internal(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(stm_dma_stop_obj, stm_dma_stop);
+
+// DMA.active()
+static mp_obj_t stm_dma_active(mp_obj_t self_in) {
+    stm_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(self->dma.State == HAL_DMA_STATE_BUSY
+        && (((DMA_Stream_TypeDef *)self->dma.Instance)->CR & DMA_SxCR_EN));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(stm_dma_active_obj, stm_dma_active);
+
+// DMA.count()
+static mp_obj_t stm_dma_count(mp_obj_t self_in) {
+    stm_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(__HAL_DMA_GET_COUNTER(&self->dma));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(stm_dma_count_obj, stm_dma_count);
+
+// DMA.deinit()
+static mp_obj_t stm_dma_deinit(mp_obj_t self_in) {
+    stm_dma_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (MP_STATE_PORT(stm_dma_obj_all)[DMA_ID_FROM_CONTROLLER_STREAM(self->controller - 1, self->stream)] == self) {
+        stm_dma_release(self);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(stm_dma_deinit_obj, stm_dma_deinit);
+
+static const mp_rom_map_elem_t stm_dma_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&stm_dma_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&stm_dma_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_active), MP_ROM_PTR(&stm_dma_active_obj) },
+    { MP_ROM_QSTR(MP_QSTR_count), MP_ROM_PTR(&stm_dma_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&stm_dma_deinit_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_IRQ_HALF), MP_ROM_INT(STM_DMA_IRQ_HALF) },
+    { MP_ROM_QSTR(MP_QSTR_IRQ_FULL), MP_ROM_INT(STM_DMA_IRQ_FULL) },
+};
+static MP_DEFINE_CONST_DICT(stm_dma_locals_dict, stm_dma_locals_dict_table);
+
+const mp_obj_type_t stm_dma_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_DMA,
+    .print = stm_dma_print,
+    .make_new = stm_dma_make_new,
+    .locals_dict = (mp_obj_dict_t *)&stm_dma_locals_dict,
+};
+
+#endif // MICROPY_PY_STM_DMA
@@ -61,6 +61,19 @@ extern const dma_descr_t dma_I2S_1_RX;
 extern const dma_descr_t dma_I2S_1_TX;
 extern const dma_descr_t dma_I2S_2_RX;
 extern const dma_descr_t dma_I2S_2_TX;
+extern const dma_descr_t dma_UART_1_RX;
+extern const dma_descr_t dma_UART_1_TX;
+extern const dma_descr_t dma_UART_2_RX;
+extern const dma_descr_t dma_UART_2_TX;
+extern const dma_descr_t dma_UART_3_RX;
+extern const dma_descr_t dma_UART_3_TX;
+extern const dma_descr_t dma_UART_4_RX;
+extern const dma_descr_t dma_UART_4_TX;
+extern const dma_descr_t dma_UART_5_RX;
+extern const dma_descr_t dma_UART_5_TX;
+extern const dma_descr_t dma_UART_6_RX;
+extern const dma_descr_t dma_UART_6_TX;
+extern const dma_descr_t dma_ADC_1_RX;
 
 #elif defined(STM32G4)
 
@@ -142,4 +155,9 @@ void dma_nohal_start(const dma_descr_t *descr, uint32_t src_addr, uint32_t dst_a
 void dma_external_acquire(uint32_t controller, uint32_t stream);
 void dma_external_release(uint32_t controller, uint32_t stream);
 
+#if MICROPY_PY_STM_DMA
+extern const mp_obj_type_t stm_dma_type;
+void stm_dma_deinit_all(void);
+#endif
+
 #endif // MICROPY_INCLUDED_STM32_DMA_H
@@ -0,0 +1,175 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/mphal.h"
+#include "dma2d.h"
+
+#if MICROPY_HW_ENABLE_DMA2D
+
+// Below this many bytes the CPU is quicker than setting up the DMA2D.
+#ifndef MICROPY_HW_DMA2D_MIN_BYTES
+#define MICROPY_HW_DMA2D_MIN_BYTES (256)
+#endif
+
+#define DMA2D_TIMEOUT_MS (100)
+
+#define DMA2D_MODE_M2M (0)
+#define DMA2D_MODE_R2M (3)
+
+#define DMA2D_CM_ARGB8888 (0)
+#define DMA2D_CM_RGB565 (2)
+#define DMA2D_CM_L8 (5)
+
+// Largest pixel count and line offset for all DMA2D versions.
+#define DMA2D_MAX_PL (0x3fff)
+#define DMA2D_MAX_OFFSET (0x3fff)
+
+// Whether the DMA2D can reach the given memory: the F4's CCM RAM and the H7's
+// DTCM RAM are only connected to the CPU.
+static bool dma2d_can_access(const void *addr, size_t len) {
+    uintptr_t a = (uintptr_t)addr;
+    #if defined(CCMDATARAM_BASE)
+    if (a < CCMDATARAM_BASE + 0x10000 && a + len > CCMDATARAM_BASE) {
+        return false;
+    }
+    #endif
+    #if defined(STM32H7)
+    if (a < D1_DTCMRAM_BASE + 0x20000 && a + len > D1_DTCMRAM_BASE) {
+        return false;
+    }
+    #endif
+    return true;
+}
+
+// Set up the output area, in pixels of psize bytes.  Returns false if the
+// DMA2D can't do it.
+static bool dma2d_set_output(uint8_t *dest, size_t dest_step, size_t len, unsigned int rows, unsigned int psize) {
+    size_t pl = len / psize;
+    size_t offset = (dest_step - len) / psize;
+    if (pl > DMA2D_MAX_PL || offset > DMA2D_MAX_OFFSET || rows > 0xffff) {
+        return false;
+    }
+    if (!__HAL_RCC_DMA2D_IS_CLK_ENABLED()) {
+        __HAL_RCC_DMA2D_CLK_ENABLE();
+    }
+    DMA2D->OMAR = (uint32_t)dest;
+    DMA2D->OOR = offset;
+    DMA2D->NLR = pl << DMA2D_NLR_PL_Pos | rows;
+    return true;
+}
+
+// Run the configured transfer and wait for it to finish.
+static bool dma2d_run(uint32_t mode, uint8_t *dest, size_t dest_span) {
+    MP_HAL_CLEANINVALIDATE_DCACHE(dest, dest_span);
+    DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF;
+    DMA2D->CR = mode << DMA2D_CR_MODE_Pos | DMA2D_CR_START;
+    bool ok = true;
+    uint32_t t0 = mp_hal_ticks_ms();
+    while (DMA2D->CR & DMA2D_CR_START) {
+        if (mp_hal_ticks_ms() - t0 > DMA2D_TIMEOUT_MS) {
+            DMA2D->CR |= DMA2D_CR_ABORT;
+            while (DMA2D->CR & DMA2D_CR_START) {
+            }
+            ok = false;
+            break;
+        }
+    }
+    if (DMA2D->ISR & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)) {
+        ok = false;
+    }
+    // The CPU may have speculatively read lines of the destination meanwhile.
+    MP_HAL_CLEANINVALIDATE_DCACHE(dest, dest_span);
+    return ok;
+}
+
+bool dma2d_copy_rows(uint8_t *dest, size_t dest_step, const uint8_t *src, size_t src_step, size_t len, unsigned int rows) {
+    if (len * rows < MICROPY_HW_DMA2D_MIN_BYTES) {
+        return false;
+    }
+    size_t dest_span = (rows - 1) * dest_step + len;
+    size_t src_span = (rows - 1) * src_step + len;
+    // The DMA2D only copies forwards, so overlapping areas are left to memmove.
+    if (dest < src + src_span && src < dest + dest_span) {
+        return false;
+    }
+    if (!dma2d_can_access(dest, dest_span) || !dma2d_can_access(src, src_span)) {
+        return false;
+    }
+
+    // Move the widest pixels that the addresses and lengths allow.
+    uintptr_t align = (uintptr_t)dest | (uintptr_t)src | dest_step | src_step | len;
+    unsigned int psize;
+    uint32_t cm;
+    if ((align & 3) == 0) {
+        psize = 4;
+        cm = DMA2D_CM_ARGB8888;
+    } else if ((align & 1) == 0) {
+        psize = 2;
+        cm = DMA2D_CM_RGB565;
+    } else {
+        psize = 1;
+        cm = DMA2D_CM_L8;
+    }
+    size_t src_offset = (src_step - len) / psize;
+    if (src_offset > DMA2D_MAX_OFFSET || !dma2d_set_output(dest, dest_step, len, rows, psize)) {
+        return false;
+    }
+    DMA2D->FGMAR = (uint32_t)src;
+    DMA2D->FGOR = src_offset;
+    DMA2D->FGPFCCR = cm;
+    MP_HAL_CLEAN_DCACHE(src, src_span);
+    return dma2d_run(DMA2D_MODE_M2M, dest, dest_span);
+}
+
+bool dma2d_fill_rows(uint8_t *dest, size_t dest_step, size_t len, unsigned int rows, unsigned int bpp, uint32_t col) {
+    if (len * rows < MICROPY_HW_DMA2D_MIN_BYTES || !dma2d_can_access(dest, (rows - 1) * dest_step + len)) {
+        return false;
+    }
+
+    // The output can only be 16 or 32 bits per pixel, so 8-bit pixels are
+    // filled four at a time.
+    unsigned int psize;
+    if (bpp == 16) {
+        psize = 2;
+        DMA2D->OPFCCR = DMA2D_CM_RGB565;
+        DMA2D->OCOLR = col & 0xffff;
+    } else if (bpp == 8 && (((uintptr_t)dest | dest_step | len) & 3) == 0) {
+        psize = 4;
+        DMA2D->OPFCCR = DMA2D_CM_ARGB8888;
+        DMA2D->OCOLR = (col & 0xff) * 0x01010101;
+    } else {
+        return false;
+    }
+    if (((uintptr_t)dest | dest_step) & (psize - 1)) {
+        return false;
+    }
+    if (!dma2d_set_output(dest, dest_step, len, rows, psize)) {
+        return false;
+    }
+    return dma2d_run(DMA2D_MODE_R2M, dest, (rows - 1) * dest_step + len);
+}
+
+#endif // MICROPY_HW_ENABLE_DMA2D
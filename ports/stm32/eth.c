@@ -129,10 +129,19 @@ typedef struct _eth_t {
 
 static eth_dma_t eth_dma __attribute__((aligned(16384)));
 
+// Received frames are passed to lwIP in place, as custom pbufs that reference
+// the DMA buffer, and the RX descriptor is handed back to the DMA when lwIP
+// frees the pbuf.  So that the DMA always has somewhere to put new frames,
+// once this many buffers are held by lwIP further frames are copied instead.
+#define RX_BUF_ZERO_COPY_MAX (RX_BUF_NUM - 2)
+
+STATIC struct pbuf_custom eth_rx_pbuf[RX_BUF_NUM];
+STATIC uint32_t eth_rx_held; // bitmask of RX buffers currently held by lwIP
+
 eth_t eth_instance;
 
 STATIC void eth_mac_deinit(eth_t *self);
-STATIC void eth_process_frame(eth_t *self, size_t len, const uint8_t *buf);
+STATIC bool eth_process_frame(eth_t *self, size_t idx, size_t len, uint8_t *buf);
 
 STATIC void eth_phy_write(uint32_t reg, uint32_t val) {
     #if defined(STM32H7)
@@ -397,6 +406,7 @@ STATIC int eth_mac_init(eth_t *self) {
     ETH->DMARDLAR = (uint32_t)&eth_dma.rx_descr[0];
     #endif
     eth_dma.rx_descr_idx = 0;
+    eth_rx_held = 0;
 
     // Configure TX descriptor lists
     for (size_t i = 0; i < TX_BUF_NUM; ++i) {
@@ -468,6 +478,11 @@ STATIC int eth_mac_init(eth_t *self) {
     ETH->MACCR |=
         ETH_MACCR_TE // enable TX
         | ETH_MACCR_RE // enable RX
+        #if defined(STM32H7)
+        | ETH_MACCR_IPC // check IP, UDP and TCP checksums of incoming frames
+        #else
+        | ETH_MACCR_IPCO // check IP, UDP and TCP checksums of incoming frames
+        #endif
     ;
     mp_hal_delay_ms(2);
 
@@ -583,11 +598,10 @@ STATIC int eth_tx_buf_send(void) {
     return 0;
 }
 
-STATIC void eth_dma_rx_free(void) {
-    // Get RX descriptor, RX buffer and move to next one
-    eth_dma_rx_descr_t *rx_descr = &eth_dma.rx_descr[eth_dma.rx_descr_idx];
-    uint8_t *buf = &eth_dma.rx_buf[eth_dma.rx_descr_idx * RX_BUF_SIZE];
-    eth_dma.rx_descr_idx = (eth_dma.rx_descr_idx + 1) % RX_BUF_NUM;
+// Give an RX descriptor, and its buffer, back to the DMA.
+STATIC void eth_dma_rx_free(size_t idx) {
+    eth_dma_rx_descr_t *rx_descr = &eth_dma.rx_descr[idx];
+    uint8_t *buf = &eth_dma.rx_buf[idx * RX_BUF_SIZE];
 
     // Schedule to get next incoming frame
     #if defined(STM32H7)
@@ -601,19 +615,28 @@ STATIC void eth_dma_rx_free(void) {
             | RX_BUF_SIZE << RX_DESCR_1_RBS1_Pos // maximum buffer length
     ;
     rx_descr->rdes2 = (uint32_t)buf;
-    rx_descr->rdes3 = (uint32_t)&eth_dma.rx_descr[eth_dma.rx_descr_idx];
+    rx_descr->rdes3 = (uint32_t)&eth_dma.rx_descr[(idx + 1) % RX_BUF_NUM];
     rx_descr->rdes0 = 1 << RX_DESCR_0_OWN_Pos;  // owned by DMA
     #endif
 
-    // Notify ETH DMA that there is a new RX descriptor available
+    // Notify ETH DMA that there is a new RX descriptor available, which also
+    // restarts it if it was suspended waiting for this descriptor
     __DMB();
     #if defined(STM32H7)
-    ETH->DMACRDTPR = (uint32_t)&rx_descr[eth_dma.rx_descr_idx];
+    ETH->DMACRDTPR = (uint32_t)rx_descr;
     #else
     ETH->DMARPDR = 0;
     #endif
 }
 
+// Called by lwIP when it frees a pbuf that references an RX buffer.  This runs
+// at PendSV level, as does ETH_IRQHandler, so the two do not race.
+STATIC void eth_rx_pbuf_free(struct pbuf *p) {
+    size_t idx = (struct pbuf_custom *)p - &eth_rx_pbuf[0];
+    eth_rx_held &= ~(1 << idx);
+    eth_dma_rx_free(idx);
+}
+
 void ETH_IRQHandler(void) {
     #if defined(STM32H7)
     uint32_t sr = ETH->DMACSR;
@@ -631,6 +654,11 @@ void ETH_IRQHandler(void) {
         ETH->DMASR = ETH_DMASR_RS;
         #endif
         for (;;) {
+            size_t idx = eth_dma.rx_descr_idx;
+            if (eth_rx_held & (1 << idx)) {
+                // The DMA has wrapped around to a buffer still held by lwIP
+                break;
+            }
             #if defined(STM32H7)
             eth_dma_rx_descr_t *rx_descr_l = &eth_dma.rx_descr[eth_dma.rx_descr_idx];
             if (rx_descr_l->rdes3 & (1 << RX_DESCR_3_OWN_Pos)) {
@@ -658,9 +686,11 @@ void ETH_IRQHandler(void) {
             uint8_t *buf = (uint8_t *)rx_descr->rdes2;
             #endif
 
-            // Process frame
-            eth_process_frame(&eth_instance, len, buf);
-            eth_dma_rx_free();
+            // Process frame, and free the buffer now unless lwIP kept it
+            eth_dma.rx_descr_idx = (idx + 1) % RX_BUF_NUM;
+            if (!eth_process_frame(&eth_instance, idx, len, buf)) {
+                eth_dma_rx_free(idx);
+            }
         }
     }
 }
@@ -714,12 +744,11 @@ STATIC err_t eth_netif_init(struct netif *netif) {
     netif->output = etharp_output;
     netif->mtu = 1500;
     netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET | NETIF_FLAG_IGMP;
-    // Checksums only need to be checked on incoming frames, not computed on outgoing frames
+    // Checksums are inserted by the MAC on outgoing frames, and the IP, UDP and
+    // TCP checksums of incoming frames are checked by the MAC, which drops any
+    // frame that fails; the rest only need to be checked in software
     NETIF_SET_CHECKSUM_CTRL(netif,
-        NETIF_CHECKSUM_CHECK_IP
-        | NETIF_CHECKSUM_CHECK_UDP
-        | NETIF_CHECKSUM_CHECK_TCP
-        | NETIF_CHECKSUM_CHECK_ICMP
+        NETIF_CHECKSUM_CHECK_ICMP
         | NETIF_CHECKSUM_CHECK_ICMP6);
     return ERR_OK;
 }
@@ -762,19 +791,34 @@ STATIC void eth_lwip_deinit(eth_t *self) {
     MICROPY_PY_LWIP_EXIT
 }
 
-STATIC void eth_process_frame(eth_t *self, size_t len, const uint8_t *buf) {
+// Pass a received frame to lwIP.  Returns true if lwIP kept a reference to
+// the RX buffer, in which case it is freed later by eth_rx_pbuf_free.
+STATIC bool eth_process_frame(eth_t *self, size_t idx, size_t len, uint8_t *buf) {
     eth_trace(self, len, buf, NETUTILS_TRACE_NEWLINE);
 
     struct netif *netif = &self->netif;
-    if (netif->flags & NETIF_FLAG_LINK_UP) {
-        struct pbuf *p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
-        if (p != NULL) {
-            pbuf_take(p, buf, len);
-            if (netif->input(p, netif) != ERR_OK) {
-                pbuf_free(p);
-            }
+    if (!(netif->flags & NETIF_FLAG_LINK_UP)) {
+        return false;
+    }
+
+    struct pbuf *p;
+    bool zero_copy = __builtin_popcount(eth_rx_held) < RX_BUF_ZERO_COPY_MAX;
+    if (zero_copy) {
+        eth_rx_pbuf[idx].custom_free_function = eth_rx_pbuf_free;
+        p = pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &eth_rx_pbuf[idx], buf, RX_BUF_SIZE);
+        eth_rx_held |= 1 << idx;
+    } else {
+        p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+        if (p == NULL) {
+            return false;
         }
+        pbuf_take(p, buf, len);
+    }
+    if (netif->input(p, netif) != ERR_OK) {
+        // this frees the RX buffer if it was passed in place
+        pbuf_free(p);
     }
+    return zero_copy;
 }
 
 struct netif *eth_netif(eth_t *self) {
@@ -232,6 +232,8 @@ bool can_init(pyb_can_obj_t *can_obj, uint32_t mode, uint32_t prescaler, uint32_
 
 void can_deinit(pyb_can_obj_t *self) {
     self->is_enabled = false;
+    self->rxbuf[0] = NULL;
+    self->rxbuf[1] = NULL;
     HAL_FDCAN_DeInit(&self->can);
     if (self->can.Instance == FDCAN1) {
         HAL_NVIC_DisableIRQ(FDCAN1_IT0_IRQn);
@@ -369,6 +371,12 @@ STATIC void can_rx_irq_handler(uint can_id, uint fifo_id) {
     if (fifo_id == FDCAN_RX_FIFO0) {
         callback = self->rxcallback0;
         state = &self->rx_state0;
+        if (self->rxbuf[0] != NULL) {
+            // Move all pending messages to the software FIFO; the interrupts stay enabled
+            __HAL_FDCAN_CLEAR_FLAG(&self->can, RxFifo0ITs);
+            irq_reason = pyb_can_rxbuf_fill(self, fifo_id);
+            RxFifo0ITs = 0;
+        }
         if (RxFifo0ITs & FDCAN_FLAG_RX_FIFO0_NEW_MESSAGE) {
             __HAL_FDCAN_DISABLE_IT(&self->can, FDCAN_IT_RX_FIFO0_NEW_MESSAGE);
             __HAL_FDCAN_CLEAR_FLAG(&self->can, FDCAN_FLAG_RX_FIFO0_NEW_MESSAGE);
@@ -393,6 +401,12 @@ STATIC void can_rx_irq_handler(uint can_id, uint fifo_id) {
     } else {
         callback = self->rxcallback1;
         state = &self->rx_state1;
+        if (self->rxbuf[1] != NULL) {
+            // Move all pending messages to the software FIFO; the interrupts stay enabled
+            __HAL_FDCAN_CLEAR_FLAG(&self->can, RxFifo1ITs);
+            irq_reason = pyb_can_rxbuf_fill(self, fifo_id);
+            RxFifo1ITs = 0;
+        }
         if (RxFifo1ITs & FDCAN_FLAG_RX_FIFO1_NEW_MESSAGE) {
             __HAL_FDCAN_DISABLE_IT(&self->can, FDCAN_IT_RX_FIFO1_NEW_MESSAGE);
             __HAL_FDCAN_CLEAR_FLAG(&self->can, FDCAN_FLAG_RX_FIFO1_NEW_MESSAGE);
@@ -2,6 +2,7 @@
 #define MICROPY_INCLUDED_STM32_LWIP_LWIPOPTS_H
 
 #include <stdint.h>
+#include "py/mpconfig.h"
 
 // This protection is not needed, instead we execute all lwIP code at PendSV priority
 #define SYS_ARCH_DECL_PROTECT(lev) do { } while (0)
@@ -39,38 +40,37 @@
 
 #define SO_REUSE                        1
 #define TCP_LISTEN_BACKLOG              1
+#define LWIP_SUPPORT_CUSTOM_PBUF        1 // for zero-copy RX in eth.c
 
 extern uint32_t rng_get(void);
 #define LWIP_RAND() rng_get()
 
-// default
-// lwip takes 15800 bytes; TCP d/l: 380k/s local, 7.2k/s remote
-// TCP u/l is very slow
-
-#if 0
-// lwip takes 19159 bytes; TCP d/l and u/l are around 320k/s on local network
-#define MEM_SIZE (5000)
-#define TCP_WND (4 * TCP_MSS)
-#define TCP_SND_BUF (4 * TCP_MSS)
+// Buffer sizes, which a board can override in its mpconfigboard.h to trade RAM
+// for TCP throughput.  Measured on stm32 with a local network:
+// - MEM_SIZE=5000, MSS=536, WND=SND_BUF=4*MSS: lwip takes 19159 bytes, TCP d/l
+//   and u/l are around 320k/s
+// - the defaults: lwip takes 26700 bytes, TCP dl/ul are around 750/600 k/s
+// - MEM_SIZE=16000, MSS=1460, WND=SND_BUF=8*MSS: lwip takes 45600 bytes, TCP
+//   dl/ul are around 1200/1000 k/s
+#ifndef MICROPY_HW_LWIP_MEM_SIZE
+#define MICROPY_HW_LWIP_MEM_SIZE (8000)
 #endif
-
-#if 1
-// lwip takes 26700 bytes; TCP dl/ul are around 750/600 k/s on local network
-#define MEM_SIZE (8000)
-#define TCP_MSS (800)
-#define TCP_WND (8 * TCP_MSS)
-#define TCP_SND_BUF (8 * TCP_MSS)
-#define MEMP_NUM_TCP_SEG (32)
+#ifndef MICROPY_HW_LWIP_TCP_MSS
+#define MICROPY_HW_LWIP_TCP_MSS (800)
 #endif
-
-#if 0
-// lwip takes 45600 bytes; TCP dl/ul are around 1200/1000 k/s on local network
-#define MEM_SIZE (16000)
-#define TCP_MSS (1460)
-#define TCP_WND (8 * TCP_MSS)
-#define TCP_SND_BUF (8 * TCP_MSS)
-#define MEMP_NUM_TCP_SEG (32)
+#ifndef MICROPY_HW_LWIP_TCP_WND
+#define MICROPY_HW_LWIP_TCP_WND (8 * MICROPY_HW_LWIP_TCP_MSS)
 #endif
+#ifndef MICROPY_HW_LWIP_TCP_SND_BUF
+#define MICROPY_HW_LWIP_TCP_SND_BUF (8 * MICROPY_HW_LWIP_TCP_MSS)
+#endif
+
+#define MEM_SIZE (MICROPY_HW_LWIP_MEM_SIZE)
+#define TCP_MSS (MICROPY_HW_LWIP_TCP_MSS)
+#define TCP_WND (MICROPY_HW_LWIP_TCP_WND)
+#define TCP_SND_BUF (MICROPY_HW_LWIP_TCP_SND_BUF)
+// Enough segments for a full send queue, which lwIP checks at compile time
+#define MEMP_NUM_TCP_SEG ((4 * TCP_SND_BUF + TCP_MSS - 1) / TCP_MSS)
 
 typedef uint32_t sys_prot_t;
 
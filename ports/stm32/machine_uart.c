@@ -152,6 +152,14 @@ STATIC void pyb_uart_print(const mp_print_t *print, mp_obj_t self_in, mp_print_k
         mp_printf(print, ", timeout=%u, timeout_char=%u, rxbuf=%u",
             self->timeout, self->timeout_char,
             self->read_buf_len == 0 ? 0 : self->read_buf_len - 1); // -1 to adjust for usable length of buffer
+        #if MICROPY_HW_UART_DMA
+        if (self->rx_dma_descr != NULL) {
+            mp_print_str(print, ", rxdma=True");
+        }
+        if (self->tx_dma_descr != NULL) {
+            mp_print_str(print, ", txdma=True");
+        }
+        #endif
         if (self->mp_irq_trigger != 0) {
             mp_printf(print, "; irq=0x%x", self->mp_irq_trigger);
         }
@@ -171,6 +179,8 @@ STATIC void pyb_uart_print(const mp_print_t *print, mp_obj_t self_in, mp_print_k
 ///   - `timeout_char` is the timeout in milliseconds to wait between characters.
 ///   - `flow` is RTS | CTS where RTS == 256, CTS == 512
 ///   - `read_buf_len` is the character length of the read buffer (0 to disable).
+///   - `rxdma` fills the read buffer using circular DMA instead of an interrupt per char.
+///   - `txdma` sends using DMA.
 STATIC mp_obj_t pyb_uart_init_helper(pyb_uart_obj_t *self, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_baudrate, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 9600} },
@@ -182,11 +192,18 @@ STATIC mp_obj_t pyb_uart_init_helper(pyb_uart_obj_t *self, size_t n_args, const
         { MP_QSTR_timeout_char, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
         { MP_QSTR_rxbuf, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -1} },
         { MP_QSTR_read_buf_len, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 64} }, // legacy
+        #if MICROPY_HW_UART_DMA
+        { MP_QSTR_rxdma, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_txdma, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        #endif
     };
 
     // parse args
     struct {
         mp_arg_val_t baudrate, bits, parity, stop, flow, timeout, timeout_char, rxbuf, read_buf_len;
+        #if MICROPY_HW_UART_DMA
+        mp_arg_val_t rxdma, txdma;
+        #endif
     } args;
     mp_arg_parse_all(n_args, pos_args, kw_args,
         MP_ARRAY_SIZE(allowed_args), allowed_args, (mp_arg_val_t *)&args);
@@ -235,6 +252,13 @@ STATIC mp_obj_t pyb_uart_init_helper(pyb_uart_obj_t *self, size_t n_args, const
     // Save attach_to_repl setting because uart_init will disable it.
     bool attach_to_repl = self->attached_to_repl;
 
+    #if MICROPY_HW_UART_DMA
+    // Stop any DMA before the UART and its read buffer are changed.
+    if (self->is_enabled) {
+        uart_set_dma(self, false, false);
+    }
+    #endif
+
     // init UART (if it fails, it's because the port doesn't exist)
     if (!uart_init(self, baudrate, bits, parity, stop, flow)) {
         mp_raise_msg_varg(&mp_type_ValueError, MP_ERROR_TEXT("UART(%d) doesn't exist"), self->uart_id);
@@ -279,6 +303,12 @@ STATIC mp_obj_t pyb_uart_init_helper(pyb_uart_obj_t *self, size_t n_args, const
         }
     }
 
+    #if MICROPY_HW_UART_DMA
+    if ((args.rxdma.u_bool || args.txdma.u_bool) && (self->is_static || !uart_set_dma(self, args.rxdma.u_bool, args.txdma.u_bool))) {
+        mp_raise_ValueError(MP_ERROR_TEXT("DMA not supported with these UART settings"));
+    }
+    #endif
+
     // compute actual baudrate that was configured
     uint32_t actual_baudrate = uart_get_baudrate(self);
 
@@ -65,11 +65,13 @@
 #include "gccollect.h"
 #include "factoryreset.h"
 #include "modmachine.h"
-#include "softtimer.h"
+#include "shared/runtime/softtimer.h"
 #include "i2c.h"
 #include "spi.h"
 #include "uart.h"
 #include "timer.h"
+#include "dma.h"
+#include "tcm.h"
 #include "led.h"
 #include "pin.h"
 #include "extint.h"
@@ -82,6 +84,7 @@
 #include "rng.h"
 #include "accel.h"
 #include "servo.h"
+#include "adc.h"
 #include "dac.h"
 #include "can.h"
 
@@ -316,6 +319,11 @@ STATIC bool init_sdcard_fs(void) {
 #endif
 
 void stm32_main(uint32_t reset_mode) {
+    #if MICROPY_HW_ENABLE_TCM_DATA
+    // Zero the data placed in TCM, which includes the VM state
+    tcm_init0();
+    #endif
+
     #if !defined(STM32F0) && defined(MICROPY_HW_VTOR)
     // Change IRQ vector table if configured differently
     SCB->VTOR = MICROPY_HW_VTOR;
@@ -494,10 +502,14 @@ soft_reset:
     mp_stack_set_limit((char *)&_estack - (char *)&_sstack - 1024);
 
     // GC init
+    #if MICROPY_HW_ENABLE_TCM_DATA
+    tcm_gc_init(MICROPY_HEAP_START, MICROPY_HEAP_END);
+    #else
     gc_init(MICROPY_HEAP_START, MICROPY_HEAP_END);
+    #endif
 
     #if MICROPY_ENABLE_PYSTACK
-    static mp_obj_t pystack[384];
+    static mp_obj_t pystack[384] MICROPY_HW_TCM_BSS_ATTR;
     mp_pystack_init(pystack, &pystack[384]);
     #endif
 
@@ -666,6 +678,15 @@ soft_reset_exit:
     #if MICROPY_HW_ENABLE_DAC
     dac_deinit_all();
     #endif
+    #if MICROPY_HW_ADC_DMA
+    adc_stream_deinit();
+    #endif
+    #if MICROPY_PY_STM_DMA
+    stm_dma_deinit_all();
+    #endif
+    #if MICROPY_HW_ENABLE_ITCM_NATIVE
+    tcm_deinit();
+    #endif
     machine_deinit();
 
     #if MICROPY_PY_THREAD
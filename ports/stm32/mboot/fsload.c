@@ -37,6 +37,13 @@
 #define MBOOT_FSLOAD_DEFAULT_BLOCK_SIZE (4096)
 #endif
 
+// Size of the pieces that element data is decompressed and written to flash in.
+// Larger pieces amortise the per-call cost of the decompressor, flash driver and
+// progress indication.  Must be at least 274 bytes to hold the target header.
+#ifndef MBOOT_FSLOAD_CHUNK_SIZE
+#define MBOOT_FSLOAD_CHUNK_SIZE (4096)
+#endif
+
 #if MBOOT_FSLOAD
 
 #if !(MBOOT_VFS_FAT || MBOOT_VFS_LFS1 || MBOOT_VFS_LFS2)
@@ -73,10 +80,12 @@ static inline int input_stream_read(size_t len, uint8_t *buf) {
 }
 #endif
 
+static uint8_t fsload_buf[MBOOT_FSLOAD_CHUNK_SIZE] __attribute__((aligned(4))) SECTION_NOZERO_BSS;
+
 static int fsload_program_file(bool write_to_flash) {
     // Parse DFU
     uint32_t crc = 0xffffffff;
-    uint8_t buf[512];
+    uint8_t *buf = fsload_buf;
     size_t file_offset;
 
     // Read file header, <5sBIB
@@ -150,8 +159,8 @@ static int fsload_program_file(bool write_to_flash) {
         // Read element data and possibly write to flash
         for (uint32_t s = elem_size; s;) {
             uint32_t l = s;
-            if (l > sizeof(buf)) {
-                l = sizeof(buf);
+            if (l > sizeof(fsload_buf)) {
+                l = sizeof(fsload_buf);
             }
             res = input_stream_read(l, buf);
             if (res != l) {
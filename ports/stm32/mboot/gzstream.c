@@ -33,13 +33,20 @@
 
 #if MBOOT_FSLOAD || MBOOT_ENABLE_PACKING
 
+// The maximum window size of deflate, so any gzip stream can be decompressed.
 #define DICT_SIZE (1 << 15)
 
+// Size of the reads from the underlying stream (the filesystem).  Larger reads
+// mean fewer, and for SD cards multi-block, transfers.
+#ifndef MBOOT_GZSTREAM_READ_SIZE
+#define MBOOT_GZSTREAM_READ_SIZE (4096)
+#endif
+
 typedef struct _gz_stream_t {
     void *stream_data;
     stream_read_t stream_read;
     struct uzlib_uncomp tinf;
-    uint8_t buf[512];
+    uint8_t buf[MBOOT_GZSTREAM_READ_SIZE];
     uint8_t dict[DICT_SIZE];
 } gz_stream_t;
 
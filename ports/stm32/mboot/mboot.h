@@ -136,6 +136,8 @@ enum {
     MBOOT_ERRNO_PACK_INVALID_VERSION,
     MBOOT_ERRNO_PACK_DECRYPT_FAILED,
     MBOOT_ERRNO_PACK_SIGN_FAILED,
+    MBOOT_ERRNO_PACK_DELTA_NO_BASE,
+    MBOOT_ERRNO_PACK_DELTA_BASE_ERASED,
 
     MBOOT_ERRNO_VFS_FAT_MOUNT_FAILED = 240,
     MBOOT_ERRNO_VFS_FAT_OPEN_FAILED,
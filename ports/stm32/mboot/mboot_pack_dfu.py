@@ -54,6 +54,11 @@ MBOOT_PACK_CHUNK_META = 0
 MBOOT_PACK_CHUNK_FULL_SIG = 1
 MBOOT_PACK_CHUNK_FW_RAW = 2
 MBOOT_PACK_CHUNK_FW_GZIP = 3
+MBOOT_PACK_CHUNK_DELTA_BASE = 4
+MBOOT_PACK_CHUNK_FW_DELTA = 5
+
+# Shortest run of bytes that is looked up in the base image when making a delta.
+DELTA_MIN_MATCH = 8
 
 
 class Keys:
@@ -135,6 +140,86 @@ def compress(data):
     return c.compress(data) + c.flush()
 
 
+def delta_index(base):
+    # Map each run of DELTA_MIN_MATCH bytes to its first offset in the base image.
+    index = {}
+    for i in range(len(base) - DELTA_MIN_MATCH, -1, -1):
+        index[base[i : i + DELTA_MIN_MATCH]] = i
+    return index
+
+
+def delta_match_length(base, base_offset, data, offset):
+    # Extend a match forwards in the same way as bsdiff, allowing mismatched bytes
+    # (which go into the diff) for as long as most of the bytes agree.
+    limit = min(len(base) - base_offset, len(data) - offset)
+    score = 0
+    best_score = 0
+    best_len = 0
+    for i in range(limit):
+        if base[base_offset + i] == data[offset + i]:
+            score += 1
+        else:
+            score -= 1
+        if score > best_score:
+            best_score = score
+            best_len = i + 1
+        elif score < best_score - 64:
+            break
+    return best_len
+
+
+def delta_encode(base, index, data):
+    """Encode data as delta records against base, see mboot_pack_delta_record_t."""
+    # Find the parts of the data that (mostly) match the base.
+    matches = []
+    offset = 0
+    shift = None
+    while offset + DELTA_MIN_MATCH <= len(data):
+        key = data[offset : offset + DELTA_MIN_MATCH]
+        if shift is not None and base[offset + shift : offset + shift + DELTA_MIN_MATCH] == key:
+            # Continue with the same alignment as the previous match.
+            base_offset = offset + shift
+        else:
+            base_offset = index.get(key)
+        if base_offset is None:
+            offset += 1
+            continue
+        length = delta_match_length(base, base_offset, data, offset)
+        matches.append((offset, base_offset, length))
+        shift = base_offset - offset
+        offset += length
+
+    # Each record is a match followed by the data up to the next match.
+    if not matches or matches[0][0] > 0:
+        matches.insert(0, (0, 0, 0))
+    records = []
+    for i, (offset, base_offset, length) in enumerate(matches):
+        extra_end = matches[i + 1][0] if i + 1 < len(matches) else len(data)
+        records.append(struct.pack("<III", length, extra_end - offset - length, base_offset))
+        records.append(
+            bytes(
+                (data[offset + j] - base[base_offset + j]) & 0xFF for j in range(length)
+            )
+        )
+        records.append(data[offset + length : extra_end])
+    return b"".join(records)
+
+
+def delta_apply(base, records):
+    data = []
+    i = 0
+    while i < len(records):
+        diff_len, extra_len, base_offset = struct.unpack_from("<III", records, i)
+        i += 12
+        data.append(
+            bytes((base[base_offset + j] + records[i + j]) & 0xFF for j in range(diff_len))
+        )
+        i += diff_len
+        data.append(records[i : i + extra_len])
+        i += extra_len
+    return b"".join(data)
+
+
 def encrypt(keys, data):
     return pyhy.hydro_secretbox_encrypt(data, 0, MBOOT_PACK_HYDRO_CONTEXT, keys.secretbox)
 
@@ -179,6 +264,27 @@ def pack_dfu(keys, args):
 
     # Build list of packed chunks.
     target = []
+
+    if args.delta_base:
+        # The delta base chunk comes first, so the device checks that it has the
+        # right firmware before anything is erased.
+        if args.delta_addr is None:
+            raise SystemExit("ERROR: --delta-addr is required with --delta-base")
+        _, base_elems = dfu_read(args.delta_base)
+        base_elems = sorted(base_elems, key=lambda e: e[0])
+        base_fw = b"".join(data for _, data in base_elems)
+        base_index = delta_index(base_fw)
+        delta_addr = int(args.delta_addr, 0)
+        for address, fw in base_elems + elems:
+            if address < delta_addr + len(base_fw) and delta_addr < address + len(fw):
+                raise SystemExit("ERROR: delta address overlaps the firmware")
+        base_payload = b"".join(struct.pack("<II", address, len(fw)) for address, fw in base_elems)
+        base_payload += sign(keys, base_fw)
+        base_chunk = pack_chunk(keys, MBOOT_PACK_CHUNK_DELTA_BASE, delta_addr, base_payload)
+        target.append({"address": delta_addr, "data": base_chunk})
+    else:
+        base_fw = None
+
     full_fw = b""
     full_signature_payload = b""
     for address, fw in elems:
@@ -190,15 +296,16 @@ def pack_dfu(keys, args):
         # then register them as individual DFU targets.
         for i, chunk in enumerate(data_chunks(fw, chunk_size)):
             chunk_addr = address + i * chunk_size
-            if args.gzip:
+            if base_fw is not None:
+                chunk = compress(delta_encode(base_fw, base_index, chunk))
+                format_ = MBOOT_PACK_CHUNK_FW_DELTA
+            elif args.gzip:
                 chunk = compress(chunk)
+                format_ = MBOOT_PACK_CHUNK_FW_GZIP
+            else:
+                format_ = MBOOT_PACK_CHUNK_FW_RAW
             chunk = encrypt(keys, chunk)
-            chunk = pack_chunk(
-                keys,
-                MBOOT_PACK_CHUNK_FW_GZIP if args.gzip else MBOOT_PACK_CHUNK_FW_RAW,
-                chunk_addr,
-                chunk,
-            )
+            chunk = pack_chunk(keys, format_, chunk_addr, chunk)
             target.append({"address": chunk_addr, "data": chunk})
 
     # Add full signature to targets, at location following the last chunk.
@@ -214,20 +321,18 @@ def pack_dfu(keys, args):
     dfu.build(args.outfile[0], [target], vid_pid)
 
     # Verify the packed DFU file.
-    verify_pack_dfu(keys, args.outfile[0])
+    verify_pack_dfu(keys, args.outfile[0], args.delta_base)
 
 
-def verify_pack_dfu(keys, filename):
+def verify_pack_dfu(keys, filename, delta_base=None):
     """Verify packed dfu file against keys. Gathers decrypted binary data."""
     full_sig = pyhy.hydro_sign(MBOOT_PACK_HYDRO_CONTEXT)
     _, elems = dfu_read(filename)
     base_addr = None
     binary_data = b""
+    base_fw = None
 
     for addr, data in elems:
-        if base_addr is None:
-            base_addr = addr
-
         header = struct.unpack("<BBBBII", data[:12])
         chunk = data[12 : 12 + header[5]]
         sig = data[12 + header[5] :]
@@ -238,13 +343,26 @@ def verify_pack_dfu(keys, filename):
 
         if header[1] == MBOOT_PACK_CHUNK_FULL_SIG:
             actual_sig = chunk[-64:]
+        elif header[1] == MBOOT_PACK_CHUNK_DELTA_BASE:
+            if delta_base is None:
+                raise SystemExit("ERROR: a delta DFU file needs --delta-base")
+            _, base_elems = dfu_read(delta_base)
+            base_fw = b"".join(data for _, data in sorted(base_elems, key=lambda e: e[0]))
+            base_sig = pyhy.hydro_sign(MBOOT_PACK_HYDRO_CONTEXT)
+            base_sig.update(base_fw)
+            assert base_sig.final_verify(chunk[-64:], keys.sign_pk)
         else:
+            if base_addr is None:
+                base_addr = addr
             chunk = pyhy.hydro_secretbox_decrypt(
                 chunk, 0, MBOOT_PACK_HYDRO_CONTEXT, keys.secretbox
             )
             assert chunk is not None
             if header[1] == MBOOT_PACK_CHUNK_FW_GZIP:
                 chunk = zlib.decompress(chunk, wbits=-15)
+            elif header[1] == MBOOT_PACK_CHUNK_FW_DELTA:
+                assert base_fw is not None
+                chunk = delta_apply(base_fw, zlib.decompress(chunk, wbits=-15))
             full_sig.update(chunk)
             assert addr == base_addr + len(binary_data)
             binary_data += chunk
@@ -259,7 +377,7 @@ def unpack_dfu(keys, args):
     keys.load()
 
     # Build a DFU file from the decrypted binary data.
-    data = verify_pack_dfu(keys, args.infile[0])
+    data = verify_pack_dfu(keys, args.infile[0], args.delta_base)
     dfu.build(args.outfile[0], [data])
 
 
@@ -273,12 +391,19 @@ def main():
 
     parser_ed = subparsers.add_parser("pack-dfu", help="encrypt and sign a DFU file")
     parser_ed.add_argument("-z", "--gzip", action="store_true", help="compress chunks")
+    parser_ed.add_argument(
+        "--delta-base", help="make a delta against this DFU file of the current firmware"
+    )
+    parser_ed.add_argument(
+        "--delta-addr", help="address the device copies the current firmware to for a delta"
+    )
     parser_ed.add_argument("chunk_size", nargs=1, help="maximum size in bytes of each chunk")
     parser_ed.add_argument("infile", nargs=1, help="input DFU file")
     parser_ed.add_argument("outfile", nargs=1, help="output DFU file")
     parser_ed.set_defaults(func=pack_dfu)
 
     parser_dd = subparsers.add_parser("unpack-dfu", help="decrypt a signed/encrypted DFU file")
+    parser_dd.add_argument("--delta-base", help="DFU file that a delta was made against")
     parser_dd.add_argument("infile", nargs=1, help="input packed DFU file")
     parser_dd.add_argument("outfile", nargs=1, help="output DFU file")
     parser_dd.set_defaults(func=unpack_dfu)
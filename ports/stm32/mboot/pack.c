@@ -42,6 +42,12 @@
 #define MBOOT_PACK_GZIP_BUFFER_SIZE (2048)
 #endif
 
+// Delta chunks rebuild the firmware into this buffer before it is written to flash.
+// It must be a multiple of the flash write size.
+#ifndef MBOOT_PACK_DELTA_BUFFER_SIZE
+#define MBOOT_PACK_DELTA_BUFFER_SIZE (1024)
+#endif
+
 // State to manage automatic flash erasure.
 static uint32_t erased_base_addr;
 static uint32_t erased_top_addr;
@@ -64,11 +70,19 @@ static uint8_t firmware_head[8];
 // Flag to indicate that firmware_head contains valid data.
 static bool firmware_head_valid;
 
+// Location and length of the copy of the base image that delta chunks apply to.
+static uint32_t delta_base_addr;
+static uint32_t delta_base_len;
+
+// Temporary buffer for firmware rebuilt from a delta chunk.
+static uint8_t delta_buf[MBOOT_PACK_DELTA_BUFFER_SIZE] __attribute__((aligned(8)));
+
 void mboot_pack_init(void) {
     erased_base_addr = 0;
     erased_top_addr = 0;
     firmware_chunk_base_addr = 0;
     firmware_head_valid = false;
+    delta_base_len = 0;
 }
 
 // In encrypted mode the erase is automatically managed.
@@ -114,20 +128,12 @@ static int mboot_pack_commit_chunk(uint32_t addr, uint8_t *data, size_t len) {
     return hw_write(addr, data, len);
 }
 
-// Handle a chunk with the full firmware signature.
-static int mboot_pack_handle_full_sig(void) {
-    if (firmware_chunk_buf.header.length < hydro_sign_BYTES) {
-        return -MBOOT_ERRNO_PACK_INVALID_CHUNK;
-    }
-
-    uint8_t *full_sig = &firmware_chunk_buf.data[firmware_chunk_buf.header.length - hydro_sign_BYTES];
-    uint32_t *region_data = (uint32_t *)&firmware_chunk_buf.data[0];
-    size_t num_regions = (full_sig - (uint8_t *)region_data) / sizeof(uint32_t) / 2;
-
+// Compute the signature of the given regions of flash and check it against sig.
+static int mboot_pack_verify_regions(const uint32_t *region_data, size_t num_regions, const uint8_t *sig) {
     uint8_t *buf = decrypted_buf;
     const size_t buf_alloc = sizeof(decrypted_buf);
 
-    // Compute the signature of the full firmware.
+    // Compute the signature of the regions.
     hydro_sign_state sign_state;
     hydro_sign_init(&sign_state, MBOOT_PACK_HYDRO_CONTEXT);
     for (size_t region = 0; region < num_regions; ++region) {
@@ -150,14 +156,33 @@ static int mboot_pack_handle_full_sig(void) {
         }
     }
 
-    // Verify the signature of the full firmware.
-    int ret = hydro_sign_final_verify(&sign_state, full_sig, mboot_pack_sign_public_key);
+    // Verify the signature of the regions.
+    int ret = hydro_sign_final_verify(&sign_state, sig, mboot_pack_sign_public_key);
     if (ret != 0) {
         dfu_context.status = DFU_STATUS_ERROR_VERIFY;
         dfu_context.error = MBOOT_ERROR_STR_INVALID_SIG_IDX;
         return -MBOOT_ERRNO_PACK_SIGN_FAILED;
     }
 
+    return 0;
+}
+
+// Handle a chunk with the full firmware signature.
+static int mboot_pack_handle_full_sig(void) {
+    if (firmware_chunk_buf.header.length < hydro_sign_BYTES) {
+        return -MBOOT_ERRNO_PACK_INVALID_CHUNK;
+    }
+
+    uint8_t *full_sig = &firmware_chunk_buf.data[firmware_chunk_buf.header.length - hydro_sign_BYTES];
+    uint32_t *region_data = (uint32_t *)&firmware_chunk_buf.data[0];
+    size_t num_regions = (full_sig - (uint8_t *)region_data) / sizeof(uint32_t) / 2;
+
+    // Verify the signature of the full firmware.
+    int ret = mboot_pack_verify_regions(region_data, num_regions, full_sig);
+    if (ret != 0) {
+        return ret;
+    }
+
     // Full firmware passed the signature check.
 
     if (firmware_head_valid) {
@@ -168,6 +193,172 @@ static int mboot_pack_handle_full_sig(void) {
     return ret;
 }
 
+// Handle a chunk describing the base image that the following delta chunks apply to.
+// It has the same layout as the full signature chunk, but signs the firmware that is
+// currently in flash.  This check is also done on a dry run so that a delta made
+// against a different firmware is rejected before anything is erased.  The base is
+// then copied to the chunk address, because the delta chunks keep reading from it
+// while the firmware is overwritten.
+static int mboot_pack_handle_delta_base(bool dry_run) {
+    if (firmware_chunk_buf.header.length < hydro_sign_BYTES) {
+        return -MBOOT_ERRNO_PACK_INVALID_CHUNK;
+    }
+
+    uint8_t *base_sig = &firmware_chunk_buf.data[firmware_chunk_buf.header.length - hydro_sign_BYTES];
+    uint32_t *region_data = (uint32_t *)&firmware_chunk_buf.data[0];
+    size_t num_regions = (base_sig - (uint8_t *)region_data) / sizeof(uint32_t) / 2;
+
+    // Verify that the current firmware is the base of the delta.
+    int ret = mboot_pack_verify_regions(region_data, num_regions, base_sig);
+    if (ret != 0 || dry_run) {
+        return ret;
+    }
+
+    // The copy must not overlap the base itself.
+    uint32_t copy_addr = firmware_chunk_buf.header.address;
+    uint32_t copy_len = 0;
+    for (size_t region = 0; region < num_regions; ++region) {
+        copy_len += region_data[2 * region + 1];
+    }
+    for (size_t region = 0; region < num_regions; ++region) {
+        uint32_t addr = region_data[2 * region];
+        uint32_t len = region_data[2 * region + 1];
+        if (addr < copy_addr + copy_len && copy_addr < addr + len) {
+            dfu_context.status = DFU_STATUS_ERROR_ADDRESS;
+            dfu_context.error = MBOOT_ERROR_STR_INVALID_ADDRESS_IDX;
+            return -MBOOT_ERRNO_PACK_INVALID_ADDR;
+        }
+    }
+
+    // Copy the base, region after region.
+    uint32_t dest = copy_addr;
+    for (size_t region = 0; region < num_regions; ++region) {
+        uint32_t addr = region_data[2 * region];
+        uint32_t len = region_data[2 * region + 1];
+        while (len) {
+            uint32_t l = len <= sizeof(decrypted_buf) ? len : sizeof(decrypted_buf);
+            hw_read(addr, l, decrypted_buf);
+            ret = mboot_pack_commit_chunk(dest, decrypted_buf, l);
+            if (ret != 0) {
+                return ret;
+            }
+            addr += l;
+            dest += l;
+            len -= l;
+        }
+    }
+
+    delta_base_addr = copy_addr;
+    delta_base_len = copy_len;
+
+    // Start the erase tracking afresh for the firmware, so that the copy of the
+    // base only counts as erased once the firmware itself grows over it.
+    erased_base_addr = 0;
+    erased_top_addr = 0;
+
+    return 0;
+}
+
+// Read part of the copy of the base image, which must not yet be erased.
+static int mboot_pack_delta_read_base(uint32_t offset, uint8_t *buf, size_t len) {
+    uint32_t addr = delta_base_addr + offset;
+    if (addr < erased_top_addr && erased_base_addr < addr + len) {
+        dfu_context.status = DFU_STATUS_ERROR_ADDRESS;
+        dfu_context.error = MBOOT_ERROR_STR_INVALID_ADDRESS_IDX;
+        return -MBOOT_ERRNO_PACK_DELTA_BASE_ERASED;
+    }
+    hw_read(addr, len, buf);
+    return 0;
+}
+
+// Decompress the delta records of a chunk and apply them to the base image,
+// writing the result to flash starting at addr.
+static int mboot_pack_apply_delta(uint32_t addr, const uint8_t *data, size_t len) {
+    if (delta_base_len == 0) {
+        return -MBOOT_ERRNO_PACK_DELTA_NO_BASE;
+    }
+
+    // The current record, which is active once all of its header is received.
+    mboot_pack_delta_record_t rec = {0};
+    size_t rec_len = 0;
+    size_t out_len = 0;
+
+    gz_stream_init_from_raw_data(data, len);
+    for (;;) {
+        int read = gz_stream_read(sizeof(uncompressed_buf), uncompressed_buf);
+        if (read == 0) {
+            break; // finished decompressing
+        } else if (read < 0) {
+            return -MBOOT_ERRNO_GUNZIP_FAILED; // error reading
+        }
+
+        const uint8_t *in = uncompressed_buf;
+        while (read > 0) {
+            size_t n;
+            if (rec_len < sizeof(rec)) {
+                // Accumulate the record header.
+                n = sizeof(rec) - rec_len;
+                n = n <= (size_t)read ? n : (size_t)read;
+                memcpy((uint8_t *)&rec + rec_len, in, n);
+                rec_len += n;
+                if (rec_len == sizeof(rec)) {
+                    if (rec.diff_len > delta_base_len || rec.base_offset > delta_base_len - rec.diff_len) {
+                        return -MBOOT_ERRNO_PACK_INVALID_CHUNK;
+                    }
+                    if (rec.diff_len == 0 && rec.extra_len == 0) {
+                        rec_len = 0;
+                    }
+                }
+            } else {
+                n = sizeof(delta_buf) - out_len;
+                n = n <= (size_t)read ? n : (size_t)read;
+                if (rec.diff_len) {
+                    // Add the diff bytes to the base.
+                    n = n <= rec.diff_len ? n : rec.diff_len;
+                    int ret = mboot_pack_delta_read_base(rec.base_offset, delta_buf + out_len, n);
+                    if (ret != 0) {
+                        return ret;
+                    }
+                    for (size_t i = 0; i < n; ++i) {
+                        delta_buf[out_len + i] += in[i];
+                    }
+                    rec.base_offset += n;
+                    rec.diff_len -= n;
+                } else {
+                    // Copy the extra bytes.
+                    n = n <= rec.extra_len ? n : rec.extra_len;
+                    memcpy(delta_buf + out_len, in, n);
+                    rec.extra_len -= n;
+                }
+                if (rec.diff_len == 0 && rec.extra_len == 0) {
+                    rec_len = 0;
+                }
+                out_len += n;
+                if (out_len == sizeof(delta_buf)) {
+                    int ret = mboot_pack_commit_chunk(addr, delta_buf, out_len);
+                    if (ret != 0) {
+                        return ret;
+                    }
+                    addr += out_len;
+                    out_len = 0;
+                }
+            }
+            in += n;
+            read -= n;
+        }
+    }
+
+    if (rec_len != 0) {
+        // Stream ended part way through a record.
+        return -MBOOT_ERRNO_PACK_INVALID_CHUNK;
+    }
+
+    if (out_len == 0) {
+        return 0;
+    }
+    return mboot_pack_commit_chunk(addr, delta_buf, out_len);
+}
+
 // Handle a chunk with firmware data.
 static int mboot_pack_handle_firmware(void) {
     const uint8_t *fw_data = &firmware_chunk_buf.data[0];
@@ -184,7 +375,10 @@ static int mboot_pack_handle_firmware(void) {
     size_t len = fw_len - hydro_secretbox_HEADERBYTES;
     uint32_t addr = firmware_chunk_buf.header.address;
 
-    if (firmware_chunk_buf.header.format == MBOOT_PACK_CHUNK_FW_GZIP) {
+    if (firmware_chunk_buf.header.format == MBOOT_PACK_CHUNK_FW_DELTA) {
+        // Rebuild the chunk data from the base image.
+        return mboot_pack_apply_delta(addr, decrypted_buf, len);
+    } else if (firmware_chunk_buf.header.format == MBOOT_PACK_CHUNK_FW_GZIP) {
         // Decompress chunk data.
         gz_stream_init_from_raw_data(decrypted_buf, len);
         for (;;) {
@@ -274,6 +468,11 @@ int mboot_pack_write(uint32_t addr, const uint8_t *src8, size_t len, bool dry_ru
     }
 
     // Signature passed, we have valid chunk.
+    if (firmware_chunk_buf.header.format == MBOOT_PACK_CHUNK_DELTA_BASE) {
+        // The base is checked even on a dry run.
+        return mboot_pack_handle_delta_base(dry_run);
+    }
+
     if (dry_run) {
         return 0;
     }
@@ -284,7 +483,8 @@ int mboot_pack_write(uint32_t addr, const uint8_t *src8, size_t len, bool dry_ru
     } else if (firmware_chunk_buf.header.format == MBOOT_PACK_CHUNK_FULL_SIG) {
         return mboot_pack_handle_full_sig();
     } else if (firmware_chunk_buf.header.format == MBOOT_PACK_CHUNK_FW_RAW
-               || firmware_chunk_buf.header.format == MBOOT_PACK_CHUNK_FW_GZIP) {
+               || firmware_chunk_buf.header.format == MBOOT_PACK_CHUNK_FW_GZIP
+               || firmware_chunk_buf.header.format == MBOOT_PACK_CHUNK_FW_DELTA) {
         return mboot_pack_handle_firmware();
     } else {
         // Unsupported contents.
@@ -51,8 +51,19 @@ enum mboot_pack_chunk_format {
     MBOOT_PACK_CHUNK_FULL_SIG = 1,
     MBOOT_PACK_CHUNK_FW_RAW = 2,
     MBOOT_PACK_CHUNK_FW_GZIP = 3,
+    MBOOT_PACK_CHUNK_DELTA_BASE = 4,
+    MBOOT_PACK_CHUNK_FW_DELTA = 5,
 };
 
+// A FW_DELTA chunk decrypts to a deflate stream of delta records.  Each record
+// is this header followed by diff_len bytes which are added to the base image
+// starting at base_offset, then extra_len bytes which are copied literally.
+typedef struct _mboot_pack_delta_record_t {
+    uint32_t diff_len;
+    uint32_t extra_len;
+    uint32_t base_offset;
+} mboot_pack_delta_record_t;
+
 // Each DFU chunk transfered has this header to validate it.
 
 typedef struct _mboot_pack_chunk_buf_t {
@@ -30,6 +30,7 @@
 #include "py/obj.h"
 #include "py/objint.h"
 #include "extmod/machine_mem.h"
+#include "dma.h"
 #include "rfcore.h"
 #include "portmodules.h"
 
@@ -46,6 +47,10 @@ STATIC const mp_rom_map_elem_t stm_module_globals_table[] = {
 
     #include "genhdr/modstm_const.h"
 
+    #if MICROPY_PY_STM_DMA
+    { MP_ROM_QSTR(MP_QSTR_DMA), MP_ROM_PTR(&stm_dma_type) },
+    #endif
+
     #if defined(STM32WB)
     { MP_ROM_QSTR(MP_QSTR_rfcore_status), MP_ROM_PTR(&rfcore_status_obj) },
     { MP_ROM_QSTR(MP_QSTR_rfcore_fw_version), MP_ROM_PTR(&rfcore_fw_version_obj) },
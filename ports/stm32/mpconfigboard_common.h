@@ -37,6 +37,15 @@
 #define MICROPY_PY_STM (1)
 #endif
 
+// Whether to include the stm.DMA class (only available on MCUs with DMA streams)
+#ifndef MICROPY_PY_STM_DMA
+#if defined(STM32F4) || defined(STM32F7)
+#define MICROPY_PY_STM_DMA (MICROPY_PY_STM)
+#else
+#define MICROPY_PY_STM_DMA (0)
+#endif
+#endif
+
 // Whether to include the pyb module
 #ifndef MICROPY_PY_PYB
 #define MICROPY_PY_PYB (1)
@@ -72,11 +81,38 @@
 #define MICROPY_HW_ENABLE_RNG (0)
 #endif
 
+// Whether to use the DMA2D (Chrom-ART) peripheral to accelerate framebuf
+#ifndef MICROPY_HW_ENABLE_DMA2D
+#if defined(DMA2D)
+#define MICROPY_HW_ENABLE_DMA2D (1)
+#else
+#define MICROPY_HW_ENABLE_DMA2D (0)
+#endif
+#endif
+
+// Whether UARTs can receive with circular DMA and transmit with DMA
+#ifndef MICROPY_HW_UART_DMA
+#if defined(STM32F4) || defined(STM32F7)
+#define MICROPY_HW_UART_DMA (1)
+#else
+#define MICROPY_HW_UART_DMA (0)
+#endif
+#endif
+
 // Whether to enable the ADC peripheral, exposed as pyb.ADC and pyb.ADCAll
 #ifndef MICROPY_HW_ENABLE_ADC
 #define MICROPY_HW_ENABLE_ADC (1)
 #endif
 
+// Whether pyb.ADC can stream timer-triggered samples into a buffer with circular DMA
+#ifndef MICROPY_HW_ADC_DMA
+#if MICROPY_HW_ENABLE_ADC && (defined(STM32F4) || defined(STM32F7))
+#define MICROPY_HW_ADC_DMA (1)
+#else
+#define MICROPY_HW_ADC_DMA (0)
+#endif
+#endif
+
 // Whether to enable the DAC peripheral, exposed as pyb.DAC
 #ifndef MICROPY_HW_ENABLE_DAC
 #define MICROPY_HW_ENABLE_DAC (0)
@@ -252,16 +288,38 @@
 #endif
 
 // Amount of incoming buffer space for each CDC instance.
-// This must be 2 or greater, and a power of 2.
+// This must be a power of 2, greater than the endpoint packet size and no
+// greater than 32768.  A high-speed (ULPI) link gets a larger default.
 #ifndef MICROPY_HW_USB_CDC_RX_DATA_SIZE
+#if MICROPY_HW_USB_HS && !MICROPY_HW_USB_HS_IN_FS
+#define MICROPY_HW_USB_CDC_RX_DATA_SIZE (4096)
+#else
 #define MICROPY_HW_USB_CDC_RX_DATA_SIZE (1024)
 #endif
+#endif
 
 // Amount of outgoing buffer space for each CDC instance.
 // This must be a power of 2 and no greater than 16384.
 #ifndef MICROPY_HW_USB_CDC_TX_DATA_SIZE
+#if MICROPY_HW_USB_HS && !MICROPY_HW_USB_HS_IN_FS
+#define MICROPY_HW_USB_CDC_TX_DATA_SIZE (4096)
+#else
 #define MICROPY_HW_USB_CDC_TX_DATA_SIZE (1024)
 #endif
+#endif
+
+// Size of each buffer used to move blocks between the MSC endpoints and the
+// storage device.  Must be a multiple of the largest block size (512) and no
+// greater than 32768.
+#ifndef MICROPY_HW_USB_MSC_MEDIA_PACKET
+#define MICROPY_HW_USB_MSC_MEDIA_PACKET (2048)
+#endif
+
+// Whether MSC uses two media buffers, so that reading or writing the storage
+// device overlaps with the USB transfer of the previous/next buffer.
+#ifndef MICROPY_HW_USB_MSC_DOUBLE_BUFFER
+#define MICROPY_HW_USB_MSC_DOUBLE_BUFFER (MICROPY_HW_USB_HS && !MICROPY_HW_USB_HS_IN_FS)
+#endif
 
 /*****************************************************************************/
 // General configuration
@@ -274,6 +332,27 @@
 #define MICROPY_HEAP_END &_heap_end
 #endif
 
+// Whether to place the VM state, the Python stack and the GC allocation tables
+// in tightly coupled memory (CCM on F4, DTCM on F7/H7).  The board must add
+// boards/common_tcm.ld to LD_FILES.
+#ifndef MICROPY_HW_ENABLE_TCM_DATA
+#define MICROPY_HW_ENABLE_TCM_DATA (0)
+#endif
+#if MICROPY_HW_ENABLE_TCM_DATA
+#if MICROPY_HW_ENABLE_INTERNAL_FLASH_STORAGE
+#error "MICROPY_HW_ENABLE_TCM_DATA can't be used with internal flash storage, which caches in TCM"
+#endif
+#define MICROPY_HW_TCM_BSS_ATTR __attribute__((section(".tcm_bss")))
+#else
+#define MICROPY_HW_TCM_BSS_ATTR
+#endif
+
+// Whether to copy native, viper and inline assembler code to ITCM and run it
+// from there (F7 and H7 only).  Code that doesn't fit runs from the GC heap.
+#ifndef MICROPY_HW_ENABLE_ITCM_NATIVE
+#define MICROPY_HW_ENABLE_ITCM_NATIVE (0)
+#endif
+
 // Configuration for STM32F0 series
 #if defined(STM32F0)
 
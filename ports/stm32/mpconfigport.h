@@ -253,6 +253,12 @@ struct _mp_bluetooth_btstack_root_pointers_t;
 #define MICROPY_PORT_ROOT_POINTER_BLUETOOTH_BTSTACK
 #endif
 
+#if MICROPY_PY_NETWORK_CYW43
+#define MICROPY_PORT_ROOT_POINTER_NETWORK_CYW43 mp_obj_t network_cyw43_irq_handler; mp_obj_t network_cyw43_scan_list;
+#else
+#define MICROPY_PORT_ROOT_POINTER_NETWORK_CYW43
+#endif
+
 #ifndef MICROPY_BOARD_ROOT_POINTERS
 #define MICROPY_BOARD_ROOT_POINTERS
 #endif
@@ -283,9 +289,16 @@ struct _mp_bluetooth_btstack_root_pointers_t;
     /* pointers to all CAN objects (if they have been created) */ \
     struct _pyb_can_obj_t *pyb_can_obj_all[MICROPY_HW_MAX_CAN]; \
     \
+    /* buffer and callback of pyb.ADC.read_timed_stream (if it is running) */ \
+    mp_obj_t pyb_adc_stream_buf; \
+    mp_obj_t pyb_adc_stream_callback; \
+    \
     /* pointers to all I2S objects (if they have been created) */ \
     struct _machine_i2s_obj_t *machine_i2s_obj[MICROPY_HW_MAX_I2S]; \
     \
+    /* pointers to all stm.DMA objects (if they have been created) */ \
+    struct _stm_dma_obj_t *stm_dma_obj_all[16]; \
+    \
     /* USB_VCP IRQ callbacks (if they have been set) */ \
     mp_obj_t pyb_usb_vcp_irq[MICROPY_HW_USB_CDC_NUM]; \
     \
@@ -295,6 +308,7 @@ struct _mp_bluetooth_btstack_root_pointers_t;
     /* root pointers for sub-systems */ \
     MICROPY_PORT_ROOT_POINTER_BLUETOOTH_NIMBLE \
     MICROPY_PORT_ROOT_POINTER_BLUETOOTH_BTSTACK \
+    MICROPY_PORT_ROOT_POINTER_NETWORK_CYW43 \
     \
     /* root pointers defined by a board */ \
         MICROPY_BOARD_ROOT_POINTERS \
@@ -303,6 +317,10 @@ struct _mp_bluetooth_btstack_root_pointers_t;
 
 #define MICROPY_MAKE_POINTER_CALLABLE(p) ((void *)((uint32_t)(p) | 1))
 
+#if MICROPY_HW_ENABLE_TCM_DATA
+#define MICROPY_MP_STATE_CTX_ATTR MICROPY_HW_TCM_BSS_ATTR
+#endif
+
 #define MP_SSIZE_MAX (0x7fffffff)
 
 // Assume that if we already defined the obj repr then we also defined these items
@@ -398,3 +416,18 @@ static inline mp_uint_t disable_irq(void) {
 
 // Needed for MICROPY_PY_URANDOM_SEED_INIT_FUNC.
 uint32_t rng_get(void);
+
+#if MICROPY_HW_ENABLE_DMA2D
+// Use the DMA2D to fill and copy the rows of framebuf objects.
+#include "dma2d.h"
+#define MICROPY_PY_FRAMEBUF_COPY_ROWS_HOOK dma2d_copy_rows
+#define MICROPY_PY_FRAMEBUF_FILL_ROWS_HOOK dma2d_fill_rows
+#endif
+
+#if MICROPY_HW_ENABLE_ITCM_NATIVE
+// Native code is generated/loaded in the GC heap then copied to ITCM, and
+// tcm_native_code_commit tracks any relocated code that is left in the heap.
+#include "tcm.h"
+#define MP_PLAT_COMMIT_EXEC(buf, len, reloc) tcm_native_code_commit(buf, len, reloc)
+#define MICROPY_PERSISTENT_CODE_TRACK_RELOC_CODE (1)
+#endif
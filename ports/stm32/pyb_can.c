@@ -127,6 +127,31 @@ STATIC uint8_t can2_start_bank = 14;
 
 #endif
 
+// Flags in the frame records written by recv_into().
+#define CAN_FRAME_FLAG_EXTID        (0x01)
+#define CAN_FRAME_FLAG_RTR          (0x02)
+#define CAN_FRAME_FLAG_FDF          (0x04)
+#define CAN_FRAME_FLAG_BRS          (0x08)
+
+// Layout of a received frame, as stored in the software FIFO and as written
+// by recv_into(), so it can be described with a uctypes struct.
+typedef struct _pyb_can_frame_t {
+    uint32_t id;
+    uint8_t flags;
+    uint8_t fmi;
+    uint8_t len;
+    uint8_t reserved;
+    uint8_t data[CAN_MAX_DATA_FRAME];
+} pyb_can_frame_t;
+
+// Software FIFO, filled from the RX interrupt.  Holds size - 1 frames.
+typedef struct _pyb_can_rxbuf_t {
+    volatile uint16_t head;
+    volatile uint16_t tail;
+    uint16_t size;
+    pyb_can_frame_t frames[];
+} pyb_can_rxbuf_t;
+
 STATIC void pyb_can_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     pyb_can_obj_t *self = MP_OBJ_TO_PTR(self_in);
     if (!self->is_enabled) {
@@ -214,10 +239,28 @@ STATIC void pyb_can_get_bit_timing(mp_uint_t baudrate, mp_uint_t sample_point,
     mp_raise_msg(&mp_type_ValueError, MP_ERROR_TEXT("couldn't match baudrate and sample point"));
 }
 
+// Enable the NVIC line for the given RX FIFO (0 or 1).
+STATIC void pyb_can_rx_irq_enable(pyb_can_obj_t *self, mp_int_t fifo) {
+    uint32_t irq = 0;
+    if (self->can_id == PYB_CAN_1) {
+        irq = (fifo == 0) ? CAN1_RX0_IRQn : CAN1_RX1_IRQn;
+    #if defined(CAN2)
+    } else if (self->can_id == PYB_CAN_2) {
+        irq = (fifo == 0) ? CAN2_RX0_IRQn : CAN2_RX1_IRQn;
+    #endif
+    #if defined(CAN3)
+    } else {
+        irq = (fifo == 0) ? CAN3_RX0_IRQn : CAN3_RX1_IRQn;
+    #endif
+    }
+    NVIC_SetPriority(irq, IRQ_PRI_CAN);
+    HAL_NVIC_EnableIRQ(irq);
+}
+
 // init(mode, prescaler=100, *, sjw=1, bs1=6, bs2=8)
 STATIC mp_obj_t pyb_can_init_helper(pyb_can_obj_t *self, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_mode, ARG_prescaler, ARG_sjw, ARG_bs1, ARG_bs2, ARG_auto_restart, ARG_baudrate, ARG_sample_point,
-           ARG_num_filter_banks, ARG_brs_prescaler, ARG_brs_sjw, ARG_brs_bs1, ARG_brs_bs2, ARG_brs_baudrate, ARG_brs_sample_point };
+           ARG_num_filter_banks, ARG_rxbuf, ARG_brs_prescaler, ARG_brs_sjw, ARG_brs_bs1, ARG_brs_bs2, ARG_brs_baudrate, ARG_brs_sample_point };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_mode,             MP_ARG_REQUIRED | MP_ARG_INT,   {.u_int = CAN_MODE_NORMAL} },
         { MP_QSTR_prescaler,        MP_ARG_INT,                     {.u_int = CAN_DEFAULT_PRESCALER} },
@@ -228,6 +271,7 @@ STATIC mp_obj_t pyb_can_init_helper(pyb_can_obj_t *self, size_t n_args, const mp
         { MP_QSTR_baudrate,         MP_ARG_KW_ONLY | MP_ARG_INT,    {.u_int = 0} },
         { MP_QSTR_sample_point,     MP_ARG_KW_ONLY | MP_ARG_INT,    {.u_int = 75} }, // 75% sampling point
         { MP_QSTR_num_filter_banks, MP_ARG_KW_ONLY | MP_ARG_INT,    {.u_int = 14} },
+        { MP_QSTR_rxbuf,            MP_ARG_KW_ONLY | MP_ARG_INT,    {.u_int = 0} },
         #if MICROPY_HW_ENABLE_FDCAN
         { MP_QSTR_brs_prescaler,    MP_ARG_INT,                     {.u_int = CAN_DEFAULT_PRESCALER} },
         { MP_QSTR_brs_sjw,          MP_ARG_KW_ONLY | MP_ARG_INT,    {.u_int = CAN_DEFAULT_SJW} },
@@ -242,8 +286,14 @@ STATIC mp_obj_t pyb_can_init_helper(pyb_can_obj_t *self, size_t n_args, const mp
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    if (args[ARG_rxbuf].u_int < 0 || args[ARG_rxbuf].u_int >= 0xffff) {
+        mp_raise_ValueError(NULL);
+    }
+
     // set the CAN configuration values
     memset(&self->can, 0, sizeof(self->can));
+    self->rxbuf[0] = NULL;
+    self->rxbuf[1] = NULL;
 
     // Calculate CAN nominal bit timing from baudrate if provided
     if (args[ARG_baudrate].u_int != 0) {
@@ -281,6 +331,20 @@ STATIC mp_obj_t pyb_can_init_helper(pyb_can_obj_t *self, size_t n_args, const mp
         mp_raise_msg_varg(&mp_type_ValueError, MP_ERROR_TEXT("CAN(%d) init failure"), self->can_id);
     }
 
+    // Optionally drain both hardware FIFOs into software FIFOs from the RX interrupt
+    if (args[ARG_rxbuf].u_int > 0) {
+        for (int i = 0; i < 2; ++i) {
+            size_t size = args[ARG_rxbuf].u_int + 1;
+            pyb_can_rxbuf_t *rxbuf = m_new_obj_var(pyb_can_rxbuf_t, pyb_can_frame_t, size);
+            rxbuf->head = 0;
+            rxbuf->tail = 0;
+            rxbuf->size = size;
+            self->rxbuf[i] = rxbuf;
+            pyb_can_rx_irq_enable(self, i);
+            __HAL_CAN_ENABLE_IT(&self->can, i == 0 ? CAN_IT_FIFO0_PENDING : CAN_IT_FIFO1_PENDING);
+        }
+    }
+
     return mp_const_none;
 }
 
@@ -326,6 +390,8 @@ STATIC mp_obj_t pyb_can_make_new(const mp_obj_type_t *type, size_t n_args, size_
         self = mp_obj_malloc(pyb_can_obj_t, &pyb_can_type);
         self->can_id = can_idx;
         self->is_enabled = false;
+        self->rxbuf[0] = NULL;
+        self->rxbuf[1] = NULL;
         MP_STATE_PORT(pyb_can_obj_all)[can_idx - 1] = self;
     } else {
         self = MP_STATE_PORT(pyb_can_obj_all)[can_idx - 1];
@@ -475,20 +541,132 @@ STATIC mp_obj_t pyb_can_info(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(pyb_can_info_obj, 1, 2, pyb_can_info);
 
+// Read one message from a hardware FIFO, which must have one pending if timeout_ms is 0.
+STATIC int pyb_can_read_frame(pyb_can_obj_t *self, uint fifo, pyb_can_frame_t *frame, uint32_t timeout_ms) {
+    CanRxMsgTypeDef rx_msg;
+    #if MICROPY_HW_ENABLE_FDCAN
+    int ret = can_receive(&self->can, fifo, &rx_msg, frame->data, timeout_ms);
+    #else
+    int ret = can_receive(&self->can, fifo, &rx_msg, rx_msg.Data, timeout_ms);
+    #endif
+    if (ret < 0) {
+        return ret;
+    }
+
+    #if MICROPY_HW_ENABLE_FDCAN
+    frame->id = rx_msg.Identifier;
+    frame->flags = (rx_msg.IdType == FDCAN_EXTENDED_ID ? CAN_FRAME_FLAG_EXTID : 0)
+        | (rx_msg.RxFrameType == FDCAN_REMOTE_FRAME ? CAN_FRAME_FLAG_RTR : 0)
+        | (rx_msg.FDFormat == FDCAN_FD_CAN ? CAN_FRAME_FLAG_FDF : 0)
+        | (rx_msg.BitRateSwitch == FDCAN_BRS_ON ? CAN_FRAME_FLAG_BRS : 0);
+    frame->fmi = rx_msg.FilterIndex;
+    frame->len = rx_msg.DataLength;
+    #else
+    frame->id = rx_msg.IDE == CAN_ID_STD ? rx_msg.StdId : rx_msg.ExtId;
+    frame->flags = (rx_msg.IDE == CAN_ID_EXT ? CAN_FRAME_FLAG_EXTID : 0)
+        | (rx_msg.RTR == CAN_RTR_REMOTE ? CAN_FRAME_FLAG_RTR : 0);
+    frame->fmi = rx_msg.FMI;
+    frame->len = rx_msg.DLC;
+    memcpy(frame->data, rx_msg.Data, 8);
+    #endif
+    frame->reserved = 0;
+
+    return 0;
+}
+
+// Called from the RX interrupt to move all pending messages to the software FIFO.
+// Messages that don't fit are dropped, and reported as an overflow (reason 2).
+mp_obj_t pyb_can_rxbuf_fill(pyb_can_obj_t *self, uint fifo) {
+    pyb_can_rxbuf_t *rxbuf = self->rxbuf[fifo == CAN_FIFO0 ? 0 : 1];
+    mp_int_t reason = 0;
+    while (__HAL_CAN_MSG_PENDING(&self->can, fifo) != 0) {
+        uint16_t next_head = rxbuf->head + 1;
+        if (next_head == rxbuf->size) {
+            next_head = 0;
+        }
+        if (next_head == rxbuf->tail) {
+            pyb_can_frame_t frame;
+            pyb_can_read_frame(self, fifo, &frame, 0);
+            reason = 2;
+        } else {
+            pyb_can_read_frame(self, fifo, &rxbuf->frames[rxbuf->head], 0);
+            rxbuf->head = next_head;
+        }
+    }
+    return MP_OBJ_NEW_SMALL_INT(reason);
+}
+
+STATIC bool pyb_can_rx_any(pyb_can_obj_t *self, uint fifo) {
+    pyb_can_rxbuf_t *rxbuf = self->rxbuf[fifo == CAN_FIFO0 ? 0 : 1];
+    if (rxbuf != NULL) {
+        return rxbuf->head != rxbuf->tail;
+    }
+    return __HAL_CAN_MSG_PENDING(&self->can, fifo) != 0;
+}
+
+// Re-arm the RX interrupts that the rx callback state machine disabled.
+STATIC void pyb_can_rx_state_update(pyb_can_obj_t *self, uint fifo) {
+    if ((fifo == CAN_FIFO0 && self->rxcallback0 != mp_const_none) ||
+        (fifo == CAN_FIFO1 && self->rxcallback1 != mp_const_none)) {
+        byte *state = (fifo == CAN_FIFO0) ? &self->rx_state0 : &self->rx_state1;
+
+        switch (*state) {
+            case RX_STATE_FIFO_EMPTY:
+                break;
+            case RX_STATE_MESSAGE_PENDING:
+                if (__HAL_CAN_MSG_PENDING(&self->can, fifo) == 0) {
+                    // Fifo is empty
+                    __HAL_CAN_ENABLE_IT(&self->can, (fifo == CAN_FIFO0) ? CAN_IT_FIFO0_PENDING : CAN_IT_FIFO1_PENDING);
+                    *state = RX_STATE_FIFO_EMPTY;
+                }
+                break;
+            case RX_STATE_FIFO_FULL:
+                __HAL_CAN_ENABLE_IT(&self->can, (fifo == CAN_FIFO0) ? CAN_IT_FIFO0_FULL : CAN_IT_FIFO1_FULL);
+                *state = RX_STATE_MESSAGE_PENDING;
+                break;
+            case RX_STATE_FIFO_OVERFLOW:
+                __HAL_CAN_ENABLE_IT(&self->can, (fifo == CAN_FIFO0) ? CAN_IT_FIFO0_OVRF : CAN_IT_FIFO1_OVRF);
+                __HAL_CAN_ENABLE_IT(&self->can, (fifo == CAN_FIFO0) ? CAN_IT_FIFO0_FULL : CAN_IT_FIFO1_FULL);
+                *state = RX_STATE_MESSAGE_PENDING;
+                break;
+        }
+    }
+}
+
+// Get the next message, from the software FIFO if there is one, else from the hardware.
+STATIC int pyb_can_recv_frame(pyb_can_obj_t *self, uint fifo, pyb_can_frame_t *frame, uint32_t timeout_ms) {
+    pyb_can_rxbuf_t *rxbuf = self->rxbuf[fifo == CAN_FIFO0 ? 0 : 1];
+    if (rxbuf == NULL) {
+        int ret = pyb_can_read_frame(self, fifo, frame, timeout_ms);
+        if (ret == 0) {
+            pyb_can_rx_state_update(self, fifo);
+        }
+        return ret;
+    }
+
+    // Wait for a message to become available, with timeout
+    uint32_t start = HAL_GetTick();
+    while (rxbuf->head == rxbuf->tail) {
+        if (HAL_GetTick() - start >= timeout_ms) {
+            return -MP_ETIMEDOUT;
+        }
+        MICROPY_EVENT_POLL_HOOK
+    }
+
+    uint16_t tail = rxbuf->tail;
+    memcpy(frame, &rxbuf->frames[tail], offsetof(pyb_can_frame_t, data) + MIN(rxbuf->frames[tail].len, CAN_MAX_DATA_FRAME));
+    if (++tail == rxbuf->size) {
+        tail = 0;
+    }
+    rxbuf->tail = tail;
+    return 0;
+}
+
 // any(fifo) - return `True` if any message waiting on the FIFO, else `False`
 STATIC mp_obj_t pyb_can_any(mp_obj_t self_in, mp_obj_t fifo_in) {
     pyb_can_obj_t *self = MP_OBJ_TO_PTR(self_in);
     mp_int_t fifo = mp_obj_get_int(fifo_in);
-    if (fifo == 0) {
-        if (__HAL_CAN_MSG_PENDING(&self->can, CAN_FIFO0) != 0) {
-            return mp_const_true;
-        }
-    } else {
-        if (__HAL_CAN_MSG_PENDING(&self->can, CAN_FIFO1) != 0) {
-            return mp_const_true;
-        }
-    }
-    return mp_const_false;
+    return mp_obj_new_bool(pyb_can_rx_any(self, fifo == 0 ? CAN_FIFO0 : CAN_FIFO1));
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(pyb_can_any_obj, pyb_can_any);
 
@@ -628,13 +806,6 @@ STATIC mp_obj_t pyb_can_recv(size_t n_args, const mp_obj_t *pos_args, mp_map_t *
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     // receive the data
-    CanRxMsgTypeDef rx_msg;
-    #if MICROPY_HW_ENABLE_FDCAN
-    uint8_t rx_data[CAN_MAX_DATA_FRAME];
-    #else
-    uint8_t *rx_data = rx_msg.Data;
-    #endif
-
     mp_uint_t fifo = args[ARG_fifo].u_int;
     if (fifo == 0) {
         fifo = CAN_FIFO0;
@@ -644,43 +815,13 @@ STATIC mp_obj_t pyb_can_recv(size_t n_args, const mp_obj_t *pos_args, mp_map_t *
         mp_raise_TypeError(NULL);
     }
 
-    int ret = can_receive(&self->can, fifo, &rx_msg, rx_data, args[ARG_timeout].u_int);
+    pyb_can_frame_t frame;
+    int ret = pyb_can_recv_frame(self, fifo, &frame, args[ARG_timeout].u_int);
     if (ret < 0) {
         mp_raise_OSError(-ret);
     }
-
-    #if MICROPY_HW_ENABLE_FDCAN
-    uint32_t rx_dlc = rx_msg.DataLength;
-    #else
-    uint32_t rx_dlc = rx_msg.DLC;
-    #endif
-
-    // Manage the rx state machine
-    if ((fifo == CAN_FIFO0 && self->rxcallback0 != mp_const_none) ||
-        (fifo == CAN_FIFO1 && self->rxcallback1 != mp_const_none)) {
-        byte *state = (fifo == CAN_FIFO0) ? &self->rx_state0 : &self->rx_state1;
-
-        switch (*state) {
-            case RX_STATE_FIFO_EMPTY:
-                break;
-            case RX_STATE_MESSAGE_PENDING:
-                if (__HAL_CAN_MSG_PENDING(&self->can, fifo) == 0) {
-                    // Fifo is empty
-                    __HAL_CAN_ENABLE_IT(&self->can, (fifo == CAN_FIFO0) ? CAN_IT_FIFO0_PENDING : CAN_IT_FIFO1_PENDING);
-                    *state = RX_STATE_FIFO_EMPTY;
-                }
-                break;
-            case RX_STATE_FIFO_FULL:
-                __HAL_CAN_ENABLE_IT(&self->can, (fifo == CAN_FIFO0) ? CAN_IT_FIFO0_FULL : CAN_IT_FIFO1_FULL);
-                *state = RX_STATE_MESSAGE_PENDING;
-                break;
-            case RX_STATE_FIFO_OVERFLOW:
-                __HAL_CAN_ENABLE_IT(&self->can, (fifo == CAN_FIFO0) ? CAN_IT_FIFO0_OVRF : CAN_IT_FIFO1_OVRF);
-                __HAL_CAN_ENABLE_IT(&self->can, (fifo == CAN_FIFO0) ? CAN_IT_FIFO0_FULL : CAN_IT_FIFO1_FULL);
-                *state = RX_STATE_MESSAGE_PENDING;
-                break;
-        }
-    }
+    uint8_t *rx_data = frame.data;
+    uint32_t rx_dlc = frame.len;
 
     // Create the tuple, or get the list, that will hold the return values
     // Also populate the fifth element, either a new bytes or reuse existing memoryview
@@ -715,23 +856,66 @@ STATIC mp_obj_t pyb_can_recv(size_t n_args, const mp_obj_t *pos_args, mp_map_t *
     }
 
     // Populate the first 4 values of the tuple/list
-    #if MICROPY_HW_ENABLE_FDCAN
-    items[0] = MP_OBJ_NEW_SMALL_INT(rx_msg.Identifier);
-    items[1] = mp_obj_new_bool(rx_msg.IdType == FDCAN_EXTENDED_ID);
-    items[2] = rx_msg.RxFrameType == FDCAN_REMOTE_FRAME ? mp_const_true : mp_const_false;
-    items[3] = MP_OBJ_NEW_SMALL_INT(rx_msg.FilterIndex);
-    #else
-    items[0] = MP_OBJ_NEW_SMALL_INT((rx_msg.IDE == CAN_ID_STD ? rx_msg.StdId : rx_msg.ExtId));
-    items[1] = mp_obj_new_bool(rx_msg.IDE == CAN_ID_EXT);
-    items[2] = rx_msg.RTR == CAN_RTR_REMOTE ? mp_const_true : mp_const_false;
-    items[3] = MP_OBJ_NEW_SMALL_INT(rx_msg.FMI);
-    #endif
+    items[0] = MP_OBJ_NEW_SMALL_INT(frame.id);
+    items[1] = mp_obj_new_bool(frame.flags & CAN_FRAME_FLAG_EXTID);
+    items[2] = mp_obj_new_bool(frame.flags & CAN_FRAME_FLAG_RTR);
+    items[3] = MP_OBJ_NEW_SMALL_INT(frame.fmi);
 
     // Return the result
     return ret_obj;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(pyb_can_recv_obj, 1, pyb_can_recv);
 
+// recv_into(fifo, buf, *, timeout=5000)
+STATIC mp_obj_t pyb_can_recv_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_fifo, ARG_buf, ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_fifo,    MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_buf,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_timeout, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 5000} },
+    };
+
+    // parse args
+    pyb_can_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_uint_t fifo = args[ARG_fifo].u_int;
+    if (fifo == 0) {
+        fifo = CAN_FIFO0;
+    } else if (fifo == 1) {
+        fifo = CAN_FIFO1;
+    } else {
+        mp_raise_TypeError(NULL);
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buf].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    size_t max_frames = bufinfo.len / sizeof(pyb_can_frame_t);
+    if (max_frames == 0) {
+        mp_raise_ValueError(NULL);
+    }
+
+    // Wait for the first message, then take what is already available.  Each frame
+    // is built on the stack because the buffer need not be aligned.
+    uint8_t *dest = bufinfo.buf;
+    size_t n = 0;
+    uint32_t timeout_ms = args[ARG_timeout].u_int;
+    do {
+        pyb_can_frame_t frame;
+        int ret = pyb_can_recv_frame(self, fifo, &frame, timeout_ms);
+        if (ret < 0) {
+            mp_raise_OSError(-ret);
+        }
+        memcpy(dest, &frame, sizeof(frame));
+        dest += sizeof(frame);
+        timeout_ms = 0;
+    } while (++n < max_frames && pyb_can_rx_any(self, fifo));
+
+    return MP_OBJ_NEW_SMALL_INT(n);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(pyb_can_recv_into_obj, 1, pyb_can_recv_into);
+
 STATIC mp_obj_t pyb_can_clearfilter(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_extframe };
     static const mp_arg_t allowed_args[] = {
@@ -938,7 +1122,10 @@ STATIC mp_obj_t pyb_can_rxcallback(mp_obj_t self_in, mp_obj_t fifo_in, mp_obj_t
     mp_obj_t *callback;
 
     callback = (fifo == 0) ? &self->rxcallback0 : &self->rxcallback1;
-    if (callback_in == mp_const_none) {
+    if (self->rxbuf[fifo == 0 ? 0 : 1] != NULL) {
+        // The RX interrupt is already enabled to fill the software FIFO
+        *callback = callback_in;
+    } else if (callback_in == mp_const_none) {
         __HAL_CAN_DISABLE_IT(&self->can, (fifo == 0) ? CAN_IT_FIFO0_PENDING : CAN_IT_FIFO1_PENDING);
         __HAL_CAN_DISABLE_IT(&self->can, (fifo == 0) ? CAN_IT_FIFO0_FULL : CAN_IT_FIFO1_FULL);
         __HAL_CAN_DISABLE_IT(&self->can, (fifo == 0) ? CAN_IT_FIFO0_OVRF : CAN_IT_FIFO1_OVRF);
@@ -951,20 +1138,7 @@ STATIC mp_obj_t pyb_can_rxcallback(mp_obj_t self_in, mp_obj_t fifo_in, mp_obj_t
         *callback = callback_in;
     } else if (mp_obj_is_callable(callback_in)) {
         *callback = callback_in;
-        uint32_t irq = 0;
-        if (self->can_id == PYB_CAN_1) {
-            irq = (fifo == 0) ? CAN1_RX0_IRQn : CAN1_RX1_IRQn;
-        #if defined(CAN2)
-        } else if (self->can_id == PYB_CAN_2) {
-            irq = (fifo == 0) ? CAN2_RX0_IRQn : CAN2_RX1_IRQn;
-        #endif
-        #if defined(CAN3)
-        } else {
-            irq = (fifo == 0) ? CAN3_RX0_IRQn : CAN3_RX1_IRQn;
-        #endif
-        }
-        NVIC_SetPriority(irq, IRQ_PRI_CAN);
-        HAL_NVIC_EnableIRQ(irq);
+        pyb_can_rx_irq_enable(self, fifo);
         __HAL_CAN_ENABLE_IT(&self->can, (fifo == 0) ? CAN_IT_FIFO0_PENDING : CAN_IT_FIFO1_PENDING);
         __HAL_CAN_ENABLE_IT(&self->can, (fifo == 0) ? CAN_IT_FIFO0_FULL : CAN_IT_FIFO1_FULL);
         __HAL_CAN_ENABLE_IT(&self->can, (fifo == 0) ? CAN_IT_FIFO0_OVRF : CAN_IT_FIFO1_OVRF);
@@ -983,6 +1157,7 @@ STATIC const mp_rom_map_elem_t pyb_can_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_any), MP_ROM_PTR(&pyb_can_any_obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&pyb_can_send_obj) },
     { MP_ROM_QSTR(MP_QSTR_recv), MP_ROM_PTR(&pyb_can_recv_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recv_into), MP_ROM_PTR(&pyb_can_recv_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_setfilter), MP_ROM_PTR(&pyb_can_setfilter_obj) },
     { MP_ROM_QSTR(MP_QSTR_clearfilter), MP_ROM_PTR(&pyb_can_clearfilter_obj) },
     { MP_ROM_QSTR(MP_QSTR_rxcallback), MP_ROM_PTR(&pyb_can_rxcallback_obj) },
@@ -1027,8 +1202,7 @@ STATIC mp_uint_t can_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, i
         uintptr_t flags = arg;
         ret = 0;
         if ((flags & MP_STREAM_POLL_RD)
-            && ((__HAL_CAN_MSG_PENDING(&self->can, CAN_FIFO0) != 0)
-                || (__HAL_CAN_MSG_PENDING(&self->can, CAN_FIFO1) != 0))) {
+            && (pyb_can_rx_any(self, CAN_FIFO0) || pyb_can_rx_any(self, CAN_FIFO1))) {
             ret |= MP_STREAM_POLL_RD;
         }
         #if MICROPY_HW_ENABLE_FDCAN
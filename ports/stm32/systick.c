@@ -29,13 +29,33 @@
 #include "irq.h"
 #include "pendsv.h"
 #include "systick.h"
-#include "softtimer.h"
+#include "shared/runtime/softtimer.h"
 #include "pybthread.h"
 
 extern __IO uint32_t uwTick;
 
 systick_dispatch_t systick_dispatch_table[SYSTICK_DISPATCH_NUM_SLOTS];
 
+// The soft timer service is driven from SysTick: each millisecond uwTick is
+// compared against soft_timer_next and on a match soft_timer_handler is run
+// via PendSV.
+STATIC volatile uint32_t soft_timer_next;
+
+uint32_t soft_timer_get_ms(void) {
+    return uwTick;
+}
+
+void soft_timer_schedule_at_ms(uint32_t ticks_ms) {
+    uint32_t irq_state = disable_irq();
+    uint32_t uw_tick = uwTick;
+    if (soft_timer_ticks_diff(ticks_ms, uw_tick) <= 0) {
+        soft_timer_next = uw_tick + 1;
+    } else {
+        soft_timer_next = ticks_ms;
+    }
+    enable_irq(irq_state);
+}
+
 void SysTick_Handler(void) {
     // Instead of calling HAL_IncTick we do the increment here of the counter.
     // This is purely for efficiency, since SysTick is called 1000 times per
@@ -0,0 +1,106 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/gc.h"
+#include "py/mphal.h"
+#include "py/persistentcode.h"
+#include "py/runtime.h"
+#include "tcm.h"
+
+#if MICROPY_HW_ENABLE_TCM_DATA
+
+// These are defined by common_tcm.ld.
+extern uint8_t _stcm_bss, _etcm_bss;
+extern uint8_t _tcm_free_start, _tcm_free_end;
+
+void tcm_init0(void) {
+    memset(&_stcm_bss, 0, &_etcm_bss - &_stcm_bss);
+}
+
+void tcm_gc_init(void *start, void *end) {
+    size_t free = &_tcm_free_end - &_tcm_free_start;
+    if (gc_tables_size((uint8_t *)end - (uint8_t *)start) <= free) {
+        // The whole of RAM is the pool, and all ATB/FTB accesses are to TCM.
+        gc_init_with_tables(&_tcm_free_start, start, end);
+    } else {
+        gc_init(start, end);
+    }
+}
+
+#endif
+
+#if MICROPY_HW_ENABLE_ITCM_NATIVE
+
+#if !defined(STM32F7) && !defined(STM32H7)
+#error "MICROPY_HW_ENABLE_ITCM_NATIVE requires an MCU with ITCM"
+#endif
+
+// These are defined by the MCU linker script.
+extern uint8_t _micropy_hw_itcm_start, _micropy_hw_itcm_end;
+
+// ITCM is a simple bump allocator that is reset on soft reset.  The first word
+// is skipped so that no code lives at address 0 (NULL).
+static uint8_t *itcm_next;
+
+void *tcm_native_code_commit(void *buf, size_t len, void *reloc) {
+    if (itcm_next == NULL) {
+        itcm_next = &_micropy_hw_itcm_start + 8;
+    }
+    size_t alloc_len = (len + 7) & ~7;
+    uint8_t *p;
+    if (alloc_len <= (size_t)(&_micropy_hw_itcm_end - itcm_next)) {
+        p = itcm_next;
+        itcm_next += alloc_len;
+    } else {
+        // ITCM is full so run the code from the GC heap.  Relocated code may only
+        // be referenced from within itself, so keep it reachable.
+        p = buf;
+        if (reloc) {
+            if (MP_STATE_VM(track_reloc_code_list) == MP_OBJ_NULL) {
+                MP_STATE_VM(track_reloc_code_list) = mp_obj_new_list(0, NULL);
+            }
+            mp_obj_list_append(MP_STATE_VM(track_reloc_code_list), MP_OBJ_FROM_PTR(buf));
+        }
+    }
+    if (reloc) {
+        mp_native_relocate(reloc, buf, (uintptr_t)p);
+    }
+    if (p != buf) {
+        memcpy(p, buf, len);
+        // ITCM is not cached, but the writes must complete before the code runs.
+        __DSB();
+        __ISB();
+    }
+    return p;
+}
+
+void tcm_deinit(void) {
+    itcm_next = NULL;
+}
+
+#endif
@@ -0,0 +1,44 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 agent
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef MICROPY_INCLUDED_STM32_TCM_H
+#define MICROPY_INCLUDED_STM32_TCM_H
+
+#include <stddef.h>
+
+// Zero the .tcm_bss section; must be called before the VM state is used.
+void tcm_init0(void);
+
+// Initialise the GC heap, with its allocation tables in TCM if they fit there.
+void tcm_gc_init(void *start, void *end);
+
+// Copy native code to ITCM (relocating it if needed) and return its new
+// address, or run it from the GC heap if ITCM is full.
+void *tcm_native_code_commit(void *buf, size_t len, void *reloc);
+
+// Release all ITCM used by native code, on soft reset.
+void tcm_deinit(void);
+
+#endif // MICROPY_INCLUDED_STM32_TCM_H
@@ -55,6 +55,21 @@
 #define UART_RXNE_IT_DIS(uart) do { (uart)->CR1 &= ~USART_CR1_RXNEIE; } while (0)
 #endif
 
+#if MICROPY_HW_UART_DMA
+#define UART_RX_DMA_ACTIVE(self) ((self)->rx_dma_descr != NULL)
+#if defined(STM32F4)
+#define UART_RDR(uart) ((uart)->DR)
+#define UART_TDR(uart) ((uart)->DR)
+#else
+#define UART_RDR(uart) ((uart)->RDR)
+#define UART_TDR(uart) ((uart)->TDR)
+#endif
+// Writes shorter than this are sent by the CPU, rather than setting up the DMA.
+#define UART_TX_DMA_MIN_CHARS (16)
+#else
+#define UART_RX_DMA_ACTIVE(self) (false)
+#endif
+
 #if defined(STM32G0) || defined(STM32WL)
 #define USART_CR1_IE_BASE (USART_CR1_PEIE | USART_CR1_TXEIE_TXFNFIE | USART_CR1_TCIE | USART_CR1_RXNEIE_RXFNEIE | USART_CR1_IDLEIE)
 #else
@@ -647,6 +662,10 @@ void uart_irq_config(pyb_uart_obj_t *self, bool enable) {
             }
         }
     }
+    if (UART_RX_DMA_ACTIVE(self)) {
+        // DMA reception relies on IDLE to wake up readers.
+        self->uartx->CR1 |= USART_CR1_IDLEIE;
+    }
 }
 
 void uart_set_rxbuf(pyb_uart_obj_t *self, size_t len, void *buf) {
@@ -661,7 +680,103 @@ void uart_set_rxbuf(pyb_uart_obj_t *self, size_t len, void *buf) {
     }
 }
 
+#if MICROPY_HW_UART_DMA
+
+STATIC void uart_get_dma_descr(pyb_uart_obj_t *self, const dma_descr_t **rx, const dma_descr_t **tx) {
+    *rx = NULL;
+    *tx = NULL;
+    switch (self->uart_id) {
+        case PYB_UART_1:
+            *rx = &dma_UART_1_RX;
+            *tx = &dma_UART_1_TX;
+            break;
+        #if defined(USART2)
+        case PYB_UART_2:
+            *rx = &dma_UART_2_RX;
+            *tx = &dma_UART_2_TX;
+            break;
+        #endif
+        #if defined(USART3)
+        case PYB_UART_3:
+            *rx = &dma_UART_3_RX;
+            *tx = &dma_UART_3_TX;
+            break;
+        #endif
+        #if defined(UART4)
+        case PYB_UART_4:
+            *rx = &dma_UART_4_RX;
+            *tx = &dma_UART_4_TX;
+            break;
+        #endif
+        #if defined(UART5)
+        case PYB_UART_5:
+            *rx = &dma_UART_5_RX;
+            *tx = &dma_UART_5_TX;
+            break;
+        #endif
+        #if defined(USART6)
+        case PYB_UART_6:
+            *rx = &dma_UART_6_RX;
+            *tx = &dma_UART_6_TX;
+            break;
+        #endif
+        default:
+            break;
+    }
+}
+
+// Stop any DMA, then if rxdma is set receive into read_buf with circular DMA,
+// and if txdma is set transmit with DMA.  The DMA streams are shared with other
+// peripherals (see dma.c) so those must not be used at the same time.
+// Returns false if this UART can't use DMA with its current settings.
+bool uart_set_dma(pyb_uart_obj_t *self, bool rxdma, bool txdma) {
+    if (self->rx_dma_descr != NULL) {
+        self->uartx->CR3 &= ~USART_CR3_DMAR;
+        HAL_DMA_Abort(&self->rx_dma);
+        dma_deinit(self->rx_dma_descr);
+        self->rx_dma_descr = NULL;
+        if (!(self->mp_irq_trigger & UART_FLAG_IDLE)) {
+            self->uartx->CR1 &= ~USART_CR1_IDLEIE;
+        }
+        uart_set_rxbuf(self, self->read_buf_len, self->read_buf);
+    }
+    self->tx_dma_descr = NULL;
+
+    if (!rxdma && !txdma) {
+        return true;
+    }
+    const dma_descr_t *rx_descr, *tx_descr;
+    uart_get_dma_descr(self, &rx_descr, &tx_descr);
+    if (rx_descr == NULL || self->char_width != CHAR_WIDTH_8BIT || (rxdma && self->read_buf_len == 0)) {
+        return false;
+    }
+
+    if (rxdma) {
+        // The DMA takes each char as it arrives, so RXNE mustn't interrupt, and
+        // IDLE signals that new data has come in.
+        UART_RXNE_IT_DIS(self->uartx);
+        self->read_buf_head = 0;
+        self->read_buf_tail = 0;
+        MP_HAL_CLEANINVALIDATE_DCACHE(self->read_buf, self->read_buf_len);
+        dma_init(&self->rx_dma, rx_descr, DMA_PERIPH_TO_MEMORY, self);
+        self->rx_dma_descr = rx_descr;
+        HAL_DMA_Start(&self->rx_dma, (uint32_t)&UART_RDR(self->uartx), (uint32_t)self->read_buf, self->read_buf_len);
+        self->uartx->CR3 |= USART_CR3_DMAR;
+        self->uartx->CR1 |= USART_CR1_IDLEIE;
+    }
+    if (txdma) {
+        self->tx_dma_descr = tx_descr;
+    }
+    return true;
+}
+
+#endif
+
 void uart_deinit(pyb_uart_obj_t *self) {
+    #if MICROPY_HW_UART_DMA
+    uart_set_dma(self, false, false);
+    #endif
+
     self->is_enabled = false;
 
     // Disable UART
@@ -931,12 +1046,25 @@ void uart_set_baudrate(pyb_uart_obj_t *self, uint32_t baudrate) {
         LL_USART_OVERSAMPLING_16, baudrate);
 }
 
+// Index of the first empty slot in read_buf.  When receiving with DMA this is
+// where the DMA will write next.
+static inline uint16_t uart_rx_head(pyb_uart_obj_t *self) {
+    #if MICROPY_HW_UART_DMA
+    if (self->rx_dma_descr != NULL) {
+        return self->read_buf_len - __HAL_DMA_GET_COUNTER(&self->rx_dma);
+    }
+    #endif
+    return self->read_buf_head;
+}
+
 mp_uint_t uart_rx_any(pyb_uart_obj_t *self) {
-    int buffer_bytes = self->read_buf_head - self->read_buf_tail;
+    int buffer_bytes = uart_rx_head(self) - self->read_buf_tail;
     if (buffer_bytes < 0) {
         return buffer_bytes + self->read_buf_len;
     } else if (buffer_bytes > 0) {
         return buffer_bytes;
+    } else if (UART_RX_DMA_ACTIVE(self)) {
+        return 0;
     } else {
         return UART_RXNE_IS_SET(self->uartx) != 0;
     }
@@ -948,7 +1076,7 @@ mp_uint_t uart_rx_any(pyb_uart_obj_t *self) {
 bool uart_rx_wait(pyb_uart_obj_t *self, uint32_t timeout) {
     uint32_t start = HAL_GetTick();
     for (;;) {
-        if (self->read_buf_tail != self->read_buf_head || UART_RXNE_IS_SET(self->uartx)) {
+        if (self->read_buf_tail != uart_rx_head(self) || (!UART_RX_DMA_ACTIVE(self) && UART_RXNE_IS_SET(self->uartx))) {
             return true; // have at least 1 char ready for reading
         }
         if (HAL_GetTick() - start >= timeout) {
@@ -960,6 +1088,16 @@ bool uart_rx_wait(pyb_uart_obj_t *self, uint32_t timeout) {
 
 // assumes there is a character available
 int uart_rx_char(pyb_uart_obj_t *self) {
+    #if MICROPY_HW_UART_DMA
+    if (self->rx_dma_descr != NULL) {
+        // buffering via DMA; the CPU never writes to read_buf so its cache
+        // lines are clean and can just be discarded
+        MP_HAL_CLEANINVALIDATE_DCACHE(&self->read_buf[self->read_buf_tail], 1);
+        int data = self->read_buf[self->read_buf_tail];
+        self->read_buf_tail = (self->read_buf_tail + 1) % self->read_buf_len;
+        return data & self->char_mask;
+    }
+    #endif
     if (self->read_buf_tail != self->read_buf_head) {
         // buffering via IRQ
         int data;
@@ -1033,6 +1171,50 @@ STATIC bool uart_wait_flag_set(pyb_uart_obj_t *self, uint32_t flag, uint32_t tim
     }
 }
 
+#if MICROPY_HW_UART_DMA
+// Send 8-bit chars with DMA, restarting the timeout each time a char is taken.
+STATIC size_t uart_tx_data_dma(pyb_uart_obj_t *self, const uint8_t *src, size_t num_chars, uint32_t timeout, int *errcode) {
+    size_t num_tx = 0;
+    while (num_tx < num_chars) {
+        size_t n = MIN(num_chars - num_tx, 0xffff);
+        DMA_HandleTypeDef tx_dma;
+        dma_init(&tx_dma, self->tx_dma_descr, DMA_MEMORY_TO_PERIPH, self);
+        MP_HAL_CLEAN_DCACHE(src, n);
+        self->uartx->CR3 |= USART_CR3_DMAT;
+        HAL_DMA_Start(&tx_dma, (uint32_t)src, (uint32_t)&UART_TDR(self->uartx), n);
+        uint32_t remaining = n;
+        uint32_t start = HAL_GetTick();
+        while (remaining != 0) {
+            uint32_t r = __HAL_DMA_GET_COUNTER(&tx_dma);
+            if (r != remaining) {
+                remaining = r;
+                start = HAL_GetTick();
+            } else if (HAL_GetTick() - start >= timeout) {
+                break;
+            }
+        }
+        HAL_DMA_Abort(&tx_dma);
+        self->uartx->CR3 &= ~USART_CR3_DMAT;
+        dma_deinit(self->tx_dma_descr);
+        num_tx += n - remaining;
+        src += n - remaining;
+        if (remaining != 0) {
+            *errcode = MP_ETIMEDOUT;
+            return num_tx;
+        }
+    }
+
+    // wait for the UART frame to complete
+    if (!uart_wait_flag_set(self, UART_FLAG_TC, timeout)) {
+        *errcode = MP_ETIMEDOUT;
+        return num_tx;
+    }
+
+    *errcode = 0;
+    return num_tx;
+}
+#endif
+
 // src - a pointer to the data to send (16-bit aligned for 9-bit chars)
 // num_chars - number of characters to send (9-bit chars count for 2 bytes from src)
 // *errcode - returns 0 for success, MP_Exxx on error
@@ -1061,6 +1243,17 @@ size_t uart_tx_data(pyb_uart_obj_t *self, const void *src_in, size_t num_chars,
     size_t num_tx = 0;
     USART_TypeDef *uart = self->uartx;
 
+    #if MICROPY_HW_UART_DMA
+    if (self->tx_dma_descr != NULL && num_chars >= UART_TX_DMA_MIN_CHARS
+        #if defined(CCMDATARAM_BASE)
+        // the CCM RAM can't be reached by DMA
+        && !((uintptr_t)src >= CCMDATARAM_BASE && (uintptr_t)src < CCMDATARAM_BASE + 0x10000)
+        #endif
+        ) {
+        return uart_tx_data_dma(self, src, num_chars, timeout, errcode);
+    }
+    #endif
+
     while (num_tx < num_chars) {
         if (!uart_wait_flag_set(self, UART_FLAG_TXE, timeout)) {
             *errcode = MP_ETIMEDOUT;
@@ -1121,7 +1314,9 @@ void uart_irq_handler(mp_uint_t uart_id) {
     #endif
 
     // Process RXNE flag, either read the character or disable the interrupt.
-    if (rxne_is_set) {
+    // With DMA reception the DMA reads the data register, and IDLE is enabled
+    // instead, to signal that chars have arrived.
+    if (rxne_is_set && !UART_RX_DMA_ACTIVE(self)) {
         if (self->read_buf_len != 0) {
             uint16_t next_head = (self->read_buf_head + 1) % self->read_buf_len;
             if (next_head != self->read_buf_tail) {
@@ -1156,7 +1351,11 @@ void uart_irq_handler(mp_uint_t uart_id) {
 
     // Clear other interrupt flags that can trigger this IRQ handler.
     #if defined(STM32F4)
-    if (did_clear_sr) {
+    if (UART_RX_DMA_ACTIVE(self)) {
+        // Reading DR after SR clears IDLE and ORE; the line is idle so DR has
+        // already been taken by the DMA.
+        (void)self->uartx->DR;
+    } else if (did_clear_sr) {
         // SR was cleared above.  Re-enable IDLE if it should be enabled.
         if (self->mp_irq_trigger & UART_FLAG_IDLE) {
             self->uartx->CR1 |= USART_CR1_IDLEIE;
@@ -27,6 +27,7 @@
 #define MICROPY_INCLUDED_STM32_UART_H
 
 #include "shared/runtime/mpirq.h"
+#include "dma.h"
 
 typedef enum {
     PYB_UART_NONE = 0,
@@ -75,6 +76,11 @@ typedef struct _pyb_uart_obj_t {
     uint16_t mp_irq_trigger;            // user IRQ trigger mask
     uint16_t mp_irq_flags;              // user IRQ active IRQ flags
     mp_irq_obj_t *mp_irq_obj;           // user IRQ object
+    #if MICROPY_HW_UART_DMA
+    const dma_descr_t *rx_dma_descr;    // non-NULL if read_buf is filled by circular DMA
+    const dma_descr_t *tx_dma_descr;    // non-NULL if transmitting with DMA
+    DMA_HandleTypeDef rx_dma;
+    #endif
 } pyb_uart_obj_t;
 
 extern const mp_obj_type_t pyb_uart_type;
@@ -87,6 +93,9 @@ bool uart_init(pyb_uart_obj_t *uart_obj,
     uint32_t baudrate, uint32_t bits, uint32_t parity, uint32_t stop, uint32_t flow);
 void uart_irq_config(pyb_uart_obj_t *self, bool enable);
 void uart_set_rxbuf(pyb_uart_obj_t *self, size_t len, void *buf);
+#if MICROPY_HW_UART_DMA
+bool uart_set_dma(pyb_uart_obj_t *self, bool rxdma, bool txdma);
+#endif
 void uart_deinit(pyb_uart_obj_t *uart_obj);
 void uart_irq_handler(mp_uint_t uart_id);
 
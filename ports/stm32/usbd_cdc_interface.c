@@ -36,6 +36,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "boardctrl.h"
 #include "usbd_cdc_msc_hid.h"
@@ -197,6 +198,22 @@ static uint16_t usbd_cdc_tx_send_length(usbd_cdc_itf_t *cdc) {
     return MIN(usbd_cdc_tx_buffer_size(cdc), to_end);
 }
 
+// Copy as much of the given data as fits into the tx buffer, without overwriting
+// anything that is waiting to be sent.  Returns the number of bytes copied.
+static uint32_t usbd_cdc_tx_buffer_write(usbd_cdc_itf_t *cdc, const uint8_t *buf, uint32_t len) {
+    uint32_t n = 0;
+    while (n < len && !usbd_cdc_tx_buffer_full(cdc)) {
+        uint16_t in = usbd_cdc_tx_buffer_mask(cdc->tx_buf_ptr_in);
+        uint32_t chunk = MICROPY_HW_USB_CDC_TX_DATA_SIZE - usbd_cdc_tx_buffer_size(cdc);
+        chunk = MIN(chunk, MICROPY_HW_USB_CDC_TX_DATA_SIZE - in);
+        chunk = MIN(chunk, len - n);
+        memcpy(&cdc->tx_buf[in], buf + n, chunk);
+        cdc->tx_buf_ptr_in += chunk;
+        n += chunk;
+    }
+    return n;
+}
+
 static void usbd_cdc_tx_buffer_put(usbd_cdc_itf_t *cdc, uint8_t data, bool check_overflow) {
     cdc->tx_buf[usbd_cdc_tx_buffer_mask(cdc->tx_buf_ptr_in)] = data;
     cdc->tx_buf_ptr_in++;
@@ -272,7 +289,7 @@ void HAL_PCD_SOFCallback(PCD_HandleTypeDef *hpcd) {
 bool usbd_cdc_rx_buffer_full(usbd_cdc_itf_t *cdc) {
     int get = cdc->rx_buf_get, put = cdc->rx_buf_put;
     int remaining = (get - put) + (-((int)(get <= put)) & MICROPY_HW_USB_CDC_RX_DATA_SIZE);
-    return remaining < CDC_DATA_MAX_PACKET_SIZE + 1;
+    return remaining < usbd_cdc_max_packet(cdc->base.usbd->pdev) + 1;
 }
 
 void usbd_cdc_rx_check_resume(usbd_cdc_itf_t *cdc) {
@@ -288,24 +305,51 @@ void usbd_cdc_rx_check_resume(usbd_cdc_itf_t *cdc) {
     enable_irq(irq_state);
 }
 
+// Copy as much of the given data as fits into the rx buffer.
+// Returns the number of bytes copied.
+static size_t usbd_cdc_rx_buffer_put(usbd_cdc_itf_t *cdc, const uint8_t *src, size_t len) {
+    size_t n = 0;
+    while (n < len) {
+        uint16_t put = cdc->rx_buf_put;
+        size_t space = (cdc->rx_buf_get - put - 1) & (MICROPY_HW_USB_CDC_RX_DATA_SIZE - 1);
+        if (space == 0) {
+            break;
+        }
+        size_t chunk = MIN(MIN(len - n, space), MICROPY_HW_USB_CDC_RX_DATA_SIZE - put);
+        memcpy(&cdc->rx_user_buf[put], src + n, chunk);
+        cdc->rx_buf_put = (put + chunk) & (MICROPY_HW_USB_CDC_RX_DATA_SIZE - 1);
+        n += chunk;
+    }
+    return n;
+}
+
 // Data received over USB OUT endpoint is processed here.
 // len: number of bytes received into the buffer we passed to USBD_CDC_ReceivePacket
 // Returns USBD_OK if all operations are OK else USBD_FAIL
 int8_t usbd_cdc_receive(usbd_cdc_state_t *cdc_in, size_t len) {
     usbd_cdc_itf_t *cdc = (usbd_cdc_itf_t *)cdc_in;
 
-    // copy the incoming data into the circular buffer
-    for (const uint8_t *src = cdc->rx_packet_buf, *top = cdc->rx_packet_buf + len; src < top; ++src) {
-        if (cdc->attached_to_repl && *src == mp_interrupt_char) {
-            pendsv_kbd_intr();
-        } else {
-            uint16_t next_put = (cdc->rx_buf_put + 1) & (MICROPY_HW_USB_CDC_RX_DATA_SIZE - 1);
-            if (next_put == cdc->rx_buf_get) {
-                // overflow, we just discard the rest of the chars
-                break;
+    // copy the incoming data into the circular buffer, in runs between any interrupt chars
+    const uint8_t *src = cdc->rx_packet_buf;
+    const uint8_t *top = cdc->rx_packet_buf + len;
+    while (src < top) {
+        const uint8_t *end = top;
+        if (cdc->attached_to_repl && mp_interrupt_char >= 0) {
+            const uint8_t *intr = memchr(src, mp_interrupt_char, top - src);
+            if (intr != NULL) {
+                end = intr;
             }
-            cdc->rx_user_buf[cdc->rx_buf_put] = *src;
-            cdc->rx_buf_put = next_put;
+        }
+        size_t n = end - src;
+        if (usbd_cdc_rx_buffer_put(cdc, src, n) < n) {
+            // overflow, we just discard the rest of the chars
+            break;
+        }
+        src = end;
+        if (src < top) {
+            // src points to an interrupt char
+            pendsv_kbd_intr();
+            ++src;
         }
     }
 
@@ -342,7 +386,8 @@ int usbd_cdc_tx_flow(usbd_cdc_itf_t *cdc, const uint8_t *buf, uint32_t len) {
 // timout in milliseconds.
 // Returns number of bytes written to the device.
 int usbd_cdc_tx(usbd_cdc_itf_t *cdc, const uint8_t *buf, uint32_t len, uint32_t timeout) {
-    for (uint32_t i = 0; i < len; i++) {
+    uint32_t i = 0;
+    while (i < len) {
         // Wait until the device is connected and the buffer has space, with a given timeout
         uint32_t start = HAL_GetTick();
         while (cdc->connect_state == USBD_CDC_CONNECT_STATE_DISCONNECTED || usbd_cdc_tx_buffer_full(cdc)) {
@@ -359,8 +404,8 @@ int usbd_cdc_tx(usbd_cdc_itf_t *cdc, const uint8_t *buf, uint32_t len, uint32_t
             __WFI(); // enter sleep mode, waiting for interrupt
         }
 
-        // Write data to device buffer
-        usbd_cdc_tx_buffer_put(cdc, buf[i], false);
+        // Write as much data as fits to device buffer
+        i += usbd_cdc_tx_buffer_write(cdc, buf + i, len - i);
     }
 
     usbd_cdc_try_tx(cdc);
@@ -373,7 +418,8 @@ int usbd_cdc_tx(usbd_cdc_itf_t *cdc, const uint8_t *buf, uint32_t len, uint32_t
 // device is not connected, or if the buffer is full.  Has a small timeout
 // to wait for the buffer to be drained, in the case the device is connected.
 void usbd_cdc_tx_always(usbd_cdc_itf_t *cdc, const uint8_t *buf, uint32_t len) {
-    for (int i = 0; i < len; i++) {
+    uint32_t i = 0;
+    while (i < len) {
         // If the CDC device is not connected to the host then we don't have anyone to receive our data.
         // The device may become connected in the future, so we should at least try to fill the buffer
         // and hope that it doesn't overflow by the time the device connects.
@@ -397,7 +443,14 @@ void usbd_cdc_tx_always(usbd_cdc_itf_t *cdc, const uint8_t *buf, uint32_t len) {
             }
         }
 
-        usbd_cdc_tx_buffer_put(cdc, buf[i], true);
+        // Write as much data as fits, or if the buffer is still full then overwrite
+        // the oldest data one byte at a time
+        uint32_t n = usbd_cdc_tx_buffer_write(cdc, buf + i, len - i);
+        if (n == 0) {
+            usbd_cdc_tx_buffer_put(cdc, buf[i], true);
+            n = 1;
+        }
+        i += n;
     }
     usbd_cdc_try_tx(cdc);
 }
@@ -416,7 +469,8 @@ int usbd_cdc_rx_num(usbd_cdc_itf_t *cdc) {
 // Returns number of bytes read from the device.
 int usbd_cdc_rx(usbd_cdc_itf_t *cdc, uint8_t *buf, uint32_t len, uint32_t timeout) {
     // loop to read bytes
-    for (uint32_t i = 0; i < len; i++) {
+    uint32_t i = 0;
+    while (i < len) {
         // Wait until we have at least 1 byte to read
         uint32_t start = HAL_GetTick();
         while (cdc->rx_buf_put == cdc->rx_buf_get) {
@@ -433,9 +487,17 @@ int usbd_cdc_rx(usbd_cdc_itf_t *cdc, uint8_t *buf, uint32_t len, uint32_t timeou
             __WFI(); // enter sleep mode, waiting for interrupt
         }
 
-        // Copy byte from device to user buffer
-        buf[i] = cdc->rx_user_buf[cdc->rx_buf_get];
-        cdc->rx_buf_get = (cdc->rx_buf_get + 1) & (MICROPY_HW_USB_CDC_RX_DATA_SIZE - 1);
+        // Copy as many contiguous bytes as are available directly to the user buffer
+        uint16_t get = cdc->rx_buf_get;
+        uint16_t put = cdc->rx_buf_put;
+        uint32_t n = (put > get ? put : MICROPY_HW_USB_CDC_RX_DATA_SIZE) - get;
+        n = MIN(n, len - i);
+        memcpy(buf + i, &cdc->rx_user_buf[get], n);
+        cdc->rx_buf_get = (get + n) & (MICROPY_HW_USB_CDC_RX_DATA_SIZE - 1);
+        i += n;
+
+        // Allow the host to send more as soon as there is room for it
+        usbd_cdc_rx_check_resume(cdc);
     }
     usbd_cdc_rx_check_resume(cdc);
 
@@ -31,7 +31,7 @@
 #else
 #define CDC_DATA_MAX_PACKET_SIZE    CDC_DATA_FS_MAX_PACKET_SIZE
 #endif
-#define MSC_MEDIA_PACKET            (2048) // was 8192; how low can it go whilst still working?
+#define MSC_MEDIA_PACKET            MICROPY_HW_USB_MSC_MEDIA_PACKET
 #define HID_DATA_FS_MAX_PACKET_SIZE (64) // endpoint IN & OUT packet size
 
 // Maximum number of LUN that can be exposed on the MSC interface
@@ -74,6 +74,11 @@ typedef struct {
   uint8_t                  bot_status;  
   uint16_t                 bot_data_length;
   uint8_t                  bot_data[MSC_MEDIA_PACKET];  
+  #if MICROPY_HW_USB_MSC_DOUBLE_BUFFER
+  uint8_t                  bot_data_alt[MSC_MEDIA_PACKET]; // second media buffer for READ10/WRITE10
+  uint8_t                  media_buf_idx; // media buffer that the next USB transfer uses
+  uint8_t                  media_prefetched; // next READ10 chunk is already in the media buffer
+  #endif
   USBD_MSC_BOT_CBWTypeDef  cbw;
   USBD_MSC_BOT_CSWTypeDef  csw;
   
@@ -519,6 +519,10 @@ static int8_t SCSI_Read10(USBD_HandleTypeDef  *pdev, uint8_t lun , uint8_t *para
 
     hmsc->bot_state = USBD_BOT_DATA_IN;
     hmsc->scsi_blk_len *= hmsc->scsi_blk_size[lun];
+    #if MICROPY_HW_USB_MSC_DOUBLE_BUFFER
+    hmsc->media_buf_idx = 0;
+    hmsc->media_prefetched = 0;
+    #endif
 
     /* cases 4,5 : Hi <> Dn */
     if (hmsc->cbw.dDataLength != hmsc->scsi_blk_len)
@@ -612,6 +616,9 @@ static int8_t SCSI_Write10 (USBD_HandleTypeDef  *pdev, uint8_t lun , uint8_t *pa
 
     /* Prepare EP to receive first data packet */
     hmsc->bot_state = USBD_BOT_DATA_OUT;
+    #if MICROPY_HW_USB_MSC_DOUBLE_BUFFER
+    hmsc->media_buf_idx = 0;
+    #endif
     USBD_LL_PrepareReceive (pdev,
                       MSC_OUT_EP,
                       hmsc->bot_data,
@@ -683,6 +690,13 @@ static int8_t SCSI_CheckAddressRange (USBD_HandleTypeDef  *pdev, uint8_t lun , u
   return 0;
 }
 
+#if MICROPY_HW_USB_MSC_DOUBLE_BUFFER
+static uint8_t *SCSI_MediaBuf(USBD_MSC_BOT_HandleTypeDef *hmsc, uint8_t idx)
+{
+  return idx ? hmsc->bot_data_alt : hmsc->bot_data;
+}
+#endif
+
 /**
 * @brief  SCSI_ProcessRead
 *         Handle Read Process
@@ -694,10 +708,16 @@ static int8_t SCSI_ProcessRead (USBD_HandleTypeDef  *pdev, uint8_t lun)
   USBD_MSC_BOT_HandleTypeDef *hmsc = &((usbd_cdc_msc_hid_state_t*)pdev->pClassData)->MSC_BOT_ClassData;
   uint32_t len;
 
+  uint8_t *buf = hmsc->bot_data;
+
   len = MIN(hmsc->scsi_blk_len , MSC_MEDIA_PACKET);
 
+  #if MICROPY_HW_USB_MSC_DOUBLE_BUFFER
+  buf = SCSI_MediaBuf(hmsc, hmsc->media_buf_idx);
+  if (!hmsc->media_prefetched)
+  #endif
   if( hmsc->bdev_ops->Read(lun ,
-                              hmsc->bot_data,
+                              buf,
                               hmsc->scsi_blk_addr_in_blks,
                               len / hmsc->scsi_blk_size[lun]) < 0)
   {
@@ -712,7 +732,7 @@ static int8_t SCSI_ProcessRead (USBD_HandleTypeDef  *pdev, uint8_t lun)
 
   USBD_LL_Transmit (pdev,
              MSC_IN_EP,
-             hmsc->bot_data,
+             buf,
              len);
 
 
@@ -726,6 +746,21 @@ static int8_t SCSI_ProcessRead (USBD_HandleTypeDef  *pdev, uint8_t lun)
   {
     hmsc->bot_state = USBD_BOT_LAST_DATA_IN;
   }
+
+  #if MICROPY_HW_USB_MSC_DOUBLE_BUFFER
+  // While that buffer is being sent, read the next chunk into the other one.
+  // If this fails then the read is retried, and the error reported, next time.
+  hmsc->media_buf_idx ^= 1;
+  hmsc->media_prefetched = 0;
+  if (hmsc->scsi_blk_len > 0)
+  {
+    len = MIN(hmsc->scsi_blk_len, MSC_MEDIA_PACKET);
+    hmsc->media_prefetched = hmsc->bdev_ops->Read(lun,
+                                                  SCSI_MediaBuf(hmsc, hmsc->media_buf_idx),
+                                                  hmsc->scsi_blk_addr_in_blks,
+                                                  len / hmsc->scsi_blk_size[lun]) >= 0;
+  }
+  #endif
   return 0;
 }
 
@@ -741,10 +776,25 @@ static int8_t SCSI_ProcessWrite (USBD_HandleTypeDef  *pdev, uint8_t lun)
   uint32_t len;
   USBD_MSC_BOT_HandleTypeDef *hmsc = &((usbd_cdc_msc_hid_state_t*)pdev->pClassData)->MSC_BOT_ClassData;
 
+  uint8_t *buf = hmsc->bot_data;
+
   len = MIN(hmsc->scsi_blk_len , MSC_MEDIA_PACKET);
 
+  #if MICROPY_HW_USB_MSC_DOUBLE_BUFFER
+  // Receive the next chunk into the other buffer while this one is written
+  buf = SCSI_MediaBuf(hmsc, hmsc->media_buf_idx);
+  if (hmsc->scsi_blk_len > len)
+  {
+    hmsc->media_buf_idx ^= 1;
+    USBD_LL_PrepareReceive (pdev,
+                            MSC_OUT_EP,
+                            SCSI_MediaBuf(hmsc, hmsc->media_buf_idx),
+                            MIN (hmsc->scsi_blk_len - len, MSC_MEDIA_PACKET));
+  }
+  #endif
+
   if(hmsc->bdev_ops->Write(lun ,
-                              hmsc->bot_data,
+                              buf,
                               hmsc->scsi_blk_addr_in_blks,
                               len / hmsc->scsi_blk_size[lun]) < 0)
   {
@@ -766,6 +816,7 @@ static int8_t SCSI_ProcessWrite (USBD_HandleTypeDef  *pdev, uint8_t lun)
   {
     MSC_BOT_SendCSW (pdev, USBD_CSW_CMD_PASSED);
   }
+  #if !MICROPY_HW_USB_MSC_DOUBLE_BUFFER
   else
   {
     /* Prapare EP to Receive next packet */
@@ -774,6 +825,7 @@ static int8_t SCSI_ProcessWrite (USBD_HandleTypeDef  *pdev, uint8_t lun)
                             hmsc->bot_data,
                             MIN (hmsc->scsi_blk_len, MSC_MEDIA_PACKET));
   }
+  #endif
 
   return 0;
 }
@@ -29,9 +29,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <unistd.h>
 
 #include "py/mpstate.h"
 #include "py/gc.h"
+#include "py/qstr.h"
 
 #if MICROPY_EMIT_NATIVE || (MICROPY_PY_FFI && MICROPY_FORCE_PLAT_ALLOC_EXEC)
 
@@ -105,3 +107,27 @@ void ffi_closure_free(void *ptr) {
 #endif
 
 #endif // MICROPY_EMIT_NATIVE || (MICROPY_PY_FFI && MICROPY_FORCE_PLAT_ALLOC_EXEC)
+
+#if MICROPY_EMIT_MACHINE_CODE
+
+// With the "-X perfmap" option, native code is listed in /tmp/perf-<pid>.map,
+// which is where the Linux perf tool looks for the names of JIT-compiled code.
+STATIC FILE *perf_map;
+
+void mp_unix_perf_map_open(void) {
+    char path[32];
+    snprintf(path, sizeof(path), "/tmp/perf-%d.map", (int)getpid());
+    perf_map = fopen(path, "w");
+}
+
+void mp_unix_perf_map_add(const void *code, size_t len, size_t name) {
+    if (perf_map == NULL) {
+        return;
+    }
+    // Each line is "<start> <size> <name>", with the numbers in hex
+    fprintf(perf_map, "%lx %lx py::%s\n", (unsigned long)(uintptr_t)code, (unsigned long)len,
+        name == MP_QSTR_ ? "<native>" : qstr_str(name));
+    fflush(perf_map);
+}
+
+#endif // MICROPY_EMIT_MACHINE_CODE
@@ -0,0 +1,756 @@
+//
+// Content for MICROPY_MODULE_FROZEN_STR
+//
+#include <stddef.h>
+#include <stdint.h>
+#define MP_FROZEN_STR_NAMES \
+"frzstr1.py\0" \
+"frzstr_pkg1/__init__.py\0" \
+"frzstr_pkg2/mod.py\0" \
+
+extern const char mp_frozen_names[];
+const char *const mp_frozen_str_names[] = {
+    &mp_frozen_names[0],
+    &mp_frozen_names[11],
+    &mp_frozen_names[35],
+    NULL
+};
+const size_t mp_frozen_str_names_len = 3;
+const uint32_t mp_frozen_str_sizes[] = { 17, 75, 90, 0 };
+const char mp_frozen_str_content[] = {
+"print(\"frzstr1\")\n\0"
+"# test frozen package with __init__.py\nprint(\"frzstr_pkg1.__init__\")\nx = 1\n\0"
+"# test frozen package without __init__.py\nprint(\"frzstr_pkg2.mod\")\n\n\nclass Foo:\n    x = 1\n\0"
+"\0"
+};
+
+//
+// Content for MICROPY_MODULE_FROZEN_MPY
+//
+#include "py/mpconfig.h"
+#include "py/objint.h"
+#include "py/objstr.h"
+#include "py/emitglue.h"
+#include "py/nativeglue.h"
+
+#if MICROPY_LONGINT_IMPL != 2
+#error "incompatible MICROPY_LONGINT_IMPL"
+#endif
+
+#if MPZ_DIG_SIZE != 16
+#error "incompatible MPZ_DIG_SIZE"
+#endif
+
+#if MICROPY_PY_BUILTINS_FLOAT
+typedef struct _mp_obj_float_t {
+    mp_obj_base_t base;
+    mp_float_t value;
+} mp_obj_float_t;
+#endif
+
+#if MICROPY_PY_BUILTINS_COMPLEX
+typedef struct _mp_obj_complex_t {
+    mp_obj_base_t base;
+    mp_float_t real;
+    mp_float_t imag;
+} mp_obj_complex_t;
+#endif
+
+enum {
+    MP_QSTR_frzqstr_dot_py = MP_QSTRnumber_of,
+    MP_QSTR_returns_NULL,
+    MP_QSTR_NULL,
+    MP_QSTR_frzmpy3_dot_py,
+    MP_QSTR__backslash_,
+    MP_QSTR__0x0a_X,
+    MP_QSTR__0x1b_,
+    MP_QSTR_frzmpy2_dot_py,
+    MP_QSTR_frzmpy1_dot_py,
+    MP_QSTR_frzmpy1,
+    MP_QSTR_frzmpy_pkg1_slash___init___dot_py,
+    MP_QSTR_x,
+    MP_QSTR_frzmpy_pkg1_dot___init__,
+    MP_QSTR_frzmpy_pkg2_slash_mod_dot_py,
+    MP_QSTR_Foo,
+    MP_QSTR_frzmpy_pkg2_dot_mod,
+};
+
+const qstr_hash_t mp_qstr_frozen_const_hashes[] = {
+    18600,
+    9176,
+    43166,
+    62587,
+    46585,
+    27607,
+    46526,
+    28762,
+    64441,
+    37342,
+    46383,
+    46557,
+    38281,
+    23952,
+    47043,
+    12854,
+};
+
+const qstr_len_t mp_qstr_frozen_const_lengths[] = {
+    10,
+    12,
+    4,
+    10,
+    1,
+    2,
+    1,
+    10,
+    10,
+    7,
+    23,
+    1,
+    20,
+    18,
+    3,
+    15,
+};
+
+extern const qstr_pool_t mp_qstr_const_pool;
+const qstr_pool_t mp_qstr_frozen_const_pool = {
+    &mp_qstr_const_pool, // previous pool
+    MP_QSTRnumber_of, // previous pool size
+    10, // allocated entries
+    16, // used entries
+    (qstr_hash_t *)mp_qstr_frozen_const_hashes,
+    (qstr_len_t *)mp_qstr_frozen_const_lengths,
+    {
+        "frzqstr.py",
+        "returns_NULL",
+        "NULL",
+        "frzmpy3.py",
+        "\x5c",
+        "\x0a\x58",
+        "\x1b",
+        "frzmpy2.py",
+        "frzmpy1.py",
+        "frzmpy1",
+        "frzmpy_pkg1/__init__.py",
+        "x",
+        "frzmpy_pkg1.__init__",
+        "frzmpy_pkg2/mod.py",
+        "Foo",
+        "frzmpy_pkg2.mod",
+    },
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzqstr
+// - original source file: build-coverage/frozen_mpy/frzqstr.mpy
+// - frozen file name: frzqstr.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzqstr.py, scope frzqstr__lt_module_gt_
+static const byte fun_data_frzqstr__lt_module_gt_[10] = {
+    0x00,0x04, // prelude
+    0x01, // names: <module>
+    0x20, // code info
+    0x32,0x00, // MAKE_FUNCTION 0
+    0x16,0x02, // STORE_NAME 'returns_NULL'
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+// child of frzqstr__lt_module_gt_
+// frozen bytecode for file frzqstr.py, scope frzqstr_returns_NULL
+static const byte fun_data_frzqstr_returns_NULL[7] = {
+    0x00,0x04, // prelude
+    0x02, // names: returns_NULL
+    0x40, // code info
+    0x10,0x03, // LOAD_CONST_STRING 'NULL'
+    0x63, // RETURN_VALUE
+};
+static MP_RAW_CODE_FROZEN_CONST mp_raw_code_t raw_code_frzqstr_returns_NULL = {
+    .kind = MP_CODE_BYTECODE,
+    .scope_flags = 0x00,
+    .n_pos_args = 0,
+    .fun_data = fun_data_frzqstr_returns_NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE || MICROPY_DEBUG_PRINTERS
+    .fun_data_len = 7,
+    #endif
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .n_children = 0,
+    #if MICROPY_PY_SYS_SETTRACE
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 2,
+        .line_info = fun_data_frzqstr_returns_NULL + 3,
+        .opcodes = fun_data_frzqstr_returns_NULL + 4,
+    },
+    .line_of_definition = 0,
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .type_sig = 0,
+    #endif
+};
+
+static const mp_raw_code_t *const children_frzqstr__lt_module_gt_[] = {
+    &raw_code_frzqstr_returns_NULL,
+};
+
+static MP_RAW_CODE_FROZEN_CONST mp_raw_code_t raw_code_frzqstr__lt_module_gt_ = {
+    .kind = MP_CODE_BYTECODE,
+    .scope_flags = 0x00,
+    .n_pos_args = 0,
+    .fun_data = fun_data_frzqstr__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE || MICROPY_DEBUG_PRINTERS
+    .fun_data_len = 10,
+    #endif
+    .children = (void *)&children_frzqstr__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .n_children = 1,
+    #if MICROPY_PY_SYS_SETTRACE
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzqstr__lt_module_gt_ + 3,
+        .opcodes = fun_data_frzqstr__lt_module_gt_ + 4,
+    },
+    .line_of_definition = 0,
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .type_sig = 0,
+    #endif
+};
+
+static const qstr_short_t const_qstr_table_data_frzqstr[4] = {
+    MP_QSTR_frzqstr_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_returns_NULL,
+    MP_QSTR_NULL,
+};
+
+static const mp_frozen_module_t frozen_module_frzqstr = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzqstr,
+        .obj_table = NULL,
+    },
+    .rc = &raw_code_frzqstr__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy3
+// - original source file: build-coverage/frozen_mpy/frzmpy3.mpy
+// - frozen file name: frzmpy3.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy3.py, scope frzmpy3__lt_module_gt_
+static const byte fun_data_frzmpy3__lt_module_gt_[41] = {
+    0x10,0x0a, // prelude
+    0x01, // names: <module>
+    0x40,0x27,0x27,0x2b, // code info
+    0x11,0x05, // LOAD_NAME 'print'
+    0x10,0x02, // LOAD_CONST_STRING '\\'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x05, // LOAD_NAME 'print'
+    0x10,0x03, // LOAD_CONST_STRING '\nX'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x05, // LOAD_NAME 'print'
+    0x11,0x06, // LOAD_NAME 'repr'
+    0x10,0x04, // LOAD_CONST_STRING '\x1b'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x05, // LOAD_NAME 'print'
+    0x23,0x00, // LOAD_CONST_OBJ 0
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+static MP_RAW_CODE_FROZEN_CONST mp_raw_code_t raw_code_frzmpy3__lt_module_gt_ = {
+    .kind = MP_CODE_BYTECODE,
+    .scope_flags = 0x00,
+    .n_pos_args = 0,
+    .fun_data = fun_data_frzmpy3__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE || MICROPY_DEBUG_PRINTERS
+    .fun_data_len = 41,
+    #endif
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .n_children = 0,
+    #if MICROPY_PY_SYS_SETTRACE
+    .prelude = {
+        .n_state = 3,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy3__lt_module_gt_ + 3,
+        .opcodes = fun_data_frzmpy3__lt_module_gt_ + 7,
+    },
+    .line_of_definition = 0,
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .type_sig = 0,
+    #endif
+};
+
+static const qstr_short_t const_qstr_table_data_frzmpy3[7] = {
+    MP_QSTR_frzmpy3_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR__backslash_,
+    MP_QSTR__0x0a_X,
+    MP_QSTR__0x1b_,
+    MP_QSTR_print,
+    MP_QSTR_repr,
+};
+
+// constants
+static const mp_obj_str_t const_obj_frzmpy3_0 = {{&mp_type_bytes}, 27322, 2, (const byte*)"\x00\xff"};
+
+// constant table
+static const mp_rom_obj_t const_obj_table_data_frzmpy3[1] = {
+    MP_ROM_PTR(&const_obj_frzmpy3_0),
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy3 = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy3,
+        .obj_table = (mp_obj_t *)&const_obj_table_data_frzmpy3,
+    },
+    .rc = &raw_code_frzmpy3__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy2
+// - original source file: build-coverage/frozen_mpy/frzmpy2.mpy
+// - frozen file name: frzmpy2.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy2.py, scope frzmpy2__lt_module_gt_
+static const byte fun_data_frzmpy2__lt_module_gt_[8] = {
+    0x00,0x02, // prelude
+    0x01, // names: <module>
+     // code info
+    0x11,0x02, // LOAD_NAME 'ZeroDivisionError'
+    0x65, // RAISE_OBJ
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+static MP_RAW_CODE_FROZEN_CONST mp_raw_code_t raw_code_frzmpy2__lt_module_gt_ = {
+    .kind = MP_CODE_BYTECODE,
+    .scope_flags = 0x00,
+    .n_pos_args = 0,
+    .fun_data = fun_data_frzmpy2__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE || MICROPY_DEBUG_PRINTERS
+    .fun_data_len = 8,
+    #endif
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .n_children = 0,
+    #if MICROPY_PY_SYS_SETTRACE
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy2__lt_module_gt_ + 3,
+        .opcodes = fun_data_frzmpy2__lt_module_gt_ + 3,
+    },
+    .line_of_definition = 0,
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .type_sig = 0,
+    #endif
+};
+
+static const qstr_short_t const_qstr_table_data_frzmpy2[3] = {
+    MP_QSTR_frzmpy2_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_ZeroDivisionError,
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy2 = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy2,
+        .obj_table = NULL,
+    },
+    .rc = &raw_code_frzmpy2__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy1
+// - original source file: build-coverage/frozen_mpy/frzmpy1.mpy
+// - frozen file name: frzmpy1.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy1.py, scope frzmpy1__lt_module_gt_
+static const byte fun_data_frzmpy1__lt_module_gt_[12] = {
+    0x08,0x02, // prelude
+    0x01, // names: <module>
+     // code info
+    0x11,0x03, // LOAD_NAME 'print'
+    0x10,0x02, // LOAD_CONST_STRING 'frzmpy1'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+static MP_RAW_CODE_FROZEN_CONST mp_raw_code_t raw_code_frzmpy1__lt_module_gt_ = {
+    .kind = MP_CODE_BYTECODE,
+    .scope_flags = 0x00,
+    .n_pos_args = 0,
+    .fun_data = fun_data_frzmpy1__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE || MICROPY_DEBUG_PRINTERS
+    .fun_data_len = 12,
+    #endif
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .n_children = 0,
+    #if MICROPY_PY_SYS_SETTRACE
+    .prelude = {
+        .n_state = 2,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy1__lt_module_gt_ + 3,
+        .opcodes = fun_data_frzmpy1__lt_module_gt_ + 3,
+    },
+    .line_of_definition = 0,
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .type_sig = 0,
+    #endif
+};
+
+static const qstr_short_t const_qstr_table_data_frzmpy1[4] = {
+    MP_QSTR_frzmpy1_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_frzmpy1,
+    MP_QSTR_print,
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy1 = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy1,
+        .obj_table = NULL,
+    },
+    .rc = &raw_code_frzmpy1__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy_pkg1___init__
+// - original source file: build-coverage/frozen_mpy/frzmpy_pkg1/__init__.mpy
+// - frozen file name: frzmpy_pkg1/__init__.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy_pkg1/__init__.py, scope frzmpy_pkg1___init____lt_module_gt_
+static const byte fun_data_frzmpy_pkg1___init____lt_module_gt_[17] = {
+    0x08,0x06, // prelude
+    0x01, // names: <module>
+    0x20,0x27, // code info
+    0x11,0x02, // LOAD_NAME 'print'
+    0x23,0x00, // LOAD_CONST_OBJ 0
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x81, // LOAD_CONST_SMALL_INT 1
+    0x16,0x03, // STORE_NAME 'x'
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+static MP_RAW_CODE_FROZEN_CONST mp_raw_code_t raw_code_frzmpy_pkg1___init____lt_module_gt_ = {
+    .kind = MP_CODE_BYTECODE,
+    .scope_flags = 0x00,
+    .n_pos_args = 0,
+    .fun_data = fun_data_frzmpy_pkg1___init____lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE || MICROPY_DEBUG_PRINTERS
+    .fun_data_len = 17,
+    #endif
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .n_children = 0,
+    #if MICROPY_PY_SYS_SETTRACE
+    .prelude = {
+        .n_state = 2,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy_pkg1___init____lt_module_gt_ + 3,
+        .opcodes = fun_data_frzmpy_pkg1___init____lt_module_gt_ + 5,
+    },
+    .line_of_definition = 0,
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .type_sig = 0,
+    #endif
+};
+
+static const qstr_short_t const_qstr_table_data_frzmpy_pkg1___init__[4] = {
+    MP_QSTR_frzmpy_pkg1_slash___init___dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_print,
+    MP_QSTR_x,
+};
+
+// constants
+
+// constant table
+static const mp_rom_obj_t const_obj_table_data_frzmpy_pkg1___init__[1] = {
+    MP_ROM_QSTR(MP_QSTR_frzmpy_pkg1_dot___init__),
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy_pkg1___init__ = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy_pkg1___init__,
+        .obj_table = (mp_obj_t *)&const_obj_table_data_frzmpy_pkg1___init__,
+    },
+    .rc = &raw_code_frzmpy_pkg1___init____lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy_pkg2_mod
+// - original source file: build-coverage/frozen_mpy/frzmpy_pkg2/mod.mpy
+// - frozen file name: frzmpy_pkg2/mod.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy_pkg2/mod.py, scope frzmpy_pkg2_mod__lt_module_gt_
+static const byte fun_data_frzmpy_pkg2_mod__lt_module_gt_[23] = {
+    0x10,0x06, // prelude
+    0x01, // names: <module>
+    0x20,0x67, // code info
+    0x11,0x03, // LOAD_NAME 'print'
+    0x23,0x00, // LOAD_CONST_OBJ 0
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x54, // LOAD_BUILD_CLASS
+    0x32,0x00, // MAKE_FUNCTION 0
+    0x10,0x02, // LOAD_CONST_STRING 'Foo'
+    0x34,0x02, // CALL_FUNCTION 2
+    0x16,0x02, // STORE_NAME 'Foo'
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+// child of frzmpy_pkg2_mod__lt_module_gt_
+// frozen bytecode for file frzmpy_pkg2/mod.py, scope frzmpy_pkg2_mod_Foo
+static const byte fun_data_frzmpy_pkg2_mod_Foo[18] = {
+    0x00,0x06, // prelude
+    0x02, // names: Foo
+    0x68,0x40, // code info
+    0x11,0x04, // LOAD_NAME '__name__'
+    0x16,0x05, // STORE_NAME '__module__'
+    0x10,0x02, // LOAD_CONST_STRING 'Foo'
+    0x16,0x06, // STORE_NAME '__qualname__'
+    0x81, // LOAD_CONST_SMALL_INT 1
+    0x16,0x07, // STORE_NAME 'x'
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+static MP_RAW_CODE_FROZEN_CONST mp_raw_code_t raw_code_frzmpy_pkg2_mod_Foo = {
+    .kind = MP_CODE_BYTECODE,
+    .scope_flags = 0x00,
+    .n_pos_args = 0,
+    .fun_data = fun_data_frzmpy_pkg2_mod_Foo,
+    #if MICROPY_PERSISTENT_CODE_SAVE || MICROPY_DEBUG_PRINTERS
+    .fun_data_len = 18,
+    #endif
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .n_children = 0,
+    #if MICROPY_PY_SYS_SETTRACE
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 2,
+        .line_info = fun_data_frzmpy_pkg2_mod_Foo + 3,
+        .opcodes = fun_data_frzmpy_pkg2_mod_Foo + 5,
+    },
+    .line_of_definition = 0,
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .type_sig = 0,
+    #endif
+};
+
+static const mp_raw_code_t *const children_frzmpy_pkg2_mod__lt_module_gt_[] = {
+    &raw_code_frzmpy_pkg2_mod_Foo,
+};
+
+static MP_RAW_CODE_FROZEN_CONST mp_raw_code_t raw_code_frzmpy_pkg2_mod__lt_module_gt_ = {
+    .kind = MP_CODE_BYTECODE,
+    .scope_flags = 0x00,
+    .n_pos_args = 0,
+    .fun_data = fun_data_frzmpy_pkg2_mod__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE || MICROPY_DEBUG_PRINTERS
+    .fun_data_len = 23,
+    #endif
+    .children = (void *)&children_frzmpy_pkg2_mod__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .n_children = 1,
+    #if MICROPY_PY_SYS_SETTRACE
+    .prelude = {
+        .n_state = 3,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy_pkg2_mod__lt_module_gt_ + 3,
+        .opcodes = fun_data_frzmpy_pkg2_mod__lt_module_gt_ + 5,
+    },
+    .line_of_definition = 0,
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #endif
+    #if MICROPY_EMIT_MACHINE_CODE
+    .type_sig = 0,
+    #endif
+};
+
+static const qstr_short_t const_qstr_table_data_frzmpy_pkg2_mod[8] = {
+    MP_QSTR_frzmpy_pkg2_slash_mod_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_Foo,
+    MP_QSTR_print,
+    MP_QSTR___name__,
+    MP_QSTR___module__,
+    MP_QSTR___qualname__,
+    MP_QSTR_x,
+};
+
+// constants
+
+// constant table
+static const mp_rom_obj_t const_obj_table_data_frzmpy_pkg2_mod[1] = {
+    MP_ROM_QSTR(MP_QSTR_frzmpy_pkg2_dot_mod),
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy_pkg2_mod = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy_pkg2_mod,
+        .obj_table = (mp_obj_t *)&const_obj_table_data_frzmpy_pkg2_mod,
+    },
+    .rc = &raw_code_frzmpy_pkg2_mod__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// collection of all frozen modules
+
+const char mp_frozen_names[] = {
+    #ifdef MP_FROZEN_STR_NAMES
+    MP_FROZEN_STR_NAMES
+    #endif
+    "frzmpy1.py\0"
+    "frzmpy2.py\0"
+    "frzmpy3.py\0"
+    "frzmpy_pkg1/__init__.py\0"
+    "frzmpy_pkg2/mod.py\0"
+    "frzqstr.py\0"
+    "\0"
+};
+
+#ifdef MP_FROZEN_STR_NAMES
+#define MP_FROZEN_MPY_NAMES_BASE (sizeof("" MP_FROZEN_STR_NAMES) - 1)
+#else
+#define MP_FROZEN_MPY_NAMES_BASE (0)
+#endif
+const char *const mp_frozen_mpy_names[] = {
+    &mp_frozen_names[MP_FROZEN_MPY_NAMES_BASE + 0],
+    &mp_frozen_names[MP_FROZEN_MPY_NAMES_BASE + 11],
+    &mp_frozen_names[MP_FROZEN_MPY_NAMES_BASE + 22],
+    &mp_frozen_names[MP_FROZEN_MPY_NAMES_BASE + 33],
+    &mp_frozen_names[MP_FROZEN_MPY_NAMES_BASE + 57],
+    &mp_frozen_names[MP_FROZEN_MPY_NAMES_BASE + 76],
+    NULL
+};
+const size_t mp_frozen_mpy_names_len = 6;
+
+const mp_frozen_module_t *const mp_frozen_mpy_content[] = {
+    &frozen_module_frzmpy1,
+    &frozen_module_frzmpy2,
+    &frozen_module_frzmpy3,
+    &frozen_module_frzmpy_pkg1___init__,
+    &frozen_module_frzmpy_pkg2_mod,
+    &frozen_module_frzqstr,
+};
+
+#ifdef MICROPY_FROZEN_LIST_ITEM
+MICROPY_FROZEN_LIST_ITEM("frzqstr", "frzqstr.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy3", "frzmpy3.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy2", "frzmpy2.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy1", "frzmpy1.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy_pkg1", "frzmpy_pkg1/__init__.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy_pkg2/mod", "frzmpy_pkg2/mod.py")
+#endif
+
+/*
+byte sizes:
+qstr content: 16 unique, 211 bytes
+bc content: 136
+bc shared: 0
+const str content: 2
+const int content: 0
+const obj content: 16
+const obj shared: 0
+const table qstr content: 0 entries, 0 bytes
+const table ptr content: 3 entries, 12 bytes
+raw code content: 8 * 4 = 128
+mp_frozen_mpy_names_content: 112
+mp_frozen_mpy_content_size: 24
+total: 641
+*/
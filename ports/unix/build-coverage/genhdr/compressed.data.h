@@ -0,0 +1,264 @@
+#define MP_MAX_UNCOMPRESSED_TEXT_LEN (73)
+MP_COMPRESSED_DATA("can'\364'%q\247objec\364functio\356forma\364argumen\364argument\363invali\344mus\364no\364keywor\344positiona\354typ\345t\357'%s\247specifie\362conver\364fo\362lengt\350strin\347b\345o\346unsupporte\344require\344wit\350\341i\356inde\370ar\347attribut\345expectin\347outsid\345supporte\344%\344empt\371implemente\344isn'\364assignmen\364erro\362fro\355generato\362expecte\344multipl\345n\357overflo\367car\344comple\370doesn'\364missin\347rang\345unknow\356conversio\356identifie\362unexpecte\344buffe\362synta\370bu\364dic\364ha\363in\364lis\364nam\345afte\362a\356clas\363fiel\344foun\344give\356mismatc\350need\363nonloca\354sequenc\345tupl\345allowe\344indice\363ou\364struct\272to\357%\361i\363o\362siz\345zer\357impor\364numbe\362shoul\344specificatio\356value\363incompatibl\345issubclass(\251%\363an\344byte\363floa\364leve\354loca\354se\364stor\345take\363valu\345wron\347allocatio\356expressio\356implicitl\371incomplet\345arg\363automati\343fil\345hea\360integers\254man\371numberin\347operatio\356redefine\344sel\346S\304negativ\345variabl\345defaul\364failed\254go\364intege\362suppor\364timeou\364waitin\347befor\345binar\371divid\345")
+MP_MATCH_COMPRESSED("%c needs int or char", "\377%c\305\273\320char")
+MP_MATCH_COMPRESSED("%q index out of range", "\377\316\233\313\225\261")
+MP_MATCH_COMPRESSED("%q indices must be integers, not %s", "\377\316\312\210\224\355\211\332")
+MP_MATCH_COMPRESSED("%q() takes %d positional arguments but %d were given", "\377%q()\342\241\213\206\270\241were\303")
+MP_MATCH_COMPRESSED("'%q' argument required", "\377\201\205\227")
+MP_MATCH_COMPRESSED("'%q' in __slots__ conflicts with class variable", "\377\201\232__slots__ conflicts\230\300\365")
+MP_MATCH_COMPRESSED("'%s' object doesn't support item assignment", "\377\216\202\257\372item\245")
+MP_MATCH_COMPRESSED("'%s' object doesn't support item deletion", "\377\216\202\257\372item deletion")
+MP_MATCH_COMPRESSED("'%s' object has no attribute '%q'", "\377\216\202\272\253\235\201")
+MP_MATCH_COMPRESSED("'%s' object isn't an iterator", "\377\216\202\244\277iterator")
+MP_MATCH_COMPRESSED("'%s' object isn't callable", "\377\216\202\244callable")
+MP_MATCH_COMPRESSED("'%s' object isn't iterable", "\377\216\202\244iterable")
+MP_MATCH_COMPRESSED("'%s' object isn't subscriptable", "\377\216\202\244subscriptable")
+MP_MATCH_COMPRESSED("'=' alignment not allowed in string format specifier", "\377'=' alignment\211\311\232\223\204\217")
+MP_MATCH_COMPRESSED("'await' outside function", "\377'await'\237\203")
+MP_MATCH_COMPRESSED("'break'/'continue' outside loop", "\377'break'/'continue'\237loop")
+MP_MATCH_COMPRESSED("'return' outside function", "\377'return'\237\203")
+MP_MATCH_COMPRESSED("'yield' outside function", "\377'yield'\237\203")
+MP_MATCH_COMPRESSED("* arg after **", "\377*\234\276**")
+MP_MATCH_COMPRESSED("*x must be assignment target", "\377*x\210\224\245target")
+MP_MATCH_COMPRESSED("-inf + inf in fsum", "\377-inf + inf\232fsum")
+MP_MATCH_COMPRESSED("0.0 to a complex power", "\3770.0\215\231\256power")
+MP_MATCH_COMPRESSED("I/O operation on closed file", "\377I/O\360on closed\353")
+MP_MATCH_COMPRESSED("LHS of keyword arg must be an id", "\377LHS\225\212\234\210\224\277id")
+MP_MATCH_COMPRESSED("Lock not acquired", "\377Lock\211acquired")
+MP_MATCH_COMPRESSED("SD card CSD format not supported", "\377\363\255CSD\204\211\240")
+MP_MATCH_COMPRESSED("[addrinfo error %d]", "\377[addrinfo\246%d]")
+MP_MATCH_COMPRESSED("__init__() should return None, not '%s'", "\377__init__()\325return None,\211\216")
+MP_MATCH_COMPRESSED("abort() called", "abort() called")
+MP_MATCH_COMPRESSED("address %08x is not aligned to %d bytes", "\377address %08x\317\211aligned\215\241\334")
+MP_MATCH_COMPRESSED("annotation must be an identifier", "\377annotation\210\224\277\264")
+MP_MATCH_COMPRESSED("arg is an empty sequence", "\377\234\317\277\242\307")
+MP_MATCH_COMPRESSED("arg must be user-type", "\377\234\210\224user-type")
+MP_MATCH_COMPRESSED("argument name reused", "\377\205\275reused")
+MP_MATCH_COMPRESSED("argument num/types mismatch", "\377\205num/types\304")
+MP_MATCH_COMPRESSED("argument should be a '%q' not a '%q'", "\377\205\325\224\231\201\211\231\201")
+MP_MATCH_COMPRESSED("array/bytes required on right side", "\377array/bytes\227on right side")
+MP_MATCH_COMPRESSED("async for/with outside async function", "\377async for/with\237async\203")
+MP_MATCH_COMPRESSED("attributes not supported yet", "\377attributes\211\240yet")
+MP_MATCH_COMPRESSED("bad compile mode", "bad compile mode")
+MP_MATCH_COMPRESSED("bad typecode", "bad typecode")
+MP_MATCH_COMPRESSED("binary op %q not implemented", "\377\376op\316\211\243")
+MP_MATCH_COMPRESSED("bits must be 32 or less", "\377bits\210\22432\320less")
+MP_MATCH_COMPRESSED("buffer length is invalid", "\377\266\222\317\207")
+MP_MATCH_COMPRESSED("buffer size must be a multiple of struct size", "\377\266\321\210\224\231\252\225struct\321")
+MP_MATCH_COMPRESSED("buffer too small", "\377\266\315small")
+MP_MATCH_COMPRESSED("buffers must be the same length", "\377buffers\210\224the same\222")
+MP_MATCH_COMPRESSED("bytecode overflow", "\377bytecode\254")
+MP_MATCH_COMPRESSED("bytes value out of range", "\377\334\343\313\225\261")
+MP_MATCH_COMPRESSED("can't add special method to already-subclassed class", "\377\200add special method\215already-subclassed\300")
+MP_MATCH_COMPRESSED("can't assign to expression", "\377\200assign\215\346")
+MP_MATCH_COMPRESSED("can't cancel self", "\377\200cancel\362")
+MP_MATCH_COMPRESSED("can't convert %s to complex", "\377\200\220\332\215\256")
+MP_MATCH_COMPRESSED("can't convert %s to float", "\377\200\220\332\215\335")
+MP_MATCH_COMPRESSED("can't convert %s to int", "\377\200\220\332\215\273")
+MP_MATCH_COMPRESSED("can't convert '%q' object to %q implicitly", "\377\200\220\201\202\215\316\347")
+MP_MATCH_COMPRESSED("can't convert NaN to int", "\377\200\220NaN\215\273")
+MP_MATCH_COMPRESSED("can't convert inf to int", "\377\200\220inf\215\273")
+MP_MATCH_COMPRESSED("can't create '%q' instances", "\377\200create\201instances")
+MP_MATCH_COMPRESSED("can't declare nonlocal in outer code", "\377\200declare\306\232outer code")
+MP_MATCH_COMPRESSED("can't delete expression", "\377\200delete\346")
+MP_MATCH_COMPRESSED("can't do binary op between '%q' and '%q'", "\377\200do\376op between\201\333\201")
+MP_MATCH_COMPRESSED("can't implicitly convert '%q' to 'bool'", "\377\200\347\220\201\215'bool'")
+MP_MATCH_COMPRESSED("can't import name %q", "\377\200\323\275\316")
+MP_MATCH_COMPRESSED("can't load from '%q'", "\377\200load\247\201")
+MP_MATCH_COMPRESSED("can't load with '%q' index", "\377\200load\230\201\233")
+MP_MATCH_COMPRESSED("can't perform relative import", "\377\200perform relative\323")
+MP_MATCH_COMPRESSED("can't send non-None value to a just-started generator", "\377\200send non-None\343\215\231just-started\250")
+MP_MATCH_COMPRESSED("can't set 512 block size", "\377\200\340512 block\321")
+MP_MATCH_COMPRESSED("can't set attribute", "\377\200\340\235")
+MP_MATCH_COMPRESSED("can't share object with interpreter", "\377\200share\202\230interpreter")
+MP_MATCH_COMPRESSED("can't store '%q'", "\377\200\341\201")
+MP_MATCH_COMPRESSED("can't store to '%q'", "\377\200\341\215\201")
+MP_MATCH_COMPRESSED("can't store with '%q' index", "\377\200\341\230\201\233")
+MP_MATCH_COMPRESSED("can't switch from automatic field numbering to manual field specification", "\377\200switch\247\352\301\357\215manual\301\326")
+MP_MATCH_COMPRESSED("can't switch from manual field specification to automatic field numbering", "\377\200switch\247manual\301\326\215\352\301\357")
+MP_MATCH_COMPRESSED("can't truncate-divide a complex number", "\377\200truncate-divide\231\256\324")
+MP_MATCH_COMPRESSED("can't unambiguously get sizeof scalar", "\377\200unambiguously get sizeof scalar")
+MP_MATCH_COMPRESSED("can't wait", "\377\200wait")
+MP_MATCH_COMPRESSED("casting", "casting")
+MP_MATCH_COMPRESSED("chr() arg not in range(0x110000)", "\377chr()\234\211\232range(0x110000)")
+MP_MATCH_COMPRESSED("comparison of int and uint", "\377comparison\225\273\333uint")
+MP_MATCH_COMPRESSED("complex divide by zero", "\377\256\377by\322")
+MP_MATCH_COMPRESSED("compression header", "compression header")
+MP_MATCH_COMPRESSED("conversion to object", "\377\263\215\202")
+MP_MATCH_COMPRESSED("couldn't determine SD card version", "\377couldn't determine\363\255version")
+MP_MATCH_COMPRESSED("default 'except' must be last", "\377\366'except'\210\224last")
+MP_MATCH_COMPRESSED("dict update sequence has wrong length", "\377\271update\307\272\344\222")
+MP_MATCH_COMPRESSED("div/mod not implemented for uint", "\377div/mod\211\243\221uint")
+MP_MATCH_COMPRESSED("divide by zero", "\377\377by\322")
+MP_MATCH_COMPRESSED("don't know how to pass object to native function", "\377don't know how\215pass\202\215native\203")
+MP_MATCH_COMPRESSED("empty", "\377\242")
+MP_MATCH_COMPRESSED("empty heap", "\377\242\354")
+MP_MATCH_COMPRESSED("empty separator", "\377\242separator")
+MP_MATCH_COMPRESSED("end of format while looking for conversion specifier", "\377end\225\204while looking\221\263\217")
+MP_MATCH_COMPRESSED("error in ffi_prep_cif", "\377\246\232ffi_prep_cif")
+MP_MATCH_COMPRESSED("error in regex", "\377\246\232regex")
+MP_MATCH_COMPRESSED("exceptions must derive from BaseException", "\377exceptions\210derive\247BaseException")
+MP_MATCH_COMPRESSED("expected ':' after format specifier", "\377\251':'\276\204\217")
+MP_MATCH_COMPRESSED("expecting a dict", "\377\236\231\271")
+MP_MATCH_COMPRESSED("expecting a dict for keyword args", "\377\236\231\271\221\212\351")
+MP_MATCH_COMPRESSED("expecting a float array", "\377\236\231\335array")
+MP_MATCH_COMPRESSED("expecting just a value for set", "\377\236just\231\343\221\340")
+MP_MATCH_COMPRESSED("expecting key:value for dict", "\377\236key:value\221\271")
+MP_MATCH_COMPRESSED("extra keyword arguments given", "\377extra\212\206\303")
+MP_MATCH_COMPRESSED("extra positional arguments given", "\377extra\213\206\303")
+MP_MATCH_COMPRESSED("ffi_prep_closure_loc", "ffi_prep_closure_loc")
+MP_MATCH_COMPRESSED("finished", "finished")
+MP_MATCH_COMPRESSED("format needs a dict", "\377\204\305\231\271")
+MP_MATCH_COMPRESSED("format string didn't convert all arguments", "\377\204\223didn't\220all\206")
+MP_MATCH_COMPRESSED("format string needs more arguments", "\377\204\223\305more\206")
+MP_MATCH_COMPRESSED("full", "full")
+MP_MATCH_COMPRESSED("function doesn't take keyword arguments", "\377\203\257take\212\206")
+MP_MATCH_COMPRESSED("function expected at most %d arguments, got %d", "\377\203\251at most\241arguments,\370\241")
+MP_MATCH_COMPRESSED("function got multiple values for argument '%q'", "\377\203\370\252\327\221\205\201")
+MP_MATCH_COMPRESSED("function missing %d required positional arguments", "\377\203\260\241\227\213\206")
+MP_MATCH_COMPRESSED("function missing keyword-only argument", "\377\203\260keyword-only\205")
+MP_MATCH_COMPRESSED("function missing required keyword argument '%q'", "\377\203\260\227\212\205\201")
+MP_MATCH_COMPRESSED("function missing required positional argument #%d", "\377\203\260\227\213\205#%d")
+MP_MATCH_COMPRESSED("function takes %d positional arguments but %d were given", "\377\203\342\241\213\206\270\241were\303")
+MP_MATCH_COMPRESSED("generator already executing", "\377\250already executing")
+MP_MATCH_COMPRESSED("generator ignored GeneratorExit", "\377\250ignored GeneratorExit")
+MP_MATCH_COMPRESSED("generator raised StopIteration", "\377\250raised StopIteration")
+MP_MATCH_COMPRESSED("heap must be a list", "\377\354\210\224\231\274")
+MP_MATCH_COMPRESSED("identifier redefined as global", "\377\264\361as global")
+MP_MATCH_COMPRESSED("identifier redefined as nonlocal", "\377\264\361as\306")
+MP_MATCH_COMPRESSED("import * not at module level", "\377\323*\211at module\336")
+MP_MATCH_COMPRESSED("incompatible .mpy arch", "\377\330.mpy arch")
+MP_MATCH_COMPRESSED("incompatible .mpy file", "\377\330.mpy\353")
+MP_MATCH_COMPRESSED("incomplete format", "\377\350\204")
+MP_MATCH_COMPRESSED("incomplete format key", "\377\350\204key")
+MP_MATCH_COMPRESSED("incorrect padding", "incorrect padding")
+MP_MATCH_COMPRESSED("int() arg 2 must be >= 2 and <= 36", "\377int()\2342\210\224>= 2\333<= 36")
+MP_MATCH_COMPRESSED("integer needed", "\377\371needed")
+MP_MATCH_COMPRESSED("intermediate overflow in fsum", "\377intermediate\254\232fsum")
+MP_MATCH_COMPRESSED("invalid cachesize", "\377\207cachesize")
+MP_MATCH_COMPRESSED("invalid count", "\377\207count")
+MP_MATCH_COMPRESSED("invalid format", "\377\207\204")
+MP_MATCH_COMPRESSED("invalid format specifier", "\377\207\204\217")
+MP_MATCH_COMPRESSED("invalid micropython decorator", "\377\207micropython decorator")
+MP_MATCH_COMPRESSED("invalid mktime usage", "\377\207mktime usage")
+MP_MATCH_COMPRESSED("invalid priority", "\377\207priority")
+MP_MATCH_COMPRESSED("invalid rotation", "\377\207rotation")
+MP_MATCH_COMPRESSED("invalid scale", "\377\207scale")
+MP_MATCH_COMPRESSED("invalid size", "\377\207\321")
+MP_MATCH_COMPRESSED("invalid syntax", "\377\207\267")
+MP_MATCH_COMPRESSED("invalid syntax for number", "\377\207\267\221\324")
+MP_MATCH_COMPRESSED("issubclass() arg 1 must be a class", "\377\331\2341\210\224\231\300")
+MP_MATCH_COMPRESSED("issubclass() arg 2 must be a class or a tuple of classes", "\377\331\2342\210\224\231\300\320\231\310\225classes")
+MP_MATCH_COMPRESSED("join expects a list of str/bytes objects consistent with self object", "\377join expects\231\274\225str/bytes objects consistent\230\362\202")
+MP_MATCH_COMPRESSED("keyword argument(s) not yet implemented - use normal args instead", "\377\212argument(s)\211yet\243- use normal\351instead")
+MP_MATCH_COMPRESSED("layout type mismatch", "\377layout\214\304")
+MP_MATCH_COMPRESSED("length mismatch", "\377\222\304")
+MP_MATCH_COMPRESSED("length must be a power of 2", "\377\222\210\224\231power\2252")
+MP_MATCH_COMPRESSED("level", "\377\336")
+MP_MATCH_COMPRESSED("lhs and rhs should be compatible", "\377lhs\333rhs\325\224compatible")
+MP_MATCH_COMPRESSED("list modified during sort", "\377\274modified during sort")
+MP_MATCH_COMPRESSED("local '%q' has type '%q' but source is '%q'", "\377\337\201\272\214\201\270source\317\201")
+MP_MATCH_COMPRESSED("local '%q' used before type known", "\377\337\201used\375\214known")
+MP_MATCH_COMPRESSED("local variable referenced before assignment", "\377\337\365referenced\375\245")
+MP_MATCH_COMPRESSED("malformed f-string", "malformed f-string")
+MP_MATCH_COMPRESSED("math domain error", "\377math domain\246")
+MP_MATCH_COMPRESSED("memory allocation failed, allocating %u bytes", "\377memory\345\367allocating %u\334")
+MP_MATCH_COMPRESSED("memory allocation failed, heap is locked", "\377memory\345\367\354\317locked")
+MP_MATCH_COMPRESSED("mktime needs a tuple of length 8 or 9", "\377mktime\305\231\310\225\2228\3209")
+MP_MATCH_COMPRESSED("mmap outside file", "\377mmap\237\353")
+MP_MATCH_COMPRESSED("multiple *x in assignment", "\377\252*x\232\245")
+MP_MATCH_COMPRESSED("multiple bases have instance lay-out conflict", "\377\252bases have instance lay-out conflict")
+MP_MATCH_COMPRESSED("must raise an object", "\377\210raise\277\202")
+MP_MATCH_COMPRESSED("must use keyword argument for key function", "\377\210use\212\205\221key\203")
+MP_MATCH_COMPRESSED("name '%q' isn't defined", "\377\275\201\244defined")
+MP_MATCH_COMPRESSED("name too long", "\377\275\315long")
+MP_MATCH_COMPRESSED("native yield", "native yield")
+MP_MATCH_COMPRESSED("need a float Pool", "\377need\231\335Pool")
+MP_MATCH_COMPRESSED("need more than %d values to unpack", "\377need more than\241\327\215unpack")
+MP_MATCH_COMPRESSED("negative factorial", "\377\364factorial")
+MP_MATCH_COMPRESSED("negative shift count", "\377\364shift count")
+MP_MATCH_COMPRESSED("no SD card", "\377\253\363\255")
+MP_MATCH_COMPRESSED("no active exception to reraise", "\377\253active exception\215reraise")
+MP_MATCH_COMPRESSED("no binding for nonlocal found", "\377\253binding\221\306\302")
+MP_MATCH_COMPRESSED("no module named '%q'", "\377\253module named\201")
+MP_MATCH_COMPRESSED("no response from SD card", "\377\253response\247\363\255")
+MP_MATCH_COMPRESSED("no such attribute", "\377\253such\235")
+MP_MATCH_COMPRESSED("non-default argument follows default argument", "\377non-default\205follows\366\205")
+MP_MATCH_COMPRESSED("non-hex digit found", "\377non-hex digit\302")
+MP_MATCH_COMPRESSED("not a constant", "\377\211\231constant")
+MP_MATCH_COMPRESSED("object '%s' isn't a tuple or list", "\377\202\216\244\231\310\320\274")
+MP_MATCH_COMPRESSED("object not in sequence", "\377\202\211\232\307")
+MP_MATCH_COMPRESSED("object of type '%s' has no len()", "\377\202\225\214\216\272\253len()")
+MP_MATCH_COMPRESSED("object with buffer protocol required", "\377\202\230\266protocol\227")
+MP_MATCH_COMPRESSED("odd-length string", "\377odd-length\223")
+MP_MATCH_COMPRESSED("only slices with step=1 (aka None) are supported", "\377only slices\230step=1 (aka None) are\240")
+MP_MATCH_COMPRESSED("opcode", "opcode")
+MP_MATCH_COMPRESSED("ord() expected a character, but string of length %d found", "\377ord()\251\231character,\270\223\225\222\241\302")
+MP_MATCH_COMPRESSED("overflow converting long int to machine word", "\377\254converting long\273\215machine word")
+MP_MATCH_COMPRESSED("pop from an empty set", "\377pop\247\277\242\340")
+MP_MATCH_COMPRESSED("pop from empty list", "\377pop\247\242\274")
+MP_MATCH_COMPRESSED("popitem(): dictionary is empty", "\377popitem(): dictionary\317\242")
+MP_MATCH_COMPRESSED("positional arg after **", "\377\213\234\276**")
+MP_MATCH_COMPRESSED("positional arg after keyword arg", "\377\213\234\276\212\234")
+MP_MATCH_COMPRESSED("pow() with 3 arguments requires integers", "\377pow()\2303\206requires integers")
+MP_MATCH_COMPRESSED("queue overflow", "\377queue\254")
+MP_MATCH_COMPRESSED("raw f-strings are not supported", "\377raw f-strings are\211\240")
+MP_MATCH_COMPRESSED("requested length %d but object has length %d", "\377requested\222\241\270\202\272\222\241")
+MP_MATCH_COMPRESSED("return expected '%q' but got '%q'", "\377return\251\201\270\370\201")
+MP_MATCH_COMPRESSED("rsplit(None,n)", "rsplit(None,n)")
+MP_MATCH_COMPRESSED("schedule queue full", "schedule queue full")
+MP_MATCH_COMPRESSED("sign not allowed in string format specifier", "\377sign\211\311\232\223\204\217")
+MP_MATCH_COMPRESSED("sign not allowed with integer format specifier 'c'", "\377sign\211\311\230\371\204\217'c'")
+MP_MATCH_COMPRESSED("single '}' encountered in format string", "\377single '}' encountered\232\204\223")
+MP_MATCH_COMPRESSED("slice step can't be zero", "\377slice step\200\224\322")
+MP_MATCH_COMPRESSED("splitting with sub-captures", "\377splitting\230sub-captures")
+MP_MATCH_COMPRESSED("start/end indices", "\377start/end\312")
+MP_MATCH_COMPRESSED("stream operation not supported", "\377stream\360\211\240")
+MP_MATCH_COMPRESSED("string index out of range", "\377\223\233\313\225\261")
+MP_MATCH_COMPRESSED("string indices must be integers, not %s", "\377\223\312\210\224\355\211\332")
+MP_MATCH_COMPRESSED("struct: can't index", "\377\314\200\233")
+MP_MATCH_COMPRESSED("struct: index out of range", "\377\314\233\313\225\261")
+MP_MATCH_COMPRESSED("struct: no fields", "\377\314\253fields")
+MP_MATCH_COMPRESSED("substring not found", "\377substring\211\302")
+MP_MATCH_COMPRESSED("super() can't find self", "\377super()\200find\362")
+MP_MATCH_COMPRESSED("syntax error in JSON", "\377\267\246\232JSON")
+MP_MATCH_COMPRESSED("syntax error in uctypes descriptor", "\377\267\246\232uctypes descriptor")
+MP_MATCH_COMPRESSED("timeout waiting for v1 card", "\377\373\374\221v1\255")
+MP_MATCH_COMPRESSED("timeout waiting for v2 card", "\377\373\374\221v2\255")
+MP_MATCH_COMPRESSED("too many args", "\377\315\356\351")
+MP_MATCH_COMPRESSED("too many slots", "\377\315\356slots")
+MP_MATCH_COMPRESSED("too many values to unpack (expected %d)", "\377\315\356\327\215unpack (expected %d)")
+MP_MATCH_COMPRESSED("tuple index out of range", "\377\310\233\313\225\261")
+MP_MATCH_COMPRESSED("type '%q' isn't an acceptable base type", "\377\214\201\244\277acceptable base\214")
+MP_MATCH_COMPRESSED("type object '%q' has no attribute '%q'", "\377\214\202\201\272\253\235\201")
+MP_MATCH_COMPRESSED("type takes 1 or 3 arguments", "\377\214\3421\3203\206")
+MP_MATCH_COMPRESSED("unary op %q not implemented", "\377unary op\316\211\243")
+MP_MATCH_COMPRESSED("unexpected indent", "\377\265indent")
+MP_MATCH_COMPRESSED("unexpected keyword argument", "\377\265\212\205")
+MP_MATCH_COMPRESSED("unexpected keyword argument '%q'", "\377\265\212\205\201")
+MP_MATCH_COMPRESSED("unicode name escapes", "\377unicode\275escapes")
+MP_MATCH_COMPRESSED("unindent doesn't match any outer indent level", "\377unindent\257match any outer indent\336")
+MP_MATCH_COMPRESSED("unknown conversion specifier %c", "\377\262\263\217%c")
+MP_MATCH_COMPRESSED("unknown format code '%c' for object of type '%s'", "\377\262\204code '%c'\221\202\225\214\216")
+MP_MATCH_COMPRESSED("unknown type", "\377\262\214")
+MP_MATCH_COMPRESSED("unknown type '%q'", "\377\262\214\201")
+MP_MATCH_COMPRESSED("unmatched '{' in format", "\377unmatched '{'\232\204")
+MP_MATCH_COMPRESSED("unreadable attribute", "\377unreadable\235")
+MP_MATCH_COMPRESSED("unsupported format character '%c' (0x%x) at index %d", "\377\226\204character '%c' (0x%x) at\233\241")
+MP_MATCH_COMPRESSED("unsupported hash type", "\377\226hash\214")
+MP_MATCH_COMPRESSED("unsupported type", "\377\226\214")
+MP_MATCH_COMPRESSED("unsupported type for %q: '%s'", "\377\226\214\221%q:\216")
+MP_MATCH_COMPRESSED("unsupported types for %q: '%s', '%s'", "\377\226types\221%q: '%s',\216")
+MP_MATCH_COMPRESSED("wbits", "wbits")
+MP_MATCH_COMPRESSED("wrong number of arguments", "\377\344\324\225\206")
+MP_MATCH_COMPRESSED("wrong object for pool", "\377\344\202\221pool")
+MP_MATCH_COMPRESSED("zero step", "\377\322step")
+// Total input length:      7327
+// Total compressed length: 3533
+// Total data length:       1149
+// Predicted saving:        2645
+
+// gzip length:             4124
+// Percentage of gzip:      113.5%
+// zlib length:             4112
+// Percentage of zlib:      113.9%
@@ -0,0 +1,1972 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTRnull, 0, 0, "")
+QDEF(MP_QSTR_, 5381, 0, "")
+QDEF(MP_QSTR___dir__, 36730, 7, "__dir__")
+QDEF(MP_QSTR__0x0a_, 46511, 1, "\x0a")
+QDEF(MP_QSTR__space_, 46469, 1, " ")
+QDEF(MP_QSTR__star_, 46479, 1, "*")
+QDEF(MP_QSTR__slash_, 46474, 1, "/")
+QDEF(MP_QSTR__lt_module_gt_, 38077, 8, "<module>")
+QDEF(MP_QSTR__, 46586, 1, "_")
+QDEF(MP_QSTR___call__, 63911, 8, "__call__")
+QDEF(MP_QSTR___class__, 50475, 9, "__class__")
+QDEF(MP_QSTR___delitem__, 13821, 11, "__delitem__")
+QDEF(MP_QSTR___enter__, 47725, 9, "__enter__")
+QDEF(MP_QSTR___exit__, 63557, 8, "__exit__")
+QDEF(MP_QSTR___getattr__, 63552, 11, "__getattr__")
+QDEF(MP_QSTR___getitem__, 14630, 11, "__getitem__")
+QDEF(MP_QSTR___hash__, 51447, 8, "__hash__")
+QDEF(MP_QSTR___init__, 42335, 8, "__init__")
+QDEF(MP_QSTR___int__, 6934, 7, "__int__")
+QDEF(MP_QSTR___iter__, 13007, 8, "__iter__")
+QDEF(MP_QSTR___len__, 45282, 7, "__len__")
+QDEF(MP_QSTR___main__, 5006, 8, "__main__")
+QDEF(MP_QSTR___module__, 12543, 10, "__module__")
+QDEF(MP_QSTR___name__, 14562, 8, "__name__")
+QDEF(MP_QSTR___new__, 5497, 7, "__new__")
+QDEF(MP_QSTR___next__, 29442, 8, "__next__")
+QDEF(MP_QSTR___qualname__, 107, 12, "__qualname__")
+QDEF(MP_QSTR___repr__, 2832, 8, "__repr__")
+QDEF(MP_QSTR___setitem__, 15922, 11, "__setitem__")
+QDEF(MP_QSTR___str__, 52688, 7, "__str__")
+QDEF(MP_QSTR_ArithmeticError, 35885, 15, "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, 23191, 14, "AssertionError")
+QDEF(MP_QSTR_AttributeError, 56865, 14, "AttributeError")
+QDEF(MP_QSTR_BaseException, 37383, 13, "BaseException")
+QDEF(MP_QSTR_EOFError, 49041, 8, "EOFError")
+QDEF(MP_QSTR_Ellipsis, 57584, 8, "Ellipsis")
+QDEF(MP_QSTR_Exception, 10738, 9, "Exception")
+QDEF(MP_QSTR_GeneratorExit, 25110, 13, "GeneratorExit")
+QDEF(MP_QSTR_ImportError, 39968, 11, "ImportError")
+QDEF(MP_QSTR_IndentationError, 8284, 16, "IndentationError")
+QDEF(MP_QSTR_IndexError, 44419, 10, "IndexError")
+QDEF(MP_QSTR_KeyError, 234, 8, "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, 58031, 17, "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, 27135, 11, "LookupError")
+QDEF(MP_QSTR_MemoryError, 33756, 11, "MemoryError")
+QDEF(MP_QSTR_NameError, 11706, 9, "NameError")
+QDEF(MP_QSTR_NoneType, 26647, 8, "NoneType")
+QDEF(MP_QSTR_NotImplementedError, 39110, 19, "NotImplementedError")
+QDEF(MP_QSTR_OSError, 26017, 7, "OSError")
+QDEF(MP_QSTR_OverflowError, 57729, 13, "OverflowError")
+QDEF(MP_QSTR_RuntimeError, 61793, 12, "RuntimeError")
+QDEF(MP_QSTR_StopIteration, 7402, 13, "StopIteration")
+QDEF(MP_QSTR_SyntaxError, 36756, 11, "SyntaxError")
+QDEF(MP_QSTR_SystemExit, 65312, 10, "SystemExit")
+QDEF(MP_QSTR_TypeError, 38437, 9, "TypeError")
+QDEF(MP_QSTR_ValueError, 34710, 10, "ValueError")
+QDEF(MP_QSTR_ZeroDivisionError, 10166, 17, "ZeroDivisionError")
+QDEF(MP_QSTR_abs, 12949, 3, "abs")
+QDEF(MP_QSTR_all, 13124, 3, "all")
+QDEF(MP_QSTR_any, 13075, 3, "any")
+QDEF(MP_QSTR_append, 38763, 6, "append")
+QDEF(MP_QSTR_args, 50882, 4, "args")
+QDEF(MP_QSTR_bool, 15595, 4, "bool")
+QDEF(MP_QSTR_builtins, 12791, 8, "builtins")
+QDEF(MP_QSTR_bytearray, 41846, 9, "bytearray")
+QDEF(MP_QSTR_bytecode, 32034, 8, "bytecode")
+QDEF(MP_QSTR_bytes, 45660, 5, "bytes")
+QDEF(MP_QSTR_callable, 28685, 8, "callable")
+QDEF(MP_QSTR_chr, 19676, 3, "chr")
+QDEF(MP_QSTR_classmethod, 36020, 11, "classmethod")
+QDEF(MP_QSTR_clear, 41084, 5, "clear")
+QDEF(MP_QSTR_close, 26419, 5, "close")
+QDEF(MP_QSTR_const, 65472, 5, "const")
+QDEF(MP_QSTR_copy, 56288, 4, "copy")
+QDEF(MP_QSTR_count, 19878, 5, "count")
+QDEF(MP_QSTR_dict, 64575, 4, "dict")
+QDEF(MP_QSTR_dir, 7930, 3, "dir")
+QDEF(MP_QSTR_divmod, 1208, 6, "divmod")
+QDEF(MP_QSTR_end, 8970, 3, "end")
+QDEF(MP_QSTR_endswith, 41755, 8, "endswith")
+QDEF(MP_QSTR_eval, 42651, 4, "eval")
+QDEF(MP_QSTR_exec, 49182, 4, "exec")
+QDEF(MP_QSTR_extend, 59491, 6, "extend")
+QDEF(MP_QSTR_find, 13312, 4, "find")
+QDEF(MP_QSTR_format, 13094, 6, "format")
+QDEF(MP_QSTR_from_bytes, 29749, 10, "from_bytes")
+QDEF(MP_QSTR_get, 15155, 3, "get")
+QDEF(MP_QSTR_getattr, 6080, 7, "getattr")
+QDEF(MP_QSTR_globals, 18845, 7, "globals")
+QDEF(MP_QSTR_hasattr, 45196, 7, "hasattr")
+QDEF(MP_QSTR_hash, 28855, 4, "hash")
+QDEF(MP_QSTR_id, 28456, 2, "id")
+QDEF(MP_QSTR_index, 10363, 5, "index")
+QDEF(MP_QSTR_insert, 21522, 6, "insert")
+QDEF(MP_QSTR_int, 21270, 3, "int")
+QDEF(MP_QSTR_isalpha, 14315, 7, "isalpha")
+QDEF(MP_QSTR_isdigit, 39592, 7, "isdigit")
+QDEF(MP_QSTR_isinstance, 48822, 10, "isinstance")
+QDEF(MP_QSTR_islower, 33020, 7, "islower")
+QDEF(MP_QSTR_isspace, 63579, 7, "isspace")
+QDEF(MP_QSTR_issubclass, 32693, 10, "issubclass")
+QDEF(MP_QSTR_isupper, 42973, 7, "isupper")
+QDEF(MP_QSTR_items, 21475, 5, "items")
+QDEF(MP_QSTR_iter, 8591, 4, "iter")
+QDEF(MP_QSTR_join, 23719, 4, "join")
+QDEF(MP_QSTR_key, 27954, 3, "key")
+QDEF(MP_QSTR_keys, 4865, 4, "keys")
+QDEF(MP_QSTR_len, 16482, 3, "len")
+QDEF(MP_QSTR_list, 7463, 4, "list")
+QDEF(MP_QSTR_little, 27273, 6, "little")
+QDEF(MP_QSTR_locals, 41275, 6, "locals")
+QDEF(MP_QSTR_lower, 52166, 5, "lower")
+QDEF(MP_QSTR_lstrip, 47589, 6, "lstrip")
+QDEF(MP_QSTR_main, 47054, 4, "main")
+QDEF(MP_QSTR_map, 17337, 3, "map")
+QDEF(MP_QSTR_micropython, 31755, 11, "micropython")
+QDEF(MP_QSTR_next, 34882, 4, "next")
+QDEF(MP_QSTR_object, 36240, 6, "object")
+QDEF(MP_QSTR_open, 15057, 4, "open")
+QDEF(MP_QSTR_ord, 24092, 3, "ord")
+QDEF(MP_QSTR_pop, 29482, 3, "pop")
+QDEF(MP_QSTR_popitem, 11455, 7, "popitem")
+QDEF(MP_QSTR_pow, 29485, 3, "pow")
+QDEF(MP_QSTR_print, 50772, 5, "print")
+QDEF(MP_QSTR_range, 24090, 5, "range")
+QDEF(MP_QSTR_read, 63927, 4, "read")
+QDEF(MP_QSTR_readinto, 48971, 8, "readinto")
+QDEF(MP_QSTR_readline, 6649, 8, "readline")
+QDEF(MP_QSTR_remove, 35427, 6, "remove")
+QDEF(MP_QSTR_replace, 9545, 7, "replace")
+QDEF(MP_QSTR_repr, 63440, 4, "repr")
+QDEF(MP_QSTR_reverse, 10789, 7, "reverse")
+QDEF(MP_QSTR_rfind, 40146, 5, "rfind")
+QDEF(MP_QSTR_rindex, 11241, 6, "rindex")
+QDEF(MP_QSTR_round, 9703, 5, "round")
+QDEF(MP_QSTR_rsplit, 165, 6, "rsplit")
+QDEF(MP_QSTR_rstrip, 38203, 6, "rstrip")
+QDEF(MP_QSTR_self, 30585, 4, "self")
+QDEF(MP_QSTR_send, 30393, 4, "send")
+QDEF(MP_QSTR_sep, 36643, 3, "sep")
+QDEF(MP_QSTR_set, 36647, 3, "set")
+QDEF(MP_QSTR_setattr, 43220, 7, "setattr")
+QDEF(MP_QSTR_setdefault, 41836, 10, "setdefault")
+QDEF(MP_QSTR_sort, 40383, 4, "sort")
+QDEF(MP_QSTR_sorted, 5470, 6, "sorted")
+QDEF(MP_QSTR_split, 13239, 5, "split")
+QDEF(MP_QSTR_start, 61317, 5, "start")
+QDEF(MP_QSTR_startswith, 59508, 10, "startswith")
+QDEF(MP_QSTR_staticmethod, 44898, 12, "staticmethod")
+QDEF(MP_QSTR_step, 13911, 4, "step")
+QDEF(MP_QSTR_stop, 13981, 4, "stop")
+QDEF(MP_QSTR_str, 36176, 3, "str")
+QDEF(MP_QSTR_strip, 7721, 5, "strip")
+QDEF(MP_QSTR_sum, 36142, 3, "sum")
+QDEF(MP_QSTR_super, 45764, 5, "super")
+QDEF(MP_QSTR_throw, 17587, 5, "throw")
+QDEF(MP_QSTR_to_bytes, 16088, 8, "to_bytes")
+QDEF(MP_QSTR_tuple, 16893, 5, "tuple")
+QDEF(MP_QSTR_type, 32669, 4, "type")
+QDEF(MP_QSTR_update, 30388, 6, "update")
+QDEF(MP_QSTR_upper, 37927, 5, "upper")
+QDEF(MP_QSTR_utf_hyphen_8, 33463, 5, "utf-8")
+QDEF(MP_QSTR_value, 13390, 5, "value")
+QDEF(MP_QSTR_values, 48765, 6, "values")
+QDEF(MP_QSTR_write, 43160, 5, "write")
+QDEF(MP_QSTR_zip, 44262, 3, "zip")
+QDEF(MP_QSTR___abs__, 54933, 7, "__abs__")
+QDEF(MP_QSTR___add__, 33476, 7, "__add__")
+QDEF(MP_QSTR___aenter__, 33868, 10, "__aenter__")
+QDEF(MP_QSTR___aexit__, 53188, 9, "__aexit__")
+QDEF(MP_QSTR___aiter__, 11086, 9, "__aiter__")
+QDEF(MP_QSTR___and__, 56078, 7, "__and__")
+QDEF(MP_QSTR___anext__, 46211, 9, "__anext__")
+QDEF(MP_QSTR___bases__, 12291, 9, "__bases__")
+QDEF(MP_QSTR___bool__, 25899, 8, "__bool__")
+QDEF(MP_QSTR___build_class__, 34882, 15, "__build_class__")
+QDEF(MP_QSTR___contains__, 24518, 12, "__contains__")
+QDEF(MP_QSTR___del__, 14184, 7, "__del__")
+QDEF(MP_QSTR___delattr__, 30555, 11, "__delattr__")
+QDEF(MP_QSTR___delete__, 60892, 10, "__delete__")
+QDEF(MP_QSTR___dict__, 21631, 8, "__dict__")
+QDEF(MP_QSTR___divmod__, 4472, 10, "__divmod__")
+QDEF(MP_QSTR___eq__, 15985, 6, "__eq__")
+QDEF(MP_QSTR___file__, 21507, 8, "__file__")
+QDEF(MP_QSTR___floordiv__, 24390, 12, "__floordiv__")
+QDEF(MP_QSTR___ge__, 18087, 6, "__ge__")
+QDEF(MP_QSTR___get__, 36787, 7, "__get__")
+QDEF(MP_QSTR___globals__, 44701, 11, "__globals__")
+QDEF(MP_QSTR___gt__, 33462, 6, "__gt__")
+QDEF(MP_QSTR___iadd__, 19053, 8, "__iadd__")
+QDEF(MP_QSTR___iand__, 8615, 8, "__iand__")
+QDEF(MP_QSTR___ifloordiv__, 3919, 13, "__ifloordiv__")
+QDEF(MP_QSTR___ilshift__, 41600, 11, "__ilshift__")
+QDEF(MP_QSTR___imatmul__, 28352, 11, "__imatmul__")
+QDEF(MP_QSTR___imod__, 34378, 8, "__imod__")
+QDEF(MP_QSTR___import__, 15928, 10, "__import__")
+QDEF(MP_QSTR___imul__, 52760, 8, "__imul__")
+QDEF(MP_QSTR___invert__, 30711, 10, "__invert__")
+QDEF(MP_QSTR___ior__, 36849, 7, "__ior__")
+QDEF(MP_QSTR___ipow__, 54660, 8, "__ipow__")
+QDEF(MP_QSTR___irshift__, 63710, 11, "__irshift__")
+QDEF(MP_QSTR___isub__, 30728, 8, "__isub__")
+QDEF(MP_QSTR___itruediv__, 545, 12, "__itruediv__")
+QDEF(MP_QSTR___ixor__, 47369, 8, "__ixor__")
+QDEF(MP_QSTR___le__, 5068, 6, "__le__")
+QDEF(MP_QSTR___lshift__, 34825, 10, "__lshift__")
+QDEF(MP_QSTR___lt__, 26717, 6, "__lt__")
+QDEF(MP_QSTR___matmul__, 62281, 10, "__matmul__")
+QDEF(MP_QSTR___mod__, 14179, 7, "__mod__")
+QDEF(MP_QSTR___mul__, 16945, 7, "__mul__")
+QDEF(MP_QSTR___ne__, 2830, 6, "__ne__")
+QDEF(MP_QSTR___neg__, 54633, 7, "__neg__")
+QDEF(MP_QSTR___or__, 47928, 6, "__or__")
+QDEF(MP_QSTR___path__, 9160, 8, "__path__")
+QDEF(MP_QSTR___pos__, 61481, 7, "__pos__")
+QDEF(MP_QSTR___pow__, 45, 7, "__pow__")
+QDEF(MP_QSTR___radd__, 50454, 8, "__radd__")
+QDEF(MP_QSTR___rand__, 11996, 8, "__rand__")
+QDEF(MP_QSTR___repl_print__, 47872, 14, "__repl_print__")
+QDEF(MP_QSTR___reversed__, 65377, 12, "__reversed__")
+QDEF(MP_QSTR___rfloordiv__, 38996, 13, "__rfloordiv__")
+QDEF(MP_QSTR___rlshift__, 53531, 11, "__rlshift__")
+QDEF(MP_QSTR___rmatmul__, 987, 11, "__rmatmul__")
+QDEF(MP_QSTR___rmod__, 35377, 8, "__rmod__")
+QDEF(MP_QSTR___rmul__, 355, 8, "__rmul__")
+QDEF(MP_QSTR___ror__, 56362, 7, "__ror__")
+QDEF(MP_QSTR___rpow__, 39679, 8, "__rpow__")
+QDEF(MP_QSTR___rrshift__, 40389, 11, "__rrshift__")
+QDEF(MP_QSTR___rshift__, 38999, 10, "__rshift__")
+QDEF(MP_QSTR___rsub__, 30579, 8, "__rsub__")
+QDEF(MP_QSTR___rtruediv__, 55130, 12, "__rtruediv__")
+QDEF(MP_QSTR___rxor__, 34546, 8, "__rxor__")
+QDEF(MP_QSTR___set__, 45991, 7, "__set__")
+QDEF(MP_QSTR___setattr__, 6484, 11, "__setattr__")
+QDEF(MP_QSTR___sizeof__, 15113, 10, "__sizeof__")
+QDEF(MP_QSTR___slots__, 42194, 9, "__slots__")
+QDEF(MP_QSTR___sub__, 2337, 7, "__sub__")
+QDEF(MP_QSTR___traceback__, 53071, 13, "__traceback__")
+QDEF(MP_QSTR___truediv__, 61320, 11, "__truediv__")
+QDEF(MP_QSTR___xor__, 60448, 7, "__xor__")
+QDEF(MP_QSTR__gt__gt__gt__space_, 44187, 4, ">>> ")
+QDEF(MP_QSTR__dot__dot__dot__space_, 10379, 4, "... ")
+QDEF(MP_QSTR__percent__hash_o, 6764, 3, "%#o")
+QDEF(MP_QSTR__percent__hash_x, 6779, 3, "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, 14168, 5, "{:#b}")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, 7795, 32, "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_lambda_gt_, 35968, 8, "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, 5588, 10, "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, 36300, 10, "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, 20820, 9, "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, 27188, 9, "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, 21330, 8, "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, 25571, 7, "<stdin>")
+QDEF(MP_QSTR__dot_frozen, 62593, 7, ".frozen")
+QDEF(MP_QSTR__lt_interpreter_gt_, 7335, 13, "<interpreter>")
+QDEF(MP_QSTR_AF_INET, 47083, 7, "AF_INET")
+QDEF(MP_QSTR_AF_INET6, 46461, 8, "AF_INET6")
+QDEF(MP_QSTR_AF_UNIX, 503, 7, "AF_UNIX")
+QDEF(MP_QSTR_ARRAY, 31324, 5, "ARRAY")
+QDEF(MP_QSTR_B115200, 62112, 7, "B115200")
+QDEF(MP_QSTR_B57600, 39955, 6, "B57600")
+QDEF(MP_QSTR_B9600, 39560, 5, "B9600")
+QDEF(MP_QSTR_BFINT16, 58005, 7, "BFINT16")
+QDEF(MP_QSTR_BFINT32, 57939, 7, "BFINT32")
+QDEF(MP_QSTR_BFINT8, 39498, 6, "BFINT8")
+QDEF(MP_QSTR_BFUINT16, 42560, 8, "BFUINT16")
+QDEF(MP_QSTR_BFUINT32, 42502, 8, "BFUINT32")
+QDEF(MP_QSTR_BFUINT8, 44991, 7, "BFUINT8")
+QDEF(MP_QSTR_BF_LEN, 45081, 6, "BF_LEN")
+QDEF(MP_QSTR_BF_POS, 40274, 6, "BF_POS")
+QDEF(MP_QSTR_BIG_ENDIAN, 20991, 10, "BIG_ENDIAN")
+QDEF(MP_QSTR_BufferedWriter, 11499, 14, "BufferedWriter")
+QDEF(MP_QSTR_BytesIO, 46874, 7, "BytesIO")
+QDEF(MP_QSTR_CancelledError, 39926, 14, "CancelledError")
+QDEF(MP_QSTR_Channel, 12870, 7, "Channel")
+QDEF(MP_QSTR_CompIO, 8722, 6, "CompIO")
+QDEF(MP_QSTR_Compress, 32131, 8, "Compress")
+QDEF(MP_QSTR_DEBUG, 27956, 5, "DEBUG")
+QDEF(MP_QSTR_DecompIO, 46995, 8, "DecompIO")
+QDEF(MP_QSTR_EACCES, 49719, 6, "EACCES")
+QDEF(MP_QSTR_EADDRINUSE, 4375, 10, "EADDRINUSE")
+QDEF(MP_QSTR_EAGAIN, 60448, 6, "EAGAIN")
+QDEF(MP_QSTR_EALREADY, 5446, 8, "EALREADY")
+QDEF(MP_QSTR_EBADF, 41825, 5, "EBADF")
+QDEF(MP_QSTR_ECONNABORTED, 43815, 12, "ECONNABORTED")
+QDEF(MP_QSTR_ECONNREFUSED, 11322, 12, "ECONNREFUSED")
+QDEF(MP_QSTR_ECONNRESET, 64281, 10, "ECONNRESET")
+QDEF(MP_QSTR_EEXIST, 44371, 6, "EEXIST")
+QDEF(MP_QSTR_EHOSTUNREACH, 9606, 12, "EHOSTUNREACH")
+QDEF(MP_QSTR_EINPROGRESS, 41114, 11, "EINPROGRESS")
+QDEF(MP_QSTR_EINVAL, 65372, 6, "EINVAL")
+QDEF(MP_QSTR_EIO, 42630, 3, "EIO")
+QDEF(MP_QSTR_EISDIR, 20389, 6, "EISDIR")
+QDEF(MP_QSTR_ENOBUFS, 34787, 7, "ENOBUFS")
+QDEF(MP_QSTR_ENODEV, 26550, 6, "ENODEV")
+QDEF(MP_QSTR_ENOENT, 25950, 6, "ENOENT")
+QDEF(MP_QSTR_ENOMEM, 34212, 6, "ENOMEM")
+QDEF(MP_QSTR_ENOTCONN, 55161, 8, "ENOTCONN")
+QDEF(MP_QSTR_EOPNOTSUPP, 38828, 10, "EOPNOTSUPP")
+QDEF(MP_QSTR_EPERM, 32746, 5, "EPERM")
+QDEF(MP_QSTR_ETIMEDOUT, 63743, 9, "ETIMEDOUT")
+QDEF(MP_QSTR_Event, 35561, 5, "Event")
+QDEF(MP_QSTR_FLOAT32, 34740, 7, "FLOAT32")
+QDEF(MP_QSTR_FLOAT64, 34583, 7, "FLOAT64")
+QDEF(MP_QSTR_FileIO, 5573, 6, "FileIO")
+QDEF(MP_QSTR_FrameBuffer, 48856, 11, "FrameBuffer")
+QDEF(MP_QSTR_FrameBuffer1, 39401, 12, "FrameBuffer1")
+QDEF(MP_QSTR_GS2_HMSB, 49960, 8, "GS2_HMSB")
+QDEF(MP_QSTR_GS4_HMSB, 29550, 8, "GS4_HMSB")
+QDEF(MP_QSTR_GS8, 49321, 3, "GS8")
+QDEF(MP_QSTR_INT, 55094, 3, "INT")
+QDEF(MP_QSTR_INT16, 30353, 5, "INT16")
+QDEF(MP_QSTR_INT32, 30295, 5, "INT32")
+QDEF(MP_QSTR_INT64, 30196, 5, "INT64")
+QDEF(MP_QSTR_INT8, 48590, 4, "INT8")
+QDEF(MP_QSTR_IOBase, 48694, 6, "IOBase")
+QDEF(MP_QSTR_Interpreter, 65157, 11, "Interpreter")
+QDEF(MP_QSTR_LITTLE_ENDIAN, 23487, 13, "LITTLE_ENDIAN")
+QDEF(MP_QSTR_LONG, 25871, 4, "LONG")
+QDEF(MP_QSTR_LONGLONG, 54405, 8, "LONGLONG")
+QDEF(MP_QSTR_Lock, 59534, 4, "Lock")
+QDEF(MP_QSTR_LockType, 8246, 8, "LockType")
+QDEF(MP_QSTR_Loop, 59673, 4, "Loop")
+QDEF(MP_QSTR_MASTER, 36153, 6, "MASTER")
+QDEF(MP_QSTR_MONO_HLSB, 38988, 9, "MONO_HLSB")
+QDEF(MP_QSTR_MONO_HMSB, 33741, 9, "MONO_HMSB")
+QDEF(MP_QSTR_MONO_VLSB, 64530, 9, "MONO_VLSB")
+QDEF(MP_QSTR_MSG_DONTROUTE, 24043, 13, "MSG_DONTROUTE")
+QDEF(MP_QSTR_MSG_DONTWAIT, 51353, 12, "MSG_DONTWAIT")
+QDEF(MP_QSTR_MVLSB, 5123, 5, "MVLSB")
+QDEF(MP_QSTR_NATIVE, 36356, 6, "NATIVE")
+QDEF(MP_QSTR_None, 53615, 4, "None")
+QDEF(MP_QSTR_NotImplemented, 50750, 14, "NotImplemented")
+QDEF(MP_QSTR_OUT, 58123, 3, "OUT")
+QDEF(MP_QSTR_OrderedDict, 32496, 11, "OrderedDict")
+QDEF(MP_QSTR_POLLERR, 49375, 7, "POLLERR")
+QDEF(MP_QSTR_POLLHUP, 35447, 7, "POLLHUP")
+QDEF(MP_QSTR_POLLIN, 24957, 6, "POLLIN")
+QDEF(MP_QSTR_POLLOUT, 34164, 7, "POLLOUT")
+QDEF(MP_QSTR_PTR, 3251, 3, "PTR")
+QDEF(MP_QSTR_PinBase, 17223, 7, "PinBase")
+QDEF(MP_QSTR_Pool, 40601, 4, "Pool")
+QDEF(MP_QSTR_Queue, 4788, 5, "Queue")
+QDEF(MP_QSTR_QueueEmpty, 38785, 10, "QueueEmpty")
+QDEF(MP_QSTR_QueueFull, 43591, 9, "QueueFull")
+QDEF(MP_QSTR_RGB565, 52324, 6, "RGB565")
+QDEF(MP_QSTR_RingBuffer, 63863, 10, "RingBuffer")
+QDEF(MP_QSTR_SDCard, 44966, 6, "SDCard")
+QDEF(MP_QSTR_SHORT, 7159, 5, "SHORT")
+QDEF(MP_QSTR_SOCK_DGRAM, 5299, 10, "SOCK_DGRAM")
+QDEF(MP_QSTR_SOCK_RAW, 38602, 8, "SOCK_RAW")
+QDEF(MP_QSTR_SOCK_STREAM, 48690, 11, "SOCK_STREAM")
+QDEF(MP_QSTR_SOL_SOCKET, 57103, 10, "SOL_SOCKET")
+QDEF(MP_QSTR_SO_BROADCAST, 50937, 12, "SO_BROADCAST")
+QDEF(MP_QSTR_SO_ERROR, 10814, 8, "SO_ERROR")
+QDEF(MP_QSTR_SO_KEEPALIVE, 41770, 12, "SO_KEEPALIVE")
+QDEF(MP_QSTR_SO_LINGER, 37117, 9, "SO_LINGER")
+QDEF(MP_QSTR_SO_REUSEADDR, 21281, 12, "SO_REUSEADDR")
+QDEF(MP_QSTR_Signal, 58523, 6, "Signal")
+QDEF(MP_QSTR_SingletonGenerator, 12601, 18, "SingletonGenerator")
+QDEF(MP_QSTR_StopAsyncIteration, 61676, 18, "StopAsyncIteration")
+QDEF(MP_QSTR_StringIO, 30326, 8, "StringIO")
+QDEF(MP_QSTR_Struct, 38130, 6, "Struct")
+QDEF(MP_QSTR_TCSANOW, 9558, 7, "TCSANOW")
+QDEF(MP_QSTR_Task, 16904, 4, "Task")
+QDEF(MP_QSTR_TaskQueue, 23705, 9, "TaskQueue")
+QDEF(MP_QSTR_TextIOWrapper, 36269, 13, "TextIOWrapper")
+QDEF(MP_QSTR_ThreadSafeFlag, 9558, 14, "ThreadSafeFlag")
+QDEF(MP_QSTR_True, 5907, 4, "True")
+QDEF(MP_QSTR_UINT, 15651, 4, "UINT")
+QDEF(MP_QSTR_UINT16, 6084, 6, "UINT16")
+QDEF(MP_QSTR_UINT32, 6018, 6, "UINT32")
+QDEF(MP_QSTR_UINT64, 6241, 6, "UINT64")
+QDEF(MP_QSTR_UINT8, 57787, 5, "UINT8")
+QDEF(MP_QSTR_ULONG, 36218, 5, "ULONG")
+QDEF(MP_QSTR_ULONGLONG, 50800, 9, "ULONGLONG")
+QDEF(MP_QSTR_USHORT, 62626, 6, "USHORT")
+QDEF(MP_QSTR_UnicodeError, 53538, 12, "UnicodeError")
+QDEF(MP_QSTR_VOID, 62001, 4, "VOID")
+QDEF(MP_QSTR_VfsFat, 39701, 6, "VfsFat")
+QDEF(MP_QSTR_VfsLfs1, 30190, 7, "VfsLfs1")
+QDEF(MP_QSTR_VfsLfs2, 30189, 7, "VfsLfs2")
+QDEF(MP_QSTR_VfsPosix, 20155, 8, "VfsPosix")
+QDEF(MP_QSTR_ViperTypeError, 1501, 14, "ViperTypeError")
+QDEF(MP_QSTR_Waiter, 12761, 6, "Waiter")
+QDEF(MP_QSTR_Z_FINISH, 16691, 8, "Z_FINISH")
+QDEF(MP_QSTR_Z_SYNC_FLUSH, 50940, 12, "Z_SYNC_FLUSH")
+QDEF(MP_QSTR__asdict, 18482, 7, "_asdict")
+QDEF(MP_QSTR__dequeue, 49770, 8, "_dequeue")
+QDEF(MP_QSTR__exc_context, 13092, 12, "_exc_context")
+QDEF(MP_QSTR__interpreters, 62089, 13, "_interpreters")
+QDEF(MP_QSTR__io_queue, 43474, 9, "_io_queue")
+QDEF(MP_QSTR__machine, 19391, 8, "_machine")
+QDEF(MP_QSTR__mpy, 10590, 4, "_mpy")
+QDEF(MP_QSTR__sdcard, 3897, 7, "_sdcard")
+QDEF(MP_QSTR__task_queue, 50649, 11, "_task_queue")
+QDEF(MP_QSTR__thread, 724, 7, "_thread")
+QDEF(MP_QSTR__uasyncio, 24527, 9, "_uasyncio")
+QDEF(MP_QSTR_a2b_base64, 2876, 10, "a2b_base64")
+QDEF(MP_QSTR_a2b_base64_into, 53919, 15, "a2b_base64_into")
+QDEF(MP_QSTR_abs_tol, 28029, 7, "abs_tol")
+QDEF(MP_QSTR_accept, 35205, 6, "accept")
+QDEF(MP_QSTR_acos, 40987, 4, "acos")
+QDEF(MP_QSTR_acosh, 41747, 5, "acosh")
+QDEF(MP_QSTR_acquire, 54045, 7, "acquire")
+QDEF(MP_QSTR_add, 12868, 3, "add")
+QDEF(MP_QSTR_add_ints, 24635, 8, "add_ints")
+QDEF(MP_QSTR_addr, 31414, 4, "addr")
+QDEF(MP_QSTR_addressof, 63834, 9, "addressof")
+QDEF(MP_QSTR_alloc_info, 17817, 10, "alloc_info")
+QDEF(MP_QSTR_alloc_trace, 38998, 11, "alloc_trace")
+QDEF(MP_QSTR_allocate_lock, 60908, 13, "allocate_lock")
+QDEF(MP_QSTR_appendleft, 7856, 10, "appendleft")
+QDEF(MP_QSTR_apply, 29265, 5, "apply")
+QDEF(MP_QSTR_argv, 50887, 4, "argv")
+QDEF(MP_QSTR_array, 29308, 5, "array")
+QDEF(MP_QSTR_as_bytearray, 6427, 12, "as_bytearray")
+QDEF(MP_QSTR_asin, 58704, 4, "asin")
+QDEF(MP_QSTR_asinh, 36664, 5, "asinh")
+QDEF(MP_QSTR_atan, 48671, 4, "atan")
+QDEF(MP_QSTR_atan2, 33229, 5, "atan2")
+QDEF(MP_QSTR_atanh, 33175, 5, "atanh")
+QDEF(MP_QSTR_atexit, 39088, 6, "atexit")
+QDEF(MP_QSTR_b2a_base64, 36668, 10, "b2a_base64")
+QDEF(MP_QSTR_b2a_base64_into, 54943, 15, "b2a_base64_into")
+QDEF(MP_QSTR_baudrate, 55541, 8, "baudrate")
+QDEF(MP_QSTR_bin, 18656, 3, "bin")
+QDEF(MP_QSTR_bind, 25732, 4, "bind")
+QDEF(MP_QSTR_bit_count, 44358, 9, "bit_count")
+QDEF(MP_QSTR_bit_length, 6841, 10, "bit_length")
+QDEF(MP_QSTR_blit, 20726, 4, "blit")
+QDEF(MP_QSTR_blockcycles, 19535, 11, "blockcycles")
+QDEF(MP_QSTR_boolean, 4353, 7, "boolean")
+QDEF(MP_QSTR_bounce, 58261, 6, "bounce")
+QDEF(MP_QSTR_bound_method, 41623, 12, "bound_method")
+QDEF(MP_QSTR_buffering, 56101, 9, "buffering")
+QDEF(MP_QSTR_bytearray_at, 23708, 12, "bytearray_at")
+QDEF(MP_QSTR_byteorder, 39265, 9, "byteorder")
+QDEF(MP_QSTR_bytes_at, 23990, 8, "bytes_at")
+QDEF(MP_QSTR_cachesize, 30924, 9, "cachesize")
+QDEF(MP_QSTR_calcsize, 14413, 8, "calcsize")
+QDEF(MP_QSTR_call_exception_handler, 19688, 22, "call_exception_handler")
+QDEF(MP_QSTR_call_into, 54628, 9, "call_into")
+QDEF(MP_QSTR_callback, 61516, 8, "callback")
+QDEF(MP_QSTR_cancel, 34563, 6, "cancel")
+QDEF(MP_QSTR_ceil, 45062, 4, "ceil")
+QDEF(MP_QSTR_center, 48974, 6, "center")
+QDEF(MP_QSTR_cexample, 53198, 8, "cexample")
+QDEF(MP_QSTR_cfun, 40283, 4, "cfun")
+QDEF(MP_QSTR_chdir, 45745, 5, "chdir")
+QDEF(MP_QSTR_choice, 13102, 6, "choice")
+QDEF(MP_QSTR_clock, 25901, 5, "clock")
+QDEF(MP_QSTR_closure, 51828, 7, "closure")
+QDEF(MP_QSTR_cmath, 62646, 5, "cmath")
+QDEF(MP_QSTR_code, 55912, 4, "code")
+QDEF(MP_QSTR_collect, 26011, 7, "collect")
+QDEF(MP_QSTR_compile, 51700, 7, "compile")
+QDEF(MP_QSTR_complex, 40389, 7, "complex")
+QDEF(MP_QSTR_compress, 31395, 8, "compress")
+QDEF(MP_QSTR_compressobj, 20004, 11, "compressobj")
+QDEF(MP_QSTR_connect, 15835, 7, "connect")
+QDEF(MP_QSTR_copyfrom, 10838, 8, "copyfrom")
+QDEF(MP_QSTR_copysign, 5171, 8, "copysign")
+QDEF(MP_QSTR_coro, 56244, 4, "coro")
+QDEF(MP_QSTR_cos, 19578, 3, "cos")
+QDEF(MP_QSTR_cosh, 56274, 4, "cosh")
+QDEF(MP_QSTR_cppexample, 26574, 10, "cppexample")
+QDEF(MP_QSTR_cppfunc, 57560, 7, "cppfunc")
+QDEF(MP_QSTR_crc32, 59510, 5, "crc32")
+QDEF(MP_QSTR_cs, 28405, 2, "cs")
+QDEF(MP_QSTR_cur_task, 11763, 8, "cur_task")
+QDEF(MP_QSTR_data, 56341, 4, "data")
+QDEF(MP_QSTR_decode, 22953, 6, "decode")
+QDEF(MP_QSTR_decompress, 64354, 10, "decompress")
+QDEF(MP_QSTR_default, 32206, 7, "default")
+QDEF(MP_QSTR_degrees, 16642, 7, "degrees")
+QDEF(MP_QSTR_delattr, 51419, 7, "delattr")
+QDEF(MP_QSTR_deleter, 56174, 7, "deleter")
+QDEF(MP_QSTR_deque, 39173, 5, "deque")
+QDEF(MP_QSTR_dict_view, 43309, 9, "dict_view")
+QDEF(MP_QSTR_difference, 9330, 10, "difference")
+QDEF(MP_QSTR_difference_update, 64156, 17, "difference_update")
+QDEF(MP_QSTR_digest, 50381, 6, "digest")
+QDEF(MP_QSTR_dirty, 51319, 5, "dirty")
+QDEF(MP_QSTR_disable, 30353, 7, "disable")
+QDEF(MP_QSTR_discard, 28943, 7, "discard")
+QDEF(MP_QSTR_doc, 7981, 3, "doc")
+QDEF(MP_QSTR_done, 837, 4, "done")
+QDEF(MP_QSTR_dot, 7994, 3, "dot")
+QDEF(MP_QSTR_dump, 12265, 4, "dump")
+QDEF(MP_QSTR_dumps, 11642, 5, "dumps")
+QDEF(MP_QSTR_e, 46528, 1, "e")
+QDEF(MP_QSTR_empty, 57264, 5, "empty")
+QDEF(MP_QSTR_enable, 56836, 6, "enable")
+QDEF(MP_QSTR_encode, 51779, 6, "encode")
+QDEF(MP_QSTR_encoding, 39942, 8, "encoding")
+QDEF(MP_QSTR_end_array, 51052, 9, "end_array")
+QDEF(MP_QSTR_end_map, 6313, 7, "end_map")
+QDEF(MP_QSTR_enumerate, 47729, 9, "enumerate")
+QDEF(MP_QSTR_erf, 9108, 3, "erf")
+QDEF(MP_QSTR_erfc, 38519, 4, "erfc")
+QDEF(MP_QSTR_errno, 4545, 5, "errno")
+QDEF(MP_QSTR_errorcode, 56592, 9, "errorcode")
+QDEF(MP_QSTR_exc_info, 65290, 8, "exc_info")
+QDEF(MP_QSTR_exception, 60370, 9, "exception")
+QDEF(MP_QSTR_exit, 48773, 4, "exit")
+QDEF(MP_QSTR_exp, 9416, 3, "exp")
+QDEF(MP_QSTR_expire, 43126, 6, "expire")
+QDEF(MP_QSTR_expm1, 29300, 5, "expm1")
+QDEF(MP_QSTR_extend_from_buffer, 60245, 18, "extend_from_buffer")
+QDEF(MP_QSTR_extra_coverage, 39534, 14, "extra_coverage")
+QDEF(MP_QSTR_extra_cpp_coverage, 28210, 18, "extra_cpp_coverage")
+QDEF(MP_QSTR_fabs, 4755, 4, "fabs")
+QDEF(MP_QSTR_factorial, 13004, 9, "factorial")
+QDEF(MP_QSTR_ffi, 13964, 3, "ffi")
+QDEF(MP_QSTR_fficallback, 24261, 11, "fficallback")
+QDEF(MP_QSTR_ffifunc, 2962, 7, "ffifunc")
+QDEF(MP_QSTR_ffimod, 45770, 6, "ffimod")
+QDEF(MP_QSTR_ffivar, 4937, 6, "ffivar")
+QDEF(MP_QSTR_fft, 13969, 3, "fft")
+QDEF(MP_QSTR_file, 13507, 4, "file")
+QDEF(MP_QSTR_file_digest, 32692, 11, "file_digest")
+QDEF(MP_QSTR_fileno, 30338, 6, "fileno")
+QDEF(MP_QSTR_fill, 13514, 4, "fill")
+QDEF(MP_QSTR_fill_rect, 60725, 9, "fill_rect")
+QDEF(MP_QSTR_filter, 48677, 6, "filter")
+QDEF(MP_QSTR_flags, 36858, 5, "flags")
+QDEF(MP_QSTR_float, 17461, 5, "float")
+QDEF(MP_QSTR_float_pool, 37110, 10, "float_pool")
+QDEF(MP_QSTR_floor, 18045, 5, "floor")
+QDEF(MP_QSTR_flush, 49505, 5, "flush")
+QDEF(MP_QSTR_fmod, 17637, 4, "fmod")
+QDEF(MP_QSTR_framebuf, 33385, 8, "framebuf")
+QDEF(MP_QSTR_free, 15089, 4, "free")
+QDEF(MP_QSTR_frexp, 38940, 5, "frexp")
+QDEF(MP_QSTR_fromkeys, 48439, 8, "fromkeys")
+QDEF(MP_QSTR_frozenset, 40173, 9, "frozenset")
+QDEF(MP_QSTR_fsum, 15528, 4, "fsum")
+QDEF(MP_QSTR_full, 26838, 4, "full")
+QDEF(MP_QSTR_func, 26651, 4, "func")
+QDEF(MP_QSTR_function, 551, 8, "function")
+QDEF(MP_QSTR_future, 14592, 6, "future")
+QDEF(MP_QSTR_gamma, 36866, 5, "gamma")
+QDEF(MP_QSTR_gc, 28257, 2, "gc")
+QDEF(MP_QSTR_generator, 50070, 9, "generator")
+QDEF(MP_QSTR_get_ident, 45566, 9, "get_ident")
+QDEF(MP_QSTR_get_into, 58672, 8, "get_into")
+QDEF(MP_QSTR_get_nowait, 16774, 10, "get_nowait")
+QDEF(MP_QSTR_getaddrinfo, 6254, 11, "getaddrinfo")
+QDEF(MP_QSTR_getcwd, 53251, 6, "getcwd")
+QDEF(MP_QSTR_getenv, 64430, 6, "getenv")
+QDEF(MP_QSTR_getrandbits, 32102, 11, "getrandbits")
+QDEF(MP_QSTR_getsizeof, 9215, 9, "getsizeof")
+QDEF(MP_QSTR_getter, 45712, 6, "getter")
+QDEF(MP_QSTR_getvalue, 44152, 8, "getvalue")
+QDEF(MP_QSTR_give, 45880, 4, "give")
+QDEF(MP_QSTR_gmtime, 36442, 6, "gmtime")
+QDEF(MP_QSTR_group, 45242, 5, "group")
+QDEF(MP_QSTR_groups, 51081, 6, "groups")
+QDEF(MP_QSTR_heap_lock, 36013, 9, "heap_lock")
+QDEF(MP_QSTR_heap_locked, 26444, 11, "heap_locked")
+QDEF(MP_QSTR_heap_size, 54563, 9, "heap_size")
+QDEF(MP_QSTR_heap_unlock, 11606, 11, "heap_unlock")
+QDEF(MP_QSTR_heapify, 11695, 7, "heapify")
+QDEF(MP_QSTR_heappop, 10198, 7, "heappop")
+QDEF(MP_QSTR_heappush, 27527, 8, "heappush")
+QDEF(MP_QSTR_hellocpp, 59812, 8, "hellocpp")
+QDEF(MP_QSTR_help, 23700, 4, "help")
+QDEF(MP_QSTR_hex, 20592, 3, "hex")
+QDEF(MP_QSTR_hexdigest, 62904, 9, "hexdigest")
+QDEF(MP_QSTR_hexlify, 32554, 7, "hexlify")
+QDEF(MP_QSTR_hexlify_into, 10697, 12, "hexlify_into")
+QDEF(MP_QSTR_hline, 15491, 5, "hline")
+QDEF(MP_QSTR_idle, 56481, 4, "idle")
+QDEF(MP_QSTR_ilistdir, 27249, 8, "ilistdir")
+QDEF(MP_QSTR_imag, 46919, 4, "imag")
+QDEF(MP_QSTR_implementation, 11543, 14, "implementation")
+QDEF(MP_QSTR_indices, 18522, 7, "indices")
+QDEF(MP_QSTR_inet_ntop, 7561, 9, "inet_ntop")
+QDEF(MP_QSTR_inet_pton, 38089, 9, "inet_pton")
+QDEF(MP_QSTR_inf, 21252, 3, "inf")
+QDEF(MP_QSTR_init, 46111, 4, "init")
+QDEF(MP_QSTR_input, 23155, 5, "input")
+QDEF(MP_QSTR_intersection, 10792, 12, "intersection")
+QDEF(MP_QSTR_intersection_update, 56582, 19, "intersection_update")
+QDEF(MP_QSTR_invert, 183, 6, "invert")
+QDEF(MP_QSTR_ioctl, 49784, 5, "ioctl")
+QDEF(MP_QSTR_ipoll, 23891, 5, "ipoll")
+QDEF(MP_QSTR_is_running, 34183, 10, "is_running")
+QDEF(MP_QSTR_is_set, 58562, 6, "is_set")
+QDEF(MP_QSTR_isclose, 20041, 7, "isclose")
+QDEF(MP_QSTR_isdisjoint, 26871, 10, "isdisjoint")
+QDEF(MP_QSTR_isenabled, 58778, 9, "isenabled")
+QDEF(MP_QSTR_isfinite, 43942, 8, "isfinite")
+QDEF(MP_QSTR_isinf, 4414, 5, "isinf")
+QDEF(MP_QSTR_isnan, 926, 5, "isnan")
+QDEF(MP_QSTR_isplit, 10078, 6, "isplit")
+QDEF(MP_QSTR_isplitlines, 23011, 11, "isplitlines")
+QDEF(MP_QSTR_issubset, 49593, 8, "issubset")
+QDEF(MP_QSTR_issuperset, 60668, 10, "issuperset")
+QDEF(MP_QSTR_itemsize, 30581, 8, "itemsize")
+QDEF(MP_QSTR_iter_unpack, 12210, 11, "iter_unpack")
+QDEF(MP_QSTR_iterable, 37413, 8, "iterable")
+QDEF(MP_QSTR_iterator, 48711, 8, "iterator")
+QDEF(MP_QSTR_iterparse, 52186, 9, "iterparse")
+QDEF(MP_QSTR_kbd_intr, 5110, 8, "kbd_intr")
+QDEF(MP_QSTR_keepends, 35682, 8, "keepends")
+QDEF(MP_QSTR_layout, 55263, 6, "layout")
+QDEF(MP_QSTR_ldexp, 28480, 5, "ldexp")
+QDEF(MP_QSTR_length, 34649, 6, "length")
+QDEF(MP_QSTR_lgamma, 27854, 6, "lgamma")
+QDEF(MP_QSTR_line, 7371, 4, "line")
+QDEF(MP_QSTR_listdir, 58264, 7, "listdir")
+QDEF(MP_QSTR_listen, 3788, 6, "listen")
+QDEF(MP_QSTR_load, 9315, 4, "load")
+QDEF(MP_QSTR_loads, 45232, 5, "loads")
+QDEF(MP_QSTR_localtime, 18045, 9, "localtime")
+QDEF(MP_QSTR_lock, 9134, 4, "lock")
+QDEF(MP_QSTR_locked, 47631, 6, "locked")
+QDEF(MP_QSTR_log, 16161, 3, "log")
+QDEF(MP_QSTR_log10, 37184, 5, "log10")
+QDEF(MP_QSTR_log2, 9075, 4, "log2")
+QDEF(MP_QSTR_lookahead, 8427, 9, "lookahead")
+QDEF(MP_QSTR_makefile, 54721, 8, "makefile")
+QDEF(MP_QSTR_map_key, 34257, 7, "map_key")
+QDEF(MP_QSTR_match, 8854, 5, "match")
+QDEF(MP_QSTR_math, 47925, 4, "math")
+QDEF(MP_QSTR_max, 17329, 3, "max")
+QDEF(MP_QSTR_maxlen, 6230, 6, "maxlen")
+QDEF(MP_QSTR_maxsize, 28884, 7, "maxsize")
+QDEF(MP_QSTR_mem, 17440, 3, "mem")
+QDEF(MP_QSTR_mem16, 51719, 5, "mem16")
+QDEF(MP_QSTR_mem32, 51777, 5, "mem32")
+QDEF(MP_QSTR_mem8, 51224, 4, "mem8")
+QDEF(MP_QSTR_mem_alloc, 11090, 9, "mem_alloc")
+QDEF(MP_QSTR_mem_current, 47638, 11, "mem_current")
+QDEF(MP_QSTR_mem_free, 25291, 8, "mem_free")
+QDEF(MP_QSTR_mem_info, 61905, 8, "mem_info")
+QDEF(MP_QSTR_mem_peak, 9536, 8, "mem_peak")
+QDEF(MP_QSTR_mem_total, 27389, 9, "mem_total")
+QDEF(MP_QSTR_memoryview, 17513, 10, "memoryview")
+QDEF(MP_QSTR_min, 17071, 3, "min")
+QDEF(MP_QSTR_mkdir, 46492, 5, "mkdir")
+QDEF(MP_QSTR_mkfs, 45174, 4, "mkfs")
+QDEF(MP_QSTR_mktime, 11158, 6, "mktime")
+QDEF(MP_QSTR_mmap, 42964, 4, "mmap")
+QDEF(MP_QSTR_mode, 49190, 4, "mode")
+QDEF(MP_QSTR_modf, 49189, 4, "modf")
+QDEF(MP_QSTR_modify, 26357, 6, "modify")
+QDEF(MP_QSTR_module, 39359, 6, "module")
+QDEF(MP_QSTR_modules, 53740, 7, "modules")
+QDEF(MP_QSTR_mount, 3496, 5, "mount")
+QDEF(MP_QSTR_mtime, 9213, 5, "mtime")
+QDEF(MP_QSTR_name, 30114, 4, "name")
+QDEF(MP_QSTR_namedtuple, 5662, 10, "namedtuple")
+QDEF(MP_QSTR_nan, 22756, 3, "nan")
+QDEF(MP_QSTR_native, 2948, 6, "native")
+QDEF(MP_QSTR_newline, 35127, 7, "newline")
+QDEF(MP_QSTR_null, 51678, 4, "null")
+QDEF(MP_QSTR_number, 63046, 6, "number")
+QDEF(MP_QSTR_oct, 23805, 3, "oct")
+QDEF(MP_QSTR_off, 23690, 3, "off")
+QDEF(MP_QSTR_offset, 15432, 6, "offset")
+QDEF(MP_QSTR_on, 28516, 2, "on")
+QDEF(MP_QSTR_opt_level, 26503, 9, "opt_level")
+QDEF(MP_QSTR_pack, 53692, 4, "pack")
+QDEF(MP_QSTR_pack_into, 43295, 9, "pack_into")
+QDEF(MP_QSTR_palette, 29144, 7, "palette")
+QDEF(MP_QSTR_partition, 58759, 9, "partition")
+QDEF(MP_QSTR_path, 52872, 4, "path")
+QDEF(MP_QSTR_pause_info, 63622, 10, "pause_info")
+QDEF(MP_QSTR_peek, 49534, 4, "peek")
+QDEF(MP_QSTR_peektime, 23691, 8, "peektime")
+QDEF(MP_QSTR_pend_throw, 29939, 10, "pend_throw")
+QDEF(MP_QSTR_ph_key, 6901, 6, "ph_key")
+QDEF(MP_QSTR_phase, 54634, 5, "phase")
+QDEF(MP_QSTR_pi, 28700, 2, "pi")
+QDEF(MP_QSTR_pixel, 61517, 5, "pixel")
+QDEF(MP_QSTR_platform, 6458, 8, "platform")
+QDEF(MP_QSTR_polar, 3077, 5, "polar")
+QDEF(MP_QSTR_polarity, 60737, 8, "polarity")
+QDEF(MP_QSTR_poll, 55706, 4, "poll")
+QDEF(MP_QSTR_poller, 42221, 6, "poller")
+QDEF(MP_QSTR_popleft, 39537, 7, "popleft")
+QDEF(MP_QSTR_print_exception, 8732, 15, "print_exception")
+QDEF(MP_QSTR_profile_dump, 38461, 12, "profile_dump")
+QDEF(MP_QSTR_profile_start, 40913, 13, "profile_start")
+QDEF(MP_QSTR_profile_stop, 49097, 12, "profile_stop")
+QDEF(MP_QSTR_progsize, 54026, 8, "progsize")
+QDEF(MP_QSTR_property, 10690, 8, "property")
+QDEF(MP_QSTR_ps1, 28919, 3, "ps1")
+QDEF(MP_QSTR_ps2, 28916, 3, "ps2")
+QDEF(MP_QSTR_ptr, 28755, 3, "ptr")
+QDEF(MP_QSTR_ptr16, 51956, 5, "ptr16")
+QDEF(MP_QSTR_ptr32, 51890, 5, "ptr32")
+QDEF(MP_QSTR_ptr8, 31371, 4, "ptr8")
+QDEF(MP_QSTR_push, 32443, 4, "push")
+QDEF(MP_QSTR_put, 28788, 3, "put")
+QDEF(MP_QSTR_put_from, 30813, 8, "put_from")
+QDEF(MP_QSTR_put_nowait, 60641, 10, "put_nowait")
+QDEF(MP_QSTR_putenv, 27849, 6, "putenv")
+QDEF(MP_QSTR_qsize, 36273, 5, "qsize")
+QDEF(MP_QSTR_qstr_info, 33200, 9, "qstr_info")
+QDEF(MP_QSTR_queue_read, 52601, 10, "queue_read")
+QDEF(MP_QSTR_r, 46551, 1, "r")
+QDEF(MP_QSTR_radians, 16263, 7, "radians")
+QDEF(MP_QSTR_randint, 56495, 7, "randint")
+QDEF(MP_QSTR_random, 11454, 6, "random")
+QDEF(MP_QSTR_randrange, 16035, 9, "randrange")
+QDEF(MP_QSTR_rb, 28885, 2, "rb")
+QDEF(MP_QSTR_read1, 12454, 5, "read1")
+QDEF(MP_QSTR_readblocks, 7213, 10, "readblocks")
+QDEF(MP_QSTR_readlines, 22890, 9, "readlines")
+QDEF(MP_QSTR_readonly, 35075, 8, "readonly")
+QDEF(MP_QSTR_readsize, 51666, 8, "readsize")
+QDEF(MP_QSTR_real, 63935, 4, "real")
+QDEF(MP_QSTR_rect, 63973, 4, "rect")
+QDEF(MP_QSTR_recv, 63975, 4, "recv")
+QDEF(MP_QSTR_recvfrom, 37009, 8, "recvfrom")
+QDEF(MP_QSTR_refill, 55069, 6, "refill")
+QDEF(MP_QSTR_register, 41388, 8, "register")
+QDEF(MP_QSTR_rel_tol, 18006, 7, "rel_tol")
+QDEF(MP_QSTR_release, 36844, 7, "release")
+QDEF(MP_QSTR_rename, 6197, 6, "rename")
+QDEF(MP_QSTR_reserve, 19141, 7, "reserve")
+QDEF(MP_QSTR_reversed, 28321, 8, "reversed")
+QDEF(MP_QSTR_rmdir, 42821, 5, "rmdir")
+QDEF(MP_QSTR_rotate, 32220, 6, "rotate")
+QDEF(MP_QSTR_rpartition, 53269, 10, "rpartition")
+QDEF(MP_QSTR_run, 35180, 3, "run")
+QDEF(MP_QSTR_run_until_complete, 37871, 18, "run_until_complete")
+QDEF(MP_QSTR_scale, 20861, 5, "scale")
+QDEF(MP_QSTR_schedule, 44256, 8, "schedule")
+QDEF(MP_QSTR_schedule_stats, 36606, 14, "schedule_stats")
+QDEF(MP_QSTR_scroll, 23080, 6, "scroll")
+QDEF(MP_QSTR_search, 49579, 6, "search")
+QDEF(MP_QSTR_seed, 30098, 4, "seed")
+QDEF(MP_QSTR_seek, 30109, 4, "seek")
+QDEF(MP_QSTR_sendfile, 24703, 8, "sendfile")
+QDEF(MP_QSTR_sendto, 802, 6, "sendto")
+QDEF(MP_QSTR_separators, 3307, 10, "separators")
+QDEF(MP_QSTR_set_buf, 42889, 7, "set_buf")
+QDEF(MP_QSTR_set_error, 64320, 9, "set_error")
+QDEF(MP_QSTR_setblocking, 6254, 11, "setblocking")
+QDEF(MP_QSTR_setraw, 29059, 6, "setraw")
+QDEF(MP_QSTR_setsockopt, 59448, 10, "setsockopt")
+QDEF(MP_QSTR_setter, 22788, 6, "setter")
+QDEF(MP_QSTR_settimeout, 35548, 10, "settimeout")
+QDEF(MP_QSTR_sha256, 302, 6, "sha256")
+QDEF(MP_QSTR_sha512, 64873, 6, "sha512")
+QDEF(MP_QSTR_sin, 37041, 3, "sin")
+QDEF(MP_QSTR_single, 8255, 6, "single")
+QDEF(MP_QSTR_sinh, 42681, 4, "sinh")
+QDEF(MP_QSTR_size, 42272, 4, "size")
+QDEF(MP_QSTR_sizeof, 29513, 6, "sizeof")
+QDEF(MP_QSTR_sleep, 10218, 5, "sleep")
+QDEF(MP_QSTR_sleep_ms, 25355, 8, "sleep_ms")
+QDEF(MP_QSTR_sleep_us, 24595, 8, "sleep_us")
+QDEF(MP_QSTR_slice, 62645, 5, "slice")
+QDEF(MP_QSTR_sockaddr, 35938, 8, "sockaddr")
+QDEF(MP_QSTR_socket, 52320, 6, "socket")
+QDEF(MP_QSTR_source, 30904, 6, "source")
+QDEF(MP_QSTR_span, 18121, 4, "span")
+QDEF(MP_QSTR_spi, 36303, 3, "spi")
+QDEF(MP_QSTR_splitlines, 54122, 10, "splitlines")
+QDEF(MP_QSTR_sqrt, 17441, 4, "sqrt")
+QDEF(MP_QSTR_stack_size, 15153, 10, "stack_size")
+QDEF(MP_QSTR_stack_use, 63383, 9, "stack_use")
+QDEF(MP_QSTR_start_array, 47651, 11, "start_array")
+QDEF(MP_QSTR_start_map, 17894, 9, "start_map")
+QDEF(MP_QSTR_start_new_thread, 9687, 16, "start_new_thread")
+QDEF(MP_QSTR_stat, 13783, 4, "stat")
+QDEF(MP_QSTR_state, 61650, 5, "state")
+QDEF(MP_QSTR_stats, 61636, 5, "stats")
+QDEF(MP_QSTR_statvfs, 6420, 7, "statvfs")
+QDEF(MP_QSTR_stderr, 22691, 6, "stderr")
+QDEF(MP_QSTR_stdin, 1057, 5, "stdin")
+QDEF(MP_QSTR_stdout, 33544, 6, "stdout")
+QDEF(MP_QSTR_string, 58736, 6, "string")
+QDEF(MP_QSTR_struct, 36882, 6, "struct")
+QDEF(MP_QSTR_sub, 36129, 3, "sub")
+QDEF(MP_QSTR_symmetric_difference, 26574, 20, "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, 63584, 27, "symmetric_difference_update")
+QDEF(MP_QSTR_sync, 25250, 4, "sync")
+QDEF(MP_QSTR_sys, 36540, 3, "sys")
+QDEF(MP_QSTR_system, 5280, 6, "system")
+QDEF(MP_QSTR_take, 41278, 4, "take")
+QDEF(MP_QSTR_tan, 25086, 3, "tan")
+QDEF(MP_QSTR_tanh, 41430, 4, "tanh")
+QDEF(MP_QSTR_tau, 25061, 3, "tau")
+QDEF(MP_QSTR_tcgetattr, 50615, 9, "tcgetattr")
+QDEF(MP_QSTR_tcsetattr, 13475, 9, "tcsetattr")
+QDEF(MP_QSTR_tell, 45332, 4, "tell")
+QDEF(MP_QSTR_termios, 57214, 7, "termios")
+QDEF(MP_QSTR_text, 44952, 4, "text")
+QDEF(MP_QSTR_threshold, 12274, 9, "threshold")
+QDEF(MP_QSTR_ticks_add, 44701, 9, "ticks_add")
+QDEF(MP_QSTR_ticks_cpu, 42266, 9, "ticks_cpu")
+QDEF(MP_QSTR_ticks_diff, 57521, 10, "ticks_diff")
+QDEF(MP_QSTR_ticks_ms, 12866, 8, "ticks_ms")
+QDEF(MP_QSTR_ticks_us, 12634, 8, "ticks_us")
+QDEF(MP_QSTR_time, 49648, 4, "time")
+QDEF(MP_QSTR_time_ns, 45682, 7, "time_ns")
+QDEF(MP_QSTR_time_pulse_us, 3209, 13, "time_pulse_us")
+QDEF(MP_QSTR_tracebacklimit, 41242, 14, "tracebacklimit")
+QDEF(MP_QSTR_trunc, 39259, 5, "trunc")
+QDEF(MP_QSTR_typecode, 36080, 8, "typecode")
+QDEF(MP_QSTR_uarray, 34441, 6, "uarray")
+QDEF(MP_QSTR_ubinascii, 35012, 9, "ubinascii")
+QDEF(MP_QSTR_ucollections, 39445, 12, "ucollections")
+QDEF(MP_QSTR_uctypes, 29176, 7, "uctypes")
+QDEF(MP_QSTR_uerrno, 59828, 6, "uerrno")
+QDEF(MP_QSTR_uhashlib, 40293, 8, "uhashlib")
+QDEF(MP_QSTR_uheapq, 17181, 6, "uheapq")
+QDEF(MP_QSTR_uint, 15843, 4, "uint")
+QDEF(MP_QSTR_uio, 26294, 3, "uio")
+QDEF(MP_QSTR_ujson, 12520, 5, "ujson")
+QDEF(MP_QSTR_umachine, 32661, 8, "umachine")
+QDEF(MP_QSTR_umount, 40669, 6, "umount")
+QDEF(MP_QSTR_unhexlify, 47537, 9, "unhexlify")
+QDEF(MP_QSTR_unhexlify_into, 21490, 14, "unhexlify_into")
+QDEF(MP_QSTR_uniform, 62721, 7, "uniform")
+QDEF(MP_QSTR_union, 31990, 5, "union")
+QDEF(MP_QSTR_unlink, 36862, 6, "unlink")
+QDEF(MP_QSTR_unpack, 15367, 6, "unpack")
+QDEF(MP_QSTR_unpack_from, 27918, 11, "unpack_from")
+QDEF(MP_QSTR_unregister, 54295, 10, "unregister")
+QDEF(MP_QSTR_unsetenv, 18049, 8, "unsetenv")
+QDEF(MP_QSTR_uos, 26604, 3, "uos")
+QDEF(MP_QSTR_urandom, 44715, 7, "urandom")
+QDEF(MP_QSTR_ure, 25479, 3, "ure")
+QDEF(MP_QSTR_uselect, 36440, 7, "uselect")
+QDEF(MP_QSTR_usocket, 117, 7, "usocket")
+QDEF(MP_QSTR_ustruct, 2119, 7, "ustruct")
+QDEF(MP_QSTR_usys, 62409, 4, "usys")
+QDEF(MP_QSTR_utime, 40421, 5, "utime")
+QDEF(MP_QSTR_utimeq, 23284, 6, "utimeq")
+QDEF(MP_QSTR_utimerwheel, 324, 11, "utimerwheel")
+QDEF(MP_QSTR_uwebsocket, 13285, 10, "uwebsocket")
+QDEF(MP_QSTR_uzlib, 39789, 5, "uzlib")
+QDEF(MP_QSTR_var, 31456, 3, "var")
+QDEF(MP_QSTR_vars, 54931, 4, "vars")
+QDEF(MP_QSTR_version, 54207, 7, "version")
+QDEF(MP_QSTR_version_info, 2670, 12, "version_info")
+QDEF(MP_QSTR_viper, 9053, 5, "viper")
+QDEF(MP_QSTR_vline, 63005, 5, "vline")
+QDEF(MP_QSTR_vm_stats, 64768, 8, "vm_stats")
+QDEF(MP_QSTR_wait, 21902, 4, "wait")
+QDEF(MP_QSTR_websocket, 36240, 9, "websocket")
+QDEF(MP_QSTR_writable, 55031, 8, "writable")
+QDEF(MP_QSTR_write1, 48041, 6, "write1")
+QDEF(MP_QSTR_write_readinto, 33929, 14, "write_readinto")
+QDEF(MP_QSTR_writeblocks, 57090, 11, "writeblocks")
+QDEF(MP_QSTR_writev, 48110, 6, "writev")
+
+#ifdef QBUCKET
+QBUCKET(0)
+QBUCKET(4)
+QBUCKET(7)
+QBUCKET(11)
+QBUCKET(17)
+QBUCKET(21)
+QBUCKET(24)
+QBUCKET(28)
+QBUCKET(31)
+QBUCKET(34)
+QBUCKET(37)
+QBUCKET(40)
+QBUCKET(43)
+QBUCKET(43)
+QBUCKET(44)
+QBUCKET(47)
+QBUCKET(51)
+QBUCKET(53)
+QBUCKET(53)
+QBUCKET(57)
+QBUCKET(62)
+QBUCKET(64)
+QBUCKET(68)
+QBUCKET(73)
+QBUCKET(78)
+QBUCKET(80)
+QBUCKET(83)
+QBUCKET(87)
+QBUCKET(92)
+QBUCKET(96)
+QBUCKET(100)
+QBUCKET(102)
+QBUCKET(105)
+QBUCKET(111)
+QBUCKET(119)
+QBUCKET(122)
+QBUCKET(126)
+QBUCKET(128)
+QBUCKET(134)
+QBUCKET(137)
+QBUCKET(142)
+QBUCKET(146)
+QBUCKET(148)
+QBUCKET(152)
+QBUCKET(154)
+QBUCKET(154)
+QBUCKET(161)
+QBUCKET(164)
+QBUCKET(164)
+QBUCKET(165)
+QBUCKET(169)
+QBUCKET(174)
+QBUCKET(178)
+QBUCKET(180)
+QBUCKET(185)
+QBUCKET(188)
+QBUCKET(191)
+QBUCKET(196)
+QBUCKET(199)
+QBUCKET(202)
+QBUCKET(205)
+QBUCKET(207)
+QBUCKET(208)
+QBUCKET(212)
+QBUCKET(214)
+QBUCKET(220)
+QBUCKET(222)
+QBUCKET(225)
+QBUCKET(226)
+QBUCKET(229)
+QBUCKET(232)
+QBUCKET(237)
+QBUCKET(242)
+QBUCKET(243)
+QBUCKET(248)
+QBUCKET(250)
+QBUCKET(251)
+QBUCKET(255)
+QBUCKET(257)
+QBUCKET(260)
+QBUCKET(263)
+QBUCKET(265)
+QBUCKET(266)
+QBUCKET(269)
+QBUCKET(273)
+QBUCKET(277)
+QBUCKET(278)
+QBUCKET(285)
+QBUCKET(288)
+QBUCKET(290)
+QBUCKET(291)
+QBUCKET(296)
+QBUCKET(300)
+QBUCKET(304)
+QBUCKET(307)
+QBUCKET(311)
+QBUCKET(312)
+QBUCKET(314)
+QBUCKET(321)
+QBUCKET(326)
+QBUCKET(331)
+QBUCKET(334)
+QBUCKET(335)
+QBUCKET(336)
+QBUCKET(336)
+QBUCKET(338)
+QBUCKET(342)
+QBUCKET(346)
+QBUCKET(348)
+QBUCKET(352)
+QBUCKET(355)
+QBUCKET(361)
+QBUCKET(362)
+QBUCKET(365)
+QBUCKET(369)
+QBUCKET(371)
+QBUCKET(375)
+QBUCKET(380)
+QBUCKET(382)
+QBUCKET(387)
+QBUCKET(391)
+QBUCKET(394)
+QBUCKET(398)
+QBUCKET(402)
+QBUCKET(404)
+QBUCKET(406)
+QBUCKET(413)
+QBUCKET(415)
+QBUCKET(417)
+QBUCKET(419)
+QBUCKET(423)
+QBUCKET(425)
+QBUCKET(430)
+QBUCKET(433)
+QBUCKET(439)
+QBUCKET(443)
+QBUCKET(449)
+QBUCKET(452)
+QBUCKET(460)
+QBUCKET(462)
+QBUCKET(465)
+QBUCKET(467)
+QBUCKET(467)
+QBUCKET(470)
+QBUCKET(472)
+QBUCKET(475)
+QBUCKET(480)
+QBUCKET(482)
+QBUCKET(485)
+QBUCKET(488)
+QBUCKET(493)
+QBUCKET(497)
+QBUCKET(501)
+QBUCKET(504)
+QBUCKET(508)
+QBUCKET(511)
+QBUCKET(515)
+QBUCKET(518)
+QBUCKET(524)
+QBUCKET(525)
+QBUCKET(527)
+QBUCKET(529)
+QBUCKET(532)
+QBUCKET(535)
+QBUCKET(539)
+QBUCKET(541)
+QBUCKET(543)
+QBUCKET(547)
+QBUCKET(553)
+QBUCKET(556)
+QBUCKET(560)
+QBUCKET(560)
+QBUCKET(562)
+QBUCKET(564)
+QBUCKET(566)
+QBUCKET(568)
+QBUCKET(573)
+QBUCKET(578)
+QBUCKET(584)
+QBUCKET(586)
+QBUCKET(590)
+QBUCKET(597)
+QBUCKET(599)
+QBUCKET(607)
+QBUCKET(613)
+QBUCKET(616)
+QBUCKET(621)
+QBUCKET(623)
+QBUCKET(626)
+QBUCKET(628)
+QBUCKET(629)
+QBUCKET(630)
+QBUCKET(638)
+QBUCKET(642)
+QBUCKET(644)
+QBUCKET(647)
+QBUCKET(648)
+QBUCKET(654)
+QBUCKET(659)
+QBUCKET(662)
+QBUCKET(663)
+QBUCKET(665)
+QBUCKET(671)
+QBUCKET(674)
+QBUCKET(676)
+QBUCKET(681)
+QBUCKET(684)
+QBUCKET(691)
+QBUCKET(694)
+QBUCKET(696)
+QBUCKET(700)
+QBUCKET(707)
+QBUCKET(707)
+QBUCKET(712)
+QBUCKET(713)
+QBUCKET(716)
+QBUCKET(719)
+QBUCKET(723)
+QBUCKET(725)
+QBUCKET(726)
+QBUCKET(729)
+QBUCKET(735)
+QBUCKET(738)
+QBUCKET(740)
+QBUCKET(742)
+QBUCKET(746)
+QBUCKET(747)
+QBUCKET(749)
+QBUCKET(754)
+QBUCKET(755)
+QBUCKET(761)
+QBUCKET(763)
+QBUCKET(765)
+QBUCKET(767)
+QBUCKET(771)
+QBUCKET(775)
+QBUCKET(782)
+QBUCKET(787)
+QBUCKET(790)
+QBUCKET(792)
+QBUCKET(793)
+QBUCKET(797)
+QBUCKET(799)
+QBUCKET(804)
+QBUCKET(806)
+QBUCKET(811)
+QBUCKET(815)
+QBUCKET(820)
+QBUCKET(828)
+QBUCKET(829)
+QBUCKET(831)
+QBUCKET(834)
+QBUCKET(834)
+QBUCKET(837)
+QBUCKET(843)
+QBUCKET(847)
+QBUCKET(853)
+#endif
+
+#ifdef QORDER
+QORDER(83)
+QORDER(218)
+QORDER(541)
+QORDER(846)
+QORDER(106)
+QORDER(432)
+QORDER(821)
+QORDER(25)
+QORDER(475)
+QORDER(542)
+QORDER(852)
+QORDER(173)
+QORDER(183)
+QORDER(329)
+QORDER(444)
+QORDER(549)
+QORDER(713)
+QORDER(330)
+QORDER(493)
+QORDER(580)
+QORDER(746)
+QORDER(1)
+QORDER(478)
+QORDER(679)
+QORDER(266)
+QORDER(445)
+QORDER(495)
+QORDER(584)
+QORDER(33)
+QORDER(631)
+QORDER(824)
+QORDER(201)
+QORDER(364)
+QORDER(777)
+QORDER(203)
+QORDER(205)
+QORDER(234)
+QORDER(78)
+QORDER(503)
+QORDER(688)
+QORDER(115)
+QORDER(333)
+QORDER(756)
+QORDER(67)
+QORDER(171)
+QORDER(210)
+QORDER(825)
+QORDER(318)
+QORDER(352)
+QORDER(485)
+QORDER(618)
+QORDER(27)
+QORDER(502)
+QORDER(93)
+QORDER(275)
+QORDER(326)
+QORDER(779)
+QORDER(59)
+QORDER(260)
+QORDER(368)
+QORDER(403)
+QORDER(757)
+QORDER(774)
+QORDER(792)
+QORDER(379)
+QORDER(471)
+QORDER(728)
+QORDER(809)
+QORDER(18)
+QORDER(37)
+QORDER(94)
+QORDER(216)
+QORDER(635)
+QORDER(46)
+QORDER(280)
+QORDER(303)
+QORDER(576)
+QORDER(826)
+QORDER(196)
+QORDER(633)
+QORDER(268)
+QORDER(286)
+QORDER(322)
+QORDER(124)
+QORDER(272)
+QORDER(797)
+QORDER(804)
+QORDER(79)
+QORDER(221)
+QORDER(402)
+QORDER(416)
+QORDER(539)
+QORDER(119)
+QORDER(534)
+QORDER(676)
+QORDER(684)
+QORDER(404)
+QORDER(719)
+QORDER(813)
+QORDER(845)
+QORDER(81)
+QORDER(654)
+QORDER(419)
+QORDER(581)
+QORDER(666)
+QORDER(38)
+QORDER(53)
+QORDER(239)
+QORDER(281)
+QORDER(630)
+QORDER(753)
+QORDER(32)
+QORDER(202)
+QORDER(236)
+QORDER(357)
+QORDER(619)
+QORDER(765)
+QORDER(776)
+QORDER(780)
+QORDER(65)
+QORDER(377)
+QORDER(739)
+QORDER(139)
+QORDER(369)
+QORDER(561)
+QORDER(768)
+QORDER(389)
+QORDER(459)
+QORDER(54)
+QORDER(131)
+QORDER(435)
+QORDER(525)
+QORDER(602)
+QORDER(647)
+QORDER(15)
+QORDER(84)
+QORDER(646)
+QORDER(108)
+QORDER(140)
+QORDER(160)
+QORDER(284)
+QORDER(540)
+QORDER(91)
+QORDER(307)
+QORDER(583)
+QORDER(734)
+QORDER(152)
+QORDER(214)
+QORDER(120)
+QORDER(225)
+QORDER(355)
+QORDER(570)
+QORDER(10)
+QORDER(174)
+QORDER(30)
+QORDER(122)
+QORDER(215)
+QORDER(451)
+QORDER(479)
+QORDER(486)
+QORDER(711)
+QORDER(153)
+QORDER(450)
+QORDER(748)
+QORDER(546)
+QORDER(209)
+QORDER(223)
+QORDER(378)
+QORDER(766)
+QORDER(28)
+QORDER(105)
+QORDER(351)
+QORDER(387)
+QORDER(511)
+QORDER(71)
+QORDER(86)
+QORDER(385)
+QORDER(462)
+QORDER(250)
+QORDER(277)
+QORDER(85)
+QORDER(524)
+QORDER(527)
+QORDER(626)
+QORDER(723)
+QORDER(310)
+QORDER(315)
+QORDER(321)
+QORDER(279)
+QORDER(535)
+QORDER(657)
+QORDER(195)
+QORDER(212)
+QORDER(418)
+QORDER(555)
+QORDER(745)
+QORDER(323)
+QORDER(359)
+QORDER(394)
+QORDER(285)
+QORDER(488)
+QORDER(678)
+QORDER(110)
+QORDER(136)
+QORDER(406)
+QORDER(398)
+QORDER(423)
+QORDER(685)
+QORDER(332)
+QORDER(354)
+QORDER(594)
+QORDER(786)
+QORDER(75)
+QORDER(751)
+QORDER(14)
+QORDER(265)
+QORDER(608)
+QORDER(620)
+QORDER(638)
+QORDER(742)
+QORDER(632)
+QORDER(680)
+QORDER(116)
+QORDER(175)
+QORDER(799)
+QORDER(494)
+QORDER(58)
+QORDER(405)
+QORDER(837)
+QORDER(13)
+QORDER(487)
+QORDER(726)
+QORDER(184)
+QORDER(274)
+QORDER(282)
+QORDER(428)
+QORDER(659)
+QORDER(340)
+QORDER(344)
+QORDER(575)
+QORDER(603)
+QORDER(833)
+QORDER(662)
+QORDER(129)
+QORDER(207)
+QORDER(518)
+QORDER(590)
+QORDER(754)
+QORDER(194)
+QORDER(264)
+QORDER(126)
+QORDER(168)
+QORDER(324)
+QORDER(443)
+QORDER(560)
+QORDER(440)
+QORDER(677)
+QORDER(162)
+QORDER(170)
+QORDER(446)
+QORDER(191)
+QORDER(237)
+QORDER(431)
+QORDER(151)
+QORDER(417)
+QORDER(413)
+QORDER(251)
+QORDER(269)
+QORDER(634)
+QORDER(263)
+QORDER(287)
+QORDER(587)
+QORDER(692)
+QORDER(123)
+QORDER(220)
+QORDER(233)
+QORDER(249)
+QORDER(509)
+QORDER(363)
+QORDER(367)
+QORDER(410)
+QORDER(461)
+QORDER(562)
+QORDER(628)
+QORDER(721)
+QORDER(149)
+QORDER(228)
+QORDER(312)
+QORDER(244)
+QORDER(831)
+QORDER(609)
+QORDER(230)
+QORDER(408)
+QORDER(556)
+QORDER(577)
+QORDER(800)
+QORDER(99)
+QORDER(178)
+QORDER(448)
+QORDER(805)
+QORDER(39)
+QORDER(66)
+QORDER(258)
+QORDER(290)
+QORDER(206)
+QORDER(698)
+QORDER(844)
+QORDER(144)
+QORDER(295)
+QORDER(393)
+QORDER(596)
+QORDER(17)
+QORDER(760)
+QORDER(782)
+QORDER(50)
+QORDER(219)
+QORDER(283)
+QORDER(372)
+QORDER(437)
+QORDER(530)
+QORDER(543)
+QORDER(107)
+QORDER(148)
+QORDER(473)
+QORDER(606)
+QORDER(759)
+QORDER(82)
+QORDER(128)
+QORDER(208)
+QORDER(224)
+QORDER(614)
+QORDER(345)
+QORDER(442)
+QORDER(663)
+QORDER(812)
+QORDER(551)
+QORDER(177)
+QORDER(454)
+QORDER(211)
+QORDER(532)
+QORDER(640)
+QORDER(749)
+QORDER(388)
+QORDER(675)
+QORDER(712)
+QORDER(764)
+QORDER(26)
+QORDER(60)
+QORDER(142)
+QORDER(242)
+QORDER(496)
+QORDER(729)
+QORDER(12)
+QORDER(189)
+QORDER(839)
+QORDER(308)
+QORDER(477)
+QORDER(510)
+QORDER(548)
+QORDER(743)
+QORDER(843)
+QORDER(331)
+QORDER(375)
+QORDER(568)
+QORDER(778)
+QORDER(182)
+QORDER(498)
+QORDER(574)
+QORDER(683)
+QORDER(480)
+QORDER(802)
+QORDER(229)
+QORDER(245)
+QORDER(582)
+QORDER(621)
+QORDER(147)
+QORDER(338)
+QORDER(452)
+QORDER(508)
+QORDER(697)
+QORDER(600)
+QORDER(832)
+QORDER(64)
+QORDER(361)
+QORDER(468)
+QORDER(507)
+QORDER(643)
+QORDER(336)
+QORDER(346)
+QORDER(483)
+QORDER(500)
+QORDER(181)
+QORDER(554)
+QORDER(586)
+QORDER(24)
+QORDER(137)
+QORDER(297)
+QORDER(703)
+QORDER(2)
+QORDER(374)
+QORDER(464)
+QORDER(490)
+QORDER(92)
+QORDER(243)
+QORDER(70)
+QORDER(415)
+QORDER(163)
+QORDER(256)
+QORDER(337)
+QORDER(400)
+QORDER(529)
+QORDER(616)
+QORDER(731)
+QORDER(671)
+QORDER(793)
+QORDER(180)
+QORDER(738)
+QORDER(192)
+QORDER(246)
+QORDER(49)
+QORDER(253)
+QORDER(343)
+QORDER(827)
+QORDER(371)
+QORDER(522)
+QORDER(40)
+QORDER(172)
+QORDER(276)
+QORDER(572)
+QORDER(744)
+QORDER(199)
+QORDER(427)
+QORDER(656)
+QORDER(4)
+QORDER(146)
+QORDER(316)
+QORDER(319)
+QORDER(401)
+QORDER(505)
+QORDER(288)
+QORDER(291)
+QORDER(547)
+QORDER(670)
+QORDER(565)
+QORDER(588)
+QORDER(664)
+QORDER(668)
+QORDER(705)
+QORDER(830)
+QORDER(238)
+QORDER(261)
+QORDER(669)
+QORDER(109)
+QORDER(390)
+QORDER(558)
+QORDER(578)
+QORDER(741)
+QORDER(803)
+QORDER(807)
+QORDER(851)
+QORDER(6)
+QORDER(661)
+QORDER(241)
+QORDER(672)
+QORDER(695)
+QORDER(89)
+QORDER(514)
+QORDER(21)
+QORDER(320)
+QORDER(847)
+QORDER(5)
+QORDER(103)
+QORDER(117)
+QORDER(553)
+QORDER(848)
+QORDER(34)
+QORDER(311)
+QORDER(484)
+QORDER(519)
+QORDER(718)
+QORDER(516)
+QORDER(736)
+QORDER(278)
+QORDER(512)
+QORDER(841)
+QORDER(52)
+QORDER(499)
+QORDER(567)
+QORDER(57)
+QORDER(166)
+QORDER(262)
+QORDER(433)
+QORDER(817)
+QORDER(55)
+QORDER(544)
+QORDER(625)
+QORDER(644)
+QORDER(31)
+QORDER(421)
+QORDER(434)
+QORDER(767)
+QORDER(164)
+QORDER(612)
+QORDER(794)
+QORDER(328)
+QORDER(341)
+QORDER(365)
+QORDER(409)
+QORDER(289)
+QORDER(592)
+QORDER(681)
+QORDER(80)
+QORDER(240)
+QORDER(358)
+QORDER(455)
+QORDER(436)
+QORDER(481)
+QORDER(642)
+QORDER(88)
+QORDER(150)
+QORDER(158)
+QORDER(187)
+QORDER(737)
+QORDER(796)
+QORDER(595)
+QORDER(399)
+QORDER(424)
+QORDER(259)
+QORDER(785)
+QORDER(48)
+QORDER(573)
+QORDER(725)
+QORDER(376)
+QORDER(653)
+QORDER(783)
+QORDER(458)
+QORDER(708)
+QORDER(775)
+QORDER(791)
+QORDER(296)
+QORDER(566)
+QORDER(135)
+QORDER(292)
+QORDER(74)
+QORDER(347)
+QORDER(593)
+QORDER(710)
+QORDER(9)
+QORDER(104)
+QORDER(185)
+QORDER(190)
+QORDER(232)
+QORDER(254)
+QORDER(96)
+QORDER(537)
+QORDER(651)
+QORDER(309)
+QORDER(472)
+QORDER(497)
+QORDER(850)
+QORDER(735)
+QORDER(829)
+QORDER(298)
+QORDER(720)
+QORDER(366)
+QORDER(559)
+QORDER(550)
+QORDER(617)
+QORDER(3)
+QORDER(42)
+QORDER(563)
+QORDER(641)
+QORDER(706)
+QORDER(412)
+QORDER(422)
+QORDER(492)
+QORDER(615)
+QORDER(702)
+QORDER(449)
+QORDER(627)
+QORDER(701)
+QORDER(750)
+QORDER(798)
+QORDER(819)
+QORDER(601)
+QORDER(694)
+QORDER(155)
+QORDER(186)
+QORDER(339)
+QORDER(349)
+QORDER(69)
+QORDER(159)
+QORDER(302)
+QORDER(342)
+QORDER(463)
+QORDER(521)
+QORDER(811)
+QORDER(100)
+QORDER(758)
+QORDER(56)
+QORDER(97)
+QORDER(188)
+QORDER(294)
+QORDER(407)
+QORDER(438)
+QORDER(453)
+QORDER(815)
+QORDER(90)
+QORDER(125)
+QORDER(145)
+QORDER(161)
+QORDER(585)
+QORDER(790)
+QORDER(77)
+QORDER(569)
+QORDER(761)
+QORDER(114)
+QORDER(138)
+QORDER(429)
+QORDER(598)
+QORDER(752)
+QORDER(45)
+QORDER(557)
+QORDER(373)
+QORDER(382)
+QORDER(696)
+QORDER(665)
+QORDER(784)
+QORDER(7)
+QORDER(707)
+QORDER(121)
+QORDER(143)
+QORDER(267)
+QORDER(317)
+QORDER(392)
+QORDER(649)
+QORDER(715)
+QORDER(842)
+QORDER(72)
+QORDER(87)
+QORDER(193)
+QORDER(491)
+QORDER(501)
+QORDER(623)
+QORDER(61)
+QORDER(589)
+QORDER(689)
+QORDER(520)
+QORDER(154)
+QORDER(167)
+QORDER(169)
+QORDER(370)
+QORDER(773)
+QORDER(808)
+QORDER(227)
+QORDER(304)
+QORDER(457)
+QORDER(515)
+QORDER(724)
+QORDER(47)
+QORDER(111)
+QORDER(176)
+QORDER(414)
+QORDER(213)
+QORDER(506)
+QORDER(571)
+QORDER(579)
+QORDER(687)
+QORDER(700)
+QORDER(762)
+QORDER(834)
+QORDER(350)
+QORDER(517)
+QORDER(523)
+QORDER(611)
+QORDER(636)
+QORDER(204)
+QORDER(248)
+QORDER(439)
+QORDER(513)
+QORDER(613)
+QORDER(325)
+QORDER(420)
+QORDER(482)
+QORDER(113)
+QORDER(314)
+QORDER(447)
+QORDER(466)
+QORDER(474)
+QORDER(610)
+QORDER(781)
+QORDER(19)
+QORDER(397)
+QORDER(763)
+QORDER(29)
+QORDER(130)
+QORDER(118)
+QORDER(624)
+QORDER(637)
+QORDER(686)
+QORDER(132)
+QORDER(235)
+QORDER(391)
+QORDER(465)
+QORDER(504)
+QORDER(714)
+QORDER(772)
+QORDER(141)
+QORDER(247)
+QORDER(396)
+QORDER(629)
+QORDER(645)
+QORDER(709)
+QORDER(538)
+QORDER(564)
+QORDER(788)
+QORDER(704)
+QORDER(770)
+QORDER(771)
+QORDER(156)
+QORDER(305)
+QORDER(467)
+QORDER(667)
+QORDER(384)
+QORDER(395)
+QORDER(604)
+QORDER(222)
+QORDER(460)
+QORDER(476)
+QORDER(44)
+QORDER(68)
+QORDER(179)
+QORDER(217)
+QORDER(727)
+QORDER(747)
+QORDER(101)
+QORDER(383)
+QORDER(818)
+QORDER(200)
+QORDER(658)
+QORDER(335)
+QORDER(607)
+QORDER(73)
+QORDER(426)
+QORDER(732)
+QORDER(840)
+QORDER(699)
+QORDER(20)
+QORDER(23)
+QORDER(102)
+QORDER(252)
+QORDER(293)
+QORDER(597)
+QORDER(814)
+QORDER(655)
+QORDER(112)
+QORDER(531)
+QORDER(716)
+QORDER(789)
+QORDER(835)
+QORDER(838)
+QORDER(165)
+QORDER(769)
+QORDER(134)
+QORDER(717)
+QORDER(441)
+QORDER(816)
+QORDER(133)
+QORDER(301)
+QORDER(306)
+QORDER(489)
+QORDER(41)
+QORDER(51)
+QORDER(299)
+QORDER(755)
+QORDER(62)
+QORDER(95)
+QORDER(255)
+QORDER(271)
+QORDER(327)
+QORDER(622)
+QORDER(740)
+QORDER(360)
+QORDER(411)
+QORDER(650)
+QORDER(722)
+QORDER(828)
+QORDER(381)
+QORDER(536)
+QORDER(682)
+QORDER(380)
+QORDER(853)
+QORDER(730)
+QORDER(35)
+QORDER(334)
+QORDER(801)
+QORDER(806)
+QORDER(198)
+QORDER(533)
+QORDER(36)
+QORDER(231)
+QORDER(362)
+QORDER(795)
+QORDER(820)
+QORDER(470)
+QORDER(673)
+QORDER(313)
+QORDER(456)
+QORDER(691)
+QORDER(693)
+QORDER(836)
+QORDER(425)
+QORDER(469)
+QORDER(648)
+QORDER(674)
+QORDER(273)
+QORDER(430)
+QORDER(528)
+QORDER(605)
+QORDER(822)
+QORDER(16)
+QORDER(63)
+QORDER(197)
+QORDER(257)
+QORDER(348)
+QORDER(591)
+QORDER(690)
+QORDER(849)
+QORDER(810)
+QORDER(127)
+QORDER(353)
+QORDER(8)
+QORDER(76)
+QORDER(526)
+QORDER(98)
+QORDER(386)
+QORDER(599)
+QORDER(11)
+QORDER(157)
+QORDER(356)
+QORDER(639)
+QORDER(652)
+QORDER(660)
+QORDER(545)
+QORDER(733)
+QORDER(787)
+QORDER(823)
+QORDER(22)
+QORDER(43)
+QORDER(226)
+QORDER(270)
+QORDER(300)
+QORDER(552)
+#endif